@@ -0,0 +1,414 @@
+//This file is part of Bertini 2.
+//
+//ball_arithmetic.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//ball_arithmetic.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with ball_arithmetic.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file ball_arithmetic.hpp
+
+\brief Complex ball arithmetic, a midpoint in double or multiple precision and a radius in double, for enclosing the values of functions over regions.
+
+A ball is the closed disk of its radius about its midpoint.  Each operation returns a ball containing every value of the operation on numbers in the balls of its arguments.  The midpoint is computed in the number type of the midpoint, as usual, and the radius bounds both the spread of the arguments and the rounding error of the midpoint, in units of roundoff of the midpoint's precision.  Radii are computed in double, rounded to nearest and then enlarged by a few units, in place of directed rounding.
+
+The enclosures rest on each operation of the number type being accurate to a few units in the last place, which holds for MPFR, and for the arithmetic and the elementary functions of common C++ libraries.  A ball whose function has a branch cut or pole within it gets an infinite radius.
+*/
+
+#ifndef BERTINI_BALL_ARITHMETIC_HPP
+#define BERTINI_BALL_ARITHMETIC_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/num_traits.hpp"
+
+#include <Eigen/Core>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <ostream>
+
+
+namespace bertini {
+
+	namespace detail {
+
+		// the radius calculations, in double, with the midpoint rounded to double
+		namespace ball {
+
+			inline dbl ToDouble(dbl const& z)
+			{
+				return z;
+			}
+
+			inline dbl ToDouble(mpfr const& z)
+			{
+				return static_cast<dbl>(z);
+			}
+
+			// the relative rounding error of one correctly rounded operation, doubled
+			inline double UnitRoundoff(dbl const&)
+			{
+				return std::numeric_limits<double>::epsilon();
+			}
+
+			inline double UnitRoundoff(mpfr const& z)
+			{
+				return std::pow(10.0, 1 - int(Precision(z)));
+			}
+
+			// rounded up and down, past the rounding error of a few double operations
+			inline double Up(double x)
+			{
+				return x*(1 + 8*std::numeric_limits<double>::epsilon()) + std::numeric_limits<double>::denorm_min();
+			}
+
+			inline double Down(double x)
+			{
+				return x*(1 - 8*std::numeric_limits<double>::epsilon()) - std::numeric_limits<double>::denorm_min();
+			}
+
+			constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+		} // re: ball
+	} // re: detail
+
+
+
+	/**
+	\brief A complex ball, the disk of a radius about a midpoint.
+
+	\tparam T The number type of the midpoint.  dbl or mpfr.  Multiple precision midpoints are computed at the precision of their arguments.
+	*/
+	template<typename T>
+	class Ball
+	{
+	public:
+
+		Ball() : mid_(0), rad_(0)
+		{}
+
+		/**
+		\brief The ball of a radius about a midpoint.  By default, the point itself.
+		*/
+		Ball(T const& mid, double rad = 0) : mid_(mid), rad_(rad)
+		{}
+
+		T const& Mid() const
+		{
+			return mid_;
+		}
+
+		double Rad() const
+		{
+			return rad_;
+		}
+
+		/**
+		\brief Whether the ball is bounded.  Unbounded balls come of division by balls containing 0, and functions of balls meeting their branch cuts.
+		*/
+		bool IsFinite() const
+		{
+			return std::isfinite(rad_);
+		}
+
+		/**
+		\brief Whether a number is in the ball.
+		*/
+		bool Contains(T const& z) const
+		{
+			return std::abs(detail::ball::ToDouble(z - mid_)) <= rad_;
+		}
+
+		/**
+		\brief An upper bound of the moduli of the numbers in the ball.
+		*/
+		double Magnitude() const
+		{
+			using namespace detail::ball;
+			return Up(std::abs(ToDouble(mid_)) + rad_);
+		}
+
+		/**
+		\brief A lower bound of the moduli of the numbers in the ball.  0 if the ball may contain 0.
+		*/
+		double Mignitude() const
+		{
+			using namespace detail::ball;
+			return std::max(0.0, Down(std::abs(ToDouble(mid_)) - rad_));
+		}
+
+		/**
+		\brief Whether the ball is clear of the nonpositive real numbers, the branch cut of log and sqrt.
+		*/
+		bool AvoidsNonPositiveReals() const
+		{
+			using namespace detail::ball;
+			dbl m = ToDouble(mid_);
+			double distance = m.real() >= 0 ? std::abs(m) : std::abs(m.imag());
+			return Down(distance) > rad_;
+		}
+
+		/**
+		\brief The ball about a computed midpoint, enlarged by a number of units of rounding error of the midpoint.
+
+		\param mid The midpoint, as computed.
+		\param rad The radius, before rounding error.
+		\param ulps The rounding errors of the midpoint, in units of roundoff relative to its modulus.
+		\param absolute Units of roundoff to add regardless of the modulus, for functions whose relative error may be large where they are small.
+		*/
+		static Ball Rounded(T const& mid, double rad, double ulps, double absolute = 0)
+		{
+			using namespace detail::ball;
+			double m = std::abs(ToDouble(mid));
+			if (!std::isfinite(m) || std::isnan(rad))
+				return Ball(mid, Infinity);
+			return Ball(mid, Up(rad + Up(ulps*m + absolute)*UnitRoundoff(mid)));
+		}
+
+		friend Ball operator+(Ball const& a, Ball const& b)
+		{
+			return Rounded(a.mid_ + b.mid_, detail::ball::Up(a.rad_ + b.rad_), 1);
+		}
+
+		friend Ball operator-(Ball const& a, Ball const& b)
+		{
+			return Rounded(a.mid_ - b.mid_, detail::ball::Up(a.rad_ + b.rad_), 1);
+		}
+
+		friend Ball operator-(Ball const& a)
+		{
+			return Ball(-a.mid_, a.rad_);
+		}
+
+		friend Ball operator*(Ball const& a, Ball const& b)
+		{
+			using namespace detail::ball;
+			double am = std::abs(ToDouble(a.mid_)), bm = std::abs(ToDouble(b.mid_));
+			return Rounded(a.mid_ * b.mid_, Up(Up(am*b.rad_) + Up(bm*a.rad_) + Up(a.rad_*b.rad_)), 4);
+		}
+
+		/**
+		Over the balls, \f$|x/y - a/b| \le (r_a + |a/b| r_b)/(|b| - r_b)\f$.
+		*/
+		friend Ball operator/(Ball const& a, Ball const& b)
+		{
+			using namespace detail::ball;
+			double denominator = b.Mignitude();
+			if (denominator <= 0)
+				return Ball(a.mid_, Infinity);
+
+			T c = a.mid_ / b.mid_;
+			return Rounded(c, Up(Up(a.rad_ + Up(std::abs(ToDouble(c))*b.rad_)) / denominator), 8);
+		}
+
+		Ball& operator+=(Ball const& other)
+		{
+			return *this = *this + other;
+		}
+
+		Ball& operator-=(Ball const& other)
+		{
+			return *this = *this - other;
+		}
+
+		Ball& operator*=(Ball const& other)
+		{
+			return *this = *this * other;
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, Ball const& a)
+		{
+			return out << "[" << a.mid_ << " +/- " << a.rad_ << "]";
+		}
+
+	private:
+
+		T mid_;
+		double rad_;
+	};
+
+
+
+	/**
+	\brief An integer power of a ball, by repeated squaring.
+	*/
+	template<typename T>
+	Ball<T> pow(Ball<T> const& a, int n)
+	{
+		if (n < 0)
+			return Ball<T>(T(1)) / pow(a, -n);
+
+		Ball<T> result(T(1)), square(a);
+		while (n > 0)
+		{
+			if (n & 1)
+				result = result * square;
+			n >>= 1;
+			if (n > 0)
+				square = square * square;
+		}
+		return result;
+	}
+
+	/**
+	\brief The principal power of a ball, as exp(b log a).
+	*/
+	template<typename T>
+	Ball<T> pow(Ball<T> const& a, Ball<T> const& b)
+	{
+		return exp(b * log(a));
+	}
+
+	/**
+	Over the ball, \f$|e^z - e^m| \le |e^m| (e^r - 1)\f$.
+	*/
+	template<typename T>
+	Ball<T> exp(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::exp;
+		T c = exp(a.Mid());
+		return Ball<T>::Rounded(c, Up(Up(std::abs(ToDouble(c))) * Up(std::expm1(a.Rad()))), 8, 1);
+	}
+
+	/**
+	Over a ball clear of the branch cut, \f$|\log z - \log m| \le r/(|m| - r)\f$.
+	*/
+	template<typename T>
+	Ball<T> log(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::log;
+		if (!a.AvoidsNonPositiveReals())
+			return Ball<T>(a.Mid(), Infinity);
+		return Ball<T>::Rounded(log(a.Mid()), Up(a.Rad() / a.Mignitude()), 8, 1);
+	}
+
+	/**
+	Over a ball clear of the branch cut, the derivative is at most \f$1/(2\sqrt{|m| - r})\f$.
+	*/
+	template<typename T>
+	Ball<T> sqrt(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::sqrt;
+		if (a.Rad()==0 && a.Mid()==T(0))
+			return a;
+		if (!a.AvoidsNonPositiveReals())
+			return Ball<T>(a.Mid(), Infinity);
+		return Ball<T>::Rounded(sqrt(a.Mid()), Up(a.Rad() / Down(2*std::sqrt(a.Mignitude()))), 8, 1);
+	}
+
+	/**
+	Over the ball, the derivatives of sine and cosine are at most \f$\cosh(|\Im m| + r)\f$.
+	*/
+	template<typename T>
+	Ball<T> sin(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::sin;
+		double slope = Up(std::cosh(Up(std::abs(ToDouble(a.Mid()).imag()) + a.Rad())));
+		return Ball<T>::Rounded(sin(a.Mid()), Up(a.Rad()*slope), 8, 1);
+	}
+
+	template<typename T>
+	Ball<T> cos(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::cos;
+		double slope = Up(std::cosh(Up(std::abs(ToDouble(a.Mid()).imag()) + a.Rad())));
+		return Ball<T>::Rounded(cos(a.Mid()), Up(a.Rad()*slope), 8, 1);
+	}
+
+	template<typename T>
+	Ball<T> tan(Ball<T> const& a)
+	{
+		return sin(a) / cos(a);
+	}
+
+	/**
+	The branch cuts of arcsine and arccosine are where \f$1-z^2\f$ is nonpositive real, and the derivatives are at most \f$1/\sqrt{|1-z^2|}\f$.
+	*/
+	template<typename T>
+	Ball<T> asin(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::asin;
+		auto q = Ball<T>(T(1)) - a*a;
+		if (!q.AvoidsNonPositiveReals())
+			return Ball<T>(asin(a.Mid()), Infinity);
+		return Ball<T>::Rounded(asin(a.Mid()), Up(a.Rad() / Down(std::sqrt(q.Mignitude()))), 8, 1);
+	}
+
+	template<typename T>
+	Ball<T> acos(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::acos;
+		auto q = Ball<T>(T(1)) - a*a;
+		if (!q.AvoidsNonPositiveReals())
+			return Ball<T>(acos(a.Mid()), Infinity);
+		return Ball<T>::Rounded(acos(a.Mid()), Up(a.Rad() / Down(std::sqrt(q.Mignitude()))), 8, 1);
+	}
+
+	/**
+	The branch cuts of arctangent are where \f$1+z^2\f$ is nonpositive real, and the derivative is at most \f$1/|1+z^2|\f$.
+	*/
+	template<typename T>
+	Ball<T> atan(Ball<T> const& a)
+	{
+		using namespace detail::ball;
+		using std::atan;
+		auto q = Ball<T>(T(1)) + a*a;
+		if (!q.AvoidsNonPositiveReals())
+			return Ball<T>(atan(a.Mid()), Infinity);
+		return Ball<T>::Rounded(atan(a.Mid()), Up(a.Rad() / q.Mignitude()), 8, 1);
+	}
+
+} // re: namespace bertini
+
+
+
+namespace Eigen {
+
+	/**
+	\brief Permits bertini::Ball in Eigen matrices, for storage.  Ball matrices have no linear algebra.
+	*/
+	template<typename T> struct NumTraits<bertini::Ball<T> > : GenericNumTraits<bertini::Ball<T> >
+	{
+		typedef bertini::Ball<T> Real;
+		typedef bertini::Ball<T> NonInteger;
+		typedef bertini::Ball<T> Nested;
+		typedef bertini::Ball<T> Literal;
+		enum {
+			IsComplex = 1,
+			IsInteger = 0,
+			IsSigned = 1,
+			RequireInitialization = 1,
+			ReadCost = 2 * NumTraits<T>::ReadCost,
+			AddCost = 2 * NumTraits<T>::AddCost,
+			MulCost = 2 * NumTraits<T>::MulCost
+		};
+	};
+
+} // re: namespace Eigen
+
+#endif
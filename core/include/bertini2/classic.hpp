@@ -33,6 +33,7 @@
 
 
 #include "bertini2/classic/parsing.hpp"
+#include "bertini2/classic/input_file.hpp"
 
 
 
@@ -0,0 +1,64 @@
+//This file is part of Bertini 2.
+//
+//input_file.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//input_file.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with input_file.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file input_file.hpp
+
+\brief Reading of Classic mode input files straight from a stream.
+*/
+
+#ifndef BERTINI_CLASSIC_INPUT_FILE_HPP
+#define BERTINI_CLASSIC_INPUT_FILE_HPP
+
+#include <istream>
+
+#include <boost/filesystem.hpp>
+
+#include "bertini2/classic/parsing.hpp"
+
+namespace bertini
+{
+	namespace classic
+	{
+		/**
+		\brief Read a Classic input file, removing comments and splitting it into config and input, in one pass.
+
+		The stream is read in fixed-size chunks.  Comments, from % to the end of the line, are dropped as each chunk is read, so the only full-size buffer is the uncommented text, which becomes the input part of the result without being copied.  The split into config and input follows parsing::SplitFileInputConfig, case for case.  The only difference is that CONFIG, INPUT, or END; inside a comment is ignored, because comments are removed first.
+
+		\param in The stream to read from, until its end.
+		\return The config and input, without comments.  Not Readable() if the file is laid out in a way SplitFileInputConfig cannot split.
+		*/
+		SplitInputFile ReadInputFile(std::istream & in);
+
+		/**
+		\brief Read a Classic input file from disk.  See ReadInputFile(std::istream &).
+
+		\throws std::runtime_error If the file cannot be opened.
+		*/
+		SplitInputFile ReadInputFile(boost::filesystem::path const& file);
+
+	} // re: namespace classic
+} // re: namespace bertini
+
+#endif
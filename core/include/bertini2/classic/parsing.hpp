@@ -55,6 +55,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 
 namespace bertini
@@ -69,12 +70,12 @@ namespace bertini
             bool readable_ = true; //Input file can be split accurately
 		public:
 
-			std::string Config() const
+			std::string const& Config() const
 			{
 				return config_;
 			}
 
-			std::string Input() const
+			std::string const& Input() const
 			{
 				return input_;
 			}
@@ -87,18 +88,18 @@ namespace bertini
 
 			void SetInput(std::string new_input)
 			{
-				input_ = new_input;
+				input_ = std::move(new_input);
 			}
 
 			void SetConfig(std::string new_config)
 			{
-				config_ = new_config;
+				config_ = std::move(new_config);
 			}
 
 			void SetConfigInput(std::string c, std::string i)
 			{
-				config_ = c;
-				input_ = i;
+				config_ = std::move(c);
+				input_ = std::move(i);
 			}
             
             void SetReadable(bool read)
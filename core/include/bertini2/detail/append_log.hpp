@@ -0,0 +1,182 @@
+//This file is part of Bertini 2.
+//
+//append_log.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//append_log.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with append_log.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file append_log.hpp
+
+\brief Provides an append-only log of serialized entries, which survives being killed mid-write.
+*/
+
+#ifndef BERTINI_DETAIL_APPEND_LOG_HPP
+#define BERTINI_DETAIL_APPEND_LOG_HPP
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief A file to which entries are only ever appended, each a kind and a Boost binary archive of an object.
+
+	Each entry is written as its kind, its length, and its archive, and flushed, so appending costs only the size of the entry, however long the log.  A process killed while appending leaves at most one incomplete entry at the end, which is ignored when reading, and cut off when the log is next opened for appending.
+
+	Binary archives are not portable, so a log should be read on the machine type which wrote it.
+
+	\code
+	AppendLog log(file);
+	log.Append(1, some_serializable_thing);
+
+	AppendLog::Read(file, [](std::uint8_t kind, boost::archive::binary_iarchive & ar)
+		{
+			if (kind==1)
+			{
+				SomeType thing;
+				ar >> thing;
+			}
+		});
+	\endcode
+	*/
+	class AppendLog
+	{
+		using SizeT = std::uint64_t;
+
+	public:
+
+		/**
+		\brief Open a log for appending, creating it if it does not exist.
+
+		\throws std::runtime_error If the file cannot be opened.
+		*/
+		explicit
+		AppendLog(boost::filesystem::path const& file)
+		{
+			if (boost::filesystem::exists(file))
+			{
+				auto valid = ReadEntries(file, [](std::uint8_t, std::istream &){});
+				if (valid < boost::filesystem::file_size(file))
+					boost::filesystem::resize_file(file, valid);
+			}
+
+			out_.open(file.string(), std::ios::binary | std::ios::app);
+			if (!out_)
+				throw std::runtime_error("unable to open log file " + file.string());
+		}
+
+		/**
+		\brief Append an entry, and flush it to the file.  Safe to call from several threads at once.
+
+		\param kind A tag for the reader, saying what type the entry is.
+		\param entry The object to write.  Must be serializable.
+		*/
+		template<typename T>
+		void Append(std::uint8_t kind, T const& entry)
+		{
+			std::ostringstream buffer;
+			{
+				boost::archive::binary_oarchive ar(buffer, boost::archive::no_header);
+				ar << entry;
+			}
+			auto data = buffer.str();
+			SizeT size = data.size();
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			out_.write(reinterpret_cast<char const*>(&kind), sizeof(kind));
+			out_.write(reinterpret_cast<char const*>(&size), sizeof(size));
+			out_.write(data.data(), data.size());
+			out_.flush();
+			if (!out_)
+				throw std::runtime_error("unable to append to log file");
+		}
+
+		/**
+		\brief Read the complete entries of a log, in the order they were appended.
+
+		\param file The log.  If it does not exist, there are no entries.
+		\param f Called as f(kind, archive) for each entry, which should read from the archive the type the kind says.
+		\return The number of complete entries.
+		*/
+		template<typename F>
+		static size_t Read(boost::filesystem::path const& file, F f)
+		{
+			size_t num_entries = 0;
+			if (!boost::filesystem::exists(file))
+				return num_entries;
+
+			ReadEntries(file, [&](std::uint8_t kind, std::istream & entry)
+				{
+					boost::archive::binary_iarchive ar(entry, boost::archive::no_header);
+					f(kind, ar);
+					++num_entries;
+				});
+			return num_entries;
+		}
+
+	private:
+
+		/**
+		Calls f(kind, stream) for each complete entry, and returns the length of the file they make up.
+		*/
+		template<typename F>
+		static std::uintmax_t ReadEntries(boost::filesystem::path const& file, F f)
+		{
+			std::ifstream in(file.string(), std::ios::binary);
+			std::uintmax_t valid = 0;
+
+			std::string data;
+			while (true)
+			{
+				std::uint8_t kind;
+				SizeT size;
+				if (!in.read(reinterpret_cast<char*>(&kind), sizeof(kind)) || !in.read(reinterpret_cast<char*>(&size), sizeof(size)))
+					break;
+
+				data.resize(size);
+				if (!in.read(&data[0], size))
+					break;
+
+				std::istringstream entry(data);
+				f(kind, entry);
+				valid += sizeof(kind) + sizeof(size) + size;
+			}
+			return valid;
+		}
+
+		std::ofstream out_;
+		std::mutex mutex_;
+	};
+
+	} // re: namespace detail
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,130 @@
+//This file is part of Bertini 2.
+//
+//close_points.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//close_points.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with close_points.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file close_points.hpp
+
+\brief Provides a spatial index for finding the pairs of a set of points closer than a tolerance, without comparing every pair.
+*/
+
+#ifndef BERTINI_DETAIL_CLOSE_POINTS_HPP
+#define BERTINI_DETAIL_CLOSE_POINTS_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief Finds the pairs of points closer together than a tolerance, in the 2-norm.
+
+	The points are sorted by their projection onto a fixed unit direction, which moves no further apart than the points themselves, and each is compared only with those after it whose projections are within the tolerance.  So for points spread out compared to the tolerance, as the endpoints of distinct paths are, this takes \f$O(n \log n)\f$ operations rather than the \f$O(n^2)\f$ of comparing every pair.  The direction has distinct weights on the coordinates, so that points differing by a permutation of their coordinates do not project together.
+
+	Projections are compared in double precision, with a margin, and only the pairs they leave are compared in the precision of the points.  The comparisons are shared between threads, each at the default precision of the calling thread.
+
+	\param points The points.  Empty ones, such as those of failed paths, are skipped.  Need not be of one size, or precision; only points of the same size are compared.
+	\param tolerance The distance under which a pair is close.
+	\param num_threads The number of threads to compare on, including the calling thread.
+	\return The pairs of indices of close points, each with the smaller index first, sorted.
+	*/
+	template<typename ComplexType, typename RealType>
+	std::vector<std::pair<size_t, size_t>> ClosePairs(std::vector<Vec<ComplexType>> const& points, RealType const& tolerance, unsigned num_threads = 1)
+	{
+		using std::abs;
+		using std::real;
+		using std::sqrt;
+
+		size_t max_size = 0;
+		for (auto const& p : points)
+			max_size = std::max(max_size, size_t(p.size()));
+
+		std::vector<double> direction(max_size);
+		double norm_squared = 0;
+		for (size_t jj = 0; jj < max_size; ++jj)
+		{
+			direction[jj] = 1 + 1/std::sqrt(double(jj+2));
+			norm_squared += direction[jj]*direction[jj];
+		}
+		for (auto& d : direction)
+			d /= std::sqrt(norm_squared);
+
+		std::vector<std::pair<double, size_t>> projections;
+		for (size_t ii = 0; ii < points.size(); ++ii)
+		{
+			auto const& p = points[ii];
+			if (p.size()==0)
+				continue;
+			double projection = 0;
+			for (size_t jj = 0; jj < size_t(p.size()); ++jj)
+				projection += direction[jj] * static_cast<double>(real(p(jj)));
+			projections.emplace_back(projection, ii);
+		}
+		std::sort(projections.begin(), projections.end());
+
+		const double window = static_cast<double>(tolerance) * (1 + 1e-8) + 1e-300;
+		num_threads = std::max(1u, std::min(num_threads, unsigned(projections.size()/1024 + 1)));
+		const auto precision = DefaultPrecision();
+
+		// thread t takes every num_threads'th point, so that clumps of close points are shared out
+		std::vector<std::vector<std::pair<size_t, size_t>>> found(num_threads);
+		auto sweep = [&](unsigned t)
+			{
+				DefaultPrecision(precision);
+				for (size_t ii = t; ii < projections.size(); ii += num_threads)
+					for (size_t jj = ii+1; jj < projections.size() && projections[jj].first - projections[ii].first <= window; ++jj)
+					{
+						auto a = projections[ii].second, b = projections[jj].second;
+						if (points[a].size()!=points[b].size())
+							continue;
+						if ((points[a]-points[b]).norm() < tolerance)
+							found[t].emplace_back(std::min(a,b), std::max(a,b));
+					}
+			};
+
+		std::vector<std::thread> threads;
+		for (unsigned t = 1; t < num_threads; ++t)
+			threads.emplace_back(sweep, t);
+		sweep(0);
+		for (auto& th : threads)
+			th.join();
+
+		std::vector<std::pair<size_t, size_t>> pairs;
+		for (auto& f : found)
+			pairs.insert(pairs.end(), f.begin(), f.end());
+		std::sort(pairs.begin(), pairs.end());
+		return pairs;
+	}
+
+	} // namespace detail
+} // namespace bertini
+
+#endif
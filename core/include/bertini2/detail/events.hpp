@@ -42,6 +42,7 @@
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
 #include <boost/type_index.hpp>
+#include <atomic>
 namespace bertini {
 
 	/**
@@ -58,9 +59,9 @@ namespace bertini {
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Observers say which exact event types they want, see AnyObserver::Subscribes, and the observable only makes an event if some observer wants it.  Within Observe, observers may further filter the events they get, by dynamic casting along the hierarchy of event types, or more cheaply by comparing `typeid`s.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers<Event<T>>(*this)`, passing the arguments of the event's constructor.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -98,6 +99,27 @@ namespace bertini {
 		
 	};
 
+	namespace detail{
+
+		inline
+		unsigned NextEventTypeId()
+		{
+			static std::atomic<unsigned> next_id{0};
+			return next_id++;
+		}
+
+		/**
+		\brief A small integer unique to an event type, assigned on first use, for indexing tables of subscribers without hashing.
+		*/
+		template<typename EventT>
+		unsigned EventTypeId()
+		{
+			static const unsigned id = NextEventTypeId();
+			return id;
+		}
+	}
+
+
 	/**
 	\brief Defines a new event type in a hierarchy
 
@@ -0,0 +1,427 @@
+//This file is part of Bertini 2.
+//
+//mixed_cells.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mixed_cells.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mixed_cells.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mixed_cells.hpp
+
+\brief Provides the mixed cells of a lifting of the supports of a square polynomial system, whose volumes sum to its mixed volume, and the solutions of the binomial systems they give.
+*/
+
+#ifndef BERTINI_DETAIL_MIXED_CELLS_HPP
+#define BERTINI_DETAIL_MIXED_CELLS_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief The exponents of the monomials of a polynomial, each with an entry for each variable.
+	*/
+	using Support = std::vector< std::vector<unsigned> >;
+
+
+	/**
+	\brief A mixed cell of a fine mixed subdivision of the Minkowski sum of the supports of a square system.
+
+	A cell chooses an edge, two points, of each lifted support, such that for its inner normal \f$\alpha\f$ the two points minimize \f$\langle a, \alpha \rangle + w(a)\f$ over the support, and no other point does.
+	*/
+	struct MixedCell
+	{
+		std::vector< std::pair<unsigned, unsigned> > edges; ///< The indices in each support of the two points of the cell.
+		std::vector<double> inner_normal; ///< The \f$\alpha\f$, for which the edges are the lowest points of the lifted supports.
+		unsigned long volume = 0; ///< The absolute determinant of the differences of the points of the edges, the number of solutions of the binomial system of the cell.
+
+		template <typename Archive>
+		void serialize(Archive& ar, const unsigned version)
+		{
+			ar & edges;
+			ar & inner_normal;
+			ar & volume;
+		}
+	};
+
+
+	/**
+	\brief Whether there is an \f$x\f$ with \f$E x = f\f$ and \f$G x \geq h\f$, the rows of E and G with the right hand sides appended.
+
+	Phase one of the simplex method, with Bland's rule, on the free variables split into positive and negative parts.  For the small dense problems of mixed cell enumeration.
+
+	\param equalities The rows of E, each with the entry of f appended.
+	\param inequalities The rows of G, each with the entry of h appended.
+	\param num_variables The number of columns of E and G.
+	\param tolerance The infeasibility below which a system counts as feasible, relative to the size of the right hand sides.
+	*/
+	inline
+	bool IsFeasible(std::vector< std::vector<double> > const& equalities, std::vector< std::vector<double> > const& inequalities, unsigned num_variables, double tolerance = 1e-9)
+	{
+		const unsigned n = num_variables;
+		const unsigned num_rows = equalities.size() + inequalities.size();
+		if (num_rows==0)
+			return true;
+
+		// columns: x+, x-, slacks of the inequalities, artificials, then the right hand side
+		const unsigned num_slacks = inequalities.size();
+		const unsigned num_columns = 2*n + num_slacks + num_rows;
+		const unsigned rhs = num_columns;
+		Eigen::MatrixXd tableau = Eigen::MatrixXd::Zero(num_rows+1, num_columns+1);
+		std::vector<unsigned> basis(num_rows);
+
+		double scale = 1;
+		for (unsigned r = 0; r < num_rows; ++r)
+		{
+			bool is_equality = r < equalities.size();
+			auto const& row = is_equality ? equalities[r] : inequalities[r-equalities.size()];
+			for (unsigned jj = 0; jj < n; ++jj)
+			{
+				tableau(r, jj) = row[jj];
+				tableau(r, n+jj) = -row[jj];
+			}
+			if (!is_equality)
+				tableau(r, 2*n + r - equalities.size()) = -1;
+			tableau(r, rhs) = row[n];
+
+			if (tableau(r, rhs) < 0)
+				tableau.row(r) *= -1;
+
+			tableau(r, 2*n + num_slacks + r) = 1;
+			basis[r] = 2*n + num_slacks + r;
+			scale = std::max(scale, std::abs(tableau(r, rhs)));
+		}
+
+		// the objective, the sum of the artificials, in terms of the others
+		for (unsigned r = 0; r < num_rows; ++r)
+			tableau.row(num_rows) += tableau.row(r);
+		for (unsigned r = 0; r < num_rows; ++r)
+			tableau(num_rows, 2*n + num_slacks + r) = 0;
+
+		const double pivot_tolerance = 1e-11;
+		for (unsigned iteration = 0; iteration < 50*num_columns; ++iteration)
+		{
+			unsigned entering = num_columns;
+			for (unsigned jj = 0; jj < num_columns; ++jj)
+				if (tableau(num_rows, jj) > pivot_tolerance)
+				{
+					entering = jj;
+					break;
+				}
+			if (entering==num_columns)
+				break;
+
+			unsigned leaving = num_rows;
+			double best_ratio = 0;
+			for (unsigned r = 0; r < num_rows; ++r)
+				if (tableau(r, entering) > pivot_tolerance)
+				{
+					double ratio = tableau(r, rhs) / tableau(r, entering);
+					if (leaving==num_rows || ratio < best_ratio || (ratio==best_ratio && basis[r] < basis[leaving]))
+					{
+						leaving = r;
+						best_ratio = ratio;
+					}
+				}
+			if (leaving==num_rows)
+				break; // cannot happen for a phase one objective, which is bounded below
+
+			tableau.row(leaving) /= tableau(leaving, entering);
+			for (unsigned r = 0; r <= num_rows; ++r)
+				if (r!=leaving && tableau(r, entering)!=0)
+					tableau.row(r) -= tableau(r, entering) * tableau.row(leaving);
+			basis[leaving] = entering;
+		}
+
+		return tableau(num_rows, rhs) < tolerance*scale;
+	}
+
+
+	// the row (a_p - a_q, w_q - w_p), making the lifted points p and q equally low
+	inline
+	std::vector<double> EdgeEquality(Support const& support, std::vector<double> const& lifting, unsigned p, unsigned q)
+	{
+		std::vector<double> row;
+		for (unsigned jj = 0; jj < support[p].size(); ++jj)
+			row.push_back(double(support[p][jj]) - double(support[q][jj]));
+		row.push_back(lifting[q] - lifting[p]);
+		return row;
+	}
+
+	// the rows (a - a_p, w_p - w_a) for the points a other than p and q, keeping them no lower
+	inline
+	void AppendEdgeInequalities(std::vector< std::vector<double> > & rows, Support const& support, std::vector<double> const& lifting, unsigned p, unsigned q)
+	{
+		for (unsigned a = 0; a < support.size(); ++a)
+		{
+			if (a==p || a==q)
+				continue;
+			std::vector<double> row;
+			for (unsigned jj = 0; jj < support[a].size(); ++jj)
+				row.push_back(double(support[a][jj]) - double(support[p][jj]));
+			row.push_back(lifting[p] - lifting[a]);
+			rows.push_back(std::move(row));
+		}
+	}
+
+	// depth first search for the mixed cells, choosing an edge of one support at each level
+	struct MixedCellSearch
+	{
+		std::vector<Support> const& supports;
+		std::vector< std::vector<double> > const& liftings;
+		std::vector< std::vector< std::pair<unsigned, unsigned> > > const& lower_edges;
+		std::vector<MixedCell> cells;
+
+		std::vector< std::pair<unsigned, unsigned> > edges;
+		std::vector< std::vector<double> > equalities, inequalities;
+
+		void Descend()
+		{
+			const unsigned n = supports.size();
+			const unsigned level = edges.size();
+			if (level==n)
+			{
+				Record();
+				return;
+			}
+
+			for (auto const& edge : lower_edges[level])
+			{
+				auto num_inequalities = inequalities.size();
+				equalities.push_back(EdgeEquality(supports[level], liftings[level], edge.first, edge.second));
+				AppendEdgeInequalities(inequalities, supports[level], liftings[level], edge.first, edge.second);
+				edges.push_back(edge);
+
+				if (IsFeasible(equalities, inequalities, n))
+					Descend();
+
+				edges.pop_back();
+				inequalities.resize(num_inequalities);
+				equalities.pop_back();
+			}
+		}
+
+		void Record()
+		{
+			const unsigned n = supports.size();
+			Eigen::MatrixXd E(n,n);
+			Eigen::VectorXd f(n);
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				for (unsigned jj = 0; jj < n; ++jj)
+					E(ii,jj) = equalities[ii][jj];
+				f(ii) = equalities[ii][n];
+			}
+
+			auto volume = std::llround(std::abs(E.determinant()));
+			if (volume==0)
+				return;
+
+			Eigen::VectorXd alpha = E.fullPivLu().solve(f);
+			MixedCell cell;
+			cell.edges = edges;
+			cell.inner_normal.assign(alpha.data(), alpha.data()+n);
+			cell.volume = static_cast<unsigned long>(volume);
+			cells.push_back(std::move(cell));
+		}
+	};
+
+
+	/**
+	\brief Finds the mixed cells of a lifting of the supports of a square system.
+
+	The cells are found by a depth first search over the lower edges of the lifted supports, one support at a time, keeping only those choices for which some inner normal makes every chosen edge lowest, as a linear program decides.  The choices for the first support are shared between threads.
+
+	For generic liftings, the cells are those of a fine mixed subdivision, and their volumes sum to the mixed volume of the supports, which by Bernstein's theorem is the number of solutions with no zero coordinate of a system with these supports and generic coefficients.
+
+	\param supports The support of each function.  As many functions as variables, each with at least two points.
+	\param liftings The lifting of each point of each support, generic, such as random numbers in [0,1].
+	\param num_threads The number of threads to search on, including the calling thread.
+	\return The mixed cells, in an order depending on the number of threads.
+	*/
+	inline
+	std::vector<MixedCell> MixedCells(std::vector<Support> const& supports, std::vector< std::vector<double> > const& liftings, unsigned num_threads = 1)
+	{
+		const unsigned n = supports.size();
+		if (n==0)
+			return {};
+
+		// the edges of each lifted support which are lowest for some inner normal, by itself
+		std::vector< std::vector< std::pair<unsigned, unsigned> > > lower_edges(n);
+		for (unsigned ii = 0; ii < n; ++ii)
+			for (unsigned p = 0; p < supports[ii].size(); ++p)
+				for (unsigned q = p+1; q < supports[ii].size(); ++q)
+				{
+					std::vector< std::vector<double> > inequalities;
+					AppendEdgeInequalities(inequalities, supports[ii], liftings[ii], p, q);
+					if (IsFeasible({EdgeEquality(supports[ii], liftings[ii], p, q)}, inequalities, n))
+						lower_edges[ii].emplace_back(p, q);
+				}
+
+		num_threads = std::max(1u, std::min(num_threads, unsigned(lower_edges[0].size())));
+
+		// thread t takes every num_threads'th edge of the first support
+		std::vector< std::vector<MixedCell> > found(num_threads);
+		auto search = [&](unsigned t)
+			{
+				auto edges = lower_edges;
+				edges[0].clear();
+				for (size_t e = t; e < lower_edges[0].size(); e += num_threads)
+					edges[0].push_back(lower_edges[0][e]);
+
+				MixedCellSearch s{supports, liftings, edges, {}, {}, {}, {}};
+				s.Descend();
+				found[t] = std::move(s.cells);
+			};
+
+		std::vector<std::thread> threads;
+		for (unsigned t = 1; t < num_threads; ++t)
+			threads.emplace_back(search, t);
+		search(0);
+		for (auto& th : threads)
+			th.join();
+
+		std::vector<MixedCell> cells;
+		for (auto& f : found)
+			cells.insert(cells.end(), f.begin(), f.end());
+		return cells;
+	}
+
+
+	/**
+	\brief The mixed volume of some supports, the sum of the volumes of the mixed cells of a lifting of them.
+	*/
+	inline
+	unsigned long MixedVolume(std::vector<MixedCell> const& cells)
+	{
+		unsigned long volume = 0;
+		for (auto const& c : cells)
+			volume += c.volume;
+		return volume;
+	}
+
+
+	/**
+	\brief The solutions of the binomial system \f$y^{v_i} = b_i\f$, where \f$v_i\f$ are the rows of an integer matrix V.
+
+	Unimodular column operations bring V to lower triangular form \f$L = V M\f$.  Then with \f$y = z^M\f$, the system is \f$z^{l_i} = b_i\f$, which is solved for one coordinate of z at a time, each with \f$|L_{ii}|\f$ roots.  So there are \f$|\det V|\f$ solutions, all with no zero coordinate.
+
+	\param V The exponents, square with nonzero determinant.
+	\param b The right hand sides, nonzero.
+	\return The solutions.
+	*/
+	template<typename T>
+	std::vector< Vec<T> > SolveBinomialSystem(std::vector< std::vector<long> > V, std::vector<T> const& b)
+	{
+		using std::abs;
+		using std::acos;
+		using std::arg;
+		using std::cos;
+		using std::pow;
+		using std::sin;
+
+		const unsigned n = V.size();
+		std::vector< std::vector<long> > M(n, std::vector<long>(n, 0));
+		for (unsigned ii = 0; ii < n; ++ii)
+			M[ii][ii] = 1;
+
+		auto subtract_column = [&](unsigned target, unsigned source, long multiple)
+			{
+				for (unsigned ii = 0; ii < n; ++ii)
+				{
+					V[ii][target] -= multiple*V[ii][source];
+					M[ii][target] -= multiple*M[ii][source];
+				}
+			};
+		auto swap_columns = [&](unsigned a, unsigned c)
+			{
+				for (unsigned ii = 0; ii < n; ++ii)
+				{
+					std::swap(V[ii][a], V[ii][c]);
+					std::swap(M[ii][a], M[ii][c]);
+				}
+			};
+
+		// euclid's algorithm along each row, clearing it right of the diagonal
+		for (unsigned r = 0; r < n; ++r)
+			for (unsigned c = r+1; c < n; ++c)
+				while (V[r][c]!=0)
+				{
+					subtract_column(r, c, V[r][r]/V[r][c]);
+					swap_columns(r, c);
+				}
+
+		// solve for z one coordinate at a time, each choice of root branching
+		std::vector< std::vector<T> > partial(1);
+		const auto two_pi = 2*acos(typename Eigen::NumTraits<T>::Real(-1));
+		for (unsigned r = 0; r < n; ++r)
+		{
+			const long degree = V[r][r];
+			if (degree==0)
+				throw std::runtime_error("in SolveBinomialSystem, exponent matrix is singular");
+
+			std::vector< std::vector<T> > extended;
+			for (auto const& z : partial)
+			{
+				T rhs = b[r];
+				for (unsigned k = 0; k < r; ++k)
+					rhs /= pow(z[k], static_cast<int>(V[r][k]));
+
+				// the |degree| roots of rhs^(1/degree)
+				const auto modulus = pow(abs(rhs), 1/typename Eigen::NumTraits<T>::Real(degree));
+				const auto angle = arg(rhs) / degree;
+				for (long k = 0; k < std::abs(degree); ++k)
+				{
+					auto root_angle = angle + two_pi * k / degree;
+					extended.push_back(z);
+					extended.back().push_back(T(modulus*cos(root_angle), modulus*sin(root_angle)));
+				}
+			}
+			partial.swap(extended);
+		}
+
+		std::vector< Vec<T> > solutions;
+		for (auto const& z : partial)
+		{
+			Vec<T> y(n);
+			for (unsigned jj = 0; jj < n; ++jj)
+			{
+				y(jj) = T(1);
+				for (unsigned k = 0; k < n; ++k)
+					y(jj) *= pow(z[k], static_cast<int>(M[jj][k]));
+			}
+			solutions.push_back(y);
+		}
+		return solutions;
+	}
+
+	} // namespace detail
+} // namespace bertini
+
+#endif
@@ -32,6 +32,10 @@
 #ifndef BERTINI_GENERIC_POOL_HPP
 #define BERTINI_GENERIC_POOL_HPP
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace bertini {
 
 	namespace detail {
@@ -92,9 +96,20 @@ namespace bertini {
 			return held_data_.back();
 		}
 
+		/**
+		\brief Drop the objects held only by the pool.
+		*/
 		void PurgeCache()
 		{
-			std::remove_if(held_data_.begin(), held_data_.end(), [](HeldType const& h){return h.use_count()==1;});
+			held_data_.erase(std::remove_if(held_data_.begin(), held_data_.end(), [](HeldType const& h){return h.use_count()==1;}), held_data_.end());
+		}
+
+		/**
+		\brief The number of objects held.
+		*/
+		size_t Size() const
+		{
+			return held_data_.size();
 		}
 
 	};
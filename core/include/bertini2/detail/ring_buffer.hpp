@@ -0,0 +1,242 @@
+//This file is part of Bertini 2.
+//
+//ring_buffer.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//ring_buffer.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with ring_buffer.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file ring_buffer.hpp
+
+\brief Provides a double-ended queue which reuses the storage of the elements it drops, for the samples of the endgames.
+*/
+
+#ifndef BERTINI_DETAIL_RING_BUFFER_HPP
+#define BERTINI_DETAIL_RING_BUFFER_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief A queue of elements in slots, in a ring, supporting the operations of std::deque the endgames use.
+
+	Popping an element leaves it in its slot, and pushing one assigns it into a free slot.  So for elements owning heap storage, such as vectors of multiple precision numbers, pushing one the size and precision of a dropped one allocates nothing: the vector keeps its storage, and each number its limbs.  The slots grow, doubling, only when full, so a queue sized by reserve, or one whose length is steady, stops allocating.
+
+	Unlike std::deque, pushing or growing invalidates references to the elements.
+
+	\tparam T The type of the elements.
+	*/
+	template<typename T>
+	class RingBuffer
+	{
+		template<bool IsConst>
+		class Iterator
+		{
+			using Buffer = typename std::conditional<IsConst, RingBuffer const, RingBuffer>::type;
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = typename std::conditional<IsConst, T const*, T*>::type;
+			using reference = typename std::conditional<IsConst, T const&, T&>::type;
+
+			Iterator() = default;
+			Iterator(Buffer * buffer, std::size_t index) : buffer_(buffer), index_(index) {}
+
+			reference operator*() const { return (*buffer_)[index_]; }
+			pointer operator->() const { return &(*buffer_)[index_]; }
+			reference operator[](difference_type n) const { return (*buffer_)[index_+n]; }
+
+			Iterator& operator++() { ++index_; return *this; }
+			Iterator operator++(int) { auto copy = *this; ++index_; return copy; }
+			Iterator& operator--() { --index_; return *this; }
+			Iterator operator--(int) { auto copy = *this; --index_; return copy; }
+			Iterator& operator+=(difference_type n) { index_ += n; return *this; }
+			Iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+			Iterator operator+(difference_type n) const { return Iterator(buffer_, index_+n); }
+			Iterator operator-(difference_type n) const { return Iterator(buffer_, index_-n); }
+			difference_type operator-(Iterator const& other) const { return difference_type(index_) - difference_type(other.index_); }
+
+			bool operator==(Iterator const& other) const { return index_==other.index_; }
+			bool operator!=(Iterator const& other) const { return index_!=other.index_; }
+			bool operator<(Iterator const& other) const { return index_<other.index_; }
+			bool operator>(Iterator const& other) const { return index_>other.index_; }
+			bool operator<=(Iterator const& other) const { return index_<=other.index_; }
+			bool operator>=(Iterator const& other) const { return index_>=other.index_; }
+
+		private:
+			Buffer * buffer_ = nullptr;
+			std::size_t index_ = 0;
+		};
+
+	public:
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using reference = T&;
+		using const_reference = T const&;
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		RingBuffer() = default;
+
+		/**
+		\brief Make a buffer of n value-initialized elements.
+		*/
+		explicit
+		RingBuffer(size_type n) : slots_(n), size_(n)
+		{}
+
+		RingBuffer(std::initializer_list<T> elements) : slots_(elements), size_(elements.size())
+		{}
+
+		size_type size() const { return size_; }
+		bool empty() const { return size_==0; }
+
+		/**
+		\brief The number of slots, including those of dropped elements.
+		*/
+		size_type capacity() const { return slots_.size(); }
+
+		T& operator[](size_type ii) { assert(ii<size_); return slots_[Slot(ii)]; }
+		T const& operator[](size_type ii) const { assert(ii<size_); return slots_[Slot(ii)]; }
+
+		T& front() { return (*this)[0]; }
+		T const& front() const { return (*this)[0]; }
+		T& back() { return (*this)[size_-1]; }
+		T const& back() const { return (*this)[size_-1]; }
+
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, size_); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, size_); }
+
+		/**
+		\brief Make sure there are at least n slots, so that pushing up to n elements does not grow the buffer.
+		*/
+		void reserve(size_type n)
+		{
+			if (n <= slots_.size())
+				return;
+
+			std::vector<T> grown;
+			grown.reserve(n);
+			for (size_type ii = 0; ii < slots_.size(); ++ii)
+				grown.push_back(std::move(slots_[Slot(ii)])); // in order from the front, including the free slots after the back
+			grown.resize(n);
+
+			slots_.swap(grown);
+			head_ = 0;
+		}
+
+		/**
+		\brief Add an element at the back, assigning it into a free slot.
+		*/
+		void push_back(T const& x)
+		{
+			GrowIfFull();
+			slots_[Slot(size_)] = x;
+			++size_;
+		}
+
+		template<typename... Args>
+		void emplace_back(Args&&... args)
+		{
+			push_back(T(std::forward<Args>(args)...));
+		}
+
+		/**
+		\brief Drop the element at the front.  Its slot, and the storage it owns, are kept for reuse.
+		*/
+		void pop_front()
+		{
+			assert(size_>0);
+			head_ = Slot(1);
+			--size_;
+		}
+
+		void pop_back()
+		{
+			assert(size_>0);
+			--size_;
+		}
+
+		/**
+		\brief Drop all the elements, keeping their slots.
+		*/
+		void clear()
+		{
+			head_ = 0;
+			size_ = 0;
+		}
+
+		/**
+		\brief Make the size n, dropping elements from the back, or adding value-initialized ones.
+		*/
+		void resize(size_type n)
+		{
+			reserve(n);
+			for (size_type ii = size_; ii < n; ++ii)
+				slots_[Slot(ii)] = T();
+			size_ = n;
+		}
+
+		/**
+		\brief All the slots, including those of dropped elements, in no particular order.  For accounting for memory.
+		*/
+		std::vector<T> const& Slots() const
+		{
+			return slots_;
+		}
+
+	private:
+
+		size_type Slot(size_type ii) const
+		{
+			auto slot = head_ + ii;
+			return slot < slots_.size() ? slot : slot - slots_.size();
+		}
+
+		void GrowIfFull()
+		{
+			if (size_==slots_.size())
+				reserve(slots_.empty() ? 4 : 2*slots_.size());
+		}
+
+		std::vector<T> slots_;
+		size_type head_ = 0;
+		size_type size_ = 0;
+	};
+
+	} // re: namespace detail
+
+} // re: namespace bertini
+
+#endif
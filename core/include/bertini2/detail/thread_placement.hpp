@@ -0,0 +1,251 @@
+//This file is part of Bertini 2.
+//
+//thread_placement.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//thread_placement.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with thread_placement.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file thread_placement.hpp
+
+\brief Finds the NUMA nodes of the machine, and pins threads to their cpus.
+
+On machines with several sockets, memory is attached to one socket or another, and reaching the memory of another socket is slower.  Linux places a page on the node of the thread which first touches it, so a thread pinned to a cpu, which allocates and fills its own objects, gets them in its own node's memory.  Only Linux is supported; elsewhere the machine is taken to be one node, and pinning does nothing.
+*/
+
+#ifndef BERTINI_DETAIL_THREAD_PLACEMENT_HPP
+#define BERTINI_DETAIL_THREAD_PLACEMENT_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief Read a list of cpus or nodes in the format of the Linux sysfs, such as "0-3,8,10-11".  Malformed entries are skipped.
+	*/
+	inline std::vector<unsigned> ParseCpuList(std::string const& list)
+	{
+		std::vector<unsigned> cpus;
+		std::stringstream ss(list);
+		std::string item;
+		while (std::getline(ss, item, ','))
+		{
+			unsigned first, last;
+			char dash;
+			std::stringstream range(item);
+			if (!(range >> first))
+				continue;
+			if (range >> dash >> last && dash=='-')
+				for (unsigned ii = first; ii <= last; ++ii)
+					cpus.push_back(ii);
+			else
+				cpus.push_back(first);
+		}
+		return cpus;
+	}
+
+
+	/**
+	\brief The cpus a thread may run on, grouped by NUMA node.
+	*/
+	struct CpuTopology
+	{
+		std::vector< std::vector<unsigned> > node_cpus; ///< The cpus of each node, in increasing order.  Nodes with none are left out.
+
+		unsigned NumNodes() const
+		{
+			return static_cast<unsigned>(node_cpus.size());
+		}
+
+		unsigned NumCpus() const
+		{
+			unsigned n = 0;
+			for (auto const& c : node_cpus)
+				n += static_cast<unsigned>(c.size());
+			return n;
+		}
+
+		/**
+		\brief One node, of cpus 0 through num_cpus-1.
+		*/
+		static CpuTopology Uniform(unsigned num_cpus)
+		{
+			CpuTopology t;
+			t.node_cpus.emplace_back();
+			for (unsigned ii = 0; ii < std::max(num_cpus, 1u); ++ii)
+				t.node_cpus.back().push_back(ii);
+			return t;
+		}
+
+		/**
+		\brief The nodes of this machine, from /sys/devices/system/node, keeping only the cpus this process may run on.  One node of all the hardware threads if they cannot be read.
+		*/
+		static CpuTopology Detect()
+		{
+			CpuTopology t;
+		#ifdef __linux__
+			cpu_set_t allowed;
+			CPU_ZERO(&allowed);
+			bool have_allowed = sched_getaffinity(0, sizeof(allowed), &allowed)==0;
+
+			std::ifstream online("/sys/devices/system/node/online");
+			std::string nodes;
+			if (online && std::getline(online, nodes))
+				for (auto node : ParseCpuList(nodes))
+				{
+					std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+					std::string list;
+					if (!cpulist || !std::getline(cpulist, list))
+						continue;
+
+					std::vector<unsigned> cpus;
+					for (auto cpu : ParseCpuList(list))
+						if (!have_allowed || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)))
+							cpus.push_back(cpu);
+					if (!cpus.empty())
+						t.node_cpus.push_back(cpus);
+				}
+		#endif
+			if (t.node_cpus.empty())
+				return Uniform(std::thread::hardware_concurrency());
+			return t;
+		}
+	};
+
+
+	/**
+	\brief Where a thread runs.
+	*/
+	struct ThreadSlot
+	{
+		int cpu = -1; ///< The cpu it is pinned to, or -1 if it is not pinned.
+		unsigned node = 0; ///< The index of its node in the topology.
+	};
+
+
+	/**
+	\brief Choose a cpu for each of a number of threads.
+
+	\param topology The cpus to choose from.
+	\param num_threads The number of threads.  If there are more than cpus, the cpus are used again in the same order.
+	\param spread Whether to take cpus from each node in turn, to use the memory bandwidth of all of them.  Otherwise one node is filled before the next is started, keeping few threads on as few nodes as possible.
+	*/
+	inline std::vector<ThreadSlot> PlaceThreads(CpuTopology const& topology, unsigned num_threads, bool spread)
+	{
+		std::vector<ThreadSlot> order;
+		if (spread)
+		{
+			for (size_t ii = 0; order.size() < topology.NumCpus(); ++ii)
+				for (unsigned node = 0; node < topology.NumNodes(); ++node)
+					if (ii < topology.node_cpus[node].size())
+					{
+						ThreadSlot s;
+						s.cpu = static_cast<int>(topology.node_cpus[node][ii]);
+						s.node = node;
+						order.push_back(s);
+					}
+		}
+		else
+		{
+			for (unsigned node = 0; node < topology.NumNodes(); ++node)
+				for (auto cpu : topology.node_cpus[node])
+				{
+					ThreadSlot s;
+					s.cpu = static_cast<int>(cpu);
+					s.node = node;
+					order.push_back(s);
+				}
+		}
+
+		std::vector<ThreadSlot> slots;
+		for (unsigned ii = 0; ii < num_threads && !order.empty(); ++ii)
+			slots.push_back(order[ii % order.size()]);
+		return slots;
+	}
+
+
+	/**
+	\brief Pin the calling thread to one cpu.
+
+	\return Whether it was pinned.  False for a cpu of -1, off Linux, and if the cpu is not available.
+	*/
+	inline bool PinThisThread(int cpu)
+	{
+	#ifdef __linux__
+		if (cpu < 0 || cpu >= CPU_SETSIZE)
+			return false;
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set)==0;
+	#else
+		return false;
+	#endif
+	}
+
+
+	/**
+	\brief Keeps the cpus the calling thread may run on, setting them back when destroyed, for pinning a thread which outlives the work it is pinned for.
+	*/
+	class ScopedAffinity
+	{
+	public:
+		ScopedAffinity()
+		{
+		#ifdef __linux__
+			CPU_ZERO(&previous_);
+			saved_ = pthread_getaffinity_np(pthread_self(), sizeof(previous_), &previous_)==0;
+		#endif
+		}
+
+		~ScopedAffinity()
+		{
+		#ifdef __linux__
+			if (saved_)
+				pthread_setaffinity_np(pthread_self(), sizeof(previous_), &previous_);
+		#endif
+		}
+
+		ScopedAffinity(ScopedAffinity const&) = delete;
+		ScopedAffinity& operator=(ScopedAffinity const&) = delete;
+
+	private:
+	#ifdef __linux__
+		cpu_set_t previous_;
+		bool saved_ = false;
+	#endif
+	};
+
+	} // re: detail
+} // re: bertini
+
+#endif
@@ -0,0 +1,230 @@
+//This file is part of Bertini 2.
+//
+//thread_team.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//thread_team.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with thread_team.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file thread_team.hpp
+
+\brief Contains ThreadTeam, a fixed set of threads which run one piece of work together, for parallelism within a single evaluation or factorization.
+*/
+
+#ifndef BERTINI_DETAIL_THREAD_TEAM_HPP
+#define BERTINI_DETAIL_THREAD_TEAM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief A team of threads, kept between uses, which run a function together, each with its index in the team, and may wait for each other part way through.
+
+	Where the work-stealing queues of RunWorkStealing balance many independent tasks, such as paths, over threads made for the purpose, a team splits one task, such as evaluating a large system or factoring its Jacobian, whose pieces depend on each other in stages.  The threads sleep between Runs, so a team may be kept for a whole solve, and shared by the things which use it one at a time, such as the System and the linear algebra of one tracker.
+
+	\code
+	ThreadTeam team(4);
+	team.Run([&](unsigned thread)
+		{
+			for (size_t ii = thread; ii < n; ii += team.NumThreads())
+				first_stage(ii);
+			team.Sync();
+			for (size_t ii = thread; ii < n; ii += team.NumThreads())
+				second_stage(ii);
+		});
+	\endcode
+
+	The threads of the team do not inherit anything thread local from the caller, such as the default precision, so work which makes multiple precision numbers should set it first.
+	*/
+	class ThreadTeam
+	{
+	public:
+
+		/**
+		\brief Make a team, starting its threads.
+
+		\param num_threads The number of threads, including the one calling Run.  1 makes no threads, and Run calls the work in the caller.
+		*/
+		explicit
+		ThreadTeam(unsigned num_threads) : num_threads_(std::max(num_threads, 1u))
+		{
+			for (unsigned ii = 1; ii < num_threads_; ++ii)
+				threads_.emplace_back([this, ii](){ Loop(ii);});
+		}
+
+		~ThreadTeam()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			start_.notify_all();
+			for (auto& t : threads_)
+				t.join();
+		}
+
+		ThreadTeam(ThreadTeam const&) = delete;
+		ThreadTeam& operator=(ThreadTeam const&) = delete;
+
+		unsigned NumThreads() const
+		{
+			return num_threads_;
+		}
+
+		/**
+		\brief Call a function on every thread of the team, the caller being thread 0, and return once all have returned.
+
+		Calls from several threads are taken one at a time.  The first exception thrown by the work is rethrown here, once every thread has stopped; threads waiting in Sync at the time stop waiting.
+
+		\param work Called as work(thread), with thread in [0, NumThreads()).
+		*/
+		void Run(std::function<void(unsigned)> const& work)
+		{
+			std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+			if (threads_.empty())
+			{
+				work(0);
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				work_ = &work;
+				error_ = nullptr;
+				failed_ = false;
+				barrier_count_ = 0; // left counting by threads abandoned in Sync by a Run which threw
+				num_running_ = num_threads_ - 1;
+				++generation_;
+			}
+			start_.notify_all();
+
+			Execute(0);
+
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				done_.wait(lock, [this](){ return num_running_==0;});
+				work_ = nullptr;
+			}
+
+			if (error_)
+				std::rethrow_exception(error_);
+		}
+
+		/**
+		\brief Wait until every thread of the team has called Sync as many times as this one, so that what each wrote before is seen by all after.  Call only from within the work of Run, from every thread.
+		*/
+		void Sync()
+		{
+			if (num_threads_==1)
+				return;
+
+			const auto generation = barrier_generation_.load(std::memory_order_acquire);
+			if (barrier_count_.fetch_add(1, std::memory_order_acq_rel)+1==num_threads_)
+			{
+				barrier_count_.store(0, std::memory_order_relaxed);
+				barrier_generation_.fetch_add(1, std::memory_order_release);
+				return;
+			}
+
+			while (barrier_generation_.load(std::memory_order_acquire)==generation)
+			{
+				if (failed_.load(std::memory_order_relaxed))
+					throw Abandoned();
+				std::this_thread::yield();
+			}
+		}
+
+	private:
+
+		// thrown out of Sync to unwind a thread whose partners have stopped on an error
+		struct Abandoned {};
+
+		void Loop(unsigned thread)
+		{
+			unsigned seen = 0;
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex_);
+					start_.wait(lock, [this, seen](){ return stopping_ || generation_!=seen;});
+					if (stopping_)
+						return;
+					seen = generation_;
+				}
+
+				Execute(thread);
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (--num_running_==0)
+					done_.notify_one();
+			}
+		}
+
+		void Execute(unsigned thread)
+		{
+			try
+			{
+				(*work_)(thread);
+			}
+			catch (Abandoned const&)
+			{}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(error_mutex_);
+				if (!error_)
+					error_ = std::current_exception();
+				failed_ = true;
+			}
+		}
+
+		unsigned num_threads_;
+		std::vector<std::thread> threads_; ///< All but the first, which is the caller of Run.
+
+		std::mutex run_mutex_; ///< Held through each Run.
+		std::mutex mutex_; ///< Guards the fields below, through to num_running_.
+		std::condition_variable start_; ///< Wakes the threads for a Run, or to stop.
+		std::condition_variable done_; ///< Wakes the caller of Run when the threads are done.
+		std::function<void(unsigned)> const* work_ = nullptr;
+		unsigned generation_ = 0; ///< The number of Runs so far.
+		unsigned num_running_ = 0; ///< The threads other than the caller still running the work of the current Run.
+		bool stopping_ = false;
+
+		std::atomic<unsigned> barrier_count_{0}; ///< The threads waiting in Sync.
+		std::atomic<unsigned> barrier_generation_{0}; ///< The number of Syncs completed.
+		std::atomic<bool> failed_{false}; ///< Whether the work of the current Run threw.
+		std::mutex error_mutex_;
+		std::exception_ptr error_;
+	};
+
+	} // re: detail
+} // re: bertini
+
+#endif
@@ -0,0 +1,256 @@
+//This file is part of Bertini 2.
+//
+//vector_pool.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//vector_pool.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with vector_pool.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file vector_pool.hpp
+
+\brief Provides a pool of vectors, which recycles them by size and precision, so long runs stop allocating.
+*/
+
+#ifndef BERTINI_DETAIL_VECTOR_POOL_HPP
+#define BERTINI_DETAIL_VECTOR_POOL_HPP
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief Free lists of vectors, keyed by size and precision.
+
+	A vector taken from the pool is one returned to it earlier, of the same size and precision, if there is one, so for multiple precision its numbers keep their limbs, and nothing is allocated.  Otherwise it is made.  Its values are whatever they were when returned.
+
+	Take and Return move vectors in and out; Acquire wraps Take in a Handle, which returns the vector when destroyed.
+
+	The pool is not synchronized.  ThreadLocal gives each thread its own.
+
+	\code
+	auto& pool = detail::VectorPool<mpfr>::ThreadLocal();
+	{
+		auto x = pool.Acquire(n, DefaultPrecision());
+		*x = y;
+		...
+	} // x goes back to the pool here
+	\endcode
+
+	\tparam NumT The number type of the vectors.  dbl or mpfr.
+	*/
+	template<typename NumT>
+	class VectorPool
+	{
+	public:
+
+		using VecT = Vec<NumT>;
+		using Key = std::pair<Eigen::Index, unsigned>;
+
+		/**
+		\brief A vector from a pool, given back to it when the handle is destroyed.
+		*/
+		class Handle
+		{
+		public:
+
+			Handle(VectorPool & pool, VecT && v) : pool_(&pool), v_(std::move(v))
+			{}
+
+			Handle(Handle const&) = delete;
+			Handle& operator=(Handle const&) = delete;
+
+			Handle(Handle && other) : pool_(other.pool_), v_(std::move(other.v_))
+			{
+				other.pool_ = nullptr;
+			}
+
+			Handle& operator=(Handle && other)
+			{
+				if (this != &other)
+				{
+					GiveBack();
+					pool_ = other.pool_;
+					v_ = std::move(other.v_);
+					other.pool_ = nullptr;
+				}
+				return *this;
+			}
+
+			~Handle()
+			{
+				GiveBack();
+			}
+
+			VecT & operator*() { return v_; }
+			VecT const& operator*() const { return v_; }
+			VecT * operator->() { return &v_; }
+			VecT const* operator->() const { return &v_; }
+
+			/**
+			\brief Keep the vector, instead of giving it back to the pool.
+			*/
+			VecT Release()
+			{
+				pool_ = nullptr;
+				return std::move(v_);
+			}
+
+		private:
+
+			void GiveBack()
+			{
+				if (pool_)
+					pool_->Return(std::move(v_));
+				pool_ = nullptr;
+			}
+
+			VectorPool * pool_;
+			VecT v_;
+		};
+
+
+		/**
+		\param max_free_per_key The most vectors of any one size and precision to hold.  Vectors returned beyond this are freed.
+		*/
+		explicit VectorPool(std::size_t max_free_per_key = 64) : max_free_per_key_(max_free_per_key)
+		{}
+
+		/**
+		\brief Get a vector of a size and precision, recycled if possible.
+		*/
+		VecT Take(Eigen::Index size, unsigned precision)
+		{
+			auto found = free_.find(Key(size, precision));
+			if (found!=free_.end() && !found->second.empty())
+			{
+				VecT v(std::move(found->second.back()));
+				found->second.pop_back();
+				--num_free_;
+				++num_reused_;
+				return v;
+			}
+
+			++num_made_;
+			VecT v(size);
+			for (Eigen::Index ii = 0; ii < size; ++ii)
+				Make(v(ii), precision);
+			return v;
+		}
+
+		/**
+		\brief Get a vector of a size and precision, recycled if possible, which goes back to the pool when the handle is destroyed.
+		*/
+		Handle Acquire(Eigen::Index size, unsigned precision)
+		{
+			return Handle(*this, Take(size, precision));
+		}
+
+		/**
+		\brief Give a vector to the pool, for reuse by Take.  Its precision is that of its first entry.
+		*/
+		void Return(VecT && v)
+		{
+			if (v.size()==0)
+				return;
+
+			auto& free = free_[Key(v.size(), Precision(v(0)))];
+			if (free.size() >= max_free_per_key_)
+				return;
+
+			free.push_back(std::move(v));
+			++num_free_;
+		}
+
+		/**
+		\brief Free every vector held.
+		*/
+		void Clear()
+		{
+			free_.clear();
+			num_free_ = 0;
+		}
+
+		/**
+		\brief The number of vectors held, ready for reuse.
+		*/
+		std::size_t NumFree() const
+		{
+			return num_free_;
+		}
+
+		/**
+		\brief The number of vectors Take has recycled.
+		*/
+		std::size_t NumReused() const
+		{
+			return num_reused_;
+		}
+
+		/**
+		\brief The number of vectors Take has made, for want of one to recycle.
+		*/
+		std::size_t NumMade() const
+		{
+			return num_made_;
+		}
+
+		/**
+		\brief The pool of the calling thread.
+		*/
+		static VectorPool & ThreadLocal()
+		{
+			#ifdef USE_THREAD_LOCAL
+				static thread_local VectorPool pool;
+			#else
+				static VectorPool pool;
+			#endif
+			return pool;
+		}
+
+	private:
+
+		static void Make(dbl & z, unsigned precision)
+		{
+			z = dbl(0);
+		}
+
+		static void Make(mpfr & z, unsigned precision)
+		{
+			z.precision(precision);
+		}
+
+		std::map<Key, std::vector<VecT> > free_;
+		std::size_t max_free_per_key_;
+		std::size_t num_free_ = 0;
+		std::size_t num_reused_ = 0;
+		std::size_t num_made_ = 0;
+	};
+
+	} // re: detail
+} // re: bertini
+
+#endif
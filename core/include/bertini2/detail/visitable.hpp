@@ -36,6 +36,9 @@
 #include "bertini2/detail/visitor.hpp"
 #include "bertini2/detail/events.hpp"
 
+#include <typeinfo>
+#include <vector>
+
 namespace bertini{
 
 	namespace policy{
@@ -135,6 +138,7 @@ namespace bertini{
 		void AddObserver(AnyObserver* new_observer)
 		{
 			current_watchers_.push_back(new_observer);
+			subscribers_.clear();
 		}
 
 	protected:
@@ -142,16 +146,40 @@ namespace bertini{
 		/**
 		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		Prefer the overload taking the event type as a template parameter, which does not make the event unless someone wants it.
 
 		\param e The event to emit.  Its type should be derived from AnyEvent.
 		*/
 		void NotifyObservers(AnyEvent const& e) const
 		{
-
 			for (auto& obs : current_watchers_)
 				obs->Observe(e);
+		}
+
+		/**
+		\brief Makes an event, and sends it to the observers subscribing to its type.
 
+		With no observers, this is one test of an empty vector, and the event is not made.  Otherwise the observers subscribing to the event type are looked up in a table indexed by a number unique to the type, which is filled in on first use after each AddObserver, so no casting is done to find them.  If the library is compiled with BERTINI_DISABLE_OBSERVERS defined, this does nothing at all, and compiles away.
+
+		\tparam EventT The type of event to emit.  Must derive from AnyEvent.
+		\param args The arguments to the constructor of the event, usually starting with `*this`.
+		*/
+		template<typename EventT, typename... Args>
+		void NotifyObservers(Args const&... args) const
+		{
+		#ifndef BERTINI_DISABLE_OBSERVERS
+			if (current_watchers_.empty())
+				return;
+
+			auto id = detail::EventTypeId<EventT>();
+			if (SubscribersTo<EventT>(id).empty())
+				return;
+
+			EventT e(args...);
+			// indexed each time, since an observer could emit another event type, growing the table.
+			for (std::size_t ii = 0; ii < subscribers_[id].observers.size(); ++ii)
+				subscribers_[id].observers[ii]->Observe(e);
+		#endif
 		}
 
 
@@ -159,7 +187,31 @@ namespace bertini{
 
 		using ObserverContainer = std::vector<AnyObserver*>;
 
+		struct Subscribers
+		{
+			bool known = false;
+			ObserverContainer observers;
+		};
+
+		template<typename EventT>
+		ObserverContainer const& SubscribersTo(unsigned id) const
+		{
+			if (id >= subscribers_.size())
+				subscribers_.resize(id+1);
+
+			auto& s = subscribers_[id];
+			if (!s.known)
+			{
+				for (auto obs : current_watchers_)
+					if (obs->Subscribes(typeid(EventT)))
+						s.observers.push_back(obs);
+				s.known = true;
+			}
+			return s.observers;
+		}
+
 		ObserverContainer current_watchers_;
+		mutable std::vector<Subscribers> subscribers_; ///< The observers of each event type, indexed by detail::EventTypeId.  Filled in as events are emitted, and cleared when an observer is added.
 	};
 
 } // namespace bertini
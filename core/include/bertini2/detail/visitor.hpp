@@ -34,6 +34,7 @@
 #define BERTINI_DETAIL_VISITOR_HPP
 
 #include <tuple>
+#include <typeinfo>
 #include <utility>
 
 #include <boost/fusion/adapted/std_tuple.hpp>
@@ -95,6 +96,18 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+		/**
+		\brief Whether this observer wants events of exactly a type.  Events of types no observer wants are never made.
+
+		Asked once per event type when first emitted after an observer is added, so can be slow.  By default an observer gets every event, so override this to get only those Observe does something with.  Since it is asked about exact types, an observer filtering on a base event type, like TrackingEvent, should keep the default.
+
+		\param event_type The `typeid` of the event type.
+		*/
+		virtual bool Subscribes(std::type_info const& event_type) const
+		{
+			return true;
+		}
 	};
 
 
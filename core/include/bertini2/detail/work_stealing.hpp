@@ -0,0 +1,267 @@
+//This file is part of Bertini 2.
+//
+//work_stealing.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//work_stealing.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with work_stealing.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file work_stealing.hpp
+
+\brief Provides a simple work-stealing scheduler, running tasks over a fixed number of threads.
+*/
+
+#ifndef BERTINI_DETAIL_WORK_STEALING_HPP
+#define BERTINI_DETAIL_WORK_STEALING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief A queue of prioritized tasks for each worker thread.
+
+	Each worker takes the highest priority task from its own queue.  When its own is empty, it steals the highest priority task from the others, so that work is balanced without any central queue, and expensive tasks are started before cheap ones wherever they were queued.  Among tasks of equal priority, the earliest pushed is taken first.  Tasks may be pushed while running, for instance to split a task into follow-on pieces.
+
+	The workers may be put in groups, such as the NUMA nodes they run on, see SetGroups, so that they steal from their own group before others.
+
+	\tparam TaskT The type of the tasks.  Should be cheap to copy, such as an index.
+	*/
+	template<typename TaskT>
+	class WorkStealingQueues
+	{
+	public:
+
+		explicit
+		WorkStealingQueues(unsigned num_workers) : queues_(num_workers), mutexes_(num_workers), sizes_(num_workers), victims_(num_workers), group_(num_workers, 0), outstanding_(0), num_pushed_(0), num_steals_(0), num_remote_steals_(0)
+		{
+			for (unsigned ii = 0; ii < num_workers; ++ii)
+				for (unsigned jj = 0; jj < num_workers; ++jj)
+					victims_[ii].push_back((ii + jj) % num_workers);
+		}
+
+		unsigned NumWorkers() const
+		{
+			return static_cast<unsigned>(queues_.size());
+		}
+
+		/**
+		\brief Put the workers in groups.  A worker whose queue is empty then steals from the workers of its own group, in turn from the next, before those of other groups.
+
+		\param group_of_worker The group of each worker.  Must be one per worker.
+		*/
+		void SetGroups(std::vector<unsigned> const& group_of_worker)
+		{
+			if (group_of_worker.size()!=queues_.size())
+				throw std::invalid_argument("must give the group of each worker of the work-stealing queues");
+
+			group_ = group_of_worker;
+			for (unsigned ii = 0; ii < NumWorkers(); ++ii)
+				std::stable_partition(victims_[ii].begin(), victims_[ii].end(), [this, ii](unsigned v){ return group_[v]==group_[ii]; });
+		}
+
+		/**
+		\brief The number of tasks taken from the queue of another worker.
+		*/
+		size_t NumSteals() const
+		{
+			return num_steals_;
+		}
+
+		/**
+		\brief The number of tasks taken from the queue of a worker of another group.
+		*/
+		size_t NumRemoteSteals() const
+		{
+			return num_remote_steals_;
+		}
+
+		/**
+		\brief The number of tasks in a worker's queue, not counting those running.  Read without locking, so may be momentarily out of date.
+		*/
+		size_t NumQueued(unsigned worker) const
+		{
+			return sizes_[worker].load(std::memory_order_relaxed);
+		}
+
+		/**
+		\brief Add a task to a worker's queue.
+
+		\param worker The index of the worker whose queue gets the task.
+		\param task The task.
+		\param priority Tasks with higher priority are taken first, by the owner and by thieves.
+		*/
+		void Push(unsigned worker, TaskT task, double priority = 0)
+		{
+			++outstanding_;
+			Entry e{priority, num_pushed_++, std::move(task)};
+
+			std::lock_guard<std::mutex> lock(mutexes_[worker]);
+			queues_[worker].push_back(std::move(e));
+			std::push_heap(queues_[worker].begin(), queues_[worker].end());
+			sizes_[worker].store(queues_[worker].size(), std::memory_order_relaxed);
+		}
+
+		/**
+		\brief Get a task for a worker, from its own queue if possible, otherwise stolen from another.
+
+		\return Whether a task was found.
+		*/
+		bool Pop(unsigned worker, TaskT & task)
+		{
+			for (auto victim : victims_[worker])
+			{
+				std::lock_guard<std::mutex> lock(mutexes_[victim]);
+				auto& q = queues_[victim];
+				if (!q.empty())
+				{
+					std::pop_heap(q.begin(), q.end());
+					task = std::move(q.back().task);
+					q.pop_back();
+					sizes_[victim].store(q.size(), std::memory_order_relaxed);
+					if (victim!=worker)
+					{
+						++num_steals_;
+						if (group_[victim]!=group_[worker])
+							++num_remote_steals_;
+					}
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		\brief Mark a task obtained from Pop as finished.  Must be called after any tasks it pushes.
+		*/
+		void Done()
+		{
+			--outstanding_;
+		}
+
+		/**
+		\brief Whether every task pushed has been finished.
+		*/
+		bool AllDone() const
+		{
+			return outstanding_==0;
+		}
+
+	private:
+
+		struct Entry
+		{
+			double priority;
+			size_t sequence;
+			TaskT task;
+
+			// the heap's top is the greatest, so earlier pushes must compare greater.
+			bool operator<(Entry const& other) const
+			{
+				if (priority!=other.priority)
+					return priority < other.priority;
+				return sequence > other.sequence;
+			}
+		};
+
+		std::vector< std::vector<Entry> > queues_; ///< A heap of tasks for each worker.
+		std::vector< std::mutex > mutexes_;
+		std::vector< std::atomic<size_t> > sizes_; ///< The size of each heap, for reading without its mutex.
+		std::vector< std::vector<unsigned> > victims_; ///< For each worker, the queues it takes from, in order, starting with its own.
+		std::vector<unsigned> group_; ///< The group of each worker.
+		std::atomic<size_t> outstanding_; ///< The number of tasks pushed but not yet finished, including those running.
+		std::atomic<size_t> num_pushed_; ///< The number of tasks ever pushed, used to keep equal priorities in order.
+		std::atomic<size_t> num_steals_;
+		std::atomic<size_t> num_remote_steals_;
+	};
+
+
+
+	/**
+	\brief Run all the tasks in a set of queues, with one thread per worker, until every task is finished.
+
+	The first exception thrown by a task is rethrown in the calling thread, after all the workers have stopped.  Tasks remaining at that point are abandoned.
+
+	\param queues The queues, already holding the initial tasks.
+	\param work The function to run on each task.  Called as work(worker, task), where worker is the index of the calling thread.  May push further tasks.
+	\param start_thread If given, called as start_thread(worker) by each thread before it takes any task, for instance to pin it to a cpu.  Worker 0 is the calling thread.
+	*/
+	template<typename TaskT>
+	void RunWorkStealing(WorkStealingQueues<TaskT> & queues, std::function<void(unsigned, TaskT const&)> const& work, std::function<void(unsigned)> const& start_thread = nullptr)
+	{
+		std::exception_ptr first_error;
+		std::mutex error_mutex;
+		std::atomic<bool> failed(false);
+
+		auto loop = [&](unsigned worker)
+		{
+			if (start_thread)
+				start_thread(worker);
+
+			TaskT task;
+			while (!queues.AllDone() && !failed)
+			{
+				if (!queues.Pop(worker, task))
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				try
+				{
+					work(worker, task);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(error_mutex);
+					if (!first_error)
+						first_error = std::current_exception();
+					failed = true;
+				}
+				queues.Done();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned ii = 1; ii < queues.NumWorkers(); ++ii)
+			threads.emplace_back(loop, ii);
+		loop(0);
+
+		for (auto& iter : threads)
+			iter.join();
+
+		if (first_error)
+			std::rethrow_exception(first_error);
+	}
+
+	} // re: detail
+} // re: bertini
+
+#endif
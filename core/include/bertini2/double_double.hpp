@@ -0,0 +1,592 @@
+//This file is part of Bertini 2.
+//
+//double_double.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//double_double.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with double_double.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file double_double.hpp
+
+\brief Double-double real and complex types, carrying about 31 decimal digits in a pair of doubles.
+
+A double-double is the unevaluated sum hi+lo of two doubles with |lo| <= ulp(hi)/2.  Arithmetic is done with the error-free transformations TwoSum and TwoProd, the latter using a fused multiply-add, so it is branch-free, does not allocate, and costs a small multiple of double arithmetic, much less than MPFR at the same precision.  The range is that of double.
+
+These are the algorithms of Hida, Li, and Bailey's QD library.
+
+Only the number types are provided here.  The function trees, systems, and trackers evaluate in dbl and mpfr, and adaptive precision does not step through double-double.
+*/
+
+#ifndef BERTINI_DOUBLE_DOUBLE_HPP
+#define BERTINI_DOUBLE_DOUBLE_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/num_traits.hpp"
+
+#include <Eigen/Core>
+
+#include <mpfr.h>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <ostream>
+#include <string>
+
+
+namespace bertini {
+
+	/**
+	\brief A real number represented as the unevaluated sum of two doubles.
+	*/
+	class dd_real
+	{
+	public:
+
+		static constexpr unsigned digits10 = 31; ///< The number of decimal digits carried.
+
+		constexpr dd_real() : hi_(0), lo_(0)
+		{}
+
+		constexpr dd_real(double x) : hi_(x), lo_(0)
+		{}
+
+		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+		constexpr dd_real(T x) : hi_(static_cast<double>(x)), lo_(0)
+		{}
+
+		/**
+		\brief Construct from a pair of doubles, which need not be normalized.
+		*/
+		dd_real(double hi, double lo)
+		{
+			QuickTwoSum(hi, lo, hi_, lo_);
+		}
+
+		explicit
+		dd_real(mpfr_float const& x) : hi_(x.convert_to<double>())
+		{
+			lo_ = mpfr_float(x - hi_).convert_to<double>();
+		}
+
+		explicit
+		dd_real(std::string const& s)
+		{
+			mpfr_t x;
+			mpfr_init2(x, 128);
+			mpfr_set_str(x, s.c_str(), 10, MPFR_RNDN);
+			hi_ = mpfr_get_d(x, MPFR_RNDN);
+			mpfr_sub_d(x, x, hi_, MPFR_RNDN);
+			lo_ = mpfr_get_d(x, MPFR_RNDN);
+			mpfr_clear(x);
+		}
+
+		/**
+		\brief Convert to an mpfr_float at the current default precision.
+		*/
+		explicit operator mpfr_float() const
+		{
+			mpfr_float r(hi_);
+			r += lo_;
+			return r;
+		}
+
+		explicit operator double() const
+		{
+			return hi_;
+		}
+
+		double hi() const { return hi_; }
+		double lo() const { return lo_; }
+
+
+		dd_real& operator+=(dd_real const& rhs)
+		{
+			double s1, s2, t1, t2;
+			TwoSum(hi_, rhs.hi_, s1, s2);
+			TwoSum(lo_, rhs.lo_, t1, t2);
+			s2 += t1;
+			QuickTwoSum(s1, s2, s1, s2);
+			s2 += t2;
+			QuickTwoSum(s1, s2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator+=(double rhs)
+		{
+			double s1, s2;
+			TwoSum(hi_, rhs, s1, s2);
+			s2 += lo_;
+			QuickTwoSum(s1, s2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator-=(dd_real const& rhs)
+		{
+			return *this += -rhs;
+		}
+
+		dd_real& operator-=(double rhs)
+		{
+			return *this += -rhs;
+		}
+
+		dd_real& operator*=(dd_real const& rhs)
+		{
+			double p1, p2;
+			TwoProd(hi_, rhs.hi_, p1, p2);
+			p2 += hi_ * rhs.lo_ + lo_ * rhs.hi_;
+			QuickTwoSum(p1, p2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator*=(double rhs)
+		{
+			double p1, p2;
+			TwoProd(hi_, rhs, p1, p2);
+			p2 += lo_ * rhs;
+			QuickTwoSum(p1, p2, hi_, lo_);
+			return *this;
+		}
+
+		/**
+		Long division, taking three quotient digits.
+		*/
+		dd_real& operator/=(dd_real const& rhs)
+		{
+			double q1 = hi_ / rhs.hi_;
+			dd_real r = *this - rhs * q1;
+
+			double q2 = r.hi_ / rhs.hi_;
+			r -= rhs * q2;
+
+			double q3 = r.hi_ / rhs.hi_;
+
+			*this = dd_real(q1, q2);
+			return *this += q3;
+		}
+
+		dd_real& operator/=(double rhs)
+		{
+			return *this /= dd_real(rhs);
+		}
+
+		dd_real operator-() const
+		{
+			dd_real r;
+			r.hi_ = -hi_;
+			r.lo_ = -lo_;
+			return r;
+		}
+
+
+		/**
+		\brief s+e = a+b exactly, with s = fl(a+b).
+		*/
+		static void TwoSum(double a, double b, double & s, double & e)
+		{
+			s = a + b;
+			double bb = s - a;
+			e = (a - (s - bb)) + (b - bb);
+		}
+
+		/**
+		\brief s+e = a+b exactly, with s = fl(a+b), assuming |a| >= |b|.
+		*/
+		static void QuickTwoSum(double a, double b, double & s, double & e)
+		{
+			s = a + b;
+			e = b - (s - a);
+		}
+
+		/**
+		\brief p+e = a*b exactly, with p = fl(a*b).
+		*/
+		static void TwoProd(double a, double b, double & p, double & e)
+		{
+			p = a * b;
+			e = std::fma(a, b, -p);
+		}
+
+	private:
+		double hi_, lo_;
+	};
+
+
+	inline dd_real operator+(dd_real lhs, dd_real const& rhs) { return lhs += rhs; }
+	inline dd_real operator-(dd_real lhs, dd_real const& rhs) { return lhs -= rhs; }
+	inline dd_real operator*(dd_real lhs, dd_real const& rhs) { return lhs *= rhs; }
+	inline dd_real operator/(dd_real lhs, dd_real const& rhs) { return lhs /= rhs; }
+
+	inline dd_real operator+(dd_real lhs, double rhs) { return lhs += rhs; }
+	inline dd_real operator-(dd_real lhs, double rhs) { return lhs -= rhs; }
+	inline dd_real operator*(dd_real lhs, double rhs) { return lhs *= rhs; }
+	inline dd_real operator/(dd_real lhs, double rhs) { return lhs /= rhs; }
+	inline dd_real operator+(double lhs, dd_real rhs) { return rhs += lhs; }
+	inline dd_real operator-(double lhs, dd_real const& rhs) { return dd_real(lhs) -= rhs; }
+	inline dd_real operator*(double lhs, dd_real rhs) { return rhs *= lhs; }
+	inline dd_real operator/(double lhs, dd_real const& rhs) { return dd_real(lhs) /= rhs; }
+
+	inline bool operator==(dd_real const& lhs, dd_real const& rhs) { return lhs.hi()==rhs.hi() && lhs.lo()==rhs.lo(); }
+	inline bool operator!=(dd_real const& lhs, dd_real const& rhs) { return !(lhs==rhs); }
+	inline bool operator< (dd_real const& lhs, dd_real const& rhs) { return lhs.hi() < rhs.hi() || (lhs.hi()==rhs.hi() && lhs.lo() < rhs.lo()); }
+	inline bool operator> (dd_real const& lhs, dd_real const& rhs) { return rhs < lhs; }
+	inline bool operator<=(dd_real const& lhs, dd_real const& rhs) { return !(rhs < lhs); }
+	inline bool operator>=(dd_real const& lhs, dd_real const& rhs) { return !(lhs < rhs); }
+
+	inline dd_real abs(dd_real const& x)
+	{
+		return x.hi() < 0 ? -x : x;
+	}
+
+	/**
+	\brief One Newton step from the double square root, which is enough for full double-double accuracy.
+	*/
+	inline dd_real sqrt(dd_real const& a)
+	{
+		if (a.hi() <= 0)
+			return dd_real(std::sqrt(a.hi()));
+
+		double x = 1.0 / std::sqrt(a.hi());
+		double ax = a.hi() * x;
+
+		double p, e;
+		dd_real::TwoProd(ax, ax, p, e);
+		return dd_real(ax) + (a - dd_real(p, e)).hi() * (x * 0.5);
+	}
+
+	inline dd_real const& real(dd_real const& x) { return x; }
+	inline dd_real imag(dd_real const& x) { return dd_real(); }
+	inline dd_real const& conj(dd_real const& x) { return x; }
+	inline dd_real abs2(dd_real const& x) { return x*x; }
+
+	inline bool isnan(dd_real const& x) { return std::isnan(x.hi()); }
+	inline bool isinf(dd_real const& x) { return std::isinf(x.hi()); }
+	inline bool isfinite(dd_real const& x) { return std::isfinite(x.hi()); }
+
+	inline std::ostream& operator<<(std::ostream& out, dd_real const& x)
+	{
+		ScopedPrecision enough(dd_real::digits10+1);
+		out << static_cast<mpfr_float>(x);
+		return out;
+	}
+
+
+
+	/**
+	\brief A complex number with double-double real and imaginary parts.
+
+	Usable as the scalar of Eigen matrices.  Converts explicitly to and from bertini::complex and std::complex<double>.
+	*/
+	class dd_complex
+	{
+	public:
+
+		using Real = dd_real;
+
+		static constexpr unsigned digits10 = dd_real::digits10;
+
+		constexpr dd_complex() = default;
+
+		constexpr dd_complex(double re) : real_(re)
+		{}
+
+		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+		constexpr dd_complex(T re) : real_(re)
+		{}
+
+		dd_complex(dd_real const& re, dd_real const& im = dd_real()) : real_(re), imag_(im)
+		{}
+
+		dd_complex(double re, double im) : real_(re), imag_(im)
+		{}
+
+		dd_complex(std::string const& re, std::string const& im) : real_(re), imag_(im)
+		{}
+
+		explicit
+		dd_complex(std::complex<double> const& z) : real_(z.real()), imag_(z.imag())
+		{}
+
+		explicit
+		dd_complex(bertini::complex const& z) : real_(z.real()), imag_(z.imag())
+		{}
+
+		/**
+		\brief Convert to a bertini::complex at the current default precision.
+		*/
+		explicit operator bertini::complex() const
+		{
+			return bertini::complex(static_cast<mpfr_float>(real_), static_cast<mpfr_float>(imag_));
+		}
+
+		explicit operator std::complex<double>() const
+		{
+			return std::complex<double>(real_.hi(), imag_.hi());
+		}
+
+		dd_real const& real() const { return real_; }
+		dd_real const& imag() const { return imag_; }
+		void real(dd_real const& re) { real_ = re; }
+		void imag(dd_real const& im) { imag_ = im; }
+
+		dd_complex& operator+=(dd_complex const& rhs)
+		{
+			real_ += rhs.real_;
+			imag_ += rhs.imag_;
+			return *this;
+		}
+
+		dd_complex& operator-=(dd_complex const& rhs)
+		{
+			real_ -= rhs.real_;
+			imag_ -= rhs.imag_;
+			return *this;
+		}
+
+		dd_complex& operator*=(dd_complex const& rhs)
+		{
+			dd_real re = real_*rhs.real_ - imag_*rhs.imag_;
+			imag_ = real_*rhs.imag_ + imag_*rhs.real_;
+			real_ = re;
+			return *this;
+		}
+
+		dd_complex& operator/=(dd_complex const& rhs)
+		{
+			dd_real denominator = rhs.real_*rhs.real_ + rhs.imag_*rhs.imag_;
+			dd_real re = real_*rhs.real_ + imag_*rhs.imag_;
+			imag_ = (imag_*rhs.real_ - real_*rhs.imag_) / denominator;
+			real_ = re / denominator;
+			return *this;
+		}
+
+		dd_complex& operator+=(dd_real const& rhs) { real_ += rhs; return *this; }
+		dd_complex& operator-=(dd_real const& rhs) { real_ -= rhs; return *this; }
+		dd_complex& operator*=(dd_real const& rhs) { real_ *= rhs; imag_ *= rhs; return *this; }
+		dd_complex& operator/=(dd_real const& rhs) { real_ /= rhs; imag_ /= rhs; return *this; }
+
+		dd_complex& operator+=(double rhs) { real_ += rhs; return *this; }
+		dd_complex& operator-=(double rhs) { real_ -= rhs; return *this; }
+		dd_complex& operator*=(double rhs) { real_ *= rhs; imag_ *= rhs; return *this; }
+		dd_complex& operator/=(double rhs) { real_ /= rhs; imag_ /= rhs; return *this; }
+
+		dd_complex operator-() const
+		{
+			return dd_complex(-real_, -imag_);
+		}
+
+	private:
+		dd_real real_, imag_;
+	};
+
+
+	inline dd_complex operator+(dd_complex lhs, dd_complex const& rhs) { return lhs += rhs; }
+	inline dd_complex operator-(dd_complex lhs, dd_complex const& rhs) { return lhs -= rhs; }
+	inline dd_complex operator*(dd_complex lhs, dd_complex const& rhs) { return lhs *= rhs; }
+	inline dd_complex operator/(dd_complex lhs, dd_complex const& rhs) { return lhs /= rhs; }
+
+	inline dd_complex operator+(dd_complex lhs, dd_real const& rhs) { return lhs += rhs; }
+	inline dd_complex operator-(dd_complex lhs, dd_real const& rhs) { return lhs -= rhs; }
+	inline dd_complex operator*(dd_complex lhs, dd_real const& rhs) { return lhs *= rhs; }
+	inline dd_complex operator/(dd_complex lhs, dd_real const& rhs) { return lhs /= rhs; }
+	inline dd_complex operator+(dd_real const& lhs, dd_complex rhs) { return rhs += lhs; }
+	inline dd_complex operator-(dd_real const& lhs, dd_complex const& rhs) { return dd_complex(lhs) -= rhs; }
+	inline dd_complex operator*(dd_real const& lhs, dd_complex rhs) { return rhs *= lhs; }
+	inline dd_complex operator/(dd_real const& lhs, dd_complex const& rhs) { return dd_complex(lhs) /= rhs; }
+
+	inline bool operator==(dd_complex const& lhs, dd_complex const& rhs) { return lhs.real()==rhs.real() && lhs.imag()==rhs.imag(); }
+	inline bool operator!=(dd_complex const& lhs, dd_complex const& rhs) { return !(lhs==rhs); }
+
+	inline dd_real const& real(dd_complex const& z) { return z.real(); }
+	inline dd_real const& imag(dd_complex const& z) { return z.imag(); }
+	inline dd_complex conj(dd_complex const& z) { return dd_complex(z.real(), -z.imag()); }
+
+	/**
+	\brief The squared modulus, without a square root.
+	*/
+	inline dd_real abs2(dd_complex const& z)
+	{
+		return z.real()*z.real() + z.imag()*z.imag();
+	}
+
+	inline dd_real norm(dd_complex const& z)
+	{
+		return abs2(z);
+	}
+
+	inline dd_real abs(dd_complex const& z)
+	{
+		return sqrt(abs2(z));
+	}
+
+	/**
+	\brief The principal square root.
+	*/
+	inline dd_complex sqrt(dd_complex const& z)
+	{
+		if (z.real()==0 && z.imag()==0)
+			return dd_complex();
+
+		// t = sqrt((|re| + |z|)/2), which does not cancel
+		dd_real t = sqrt((abs(z.real()) + abs(z)) * 0.5);
+		dd_real s = z.imag() / (t*2);
+
+		if (z.real() >= 0)
+			return dd_complex(t, s);
+		else if (z.imag() < 0)
+			return dd_complex(abs(s), -t);
+		else
+			return dd_complex(abs(s), t);
+	}
+
+	inline bool isnan(dd_complex const& z) { return isnan(z.real()) || isnan(z.imag()); }
+	inline bool isinf(dd_complex const& z) { return isinf(z.real()) || isinf(z.imag()); }
+	inline bool isfinite(dd_complex const& z) { return isfinite(z.real()) && isfinite(z.imag()); }
+
+	inline std::ostream& operator<<(std::ostream& out, dd_complex const& z)
+	{
+		return out << "(" << z.real() << "," << z.imag() << ")";
+	}
+
+
+	/**
+	\brief Whether a precision, in digits, can be carried by double-double arithmetic.
+	*/
+	inline bool FitsDoubleDouble(unsigned digits)
+	{
+		return digits <= dd_real::digits10;
+	}
+
+
+	template<> struct NumTraits<dd_complex>
+	{
+		inline static unsigned NumDigits()
+		{
+			return dd_complex::digits10;
+		}
+
+		inline static
+		dd_complex FromString(std::string const& s)
+		{
+			return dd_complex(s, "0");
+		}
+
+		inline static
+		dd_complex FromString(std::string const& s, std::string const& t)
+		{
+			return dd_complex(s,t);
+		}
+	};
+
+} // re: namespace bertini
+
+
+
+namespace Eigen {
+
+	/**
+	 \brief Permits the use of bertini::dd_real in Eigen matrices.
+	 */
+	template<> struct NumTraits<bertini::dd_real> : GenericNumTraits<bertini::dd_real>
+	{
+		typedef bertini::dd_real Real;
+		typedef Real NonInteger;
+		typedef Real Nested;
+		typedef Real Literal;
+		enum {
+			IsComplex = 0,
+			IsInteger = 0,
+			IsSigned = 1,
+			RequireInitialization = 0,
+			ReadCost = 2,
+			AddCost = 20,
+			MulCost = 10
+		};
+
+		// 2^-104
+		inline static Real epsilon() { return Real(4.93038065763132e-32); }
+		inline static Real dummy_precision() { return Real(1e-30); }
+		inline static Real highest() { return Real(std::numeric_limits<double>::max()); }
+		inline static Real lowest() { return Real(-std::numeric_limits<double>::max()); }
+		inline static int digits10() { return Real::digits10; }
+	};
+
+
+	/**
+	 \brief Permits the use of bertini::dd_complex in Eigen matrices.
+	 */
+	template<> struct NumTraits<bertini::dd_complex> : GenericNumTraits<bertini::dd_complex>
+	{
+		typedef bertini::dd_real Real;
+		typedef bertini::dd_complex NonInteger;
+		typedef bertini::dd_complex Nested;
+		typedef bertini::dd_complex Literal;
+		enum {
+			IsComplex = 1,
+			IsInteger = 0,
+			IsSigned = 1,
+			RequireInitialization = 0,
+			ReadCost = 2 * NumTraits<Real>::ReadCost,
+			AddCost = 2 * NumTraits<Real>::AddCost,
+			MulCost = 4 * NumTraits<Real>::MulCost + 2 * NumTraits<Real>::AddCost
+		};
+
+		inline static Real epsilon() { return NumTraits<Real>::epsilon(); }
+		inline static Real dummy_precision() { return NumTraits<Real>::dummy_precision(); }
+		inline static Real highest() { return NumTraits<Real>::highest(); }
+		inline static Real lowest() { return NumTraits<Real>::lowest(); }
+		inline static int digits10() { return NumTraits<Real>::digits10(); }
+	};
+
+
+#if EIGEN_VERSION_AT_LEAST(3,2,92)
+	template<typename BinaryOp>
+	struct ScalarBinaryOpTraits<bertini::dd_complex, bertini::dd_real, BinaryOp>
+	{
+		typedef bertini::dd_complex ReturnType;
+	};
+
+	template<typename BinaryOp>
+	struct ScalarBinaryOpTraits<bertini::dd_real, bertini::dd_complex, BinaryOp>
+	{
+		typedef bertini::dd_complex ReturnType;
+	};
+#else
+	namespace internal {
+		template<>
+		struct scalar_product_traits<bertini::dd_complex, bertini::dd_real>
+		{
+			enum { Defined = 1 };
+			typedef bertini::dd_complex ReturnType;
+		};
+
+		template<>
+		struct scalar_product_traits<bertini::dd_real, bertini::dd_complex>
+		{
+			enum { Defined = 1 };
+			typedef bertini::dd_complex ReturnType;
+		};
+	}
+#endif
+
+} // re: namespace Eigen
+
+#endif
@@ -146,6 +146,18 @@ namespace Eigen {
 			return a + (b-a) * random<bertini::complex>();
 		}
 
+		// the inner kernel of matrix products, and so of the blocked LU update.  accumulates with the fused multiply-add rather than forming each product.
+		template<>
+		struct conj_helper<bertini::complex, bertini::complex, false, false>
+		{
+			typedef bertini::complex Scalar;
+			EIGEN_STRONG_INLINE Scalar pmadd(const Scalar& x, const Scalar& y, const Scalar& c) const
+			{ Scalar r(c); r.MultiplyAdd(x,y); return r; }
+
+			EIGEN_STRONG_INLINE Scalar pmul(const Scalar& x, const Scalar& y) const
+			{ return x*y; }
+		};
+
 		template<>
 		struct conj_helper<bertini::complex, bertini::complex, false, true>
 		{
@@ -502,6 +514,105 @@ namespace bertini {
 		return Vec<NumberType>(size).unaryExpr([](NumberType const& x) { return RandomUnit<NumberType>(); });
 	}
 
+
+
+	/**
+	\brief Estimate the 1-norm of the inverse of a matrix, given solves with it and its adjoint.
+
+	This is the estimator of Hager, as refined by Higham, and used in LAPACK's xLACON.  It is a lower bound on \f$\|A^{-1}\|_1\f$, usually equal to it or within a small factor, at the cost of a few solves with \f$A\f$ and its adjoint.  The inverse is never formed.
+
+	\param n The size of the matrix.  Must be square and non-singular.
+	\param solve Given b, returns the Vec<NumberType> x with \f$A x = b\f$.
+	\param adjoint_solve Given b, returns the Vec<NumberType> x with \f$A^* x = b\f$.
+	\param max_iterations The most number of solve pairs to do.  The iteration usually stops after two.
+
+	\return The estimate.
+	\tparam NumberType The complex number type.
+	*/
+	template <typename NumberType, typename SolveF, typename AdjointSolveF>
+	typename Eigen::NumTraits<NumberType>::Real InverseOneNormEstimate(Eigen::Index n, SolveF const& solve, AdjointSolveF const& adjoint_solve, unsigned max_iterations = 5)
+	{
+		using RealType = typename Eigen::NumTraits<NumberType>::Real;
+		using std::abs;
+
+		auto one_norm = [](Vec<NumberType> const& v)
+		{
+			RealType s(0);
+			for (int ii = 0; ii < v.size(); ++ii)
+				s += abs(v(ii));
+			return s;
+		};
+
+		Vec<NumberType> x = Vec<NumberType>::Constant(n, NumberType(RealType(1)/n));
+		RealType estimate(0);
+		for (unsigned iteration = 0; iteration < max_iterations; ++iteration)
+		{
+			Vec<NumberType> y = solve(x);
+			RealType norm_y = one_norm(y);
+			if (iteration > 0 && norm_y <= estimate) // no longer increasing
+				break;
+			estimate = norm_y;
+
+			Vec<NumberType> signs(n);
+			for (int ii = 0; ii < n; ++ii)
+			{
+				RealType a = abs(y(ii));
+				signs(ii) = a==0 ? NumberType(1) : NumberType(y(ii)/a);
+			}
+			Vec<NumberType> z = adjoint_solve(signs);
+
+			int j = 0;
+			RealType max_z = abs(z(0));
+			for (int ii = 1; ii < n; ++ii)
+				if (abs(z(ii)) > max_z)
+				{
+					max_z = abs(z(ii));
+					j = ii;
+				}
+
+			if (max_z <= RealType(z.dot(x).real())) // at a local maximum
+				break;
+
+			x.setZero();
+			x(j) = NumberType(1);
+		}
+
+		// guards against matrices for which the iteration is fooled.  from Higham's refinement.
+		Vec<NumberType> b(n);
+		for (int ii = 0; ii < n; ++ii)
+		{
+			RealType b_ii = n>1 ? RealType(1) + RealType(ii)/(n-1) : RealType(1);
+			b(ii) = NumberType(ii%2 ? RealType(-b_ii) : b_ii);
+		}
+		RealType alternative = 2*one_norm(solve(b))/(3*n);
+
+		return alternative > estimate ? alternative : estimate;
+	}
+
+
+	/**
+	\brief Estimate the 1-norm of the inverse of a matrix, from its LU factorization.
+
+	\param LU The factorization of the matrix.  Must be square and non-singular.
+	\param max_iterations The most number of solve pairs to do.  The iteration usually stops after two.
+
+	\return The estimate, as the overload taking solves.
+	\tparam NumberType The complex number type.
+	*/
+	template <typename NumberType>
+	typename Eigen::NumTraits<NumberType>::Real InverseOneNormEstimate(Eigen::PartialPivLU<Mat<NumberType>> const& LU, unsigned max_iterations = 5)
+	{
+		// PA = LU, so the adjoint of A is U^* L^* P.
+		auto adjoint_solve = [&LU](Vec<NumberType> const& b)
+		{
+			Vec<NumberType> w = LU.matrixLU().template triangularView<Eigen::Upper>().adjoint().solve(b);
+			w = LU.matrixLU().template triangularView<Eigen::UnitLower>().adjoint().solve(w);
+			return Vec<NumberType>(LU.permutationP().transpose() * w);
+		};
+
+		return InverseOneNormEstimate<NumberType>(LU.matrixLU().rows(), [&LU](Vec<NumberType> const& b){ return Vec<NumberType>(LU.solve(b)); }, adjoint_solve, max_iterations);
+	}
+
 }
 
 
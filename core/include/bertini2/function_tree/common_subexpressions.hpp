@@ -0,0 +1,117 @@
+//This file is part of Bertini 2.
+//
+//common_subexpressions.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//common_subexpressions.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with common_subexpressions.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file common_subexpressions.hpp
+
+\brief Provides common subexpression elimination over collections of function trees.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_COMMON_SUBEXPRESSIONS_HPP
+#define BERTINI_FUNCTION_TREE_COMMON_SUBEXPRESSIONS_HPP
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/symbols/differential.hpp"
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief The effect of a pass of common subexpression elimination.
+	*/
+	struct CSEStatistics
+	{
+		size_t nodes_before = 0; ///< The number of distinct nodes reachable from the roots, before merging.
+		size_t nodes_after = 0; ///< The number of distinct nodes reachable from the roots, after merging.
+	};
+
+
+	/**
+	\brief Count the distinct nodes reachable from a collection of roots.  Nodes which are shared are counted once.
+	*/
+	size_t CountDistinctNodes(std::vector< std::shared_ptr<Node> > const& roots);
+
+
+	/**
+	\brief Merge structurally identical subtrees of a collection of trees into single shared nodes.
+
+	Two nodes are identical if they are of the same type, store the same data (signs, exponents, exact numeric values), and have identical children.  Variables, differentials and the special numbers are compared by identity of the underlying variable or constant; Float numbers are only merged if they are already the same node.  Function nodes, including Jacobians, are never merged with each other, since they are named, but their entry nodes are.
+
+	The trees are modified in place, by replacing children of operators and roots of functions.  The values of the trees are unchanged.  Identical subexpressions are then evaluated once per point, because the stored value of a shared node is reused.
+
+	\param roots The trees to merge.  Typically the functions and Jacobian entries of a System.
+	\return The number of distinct nodes before and after merging.
+	*/
+	CSEStatistics EliminateCommonSubexpressions(std::vector< std::shared_ptr<Node> > const& roots);
+
+
+
+	/**
+	\brief Hashes and compares trees by structure, rather than by node identity.
+
+	Two trees are structurally equal if their nodes are of the same types, store the same data (signs, exponents, the exact text of numbers), and have structurally equal children.  Unlike EliminateCommonSubexpressions, variables and differentials are compared by the name of the variable, not its identity, so the same model parsed into two systems compares equal, and may key caches shared between systems.  Function nodes compare by their entry nodes.
+
+	The hash of each node, and each pair of nodes found equal, are remembered, so hashing a collection of trees, or comparing them against each other, visits each node once however many trees share it.  What is remembered is only valid while the trees are not modified; use a new hasher after modifying them.
+	*/
+	class StructuralHasher
+	{
+	public:
+
+		/**
+		\brief The structural hash of a tree.  Structurally equal trees have equal hashes.
+		*/
+		std::size_t Hash(std::shared_ptr<Node> const& n);
+
+		/**
+		\brief Whether two trees are structurally equal.  Trees with different hashes are rejected without being walked.
+		*/
+		bool Equal(std::shared_ptr<Node> const& a, std::shared_ptr<Node> const& b);
+
+	private:
+
+		std::unordered_map<Node const*, std::size_t> hashes_;
+		std::set< std::pair<Node const*, Node const*> > equal_; ///< The pairs found equal so far.
+	};
+
+
+	/**
+	\brief The structural hash of a tree.  See StructuralHasher.
+	*/
+	std::size_t StructuralHash(std::shared_ptr<Node> const& n);
+
+	/**
+	\brief Whether two trees are structurally equal.  See StructuralHasher.
+	*/
+	bool StructurallyEqual(std::shared_ptr<Node> const& a, std::shared_ptr<Node> const& b);
+
+} // re: namespace node
+} // re: namespace bertini
+
+
+#endif
@@ -0,0 +1,129 @@
+//This file is part of Bertini 2.
+//
+//eval_profile.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_profile.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_profile.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file eval_profile.hpp
+
+\brief Counting and timing the fresh evaluations of the nodes of function trees, to find which parts of a system are slow to evaluate.
+
+Profiling is compiled in only when the library is configured with `--enable-eval_profiling`, which defines BERTINI_ENABLE_EVAL_PROFILING.  Otherwise nothing here is called, and evaluation costs exactly what it did.
+
+When compiled in, every call of FreshEval_d or FreshEval_mp made by Node::Eval and Node::EvalInPlace is counted and timed, per node, on the calling thread.  Only evaluation through the function trees is profiled, so a system told to use its polynomial or compiled evaluation must be told not to, with System::UsePolynomialEvaluation(false) and System::UseCompiledEvaluation(false), for the profile to mean anything.
+
+\code
+sys.UsePolynomialEvaluation(false);
+bertini::node::profile::Reset();
+for (int ii = 0; ii < 1000; ++ii)
+	sys.Eval(x, t);
+bertini::node::profile::Report(std::cout, sys);
+\endcode
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_EVAL_PROFILE_HPP
+#define BERTINI_FUNCTION_TREE_EVAL_PROFILE_HPP
+
+#include <chrono>
+#include <iosfwd>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace bertini {
+
+class System;
+
+namespace node{
+
+	class Node;
+
+namespace profile{
+
+	/**
+	\brief The evaluations of one node.
+
+	Times are wall times.  The self time of a node excludes the time spent freshly evaluating its children, so the self times of all nodes add up to the total time evaluating.
+	*/
+	struct NodeProfile
+	{
+		std::type_info const* type = nullptr; ///< The type of the node, such as SumOperator.
+		Node const* function = nullptr; ///< The innermost Function node, such as a system function or subfunction, which was being evaluated when this node was first evaluated.  Null if none.
+
+		unsigned long long num_evals_d = 0; ///< The number of calls of FreshEval_d.
+		unsigned long long num_evals_mp = 0; ///< The number of calls of FreshEval_mp.
+		double self_seconds_d = 0;
+		double self_seconds_mp = 0;
+		double total_seconds_d = 0; ///< Including the fresh evaluation of children.
+		double total_seconds_mp = 0;
+	};
+
+	/**
+	\brief The profiles of the nodes evaluated by the calling thread, since the last Reset.
+
+	Keyed by the address of the node, so a node destroyed since being profiled may share its key with a new one.  Reset between systems.
+	*/
+	std::unordered_map<Node const*, NodeProfile> const& Profiles();
+
+	/**
+	\brief Forget the profiles of the calling thread.
+	*/
+	void Reset();
+
+	/**
+	\brief Write a report of the profiles of the calling thread, in terms of a system.
+
+	The report has three parts.
+
+	* Each function and subfunction of the system, with the number of times it was freshly evaluated, and the total time, including the nodes under it.
+	* The time spent at each type of operator, summed over all nodes.
+	* The nodes with the most self time, with their type and the function or subfunction they are in.
+
+	\param out The stream to write to.
+	\param sys The system which was evaluated, for the names of its functions and subfunctions.  The functions of nodes not in it are reported as unknown.
+	\param num_hotspots The number of nodes with the most self time to list.
+	*/
+	void Report(std::ostream & out, System const& sys, unsigned num_hotspots = 20);
+
+
+	/**
+	\brief Times one fresh evaluation of a node, from construction to destruction.  Used by Node::Eval and Node::EvalInPlace, when profiling is compiled in.
+	*/
+	class ScopedEval
+	{
+	public:
+		ScopedEval(Node const& n, bool multiple_precision);
+		~ScopedEval();
+
+		ScopedEval(ScopedEval const&) = delete;
+		ScopedEval& operator=(ScopedEval const&) = delete;
+
+	private:
+		NodeProfile* profile_;
+		bool multiple_precision_;
+		std::chrono::steady_clock::time_point start_;
+	};
+
+} // re: namespace profile
+} // re: namespace node
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,139 @@
+//This file is part of Bertini 2.
+//
+//native_program.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//native_program.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with native_program.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file native_program.hpp
+
+\brief Provides the NativeProgram, a StraightLineProgram compiled to native code for double precision.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_NATIVE_PROGRAM_HPP
+#define BERTINI_FUNCTION_TREE_NATIVE_PROGRAM_HPP
+
+#include <memory>
+#include <string>
+
+#include "bertini2/function_tree/straight_line_program.hpp"
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief A StraightLineProgram compiled to native code, for evaluation and reverse sweeps in double precision.
+
+	The instructions are written out as C++, one statement each on std::complex<double>, with nothing left to interpret: evaluation is one unrolled function, and the reverse sweep of each output another.  The source is compiled into a shared library by the system's C++ compiler, which is loaded.
+
+	The generated code works on the same register file as the program, so the inputs and constants are loaded as before, and a program using its native form, see StraightLineProgram::SetNative, is used exactly as one interpreting.  The constants are read from the registers, not written into the code, so programs of the same structure share one library whatever their numbers, as for many instances of a parametrized model.  Libraries are kept in a directory, named by a hash of their source, the compiler and its flags, and reused by later builds, in this run or another.
+
+	Building needs a C++ compiler at run time.  The compiler is `c++`, or the value of the environment variable BERTINI_NATIVE_CXX, and is run directly, not through a shell, with the whitespace-separated flags in BERTINI_NATIVE_CXXFLAGS, `-O2` if unset.
+
+	Since a loaded library runs as the user, the cache directory is made private, with mode 0700, and libraries are loaded only from a directory and files owned by the current user and writable by no one else; anything else is refused.
+
+	\code
+	auto native = NativeProgram::Build(slp); // cached in NativeProgram::DefaultCacheDirectory()
+	slp.SetNative(native);
+	slp.Eval<dbl>(); // runs native code
+	\endcode
+	*/
+	class NativeProgram
+	{
+	public:
+
+		/**
+		\brief Build the native form of a program, or load it if already built.
+
+		\throws std::runtime_error, if the source cannot be written, does not compile, or the library cannot be loaded.
+		\throws std::runtime_error, if the cache directory or the library is not a plain directory or file owned by the current user and writable only by them.
+
+		\param slp The program to compile.
+		\param cache_directory The directory holding the libraries.  Made, private to the user, if it does not exist.
+		*/
+		static std::shared_ptr<NativeProgram> Build(StraightLineProgram const& slp, std::string const& cache_directory = DefaultCacheDirectory());
+
+		/**
+		\brief The C++ source of the native form of a program.
+		*/
+		static std::string Source(StraightLineProgram const& slp);
+
+		/**
+		\brief The directory libraries are kept in by default, one per user: bertini2_native in $XDG_CACHE_HOME, else in $HOME/.cache, else bertini2_native-<uid> in the system's temporary directory.
+		*/
+		static std::string DefaultCacheDirectory();
+
+		~NativeProgram();
+
+		NativeProgram(NativeProgram const&) = delete;
+		NativeProgram& operator=(NativeProgram const&) = delete;
+
+		/**
+		\brief Evaluate the program on a register file, with its inputs and constants loaded, as StraightLineProgram::Eval.
+		*/
+		void Eval(dbl * registers) const
+		{
+			eval_(registers);
+		}
+
+		/**
+		\brief Compute the adjoints of one output, as StraightLineProgram::ReverseSweep, from registers evaluated by Eval.
+		*/
+		void ReverseSweep(size_t index, dbl const* registers, dbl * adjoints) const
+		{
+			sweep_(static_cast<unsigned>(index), registers, adjoints);
+		}
+
+		/**
+		\brief The path of the loaded library.
+		*/
+		std::string const& LibraryPath() const
+		{
+			return library_path_;
+		}
+
+		/**
+		\brief Whether the library was found already built, rather than compiled by this Build.
+		*/
+		bool WasCached() const
+		{
+			return was_cached_;
+		}
+
+	private:
+
+		NativeProgram() = default;
+
+		using EvalFunction = void (*)(dbl *);
+		using SweepFunction = void (*)(unsigned, dbl const*, dbl *);
+
+		void* handle_ = nullptr; ///< From dlopen.
+		EvalFunction eval_ = nullptr;
+		SweepFunction sweep_ = nullptr;
+		std::string library_path_;
+		bool was_cached_ = false;
+	};
+
+} // re: namespace node
+} // re: namespace bertini
+
+
+#endif
@@ -43,17 +43,25 @@
 
 #include "bertini2/config.h"
 
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <memory>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <boost/type_index.hpp>
 
 #include "bertini2/num_traits.hpp"
+#include "bertini2/function_tree/eval_profile.hpp"
 
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -81,24 +89,46 @@ enum class VariableGroupType
 
 namespace node{
 
+/**
+\brief The integer by which a Variable is known when differentiating, Variable::Id.  Nodes are evaluated with respect to a variable by its id, as the differentials in a derivative tree compare them.
+*/
+using VariableId = int;
+
+/**
+\brief The id with respect to which nothing is differentiated, for evaluating functions rather than derivatives.
+*/
+constexpr VariableId NoVariable = -1;
+
 namespace detail{
 	template<typename T>
 	struct FreshEvalSelector
 	{};
 
+	inline
+	void SetZero(dbl& z)
+	{
+		z = dbl(0);
+	}
+
+	inline
+	void SetZero(mpfr& z)
+	{
+		z.SetZero();
+	}
+
 	template<>
 	struct FreshEvalSelector<dbl>
 	{
 		
 		template<typename N>
-		static dbl Run(N const& n, std::shared_ptr<Variable> const& diff_variable)
+		static dbl Run(N const& n, VariableId diff_variable)
 		{
 			return n.FreshEval_d(diff_variable);
 		}
 		
 		
 		template<typename N>
-		static void RunInPlace(dbl& evaluation_value, N const& n, std::shared_ptr<Variable> const& diff_variable)
+		static void RunInPlace(dbl& evaluation_value, N const& n, VariableId diff_variable)
 		{
 			n.FreshEval_d(evaluation_value, diff_variable);
 		}
@@ -109,19 +139,159 @@ namespace detail{
 	struct FreshEvalSelector<mpfr>
 	{
 		template<typename N>
-		static mpfr Run(N const& n, std::shared_ptr<Variable> const& diff_variable)
+		static mpfr Run(N const& n, VariableId diff_variable)
 		{
 			return n.FreshEval_mp(diff_variable);
 		}
 		
 		
 		template<typename N>
-		static void RunInPlace(mpfr& evaluation_value, N const& n, std::shared_ptr<Variable> const& diff_variable)
+		static void RunInPlace(mpfr& evaluation_value, N const& n, VariableId diff_variable)
 		{
 			n.FreshEval_mp(evaluation_value, diff_variable);
 		}
 
 	};
+
+
+	/**
+	\brief The stored values of a Node, and whether they are current.
+
+	The double precision value is held inline.  The multiple precision value is allocated when first used, so that nodes evaluated only in double precision never carry an mpfr.  Until then, its precision is recorded, and given to it when it is made.
+	*/
+	class StoredValues
+	{
+	public:
+
+		StoredValues() : precision_(DefaultPrecision())
+		{}
+
+		StoredValues(StoredValues const& other) : value_d_(other.value_d_), precision_(other.Precision())
+		{
+			if (other.value_mp_)
+				value_mp_.reset(new std::pair<mpfr,bool>(*other.value_mp_));
+		}
+
+		StoredValues& operator=(StoredValues other)
+		{
+			std::swap(value_d_, other.value_d_);
+			std::swap(value_mp_, other.value_mp_);
+			std::swap(precision_, other.precision_);
+			return *this;
+		}
+
+		template<typename T>
+		std::pair<T,bool>& Get() const;
+
+		unsigned Precision() const
+		{
+			return value_mp_ ? value_mp_->first.precision() : precision_;
+		}
+
+		void Precision(unsigned prec) const
+		{
+			if (value_mp_)
+				value_mp_->first.precision(prec);
+			else
+				precision_ = prec;
+		}
+
+		void Invalidate() const
+		{
+			value_d_.second = false;
+			if (value_mp_)
+				value_mp_->second = false;
+		}
+
+		/**
+		Change the precision, invalidating the multiple precision value if it differs.  For constants, whose values are otherwise kept across resets.
+		*/
+		void PrecisionOfConstant(unsigned prec) const
+		{
+			if (prec==Precision())
+				return;
+
+			Precision(prec);
+			if (value_mp_)
+				value_mp_->second = false;
+		}
+
+		/**
+		The bytes of the multiple precision value, if made.
+		*/
+		std::size_t HeapBytes() const;
+
+	private:
+		mutable std::pair<dbl,bool> value_d_ = std::make_pair(dbl(), false);
+		mutable std::unique_ptr<std::pair<mpfr,bool> > value_mp_;
+		mutable unsigned precision_; ///< The precision the multiple precision value will be made at.  Meaningful only until it is.
+	};
+
+	/**
+	\brief A multiple precision workspace for a Node, allocated when first used.
+
+	Like the stored values, so that nodes in double precision runs do not carry an mpfr.  Copies start empty, at the same precision.
+	*/
+	class MpfrWorkspace
+	{
+	public:
+
+		MpfrWorkspace() : precision_(DefaultPrecision())
+		{}
+
+		MpfrWorkspace(MpfrWorkspace const& other) : precision_(other.precision_)
+		{}
+
+		MpfrWorkspace& operator=(MpfrWorkspace const& other)
+		{
+			Precision(other.precision_);
+			return *this;
+		}
+
+		mpfr& Get() const
+		{
+			if (!value_)
+			{
+				value_.reset(new mpfr());
+				value_->precision(precision_);
+			}
+			return *value_;
+		}
+
+		void Precision(unsigned prec) const
+		{
+			precision_ = prec;
+			if (value_)
+				value_->precision(prec);
+		}
+
+		/**
+		The bytes of the workspace, if made.
+		*/
+		std::size_t HeapBytes() const;
+
+	private:
+		mutable std::unique_ptr<mpfr> value_;
+		mutable unsigned precision_;
+	};
+
+	template<>
+	inline std::pair<dbl,bool>& StoredValues::Get<dbl>() const
+	{
+		return value_d_;
+	}
+
+	template<>
+	inline std::pair<mpfr,bool>& StoredValues::Get<mpfr>() const
+	{
+		if (!value_mp_)
+		{
+			value_mp_.reset(new std::pair<mpfr,bool>());
+			value_mp_->first.precision(precision_);
+			value_mp_->second = false;
+		}
+		return *value_mp_;
+	}
 }
 /**
 An interface for all nodes in a function tree, and for a function object as well.  Almost all
@@ -155,27 +325,51 @@ public:
 
 	public:
 	/**
-	 Evaluate the node.  If flag false, just return value, if flag true
-	 run the specific FreshEval of the node, then set flag to false.
+	 Evaluate the node, and get a reference to its value, which it keeps until it is next evaluated.  If flag false, just return value, if flag true
+	 run the specific FreshEval of the node, in place in the stored value, then set flag to false.
 
-	 Template type is type of value you want returned.
+	 Nothing is copied, so for mpfr this is the cheapest way to use the value of a child, such as in the FreshEval of an operator.
 
 	 \return The value of the node.
 	 \tparam T The number type for return.  Must be one of the types stored in the Node class, currently dbl and mpfr.
 	 */
 	template<typename T>
-	T Eval(std::shared_ptr<Variable> const& diff_variable = nullptr) const 
+	T const& EvalRef(VariableId diff_variable = NoVariable) const
 	{
-		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+		auto& val_pair = current_value_.Get<T>();
 		if(!val_pair.second)
 		{
-			val_pair.first = detail::FreshEvalSelector<T>::Run(*this,diff_variable);
+			// a derivative part not involving the variable is zero, its subtree skipped
+			if (!DependsOnDifferential(diff_variable))
+				detail::SetZero(val_pair.first);
+			else
+			{
+			#ifdef BERTINI_ENABLE_EVAL_PROFILING
+				profile::ScopedEval profiling(*this, std::is_same<T,mpfr>::value);
+			#endif
+				detail::FreshEvalSelector<T>::RunInPlace(val_pair.first, *this,diff_variable);
+			}
 			val_pair.second = true;
 		}
- 
-		
+
 		return val_pair.first;
 	}
+
+
+	/**
+	 Evaluate the node.  If flag false, just return value, if flag true
+	 run the specific FreshEval of the node, then set flag to false.
+
+	 Template type is type of value you want returned.
+
+	 \return A copy of the value of the node.  See EvalRef, which does not copy.
+	 \tparam T The number type for return.  Must be one of the types stored in the Node class, currently dbl and mpfr.
+	 */
+	template<typename T>
+	T Eval(VariableId diff_variable = NoVariable) const 
+	{
+		return EvalRef<T>(diff_variable);
+	}
 	
 
 	/**
@@ -184,22 +378,13 @@ public:
 	 
 	 Template type is type of value you want returned.
 	 
-	 \return The value of the node.
+	 \param eval_value Set to the value of the node, reusing its storage.
 	 \tparam T The number type for return.  Must be one of the types stored in the Node class, currently dbl and mpfr.
 	 */
 	template<typename T>
-	void EvalInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable = nullptr) const
+	void EvalInPlace(T& eval_value, VariableId diff_variable = NoVariable) const
 	{
-		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
-		if(!val_pair.second)
-		{
-			detail::FreshEvalSelector<T>::RunInPlace(val_pair.first, *this,diff_variable);
-			val_pair.second = true;
-		}
-		
-		eval_value = val_pair.first;
-		
-		
+		eval_value = EvalRef<T>(diff_variable);
 	}
 
 	
@@ -277,12 +462,69 @@ public:
 	 */
 	virtual void precision(unsigned int prec) const = 0;
 
+	/**
+	 Change the precision of the values and workspaces of this node only.
+
+	 Unlike precision(unsigned), this does not descend into the children of the Node, so that a caller holding the nodes of a graph, each once, can change the precision of each exactly once.  See UniqueNodes.
+
+	 \param prec the number of digits to change precision to.
+	 */
+	virtual void OwnPrecision(unsigned int prec) const
+	{
+		current_value_.Precision(prec);
+	}
+
 	unsigned precision() const
 	{
-		return std::get<std::pair<mpfr,bool> >(current_value_).first.precision();
+		return current_value_.Precision();
 	}
 	///////// PUBLIC PURE METHODS /////////////////
 
+
+	/**
+	Set the stored values for the Node to indicate a fresh eval on the next pass.  This is so that Nodes which are referred to more than once, are only evaluated once.  The first evaluation is fresh, and then the indicator for fresh/stored is set to stored.  Subsequent evaluation calls simply return the stored number.
+
+	Unlike Reset(), this does not descend into the children of the Node.  It is public so that a System can invalidate exactly those nodes which depend on a changed value.
+	*/
+	void ResetStoredValues() const
+	{
+		current_value_.Invalidate();
+	}
+
+
+	/**
+	\brief Set the variables of whose differentials the value of this node may be non-zero, by id.  See MarkDifferentialDependence.
+
+	Evaluated with respect to a variable not in a non-empty dependence, the node is zero, without evaluating it or its children.  An empty dependence, the default, is for nodes which involve no differentials, or whose dependence is not known, which are always evaluated.
+
+	\param dependence The ids of the variables, sorted.
+	*/
+	void DifferentialDependence(std::vector<VariableId> dependence) const
+	{
+		differential_dependence_ = std::move(dependence);
+	}
+
+	std::vector<VariableId> const& DifferentialDependence() const
+	{
+		return differential_dependence_;
+	}
+
+	/**
+	\brief Whether the node may be non-zero, evaluated with respect to a variable.  Always for NoVariable, and for nodes with an empty dependence.
+	*/
+	bool DependsOnDifferential(VariableId diff_variable) const
+	{
+		return diff_variable < 0 || differential_dependence_.empty() || std::binary_search(differential_dependence_.begin(), differential_dependence_.end(), diff_variable);
+	}
+
+
+	/**
+	\brief An estimate of the bytes held by this node: the node itself, and the heap storage it owns, such as its multiple precision values and workspaces at their current precision.
+
+	Children are not included.  For whole trees, with shared nodes counted once, use TreeMemoryBytes.
+	*/
+	virtual std::size_t MemoryBytes() const;
+
 	/**
 	Check if a Node is polynomial -- it has degree at least 0.  Negative degrees indicate non-polynomial.
 
@@ -312,8 +554,9 @@ public:
 protected:
 	//Stores the current value of the node in all required types
 	//We must hard code in all types that we want here.
-	//TODO: Initialize this to some default value, second = false
-	mutable std::tuple< std::pair<dbl,bool>, std::pair<mpfr,bool> > current_value_;
+	detail::StoredValues current_value_;
+
+	mutable std::vector<VariableId> differential_dependence_; ///< The ids of the variables whose differentials this node depends on, sorted.  Not serialized, set by MarkDifferentialDependence.
 	
 	
 	
@@ -326,14 +569,14 @@ protected:
 
 	If we had the ability to use template virtual functions, we would have.  However, this is impossible with current C++ without using experimental libraries, so we have two copies -- because there are two number types for Nodes, dbl and mpfr.
 	*/
-	virtual dbl FreshEval_d(std::shared_ptr<Variable> const&) const = 0;
+	virtual dbl FreshEval_d(VariableId) const = 0;
 
 	/**
 	 Overridden code for specific node types, for how to evaluate themselves.  Called from the wrapper EvalInPlace<>() call from Node, if so required (by resetting, etc).
 	 
 	 If we had the ability to use template virtual functions, we would have.  However, this is impossible with current C++ without using experimental libraries, so we have two copies -- because there are two number types for Nodes, dbl and mpfr.
 	 */
-	virtual void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const&) const = 0;
+	virtual void FreshEval_d(dbl& evaluation_value, VariableId) const = 0;
 
 	
 	/**
@@ -341,35 +584,21 @@ protected:
 
 	If we had the ability to use template virtual functions, we would have.  However, this is impossible with current C++ without using experimental libraries, so we have two copies -- because there are two number types for Nodes, dbl and mpfr.
 	*/
-	virtual mpfr FreshEval_mp(std::shared_ptr<Variable> const&) const = 0;
+	virtual mpfr FreshEval_mp(VariableId) const = 0;
 	
 	/**
 	 Overridden code for specific node types, for how to evaluate themselves.  Called from the wrapper Eval<>() call from Node, if so required (by resetting, etc).
 	 
 	 If we had the ability to use template virtual functions, we would have.  However, this is impossible with current C++ without using experimental libraries, so we have two copies -- because there are two number types for Nodes, dbl and mpfr.
 	 */
-	virtual void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const&) const = 0;
+	virtual void FreshEval_mp(mpfr& evaluation_value, VariableId) const = 0;
 
 	
 	
 	
 	///////// END PRIVATE PURE METHODS /////////////////
 	
-	
-	/**
-	Set the stored values for the Node to indicate a fresh eval on the next pass.  This is so that Nodes which are referred to more than once, are only evaluated once.  The first evaluation is fresh, and then the indicator for fresh/stored is set to stored.  Subsequent evaluation calls simply return the stored number.
-	*/
-	void ResetStoredValues() const
-	{
-		std::get< std::pair<dbl,bool> >(current_value_).second = false;
-		std::get< std::pair<mpfr,bool> >(current_value_).second = false;
-	}
-
-	Node()
-	{
-		std::get<std::pair<dbl,bool> >(current_value_).second = false;
-		std::get<std::pair<mpfr,bool> >(current_value_).second = false;
-	}
+	Node() = default;
 private:
 	friend std::ostream& operator<<(std::ostream & out, const Node& N);
 
@@ -389,6 +618,87 @@ private:
 		N.print(out);
 		return out;
 	}
+
+
+	/**
+	\brief The immediate children of a node, of any type.  Leaves have none.
+	*/
+	std::vector<std::shared_ptr<Node> > Children(std::shared_ptr<Node> const& n);
+
+	/**
+	\brief The bytes held by the nodes of trees, each node counted once.
+
+	\param roots The roots of the trees.
+	\param counted The nodes already counted, which are skipped, and to which the nodes counted here are added.  Passing the same set for several calls counts nodes shared between them once.
+	\return The sum of Node::MemoryBytes over the nodes not already counted.
+	*/
+	std::size_t TreeMemoryBytes(std::vector<std::shared_ptr<Node> > const& roots, std::unordered_set<Node const*> & counted);
+
+	/**
+	\brief The nodes of trees, each once, however many times it is shared within and between them.
+
+	\param roots The roots of the trees.  Null roots are skipped.
+	\return The nodes, in no particular order.
+	*/
+	std::vector<std::shared_ptr<Node> > UniqueNodes(std::vector<std::shared_ptr<Node> > const& roots);
+
+
+	/**
+	\brief Set the DifferentialDependence of the nodes of a derivative tree, so that evaluating it with respect to one variable skips the subtrees which are zero for it.
+
+	A derivative is linear in the differentials it contains, so a subtree is zero with respect to a variable if it involves differentials, but not that of the variable.  The dependence is found through sums, negations, and multiplications, and a node built otherwise from differentials, such as a quotient by one, depends on them all, and is left always evaluated, as are nodes involving no differentials.
+
+	The ids of variables never change, so the marks hold in every system the tree is used in, and marking a node twice marks it the same.
+
+	\param root The root of the derivative tree.
+	\return The nodes involving differentials, each once, including the root if it does.  They alone change value from one variable to the next.
+	*/
+	std::vector<std::shared_ptr<Node> > MarkDifferentialDependence(std::shared_ptr<Node> const& root);
+
+
+	/**
+	\brief While alive, shares the derivative of each node among all its uses, on the thread which made it.
+
+	Differentiation recurses through DerivativeOf, which without a memo differentiates the node afresh every time it is reached, so that a subexpression or subfunction used many times has its derivative built as many times.  With a memo, each node is differentiated once, and its derivative tree is shared by every use.
+
+	Memos nest, the innermost being used.  A memo is not shared between threads, nor may the derivatives it has made be differentiated from other threads while it is alive.
+
+	\code
+	{
+		DifferentiationMemo memo;
+		for (auto const& f : functions)
+			derivatives.push_back(DerivativeOf(f));
+	}
+	\endcode
+	*/
+	class DifferentiationMemo
+	{
+	public:
+		DifferentiationMemo();
+		~DifferentiationMemo();
+
+		DifferentiationMemo(DifferentiationMemo const&) = delete;
+		DifferentiationMemo& operator=(DifferentiationMemo const&) = delete;
+
+		/**
+		\brief The number of nodes differentiated through this memo.
+		*/
+		std::size_t Size() const
+		{
+			return derivatives_.size();
+		}
+
+	private:
+		friend std::shared_ptr<Node> DerivativeOf(std::shared_ptr<Node> const& n);
+
+		std::unordered_map<Node const*, std::shared_ptr<Node> > derivatives_; ///< The derivative of each node differentiated, keyed by the node.
+		DifferentiationMemo* enclosing_; ///< The memo active when this one was made, restored when it is destroyed.
+	};
+
+	/**
+	\brief The derivative of a node, taken from the calling thread's DifferentiationMemo if it has one, and differentiated and remembered there if not yet.  Without a memo, simply n->Differentiate().
+	*/
+	std::shared_ptr<Node> DerivativeOf(std::shared_ptr<Node> const& n);
 	
 	} // re: namespace node
 } // re: namespace bertini
@@ -78,6 +78,8 @@ namespace node{
 	{
 	public:
 		virtual ~SumOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 		
 		
@@ -132,6 +134,33 @@ namespace node{
 			NaryOperator::AddChild(std::move(child));
 			children_sign_.push_back(sign);
 		}
+
+		/**
+		 Get the signs of the terms.  true = add, false = subtract.  One-one with children().
+		 */
+		std::vector<bool> const& children_sign() const
+		{
+			return children_sign_;
+		}
+
+
+		/**
+		 Set whether double precision evaluation of this sum uses compensated (Neumaier) summation.  Off by default.  System::CompensatedSummation sets it for every sum of a system.
+
+		 Compensated summation carries the rounding error of each addition along, so a wide sum with cancellation keeps nearly all its digits, at about four times the cost of plain summation.  This can keep adaptive precision from raising precision just to make up for error in the sum.
+		 */
+		void CompensatedSummation(bool use)
+		{
+			compensated_summation_ = use;
+		}
+
+		/**
+		 Whether double precision evaluation of this sum uses compensated summation.
+		 */
+		bool CompensatedSummation() const
+		{
+			return compensated_summation_;
+		}
 		
 		
 		/**
@@ -187,26 +216,26 @@ namespace node{
 		 Specific implementation of FreshEval for add and subtract.
 		 If child_sign_ = true, then add, else subtract
 		 */
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
 
 		/**
 		 Specific implementation of FreshEval in place for add and subtract.
 		 If child_sign_ = true, then add, else subtract
 		 */
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 
 		
 		/**
 		 Specific implementation of FreshEval for add and subtract.
 		 If child_sign_ = true, then add, else subtract
 		 */
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
 
 		/**
 		 Specific implementation of FreshEval for add and subtract.
 		 If child_sign_ = true, then add, else subtract
 		 */
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 
 	private:
 		// Stores the sign of the particular term.  There is a one-one
@@ -215,6 +244,8 @@ namespace node{
 		
 		// TODO(JBC): If we add method to delete child, must also delete children_sign_ entry.
 		std::vector<bool> children_sign_;
+
+		bool compensated_summation_ = false; ///< Whether double precision evaluation uses compensated summation.  Not serialized; an evaluation setting, like the buffers below.
 		
 	private:
 
@@ -229,13 +260,11 @@ namespace node{
 		}
 
 
-		void PrecisionChangeSpecific(unsigned prec) const override
-		{
-			temp_mp_.precision(prec);
-		}
-
-		mutable mpfr temp_mp_;
 		mutable dbl temp_d_;
+
+		// double precision evaluation gathers the values of the terms into these, contiguously, to be reduced with SIMD.  sized when first evaluated after terms are added.  not serialized.
+		mutable std::vector<double> real_terms_, imag_terms_;
+		mutable std::vector<double> sign_factors_; ///< +1 or -1 for each term, from children_sign_.
 	};
 	
 	
@@ -294,11 +323,11 @@ namespace node{
 	protected:
 		
 		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 
 
 	private:
@@ -365,6 +394,8 @@ namespace node{
 		
 		
 		virtual ~MultOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 		
 		
@@ -384,6 +415,14 @@ namespace node{
 			NaryOperator::AddChild(std::move(child));
 			children_mult_or_div_.push_back(mult);
 		}
+
+		/**
+		 Get whether each factor multiplies or divides.  true = mult, false = divide.  One-one with children().
+		 */
+		std::vector<bool> const& children_mult_or_div() const
+		{
+			return children_mult_or_div_;
+		}
 		
 		
 		/**
@@ -424,11 +463,11 @@ namespace node{
 		
 		// Specific implementation of FreshEval for mult and divide.
 		//  If child_mult_ = true, then multiply, else divide
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 
 		
 		
@@ -457,12 +496,6 @@ namespace node{
 			ar & children_mult_or_div_;
 		}
 
-		void PrecisionChangeSpecific(unsigned prec) const override
-		{
-			temp_mp_.precision(prec);
-		}
-
-		mutable mpfr temp_mp_;
 		mutable dbl temp_d_;
 	};
 	
@@ -499,6 +532,16 @@ namespace node{
 		{
 			exponent_ = new_exponent;
 		}
+
+		std::shared_ptr<Node> const& base() const
+		{
+			return base_;
+		}
+
+		std::shared_ptr<Node> const& exponent() const
+		{
+			return exponent_;
+		}
 		
 		
 		void Reset() const override;
@@ -548,8 +591,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 
 			base_->precision(prec);
 			exponent_->precision(prec);
@@ -559,11 +601,11 @@ namespace node{
 
 	protected:
 		
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaulation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaulation_value, VariableId diff_variable) const override;
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaulation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaulation_value, VariableId diff_variable) const override;
 
 	private:
 				
@@ -667,7 +709,27 @@ namespace node{
 		}
 
 
+		/**
+		 Change the precision of this variable-precision tree node.
+		 
+		 \param prec the number of digits to change precision to.
+		 */
+		void precision(unsigned int prec) const override
+		{
+			UnaryOperator::precision(prec);
+			square_mp_.Precision(prec);
+		}
+
+		void OwnPrecision(unsigned int prec) const override
+		{
+			UnaryOperator::OwnPrecision(prec);
+			square_mp_.Precision(prec);
+		}
+
+
 		virtual ~IntegerPowerOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 		
 		/**
@@ -681,30 +743,82 @@ namespace node{
 	protected:
 		
 		
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
-			return pow(child_->Eval<dbl>(diff_variable), exponent_);
+			dbl evaluation_value;
+			FreshEvalInPlace(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
-			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
-			evaluation_value = pow(evaluation_value, exponent_);
+			FreshEvalInPlace(evaluation_value, diff_variable);
 		}
 
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return pow(child_->Eval<mpfr>(diff_variable),exponent_);
+			mpfr evaluation_value;
+			FreshEvalInPlace(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
-			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
-			evaluation_value = pow(evaluation_value, exponent_);
+			FreshEvalInPlace(evaluation_value, diff_variable);
 		}
 
 	private:
+
+		/**
+		 Powers of a variable come from the variable's table of its powers, shared by all the powers of it in the system.  Powers of anything else are computed by repeated squaring.
+		 */
+		template<typename T>
+		void FreshEvalInPlace(T& evaluation_value, VariableId diff_variable) const
+		{
+			const unsigned magnitude = exponent_ < 0 ? -exponent_ : exponent_;
+
+			if (auto v = dynamic_cast<Variable const*>(child_.get()))
+				evaluation_value = v->Power<T>(magnitude);
+			else
+			{
+				child_->EvalInPlace<T>(evaluation_value, diff_variable);
+				PowerBySquaring(evaluation_value, magnitude);
+			}
+
+			if (exponent_ < 0)
+				evaluation_value = T(1)/evaluation_value;
+		}
+
+		template<typename T>
+		void PowerBySquaring(T& value, unsigned exponent) const
+		{
+			auto& square = Square(value);
+			square = value;
+			value = T(1);
+			while (exponent > 0)
+			{
+				if (exponent & 1)
+					value *= square;
+				exponent >>= 1;
+				if (exponent > 0)
+					square *= square;
+			}
+		}
+
+		dbl& Square(dbl const&) const
+		{
+			return square_d_;
+		}
+
+		mpfr& Square(mpfr const&) const
+		{
+			return square_mp_.Get();
+		}
+
+		// workspaces for repeated squaring.  not serialized.
+		mutable dbl square_d_;
+		detail::MpfrWorkspace square_mp_;
 		
 		IntegerPowerOperator() = default;
 
@@ -778,11 +892,11 @@ namespace node{
 	protected:
 		
 		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 
 
 	private:
@@ -819,6 +933,12 @@ namespace node{
 		
 		ExpOperator(const std::shared_ptr<Node> & N) : UnaryOperator(N)
 		{};
+
+		/**
+		 Make an exponential which shares its computed value with other exponentials of the same argument.
+		 */
+		ExpOperator(const std::shared_ptr<Node> & N, std::shared_ptr<detail::SharedFunctionValues> const& shared_values) : UnaryOperator(N), shared_values_(shared_values)
+		{};
 	 
 		
 		
@@ -842,17 +962,25 @@ namespace node{
 		
 
 		virtual ~ExpOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 	protected:
 		
 		// Specific implementation of FreshEval for exponentiate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 
 	private:
+
+		template<typename T>
+		void FreshEvalInPlace(T& evaluation_value, VariableId diff_variable) const;
+
+		std::shared_ptr<detail::SharedFunctionValues> shared_values_ = std::make_shared<detail::SharedFunctionValues>(); ///< Shared with the exponentials in this node's derivatives.  Not serialized.
+
 		ExpOperator() = default;
 		friend class boost::serialization::access;
 		
@@ -901,11 +1029,11 @@ namespace node{
 	protected:
 		
 		// Specific implementation of FreshEval for exponentiate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		dbl FreshEval_d(VariableId diff_variable) const override;
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override;
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
+		mpfr FreshEval_mp(VariableId diff_variable) const override;
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override;
 		
 	private:
 		LogOperator() = default;
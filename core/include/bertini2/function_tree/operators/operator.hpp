@@ -49,6 +49,109 @@
 
 namespace bertini {
 namespace node{
+
+namespace detail{
+	/**
+	\brief Values of transcendental functions of one argument, shared between the nodes computing them.
+
+	The sine and cosine of a complex number cost the same to compute together as either one alone, and the derivatives of sin, cos, and exp contain cos, sin, and exp of the same argument.  Nodes made by differentiation share one of these with the node they came from.  Whichever is evaluated first computes the values, and the argument they were computed at is kept, so the others only compare it with their own argument.
+	*/
+	class SharedFunctionValues
+	{
+	public:
+
+		/**
+		Whether the values are current for this argument, at its precision.  After a raise of precision, the same point is a different argument, since the values kept were computed to fewer digits.
+		*/
+		template<typename T>
+		bool ComputedAt(T const& argument) const
+		{
+			const auto& a = Argument(&argument);
+			return a.second && SamePrecision(a.first, argument) && a.first==argument;
+		}
+
+		/**
+		Record the argument the values are about to be computed at, matching the precision of the slots to it.
+		*/
+		template<typename T>
+		void ComputingAt(T const& argument)
+		{
+			auto& a = Argument(&argument);
+			auto& v = Values(&argument);
+			MatchPrecision(v.first, argument);
+			MatchPrecision(v.second, argument);
+			MatchPrecision(a.first, argument);
+
+			a.first = argument;
+			a.second = true;
+		}
+
+		template<typename T>
+		T& First()
+		{
+			return Values(static_cast<T const*>(nullptr)).first;
+		}
+
+		template<typename T>
+		T& Second()
+		{
+			return Values(static_cast<T const*>(nullptr)).second;
+		}
+
+		/**
+		The bytes of the multiple precision values, if made.
+		*/
+		std::size_t HeapBytes() const;
+
+	private:
+
+		struct MultiplePrecision
+		{
+			std::pair<mpfr,bool> argument = std::make_pair(mpfr(), false);
+			std::pair<mpfr,mpfr> values;
+		};
+
+		// the multiple precision values are made on first use, so that double precision runs never allocate them.  the accessors below select by a pointer to the number type.
+		MultiplePrecision& Mp() const
+		{
+			if (!mp_)
+				mp_.reset(new MultiplePrecision);
+			return *mp_;
+		}
+
+		std::pair<dbl,bool> const& Argument(dbl const*) const { return argument_d_; }
+		std::pair<dbl,bool>& Argument(dbl const*) { return argument_d_; }
+		std::pair<mpfr,bool> const& Argument(mpfr const*) const { return Mp().argument; }
+		std::pair<mpfr,bool>& Argument(mpfr const*) { return Mp().argument; }
+
+		std::pair<dbl,dbl>& Values(dbl const*) { return values_d_; }
+		std::pair<mpfr,mpfr>& Values(mpfr const*) { return Mp().values; }
+
+		static bool SamePrecision(dbl const&, dbl const&)
+		{
+			return true;
+		}
+
+		static bool SamePrecision(mpfr const& kept, mpfr const& argument)
+		{
+			return kept.precision()==argument.precision();
+		}
+
+		static void MatchPrecision(dbl &, dbl const&)
+		{}
+
+		static void MatchPrecision(mpfr & slot, mpfr const& argument)
+		{
+			if (slot.precision()!=argument.precision())
+				slot.precision(argument.precision());
+		}
+
+		std::pair<dbl,bool> argument_d_ = std::make_pair(dbl(), false);
+		std::pair<dbl,dbl> values_d_;
+		mutable std::unique_ptr<MultiplePrecision> mp_;
+	};
+} // re: namespace detail
+
 	
 	/**
 	\brief Abstract Node type from which all Operators inherit.
@@ -193,8 +296,7 @@ namespace node{
 		 */
 		void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 
 			child_->precision(prec);
 		}
@@ -230,6 +332,8 @@ namespace node{
 	public:
 		
 		virtual ~NaryOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 		
 		void Reset() const override
@@ -260,10 +364,27 @@ namespace node{
 		{
 			return children_[0];
 		}
-		
-		
-		
-		
+
+		/**
+		 Get read access to all children of this operator, in the order in which they were added.
+		 */
+		std::vector< std::shared_ptr<Node> > const& children() const
+		{
+			return children_;
+		}
+
+
+		/**
+		 Replace the child at a position, keeping whatever else the operator stores for that position, such as its sign.
+		 */
+		void SetChild(size_t index, std::shared_ptr<Node> new_child)
+		{
+			children_[index] = std::move(new_child);
+		}
+
+
+
+
 		 /**
 		 Change the precision of this variable-precision tree node.
 		 
@@ -271,15 +392,19 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
-			
-			this->PrecisionChangeSpecific(prec);
+			OwnPrecision(prec);
 
 			for (auto iter : children_)
 				iter->precision(prec);
 		}
 
+		void OwnPrecision(unsigned int prec) const override
+		{
+			current_value_.Precision(prec);
+			
+			this->PrecisionChangeSpecific(prec);
+		}
+
 		
 		
 	protected:
@@ -49,6 +49,36 @@
 
 namespace bertini {
 namespace node{	
+
+namespace detail{
+	inline void SinCos(dbl const& z, dbl & s, dbl & c)
+	{
+		using std::sin; using std::cos; using std::sinh; using std::cosh;
+		const double sin_a = sin(z.real()), cos_a = cos(z.real()), sinh_b = sinh(z.imag()), cosh_b = cosh(z.imag());
+		s = dbl(sin_a*cosh_b, cos_a*sinh_b);
+		c = dbl(cos_a*cosh_b, -sin_a*sinh_b);
+	}
+
+	inline void SinCos(mpfr const& z, mpfr & s, mpfr & c)
+	{
+		z.SinCos(s, c);
+	}
+
+	/**
+	Bring the sine (First) and cosine (Second) in the shared values up to date with the argument.
+	*/
+	template<typename T>
+	void UpdateSinCos(SharedFunctionValues & shared, T const& argument)
+	{
+		if (shared.ComputedAt(argument))
+			return;
+
+		shared.ComputingAt(argument);
+		SinCos(argument, shared.First<T>(), shared.Second<T>());
+	}
+} // re: namespace detail
+
+
 	/**
 	\brief Abstract class for trigonometric Operator types.
 
@@ -99,6 +129,12 @@ namespace node{
 		
 		SinOperator(const std::shared_ptr<Node> & N) : TrigOperator(N), UnaryOperator(N)
 		{};
+
+		/**
+		 Make a sine which shares its computed value with the cosine of the same argument.
+		 */
+		SinOperator(const std::shared_ptr<Node> & N, std::shared_ptr<detail::SharedFunctionValues> const& shared_values) : TrigOperator(N), UnaryOperator(N), shared_values_(shared_values)
+		{};
 		
 		
 		
@@ -113,36 +149,46 @@ namespace node{
 		
 		
 		virtual ~SinOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 	protected:
 		
 		
-		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
-			return sin(child_->Eval<dbl>(diff_variable));
+			dbl evaluation_value;
+			FreshEval_d(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return sin(child_->Eval<mpfr>(diff_variable));
+			mpfr evaluation_value;
+			FreshEval_mp(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
-			evaluation_value = sin(evaluation_value);
+			detail::UpdateSinCos(*shared_values_, evaluation_value);
+			evaluation_value = shared_values_->First<mpfr>();
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
-			evaluation_value = sin(evaluation_value);
+			detail::UpdateSinCos(*shared_values_, evaluation_value);
+			evaluation_value = shared_values_->First<dbl>();
 		}
 
 		
 	private:
+
+		std::shared_ptr<detail::SharedFunctionValues> shared_values_ = std::make_shared<detail::SharedFunctionValues>(); ///< The sine and cosine of the child, shared with the cosine in this node's derivatives.  Not serialized.
+
 		SinOperator() = default;
 		friend class boost::serialization::access;
 
@@ -184,24 +230,24 @@ namespace node{
 		
 		
 		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return asin(child_->Eval<dbl>(diff_variable));
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return asin(child_->Eval<mpfr>(diff_variable));
+			return asin(child_->EvalRef<mpfr>(diff_variable));
 		}
 
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = asin(evaluation_value);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = asin(evaluation_value);
@@ -239,6 +285,12 @@ namespace node{
 		
 		CosOperator(const std::shared_ptr<Node> & N) : TrigOperator(N), UnaryOperator(N)
 		{};
+
+		/**
+		 Make a cosine which shares its computed value with the sine of the same argument.
+		 */
+		CosOperator(const std::shared_ptr<Node> & N, std::shared_ptr<detail::SharedFunctionValues> const& shared_values) : TrigOperator(N), UnaryOperator(N), shared_values_(shared_values)
+		{};
 		
 		
 		
@@ -255,37 +307,46 @@ namespace node{
 		
 		
 		virtual ~CosOperator() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 	protected:
 		
 		
-		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
-			return cos(child_->Eval<dbl>(diff_variable));
+			dbl evaluation_value;
+			FreshEval_d(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return cos(child_->Eval<mpfr>(diff_variable));
+			mpfr evaluation_value;
+			FreshEval_mp(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
-			evaluation_value = cos(evaluation_value);
+			detail::UpdateSinCos(*shared_values_, evaluation_value);
+			evaluation_value = shared_values_->Second<mpfr>();
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
-			evaluation_value = cos(evaluation_value);
+			detail::UpdateSinCos(*shared_values_, evaluation_value);
+			evaluation_value = shared_values_->Second<dbl>();
 		}
 
 		
-		
 	private:
+
+		std::shared_ptr<detail::SharedFunctionValues> shared_values_ = std::make_shared<detail::SharedFunctionValues>(); ///< The sine and cosine of the child, shared with the sine in this node's derivatives.  Not serialized.
+
 		CosOperator() = default;
 		friend class boost::serialization::access;
 		
@@ -331,24 +392,24 @@ namespace node{
 		
 		
 		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return acos(child_->Eval<dbl>(diff_variable));
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return acos(child_->Eval<mpfr>(diff_variable));
+			return acos(child_->EvalRef<mpfr>(diff_variable));
 		}
 		
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = acos(evaluation_value);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = acos(evaluation_value);
@@ -408,24 +469,24 @@ namespace node{
 		
 		
 		// Specific implementation of FreshEval for negate.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return tan(child_->Eval<dbl>(diff_variable));
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return tan(child_->Eval<mpfr>(diff_variable));
+			return tan(child_->EvalRef<mpfr>(diff_variable));
 		}
 		
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = tan(evaluation_value);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = tan(evaluation_value);
@@ -478,24 +539,24 @@ namespace node{
 		
 		
 		// Specific implementation of FreshEval for arctangent.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return atan(child_->Eval<dbl>(diff_variable));
 		}
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return atan(child_->Eval<mpfr>(diff_variable));
+			return atan(child_->EvalRef<mpfr>(diff_variable));
 		}
 		
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = atan(evaluation_value);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = atan(evaluation_value);
@@ -146,7 +146,7 @@ namespace node{
 		 */
 		std::shared_ptr<Node> Differentiate() const override
 		{
-			return entry_node_->Differentiate();
+			return DerivativeOf(entry_node_);
 		}
 		
 		
@@ -209,11 +209,10 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			if (val_pair.first.precision()==prec)
+			if (current_value_.Precision()==prec)
 				return;
 			else{
-				val_pair.first.precision(prec);
+				current_value_.Precision(prec);
 				entry_node_->precision(prec);
 			}
 			
@@ -224,7 +223,7 @@ namespace node{
 		/**
 		 Calls FreshEval on the entry node to the tree.
 		 */
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return entry_node_->Eval<dbl>(diff_variable);
 		}
@@ -232,7 +231,7 @@ namespace node{
 		/**
 		 Calls FreshEval in place on the entry node to the tree.
 		 */
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			entry_node_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 		}
@@ -241,15 +240,15 @@ namespace node{
 		/**
 		 Calls FreshEval on the entry node to the tree.
 		 */
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return entry_node_->Eval<mpfr>(diff_variable);
+			return entry_node_->EvalRef<mpfr>(diff_variable);
 		}
 		
 		/**
 		 Calls FreshEval in place on the entry node to the tree.
 		 */
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			entry_node_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 		}
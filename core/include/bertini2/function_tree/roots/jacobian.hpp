@@ -80,7 +80,7 @@ namespace node{
 				 the Jacobian is reevaluated.
 				 */
 				template<typename T>
-				T Eval(std::shared_ptr<Variable> const& diff_variable = nullptr) const = delete;
+				T Eval(VariableId diff_variable = NoVariable) const = delete;
 				
 				
 				// Evaluate the node.  If flag false, just return value, if flag true
@@ -88,15 +88,16 @@ namespace node{
 				template<typename T>
 				T EvalJ(std::shared_ptr<Variable> const& diff_variable) const
 				{
-						auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+						const VariableId id = diff_variable ? diff_variable->Id() : NoVariable;
+						auto& val_pair = current_value_.Get<T>();
 
-						if(diff_variable == current_diff_variable_ && val_pair.second)
+						if(id == current_diff_variable_ && val_pair.second)
 							return val_pair.first;
 						else
 						{
-							current_diff_variable_ = diff_variable;
+							current_diff_variable_ = id;
 							Reset();
-							detail::FreshEvalSelector<T>::RunInPlace(val_pair.first, *this, diff_variable);
+							detail::FreshEvalSelector<T>::RunInPlace(val_pair.first, *this, id);
 							val_pair.second = true;
 							return val_pair.first;
 						}						
@@ -109,21 +110,69 @@ namespace node{
 				template<typename T>
 				void EvalJInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable) const
 				{
-						auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+						const VariableId id = diff_variable ? diff_variable->Id() : NoVariable;
+						auto& val_pair = current_value_.Get<T>();
 
-						if(diff_variable == current_diff_variable_ && val_pair.second)
+						if(id == current_diff_variable_ && val_pair.second)
 							eval_value = val_pair.first;
 						else
 						{
-							current_diff_variable_ = diff_variable;
+							current_diff_variable_ = id;
 							Reset();
-							detail::FreshEvalSelector<T>::RunInPlace(val_pair.first,*this,diff_variable);
+							detail::FreshEvalSelector<T>::RunInPlace(val_pair.first,*this,id);
 							val_pair.second = true;
 							eval_value = val_pair.first;
 						}						
 				}
 
 
+				/**
+				 \brief Evaluate with respect to a variable, by id, at the point at which the Jacobian was last evaluated.
+
+				 With the nodes involving differentials set by DifferentialNodes, moving from one variable to another evaluates only those again, and the Jacobian is then evaluated column by column at the cost of its derivative parts, the values of the functions in it being kept.  Without them, or if the Jacobian has been reset since, as EvalJInPlace.
+
+				 \param eval_value Set to the value.
+				 \param diff_variable The Variable::Id of the variable.
+				 */
+				template<typename T>
+				void EvalJColumnInPlace(T& eval_value, VariableId diff_variable) const
+				{
+						auto& val_pair = current_value_.Get<T>();
+
+						if(diff_variable == current_diff_variable_ && val_pair.second)
+						{
+							eval_value = val_pair.first;
+							return;
+						}
+
+						if (val_pair.second && !differential_nodes_.empty())
+						{
+							for (auto const& iter : differential_nodes_)
+								iter->ResetStoredValues();
+							Node::ResetStoredValues();
+						}
+						else
+							Reset();
+
+						current_diff_variable_ = diff_variable;
+						detail::FreshEvalSelector<T>::RunInPlace(val_pair.first,*this,diff_variable);
+						val_pair.second = true;
+						eval_value = val_pair.first;
+				}
+
+
+				/**
+				 \brief Set the nodes of the Jacobian involving differentials, as from MarkDifferentialDependence, for EvalJColumnInPlace.
+				 */
+				void DifferentialNodes(std::vector<std::shared_ptr<Node> > const& nodes) const
+				{
+					differential_nodes_.clear();
+					for (auto const& iter : nodes)
+						if (iter.get() != this)
+							differential_nodes_.push_back(iter.get());
+				}
+
+
 				/**
 				 The function which flips the fresh eval bit back to fresh.
 				 */
@@ -139,13 +188,15 @@ namespace node{
 				virtual ~Jacobian() = default;
 				
 	
-				mutable std::shared_ptr<Variable> current_diff_variable_;
+				mutable VariableId current_diff_variable_ = NoVariable;
 				Jacobian() = default;
 		private:
 				/**
 				 The default constructor
 				 */
 				
+				mutable std::vector<Node const*> differential_nodes_; ///< The nodes of the tree involving differentials, but the root, for EvalJColumnInPlace.  Not serialized.
+
 				friend class boost::serialization::access;
 		
 				template <typename Archive>
@@ -0,0 +1,63 @@
+//This file is part of Bertini 2.
+//
+//simplify.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//simplify.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with simplify.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file simplify.hpp
+
+\brief Provides algebraic simplification of function trees.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_SIMPLIFY_HPP
+#define BERTINI_FUNCTION_TREE_SIMPLIFY_HPP
+
+#include "bertini2/function_tree.hpp"
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief Algebraically simplify a tree.
+
+	The simplifications made are
+
+	* nested sums and products are flattened into their parent,
+	* negations are absorbed into the signs of sums and the constant factor of products,
+	* Integer and Rational constants are folded exactly, using their mpq_rational values,
+	* terms which are zero, and factors which are one, are removed,
+	* products with a zero factor become zero,
+	* integer powers of 0 and 1 are removed, and nested integer powers are combined,
+	* powers with an exact integer exponent become integer powers.
+
+	Float and special numbers are never folded, since their values are not exact.  Function nodes are kept, with their entry nodes simplified in place, so that subfunctions remain shared.  Other operators are simplified in place, while sums and products are rebuilt.
+
+	\param n The root of the tree to simplify.
+	\return The root of the simplified tree, which has the same value as the original.  May be `n` itself.
+	*/
+	std::shared_ptr<Node> Simplify(std::shared_ptr<Node> const& n);
+
+} // re: namespace node
+} // re: namespace bertini
+
+
+#endif
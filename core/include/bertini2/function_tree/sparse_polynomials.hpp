@@ -0,0 +1,343 @@
+//This file is part of Bertini 2.
+//
+//sparse_polynomials.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//sparse_polynomials.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with sparse_polynomials.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file sparse_polynomials.hpp
+
+\brief Provides SparsePolynomials, the expansion of polynomial function trees into tables of monomials.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_SPARSE_POLYNOMIALS_HPP
+#define BERTINI_FUNCTION_TREE_SPARSE_POLYNOMIALS_HPP
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "bertini2/function_tree.hpp"
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief Polynomial function trees, expanded into sparse tables of monomials in a fixed list of variables.
+
+	Each term is a coefficient and a list of (variable, exponent) pairs.  Evaluation first fills a table of the powers of each variable, up to the highest degree in which it appears, which all the terms of all the functions share.  Each term is then a product of entries of the table.  The partial derivatives come from the same pass, without differentiating any tree: the derivative of a term with respect to one of its variables is the product of the others, times the derivative of its power, and prefix and suffix products over the term's factors give all of these in linear time.
+
+	Function trees made of sums, products, integer powers, negation, and division by constants, of the variables and numbers, can be expanded.  Any other node, or a variable not in the list, makes AddOutput throw, and the expansion should not be used.
+
+	\code
+	SparsePolynomials p;
+	p.SetInputs({x, y, t});
+	p.AddOutput(f);
+	p.EvalWithDerivatives<dbl>();
+	dbl df_dy = p.Derivative<dbl>(0, 1);
+	\endcode
+	*/
+	class SparsePolynomials
+	{
+	public:
+
+		/**
+		\brief The most terms an expansion may have, in any function or intermediate result.  Beyond this, expanding costs more than walking the tree saves.
+		*/
+		static constexpr size_t MaxTerms = 20000;
+
+		/**
+		\brief Forget all functions and variables.
+		*/
+		void Clear();
+
+		/**
+		\brief Set the variables the functions are polynomials in, in order.  Must be done before adding functions.
+
+		The values of the variables are read from the nodes at each evaluation.
+		*/
+		void SetInputs(std::vector<std::shared_ptr<Variable> > const& inputs);
+
+		/**
+		\brief Expand a function into monomials, and add it as the next output.
+
+		\throws std::runtime_error, if the function is not a polynomial in the inputs, or it or any product formed in expanding it has more than MaxTerms terms.
+		\return The index of the output.
+		*/
+		unsigned AddOutput(std::shared_ptr<Node> const& f);
+
+		/**
+		\brief Homogenize the expanded functions, without expanding them again, by multiplying each term by the power of the homogenizing variable of each group making up the term's deficiency in the group's degree.
+
+		The degree of each function in each group, with its homogenizing variable, is taken from the function's tree, so this must be done before the trees themselves are homogenized, if they are to be.  The powers of the homogenizing variables are entries in the same table as the powers of all the inputs, so cost a multiplication per term and group.  Homogenizing again replaces the grouping, from the terms as expanded, so trying other groupings costs no expansion.  The homogenization is kept across changes of precision.
+
+		\param inputs The inputs from now on, in order.  Must include the current inputs, and the homogenizing variables.
+		\param groups The variable groups.
+		\param homogenizing The homogenizing variable of each group.  May already appear in the functions, in which case it counts towards the degree.
+
+		\throws std::runtime_error, if an input is missing from the new inputs, or a function is not a polynomial in a group.
+		*/
+		void Homogenize(std::vector<std::shared_ptr<Variable> > const& inputs, std::vector<VariableGroup> const& groups, VariableGroup const& homogenizing);
+
+		/**
+		\brief Change the precision of the multiple precision coefficients and workspaces.
+
+		The coefficients are kept as expanded, at the highest precision the functions have been expanded at, and a change of precision rounds them from those, without expanding again.  Only a raise above that precision expands the functions again, so the coefficients carry all the digits asked for.  The nodes of the functions are not changed, neither here nor in expanding.
+		*/
+		void precision(unsigned new_precision);
+
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+		size_t NumOutputs() const
+		{
+			return outputs_.size();
+		}
+
+		size_t NumInputs() const
+		{
+			return inputs_.size();
+		}
+
+		size_t NumTerms() const
+		{
+			return terms_.size();
+		}
+
+
+		/**
+		\brief Evaluate all outputs at the current values of the inputs.
+
+		\tparam T The number type for evaluation.  dbl or mpfr.
+		*/
+		template<typename T>
+		void Eval() const
+		{
+			ComputePowers<T>();
+
+			auto& values = std::get<std::vector<T> >(values_);
+			const auto& coefficients = std::get<std::vector<T> >(coefficients_);
+			const auto& powers = std::get<std::vector<T> >(powers_);
+			auto& term_value = std::get<std::vector<T> >(scratch_)[0];
+
+			for (auto& v : values)
+				v = T(0);
+
+			for (size_t ii = 0; ii < terms_.size(); ++ii)
+			{
+				const auto& term = terms_[ii];
+				term_value = coefficients[ii];
+				for (unsigned jj = term.first_factor; jj < term.first_factor+term.num_factors; ++jj)
+					term_value *= powers[power_offsets_[factors_[jj].input] + factors_[jj].exponent];
+				values[term.output] += term_value;
+			}
+		}
+
+		/**
+		\brief Evaluate all outputs, and their partial derivatives with respect to all inputs, at the current values of the inputs.
+
+		\tparam T The number type for evaluation.  dbl or mpfr.
+		*/
+		template<typename T>
+		void EvalWithDerivatives() const
+		{
+			ComputePowers<T>();
+
+			auto& values = std::get<std::vector<T> >(values_);
+			auto& derivatives = std::get<std::vector<T> >(derivatives_);
+			const auto& coefficients = std::get<std::vector<T> >(coefficients_);
+			const auto& powers = std::get<std::vector<T> >(powers_);
+			auto& scratch = std::get<std::vector<T> >(scratch_);
+
+			for (auto& v : values)
+				v = T(0);
+			for (auto& d : derivatives)
+				d = T(0);
+
+			// scratch holds the suffix product, a partial derivative, then the prefix products
+			auto& suffix = scratch[0];
+			auto& partial = scratch[1];
+			auto prefix = scratch.begin()+2;
+
+			for (size_t ii = 0; ii < terms_.size(); ++ii)
+			{
+				const auto& term = terms_[ii];
+				const auto* factors = factors_.data() + term.first_factor;
+
+				prefix[0] = coefficients[ii];
+				for (unsigned jj = 0; jj < term.num_factors; ++jj)
+				{
+					prefix[jj+1] = prefix[jj];
+					prefix[jj+1] *= powers[power_offsets_[factors[jj].input] + factors[jj].exponent];
+				}
+				values[term.output] += prefix[term.num_factors];
+
+				suffix = T(1);
+				for (unsigned jj = term.num_factors; jj-- > 0; )
+				{
+					const auto& f = factors[jj];
+					const auto offset = power_offsets_[f.input];
+
+					partial = prefix[jj];
+					partial *= suffix;
+					partial *= powers[offset + f.exponent - 1];
+					partial *= static_cast<int>(f.exponent);
+					derivatives[term.output*inputs_.size() + f.input] += partial;
+
+					suffix *= powers[offset + f.exponent];
+				}
+			}
+		}
+
+		/**
+		\brief The value of an output, from the most recent evaluation.
+		*/
+		template<typename T>
+		T const& Output(unsigned output) const
+		{
+			return std::get<std::vector<T> >(values_)[output];
+		}
+
+		/**
+		\brief The partial derivative of an output with respect to an input, from the most recent EvalWithDerivatives.
+		*/
+		template<typename T>
+		T const& Derivative(unsigned output, unsigned input) const
+		{
+			return std::get<std::vector<T> >(derivatives_)[output*inputs_.size() + input];
+		}
+
+		/**
+		\brief The exponents of the terms of an output, each with an entry for each input.  These are the support of the polynomial, its Newton polytope's points.
+		*/
+		std::vector< std::vector<unsigned> > Exponents(unsigned output) const
+		{
+			std::vector< std::vector<unsigned> > exponents;
+			for (const auto& term : terms_)
+				if (term.output==output)
+				{
+					exponents.emplace_back(inputs_.size(), 0);
+					for (unsigned jj = term.first_factor; jj < term.first_factor+term.num_factors; ++jj)
+						exponents.back()[factors_[jj].input] = factors_[jj].exponent;
+				}
+			return exponents;
+		}
+
+		/**
+		\brief An estimate of the bytes held by the expanded polynomials, their coefficients, and their evaluation workspaces.  The functions they were expanded from are not included.
+		*/
+		size_t MemoryBytes() const;
+
+	private:
+
+		/**
+		\brief Fill the table of powers of each input, from the current values of the inputs.
+		*/
+		template<typename T>
+		void ComputePowers() const
+		{
+			auto& powers = std::get<std::vector<T> >(powers_);
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+			{
+				auto offset = power_offsets_[ii];
+				powers[offset] = T(1);
+				if (max_degrees_[ii]==0)
+					continue;
+
+				powers[offset+1] = inputs_[ii]->current_value<T>();
+				for (unsigned jj = 2; jj <= max_degrees_[ii]; ++jj)
+				{
+					powers[offset+jj] = powers[offset+jj-1];
+					powers[offset+jj] *= powers[offset+1];
+				}
+			}
+		}
+
+		/**
+		\brief Expand all the functions into the tables, at the current precision.
+		*/
+		void Build();
+
+		/**
+		\brief Append the terms of an expanded function, by monomial, to the tables.
+		*/
+		void AppendTerms(std::map<std::vector<unsigned>, mpfr> const& p, unsigned output);
+
+		/**
+		\brief Lay out the factors of the terms again, the expanded ones of each followed by the powers of the homogenizing variables, and size the workspaces.
+		*/
+		void ApplyHomogenization();
+
+		/**
+		\brief Size the workspaces to the tables, setting the precision of the multiple precision ones.
+		*/
+		void ResizeWorkspaces();
+
+
+		struct Term
+		{
+			unsigned output; ///< The function this term belongs to.
+			unsigned first_factor; ///< The index in factors_ of the first of this term's factors.
+			unsigned num_factors;
+			unsigned num_expanded_factors; ///< The first of the factors, which came from the expansion.  The rest are powers of homogenizing variables.
+		};
+
+		struct Factor
+		{
+			unsigned input; ///< The index of the variable.
+			unsigned exponent; ///< Positive.
+		};
+
+		struct Homogenization
+		{
+			unsigned input; ///< The index of the homogenizing variable.
+			std::vector<bool> in_group; ///< For each input, whether it is in the group, the homogenizing variable included.
+			std::vector<int> degrees; ///< The degree of each output in the group.
+		};
+
+		std::vector<std::shared_ptr<Variable> > inputs_;
+		std::vector<std::shared_ptr<Node> > outputs_; ///< The functions, kept for expanding again at a change of precision.
+
+		std::vector<Term> terms_; ///< Ordered by output.
+		std::vector<Factor> factors_;
+		std::tuple< std::vector<dbl>, std::vector<mpfr> > coefficients_; ///< One for each term.
+		std::vector<mpfr> expanded_coefficients_; ///< The coefficients as expanded, at expansion_precision_, rounded into coefficients_ at a change of precision.
+		unsigned expansion_precision_ = 0; ///< The precision the functions were expanded at.  At least precision_.
+
+		std::vector<unsigned> max_degrees_; ///< The highest power of each input appearing in any term.
+		std::vector<unsigned> power_offsets_; ///< The index in the power tables of the 0th power of each input.
+		unsigned max_factors_ = 0; ///< The most factors of any term.
+		std::vector<Homogenization> homogenizations_; ///< One for each variable group, if homogenized.
+
+		unsigned precision_ = DefaultPrecision();
+
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > powers_;
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > values_;
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > derivatives_; ///< Row-major, outputs by inputs.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > scratch_;
+	};
+
+} // re: namespace node
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,973 @@
+//This file is part of Bertini 2.
+//
+//straight_line_program.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_program.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_program.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file straight_line_program.hpp
+
+\brief Provides the StraightLineProgram, a flattened form of one or more function trees.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_STRAIGHT_LINE_PROGRAM_HPP
+#define BERTINI_FUNCTION_TREE_STRAIGHT_LINE_PROGRAM_HPP
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/symbols/differential.hpp"
+#include "bertini2/function_tree/taylor_series.hpp"
+#include "bertini2/ball_arithmetic.hpp"
+#include "bertini2/detail/thread_team.hpp"
+
+namespace bertini {
+namespace node{
+
+	class NativeProgram;
+
+	/**
+	\brief A function tree, lowered into a topologically ordered list of instructions acting on a register file.
+
+	Evaluating a function tree walks `std::shared_ptr<Node>`s, making a virtual call and checking a cache flag at every node.  A StraightLineProgram instead visits each distinct node of one or more trees exactly once, at construction time, and records an opcode for it.  Evaluation is then a single loop over a contiguous array of instructions, reading and writing a contiguous array of registers of type dbl or mpfr.
+
+	Nodes which are shared between trees (or which appear more than once within a tree, such as subfunctions) are lowered to a single register, so are computed exactly once per evaluation.
+
+	Variable nodes are the inputs, and are read directly from the Variable nodes at the start of each evaluation.  Number nodes, and the special numbers, are read once, and re-read at change of precision.
+
+	\code
+	StraightLineProgram slp;
+	auto index = slp.AddOutput(f);
+	x->set_current_value(dbl(1,2));
+	slp.Eval<dbl>();
+	dbl value = slp.Output<dbl>(index);
+	\endcode
+	*/
+	class StraightLineProgram
+	{
+	public:
+
+		/**
+		\brief The operations a StraightLineProgram can perform.
+		*/
+		enum class OpCode : unsigned char
+		{
+			Add,
+			Subtract,
+			Multiply,
+			Divide,
+			Negate,
+			IntegerPower,
+			Power,
+			Sqrt,
+			Exp,
+			Log,
+			Sin,
+			Cos,
+			Tan,
+			ArcSin,
+			ArcCos,
+			ArcTan
+		};
+
+		/**
+		\brief A single step of a StraightLineProgram.
+
+		Computes `registers[result] = op(registers[lhs], registers[rhs])`.  Unary operations ignore rhs, and IntegerPower uses exponent in place of rhs.
+		*/
+		struct Instruction
+		{
+			OpCode op;
+			unsigned result;
+			unsigned lhs;
+			unsigned rhs;
+			int exponent;
+		};
+
+
+		/**
+		\brief The mutable state of an evaluation of a StraightLineProgram: its register file, and the adjoints of the registers.
+
+		A program holds one Workspace of its own, used by the overloads of Eval and ReverseSweep without a Workspace argument.  Since evaluation into a separate Workspace does not modify the program, one program can be evaluated from several threads at once, each with its own Workspace, see MakeWorkspace.
+		*/
+		class Workspace
+		{
+		public:
+
+			/**
+			\brief Get a register, for reading an output or writing an input.
+			*/
+			template<typename T>
+			T& Register(unsigned reg)
+			{
+				return std::get<std::vector<T> >(registers_)[reg];
+			}
+
+			template<typename T>
+			T const& Register(unsigned reg) const
+			{
+				return std::get<std::vector<T> >(registers_)[reg];
+			}
+
+			/**
+			\brief Get the adjoint of a register, as computed by the most recent ReverseSweep into this Workspace.
+			*/
+			template<typename T>
+			T const& Adjoint(unsigned reg) const
+			{
+				return std::get<std::vector<T> >(adjoints_)[reg];
+			}
+
+			size_t NumRegisters() const
+			{
+				return std::get<std::vector<dbl> >(registers_).size();
+			}
+
+		private:
+			friend class StraightLineProgram;
+
+			std::tuple< std::vector<dbl>, std::vector<mpfr> > registers_; ///< The register file.
+			std::tuple< std::vector<dbl>, std::vector<mpfr> > adjoints_; ///< Derivatives of a single output with respect to each register, computed by ReverseSweep.
+		};
+
+
+		StraightLineProgram() : precision_(DefaultPrecision())
+		{}
+
+		/**
+		\brief Lower a tree into the program, and mark its value as an output.
+
+		Nodes already lowered into this program, including from previous calls to this function, are not duplicated.
+
+		\throws std::runtime_error, if the tree contains a node type which cannot be lowered.
+		\return The index of the output, for use with Output().
+		\param root The root of the tree to lower.
+		*/
+		size_t AddOutput(std::shared_ptr<Node> const& root);
+
+		/**
+		\brief Remove everything from the program.
+		*/
+		void Clear();
+
+		/**
+		\brief Evaluate the program, using the current values of the variable nodes.
+
+		\tparam T The number type for evaluation.  dbl or mpfr.
+		*/
+		template<typename T>
+		void Eval() const
+		{
+			ReadInputs<T>(workspace_);
+			Eval<T>(workspace_);
+		}
+
+		/**
+		\brief Copy the current values of the variable nodes into the input registers of a Workspace.
+		*/
+		template<typename T>
+		void ReadInputs(Workspace & w) const
+		{
+			auto& r = std::get<std::vector<T> >(w.registers_);
+			for (const auto& iter : inputs_)
+				r[iter.second] = iter.first->current_value<T>();
+		}
+
+		/**
+		\brief Evaluate the program into a Workspace, using the values already in its input registers.
+
+		Modifies only the Workspace, so is safe to call concurrently with distinct Workspaces.
+
+		\tparam T The number type for evaluation.  dbl or mpfr.
+		\param w The Workspace, as made by MakeWorkspace, with its inputs set.
+		*/
+		template<typename T>
+		void Eval(Workspace & w) const
+		{
+			auto& r = std::get<std::vector<T> >(w.registers_);
+
+			if (EvalNative(r))
+				return;
+
+			for (const auto& i : instructions_)
+				Execute(i, r);
+		}
+
+		/**
+		\brief Compute the derivatives of one output with respect to every register, by a single reverse (adjoint) sweep over the program.
+
+		Must be preceded by a call to Eval of the same number type at the same point, because the sweep uses the stored register values.  After this call, Adjoint(r) is the partial derivative of the output with respect to the value in register r.  In particular, the derivatives with respect to the variables are the adjoints of their registers, see RegisterOf.
+
+		The cost of this is a small multiple of the cost of evaluation, independent of the number of variables.
+
+		\tparam T The number type.  Must match that used in the call to Eval.
+		\param index The index of the output, as returned by AddOutput.
+		*/
+		template<typename T>
+		void ReverseSweep(size_t index) const
+		{
+			ReverseSweep<T>(index, workspace_);
+		}
+
+		/**
+		\brief Compute the derivatives of one output with respect to every register, into a Workspace.
+
+		Must be preceded by a call to Eval of the same number type into the same Workspace.  Modifies only the Workspace.
+		*/
+		template<typename T>
+		void ReverseSweep(size_t index, Workspace & w) const
+		{
+			Sweep(index, std::get<std::vector<T> >(w.registers_), std::get<std::vector<T> >(w.adjoints_));
+		}
+
+		/**
+		\brief Evaluate the program into its own Workspace, split over the threads of a team, using the current values of the variable nodes.
+
+		The instructions on which several outputs depend, such as subfunctions, are computed first, level by level in their dependencies, each level split over the threads if it is wide enough to be worth it.  The instructions on which only one output depends are then computed with that output, the outputs being shared out among the threads to balance their numbers of instructions.  The results are the same as those of Eval<T>(), but a program with many outputs is evaluated in a fraction of the time.
+
+		Double precision with a native program is evaluated serially, through the native code.
+
+		\tparam T The number type for evaluation.  dbl or mpfr.
+		\param team The threads to evaluate with, see SetEvaluationTeam of System.
+		*/
+		template<typename T>
+		void Eval(detail::ThreadTeam & team) const
+		{
+			ReadInputs<T>(workspace_);
+			auto& r = std::get<std::vector<T> >(workspace_.registers_);
+
+			if (team.NumThreads()==1 || EvalNative(r))
+			{
+				if (team.NumThreads()==1)
+					Eval<T>(workspace_);
+				return;
+			}
+
+			const auto& plan = ParallelPlanFor(team.NumThreads());
+			const auto precision = DefaultPrecision();
+			team.Run([&](unsigned thread)
+				{
+					DefaultPrecision(precision);
+					for (const auto& stage : plan.stages)
+					{
+						if (stage.parallel)
+						{
+							const auto n = stage.instructions.size(), chunk = (n + team.NumThreads() - 1) / team.NumThreads();
+							for (auto ii = std::min(n, thread*chunk); ii < std::min(n, (thread+1)*chunk); ++ii)
+								Execute(instructions_[stage.instructions[ii]], r);
+						}
+						else if (thread==0)
+							for (auto ii : stage.instructions)
+								Execute(instructions_[ii], r);
+						team.Sync();
+					}
+					for (auto ii : plan.exclusive[thread])
+						Execute(instructions_[ii], r);
+				});
+		}
+
+		/**
+		\brief Compute the derivatives of every output with respect to every register, one output at a time, handing each to a function.
+
+		Must be preceded by a call to Eval of the same number type.  Afterward, the program's own adjoints are those of the last output.
+
+		\param row Called as row(index, adjoints) for each output index in turn, adjoints being the derivatives of that output with respect to each register.
+		*/
+		template<typename T, typename RowF>
+		void ReverseSweeps(RowF const& row) const
+		{
+			for (size_t ii = 0; ii < outputs_.size(); ++ii)
+			{
+				ReverseSweep<T>(ii);
+				row(ii, std::get<std::vector<T> >(workspace_.adjoints_));
+			}
+		}
+
+		/**
+		\brief Compute the derivatives of every output with respect to every register, the outputs being shared out among the threads of a team, handing each to a function.
+
+		Must be preceded by a call to Eval of the same number type.  Each thread sweeps into adjoints of its own, so the program's own adjoints are not changed.
+
+		\param team The threads to sweep with.
+		\param row Called as row(index, adjoints) once for each output, from the thread which swept it, so must be safe to call concurrently for distinct outputs, such as by writing row index of a matrix.
+		*/
+		template<typename T, typename RowF>
+		void ReverseSweeps(detail::ThreadTeam & team, RowF const& row) const
+		{
+			if (team.NumThreads()==1)
+			{
+				ReverseSweeps<T>(row);
+				return;
+			}
+
+			const auto& r = std::get<std::vector<T> >(workspace_.registers_);
+			if (thread_adjoints_.size() < team.NumThreads())
+				thread_adjoints_.resize(team.NumThreads());
+
+			const auto precision = DefaultPrecision();
+			std::atomic<size_t> next(0);
+			team.Run([&](unsigned thread)
+				{
+					DefaultPrecision(precision);
+					auto& a = std::get<std::vector<T> >(thread_adjoints_[thread]);
+					if (a.size()!=num_registers_)
+					{
+						a.resize(num_registers_);
+						for (auto& iter : a)
+							MakeZero(iter);
+					}
+					for (size_t ii; (ii = next.fetch_add(1, std::memory_order_relaxed)) < outputs_.size(); )
+					{
+						Sweep(ii, r, a);
+						row(ii, a);
+					}
+				});
+		}
+
+		/**
+		\brief Compute the derivatives of a weighted sum of the outputs with respect to every register, by a single reverse sweep over the program.
+
+		Must be preceded by a call to Eval of the same number type at the same point.  After this call, Adjoint(r) is \f$\sum_k w_k \partial y_k / \partial r\f$, so the adjoints of the registers of the variables are the product of the weights, as a row vector, with the Jacobian.  This costs the same as ReverseSweep of one output.
+
+		\param weights One for each output, in the order of AddOutput.
+		*/
+		template<typename T>
+		void WeightedReverseSweep(std::vector<T> const& weights) const
+		{
+			const auto& r = std::get<std::vector<T> >(workspace_.registers_);
+			auto& a = std::get<std::vector<T> >(workspace_.adjoints_);
+
+			for (auto& iter : a)
+				iter = T(0);
+			for (size_t ii = 0; ii < outputs_.size(); ++ii)
+				a[outputs_[ii]] += weights[ii];
+
+			Backpropagate(r, a, instructions_.size());
+		}
+
+		/**
+		\brief Prepare a register file of truncated Taylor series, for EvalTaylor.
+
+		Each register holds the first order+1 coefficients of its value as a series in a parameter s, register reg's coefficient k at series[reg*(order+1) + k].  The constants are loaded, as constant series, and everything else is zeroed.  Set the series of the inputs next, see RegisterOf, then call EvalTaylor.
+
+		\tparam T The number type.  dbl or mpfr.  Multiple precision series are at the program's precision.
+		*/
+		template<typename T>
+		void BeginTaylor(std::vector<T> & series, unsigned order) const
+		{
+			const auto K = order+1;
+			series.resize(num_registers_*K);
+			for (auto& iter : series)
+				MakeZero(iter);
+
+			const auto& r = std::get<std::vector<T> >(workspace_.registers_);
+			for (const auto& iter : constants_)
+				series[iter.second*K] = r[iter.second];
+		}
+
+		/**
+		\brief Evaluate the program on truncated Taylor series, in one pass.
+
+		Afterward, coefficient k of the series of an output is its k-th derivative with respect to s, divided by k!, at s=0.  Each instruction costs \f$O(order^2)\f$, so all the derivatives to order k cost about as much as \f$k^2\f$ evaluations, rather than requiring repeated differentiation.  See node::taylor.
+
+		\param series The register file, made by BeginTaylor, with the inputs set.
+		\param order The order of the series, as given to BeginTaylor.
+		*/
+		template<typename T>
+		void EvalTaylor(std::vector<T> & series, unsigned order) const
+		{
+			const auto K = order+1;
+			std::vector<T> scratch(2*K);
+			for (auto& iter : scratch)
+				MakeZero(iter);
+			T* u = scratch.data();
+			T* v = u + K;
+
+			for (const auto& i : instructions_)
+			{
+				T* c = series.data() + i.result*K;
+				T const* a = series.data() + i.lhs*K;
+				T const* b = series.data() + i.rhs*K;
+
+				switch (i.op)
+				{
+					case OpCode::Add:
+						for (unsigned k = 0; k < K; ++k) c[k] = a[k] + b[k];
+						break;
+					case OpCode::Subtract:
+						for (unsigned k = 0; k < K; ++k) c[k] = a[k] - b[k];
+						break;
+					case OpCode::Multiply:
+						taylor::Multiply(c, a, b, K); break;
+					case OpCode::Divide:
+						taylor::Divide(c, a, b, K); break;
+					case OpCode::Negate:
+						for (unsigned k = 0; k < K; ++k) c[k] = -a[k];
+						break;
+					case OpCode::IntegerPower:
+						taylor::IntegerPower(c, a, i.exponent, K, u); break;
+					case OpCode::Power:
+						taylor::Power(c, a, b, K, u, v); break;
+					case OpCode::Sqrt:
+						taylor::Sqrt(c, a, K); break;
+					case OpCode::Exp:
+						taylor::Exp(c, a, K); break;
+					case OpCode::Log:
+						taylor::Log(c, a, K); break;
+					case OpCode::Sin:
+						taylor::SinCos(c, u, a, K); break;
+					case OpCode::Cos:
+						taylor::SinCos(u, c, a, K); break;
+					case OpCode::Tan:
+						taylor::Tan(c, a, K, u); break;
+					case OpCode::ArcSin:
+						taylor::ArcSinCos(c, a, K, false, u, v); break;
+					case OpCode::ArcCos:
+						taylor::ArcSinCos(c, a, K, true, u, v); break;
+					case OpCode::ArcTan:
+						taylor::ArcTan(c, a, K, u); break;
+				}
+			}
+		}
+
+		/**
+		\brief Prepare a register file of balls, for EvalBall.
+
+		Each register holds a ball enclosing its value, followed by balls enclosing its derivatives in num_directions directions, register reg's value at balls[reg*(num_directions+1)] and its derivative in direction j at balls[reg*(num_directions+1) + 1 + j].  The constants are loaded as points, with zero derivatives, and everything else is zeroed.  Set the balls of the inputs next, and the derivatives of the inputs with respect to the directions, see RegisterOf, then call EvalBall.
+
+		\tparam T The number type of the midpoints.  dbl or mpfr.  Multiple precision midpoints are at the program's precision.
+		*/
+		template<typename T>
+		void BeginBall(std::vector<Ball<T> > & balls, unsigned num_directions) const
+		{
+			const auto N = num_directions+1;
+			T zero;
+			MakeZero(zero);
+			balls.assign(num_registers_*N, Ball<T>(zero));
+
+			const auto& r = std::get<std::vector<T> >(workspace_.registers_);
+			for (const auto& iter : constants_)
+				balls[iter.second*N] = Ball<T>(r[iter.second]);
+		}
+
+		/**
+		\brief Evaluate the program in ball arithmetic, in forward mode.
+
+		Afterward, the ball of each output contains every value of it for inputs in the balls of the inputs, and the ball of each of its derivatives contains every value of that derivative there.  With the inputs seeded with the unit directions, these are enclosures of the function and its gradient over a box, as needed to certify a root, see tracking::Krawczyk.  With no directions, this is evaluation in ball arithmetic alone.
+
+		\param balls The register file, made by BeginBall, with the inputs set.
+		\param num_directions The number of directions, as given to BeginBall.
+		*/
+		template<typename T>
+		void EvalBall(std::vector<Ball<T> > & balls, unsigned num_directions) const
+		{
+			using B = Ball<T>;
+			const auto N = num_directions+1;
+			B one(T(1));
+
+			for (const auto& i : instructions_)
+			{
+				B* c = balls.data() + i.result*N;
+				B const* a = balls.data() + i.lhs*N;
+				B const* b = balls.data() + i.rhs*N;
+
+				// the derivative of a unary operation, times the derivatives of its argument
+				auto chain = [&](B const& derivative)
+					{
+						for (unsigned k = 1; k < N; ++k)
+							c[k] = derivative*a[k];
+					};
+
+				switch (i.op)
+				{
+					case OpCode::Add:
+						for (unsigned k = 0; k < N; ++k) c[k] = a[k] + b[k];
+						break;
+					case OpCode::Subtract:
+						for (unsigned k = 0; k < N; ++k) c[k] = a[k] - b[k];
+						break;
+					case OpCode::Multiply:
+						c[0] = a[0]*b[0];
+						for (unsigned k = 1; k < N; ++k) c[k] = a[k]*b[0] + a[0]*b[k];
+						break;
+					case OpCode::Divide:
+						c[0] = a[0]/b[0];
+						for (unsigned k = 1; k < N; ++k) c[k] = (a[k] - c[0]*b[k])/b[0];
+						break;
+					case OpCode::Negate:
+						for (unsigned k = 0; k < N; ++k) c[k] = -a[k];
+						break;
+					case OpCode::IntegerPower:
+						c[0] = pow(a[0], i.exponent);
+						if (N > 1)
+							chain(i.exponent==0 ? B(T(0)) : B(T(i.exponent))*pow(a[0], i.exponent-1));
+						break;
+					case OpCode::Power:
+						c[0] = pow(a[0], b[0]);
+						if (N > 1)
+						{
+							B log_a = log(a[0]);
+							for (unsigned k = 1; k < N; ++k) c[k] = c[0]*(b[k]*log_a + b[0]*a[k]/a[0]);
+						}
+						break;
+					case OpCode::Sqrt:
+						c[0] = sqrt(a[0]);
+						if (N > 1) chain(one/(B(T(2))*c[0]));
+						break;
+					case OpCode::Exp:
+						c[0] = exp(a[0]);
+						if (N > 1) chain(c[0]);
+						break;
+					case OpCode::Log:
+						c[0] = log(a[0]);
+						if (N > 1) chain(one/a[0]);
+						break;
+					case OpCode::Sin:
+						c[0] = sin(a[0]);
+						if (N > 1) chain(cos(a[0]));
+						break;
+					case OpCode::Cos:
+						c[0] = cos(a[0]);
+						if (N > 1) chain(-sin(a[0]));
+						break;
+					case OpCode::Tan:
+						c[0] = tan(a[0]);
+						if (N > 1) chain(one + c[0]*c[0]);
+						break;
+					case OpCode::ArcSin:
+						c[0] = asin(a[0]);
+						if (N > 1) chain(one/sqrt(one - a[0]*a[0]));
+						break;
+					case OpCode::ArcCos:
+						c[0] = acos(a[0]);
+						if (N > 1) chain(-one/sqrt(one - a[0]*a[0]));
+						break;
+					case OpCode::ArcTan:
+						c[0] = atan(a[0]);
+						if (N > 1) chain(one/(one + a[0]*a[0]));
+						break;
+				}
+			}
+		}
+
+		/**
+		\brief Get the adjoint of a register, as computed by the most recent call to ReverseSweep.
+
+		\tparam T The number type.  Must match that used in the call to ReverseSweep.
+		\param reg The register, as returned by RegisterOf.
+		*/
+		template<typename T>
+		T const& Adjoint(unsigned reg) const
+		{
+			return workspace_.Adjoint<T>(reg);
+		}
+
+		/**
+		\brief Get the register holding the value of a node, or -1 if the node does not appear in the program.
+
+		Used to find the registers of variables, for reading derivatives after ReverseSweep.
+		*/
+		int RegisterOf(std::shared_ptr<Node> const& n) const
+		{
+			auto found = lowered_.find(n.get());
+			if (found==lowered_.end())
+				return -1;
+			return found->second;
+		}
+
+		/**
+		\brief Get the value of an output, as computed by the most recent call to Eval.
+
+		\tparam T The number type.  Must match that used in the call to Eval.
+		\param index The index of the output, as returned by AddOutput.
+		*/
+		template<typename T>
+		T const& Output(size_t index) const
+		{
+			return workspace_.Register<T>(outputs_[index]);
+		}
+
+		/**
+		\brief Get the value of an output, as computed by the most recent call to Eval into a Workspace.
+		*/
+		template<typename T>
+		T const& Output(size_t index, Workspace const& w) const
+		{
+			return w.Register<T>(outputs_[index]);
+		}
+
+		/**
+		\brief Make a Workspace for evaluation of this program, independent of the program's own.
+
+		The constants are loaded at the current precision of the program, and the inputs with the current values of the variable nodes.  A Workspace must be made again after the program is changed, or its precision is.  Making a Workspace is not itself thread-safe.
+		*/
+		Workspace MakeWorkspace() const;
+
+		/**
+		\brief Prepare to evaluate the program at many points at once, in double precision.
+
+		Every input is set to the current value of its Variable node at every point, and every constant is broadcast to every point.  Follow with calls to SetBatchInput for the inputs which vary from point to point, then EvalBatch.
+
+		The batch registers are stored as structure-of-arrays: the real parts of a register at all points are contiguous, as are the imaginary parts.  Each instruction is then a loop over plain doubles, which the compiler can vectorize.
+
+		\param num_points The number of points in the batch.
+		*/
+		void BeginBatch(size_t num_points) const;
+
+		/**
+		\brief Set the value of an input register at one point of the batch.
+
+		\param reg The register of the input, as returned by RegisterOf.
+		\param point The index of the point in the batch.
+		\param value The value to set.
+		*/
+		void SetBatchInput(unsigned reg, size_t point, dbl const& value) const
+		{
+			batch_real_[reg*batch_size_ + point] = value.real();
+			batch_imag_[reg*batch_size_ + point] = value.imag();
+		}
+
+		/**
+		\brief Evaluate the program at every point of the batch.
+
+		Must be preceded by BeginBatch.
+		*/
+		void EvalBatch() const;
+
+		/**
+		\brief Compute the derivatives of one output with respect to every register, at every point of the batch.
+
+		The batched analogue of ReverseSweep.  Must be preceded by a call to EvalBatch, whose register values are used.
+
+		\param index The index of the output, as returned by AddOutput.
+		*/
+		void ReverseSweepBatch(size_t index) const;
+
+		/**
+		\brief Get the value of an output at one point of the batch, as computed by the most recent call to EvalBatch.
+		*/
+		dbl BatchOutput(size_t index, size_t point) const
+		{
+			auto reg = outputs_[index];
+			return dbl(batch_real_[reg*batch_size_ + point], batch_imag_[reg*batch_size_ + point]);
+		}
+
+		/**
+		\brief Get the adjoint of a register at one point of the batch, as computed by the most recent call to ReverseSweepBatch.
+		*/
+		dbl BatchAdjoint(unsigned reg, size_t point) const
+		{
+			return dbl(batch_adjoint_real_[reg*batch_size_ + point], batch_adjoint_imag_[reg*batch_size_ + point]);
+		}
+
+		/**
+		\brief Get the number of points in the current batch.
+		*/
+		size_t BatchSize() const
+		{
+			return batch_size_;
+		}
+
+		/**
+		\brief Change the precision of the multiple precision registers, and re-read the constants at the new precision.
+
+		The registers at each precision used are kept, constants loaded, so returning to a precision swaps them back in without reading the constants again.
+		*/
+		void precision(unsigned new_precision) const;
+
+		/**
+		\brief Get the current precision of the multiple precision registers.
+		*/
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+		size_t NumOutputs() const
+		{
+			return outputs_.size();
+		}
+
+		size_t NumInstructions() const
+		{
+			return instructions_.size();
+		}
+
+		size_t NumRegisters() const
+		{
+			return num_registers_;
+		}
+
+		std::vector<Instruction> const& Instructions() const
+		{
+			return instructions_;
+		}
+
+		/**
+		\brief The registers holding the outputs, by index of output.
+		*/
+		std::vector<unsigned> const& OutputRegisters() const
+		{
+			return outputs_;
+		}
+
+		/**
+		\brief For each output, the number of leading instructions on which it can depend.
+		*/
+		std::vector<size_t> const& OutputExtents() const
+		{
+			return output_extents_;
+		}
+
+		/**
+		\brief Evaluate and sweep in double precision through native code compiled from this program, rather than interpreting the instructions.
+
+		The native program must have been built from this program as it is now.  It is dropped when the program is changed.  Multiple precision evaluation, and batches, still interpret.
+
+		\param native The native program, or null to go back to interpreting.
+		*/
+		void SetNative(std::shared_ptr<NativeProgram const> native)
+		{
+			native_ = native;
+		}
+
+		bool HasNative() const
+		{
+			return static_cast<bool>(native_);
+		}
+
+		/**
+		\brief An estimate of the bytes held by the program: its instructions, and its own workspace, batch registers, and registers kept at other precisions.  The nodes it refers to are not included.
+		*/
+		size_t MemoryBytes() const;
+
+	private:
+
+		// perform one instruction on the registers r
+		template<typename T>
+		static void Execute(Instruction const& i, std::vector<T> & r)
+		{
+			switch (i.op)
+			{
+				case OpCode::Add:
+					r[i.result] = r[i.lhs] + r[i.rhs]; break;
+				case OpCode::Subtract:
+					r[i.result] = r[i.lhs] - r[i.rhs]; break;
+				case OpCode::Multiply:
+					r[i.result] = r[i.lhs] * r[i.rhs]; break;
+				case OpCode::Divide:
+					r[i.result] = r[i.lhs] / r[i.rhs]; break;
+				case OpCode::Negate:
+					r[i.result] = -r[i.lhs]; break;
+				case OpCode::IntegerPower:
+					r[i.result] = pow(r[i.lhs], i.exponent); break;
+				case OpCode::Power:
+					r[i.result] = pow(r[i.lhs], r[i.rhs]); break;
+				case OpCode::Sqrt:
+					r[i.result] = sqrt(r[i.lhs]); break;
+				case OpCode::Exp:
+					r[i.result] = exp(r[i.lhs]); break;
+				case OpCode::Log:
+					r[i.result] = log(r[i.lhs]); break;
+				case OpCode::Sin:
+					r[i.result] = sin(r[i.lhs]); break;
+				case OpCode::Cos:
+					r[i.result] = cos(r[i.lhs]); break;
+				case OpCode::Tan:
+					r[i.result] = tan(r[i.lhs]); break;
+				case OpCode::ArcSin:
+					r[i.result] = asin(r[i.lhs]); break;
+				case OpCode::ArcCos:
+					r[i.result] = acos(r[i.lhs]); break;
+				case OpCode::ArcTan:
+					r[i.result] = atan(r[i.lhs]); break;
+			}
+		}
+
+		// the adjoints of one output with respect to every register into a, given the register values r
+		template<typename T>
+		void Sweep(size_t index, std::vector<T> const& r, std::vector<T> & a) const
+		{
+			if (ReverseSweepNative(index, r, a))
+				return;
+
+			for (auto& iter : a)
+				iter = T(0);
+			a[outputs_[index]] = T(1);
+
+			Backpropagate(r, a, output_extents_[index]);
+		}
+
+		/**
+		\brief How the instructions are shared out among the threads of a team by Eval.
+		*/
+		struct ParallelPlan
+		{
+			struct Stage
+			{
+				std::vector<size_t> instructions; ///< Independent of each other, if parallel.
+				bool parallel; ///< Whether the instructions are split over the threads, rather than all done by the first.
+			};
+
+			unsigned num_threads = 0; ///< The size of team this is for.  0 if not yet made.
+			std::vector<Stage> stages; ///< The instructions on which more than one output depends, in order of dependency.
+			std::vector<std::vector<size_t> > exclusive; ///< For each thread, the instructions on which only one of its outputs depends, in program order.
+		};
+
+		ParallelPlan const& ParallelPlanFor(unsigned num_threads) const;
+
+		// accumulate the adjoints of the first num_instructions instructions into a, from the last back, given the register values r
+		template<typename T>
+		void Backpropagate(std::vector<T> const& r, std::vector<T> & a, size_t num_instructions) const
+		{
+			for (auto ii = num_instructions; ii > 0; --ii)
+			{
+				const auto& i = instructions_[ii-1];
+				const auto& bar = a[i.result];
+
+				switch (i.op)
+				{
+					case OpCode::Add:
+						a[i.lhs] += bar; a[i.rhs] += bar; break;
+					case OpCode::Subtract:
+						a[i.lhs] += bar; a[i.rhs] -= bar; break;
+					case OpCode::Multiply:
+						a[i.lhs] += bar * r[i.rhs]; a[i.rhs] += bar * r[i.lhs]; break;
+					case OpCode::Divide:
+						a[i.lhs] += bar / r[i.rhs]; a[i.rhs] -= bar * r[i.result] / r[i.rhs]; break;
+					case OpCode::Negate:
+						a[i.lhs] -= bar; break;
+					case OpCode::IntegerPower:
+						if (i.exponent!=0)
+							a[i.lhs] += bar * T(i.exponent) * pow(r[i.lhs], i.exponent-1);
+						break;
+					case OpCode::Power:
+						a[i.lhs] += bar * r[i.rhs] * pow(r[i.lhs], r[i.rhs] - T(1));
+						a[i.rhs] += bar * r[i.result] * log(r[i.lhs]); break;
+					case OpCode::Sqrt:
+						a[i.lhs] += bar / (T(2) * r[i.result]); break;
+					case OpCode::Exp:
+						a[i.lhs] += bar * r[i.result]; break;
+					case OpCode::Log:
+						a[i.lhs] += bar / r[i.lhs]; break;
+					case OpCode::Sin:
+						a[i.lhs] += bar * cos(r[i.lhs]); break;
+					case OpCode::Cos:
+						a[i.lhs] -= bar * sin(r[i.lhs]); break;
+					case OpCode::Tan:
+						a[i.lhs] += bar * (T(1) + r[i.result]*r[i.result]); break;
+					case OpCode::ArcSin:
+						a[i.lhs] += bar / sqrt(T(1) - r[i.lhs]*r[i.lhs]); break;
+					case OpCode::ArcCos:
+						a[i.lhs] -= bar / sqrt(T(1) - r[i.lhs]*r[i.lhs]); break;
+					case OpCode::ArcTan:
+						a[i.lhs] += bar / (T(1) + r[i.lhs]*r[i.lhs]); break;
+				}
+			}
+		}
+
+		/**
+		\brief Recursively lower a node, returning the register holding its value.
+		*/
+		unsigned Lower(std::shared_ptr<Node> const& n);
+
+		/**
+		\brief Lower a node whose value does not depend on any variable, reading its value now.
+		*/
+		unsigned LowerConstant(std::shared_ptr<Node> const& n);
+
+		unsigned NewRegister();
+
+		unsigned Emit(OpCode op, unsigned lhs, unsigned rhs = 0, int exponent = 0);
+
+		// zero, at the precision of the program
+		void MakeZero(dbl & z) const
+		{
+			z = dbl(0);
+		}
+
+		void MakeZero(mpfr & z) const
+		{
+			z = mpfr(0);
+			z.precision(precision_);
+		}
+
+		/**
+		\brief Evaluate through the native program, if there is one.  Only double precision is compiled.
+
+		\return Whether the native program did the evaluation.
+		*/
+		bool EvalNative(std::vector<dbl> & r) const;
+
+		bool EvalNative(std::vector<mpfr> & r) const
+		{
+			return false;
+		}
+
+		bool ReverseSweepNative(size_t index, std::vector<dbl> const& r, std::vector<dbl> & a) const;
+
+		bool ReverseSweepNative(size_t index, std::vector<mpfr> const& r, std::vector<mpfr> & a) const
+		{
+			return false;
+		}
+
+		std::unordered_map<Node const*, unsigned> lowered_; ///< Registers for nodes which have already been lowered.  Keys are only used for identity.
+		std::vector< std::pair<std::shared_ptr<Variable>, unsigned> > inputs_; ///< The variables read at the start of each evaluation, and their registers.
+		std::vector< std::pair<std::shared_ptr<Node>, unsigned> > constants_; ///< The constant nodes, and their registers.
+		std::vector< Instruction > instructions_; ///< The program itself, in topological order.
+		std::vector< unsigned > outputs_; ///< The registers holding the roots of the lowered trees.
+		std::vector< size_t > output_extents_; ///< For each output, the number of leading instructions on which it can depend.
+
+		unsigned num_registers_ = 0;
+		std::shared_ptr<NativeProgram const> native_; ///< The program compiled to native code, for double precision, if any.
+		mutable Workspace workspace_; ///< The program's own register file and adjoints.
+		mutable unsigned precision_;
+
+		/**
+		\brief The multiple precision registers and adjoints of the program's own workspace at one precision, kept while working at another.
+		*/
+		struct PrecisionTier
+		{
+			bool valid = false; ///< Whether this holds the registers at its precision, rather than storage left over from a swap.
+			std::vector<mpfr> registers;
+			std::vector<mpfr> adjoints;
+		};
+		mutable std::map<unsigned, PrecisionTier> precision_tiers_; ///< The registers at each precision used other than the current.  Cleared when a register is added.
+
+		mutable size_t batch_size_ = 0; ///< The number of points in the current batch.
+		mutable std::vector<double> batch_real_; ///< The real parts of the batch register file.  Register r at point k is at r*batch_size_ + k.
+		mutable std::vector<double> batch_imag_; ///< The imaginary parts of the batch register file.
+		mutable std::vector<double> batch_adjoint_real_; ///< The real parts of the batch adjoints, laid out as batch_real_.
+		mutable std::vector<double> batch_adjoint_imag_; ///< The imaginary parts of the batch adjoints.
+
+		mutable ParallelPlan parallel_plan_; ///< The plan for Eval by a team, made at first use.  Reset when an output is added.
+		mutable std::vector<std::tuple< std::vector<dbl>, std::vector<mpfr> > > thread_adjoints_; ///< The adjoints for each thread of ReverseSweeps by a team.
+	};
+
+} // re: namespace node
+} // re: namespace bertini
+
+
+#endif
@@ -151,16 +151,15 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 		}
 
 		
 	protected:
 		// This should never be called for a Differential.  Only for Jacobians.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
-			if(differential_variable_ == diff_variable)
+			if(IsWithRespectTo(diff_variable))
 			{
 				return 1.0;
 			}
@@ -170,9 +169,9 @@ namespace node{
 			}
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
-			if(differential_variable_ == diff_variable)
+			if(IsWithRespectTo(diff_variable))
 			{
 				evaluation_value = 1.0;
 			}
@@ -183,9 +182,9 @@ namespace node{
 		}
 
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			if(differential_variable_ == diff_variable)
+			if(IsWithRespectTo(diff_variable))
 			{
 				return mpfr(1);
 			}
@@ -195,9 +194,9 @@ namespace node{
 			}
 		}
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
-			if(differential_variable_ == diff_variable)
+			if(IsWithRespectTo(diff_variable))
 			{
 				evaluation_value.SetOne();
 			}
@@ -210,6 +209,11 @@ namespace node{
 
 
 	private:
+		/**
+		Whether the differential is that of the variable with an id, comparing Variable::Id.  Defined with Variable.
+		*/
+		bool IsWithRespectTo(VariableId diff_variable) const;
+
 		Differential() = default;
 		std::shared_ptr<const Variable> differential_variable_;
 
@@ -238,4 +242,7 @@ namespace node{
 } // re: namespace node
 } // re: namespace bertini
 
+// Variable, with which Differential::IsWithRespectTo is defined
+#include "bertini2/function_tree/symbols/variable.hpp"
+
 #endif
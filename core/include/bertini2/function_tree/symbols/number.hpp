@@ -66,10 +66,11 @@ namespace node{
 
 
 
+		/**
+		The value of a number never changes, so its stored values are kept, and resetting does nothing.  The multiple precision value is recomputed when the precision changes.
+		*/
 		void Reset() const override
-		{
-			ResetStoredValues();
-		}
+		{}
 
 
 		
@@ -125,8 +126,12 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			OwnPrecision(prec);
+		}
+
+		void OwnPrecision(unsigned int prec) const override
+		{
+			current_value_.PrecisionOfConstant(prec);
 		}
 
 
@@ -170,8 +175,18 @@ namespace node{
 		Integer(Integer const&) = default;
 
 		~Integer() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 
+		/**
+		 Get the exact value of this Integer.
+		 */
+		mpz_int const& true_value() const
+		{
+			return true_value_;
+		}
+
 
 
 		void print(std::ostream & target) const override
@@ -193,23 +208,23 @@ namespace node{
 	private:
 
 		// Return value of constant
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return dbl(double(true_value_),0);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			evaluation_value = dbl(double(true_value_),0);
 		}
 
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
 			return mpfr(true_value_,0);
 		}
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			evaluation_value = true_value_;
 		}
@@ -257,7 +272,16 @@ namespace node{
 		{}
 
 		~Float() = default;
-		
+
+		std::size_t MemoryBytes() const override;
+
+		/**
+		 Get the value of this Float, at the precision it was made with.
+		 */
+		mpfr const& highest_precision_value() const
+		{
+			return highest_precision_value_;
+		}
 
 
 
@@ -279,25 +303,25 @@ namespace node{
 
 	private:
 		// Return value of constant
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return dbl(highest_precision_value_);
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			evaluation_value = dbl(highest_precision_value_);
 		}
 
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return mpfr(highest_precision_value_);
+			return highest_precision_value_;
 		}
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
-			evaluation_value = mpfr(highest_precision_value_);
+			evaluation_value = highest_precision_value_;
 		}
 
 
@@ -320,7 +344,7 @@ namespace node{
 	/**
 	\brief The Rational number type for Bertini2 expression trees.
 
-	The Rational number type for Bertini2 expression trees.  The `true value' is stored using two mpq_rational numbers from the Boost.Multiprecision library, and the ratio is converted into a double or a mpfr at evaluate time.
+	The Rational number type for Bertini2 expression trees.  The `true value' is stored using two mpq_rational numbers from the Boost.Multiprecision library, and the ratio is converted into a double or a mpfr at the first evaluation at each precision.
 	*/
 	class Rational : public virtual Number
 	{
@@ -355,6 +379,8 @@ namespace node{
 		Rational(int, int) = delete;
 
 		~Rational() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 		static Rational Rand()
 		{
@@ -366,6 +392,22 @@ namespace node{
 			return Rational(RandomRat(),0);
 		}
 
+		/**
+		 Get the exact real part of this Rational.
+		 */
+		mpq_rational const& true_value_real() const
+		{
+			return true_value_real_;
+		}
+
+		/**
+		 Get the exact imaginary part of this Rational.
+		 */
+		mpq_rational const& true_value_imag() const
+		{
+			return true_value_imag_;
+		}
+
 		void print(std::ostream & target) const override
 		{
 			target << "(" << true_value_real_ << "," << true_value_imag_ << ")";
@@ -385,23 +427,23 @@ namespace node{
 	private:
 
 		// Return value of constant
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
 			return dbl(double(true_value_real_),double(true_value_imag_));
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
 			evaluation_value = dbl(double(true_value_real_),double(true_value_imag_));
 		}
 
 
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
 			return mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
 		}
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
 			evaluation_value = mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
 		}
@@ -74,10 +74,11 @@ namespace node{
 			virtual ~Pi() = default;
 
 
+			/**
+			The value never changes, so resetting does nothing.  See Number::Reset.
+			*/
 			void Reset() const override
-			{
-				Node::ResetStoredValues();
-			}
+			{}
 
 
 			/**
@@ -136,8 +137,12 @@ namespace node{
 			 */
 			virtual void precision(unsigned int prec) const override
 			{
-				auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-				val_pair.first.precision(prec);
+				OwnPrecision(prec);
+			}
+
+			void OwnPrecision(unsigned int prec) const override
+			{
+				current_value_.PrecisionOfConstant(prec);
 			}
 
 
@@ -145,23 +150,23 @@ namespace node{
 			
 		private:
 			// Return value of constant
-			dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+			dbl FreshEval_d(VariableId diff_variable) const override
 			{
 				return acos(-1.0);
 			}
 			
-			void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+			void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 			{
 				evaluation_value = acos(-1.0);
 			}
 
 
-			mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+			mpfr FreshEval_mp(VariableId diff_variable) const override
 			{
 				return mpfr(mpfr_float(acos(mpfr_float(-1))));
 			}
 			
-			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+			void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 			{
 				evaluation_value = mpfr(mpfr_float(acos(mpfr_float(-1))));
 			}
@@ -191,10 +196,11 @@ namespace node{
 			virtual ~E() = default;
 
 
+			/**
+			The value never changes, so resetting does nothing.  See Number::Reset.
+			*/
 			void Reset() const override
-			{
-				Node::ResetStoredValues();
-			}
+			{}
 
 			/**
 			 Differentiates a number.  Should this return the special number Zero?
@@ -251,29 +257,33 @@ namespace node{
 			 */
 			virtual void precision(unsigned int prec) const override
 			{
-				auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-				val_pair.first.precision(prec);
+				OwnPrecision(prec);
+			}
+
+			void OwnPrecision(unsigned int prec) const override
+			{
+				current_value_.PrecisionOfConstant(prec);
 			}
 
 		private:
 			// Return value of constant
-			dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+			dbl FreshEval_d(VariableId diff_variable) const override
 			{
-				return dbl(exp(1.0f),0.0);
+				return dbl(exp(1.0),0.0);
 			}
 			
-			void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+			void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 			{
-				evaluation_value = dbl(exp(1.0f),0.0);
+				evaluation_value = dbl(exp(1.0),0.0);
 			}
 
 
-			mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+			mpfr FreshEval_mp(VariableId diff_variable) const override
 			{
 				return mpfr(mpfr_float(exp(mpfr_float(1))));
 			}
 			
-			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+			void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 			{
 				evaluation_value = mpfr(mpfr_float(exp(mpfr_float(1))));
 			}
@@ -113,6 +113,8 @@ namespace node {
 		}
 		
 		virtual ~NamedSymbol() = default;
+
+		std::size_t MemoryBytes() const override;
 		
 	protected:
 		NamedSymbol() = default;
@@ -45,10 +45,26 @@
 #include "bertini2/function_tree/symbols/symbol.hpp"
 #include "bertini2/function_tree/symbols/differential.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 
 
 namespace  bertini {
 namespace node{
+
+	/**
+	\brief An id no variable has been made with before.
+	*/
+	inline
+	VariableId UniqueVariableId()
+	{
+		static std::atomic<VariableId> next(0);
+		return next++;
+	}
+
+
 	/**
 	\brief Represents variable leaves in the function tree.
 
@@ -73,6 +89,18 @@ namespace node{
 
 
 		explicit operator std::string(){return name();}
+
+
+
+		/**
+		\brief The integer the variable is known by when differentiating, which the differentials of derivative trees compare.
+
+		Each variable is made with an id of its own, which never changes, so that derivatives with respect to it are distinct from those of all others, in every system it is in.
+		*/
+		VariableId Id() const
+		{
+			return id_;
+		}
 		
 		
 		
@@ -80,10 +108,54 @@ namespace node{
 		template <typename T>
 		void set_current_value(T val)
 		{
-			std::get< std::pair<T,bool> >(current_value_).first = val;
-			std::get< std::pair<T,bool> >(current_value_).second = false;
+			current_value_.Get<T>().first = val;
+			current_value_.Get<T>().second = false;
+			std::get< std::pair<std::vector<T>,unsigned> >(powers_).second = 0;
+		}
+
+
+		/**
+		 Get the most recently set value of the variable, without going through the evaluation machinery.
+		 */
+		template <typename T>
+		T const& current_value() const
+		{
+			return current_value_.Get<T>().first;
 		}
 		
+
+
+		/**
+		 Get a nonnegative integer power of the current value of the variable.
+
+		 Powers are computed by successive multiplication, and kept until the value of the variable changes.  All the integer powers of a variable appearing in a system are then computed once per point, at a cost of one multiplication each.
+		 */
+		template <typename T>
+		T const& Power(unsigned exponent) const
+		{
+			auto& cache = std::get< std::pair<std::vector<T>,unsigned> >(powers_);
+			auto& table = cache.first;
+			auto& num_computed = cache.second; // the highest power in the table, or 0 if the table is stale
+
+			if (table.size() <= exponent)
+				ResizePowers(table, std::max(exponent+1, 2u));
+
+			if (num_computed==0)
+			{
+				table[0] = T(1);
+				table[1] = current_value<T>();
+				num_computed = 1;
+			}
+
+			for (; num_computed < exponent; ++num_computed)
+			{
+				table[num_computed+1] = table[num_computed];
+				table[num_computed+1] *= table[1];
+			}
+
+			return table[exponent];
+		}
+
 		
 		/**
 		 Differentiates a variable.  
@@ -168,36 +240,61 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			OwnPrecision(prec);
+		}
+
+		void OwnPrecision(unsigned int prec) const override
+		{
+			current_value_.Precision(prec);
+
+			auto& powers = std::get< std::pair<std::vector<mpfr>,unsigned> >(powers_);
+			for (auto& p : powers.first)
+				p.precision(prec);
+			powers.second = 0;
 		}
 		
 	protected:
 		
 		// Return current value of the variable.
-		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
+		dbl FreshEval_d(VariableId diff_variable) const override
 		{
-			return std::get< std::pair<dbl,bool> >(current_value_).first;
+			return current_value_.Get<dbl>().first;
 		}
 		
-		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const override
 		{
-			evaluation_value = std::get< std::pair<dbl,bool> >(current_value_).first;
+			evaluation_value = current_value_.Get<dbl>().first;
 		}
 
 		
-		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
+		mpfr FreshEval_mp(VariableId diff_variable) const override
 		{
-			return std::get< std::pair<mpfr,bool> >(current_value_).first;
+			return current_value_.Get<mpfr>().first;
 		}
 		
-		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
+		void FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const override
 		{
-			evaluation_value = std::get< std::pair<mpfr,bool> >(current_value_).first;
+			evaluation_value = current_value_.Get<mpfr>().first;
 		}
 
 		Variable() = default;
 	private:
+
+		void ResizePowers(std::vector<dbl> & table, unsigned size) const
+		{
+			table.resize(size);
+		}
+
+		void ResizePowers(std::vector<mpfr> & table, unsigned size) const
+		{
+			auto prec = current_value<mpfr>().precision();
+			table.resize(size);
+			for (auto& p : table)
+				p.precision(prec);
+		}
+
+		mutable std::tuple< std::pair<std::vector<dbl>,unsigned>, std::pair<std::vector<mpfr>,unsigned> > powers_; ///< Tables of the powers of the current value, and the highest power computed in each.  Not serialized.
+		VariableId id_ = UniqueVariableId(); ///< The id of the variable.  Not serialized, so a loaded variable has one of its own.
 		
 		friend class boost::serialization::access;
 
@@ -209,7 +306,12 @@ namespace node{
 	};
 	
 
-	
+
+	inline
+	bool Differential::IsWithRespectTo(VariableId diff_variable) const
+	{
+		return differential_variable_->Id() == diff_variable;
+	}
 
 } // re: namespace node
 } // re: namespace bertini
@@ -0,0 +1,243 @@
+//This file is part of Bertini 2.
+//
+//taylor_series.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//taylor_series.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with taylor_series.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file taylor_series.hpp
+
+\brief Arithmetic on truncated Taylor series, for evaluating a StraightLineProgram on series.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_TAYLOR_SERIES_HPP
+#define BERTINI_FUNCTION_TREE_TAYLOR_SERIES_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief The operations of a StraightLineProgram on truncated Taylor series.
+
+	A series is its first K coefficients, \f$a(s) = \sum_{k<K} a_k s^k\f$, contiguous.  Each function computes the first K coefficients of the result from those of the arguments, by the recurrences of Taylor-mode automatic differentiation, see Griewank and Walther, Evaluating Derivatives, chapter 13.  Each costs \f$O(K^2)\f$ operations.  The result must not overlap the arguments.  Those needing space for an auxiliary series take it as scratch, of at least K coefficients each.
+	*/
+	namespace taylor{
+
+		template<typename T>
+		void Multiply(T * c, T const* a, T const* b, unsigned K)
+		{
+			for (unsigned k = 0; k < K; ++k)
+			{
+				c[k] = a[0]*b[k];
+				for (unsigned j = 1; j <= k; ++j)
+					c[k] += a[j]*b[k-j];
+			}
+		}
+
+		template<typename T>
+		void Divide(T * c, T const* a, T const* b, unsigned K)
+		{
+			for (unsigned k = 0; k < K; ++k)
+			{
+				c[k] = a[k];
+				for (unsigned j = 1; j <= k; ++j)
+					c[k] -= b[j]*c[k-j];
+				c[k] /= b[0];
+			}
+		}
+
+		template<typename T>
+		void Exp(T * c, T const* a, unsigned K)
+		{
+			c[0] = exp(a[0]);
+			for (unsigned k = 1; k < K; ++k)
+			{
+				c[k] = T(0);
+				for (unsigned j = 1; j <= k; ++j)
+					c[k] += T(j)*a[j]*c[k-j];
+				c[k] /= T(k);
+			}
+		}
+
+		/**
+		\brief The series c with \f$c' q = a'\f$ and \f$c_0\f$ given, as for log, and the inverse trigonometric functions.  With negate, \f$c' q = -a'\f$.
+		*/
+		template<typename T>
+		void Integrate(T * c, T const* a, T const* q, unsigned K, bool negate = false)
+		{
+			for (unsigned k = 1; k < K; ++k)
+			{
+				T sum(0);
+				for (unsigned j = 1; j < k; ++j)
+					sum += T(j)*c[j]*q[k-j];
+				c[k] = ((negate ? -a[k] : a[k]) - sum/T(k)) / q[0];
+			}
+		}
+
+		template<typename T>
+		void Log(T * c, T const* a, unsigned K)
+		{
+			c[0] = log(a[0]);
+			Integrate(c, a, a, K);
+		}
+
+		template<typename T>
+		void Sqrt(T * c, T const* a, unsigned K)
+		{
+			c[0] = sqrt(a[0]);
+			for (unsigned k = 1; k < K; ++k)
+			{
+				c[k] = a[k];
+				for (unsigned j = 1; j < k; ++j)
+					c[k] -= c[j]*c[k-j];
+				c[k] /= T(2)*c[0];
+			}
+		}
+
+		/**
+		\brief The series of an integer power.
+
+		By the recurrence \f$k a_0 c_k = \sum_{j=1}^k (n j - k + j) a_j c_{k-j}\f$, unless \f$a_0 = 0\f$ and the power is positive, in which case by repeated multiplication.
+		*/
+		template<typename T>
+		void IntegerPower(T * c, T const* a, int n, unsigned K, T * scratch)
+		{
+			if (n==0)
+			{
+				c[0] = T(1);
+				for (unsigned k = 1; k < K; ++k)
+					c[k] = T(0);
+				return;
+			}
+
+			if (a[0]==T(0) && n > 0)
+			{
+				for (unsigned k = 0; k < K; ++k)
+					c[k] = a[k];
+				for (int m = 1; m < n; ++m)
+				{
+					for (unsigned k = 0; k < K; ++k)
+						scratch[k] = c[k];
+					Multiply(c, scratch, a, K);
+				}
+				return;
+			}
+
+			c[0] = pow(a[0], n);
+			for (unsigned k = 1; k < K; ++k)
+			{
+				c[k] = T(0);
+				for (unsigned j = 1; j <= k; ++j)
+					c[k] += T(n*int(j) - int(k) + int(j))*a[j]*c[k-j];
+				c[k] /= T(k)*a[0];
+			}
+		}
+
+		/**
+		\brief The series of \f$a^b\f$, as \f$\exp(b \log a)\f$.
+		*/
+		template<typename T>
+		void Power(T * c, T const* a, T const* b, unsigned K, T * scratch1, T * scratch2)
+		{
+			Log(scratch1, a, K);
+			Multiply(scratch2, b, scratch1, K);
+			Exp(c, scratch2, K);
+		}
+
+		/**
+		\brief The series of the sine and cosine of a, together, since each recurrence needs the other.
+		*/
+		template<typename T>
+		void SinCos(T * s, T * co, T const* a, unsigned K)
+		{
+			s[0] = sin(a[0]);
+			co[0] = cos(a[0]);
+			for (unsigned k = 1; k < K; ++k)
+			{
+				s[k] = T(0);
+				co[k] = T(0);
+				for (unsigned j = 1; j <= k; ++j)
+				{
+					s[k] += T(j)*a[j]*co[k-j];
+					co[k] -= T(j)*a[j]*s[k-j];
+				}
+				s[k] /= T(k);
+				co[k] /= T(k);
+			}
+		}
+
+		/**
+		\brief The series of the tangent, from \f$c' = (1 + c^2) a'\f$.
+		*/
+		template<typename T>
+		void Tan(T * c, T const* a, unsigned K, T * u)
+		{
+			c[0] = tan(a[0]);
+			u[0] = T(1) + c[0]*c[0];
+			for (unsigned k = 1; k < K; ++k)
+			{
+				c[k] = T(0);
+				for (unsigned j = 1; j <= k; ++j)
+					c[k] += T(j)*a[j]*u[k-j];
+				c[k] /= T(k);
+
+				u[k] = T(0);
+				for (unsigned j = 0; j <= k; ++j)
+					u[k] += c[j]*c[k-j];
+			}
+		}
+
+		/**
+		\brief The series of arcsine or arccosine, from \f$c' \sqrt{1-a^2} = \pm a'\f$.
+		*/
+		template<typename T>
+		void ArcSinCos(T * c, T const* a, unsigned K, bool cosine, T * scratch1, T * scratch2)
+		{
+			Multiply(scratch1, a, a, K);
+			for (unsigned k = 0; k < K; ++k)
+				scratch1[k] = -scratch1[k];
+			scratch1[0] += T(1);
+			Sqrt(scratch2, scratch1, K);
+
+			c[0] = cosine ? acos(a[0]) : asin(a[0]);
+			Integrate(c, a, scratch2, K, cosine);
+		}
+
+		/**
+		\brief The series of arctangent, from \f$c' (1+a^2) = a'\f$.
+		*/
+		template<typename T>
+		void ArcTan(T * c, T const* a, unsigned K, T * scratch)
+		{
+			Multiply(scratch, a, a, K);
+			scratch[0] += T(1);
+
+			c[0] = atan(a[0]);
+			Integrate(c, a, scratch, K);
+		}
+
+	} // re: namespace taylor
+} // re: namespace node
+} // re: namespace bertini
+
+#endif
@@ -26,6 +26,8 @@
 \file logging.hpp 
 
 \brief Logging in Bertini using Boost.Log
+
+Log with BERTINI_LOG, rather than BOOST_LOG_TRIVIAL directly, so that messages which will not be written cost next to nothing, and messages below the configured minimum cost nothing at all.  LoggingInit writes to a file from a background thread, so threads logging while they track never wait on each other or on the disk.
 */
 
 
@@ -35,14 +37,43 @@
  
 #define BOOST_LOG_DYN_LINK 1
 
+#include "bertini2/config.h"
+
 #include <boost/log/core.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
 #include <boost/log/utility/setup/file.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/sources/record_ostream.hpp>
+#include <boost/make_shared.hpp>
+
+#include <atomic>
+
+
+#ifndef BERTINI_MIN_LOG_SEVERITY
+/**
+The least severe level of log message compiled in, one of trace, debug, info, warning, error, fatal.  Set with --with-min_log_severity when configuring.
+*/
+#define BERTINI_MIN_LOG_SEVERITY trace
+#endif
+
+
+/**
+\brief Log a message at a severity level, one of trace, debug, info, warning, error, fatal.
+
+\code
+BERTINI_LOG(debug) << "changing precision from " << previous << " to " << next;
+\endcode
+
+Messages less severe than BERTINI_MIN_LOG_SEVERITY are compiled out.  Messages less severe than the level set at run time, by LoggingInit or SetLogSeverity, cost one relaxed atomic load: they neither touch the Boost.Log core, which locks, nor evaluate or format what is streamed into them.
+*/
+#define BERTINI_LOG(lvl) \
+	if (!(::boost::log::trivial::lvl >= ::boost::log::trivial::BERTINI_MIN_LOG_SEVERITY && ::bertini::LogEnabled(::boost::log::trivial::lvl))) {} \
+	else BOOST_LOG_TRIVIAL(lvl)
+
 
 namespace bertini
 {
@@ -65,6 +96,45 @@ namespace bertini
 	}
 
 
+	using severity_level = logging::trivial::severity_level;
+
+
+	namespace detail{
+		/**
+		The least severe level of message written, checked by BERTINI_LOG before going to Boost.Log.  Until LoggingInit or SetLogSeverity is called, info, as for Boost.Log's default sink.
+		*/
+		inline
+		std::atomic<int>& LogSeverityThreshold()
+		{
+			static std::atomic<int> threshold{static_cast<int>(severity_level::info)};
+			return threshold;
+		}
+	}
+
+	/**
+	\brief Set the least severe level of message logged by BERTINI_LOG.  Called by LoggingInit; call it yourself if you set up your own sinks.
+	*/
+	inline
+	void SetLogSeverity(severity_level level)
+	{
+		detail::LogSeverityThreshold().store(static_cast<int>(level), std::memory_order_relaxed);
+	}
+
+	/**
+	\brief Whether messages at a level are logged, for skipping work done only to log.
+	*/
+	inline
+	bool LogEnabled(severity_level level)
+	{
+		return static_cast<int>(level) >= detail::LogSeverityThreshold().load(std::memory_order_relaxed);
+	}
+
+
+	/**
+	\brief Logs to the rotating files bertini_N.log, from a background thread, for the lifetime of this object.
+
+	Messages are queued by the logging threads without waiting on each other, and written by the background thread.  Anything queued is written when this is destroyed.
+	*/
 	struct LoggingInit
 	{
 		
@@ -72,28 +142,45 @@ namespace bertini
 		//
 		//  trace, debug, info, warning, error, fatal
 		LoggingInit(logging::trivial::severity_level desired_level = logging::trivial::severity_level::trace, unsigned desired_rotation_size = 10*1024*1024)
+			: previous_level_(static_cast<severity_level>(detail::LogSeverityThreshold().load()))
 		{
-			logging::add_file_log
+			auto backend = boost::make_shared<sinks::text_file_backend>
 			(
 			    keywords::file_name = "bertini_%N.log",
-			    keywords::rotation_size = desired_rotation_size,
-			    keywords::format = "%Message%" //[%TimeStamp%]: 
+			    keywords::rotation_size = desired_rotation_size
 			);
 
+			sink_ = boost::make_shared<Sink>(backend);
+			sink_->set_formatter(logging::expressions::stream << logging::expressions::smessage); //[%TimeStamp%]: 
+			logging::core::get()->add_sink(sink_);
+
 			logging::core::get()->set_filter
 			(
 			    logging::trivial::severity >= desired_level
 			);
+			SetLogSeverity(desired_level);
 
-			BOOST_LOG_TRIVIAL(trace) << "initialized logging";
+			BERTINI_LOG(trace) << "initialized logging";
 
 		}
 
-		~LoggingInit(){}
-	    
-	};
+		LoggingInit(LoggingInit const&) = delete;
+		LoggingInit& operator=(LoggingInit const&) = delete;
 
-	using severity_level = logging::trivial::severity_level;
+		~LoggingInit()
+		{
+			logging::core::get()->remove_sink(sink_);
+			sink_->stop();
+			sink_->flush();
+			SetLogSeverity(previous_level_);
+		}
+
+	private:
+		using Sink = sinks::asynchronous_sink<sinks::text_file_backend>;
+
+		boost::shared_ptr<Sink> sink_;
+		severity_level previous_level_;
+	};
 
 } // re: namespace bertini
 
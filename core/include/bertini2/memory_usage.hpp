@@ -0,0 +1,246 @@
+//This file is part of Bertini 2.
+//
+//memory_usage.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//memory_usage.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with memory_usage.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file memory_usage.hpp
+
+\brief Accounting for the memory held by systems, trackers, and endgames, by component.
+
+The counts are estimates, of the bytes held by the objects themselves and the heap storage they own, including the limbs of multiple precision numbers at their current precision.  They do not include the overhead of the allocator, nor storage shared with objects outside the one asked, such as the system a tracker refers to.  They are meant for sizing jobs, such as choosing how many threads fit in the memory of a node, not for exact bookkeeping.
+
+\code
+std::cout << sys.MemoryUsage();
+std::cout << tracker.MemoryUsage().Total() << " bytes in the tracker\n";
+\endcode
+*/
+
+#ifndef BERTINI_MEMORY_USAGE_HPP
+#define BERTINI_MEMORY_USAGE_HPP
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/detail/ring_buffer.hpp"
+#include <Eigen/Sparse>
+
+#include <deque>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	/**
+	\brief Byte counts of the components of an object, by name.
+	*/
+	struct MemoryReport
+	{
+		std::map<std::string, std::size_t> components;
+
+		/**
+		\brief Add bytes to a component, making it if needed.
+		*/
+		void Add(std::string const& component, std::size_t bytes)
+		{
+			components[component] += bytes;
+		}
+
+		/**
+		\brief Add the components of another usage, with a prefix on their names, such as "system: ".
+		*/
+		void Add(std::string const& prefix, MemoryReport const& other)
+		{
+			for (auto const& c : other.components)
+				components[prefix + c.first] += c.second;
+		}
+
+		/**
+		\brief The sum of the components.
+		*/
+		std::size_t Total() const
+		{
+			std::size_t total = 0;
+			for (auto const& c : components)
+				total += c.second;
+			return total;
+		}
+
+		MemoryReport& operator+=(MemoryReport const& other)
+		{
+			for (auto const& c : other.components)
+				components[c.first] += c.second;
+			return *this;
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, MemoryReport const& m)
+		{
+			for (auto const& c : m.components)
+				out << c.first << ": " << c.second << " bytes\n";
+			return out << "total: " << m.Total() << " bytes\n";
+		}
+	};
+
+
+	/**
+	\brief The heap bytes owned by numbers and containers of them.
+
+	Each HeapBytes counts only storage outside the object itself; Bytes adds the object.  Containers count their capacity, with the heap storage of their elements.
+	*/
+	namespace memory {
+
+		/**
+		Numbers in double precision, indices, and other plain data own no heap storage.
+		*/
+		template<typename T>
+		std::enable_if_t<std::is_trivially_copyable<T>::value, std::size_t> HeapBytes(T const&)
+		{
+			return 0;
+		}
+
+		/**
+		The limbs of the significand at the current precision, and the word MPFR keeps its size in.
+		*/
+		inline std::size_t HeapBytes(mpfr_float const& x)
+		{
+			return mpfr_custom_get_size(mpfr_get_prec(x.backend().data())) + sizeof(mp_limb_t);
+		}
+
+		inline std::size_t HeapBytes(mpfr const& z)
+		{
+			return HeapBytes(z.real()) + HeapBytes(z.imag());
+		}
+
+		inline std::size_t HeapBytes(mpz_int const& n)
+		{
+			return n.backend().data()[0]._mp_alloc * sizeof(mp_limb_t);
+		}
+
+		inline std::size_t HeapBytes(mpq_rational const& q)
+		{
+			auto data = q.backend().data();
+			return (mpq_numref(data)->_mp_alloc + mpq_denref(data)->_mp_alloc) * sizeof(mp_limb_t);
+		}
+
+		template<typename T>
+		std::size_t HeapBytes(Eigen::Matrix<T, Eigen::Dynamic, 1> const& v)
+		{
+			std::size_t bytes = v.size() * sizeof(T);
+			for (int ii = 0; ii < v.size(); ++ii)
+				bytes += HeapBytes(v(ii));
+			return bytes;
+		}
+
+		template<typename T>
+		std::size_t HeapBytes(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> const& A)
+		{
+			std::size_t bytes = A.size() * sizeof(T);
+			for (int ii = 0; ii < A.size(); ++ii)
+				bytes += HeapBytes(A.data()[ii]);
+			return bytes;
+		}
+
+		/**
+		The factors and the permutation.  Factorizations not yet computed hold nothing.
+		*/
+		template<typename MatrixType>
+		std::size_t HeapBytes(Eigen::PartialPivLU<MatrixType> const& LU)
+		{
+			if (LU.rows()==0)
+				return 0;
+			return HeapBytes(LU.matrixLU()) + 2*LU.rows()*sizeof(int);
+		}
+
+		/**
+		The allocated values and their indices, and the outer indices.
+		*/
+		template<typename T>
+		std::size_t HeapBytes(Eigen::SparseMatrix<T> const& A)
+		{
+			std::size_t bytes = (A.outerSize()+1)*sizeof(int) + A.data().allocatedSize()*(sizeof(T) + sizeof(int));
+			for (int ii = 0; ii < A.data().size(); ++ii)
+				bytes += HeapBytes(A.data().value(ii));
+			return bytes;
+		}
+
+		template<typename T>
+		std::size_t HeapBytes(std::vector<T> const& v)
+		{
+			std::size_t bytes = v.capacity() * sizeof(T);
+			for (auto const& x : v)
+				bytes += HeapBytes(x);
+			return bytes;
+		}
+
+		template<typename T>
+		std::size_t HeapBytes(std::deque<T> const& d)
+		{
+			std::size_t bytes = d.size() * sizeof(T);
+			for (auto const& x : d)
+				bytes += HeapBytes(x);
+			return bytes;
+		}
+
+		/**
+		All the slots, including those of dropped elements, which keep their storage for reuse.
+		*/
+		template<typename T>
+		std::size_t HeapBytes(detail::RingBuffer<T> const& r)
+		{
+			return HeapBytes(r.Slots());
+		}
+
+		template<typename... Ts, std::size_t... I>
+		std::size_t TupleHeapBytes(std::tuple<Ts...> const& t, std::index_sequence<I...>)
+		{
+			std::size_t bytes = 0;
+			(void)std::initializer_list<int>{ (bytes += HeapBytes(std::get<I>(t)), 0)... };
+			return bytes;
+		}
+
+		/**
+		The members of a tuple, such as the double and multiple precision pairs of workspaces held by trackers.
+		*/
+		template<typename... Ts>
+		std::size_t HeapBytes(std::tuple<Ts...> const& t)
+		{
+			return TupleHeapBytes(t, std::index_sequence_for<Ts...>{});
+		}
+
+		/**
+		\brief The bytes of an object, and the heap storage it owns.
+		*/
+		template<typename T>
+		std::size_t Bytes(T const& x)
+		{
+			return sizeof(T) + HeapBytes(x);
+		}
+
+	} // re: namespace memory
+
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,124 @@
+//This file is part of Bertini 2.
+//
+//mp_allocator.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mp_allocator.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mp_allocator.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mp_allocator.hpp
+
+\brief An optional allocator for the limbs of multiple precision numbers, caching freed blocks per thread, by size.
+*/
+
+#ifndef BERTINI_MP_ALLOCATOR_HPP
+#define BERTINI_MP_ALLOCATOR_HPP
+
+#include <cstddef>
+
+namespace bertini {
+
+	namespace mp_allocator {
+
+		/**
+		\brief Counts of the calling thread's use of the allocator.
+		*/
+		struct ThreadStatistics
+		{
+			std::size_t num_reused = 0; ///< Allocations served from the thread's cache.
+			std::size_t num_allocated = 0; ///< Allocations passed to malloc, for want of a cached block, or being too large to cache.
+			std::size_t num_cached = 0; ///< Blocks held in the thread's cache now.
+		};
+
+		/**
+		\brief Install the allocator as GMP's memory functions, through mp_set_memory_functions, so MPFR and everything built on it, bertini::complex and mpfr_float included, allocate through it.
+
+		Each thread keeps its own free lists, one for each block size up to MaxCachedBytes in steps of the limb size.  A freed block of such a size goes on the list of the freeing thread, and an allocation of that size takes one from the list of the allocating thread, without locking.  Other sizes go to malloc and free.  The blocks are plain malloc blocks reused only at exactly their own size, so blocks made before installing, or freed after uninstalling, are handled correctly, and numbers may move between threads.  A thread's cached blocks are freed when it exits.
+
+		Contention for malloc between many threads tracking in multiple precision is so avoided once each thread's caches are warm, since the numbers of a tracker step are mostly made and freed at the same sizes every step.
+
+		Does nothing if thread_local is not enabled, see USE_THREAD_LOCAL.
+
+		\return Whether the allocator was installed.
+		*/
+		bool Install();
+
+		/**
+		\brief Restore the memory functions GMP had before Install.  Blocks cached stay cached until their threads exit, or ReleaseThreadCache.
+		*/
+		void Uninstall();
+
+		/**
+		\brief Whether the allocator is installed.
+		*/
+		bool IsInstalled();
+
+		/**
+		\brief Free the blocks cached by the calling thread.
+		*/
+		void ReleaseThreadCache();
+
+		/**
+		\brief The counts of the calling thread.
+		*/
+		ThreadStatistics GetThreadStatistics();
+
+		/**
+		\brief The largest block cached, in bytes.  Numbers of up to about 1000 digits fit.
+		*/
+		constexpr std::size_t MaxCachedBytes()
+		{
+			return 512;
+		}
+
+		/**
+		\brief The most blocks of each size a thread caches.  Blocks freed beyond this go to free.
+		*/
+		constexpr std::size_t MaxCachedPerSize()
+		{
+			return 4096;
+		}
+
+		/**
+		\brief Install the allocator for a scope, restoring the previous memory functions after.
+		*/
+		class ScopedInstall
+		{
+		public:
+			ScopedInstall() : installed_(!IsInstalled() && Install())
+			{}
+
+			~ScopedInstall()
+			{
+				if (installed_)
+					Uninstall();
+			}
+
+			ScopedInstall(ScopedInstall const&) = delete;
+			ScopedInstall& operator=(ScopedInstall const&) = delete;
+
+		private:
+			bool installed_;
+		};
+
+	} // namespace mp_allocator
+} // namespace bertini
+
+#endif
@@ -38,11 +38,15 @@
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/split_member.hpp>
 
 #include <string>
 #include <assert.h>
 
+#include <mpfr.h>
+
 
 namespace bertini {
 
@@ -71,6 +75,34 @@ namespace bertini {
 			static mpfr_float temp_[8];
 		#endif
 
+		/**
+		 result = a*b + c*d, rounded once where the installed MPFR has mpfr_fmma.  result may be any of the arguments.  Falls back to temp_[7] for c*d.
+		 */
+		static void Fmma(mpfr_float & result, const mpfr_float & a, const mpfr_float & b, const mpfr_float & c, const mpfr_float & d)
+		{
+		#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+			mpfr_fmma(result.backend().data(), a.backend().data(), b.backend().data(), c.backend().data(), d.backend().data(), MPFR_RNDN);
+		#else
+			temp_[7].precision(DefaultPrecision());
+			mpfr_mul(temp_[7].backend().data(), c.backend().data(), d.backend().data(), MPFR_RNDN);
+			mpfr_fma(result.backend().data(), a.backend().data(), b.backend().data(), temp_[7].backend().data(), MPFR_RNDN);
+		#endif
+		}
+
+		/**
+		 result = a*b - c*d, rounded once where the installed MPFR has mpfr_fmms.  result may be any of the arguments.  Falls back to temp_[7] for c*d.
+		 */
+		static void Fmms(mpfr_float & result, const mpfr_float & a, const mpfr_float & b, const mpfr_float & c, const mpfr_float & d)
+		{
+		#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+			mpfr_fmms(result.backend().data(), a.backend().data(), b.backend().data(), c.backend().data(), d.backend().data(), MPFR_RNDN);
+		#else
+			temp_[7].precision(DefaultPrecision());
+			mpfr_mul(temp_[7].backend().data(), c.backend().data(), d.backend().data(), MPFR_RNDN);
+			mpfr_fms(result.backend().data(), a.backend().data(), b.backend().data(), temp_[7].backend().data(), MPFR_RNDN);
+		#endif
+		}
+
 		// Let the boost serialization library have access to the private members of this class.
 		friend class boost::serialization::access;
 		
@@ -238,9 +270,9 @@ namespace bertini {
 		
 		
 		/**
-		 The move constructor
+		 The move constructor.  Steals the limbs of other, leaving it valid but unspecified, and never throws, so containers of complex move rather than copy when they grow.
 		 */
-		complex(complex&& other) : real_(std::move(other.real_)), imag_(std::move(other.imag_))
+		complex(complex&& other) noexcept : real_(std::move(other.real_)), imag_(std::move(other.imag_))
 		{}
 		
 		
@@ -283,7 +315,7 @@ namespace bertini {
 			return *this;
 		}
 
-		complex& operator=(complex && other) = default;
+		complex& operator=(complex && other) noexcept = default;
 #endif
 		
 		template<typename T, typename S, typename R, 
@@ -548,22 +580,114 @@ namespace bertini {
 
 
 
+		/**
+		 The precision, in digits, from which multiplication uses the three-multiplication Karatsuba product rather than the four-multiplication one.  Below this, the three extra additions cost more than the multiplication saved.
+		 */
+		static constexpr unsigned KaratsubaDigits = 300;
+
 		/**
 		 Complex multiplication.  uses a single temporary variable
 		 
-		 1 temporary, 4 multiplications
+		 1 temporary, 4 multiplications, each part rounded once if MPFR has mpfr_fmma.  At KaratsubaDigits and above, 3 temporaries and 3 multiplications.
 		 */
 		complex& operator*=(const complex & rhs)
 		{
+			if (DefaultPrecision() >= KaratsubaDigits)
+				return MultiplyKaratsuba(rhs);
+
 			temp_[0].precision(DefaultPrecision());
 
-			temp_[0] = real_*rhs.real_ - imag_*rhs.imag_; // cache the real part of the result
-			imag_ = real_*rhs.imag_ + imag_*rhs.real_;
-			real_ = temp_[0];
+			Fmms(temp_[0], real_, rhs.real_, imag_, rhs.imag_); // cache the real part of the result
+			Fmma(imag_, real_, rhs.imag_, imag_, rhs.real_);
+			real_.swap(temp_[0]);
+			return *this;
+		}
+
+		/**
+		 Complex multiplication using three real multiplications,
+
+		 (a+bi)(c+di) = (c(a+b) - b(c+d)) + (c(a+b) + a(d-c))i
+
+		 3 temporaries, 3 multiplications, 5 additions.
+		 */
+		complex& MultiplyKaratsuba(const complex & rhs)
+		{
+			temp_[0].precision(DefaultPrecision());
+			temp_[1].precision(DefaultPrecision());
+			temp_[2].precision(DefaultPrecision());
+
+			mpfr_ptr k1 = temp_[0].backend().data(), k2 = temp_[1].backend().data(), k3 = temp_[2].backend().data();
+
+			mpfr_add(k1, real_.backend().data(), imag_.backend().data(), MPFR_RNDN);
+			mpfr_mul(k1, k1, rhs.real_.backend().data(), MPFR_RNDN);
+
+			mpfr_sub(k2, rhs.imag_.backend().data(), rhs.real_.backend().data(), MPFR_RNDN);
+			mpfr_mul(k2, k2, real_.backend().data(), MPFR_RNDN);
+
+			mpfr_add(k3, rhs.real_.backend().data(), rhs.imag_.backend().data(), MPFR_RNDN);
+			mpfr_mul(k3, k3, imag_.backend().data(), MPFR_RNDN);
+
+			mpfr_sub(real_.backend().data(), k1, k3, MPFR_RNDN);
+			mpfr_add(imag_.backend().data(), k1, k2, MPFR_RNDN);
+			return *this;
+		}
+
+		/**
+		 Fused multiply-add, *this += b*c, without forming the product as a complex.
+
+		 2 temporaries, 4 multiplications, each part of the product rounded once if MPFR has mpfr_fmma.
+		 */
+		complex& MultiplyAdd(const complex & b, const complex & c)
+		{
+			temp_[0].precision(DefaultPrecision());
+			temp_[1].precision(DefaultPrecision());
+
+			Fmms(temp_[0], b.real_, c.real_, b.imag_, c.imag_);
+			Fmma(temp_[1], b.real_, c.imag_, b.imag_, c.real_);
+			real_ += temp_[0];
+			imag_ += temp_[1];
+			return *this;
+		}
+
+		/**
+		 Fused multiply-subtract, *this -= b*c, without forming the product as a complex.
+		 */
+		complex& MultiplySubtract(const complex & b, const complex & c)
+		{
+			temp_[0].precision(DefaultPrecision());
+			temp_[1].precision(DefaultPrecision());
+
+			Fmms(temp_[0], b.real_, c.real_, b.imag_, c.imag_);
+			Fmma(temp_[1], b.real_, c.imag_, b.imag_, c.real_);
+			real_ -= temp_[0];
+			imag_ -= temp_[1];
 			return *this;
 		}
 		
 
+		/**
+		 Sine and cosine together.
+
+		 sin(a+bi) = sin(a)cosh(b) + i cos(a)sinh(b), and cos(a+bi) = cos(a)cosh(b) - i sin(a)sinh(b), so both come from one mpfr_sin_cos and one mpfr_sinh_cosh, the same cost as either alone.  s and c keep their precisions, and either may be *this.
+		 */
+		void SinCos(complex & s, complex & c) const
+		{
+			for (unsigned ii = 3; ii < 7; ++ii)
+				temp_[ii].precision(DefaultPrecision());
+
+			mpfr_ptr sin_a = temp_[3].backend().data(), cos_a = temp_[4].backend().data(), sinh_b = temp_[5].backend().data(), cosh_b = temp_[6].backend().data();
+
+			mpfr_sin_cos(sin_a, cos_a, real_.backend().data(), MPFR_RNDN);
+			mpfr_sinh_cosh(sinh_b, cosh_b, imag_.backend().data(), MPFR_RNDN);
+
+			mpfr_mul(s.real_.backend().data(), sin_a, cosh_b, MPFR_RNDN);
+			mpfr_mul(s.imag_.backend().data(), cos_a, sinh_b, MPFR_RNDN);
+			mpfr_mul(c.real_.backend().data(), cos_a, cosh_b, MPFR_RNDN);
+			mpfr_mul(c.imag_.backend().data(), sin_a, sinh_b, MPFR_RNDN);
+			mpfr_neg(c.imag_.backend().data(), c.imag_.backend().data(), MPFR_RNDN);
+		}
+
+
 		/**
 		 Complex multiplication, by an integral type.
 		 */
@@ -593,10 +717,11 @@ namespace bertini {
 			temp_[1].precision(DefaultPrecision());
 			temp_[2].precision(DefaultPrecision());
 
-			temp_[1] = rhs.abs2(); // cache the denomenator...
-			temp_[2] = real_*rhs.real_ + imag_*rhs.imag_; // cache the numerator of the real part of the result
-			imag_ = (imag_*rhs.real_ - real_*rhs.imag_)/temp_[1];
-			real_ = temp_[2]/temp_[1];
+			Fmma(temp_[1], rhs.real_, rhs.real_, rhs.imag_, rhs.imag_); // cache the denomenator...
+			Fmma(temp_[2], real_, rhs.real_, imag_, rhs.imag_); // cache the numerator of the real part of the result
+			Fmms(imag_, imag_, rhs.real_, real_, rhs.imag_);
+			imag_ /= temp_[1];
+			mpfr_div(real_.backend().data(), temp_[2].backend().data(), temp_[1].backend().data(), MPFR_RNDN);
 			
 			return *this;
 		}
@@ -653,19 +778,23 @@ namespace bertini {
 		
 		
 		/**
-		 Compute the square of the absolute value of the number
+		 Compute the square of the absolute value of the number, without a square root.
 		 */
 		mpfr_float abs2() const
 		{
-			return real()*real()+imag()*imag();
+			mpfr_float r;
+			Fmma(r, real_, real_, imag_, imag_);
+			return r;
 		}
 		
 		/**
-		 Compute the absolute value of the number
+		 Compute the absolute value of the number, rounded once, and without overflow in squaring the parts.
 		 */
 		mpfr_float abs() const
 		{
-			return sqrt(abs2());
+			mpfr_float r;
+			mpfr_hypot(r.backend().data(), real_.backend().data(), imag_.backend().data(), MPFR_RNDN);
+			return r;
 		}
 		
 		
@@ -1232,7 +1361,7 @@ namespace bertini {
 	 */
 	inline mpfr_float abs(const complex & z)
 	{
-		return boost::multiprecision::sqrt(abs2(z));
+		return z.abs();
 	}
 	
 	
@@ -1349,9 +1478,16 @@ namespace bertini {
 	 */
 	inline complex exp(const complex & z)
 	{
-		complex::temp_[7].precision(DefaultPrecision());
-		complex::temp_[7] = exp(real(z));
-		return complex(complex::temp_[7] * cos(imag(z)), complex::temp_[7] * sin(imag(z)));
+		complex result;
+		for (unsigned ii = 5; ii < 8; ++ii)
+			complex::temp_[ii].precision(DefaultPrecision());
+
+		mpfr_exp(complex::temp_[7].backend().data(), z.real_.backend().data(), MPFR_RNDN);
+		mpfr_sin_cos(complex::temp_[5].backend().data(), complex::temp_[6].backend().data(), z.imag_.backend().data(), MPFR_RNDN);
+
+		mpfr_mul(result.real_.backend().data(), complex::temp_[7].backend().data(), complex::temp_[6].backend().data(), MPFR_RNDN);
+		mpfr_mul(result.imag_.backend().data(), complex::temp_[7].backend().data(), complex::temp_[5].backend().data(), MPFR_RNDN);
+		return result;
 	}
 	
 	/**
@@ -1359,7 +1495,9 @@ namespace bertini {
 	 */
 	inline complex sin(const complex & z)
 	{
-		return (exp(complex::i()*z) - exp(-complex::i()*z)) / complex::i() / 2;
+		complex s, c;
+		z.SinCos(s, c);
+		return s;
 	}
 	
 	/**
@@ -1367,7 +1505,9 @@ namespace bertini {
 	 */
 	inline complex cos(const complex & z)
 	{
-		return (exp(complex::i()*z) + exp(-complex::i()*z))  / 2;
+		complex s, c;
+		z.SinCos(s, c);
+		return c;
 	}
 	
 	/**
@@ -1544,14 +1684,12 @@ namespace bertini {
 	inline 
 	void RandomUnit(bertini::complex & a, unsigned num_digits)
 	{
-		auto prev_precision = DefaultPrecision();
+		ScopedPrecision unchanged(DefaultPrecision());
 
 		a.precision(num_digits);
 		RandomMp(a.real_,num_digits);
 		RandomMp(a.imag_,num_digits);
 		a /= abs(a);
-
-		DefaultPrecision(prev_precision);
 	}
 
 	using mpfr = bertini::complex;
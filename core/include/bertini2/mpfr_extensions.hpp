@@ -34,6 +34,7 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 #define BERTINI_MPFR_EXTENSIONS_HPP
 
 #include "bertini2/config.h"
+#include "bertini2/random.hpp"
 
 #include <boost/multiprecision/mpfr.hpp>
 #include <boost/multiprecision/random.hpp>
@@ -41,9 +42,13 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/split_member.hpp>
 
 #include <string>
+#include <type_traits>
+#include <vector>
 
 
 
@@ -60,16 +65,72 @@ namespace bertini{
 	using mpq_rational = boost::multiprecision::number<boost::multiprecision::backends::gmp_rational, boost::multiprecision::et_off>;
 #endif
 
-	inline auto DefaultPrecision()
+	/**
+	\brief Get the working precision of the calling thread, in digits, at which new multiple precision numbers are made.
+
+	Each thread has its own, if Boost.Multiprecision keeps one per thread, which configure checks for, defining HAVE_THREAD_DEFAULT_PRECISION.  A new thread starts at the precision last set for the process, so threads which work in multiple precision should set theirs first.  Otherwise there is one for the whole process, and threads working at different precisions make their numbers at each other's.
+	*/
+	inline unsigned DefaultPrecision()
 	{
+	#ifdef HAVE_THREAD_DEFAULT_PRECISION
+		return mpfr_float::thread_default_precision();
+	#else
 		return mpfr_float::default_precision();
+	#endif
 	}
 
+	/**
+	\brief Set the working precision of the calling thread, in digits.  See DefaultPrecision().
+	*/
 	inline void DefaultPrecision(unsigned prec)
 	{
+	#ifdef HAVE_THREAD_DEFAULT_PRECISION
+		mpfr_float::thread_default_precision(prec);
+	#else
 		mpfr_float::default_precision(prec);
+	#endif
 	}
 
+	/**
+	\brief Sets the working precision of the calling thread for its lifetime, restoring the previous one when destroyed, including by an exception.
+
+	\code
+	{
+		ScopedPrecision higher(2*DefaultPrecision());
+		// numbers made here are at the higher precision
+	}
+	// and those made here at the one before
+	\endcode
+	*/
+	class ScopedPrecision
+	{
+	public:
+		explicit
+		ScopedPrecision(unsigned prec) : previous_(DefaultPrecision())
+		{
+			DefaultPrecision(prec);
+		}
+
+		~ScopedPrecision()
+		{
+			DefaultPrecision(previous_);
+		}
+
+		ScopedPrecision(ScopedPrecision const&) = delete;
+		ScopedPrecision& operator=(ScopedPrecision const&) = delete;
+
+		/**
+		\brief The working precision when this was made, restored when it is destroyed.
+		*/
+		unsigned Previous() const
+		{
+			return previous_;
+		}
+
+	private:
+		unsigned previous_;
+	};
+
 	/** 
 	\brief Get the precision of a number.
 
@@ -90,6 +151,23 @@ namespace bertini{
 	{
 		num.precision(prec);
 	}
+
+	/**
+	\brief Whether an archive is one of Boost's native binary archives.
+
+	Multiple precision numbers are written to these as their limbs, rather than as decimal strings, which is exact and much faster, but not portable across architectures.  Use text archives for anything leaving the machine.
+	*/
+	template<typename Archive>
+	struct IsBinaryArchive : std::false_type
+	{};
+
+	template<>
+	struct IsBinaryArchive<boost::archive::binary_oarchive> : std::true_type
+	{};
+
+	template<>
+	struct IsBinaryArchive<boost::archive::binary_iarchive> : std::true_type
+	{};
 }
 
 // the following code block extends serialization to the mpfr_float class from boost::multiprecision
@@ -98,19 +176,45 @@ namespace boost { namespace serialization {
 	 Save a mpfr_float type to a boost archive.
 	 */
 	template <typename Archive>
-	void save(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, unsigned /*version*/)
+	void save(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, std::false_type)
 	{
 		unsigned num_digits(r.precision());
 		ar & num_digits;
 		std::string tmp = r.str(0,std::ios::scientific);
 		ar & tmp;
 	}
-	
+
 	/**
-	 Load a mpfr_float type from a boost archive.
+	 Save a mpfr_float to a binary archive, as its precision in bits, kind and sign, exponent, and limbs.
 	 */
 	template <typename Archive>
-	void load(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, unsigned /*version*/)
+	void save(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, std::true_type)
+	{
+		mpfr_srcptr x = r.data();
+		long prec = mpfr_get_prec(x);
+		int kind = mpfr_custom_get_kind(x);
+		ar & prec;
+		ar & kind;
+
+		if (mpfr_regular_p(x))
+		{
+			long exponent = mpfr_custom_get_exp(x);
+			ar & exponent;
+			ar.save_binary(mpfr_custom_get_significand(x), mpfr_custom_get_size(prec));
+		}
+	}
+
+	/**
+	 Save a mpfr_float type to a boost archive.
+	 */
+	template <typename Archive>
+	void save(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, unsigned /*version*/)
+	{
+		save(ar, r, std::integral_constant<bool, bertini::IsBinaryArchive<Archive>::value>());
+	}
+	
+	template <typename Archive>
+	void load(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, std::false_type)
 	{
 		unsigned num_digits;
 		ar & num_digits;
@@ -119,6 +223,45 @@ namespace boost { namespace serialization {
 		ar & tmp;
 		r = tmp.c_str();
 	}
+
+	/**
+	 Load a mpfr_float from a binary archive, from its limbs.
+	 */
+	template <typename Archive>
+	void load(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, std::true_type)
+	{
+		long prec;
+		int kind;
+		ar & prec;
+		ar & kind;
+
+		const auto num_bytes = mpfr_custom_get_size(prec);
+		std::vector<mp_limb_t> limbs((num_bytes + sizeof(mp_limb_t) - 1)/sizeof(mp_limb_t));
+
+		long exponent = 0;
+		if (kind==MPFR_REGULAR_KIND || kind==-MPFR_REGULAR_KIND)
+		{
+			ar & exponent;
+			ar.load_binary(limbs.data(), num_bytes);
+		}
+
+		// view the limbs as an mpfr, and copy it into r
+		mpfr_t loaded;
+		mpfr_custom_init(limbs.data(), prec);
+		mpfr_custom_init_set(loaded, kind, exponent, prec, limbs.data());
+
+		mpfr_set_prec(r.data(), prec);
+		mpfr_set(r.data(), loaded, MPFR_RNDN);
+	}
+
+	/**
+	 Load a mpfr_float type from a boost archive.
+	 */
+	template <typename Archive>
+	void load(Archive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, unsigned /*version*/)
+	{
+		load(ar, r, std::integral_constant<bool, bertini::IsBinaryArchive<Archive>::value>());
+	}
 	
 
 	/**
@@ -192,48 +335,91 @@ using boost::multiprecision::max; //3 options: ./configure --disable-expression_
 namespace bertini
 {
 	/**
-	Generate a random integer number between -10^digits and 10^digits
+	Generate a random integer number between -10^digits and 10^digits, from the generator of the calling thread.
 	*/
 	template <unsigned long digits = 50>
 	inline
 	mpz_int RandomInt()
 	{
 		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return ui(mt);
+	    uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+	    return ui(RandomEngine());
 	}
 	
 	
 	/**
-	Generate a random rational number with numerator and denomenator between -10^digits and 10^digits
+	Generate a random rational number with numerator and denomenator between -10^digits and 10^digits, from the generator of the calling thread.
 	*/
 	template <unsigned long digits = 50>
 	mpq_rational RandomRat()
 	{
    		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return mpq_rational(ui(mt),ui(mt));
+	    uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+	    auto numerator = ui(RandomEngine());
+	    return mpq_rational(numerator,ui(RandomEngine()));
+	}
+
+
+	/**
+	\brief Set a number to a random one uniform in [0,1), with as many random bits as its precision, from the generator of the calling thread.
+
+	The bits are written straight into the limbs of the significand, and shifted up past any leading zeros, so the cost is that of drawing them.
+	*/
+	inline void RandomMantissa(mpfr_float & a)
+	{
+		auto x = a.backend().data();
+		const mpfr_prec_t bits = mpfr_get_prec(x);
+		const mpfr_prec_t num_limbs = (bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+		auto limbs = static_cast<mp_limb_t*>(mpfr_custom_get_significand(x));
+
+		auto& engine = RandomEngine();
+		for (mpfr_prec_t ii = 0; ii < num_limbs; ++ii)
+			limbs[ii] = static_cast<mp_limb_t>(GMP_NUMB_BITS > 32 ? engine.Bits64() : engine());
+
+		// the bits below the precision must be zero
+		const auto unused = num_limbs*GMP_NUMB_BITS - bits;
+		limbs[0] &= ~((mp_limb_t(1) << unused) - 1);
+
+		mpfr_prec_t top = num_limbs;
+		while (top > 0 && limbs[top-1]==0)
+			--top;
+		if (top==0) // all zero, with probability 2^-bits
+		{
+			mpfr_set_zero(x, 1);
+			return;
+		}
+
+		// normalize, so the most significant bit is set
+		const mpfr_prec_t zero_limbs = num_limbs - top;
+		int zero_bits = 0;
+		while (!(limbs[top-1] & (mp_limb_t(1) << (GMP_NUMB_BITS-1-zero_bits))))
+			++zero_bits;
+		if (zero_bits > 0)
+			mpn_lshift(limbs, limbs, top, zero_bits);
+		if (zero_limbs > 0)
+		{
+			for (mpfr_prec_t ii = top; ii-- > 0;)
+				limbs[ii+zero_limbs] = limbs[ii];
+			for (mpfr_prec_t ii = 0; ii < zero_limbs; ++ii)
+				limbs[ii] = 0;
+		}
+
+		mpfr_custom_init_set(x, MPFR_REGULAR_KIND, -(zero_limbs*GMP_NUMB_BITS + zero_bits), bits, limbs);
 	}
 
 
 	/**
-	 Produce a random number with at length_in_digits non-zero digits.
+	 Produce a random number in [0,1), with length_in_digits digits.
 	 
 	 \tparam length_in_digits The length of the desired random number
 	 */
 	template <unsigned int length_in_digits>
 	mpfr_float RandomMp()
 	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
-
-		return ur(gen);
+		mpfr_float a;
+		a.precision(length_in_digits);
+		RandomMantissa(a);
+		return a;
 	}
 	
 	/**
@@ -244,14 +430,8 @@ namespace bertini
 	template <unsigned int length_in_digits>
 	void RandomMp(mpfr_float & a)
 	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
-
-		a = ur(gen);
+		a.precision(length_in_digits);
+		RandomMantissa(a);
 	}
 
 	/**
@@ -187,18 +187,14 @@ namespace bertini
 	{
 		using std::abs;
 		using std::sqrt;
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		std::complex<double> returnme(2*RandomDouble()-1, 2*RandomDouble()-1);
 		return returnme / sqrt( abs(returnme));
 	}
 
 	template <> inline
 	std::complex<double> RandomUnit<std::complex<double> >()
 	{
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		std::complex<double> returnme(2*RandomDouble()-1, 2*RandomDouble()-1);
 		return returnme / abs(returnme);
 	}
 
@@ -0,0 +1,125 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parameter_homotopy.hpp
+
+\brief Defines ParameterHomotopy, for moving the solutions of a parametrized family of systems from one point of its parameter space to others.
+*/
+
+
+#ifndef BERTINI_PARAMETER_HOMOTOPY_HPP
+#define BERTINI_PARAMETER_HOMOTOPY_HPP
+
+#include "bertini2/system.hpp"
+
+
+namespace bertini
+{
+	/**
+	\brief The homotopy of coefficient-parameter continuation, from a start point of the parameter space of a family of systems, at which the solutions are known, to a target point.
+
+	The family is a System whose explicit parameters, see System::AddParameter, are the parameters.  The homotopy is the family with each parameter replaced by a point of the path
+	\f[ p(t) = \tau(t) p_0 + (1-\tau(t)) p_1, \qquad \tau(t) = \frac{\gamma t}{1 + (\gamma-1) t}, \f]
+	from the start parameters \f$p_0\f$ at \f$t=1\f$ to the target parameters \f$p_1\f$ at \f$t=0\f$.  With the gamma trick, \f$\gamma\f$ is a random complex number, so for all but finitely many choices of it the path misses the parameters at which the family is singular.  Without it, \f$\tau(t)=t\f$ and the path is the straight segment, which is as good for real parameters only if nothing singular lies on it.
+
+	Only as many paths are tracked as the family has solutions at generic parameters, the solutions at the start parameters, rather than a start system's worth.
+
+	The target parameters are the implicit parameters of the homotopy, variables read at every evaluation, so moving the target is setting their values, and the homotopy, its derivatives and its compiled form are made once for a whole sweep of targets.  See ParallelSolver::SetImplicitParameters.
+
+	\code
+	Fn a = std::make_shared<node::Function>("a");
+	a->SetRoot(std::make_shared<node::Float>("1"));
+	family.AddParameter(a);
+	family.AddFunction(x*x - a);
+	// ...
+
+	ParameterHomotopy H(family, start_parameters);
+	ParallelSolver<AMPTracker> solver(H, start_solutions, setup);
+	for (auto const& p : targets)
+	{
+		solver.SetImplicitParameters(p);
+		solver.Solve();
+		// ...
+	}
+	\endcode
+	*/
+	class ParameterHomotopy
+	{
+	public:
+
+		/**
+		\brief Make the homotopy for a family, from the parameters at which its solutions are known.
+
+		The family is copied, and left as it is.
+
+		\throws std::runtime_error, if the family has no parameters, has a path variable or implicit parameters already, or the number of start parameters is not the number of its parameters.
+
+		\param family The parametrized family of systems.
+		\param start_parameters The values of the parameters at which the solutions are known, in the order the parameters were added.
+		\param use_gamma_trick Whether to bend the path through parameter space by a random complex gamma, see the class description.
+		*/
+		ParameterHomotopy(System const& family, Vec<mpfr> const& start_parameters, bool use_gamma_trick = true);
+
+
+		/**
+		\brief The homotopy, with path variable \f$t\f$, and the target parameters as its implicit parameters.
+		*/
+		System const& Homotopy() const
+		{
+			return homotopy_;
+		}
+
+		/**
+		\brief The values of the parameters at which the solutions are known, at \f$t=1\f$.
+		*/
+		Vec<mpfr> const& StartParameters() const
+		{
+			return start_parameters_;
+		}
+
+		/**
+		\brief The gamma bending the path through parameter space, 1 if not using the gamma trick.
+		*/
+		mpfr Gamma() const
+		{
+			return gamma_->Eval<mpfr>();
+		}
+
+		size_t NumParameters() const
+		{
+			return static_cast<size_t>(start_parameters_.size());
+		}
+
+	private:
+
+		System homotopy_; ///< The family, with its parameters moved along the path.
+		Vec<mpfr> start_parameters_;
+		std::shared_ptr<node::Rational> gamma_;
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -37,12 +37,16 @@
 #include "bertini2/num_traits.hpp"
 #include "bertini2/eigen_extensions.hpp"
 
+#include <map>
+#include <stdexcept>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 
 #include <boost/serialization/vector.hpp>
 
@@ -224,6 +228,59 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief Construct a coordinate patch on a space, on which one coordinate of each variable group is 1.
+
+		\param sizes The sizes of the variable groups, including homogenizing variables if present.
+		\param indices For each variable group, the index within it of the coordinate set to 1.
+		*/
+		static Patch Coordinate(std::vector<unsigned> const& sizes, std::vector<unsigned> const& indices)
+		{
+			using bertini::Precision;
+
+			if (indices.size()!=sizes.size())
+				throw std::runtime_error("making coordinate patch, but the number of indices doesn't match the number of variable groups");
+
+			Patch p;
+
+			p.variable_group_sizes_ = sizes;
+
+			std::vector<Vec<mpfr> >& coefficients_mpfr = std::get<std::vector<Vec<mpfr> > >(p.coefficients_working_);
+			std::vector<Vec<dbl> >& coefficients_dbl = std::get<std::vector<Vec<dbl> > >(p.coefficients_working_);
+
+			p.coefficients_highest_precision_.resize(sizes.size());
+			coefficients_mpfr.resize(sizes.size());
+			coefficients_dbl.resize(sizes.size());
+
+			for (size_t ii=0; ii<sizes.size(); ++ii)
+			{
+				if (indices[ii] >= sizes[ii])
+					throw std::runtime_error("making coordinate patch, but an index is out of range of its variable group");
+
+				p.coefficients_highest_precision_[ii].resize(sizes[ii]);
+				for (unsigned jj=0; jj<sizes[ii]; ++jj)
+					p.coefficients_highest_precision_[ii](jj) = mpfr(jj==indices[ii] ? 1 : 0);
+				Precision(p.coefficients_highest_precision_[ii], MaxPrecisionAllowed()); // exact, at any precision
+
+				coefficients_mpfr[ii] = p.coefficients_highest_precision_[ii];
+				Precision(coefficients_mpfr[ii],DefaultPrecision());
+
+				coefficients_dbl[ii] = Vec<dbl>::Zero(sizes[ii]);
+				coefficients_dbl[ii](indices[ii]) = dbl(1);
+			}
+
+			return p;
+		}
+
+
+		/**
+		\brief Get the sizes of the variable groups on which the patch is defined, in order.
+		*/
+		std::vector<unsigned> const& VariableGroupSizes() const
+		{
+			return variable_group_sizes_;
+		}
+
 		/**
 		\brief Get the current precision of the patch.
 
@@ -239,26 +296,36 @@ namespace bertini {
 	
 		Copies the patch coefficients into correct precision for subsequent precision.
 
+		The coefficients at each precision used are kept, so that going back to a precision swaps them back in, rather than converting them again.  Tracking typically bounces between a few precisions many times over.
+
 		\param new_precision The precision to change to.
 		*/
 		void Precision(unsigned new_precision) const
 		{
 			using bertini::Precision;
+			if (new_precision==precision_)
+				return;
+
 			std::vector<Vec<mpfr> >& coefficients_mpfr = std::get<std::vector<Vec<mpfr> > >(coefficients_working_);
 
-			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+			coefficients_mpfr.swap(coefficients_by_precision_[precision_]);
+
+			auto stored = coefficients_by_precision_.find(new_precision);
+			if (stored!=coefficients_by_precision_.end() && stored->second.size()==NumVariableGroups())
+				coefficients_mpfr.swap(stored->second);
+			else
 			{
-				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
+				coefficients_mpfr.resize(NumVariableGroups());
+				for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
 				{
-					if (new_precision>precision_)
+					coefficients_mpfr[ii].resize(variable_group_sizes_[ii]);
+					for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
 					{
 						coefficients_mpfr[ii](jj) = coefficients_highest_precision_[ii](jj);
 						coefficients_mpfr[ii](jj).precision(new_precision);
-					}
-					else
-						coefficients_mpfr[ii](jj).precision(new_precision);
 
-					assert(Precision(coefficients_mpfr[ii](jj))==new_precision);
+						assert(Precision(coefficients_mpfr[ii](jj))==new_precision);
+					}
 				}
 			}
 			
@@ -300,15 +367,49 @@ namespace bertini {
 			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
 			{
 				T& value = function_values(ii+offset);
-				value = T(-1);
+				SetMinusOne(value);
 				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
 				{	
-					value += x(counter)*coefficients[ii](jj);
+					AddProduct(value, x(counter), coefficients[ii](jj));
 					counter++;
 				}
 			}
 		}
 
+
+		/**
+		\brief Evaluate the patch at many points at once, in place.
+
+		\param function_values The matrix to populate, one column per point.  Must have at least as many rows as the number of variable groups, and the patch values go into the last rows, as in EvalInPlace.
+		\param X The points at which to evaluate, one per column.
+		*/
+		template<typename Derived, typename T>
+		void EvalBatchInPlace(Eigen::MatrixBase<Derived> & function_values, Mat<T> const& X) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar,T>::value,"scalar types must match");
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(function_values.rows()>=NumVariableGroups() && "function values must have at least as many rows as the number of variable groups");
+			assert(function_values.cols()==X.cols() && "function values must have one column per point");
+			assert(X.rows()==NumVariables() && "points must have as many rows as the patch has variables");
+			#endif
+
+			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+
+			unsigned offset(function_values.rows() - NumVariableGroups());
+			for (unsigned kk = 0; kk < X.cols(); ++kk)
+			{
+				unsigned counter(0);
+				for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+				{
+					T& value = function_values(ii+offset,kk);
+					SetMinusOne(value);
+					for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
+						AddProduct(value, X(counter++,kk), coefficients[ii](jj));
+				}
+			}
+		}
+
 		/**
 		\brief Evaluate the patch at a point.
 
@@ -348,6 +449,26 @@ namespace bertini {
 			       );
 			#endif
 			
+			JacobianInPlace(jacobian);
+		}
+
+		/**
+		\brief Evaluate the Jacobian matrix, in place, without a point.
+
+		The patch is linear, so its Jacobian is its coefficients, the same at every point.  Only the last NumVariableGroups() rows are written, so when evaluating repeatedly into the same matrix, the rest of it may change without the patch rows being written again.
+
+		\param jacobian Matrix to populate with the Jacobian.  Must be large enough (NumVariableGroups x NumVariables).
+		*/
+		template<typename Derived>
+		void JacobianInPlace(Eigen::MatrixBase<Derived> & jacobian) const
+		{
+			using T = typename Derived::Scalar;
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(jacobian.rows()>=NumVariableGroups() && "input jacobian must have at least as many rows as variable groups");
+			assert(jacobian.cols()==NumVariables() && "input jacobian must have as many columns as the patch has variables");
+			#endif
+
 			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
 
 			unsigned offset(jacobian.rows() - NumVariableGroups()); // by precondition this number is at least 0.  the precondition is ensured by the public wrapper
@@ -392,15 +513,23 @@ namespace bertini {
 					   );
 			#endif
 
-			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+			RescaleColumns(x);
+		}
 
-			unsigned starting_index_counter(0);
-			for (unsigned ii=0; ii<NumVariableGroups(); ii++)
-			{
-				auto subvec = x.segment(starting_index_counter,variable_group_sizes_[ii]);
-				subvec /= subvec.transpose() * coefficients[ii];
-				starting_index_counter += variable_group_sizes_[ii];
-			}
+		/**
+		\brief Rescale many points at once, so that each satisfies the patch equations.
+
+		\param X The points to rescale, one per column.  None may be zero on any variable group.
+		\tparam T The number type.
+		*/
+		template<typename T>
+		void RescalePointsToFitInPlace(Mat<T> & X) const
+		{
+			#ifndef BERTINI_DISABLE_ASSERTS
+				assert(X.rows() == NumVariables() && "input points for rescaling to fit a patch must have same length as total number of variables being patched, in all variable groups.");
+			#endif
+
+			RescaleColumns(X);
 		}
 
 		/**
@@ -485,6 +614,52 @@ namespace bertini {
 
 	private:
 
+		// scale each column of X so that the patch is zero there, accumulating the patch value in place.
+		template<typename Derived>
+		void RescaleColumns(Eigen::MatrixBase<Derived> & X) const
+		{
+			using T = typename Derived::Scalar;
+			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+
+			T scale;
+			for (unsigned kk = 0; kk < X.cols(); ++kk)
+			{
+				unsigned starting_index_counter(0);
+				for (unsigned ii=0; ii<NumVariableGroups(); ii++)
+				{
+					scale = T(0);
+					for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
+						AddProduct(scale, X(starting_index_counter+jj,kk), coefficients[ii](jj));
+					for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
+						X(starting_index_counter+jj,kk) /= scale;
+					starting_index_counter += variable_group_sizes_[ii];
+				}
+			}
+		}
+
+		static void SetMinusOne(dbl & value)
+		{
+			value = dbl(-1);
+		}
+
+		// set in place, rather than assigning a temporary
+		static void SetMinusOne(mpfr & value)
+		{
+			value.real(-1);
+			value.imag(0);
+		}
+
+		static void AddProduct(dbl & value, dbl const& a, dbl const& b)
+		{
+			value += a*b;
+		}
+
+		// fused, with no complex temporary for the product
+		static void AddProduct(mpfr & value, mpfr const& a, mpfr const& b)
+		{
+			value.MultiplyAdd(a,b);
+		}
+
 		/////////////////
 		//
 		//    Data members
@@ -499,12 +674,15 @@ namespace bertini {
 
 		mutable unsigned precision_; ///< the current working precision of the patch.
 
+		mutable std::map< unsigned, std::vector< Vec< mpfr > > > coefficients_by_precision_; ///< the mpfr coefficients at precisions other than the current, kept to be swapped back in.  not serialized.
+
 		// add serialization support through boost.
 
 		friend class boost::serialization::access;
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
+			coefficients_by_precision_.clear();
 			ar & precision_;
 
 			ar & coefficients_highest_precision_;
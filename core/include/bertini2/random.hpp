@@ -0,0 +1,240 @@
+//This file is part of Bertini 2.
+//
+//random.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file random.hpp
+
+\brief The random number generator of each thread, from which all of Bertini2's random numbers are drawn, and streams of it for reproducing them.
+*/
+
+#ifndef BERTINI_RANDOM_HPP
+#define BERTINI_RANDOM_HPP
+
+#include "bertini2/config.h"
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace bertini {
+
+	/**
+	\brief The counter-based random number generator Philox4x32-10, of Salmon, Moraes, Dror, and Shaw, Parallel random numbers: as easy as 1, 2, 3, SC11.
+
+	The nth block of four outputs is ten rounds of a bijection of the counter n, keyed by the seed, so there are \f$2^{64}\f$ independent streams for each seed, chosen by the high half of the counter, each of \f$2^{64}\f$ blocks.  The state is a few words, and making a generator costs nothing, so one can be made for every path.
+
+	A UniformRandomBitGenerator, of 32 bit numbers, for use with the distributions of the standard library and Boost.
+	*/
+	class Philox4x32
+	{
+	public:
+		using result_type = std::uint32_t;
+
+		static constexpr result_type min()
+		{
+			return 0;
+		}
+
+		static constexpr result_type max()
+		{
+			return 0xffffffffu;
+		}
+
+		explicit
+		Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0)
+		{
+			Seed(seed, stream);
+		}
+
+		/**
+		\brief Start a stream of a seed from its beginning.
+		*/
+		void Seed(std::uint64_t seed, std::uint64_t stream = 0)
+		{
+			key_[0] = static_cast<std::uint32_t>(seed);
+			key_[1] = static_cast<std::uint32_t>(seed >> 32);
+			counter_[0] = 0;
+			counter_[1] = 0;
+			counter_[2] = static_cast<std::uint32_t>(stream);
+			counter_[3] = static_cast<std::uint32_t>(stream >> 32);
+			index_ = 4;
+		}
+
+		result_type operator()()
+		{
+			if (index_==4)
+			{
+				Block(buffer_, counter_, key_);
+				if (++counter_[0]==0)
+					++counter_[1];
+				index_ = 0;
+			}
+			return buffer_[index_++];
+		}
+
+		/**
+		\brief The next 64 random bits.
+		*/
+		std::uint64_t Bits64()
+		{
+			std::uint64_t low = (*this)();
+			return low | (std::uint64_t((*this)()) << 32);
+		}
+
+		/**
+		\brief One block of four outputs, for a counter and key.
+		*/
+		static void Block(std::uint32_t out[4], std::uint32_t const counter[4], std::uint32_t const key[2])
+		{
+			std::uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+			std::uint32_t k[2] = {key[0], key[1]};
+			for (unsigned round = 0; round < 10; ++round)
+			{
+				std::uint64_t p0 = std::uint64_t(0xD2511F53u) * c[0];
+				std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * c[2];
+				std::uint32_t next[4] = {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0], static_cast<std::uint32_t>(p1),
+				                         static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1], static_cast<std::uint32_t>(p0)};
+				c[0] = next[0]; c[1] = next[1]; c[2] = next[2]; c[3] = next[3];
+				k[0] += 0x9E3779B9u;
+				k[1] += 0xBB67AE85u;
+			}
+			out[0] = c[0]; out[1] = c[1]; out[2] = c[2]; out[3] = c[3];
+		}
+
+	private:
+		std::uint32_t key_[2];
+		std::uint32_t counter_[4]; ///< The block, in the low two words, and the stream, in the high two.
+		std::uint32_t buffer_[4];
+		unsigned index_; ///< The next output of buffer_ to give.  4 when it is used up.
+	};
+
+
+	namespace detail {
+		inline std::atomic<std::uint64_t>& RandomSeedStorage()
+		{
+			static std::atomic<std::uint64_t> seed(0);
+			return seed;
+		}
+
+		// the number of threads' streams handed out since the start, or the last RandomSeed
+		inline std::atomic<std::uint64_t>& NumThreadStreams()
+		{
+			static std::atomic<std::uint64_t> num_threads(0);
+			return num_threads;
+		}
+
+		// threads not in a ScopedRandomStream each draw from their own stream, counting down from the last
+		inline std::uint64_t NextThreadStream()
+		{
+			return ~NumThreadStreams()++;
+		}
+	}
+
+
+	/**
+	\brief The random number generator of the calling thread.
+
+	Every random number of Bertini2, of any type, is drawn from it, so that runs with the same seed, RandomSeed, draw the same numbers.  Work which must get the same numbers however it is scheduled over threads, such as tracking a path, draws from a stream of its own, see ScopedRandomStream.  Otherwise each thread draws from a stream chosen in the order the threads first draw, with one shared generator if thread_local is disabled.
+	*/
+	inline Philox4x32& RandomEngine()
+	{
+	#ifdef USE_THREAD_LOCAL
+		thread_local Philox4x32 engine(detail::RandomSeedStorage(), detail::NextThreadStream());
+	#else
+		static Philox4x32 engine(detail::RandomSeedStorage(), detail::NextThreadStream());
+	#endif
+		return engine;
+	}
+
+	/**
+	\brief Get the seed of the random numbers of the process.  0 unless set.
+	*/
+	inline std::uint64_t RandomSeed()
+	{
+		return detail::RandomSeedStorage();
+	}
+
+	/**
+	\brief Set the seed of the random numbers of the process, restarting the generator of the calling thread.  Threads which have drawn already keep their seed, so set it before starting any.
+
+	The calling thread takes the first of the threads' streams, and the threads which first draw after take the next in turn, so the numbers drawn after seeding are the same however many times it was seeded before.  The outputs the generator has buffered are dropped.  No distribution is kept between draws, in double or multiple precision, so none holds state from before.
+	*/
+	inline void RandomSeed(std::uint64_t seed)
+	{
+		auto& engine = RandomEngine(); // first, since a thread's first call takes a stream
+		detail::RandomSeedStorage() = seed;
+		detail::NumThreadStreams() = 0;
+		engine.Seed(seed, detail::NextThreadStream());
+	}
+
+
+	/**
+	\brief Draws the random numbers of the calling thread from a stream of the seed, RandomSeed, for its lifetime, restoring the generator as it was when destroyed.
+
+	The random numbers drawn inside are the same in every run with the same seed, whichever thread runs it, and whatever ran before.  The parallel solver tracks each path in the stream of its index.
+
+	\code
+	{
+		ScopedRandomStream stream(path_index);
+		// random numbers drawn here depend only on the seed and path_index
+	}
+	\endcode
+	*/
+	class ScopedRandomStream
+	{
+	public:
+		/**
+		\param stream The stream.  Those from \f$2^{63}\f$ up are used by the threads, and should be avoided.
+		*/
+		explicit
+		ScopedRandomStream(std::uint64_t stream) : previous_(RandomEngine())
+		{
+			RandomEngine().Seed(RandomSeed(), stream);
+		}
+
+		~ScopedRandomStream()
+		{
+			RandomEngine() = previous_;
+		}
+
+		ScopedRandomStream(ScopedRandomStream const&) = delete;
+		ScopedRandomStream& operator=(ScopedRandomStream const&) = delete;
+
+	private:
+		Philox4x32 previous_;
+	};
+
+
+	/**
+	\brief A random double, uniform in [0,1), from the 53 high bits of 64 drawn from the generator of the calling thread.
+	*/
+	inline double RandomDouble()
+	{
+		return (RandomEngine().Bits64() >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+} // re: namespace bertini
+
+#endif
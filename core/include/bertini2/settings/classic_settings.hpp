@@ -0,0 +1,448 @@
+//This file is part of Bertini 2.
+//
+//classic_settings.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//classic_settings.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with classic_settings.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file classic_settings.hpp
+
+\brief Contains ClassicSettings, the settings of a Classic CONFIG section as typed values, checked once as they are set by a ClassicSettingsBuilder, and ParseClassicConfig, reading a CONFIG section into them in one pass.
+
+Unlike settings::parsing::ConfigToIni, there is no INI text and no Boost.Program_options between the section and the values, and the config structs of a solve are made from the values directly, so that programs making many solves with different settings pay for checking them once.
+
+\code
+auto s = settings::ClassicSettingsBuilder().MPType(2).Predictor(5).TrackTolBeforeEG(1e-6).Build();
+tracker.Setup(s.PredictorSetting(), s.TrackTolBeforeEG(), s.PathTruncationThreshold(), s.StepSettings<double>(), s.NewtonSettings());
+\endcode
+*/
+
+#ifndef BERTINI_SETTINGS_CLASSIC_SETTINGS_HPP
+#define BERTINI_SETTINGS_CLASSIC_SETTINGS_HPP
+
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+
+namespace bertini{
+
+	namespace settings{
+
+		namespace config = tracking::config;
+
+		/**
+		\brief The settings of a Classic CONFIG section, with the names and defaults of Classic, as checked by the ClassicSettingsBuilder making them.
+
+		The config structs of a solve come from the member functions below.
+		*/
+		class ClassicSettings
+		{
+		public:
+
+			int TrackType() const {return tracktype_;}
+			int MPType() const {return mptype_;} ///< 0 double, 1 fixed multiple, 2 adaptive.
+			unsigned Precision() const {return precision_;} ///< In bits, for mptype 1.
+			int Predictor() const {return odepredictor_;} ///< The Classic code, from -1 to 8.
+			int EndgameNum() const {return endgamenum_;} ///< 1 power series, 2 Cauchy.
+			double TrackTolBeforeEG() const {return tracktolbeforeeg_;}
+			double TrackTolDuringEG() const {return tracktolduringeg_;}
+			double FinalTol() const {return finaltol_;}
+			double MaxStepSize() const {return maxstepsize_;}
+			unsigned StepsForIncrease() const {return stepsforincrease_;}
+			unsigned MaxNumberSteps() const {return maxnumbersteps_;}
+			unsigned MaxNewtonIts() const {return maxnewtonits_;}
+			double EndgameBoundary() const {return endgamebdry_;}
+			double PathTruncationThreshold() const {return securitymaxnorm_;}
+			unsigned AMPMaxPrec() const {return ampmaxprec_;} ///< In bits, as in Classic.
+			int AMPSafetyDigits1() const {return ampsafetydigits1_;}
+			int AMPSafetyDigits2() const {return ampsafetydigits2_;}
+			double CoeffBound() const {return coeffbound_;} ///< 0 if computed from the system.
+			double DegreeBound() const {return degreebound_;} ///< 0 if computed from the system.
+			unsigned SharpenDigits() const {return sharpendigits_;}
+
+			/**
+			\brief The precision in digits for mptype 1, from the bits of Classic.
+			*/
+			unsigned PrecisionDigits() const
+			{
+				return static_cast<unsigned>(std::ceil(precision_ * std::log10(2.0)));
+			}
+
+			config::Predictor PredictorSetting() const
+			{
+				static const config::Predictor predictors[] = {config::Predictor::Constant, config::Predictor::Euler, config::Predictor::Heun, config::Predictor::RK4, config::Predictor::HeunEuler, config::Predictor::RKNorsett34, config::Predictor::RKF45, config::Predictor::RKCashKarp45, config::Predictor::RKDormandPrince56, config::Predictor::RKVerner67};
+				return predictors[odepredictor_+1];
+			}
+
+			template<typename RealT>
+			config::Stepping<RealT> StepSettings() const
+			{
+				config::Stepping<RealT> stepping;
+				stepping.max_step_size = RealT(maxstepsize_);
+				stepping.initial_step_size = RealT(maxstepsize_);
+				stepping.consecutive_successful_steps_before_stepsize_increase = stepsforincrease_;
+				stepping.max_num_steps = maxnumbersteps_;
+				return stepping;
+			}
+
+			config::Newton NewtonSettings() const
+			{
+				config::Newton newton;
+				newton.max_num_newton_iterations = maxnewtonits_;
+				newton.min_num_newton_iterations = std::min(newton.min_num_newton_iterations, maxnewtonits_);
+				return newton;
+			}
+
+			template<typename RealT>
+			config::Tolerances<RealT> ToleranceSettings() const
+			{
+				config::Tolerances<RealT> tolerances;
+				tolerances.newton_before_endgame = RealT(tracktolbeforeeg_);
+				tolerances.newton_during_endgame = RealT(tracktolduringeg_);
+				tolerances.final_tolerance = RealT(finaltol_);
+				tolerances.final_tolerance_times_final_tolerance_multiplier = tolerances.final_tolerance * tolerances.final_tolerance_multiplier;
+				tolerances.path_truncation_threshold = RealT(securitymaxnorm_);
+				return tolerances;
+			}
+
+			/**
+			\brief The adaptive precision settings for a system, the bounds not set here computed from it as by config::AMPConfigFrom.
+			*/
+			config::AdaptiveMultiplePrecisionConfig AMPSettings(System const& sys) const
+			{
+				auto amp = config::AMPConfigFrom(sys);
+				amp.maximum_precision = static_cast<unsigned>(std::ceil(ampmaxprec_ * std::log10(2.0)));
+				amp.safety_digits_1 = ampsafetydigits1_;
+				amp.safety_digits_2 = ampsafetydigits2_;
+				if (coeffbound_ > 0)
+					amp.coefficient_bound = mpfr_float(coeffbound_);
+				if (degreebound_ > 0)
+					amp.degree_bound = mpfr_float(degreebound_);
+				amp.SetPhiPsiFromBounds();
+				return amp;
+			}
+
+		private:
+
+			friend class ClassicSettingsBuilder;
+
+			int tracktype_ = 0;
+			int mptype_ = 2;
+			unsigned precision_ = 96;
+			int odepredictor_ = 5;
+			int endgamenum_ = 1;
+			double tracktolbeforeeg_ = 1e-5;
+			double tracktolduringeg_ = 1e-6;
+			double finaltol_ = 1e-11;
+			double maxstepsize_ = 0.1;
+			unsigned stepsforincrease_ = 5;
+			unsigned maxnumbersteps_ = 10000;
+			unsigned maxnewtonits_ = 2;
+			double endgamebdry_ = 0.1;
+			double securitymaxnorm_ = 1e5;
+			unsigned ampmaxprec_ = 1024;
+			int ampsafetydigits1_ = 1;
+			int ampsafetydigits2_ = 1;
+			double coeffbound_ = 0;
+			double degreebound_ = 0;
+			unsigned sharpendigits_ = 0;
+		};
+
+
+
+		/**
+		\brief Makes ClassicSettings, checking each setting as it is set, and throwing std::invalid_argument for one out of range.
+
+		The settings not set keep the defaults of Classic.
+		*/
+		class ClassicSettingsBuilder
+		{
+		public:
+
+			ClassicSettingsBuilder& TrackType(int v)
+			{
+				Check(v==0, "only tracktype 0, finding the isolated solutions, is supported");
+				s_.tracktype_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& MPType(int v)
+			{
+				Check(v >= 0 && v <= 2, "mptype must be 0, 1, or 2");
+				s_.mptype_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& Precision(unsigned v)
+			{
+				Check(v > 0, "precision must be positive");
+				s_.precision_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& Predictor(int v)
+			{
+				Check(v >= -1 && v <= 8, "odepredictor must be from -1 to 8");
+				s_.odepredictor_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& EndgameNum(int v)
+			{
+				Check(v==1 || v==2, "endgamenum must be 1, power series, or 2, Cauchy");
+				s_.endgamenum_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& TrackTolBeforeEG(double v)
+			{
+				Check(v > 0, "tracktolbeforeeg must be positive");
+				s_.tracktolbeforeeg_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& TrackTolDuringEG(double v)
+			{
+				Check(v > 0, "tracktolduringeg must be positive");
+				s_.tracktolduringeg_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& FinalTol(double v)
+			{
+				Check(v > 0, "finaltol must be positive");
+				s_.finaltol_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& MaxStepSize(double v)
+			{
+				Check(v > 0, "maxstepsize must be positive");
+				s_.maxstepsize_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& StepsForIncrease(unsigned v)
+			{
+				Check(v > 0, "stepsforincrease must be positive");
+				s_.stepsforincrease_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& MaxNumberSteps(unsigned v)
+			{
+				Check(v > 0, "maxnumbersteps must be positive");
+				s_.maxnumbersteps_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& MaxNewtonIts(unsigned v)
+			{
+				Check(v > 0, "maxnewtonits must be positive");
+				s_.maxnewtonits_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& EndgameBoundary(double v)
+			{
+				Check(v > 0 && v < 1, "endgamebdry must be between 0 and 1");
+				s_.endgamebdry_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& PathTruncationThreshold(double v)
+			{
+				Check(v > 0, "securitymaxnorm must be positive");
+				s_.securitymaxnorm_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& AMPMaxPrec(unsigned v)
+			{
+				Check(v >= 64, "ampmaxprec must be at least 64 bits");
+				s_.ampmaxprec_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& AMPSafetyDigits1(int v)
+			{
+				s_.ampsafetydigits1_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& AMPSafetyDigits2(int v)
+			{
+				s_.ampsafetydigits2_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& CoeffBound(double v)
+			{
+				Check(v >= 0, "coeffbound must not be negative");
+				s_.coeffbound_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& DegreeBound(double v)
+			{
+				Check(v >= 0, "degreebound must not be negative");
+				s_.degreebound_ = v; return *this;
+			}
+
+			ClassicSettingsBuilder& SharpenDigits(unsigned v)
+			{
+				s_.sharpendigits_ = v; return *this;
+			}
+
+			/**
+			\brief Set a setting by its Classic name, in lower case, from the text of its value.  Settings Classic has but not used here are ignored.
+
+			\return Whether the name is of a setting used here.
+			*/
+			bool Set(std::string const& name, std::string const& value)
+			{
+				if (name=="tracktype") TrackType(ToInt(name, value));
+				else if (name=="mptype") MPType(ToInt(name, value));
+				else if (name=="precision") Precision(ToUnsigned(name, value));
+				else if (name=="odepredictor") Predictor(ToInt(name, value));
+				else if (name=="endgamenum") EndgameNum(ToInt(name, value));
+				else if (name=="tracktolbeforeeg") TrackTolBeforeEG(ToDouble(name, value));
+				else if (name=="tracktolduringeg") TrackTolDuringEG(ToDouble(name, value));
+				else if (name=="finaltol") FinalTol(ToDouble(name, value));
+				else if (name=="maxstepsize") MaxStepSize(ToDouble(name, value));
+				else if (name=="stepsforincrease") StepsForIncrease(ToUnsigned(name, value));
+				else if (name=="maxnumbersteps") MaxNumberSteps(ToUnsigned(name, value));
+				else if (name=="maxnewtonits") MaxNewtonIts(ToUnsigned(name, value));
+				else if (name=="endgamebdry") EndgameBoundary(ToDouble(name, value));
+				else if (name=="securitymaxnorm") PathTruncationThreshold(ToDouble(name, value));
+				else if (name=="ampmaxprec") AMPMaxPrec(ToUnsigned(name, value));
+				else if (name=="ampsafetydigits1") AMPSafetyDigits1(ToInt(name, value));
+				else if (name=="ampsafetydigits2") AMPSafetyDigits2(ToInt(name, value));
+				else if (name=="coeffbound") CoeffBound(ToDouble(name, value));
+				else if (name=="degreebound") DegreeBound(ToDouble(name, value));
+				else if (name=="sharpendigits") SharpenDigits(ToUnsigned(name, value));
+				else
+					return false;
+				return true;
+			}
+
+			ClassicSettings const& Build() const
+			{
+				return s_;
+			}
+
+		private:
+
+			static void Check(bool ok, char const* message)
+			{
+				if (!ok)
+					throw std::invalid_argument(message);
+			}
+
+			static double ToDouble(std::string const& name, std::string const& value)
+			{
+				char* end;
+				errno = 0;
+				double v = std::strtod(value.c_str(), &end);
+				if (value.empty() || *end!='\0' || errno==ERANGE)
+					throw std::invalid_argument("the value '" + value + "' of " + name + " is not a number");
+				return v;
+			}
+
+			static long ToLong(std::string const& name, std::string const& value)
+			{
+				char* end;
+				errno = 0;
+				long v = std::strtol(value.c_str(), &end, 10);
+				if (value.empty() || *end!='\0' || errno==ERANGE)
+					throw std::invalid_argument("the value '" + value + "' of " + name + " is not an integer");
+				return v;
+			}
+
+			static int ToInt(std::string const& name, std::string const& value)
+			{
+				return static_cast<int>(ToLong(name, value));
+			}
+
+			static unsigned ToUnsigned(std::string const& name, std::string const& value)
+			{
+				long v = ToLong(name, value);
+				if (v < 0)
+					throw std::invalid_argument(name + " must not be negative");
+				return static_cast<unsigned>(v);
+			}
+
+			ClassicSettings s_;
+		};
+
+
+
+		/**
+		\brief Read the settings of a Classic CONFIG section in one pass, without the INI text and Boost.Program_options of ConfigToIni.
+
+		Settings are `name: value;`, with names in any case, and comments from % to the end of the line.  The words CONFIG and END, and settings not used here, are skipped.  A setting ending its line may omit its semicolon.
+
+		\throws std::invalid_argument for a value which is not a number, or is out of range for its setting.
+		*/
+		inline ClassicSettings ParseClassicConfig(std::string const& config)
+		{
+			ClassicSettingsBuilder builder;
+
+			auto iter = config.begin();
+			const auto end = config.end();
+			auto skip_space = [&iter, &end]
+				{
+					while (iter!=end)
+					{
+						if (*iter=='%')
+							iter = std::find(iter, end, '\n');
+						else if (std::isspace(static_cast<unsigned char>(*iter)))
+							++iter;
+						else
+							break;
+					}
+				};
+
+			std::string name, value;
+			while (skip_space(), iter!=end)
+			{
+				name.clear();
+				while (iter!=end && (std::isalnum(static_cast<unsigned char>(*iter)) || *iter=='_'))
+					name.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*iter++))));
+
+				skip_space();
+				if (iter==end || *iter!=':')
+				{
+					// a bare word such as CONFIG or END, or stray punctuation
+					if (name.empty() && iter!=end)
+						++iter;
+					continue;
+				}
+				++iter;
+
+				value.clear();
+				while (iter!=end && *iter!=';' && *iter!='\n' && *iter!='%')
+					value.push_back(*iter++);
+				if (iter!=end && *iter==';')
+					++iter;
+				value.erase(value.find_last_not_of(" \t\r") + 1);
+				value.erase(0, value.find_first_not_of(" \t"));
+
+				builder.Set(name, value);
+			}
+
+			return builder.Build();
+		}
+
+	} // re: namespace settings
+} // re: namespace bertini
+
+#endif
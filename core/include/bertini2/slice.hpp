@@ -170,6 +170,38 @@ namespace bertini {
 			return sliced_vars_.size();
 		}
 
+		/**
+		\brief Get the coefficients of the slice, at the highest precision, one row per dimension sliced.
+		*/
+		Mat<mpfr> const& Coefficients() const
+		{
+			return coefficients_highest_precision_;
+		}
+
+		/**
+		\brief Get the constants of the slice, at the highest precision, one per dimension sliced.  Unused if the slice is homogeneous.
+		*/
+		Vec<mpfr> const& Constants() const
+		{
+			return constants_highest_precision_;
+		}
+
+		/**
+		\brief Whether the slice is homogeneous, so has no constants.
+		*/
+		bool IsHomogeneous() const
+		{
+			return is_homogeneous_;
+		}
+
+		/**
+		\brief Get the variables sliced.
+		*/
+		VariableGroup const& Variables() const
+		{
+			return sliced_vars_;
+		}
+
 
 	private:
 
@@ -197,16 +229,13 @@ namespace bertini {
 					for (unsigned jj(0); jj<mindim; ++jj)
 						gen(s.coefficients_highest_precision_(ii,jj), MaxPrecisionAllowed());
 
-				auto prev_precision = DefaultPrecision();
-				DefaultPrecision(MaxPrecisionAllowed());
+				ScopedPrecision highest(MaxPrecisionAllowed());
 
 				auto QR_factorization = Eigen::HouseholderQR<Mat<mpfr> >(s.coefficients_highest_precision_);
 				s.coefficients_highest_precision_ = QR_factorization.householderQ()*Mat<mpfr>::Identity(maxdim, mindim);
 				
 				if (need_transpose)
 					s.coefficients_highest_precision_.transposeInPlace();
-
-				DefaultPrecision(prev_precision);
 			}
 			else
 			{
@@ -279,6 +308,7 @@ namespace bertini {
 	};
 
 
+	inline
 	std::ostream& operator<<(std::ostream& out, LinearSlice const& s)
 	{
 		out << "linear slice on " << s.NumVariables() << " variables:\n";
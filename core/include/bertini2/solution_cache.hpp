@@ -0,0 +1,299 @@
+//This file is part of Bertini 2.
+//
+//solution_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solution_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solution_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file solution_cache.hpp
+
+\brief Provides SolutionCache, an in-memory cache of the solutions of a parametrized family of systems at points of its parameter space.
+*/
+
+#ifndef BERTINI_SOLUTION_CACHE_HPP
+#define BERTINI_SOLUTION_CACHE_HPP
+
+#include "bertini2/system.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace bertini {
+
+	/**
+	\brief An in-memory cache of the solutions of parametrized families of systems, by family and parameter values, for programs solving the same families over and over, such as services.
+
+	A family is keyed by its System::StructuralHash, taken once, of the family as made, since the values its explicit parameters are made with are part of its structure.  Parameter values are looked up exactly by Find, or by the closest cached values of the same family by Nearest, whose solutions start a ParameterHomotopy to the values wanted, a short solve rather than a full one.
+
+	\code
+	SolutionCache<mpfr> cache(10000);
+	const auto model = family.StructuralHash();
+
+	auto hit = cache.Find(model, p);
+	if (!hit)
+	{
+		std::vector<Vec<mpfr>> solutions;
+		if (auto near = cache.Nearest(model, p))
+		{
+			ParameterHomotopy H(family, near->parameters);
+			ParallelSolver<AMPTracker> solver(H, near->solutions, setup);
+			solver.SetImplicitParameters(p);
+			solver.Solve();
+			// ... solutions from solver.Results()
+		}
+		else
+		{
+			// ... a full solve
+		}
+		cache.Insert(model, p, solutions);
+	}
+	\endcode
+
+	Safe to use from many threads at once.  The entries returned are shared, not copied, and stay valid after they leave the cache.
+
+	\tparam CT The complex type of the parameter values and solutions.
+	*/
+	template<typename CT>
+	class SolutionCache
+	{
+	public:
+
+		/**
+		\brief The solutions of a family at some parameter values.
+		*/
+		struct Entry
+		{
+			std::size_t model; ///< The key of the family, its System::StructuralHash.
+			Vec<CT> parameters;
+			std::vector<Vec<CT>> solutions;
+		};
+
+		using EntryPtr = std::shared_ptr<const Entry>;
+
+
+		/**
+		\param capacity The most entries kept, over all families, the least recently found of them dropped to make room.  0 for no limit.
+		*/
+		explicit SolutionCache(size_t capacity = 0) : capacity_(capacity)
+		{}
+
+		/**
+		\brief Keep the solutions of a family at parameter values, replacing any kept for exactly those values.
+		*/
+		void Insert(std::size_t model, Vec<CT> const& parameters, std::vector<Vec<CT>> solutions)
+		{
+			auto entry = std::make_shared<const Entry>(Entry{model, parameters, std::move(solutions)});
+			const auto h = Hash(parameters);
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto& stored = models_[model];
+			auto range = stored.equal_range(h);
+			for (auto iter = range.first; iter!=range.second; ++iter)
+				if (SameValues(iter->second.entry->parameters, parameters))
+				{
+					iter->second = Stored{entry, ++clock_};
+					return;
+				}
+
+			if (capacity_ > 0 && size_ >= capacity_)
+				DropLeastRecent();
+			models_[model].emplace(h, Stored{entry, ++clock_});
+			++size_;
+		}
+
+		/**
+		\brief The entry for exactly these parameter values of a family, or null.
+		*/
+		EntryPtr Find(std::size_t model, Vec<CT> const& parameters) const
+		{
+			const auto h = Hash(parameters);
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto m = models_.find(model);
+			if (m!=models_.end())
+			{
+				auto range = m->second.equal_range(h);
+				for (auto iter = range.first; iter!=range.second; ++iter)
+					if (SameValues(iter->second.entry->parameters, parameters))
+					{
+						iter->second.last_used = ++clock_;
+						++num_exact_hits_;
+						return iter->second.entry;
+					}
+			}
+			++num_misses_;
+			return nullptr;
+		}
+
+		/**
+		\brief The entry of a family whose parameter values are closest to these, in the 2-norm, or null if it has none within max_distance.
+
+		Compares against every entry of the family, which is fast next to any solve for caches of thousands of entries.  An exact match is the closest.
+		*/
+		EntryPtr Nearest(std::size_t model, Vec<CT> const& parameters, double max_distance = std::numeric_limits<double>::infinity()) const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto m = models_.find(model);
+			if (m!=models_.end())
+			{
+				Stored const* best = nullptr;
+				double best_distance = max_distance;
+				for (auto const& s : m->second)
+				{
+					auto const& p = s.second.entry->parameters;
+					if (p.size()!=parameters.size())
+						continue;
+					const double d = static_cast<double>((p - parameters).norm());
+					if (d <= best_distance)
+					{
+						best = &s.second;
+						best_distance = d;
+					}
+				}
+				if (best)
+				{
+					best->last_used = ++clock_;
+					++num_nearest_hits_;
+					return best->entry;
+				}
+			}
+			++num_misses_;
+			return nullptr;
+		}
+
+		size_t Size() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return size_;
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			models_.clear();
+			size_ = 0;
+		}
+
+		/**
+		\brief The lookups by Find which found an entry.
+		*/
+		size_t NumExactHits() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return num_exact_hits_;
+		}
+
+		/**
+		\brief The lookups by Nearest which found an entry.
+		*/
+		size_t NumNearestHits() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return num_nearest_hits_;
+		}
+
+		/**
+		\brief The lookups by Find or Nearest which found nothing.
+		*/
+		size_t NumMisses() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return num_misses_;
+		}
+
+		/**
+		\brief A hash of parameter values, of their values rounded to double.  Values equal in double but not exactly are told apart by comparing them.
+		*/
+		static std::size_t Hash(Vec<CT> const& parameters)
+		{
+			using std::real;
+			using std::imag;
+			auto combine = [](std::size_t & seed, std::size_t h)
+				{
+					seed ^= h + 0x9e3779b9 + (seed<<6) + (seed>>2);
+				};
+
+			std::size_t h = std::hash<Eigen::Index>()(parameters.size());
+			for (Eigen::Index ii = 0; ii < parameters.size(); ++ii)
+			{
+				combine(h, std::hash<double>()(static_cast<double>(real(parameters(ii)))));
+				combine(h, std::hash<double>()(static_cast<double>(imag(parameters(ii)))));
+			}
+			return h;
+		}
+
+	private:
+
+		struct Stored
+		{
+			EntryPtr entry;
+			mutable std::uint64_t last_used; ///< The clock at insertion or the last lookup finding it.
+		};
+
+		static bool SameValues(Vec<CT> const& a, Vec<CT> const& b)
+		{
+			if (a.size()!=b.size())
+				return false;
+			for (Eigen::Index ii = 0; ii < a.size(); ++ii)
+				if (!(a(ii)==b(ii)))
+					return false;
+			return true;
+		}
+
+		void DropLeastRecent()
+		{
+			std::unordered_multimap<std::size_t, Stored>* oldest_model = nullptr;
+			typename std::unordered_multimap<std::size_t, Stored>::iterator oldest;
+			for (auto& m : models_)
+				for (auto iter = m.second.begin(); iter!=m.second.end(); ++iter)
+					if (!oldest_model || iter->second.last_used < oldest->second.last_used)
+					{
+						oldest_model = &m.second;
+						oldest = iter;
+					}
+
+			if (oldest_model)
+			{
+				oldest_model->erase(oldest);
+				--size_;
+			}
+		}
+
+		size_t capacity_;
+		size_t size_ = 0;
+		std::unordered_map<std::size_t, std::unordered_multimap<std::size_t, Stored>> models_; ///< By family, then by hash of the parameter values.
+
+		mutable std::mutex mutex_; ///< Guards the rest.
+		mutable std::uint64_t clock_ = 0;
+		mutable size_t num_exact_hits_ = 0;
+		mutable size_t num_nearest_hits_ = 0;
+		mutable size_t num_misses_ = 0;
+	};
+
+} // re: namespace bertini
+
+#endif
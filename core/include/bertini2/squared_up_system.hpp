@@ -0,0 +1,223 @@
+//This file is part of Bertini 2.
+//
+//squared_up_system.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//squared_up_system.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with squared_up_system.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file squared_up_system.hpp
+
+\brief Defines SquaredUpSystem, the random combinations of the functions of an overdetermined system, evaluated as a matrix product.
+*/
+
+
+#ifndef BERTINI_SQUARED_UP_SYSTEM_HPP
+#define BERTINI_SQUARED_UP_SYSTEM_HPP
+
+#include "bertini2/system.hpp"
+
+
+namespace bertini
+{
+	/**
+	\brief The first \f$k\f$ functions of a system, each plus a random combination of the rest, \f$g = f_{1..k} + R f_{k+1..m}\f$.
+
+	Its solutions include those of the system, and its components of dimension \f$n-k\f$ are the system's, or not on it at all, so it squares up an overdetermined system, or randomizes one down to a given codimension.
+
+	Building \f$g\f$ as trees makes each of its \f$k\f$ functions a sum over the \f$m-k\f$ functions after them, whose derivatives are differentiated and walked again for every one of the \f$k\f$.  Here the \f$m\f$ functions of the system and their Jacobian are evaluated once, and combined by the \f$k \times (m-k)\f$ matrix \f$R\f$, a small dense product in double or multiple precision.  The entries of \f$R\f$ are random rationals, exact, so that evaluation in multiple precision at any precision is of the same system.  AsSystem makes the same combinations as trees, for the trackers, which evaluate Systems.
+
+	\code
+	SquaredUpSystem g(overdetermined, overdetermined.NumVariables());
+	Vec<dbl> values;
+	Mat<dbl> J;
+	g.EvalAndJacobianInPlace(values, J, x);
+	\endcode
+
+	Not safe to evaluate from several threads at once.  Give each its own copy.
+	*/
+	class SquaredUpSystem
+	{
+	public:
+
+		/**
+		\brief Combine the functions of a system down to k of them, with random coefficients.
+
+		The system is copied, and left as it is.
+
+		\throws std::runtime_error, if k is zero or more than the number of functions, or the system has a path variable.
+
+		\param sys The system.  Its patch, if any, is not part of the combination.
+		\param k The number of functions of the combination.
+		*/
+		SquaredUpSystem(System const& sys, unsigned k);
+
+
+		size_t NumFunctions() const
+		{
+			return num_functions_;
+		}
+
+		size_t NumVariables() const
+		{
+			return original_.NumVariables();
+		}
+
+		/**
+		\brief Change the precision of the system combined, as System::precision.  The matrix follows the default precision.
+		*/
+		void precision(unsigned new_precision) const
+		{
+			original_.precision(new_precision);
+		}
+
+		unsigned precision() const
+		{
+			return original_.precision();
+		}
+
+		/**
+		\brief The system combined.
+		*/
+		System const& Original() const
+		{
+			return original_;
+		}
+
+		/**
+		\brief The matrix \f$R\f$ of the combinations, at the current default precision.
+		*/
+		Mat<mpfr> const& Randomization() const
+		{
+			return std::get<Mat<mpfr> >(RandomizationAtPrecision(mpfr()));
+		}
+
+
+		/**
+		\brief The combinations as a System of trees, each function of the system plus the sums of the others times the entries of \f$R\f$.  For tracking.
+		*/
+		System AsSystem() const;
+
+
+		/**
+		\brief Evaluate the combinations at a point.
+
+		\param[out] values The values, resized to NumFunctions.
+		\param x The point.
+		*/
+		template<typename T>
+		void EvalInPlace(Vec<T> & values, Vec<T> const& x) const
+		{
+			auto& f = std::get<Vec<T> >(function_values_);
+			f.resize(original_.NumTotalFunctions());
+			original_.EvalInPlace(f, x);
+			Combine(values, f);
+		}
+
+		/**
+		\brief Evaluate the Jacobian of the combinations at a point, NumFunctions by NumVariables.
+		*/
+		template<typename T>
+		void JacobianInPlace(Mat<T> & J, Vec<T> const& x) const
+		{
+			auto& Jf = std::get<Mat<T> >(jacobian_);
+			Jf.resize(original_.NumTotalFunctions(), original_.NumVariables());
+			original_.JacobianInPlace(Jf, x);
+			CombineRows(J, Jf);
+		}
+
+		/**
+		\brief Evaluate the combinations and their Jacobian at a point, setting the point in the system once.
+		*/
+		template<typename T>
+		void EvalAndJacobianInPlace(Vec<T> & values, Mat<T> & J, Vec<T> const& x) const
+		{
+			auto& f = std::get<Vec<T> >(function_values_);
+			auto& Jf = std::get<Mat<T> >(jacobian_);
+			f.resize(original_.NumTotalFunctions());
+			Jf.resize(original_.NumTotalFunctions(), original_.NumVariables());
+			original_.EvalInPlace(f, x);
+			original_.JacobianInPlace(Jf);
+			Combine(values, f);
+			CombineRows(J, Jf);
+		}
+
+		template<typename T>
+		Vec<T> Eval(Vec<T> const& x) const
+		{
+			Vec<T> values;
+			EvalInPlace(values, x);
+			return values;
+		}
+
+		template<typename T>
+		Mat<T> Jacobian(Vec<T> const& x) const
+		{
+			Mat<T> J;
+			JacobianInPlace(J, x);
+			return J;
+		}
+
+	private:
+
+		template<typename T>
+		void Combine(Vec<T> & values, Vec<T> const& f) const
+		{
+			auto const& R = std::get<Mat<T> >(RandomizationAtPrecision(T()));
+			const auto rest = original_.NumFunctions() - num_functions_;
+			values = f.head(num_functions_);
+			if (rest > 0)
+				values.noalias() += R * f.segment(num_functions_, rest);
+		}
+
+		template<typename T>
+		void CombineRows(Mat<T> & J, Mat<T> const& Jf) const
+		{
+			auto const& R = std::get<Mat<T> >(RandomizationAtPrecision(T()));
+			const auto rest = original_.NumFunctions() - num_functions_;
+			J = Jf.topRows(num_functions_);
+			if (rest > 0)
+				J.noalias() += R * Jf.middleRows(num_functions_, rest);
+		}
+
+		/**
+		The matrix in double precision, or in multiple precision converted from the rationals again if the default precision has changed since last.
+		*/
+		std::tuple<Mat<dbl>, Mat<mpfr> > const& RandomizationAtPrecision(dbl) const
+		{
+			return randomization_;
+		}
+
+		std::tuple<Mat<dbl>, Mat<mpfr> > const& RandomizationAtPrecision(mpfr) const;
+
+		System original_; ///< A copy of the system combined.
+		size_t num_functions_; ///< k.
+		std::vector<std::shared_ptr<node::Rational> > coefficients_; ///< The entries of R, by rows.
+
+		mutable std::tuple<Mat<dbl>, Mat<mpfr> > randomization_; ///< R, in each precision.
+		mutable unsigned randomization_precision_ = 0; ///< The precision of R in multiple precision.
+		mutable std::tuple<Vec<dbl>, Vec<mpfr> > function_values_;
+		mutable std::tuple<Mat<dbl>, Mat<mpfr> > jacobian_;
+	};
+
+} // namespace bertini
+
+
+#endif
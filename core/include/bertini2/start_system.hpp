@@ -34,12 +34,61 @@
 
 #include "bertini2/system.hpp"
 #include "bertini2/limbo.hpp"
+#include "bertini2/detail/mixed_cells.hpp"
+
+#include <boost/serialization/utility.hpp>
 
 
 namespace bertini 
 {
 	namespace start_system{
 
+		template<typename T>
+		class TotalDegreeStartPoints;
+
+
+		/**
+		\brief The functions of a start system, evaluated in closed form rather than through their trees.
+
+		For start systems whose functions are simple enough to evaluate directly, such as the \f$x_i^{d_i} - r_i\f$ of TotalDegree, whose Jacobian is diagonal.  A StraightLineHomotopy evaluates its start system through this, when the start system provides one, see StartSystem::ClosedForm.  The values and Jacobians are of the functions only, not of the patch.
+		*/
+		class ClosedFormStart
+		{
+		public:
+
+			virtual ~ClosedFormStart() = default;
+
+			/**
+			\brief Evaluate the start functions at a point.
+
+			\param[out] f The values, in its first NumFunctions entries, which must exist.
+			\param x The point, at the precision to evaluate at.
+			*/
+			template<typename T>
+			void EvalInPlace(Vec<T> & f, Vec<T> const& x) const
+			{
+				Eval(f, x);
+			}
+
+			/**
+			\brief Evaluate the Jacobian of the start functions at a point.
+
+			\param[out] J The Jacobian, in its first NumFunctions rows, which must exist.
+			\param x The point, at the precision to evaluate at.
+			*/
+			template<typename T>
+			void JacobianInPlace(Mat<T> & J, Vec<T> const& x) const
+			{
+				Jacobian(J, x);
+			}
+
+		private:
+			virtual void Eval(Vec<dbl> & f, Vec<dbl> const& x) const = 0;
+			virtual void Eval(Vec<mpfr> & f, Vec<mpfr> const& x) const = 0;
+			virtual void Jacobian(Mat<dbl> & J, Vec<dbl> const& x) const = 0;
+			virtual void Jacobian(Mat<mpfr> & J, Vec<mpfr> const& x) const = 0;
+		};
+
 		/**
 		\brief Abstract base class for other start systems.
 
@@ -61,6 +110,17 @@ namespace bertini
 				return GenerateStartPoint(T(),index);
 			}
 
+
+			/**
+			\brief The functions of the start system in closed form, or null if they have none, and are evaluated through their trees.
+
+			Made from the start system as it is, and not changed by changes to it after.
+			*/
+			virtual std::shared_ptr<const ClosedFormStart> ClosedForm() const
+			{
+				return nullptr;
+			}
+
 			virtual ~StartSystem() = default;
 			
 		private:
@@ -131,12 +191,40 @@ namespace bertini
 			*/
 			mpz_int NumStartPoints() const override;
 
+			/**
+			\brief The functions \f$x_i^{d_i} - r_i\f$, or \f$x_i^{d_i} - r_i h^{d_i}\f$ if homogenized, in closed form, computing each power once for the value and the diagonal Jacobian.
+
+			Null if the variables are not those of the one group and its homogenizing variable.
+			*/
+			std::shared_ptr<const ClosedFormStart> ClosedForm() const override;
+
+			/**
+			\brief Walk the start points with indices in [begin, end), in increasing order.
+
+			Cheaper than calling StartPoint for each index.  See TotalDegreeStartPoints.
+
+			\param begin The index of the first start point.
+			\param end One past the index of the last start point.  Clamped to NumStartPoints.
+			*/
+			template<typename T>
+			TotalDegreeStartPoints<T> StartPoints(mpz_int const& begin, mpz_int const& end) const;
+
 			TotalDegree& operator*=(Nd const& n);
 
 			TotalDegree& operator+=(System const& sys) = delete;
 			
 		private:
 
+			/**
+			The kth of the d_ii values of variable ii at the start points, a d_ii-th root of the random value.
+			*/
+			dbl StartCoordinate(dbl, size_t ii, mpz_int const& k) const;
+
+			/**
+			The kth of the d_ii values of variable ii at the start points, in current default precision.
+			*/
+			mpfr StartCoordinate(mpfr, size_t ii, mpz_int const& k) const;
+
 			/**
 			Get the ith start point, in double precision.
 
@@ -155,6 +243,9 @@ namespace bertini
 			std::vector<std::shared_ptr<node::Rational> > random_values_; ///< stores the random values for the start functions.  x^d-r, where r is stored in this vector.
 			std::vector<mpz_int> degrees_; ///< stores the degrees of the functions.
 
+			template<typename T>
+			friend class TotalDegreeStartPoints;
+
 
 			friend class boost::serialization::access;
 
@@ -166,6 +257,528 @@ namespace bertini
 			}
 
 		};
+
+
+
+		/**
+		\brief Walks the start points of a TotalDegree start system with indices in a range, in increasing order.
+
+		TotalDegree::StartPoint converts each index into subscripts with mpz divisions, and computes the roots of unity and the roots of the random values afresh.  This computes the \f$d_i\f$ values of each coordinate once, and steps the subscripts like an odometer, the first fastest, so that most steps write a single coordinate.  The points are the same as those of StartPoint, including the rescaling to the patch, if there is one.
+
+		To share the start points out among threads or processes, give each the range from Chunk.
+
+		\code
+		auto range = TotalDegreeStartPoints<dbl>::Chunk(TD.NumStartPoints(), rank, num_ranks);
+		for (auto points = TD.StartPoints<dbl>(range.first, range.second); !points.Done(); points.Next())
+			Track(points.Index(), points.Current());
+		\endcode
+		*/
+		template<typename T>
+		class TotalDegreeStartPoints
+		{
+		public:
+
+			/**
+			\param start_system The start system.  Must outlive this.
+			\param begin The index of the first start point.
+			\param end One past the index of the last start point.  Clamped to the number of start points.
+			*/
+			TotalDegreeStartPoints(TotalDegree const& start_system, mpz_int const& begin, mpz_int const& end) : start_system_(start_system), index_(begin), end_(end)
+			{
+				if (end_ > start_system.NumStartPoints())
+					end_ = start_system.NumStartPoints();
+
+				const auto num_coordinates = start_system.NumNaturalVariables();
+				offset_ = start_system.IsPatched() ? 1 : 0;
+
+				roots_.resize(num_coordinates);
+				for (size_t ii = 0; ii < num_coordinates; ++ii)
+				{
+					auto degree = static_cast<unsigned>(start_system.degrees_[ii]);
+					roots_[ii].reserve(degree);
+					for (unsigned k = 0; k < degree; ++k)
+						roots_[ii].push_back(start_system.StartCoordinate(T(), ii, mpz_int(k)));
+				}
+
+				point_.resize(start_system.NumVariables());
+				if (offset_)
+					point_(0) = T(1);
+
+				subscripts_.assign(num_coordinates, 0);
+				if (Done())
+					return;
+
+				auto subscripts = IndexToSubscript(index_, start_system.degrees_);
+				for (size_t ii = 0; ii < num_coordinates; ++ii)
+				{
+					subscripts_[ii] = static_cast<unsigned>(subscripts[ii]);
+					point_(ii+offset_) = roots_[ii][subscripts_[ii]];
+				}
+				Finish();
+			}
+
+			/**
+			Whether the range is exhausted.  Current is meaningless if so.
+			*/
+			bool Done() const
+			{
+				return index_ >= end_;
+			}
+
+			/**
+			The index of the current start point, as for TotalDegree::StartPoint.
+			*/
+			mpz_int const& Index() const
+			{
+				return index_;
+			}
+
+			/**
+			The current start point.
+			*/
+			Vec<T> const& Current() const
+			{
+				return current_;
+			}
+
+			/**
+			Step to the start point with the next index.
+			*/
+			void Next()
+			{
+				++index_;
+				if (Done())
+					return;
+
+				for (size_t ii = 0; ii < subscripts_.size(); ++ii)
+				{
+					if (++subscripts_[ii] < roots_[ii].size())
+					{
+						point_(ii+offset_) = roots_[ii][subscripts_[ii]];
+						break;
+					}
+					subscripts_[ii] = 0;
+					point_(ii+offset_) = roots_[ii][0];
+				}
+				Finish();
+			}
+
+			/**
+			\brief Split the indices [0, num_points) into num_chunks contiguous ranges of sizes differing by at most one.
+
+			\param num_points The number of start points, as from TotalDegree::NumStartPoints.
+			\param chunk Which of the ranges, from 0.
+			\param num_chunks The number of ranges, such as the number of threads or processes.
+			\return The beginning and end of the range.
+			*/
+			static std::pair<mpz_int, mpz_int> Chunk(mpz_int const& num_points, unsigned chunk, unsigned num_chunks)
+			{
+				if (num_chunks==0 || chunk >= num_chunks)
+					throw std::out_of_range("in TotalDegreeStartPoints::Chunk, chunk must be less than the number of chunks");
+
+				return std::make_pair(mpz_int(num_points*chunk/num_chunks), mpz_int(num_points*(chunk+1)/num_chunks));
+			}
+
+		private:
+
+			void Finish()
+			{
+				current_ = point_;
+				if (offset_)
+					start_system_.RescalePointToFitPatchInPlace(current_);
+			}
+
+			TotalDegree const& start_system_;
+			mpz_int index_; ///< The index of the current start point.
+			mpz_int end_; ///< One past the index of the last start point.
+			unsigned offset_; ///< 1 if the homogenizing variable comes first, else 0.
+			std::vector< std::vector<T> > roots_; ///< The possible values of each coordinate.
+			std::vector<unsigned> subscripts_; ///< Which of its values each coordinate has.
+			Vec<T> point_; ///< The current start point, before rescaling to the patch.
+			Vec<T> current_; ///< The current start point.
+		};
+
+
+		template<typename T>
+		TotalDegreeStartPoints<T> TotalDegree::StartPoints(mpz_int const& begin, mpz_int const& end) const
+		{
+			return TotalDegreeStartPoints<T>(*this, begin, end);
+		}
+
+
+
+
+		/**
+		\brief StartSystem of products of linear functions, for polynomial systems in several groups of affine variables.
+
+		Each function of the target system has a degree in each variable group, and a support in it, the variables of the group it involves.  The start function with index \f$i\f$ is the product over the groups \f$j\f$ of \f$d_{ij}\f$ random linear functions in the variables of the support of function \f$i\f$ in group \f$j\f$, so has the same multidegree, and no more variables.
+
+		A start point chooses for each function a group and one of its linear factors in that group, such that each group is chosen as many times as it has variables.  Such a choice of groups is an assignment.  The point then solves, in each group, the linear system of the chosen factors.  For random coefficients, that system is regular exactly when the supports of the functions assigned to the group can be matched to its variables, one to one, so the other assignments are discarded.  The number of start points is the sum over the admissible assignments of the products of the chosen degrees.  For systems in several groups, such as bilinear ones, and for sparse ones, whose functions involve few of the variables, this is often far less than the total degree, and every start point is a path saved.
+
+		The admissible assignments are enumerated on construction.  The start points are indexed by assignment, then by the choices of linear factors, the first function's fastest, and each is computed only when asked for, as for TotalDegree.
+		*/
+		class LinearProduct : public StartSystem
+		{
+		public:
+			LinearProduct() = default;
+			virtual ~LinearProduct() = default;
+
+			/**
+			 Constructor for making a linear product start system from a polynomial system, using the supports of its functions.
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, has ungrouped variables, or has any homogeneous variable groups.
+			*/
+			LinearProduct(System const& s) : LinearProduct(s, true)
+			{}
+
+
+			/**
+			Get the number of start points for this start system.  This is the generic root count of the linear product system, at most the multihomogeneous Bezout number of the target system.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the degrees of the target functions in the variable groups, indexed by function, then group.
+			*/
+			std::vector< std::vector<int> > const& MultiDegrees() const
+			{
+				return degrees_;
+			}
+
+
+			/**
+			Get the supports of the target functions in the variable groups, indexed by function, then group.  Each is the positions in the group of the variables involved.
+			*/
+			std::vector< std::vector< std::vector<unsigned> > > const& Supports() const
+			{
+				return supports_;
+			}
+
+
+			/**
+			Get the admissible assignments of the functions to the variable groups.  Each is the group of each function.
+			*/
+			std::vector< std::vector<unsigned> > const& Assignments() const
+			{
+				return assignments_;
+			}
+
+			LinearProduct& operator+=(System const& sys) = delete;
+
+		protected:
+
+			/**
+			\param s The target system.
+			\param use_supports Whether to restrict the linear factors to the supports of the functions.  If not, they involve every variable of their group.
+			*/
+			LinearProduct(System const& s, bool use_supports);
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			template<typename T>
+			Vec<T> GenerateStartPoint(mpz_int index) const;
+
+			/**
+			Find the admissible assignments, and the number of start points before each, recursing over the functions.
+			*/
+			void EnumerateAssignments(std::vector<unsigned> & assignment, std::vector<unsigned> & remaining, mpz_int const& num_points);
+
+			/**
+			Whether the supports of the functions assigned to each group can be matched to its variables.
+			*/
+			bool IsAdmissible(std::vector<unsigned> const& assignment) const;
+
+			std::vector< std::vector<int> > degrees_; ///< The degree of each function in each variable group.
+			std::vector< std::vector< std::vector<unsigned> > > supports_; ///< The positions in each variable group of the variables involved in each function.
+			std::vector< std::vector< std::vector< std::vector< std::shared_ptr<node::Rational> > > > > linear_factors_; ///< The coefficients of the linear factors, indexed by function, group, factor, and then variable of the support, with the constant term last.
+			std::vector< std::vector<unsigned> > assignments_; ///< The admissible assignments of the functions to groups.
+			std::vector<mpz_int> assignment_offsets_; ///< The index of the first start point of each assignment, then the number of start points.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & degrees_;
+				ar & supports_;
+				ar & linear_factors_;
+				ar & assignments_;
+				ar & assignment_offsets_;
+			}
+
+		};
+
+
+
+		/**
+		\brief StartSystem for polynomial systems in several groups of affine variables, with the multihomogeneous Bezout number of start points.
+
+		The LinearProduct start system with linear factors in every variable of their group, regardless of the supports of the functions.  So every assignment is admissible, in which each group takes as many functions as it has variables, each of positive degree in it.
+
+		With one variable group, the start system is a total degree one, though with products of linear functions rather than \f$x_i^{d_i} - r_i\f$.
+		*/
+		class MHomogeneous : public LinearProduct
+		{
+		public:
+			MHomogeneous() = default;
+			virtual ~MHomogeneous() = default;
+
+			/**
+			 Constructor for making a multihomogeneous start system from a polynomial system
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, has ungrouped variables, or has any homogeneous variable groups.
+			*/
+			MHomogeneous(System const& s) : LinearProduct(s, false)
+			{}
+
+		private:
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<LinearProduct>(*this);
+			}
+		};
+
+
+
+		/**
+		\brief StartSystem with the supports of the target system, and the BKK bound of start points, solved by polyhedral homotopies.
+
+		The start functions are \f$g_i(x) = \sum_{a \in A_i} c_{ia} x^a\f$, with random coefficients, where \f$A_i\f$ is the support of target function \f$i\f$, its exponents as expanded into monomials, with the origin added.  By Bernstein's theorem, such a system has as many solutions as the mixed volume of its supports, and with the origin added, this bounds the number of isolated solutions of the target system.  For sparse systems, such as those of chemical reaction networks, the mixed volume is often orders of magnitude below the Bezout numbers.
+
+		The solutions are not known in closed form.  The supports are lifted by random weights \f$w\f$, and each mixed cell of the lifting, with inner normal \f$\alpha\f$, gives a homotopy
+		\f[ h_i(y,t) = \sum_{a \in A_i} c_{ia} y^a t^{\langle a, \alpha \rangle + w_{ia} - \beta_i} \f]
+		with \f$\beta_i\f$ the least of the exponents, so that at \f$t=0\f$ it is the binomial system of the edges of the cell, whose solutions are computed directly, and at \f$t=1\f$ it is the start system.  So this class provides the homotopies and their start points, see CellHomotopy and CellStartPoints.  Tracking them, as by tracking::SolvePolyhedral, gives the start points of this system, which are added with AddStartPoint.  Only then does this have start points.
+
+		\code
+		start_system::Polyhedral G(target);
+		tracking::SolvePolyhedral<AMPTracker>(G, configure);
+		auto homotopy = (1-t)*target + gamma*t*G;
+		\endcode
+		*/
+		class Polyhedral : public StartSystem
+		{
+		public:
+			Polyhedral() = default;
+			virtual ~Polyhedral() = default;
+
+			/**
+			 Constructor for making a polyhedral start system from a polynomial system, computing the mixed cells.
+
+			 \param s The target system.
+			 \param num_threads The number of threads on which to search for mixed cells.
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, is homogenized, or has any homogeneous variable groups.
+			*/
+			Polyhedral(System const& s, unsigned num_threads = 1);
+
+
+			/**
+			Get the number of start points found so far, by tracking the cell homotopies and adding their endpoints.  At most the MixedVolume.
+			*/
+			mpz_int NumStartPoints() const override
+			{
+				return start_points_.size();
+			}
+
+			/**
+			Get the mixed volume of the supports, the number of start points there should be.
+			*/
+			unsigned long MixedVolume() const
+			{
+				return detail::MixedVolume(cells_);
+			}
+
+			/**
+			Get the supports of the start functions, the exponents of their monomials, in the order of Variables().
+			*/
+			std::vector<detail::Support> const& Supports() const
+			{
+				return supports_;
+			}
+
+			/**
+			Get the mixed cells of the lifted supports.
+			*/
+			std::vector<detail::MixedCell> const& Cells() const
+			{
+				return cells_;
+			}
+
+			/**
+			\brief Make the homotopy of a mixed cell, from its binomial system at \f$t=0\f$ to this system at \f$t=1\f$.
+
+			The powers of t are scaled so that the least positive one is 1, which changes the parametrization, but not the endpoints.
+
+			\param cell The index of the mixed cell.
+			\param t The path variable to use.
+			*/
+			System CellHomotopy(unsigned cell, Var const& t) const;
+
+			/**
+			\brief The solutions of the binomial system of a mixed cell, the start points of its homotopy, at \f$t=0\f$.
+
+			There are as many as the volume of the cell.
+			*/
+			template<typename T>
+			std::vector< Vec<T> > CellStartPoints(unsigned cell) const
+			{
+				auto const& c = cells_[cell];
+				std::vector< std::vector<long> > V;
+				std::vector<T> b;
+				for (unsigned ii = 0; ii < c.edges.size(); ++ii)
+				{
+					auto const& p = supports_[ii][c.edges[ii].first];
+					auto const& q = supports_[ii][c.edges[ii].second];
+					V.emplace_back();
+					for (unsigned jj = 0; jj < p.size(); ++jj)
+						V.back().push_back(long(p[jj]) - long(q[jj]));
+					b.push_back(-coefficients_[ii][c.edges[ii].second]->Eval<T>() / coefficients_[ii][c.edges[ii].first]->Eval<T>());
+				}
+				return detail::SolveBinomialSystem(V, b);
+			}
+
+			/**
+			Add a solution of this system, such as the endpoint of a path of a cell homotopy, as the next start point.
+			*/
+			void AddStartPoint(Vec<dbl> const& x);
+
+			/**
+			Add a solution of this system, such as the endpoint of a path of a cell homotopy, as the next start point.
+			*/
+			void AddStartPoint(Vec<mpfr> const& x);
+
+			/**
+			Forget the start points added.
+			*/
+			void ClearStartPoints()
+			{
+				start_points_.clear();
+			}
+
+			Polyhedral& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			std::vector<detail::Support> supports_; ///< The exponents of the monomials of each function.
+			std::vector< std::vector< std::shared_ptr<node::Rational> > > coefficients_; ///< The coefficient of each monomial of each function.
+			std::vector< std::vector<double> > liftings_; ///< The lifting of each monomial of each function.
+			std::vector<detail::MixedCell> cells_; ///< The mixed cells of the lifted supports.
+			std::vector< Vec<mpfr> > start_points_; ///< The solutions added so far.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & supports_;
+				ar & coefficients_;
+				ar & liftings_;
+				ar & cells_;
+				ar & start_points_;
+			}
+
+		};
+
+
+
+		/**
+		\brief A start system given by its functions, and solutions of them found some other way.
+
+		For homotopies assembled from other solves, such as the stages of regeneration, whose start systems are systems already solved.  The functions are those of the system it is made from, and the start points are added with AddStartPoint.
+
+		Note that the homotopy of a solver is \f$(1-t) f + t g\f$, with no gamma, so scale the functions of the start system which differ from those of the target by a random complex number, for the paths to avoid singularities.
+		*/
+		class User : public StartSystem
+		{
+		public:
+			User() = default;
+			virtual ~User() = default;
+
+			/**
+			Make a start system with the functions and variable structure of a system.
+
+			\throws std::runtime_error, if the system has a path variable.
+			*/
+			User(System const& s);
+
+			/**
+			Get the number of start points added.
+			*/
+			mpz_int NumStartPoints() const override
+			{
+				return start_points_.size();
+			}
+
+			/**
+			Add a solution of this system as the next start point.
+			*/
+			void AddStartPoint(Vec<dbl> const& x);
+
+			/**
+			Add a solution of this system as the next start point.
+			*/
+			void AddStartPoint(Vec<mpfr> const& x);
+
+			/**
+			Forget the start points added.
+			*/
+			void ClearStartPoints()
+			{
+				start_points_.clear();
+			}
+
+		private:
+
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			std::vector< Vec<mpfr> > start_points_; ///< The solutions added so far.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & start_points_;
+			}
+
+		};
 	}
 }
 
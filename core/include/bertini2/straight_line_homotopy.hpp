@@ -0,0 +1,205 @@
+//This file is part of Bertini 2.
+//
+//straight_line_homotopy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_homotopy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_homotopy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file straight_line_homotopy.hpp
+
+\brief Defines StraightLineHomotopy, the gamma-trick homotopy from a start system to a target, whose gamma changes without rebuilding it.
+*/
+
+
+#ifndef BERTINI_STRAIGHT_LINE_HOMOTOPY_HPP
+#define BERTINI_STRAIGHT_LINE_HOMOTOPY_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/start_system.hpp"
+
+
+namespace bertini
+{
+	/**
+	\brief The homotopy \f$H(x,t) = (1-t) f(x) + \gamma t g(x)\f$ from a start system \f$g\f$ at \f$t=1\f$ to a target \f$f\f$ at \f$t=0\f$.
+
+	Composing the systems with System::operator+ and System::operator* makes new trees, which are then differentiated and compiled.  Here that is done once: \f$\gamma\f$ is the implicit parameter of the homotopy, a variable read at every evaluation, so choosing another \f$\gamma\f$, for instance to retrack failed paths along a different route, is setting its value, and the homotopy, its derivatives and its compiled form are kept.  See ParallelSolver::SetImplicitParameters.
+
+	The homotopy can also be evaluated from separate evaluations of the target and start systems, combining their values, Jacobians and the time derivative \f$\gamma g - f\f$ with no tree for \f$H\f$ at all.  The rows of the patch, if the systems are patched, are the target's.  A start system with functions in closed form, such as TotalDegree, is evaluated through them, see start_system::StartSystem::ClosedForm, so that only the target's trees are evaluated.
+
+	\code
+	StraightLineHomotopy H(target, TD);
+	ParallelSolver<AMPTracker> solver(H, TD, setup);
+	solver.Solve();
+
+	// another route for the paths
+	Vec<mpfr> gamma(1);
+	gamma << RandomUnit<mpfr>();
+	solver.SetImplicitParameters(gamma);
+	solver.Solve();
+	\endcode
+	*/
+	class StraightLineHomotopy
+	{
+	public:
+
+		/**
+		\brief Make the homotopy between two systems.
+
+		Both systems are copied, and left as they are.
+
+		\throws std::runtime_error, if either system has a path variable or implicit parameters already, or they differ in numbers of variables or functions.
+
+		\param target The system to solve, at \f$t=0\f$.
+		\param start The start system, at \f$t=1\f$.
+		\param use_gamma_trick Whether to start with a random complex \f$\gamma\f$ of modulus one.  Otherwise it is 1.
+		*/
+		StraightLineHomotopy(System const& target, System const& start, bool use_gamma_trick = true);
+
+
+		/**
+		\brief The homotopy as a system, with path variable \f$t\f$, and \f$\gamma\f$ as its one implicit parameter.
+		*/
+		System const& Homotopy() const
+		{
+			return homotopy_;
+		}
+
+		mpfr const& Gamma() const
+		{
+			return std::get<mpfr>(gamma_);
+		}
+
+		/**
+		\brief Change \f$\gamma\f$, in the homotopy and for evaluation from the separate systems.
+
+		Copies of the homotopy made before, such as the threads' copies in a ParallelSolver, are not changed.  Set their implicit parameters instead.
+		*/
+		void SetGamma(mpfr const& gamma);
+
+		/**
+		\brief Change \f$\gamma\f$ to a random complex number of modulus one.
+		*/
+		void RandomizeGamma()
+		{
+			SetGamma(RandomUnit<mpfr>());
+		}
+
+
+		/**
+		\brief Evaluate \f$H(x,t)\f$ from evaluations of the target and start systems.
+
+		\param function_values The values, resized to the number of functions, including the patch.
+		*/
+		template<typename T>
+		void EvalInPlace(Vec<T> & function_values, Vec<T> const& x, T const& t) const
+		{
+			auto& g = std::get<Vec<T> >(start_values_);
+			auto const& gamma = std::get<T>(gamma_);
+
+			function_values.resize(target_.NumTotalFunctions());
+			g.resize(start_.NumTotalFunctions());
+			target_.EvalInPlace(function_values, x);
+			EvalStartInPlace(g, x);
+
+			T one_minus_t = T(1) - t;
+			T gamma_t = gamma * t;
+			for (unsigned ii = 0; ii < target_.NumFunctions(); ++ii)
+				function_values(ii) = one_minus_t * function_values(ii) + gamma_t * g(ii);
+		}
+
+		/**
+		\brief Evaluate the Jacobian of \f$H\f$ with respect to the variables, from the Jacobians of the target and start systems.
+		*/
+		template<typename T>
+		void JacobianInPlace(Mat<T> & J, Vec<T> const& x, T const& t) const
+		{
+			auto& Jg = std::get<Mat<T> >(start_jacobian_);
+			auto const& gamma = std::get<T>(gamma_);
+
+			J.resize(target_.NumTotalFunctions(), target_.NumVariables());
+			Jg.resize(start_.NumTotalFunctions(), start_.NumVariables());
+			target_.JacobianInPlace(J, x);
+			if (start_closed_form_)
+				start_closed_form_->JacobianInPlace(Jg, x);
+			else
+				start_.JacobianInPlace(Jg, x);
+
+			auto num_functions = target_.NumFunctions();
+			J.topRows(num_functions) = (T(1) - t) * J.topRows(num_functions) + (gamma * t) * Jg.topRows(num_functions);
+		}
+
+		/**
+		\brief Evaluate \f$\partial H / \partial t = \gamma g(x) - f(x)\f$, which is zero in the rows of the patch.
+		*/
+		template<typename T>
+		void TimeDerivativeInPlace(Vec<T> & ds_dt, Vec<T> const& x) const
+		{
+			auto& g = std::get<Vec<T> >(start_values_);
+			auto const& gamma = std::get<T>(gamma_);
+
+			ds_dt.resize(target_.NumTotalFunctions());
+			g.resize(start_.NumTotalFunctions());
+			target_.EvalInPlace(ds_dt, x);
+			EvalStartInPlace(g, x);
+
+			auto num_functions = target_.NumFunctions();
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+				ds_dt(ii) = gamma * g(ii) - ds_dt(ii);
+			for (unsigned ii = num_functions; ii < ds_dt.size(); ++ii)
+				ds_dt(ii) = T(0);
+		}
+
+		/**
+		\brief Whether the start system is evaluated through its functions in closed form, rather than its trees.
+		*/
+		bool UsingClosedFormStart() const
+		{
+			return static_cast<bool>(start_closed_form_);
+		}
+
+	private:
+
+		template<typename T>
+		void EvalStartInPlace(Vec<T> & g, Vec<T> const& x) const
+		{
+			if (start_closed_form_)
+				start_closed_form_->EvalInPlace(g, x);
+			else
+				start_.EvalInPlace(g, x);
+		}
+
+		System homotopy_; ///< (1-t) target + gamma t start, made once.
+		std::shared_ptr<node::Variable> gamma_variable_; ///< The implicit parameter of the homotopy.
+
+		System target_; ///< A copy of the target, for evaluating the homotopy without its tree.
+		System start_; ///< A copy of the start system, for evaluating the homotopy without its tree.
+		std::shared_ptr<const start_system::ClosedFormStart> start_closed_form_; ///< The start functions in closed form, if the start system has them.
+
+		std::tuple<dbl, mpfr> gamma_;
+		mutable std::tuple<Vec<dbl>, Vec<mpfr> > start_values_;
+		mutable std::tuple<Mat<dbl>, Mat<mpfr> > start_jacobian_;
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -37,6 +37,8 @@
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -46,12 +48,19 @@
 #include "bertini2/mpfr_complex.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/eigen_extensions.hpp"
+#include <Eigen/Sparse>
 
 
 #include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/straight_line_program.hpp"
+#include "bertini2/function_tree/sparse_polynomials.hpp"
+#include "bertini2/function_tree/common_subexpressions.hpp"
+#include "bertini2/function_tree/native_program.hpp"
+#include "bertini2/function_tree/simplify.hpp"
 #include "bertini2/patch.hpp"
 
 #include "bertini2/limbo.hpp"
+#include "bertini2/memory_usage.hpp"
 
 
 
@@ -79,7 +88,7 @@ namespace bertini {
 		/**
 		\brief The default constructor for a system.
 		*/
-		System() : is_differentiated_(false), have_path_variable_(false), have_ordering_(false), precision_(DefaultPrecision()), is_patched_(false)
+		System() : is_differentiated_(false), have_path_variable_(false), have_ordering_(false), precision_(DefaultPrecision()), is_patched_(false), use_compiled_evaluation_(false), is_compiled_(false), compiled_path_variable_register_(-1), use_polynomial_evaluation_(false), is_expanded_(false), is_expandable_(false), have_dependencies_(false), have_path_terms_(false), have_precision_nodes_(false), have_bounds_(false), coefficient_bound_evaluations_(0)
 		{}
 
 		/** 
@@ -115,6 +124,15 @@ namespace bertini {
 		*/
 		friend void swap(System & a, System & b);
 
+		/**
+		\brief Make an independent copy of the system, with its own nodes.
+
+		The copy constructor shares the nodes of the functions with the original, so the two cannot be evaluated at the same time, as by different threads.  The clone is a deep copy of all the function trees.  Nodes shared within the original, such as subfunctions and variables, are shared the same way within the clone.
+
+		The copy is made through an in-memory binary archive, which writes multiple precision numbers as their limbs.
+		*/
+		System Clone() const;
+
 		/**
 		Change the precision of the entire system's functions, subfunctions, and all other nodes.
 
@@ -132,9 +150,208 @@ namespace bertini {
 
 		/**
 		 \brief Compute and internally store the symbolic Jacobian of the system.
+
+		 Optional.  Otherwise the derivative tree of each function is made when the tree evaluation of the Jacobian first needs it, one function at a time, and compiled and polynomial evaluation, which differentiate by themselves, never make them.  Differentiating all the functions up front is faster for many functions, being done over several threads, and shares the subexpressions of the derivatives.
+
+		 The derivatives are simplified as they are made, see node::Simplify.  After differentiation, structurally identical subexpressions of the functions and Jacobian entries are merged into shared nodes, so that each is evaluated once per point.  See MergeCommonSubexpressions.
 		*/
 		void Differentiate() const;
 
+		/**
+		\brief Merge structurally identical subexpressions of the functions, and of the Jacobian entries if the system has been differentiated, into shared nodes.
+
+		This is done automatically after parsing and differentiation.  The values of the system are unchanged.
+		*/
+		void MergeCommonSubexpressions() const;
+
+		/**
+		\brief Get the number of distinct nodes in the functions and Jacobian entries, before and after the most recent merging of common subexpressions.
+		*/
+		node::CSEStatistics const& CommonSubexpressionStatistics() const
+		{
+			return cse_statistics_;
+		}
+
+
+		/**
+		\brief A hash of the structure of the system: the names of its variables in order, its path variable, and the structure of its functions, see node::StructuralHasher.
+
+		Systems made from the same model have the same hash, whatever their nodes, so it may key caches shared between systems.  The values of parameters which are implicit, or set at evaluation, do not affect it, but the numbers in the functions do.
+		*/
+		std::size_t StructuralHash() const;
+
+
+		/**
+		\brief An estimate of the memory held by the system, by component.
+
+		The components are
+
+		* function trees -- the nodes of the functions, subfunctions, and parameters, with their stored values at the current precision.
+		* jacobian trees -- the nodes of the derivatives not shared with the functions.  Empty until the system is differentiated.
+		* compiled evaluation -- the straight line program, if compiled evaluation has been used.
+		* polynomial evaluation -- the expanded polynomials, if polynomial evaluation has been used.
+		* workspace -- the variable values, and the bookkeeping for invalidating stored values.
+
+		See memory_usage.hpp for what the estimates include.
+		*/
+		MemoryReport MemoryUsage() const;
+
+
+		/**
+		\brief Lower the functions of the system into a straight line program, for use in compiled evaluation mode.
+
+		Called automatically on first evaluation in compiled mode, and again after the system is modified.  
+
+		\throws std::runtime_error, if the functions contain a node type which cannot be lowered.
+		\see UseCompiledEvaluation
+		*/
+		void Compile() const;
+
+		/**
+		\brief Turn on or off evaluation of the functions through a straight line program, rather than by walking the function trees.
+
+		The results are the same either way.  Compiled mode avoids the virtual call and cache check made at every node of every tree, at the cost of a lowering step after each modification of the system.
+
+		\param use_compiled Whether to use the compiled representation for evaluation.
+		*/
+		void UseCompiledEvaluation(bool use_compiled)
+		{
+			use_compiled_evaluation_ = use_compiled;
+		}
+
+		/**
+		\brief Query whether evaluation uses the compiled representation of the functions.
+		*/
+		bool UsingCompiledEvaluation() const
+		{
+			return use_compiled_evaluation_;
+		}
+
+		/**
+		\brief Turn on or off compiling the straight line program of compiled evaluation to native code, for evaluation in double precision.  See node::NativeProgram.
+
+		Only has effect in compiled mode.  The native code is built when the system is next compiled, so after each modification, and libraries already built for a system of the same structure are reused.  Multiple precision evaluation still interprets the program.  Building throws std::runtime_error if there is no working C++ compiler, or if the cache directory is not private to the user.
+
+		\param use_native Whether to compile to native code.
+		\param cache_directory The directory in which to keep the compiled libraries.
+		*/
+		void UseNativeEvaluation(bool use_native, std::string const& cache_directory = node::NativeProgram::DefaultCacheDirectory())
+		{
+			use_native_evaluation_ = use_native;
+			native_cache_directory_ = cache_directory;
+			is_compiled_ = false;
+		}
+
+		bool UsingNativeEvaluation() const
+		{
+			return use_native_evaluation_;
+		}
+
+		/**
+		\brief Share the compiled evaluation of the functions and their Jacobian among a team of threads, or stop doing so.
+
+		For a system with many functions but few paths to track, so that tracking the paths in parallel leaves cores idle.  Each evaluation computes the subfunctions and other common parts first, split among the threads in order of dependency, then the rest of each function on one thread, and each thread then computes whole rows of the Jacobian.  The results are the same as without the team.
+
+		Only has effect in compiled mode.  The team is not copied with the system, nor serialized, so the copies tracking paths in parallel do not wait for each other.  A team may be shared by systems and linear solvers used one at a time, see tracking::correct::NewtonCorrector::SetThreadTeam.
+
+		\param team The threads, or nullptr to evaluate in the calling thread only.
+		*/
+		void SetEvaluationTeam(std::shared_ptr<detail::ThreadTeam> const& team)
+		{
+			evaluation_team_ = team;
+		}
+
+		std::shared_ptr<detail::ThreadTeam> const& EvaluationTeam() const
+		{
+			return evaluation_team_;
+		}
+
+		/**
+		\brief The straight line program of the functions, compiling the system first if need be.
+
+		For evaluating the system somewhere other than through the System, such as on an accelerator by a BundleBackend.  The inputs of the program are the registers given by CompiledVariableRegisters and CompiledPathVariableRegister, and its outputs are the functions, in order.  Valid until the system is next modified.
+		*/
+		node::StraightLineProgram const& CompiledProgram() const
+		{
+			if (!is_compiled_)
+				Compile();
+			return compiled_functions_;
+		}
+
+		/**
+		\brief The register of the compiled program holding each variable, in the order of the variables.  -1 for a variable which no function depends on.
+		*/
+		std::vector<int> const& CompiledVariableRegisters() const
+		{
+			if (!is_compiled_)
+				Compile();
+			return compiled_variable_registers_;
+		}
+
+		/**
+		\brief The register of the compiled program holding the path variable.  -1 if there is none, or no function depends on it.
+		*/
+		int CompiledPathVariableRegister() const
+		{
+			if (!is_compiled_)
+				Compile();
+			return compiled_path_variable_register_;
+		}
+
+
+		/**
+		\brief Expand the functions into tables of monomials in the variables and path variable, for use in polynomial evaluation.
+
+		Called automatically on first evaluation with polynomial evaluation on, and again after the system is modified.  If a function is not a polynomial, for instance because it contains a transcendental function or a parameter, or it expands to too many terms, the expansion is discarded, and the trees are evaluated instead.
+		*/
+		void ExpandPolynomials() const;
+
+		/**
+		\brief Turn on or off evaluation of polynomial systems from their expansion into monomials.  Off by default.
+
+		When on, and the functions of the system are all polynomials, evaluation uses a table of the monomials of each function, sharing the powers of the variables among all of them, instead of walking the function trees.  The Jacobian and time derivative come from the same table, so the system need not be differentiated at all.  The results agree with walking the trees up to roundoff.  Compiled evaluation, if on, takes priority.
+
+		Expanding costs time and memory up front, which can exceed what it saves for a system of few evaluations or of dense high degree functions, so it is asked for, rather than assumed.  A change of precision rounds the expanded coefficients, and expands again only when raising above the highest precision expanded at.
+
+		\param use_polynomial Whether to use the polynomial expansion for evaluation, when possible.
+		*/
+		void UsePolynomialEvaluation(bool use_polynomial)
+		{
+			use_polynomial_evaluation_ = use_polynomial;
+		}
+
+		/**
+		\brief Query whether evaluation uses the expansion of the functions into monomials.  Expands the functions if needed.
+
+		\return true if polynomial evaluation is on and all the functions are polynomials in the variables and path variable.
+		*/
+		bool UsingPolynomialEvaluation() const
+		{
+			if (!use_polynomial_evaluation_ || use_compiled_evaluation_)
+				return false;
+			if (!is_expanded_)
+				ExpandPolynomials();
+			return is_expandable_;
+		}
+
+
+		/**
+		\brief Turn on or off compensated summation of the sums of the function trees, in double precision.  Off by default.
+
+		Sets node::SumOperator::CompensatedSummation for every sum of this system's functions, and of its derivatives as they are made, so systems tracked side by side may differ.  Functions added afterward follow it once the precision of the system is next set.  Compiled and polynomial evaluation do not walk the trees, and are unaffected.
+
+		\param use Whether to use compensated summation.
+		*/
+		void CompensatedSummation(bool use);
+
+		/**
+		\brief Query whether double precision evaluation of the function trees uses compensated summation.
+		*/
+		bool CompensatedSummation() const
+		{
+			return compensated_summation_;
+		}
+
 
 		
 		
@@ -159,15 +376,32 @@ namespace bertini {
 				throw std::runtime_error(ss.str());
 			}
 
-			// the Reset() function call traverses the entire tree, resetting everything.
-			// TODO: it has the unfortunate side effect of resetting constant functions, too.
-			for (const auto& iter : functions_) 
-				iter->Reset();
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
 
+				CompiledEval<T>();
+				for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+					function_values(ii) = compiled_functions_.Output<T>(ii);
+			}
+			else if (UsingPolynomialEvaluation())
+			{
+				polynomial_functions_.Eval<T>();
+				for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+					function_values(ii) = polynomial_functions_.Output<T>(ii);
+			}
+			else
+			{
+				// the nodes depending on the variables and path variable were invalidated when their values were set, so constant parts of the trees keep their stored values.
+				if (!have_dependencies_)
+					ComputeDependencies();
 
-			unsigned counter(0);
-			for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
-				(*iter)->EvalInPlace<T>(function_values(counter));
+
+				unsigned counter(0);
+				for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
+					(*iter)->EvalInPlace<T>(function_values(counter));
+				}
 			}
 
 			if (IsPatched())
@@ -343,6 +577,156 @@ namespace bertini {
 			EvalInPlace(function_values, variable_values, path_variable_value);
 			return function_values;
 		}
+
+
+
+		/**
+		\brief Evaluate the system at many points at once, in double precision.
+
+		All the points are evaluated in each pass over the compiled representation of the functions, whose values are stored structure-of-arrays so the arithmetic vectorizes.  The compiled representation is used regardless of UsingCompiledEvaluation.  The path variable, if any, takes its current value at every point.  The current variable values of the system are not changed.
+
+		\throws std::runtime_error, if the number of rows of X doesn't match the number of variables, or the functions cannot be compiled.
+		\param X The values of the variables, one column per point, in the order of Variables().
+		\param F The values of the functions, one column per point.  Resized to NumTotalFunctions() by X.cols().
+		*/
+		void EvalBatch(Mat<dbl> const& X, Mat<dbl> & F) const;
+
+		/**
+		\brief Evaluate the system at many points at once, in double precision, provided a path variable is defined for the system.
+
+		Sets the path variable, then evaluates as EvalBatch(X, F).
+
+		\throws std::runtime_error, if a path variable is NOT defined.
+		*/
+		void EvalBatch(Mat<dbl> const& X, dbl const& path_variable_value, Mat<dbl> & F) const;
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system at many points at once, in double precision.
+
+		The batched analogue of Jacobian, computed by one forward and one reverse pass per function over the compiled representation, for all the points together.  See EvalBatch.
+
+		\param X The values of the variables, one column per point, in the order of Variables().
+		\param J The Jacobian matrices, one per point.  Resized to X.cols() matrices of NumTotalFunctions() by NumVariables().
+		*/
+		void JacobianBatch(Mat<dbl> const& X, std::vector< Mat<dbl> > & J) const;
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system at many points at once, in double precision, provided a path variable is defined for the system.
+
+		Sets the path variable, then evaluates as JacobianBatch(X, J).
+
+		\throws std::runtime_error, if a path variable is NOT defined.
+		*/
+		void JacobianBatch(Mat<dbl> const& X, dbl const& path_variable_value, std::vector< Mat<dbl> > & J) const;
+
+		/**
+		\brief Evaluate the system, its Jacobian matrix, and its derivative with respect to the path variable, at many points at once, in double precision.
+
+		Everything a predictor or corrector step needs, from one forward pass and one reverse pass per function over the compiled representation.  See EvalBatch.
+
+		\throws std::runtime_error, if a path variable is NOT defined.
+		\param X The values of the variables, one column per point, in the order of Variables().
+		\param path_variable_value The value of the path variable, shared by all the points.
+		\param F The values of the functions, one column per point.
+		\param J The Jacobian matrices, one per point.
+		\param ds_dt The derivatives with respect to the path variable, one column per point.  Entries for the patches are 0.
+		*/
+		void EvalJacobianAndTimeDerivativeBatch(Mat<dbl> const& X, dbl const& path_variable_value, Mat<dbl> & F, std::vector< Mat<dbl> > & J, Mat<dbl> & ds_dt) const;
+
+
+
+		/**
+		\brief The state of an evaluation of a System, owned by the caller rather than the System.
+
+		Evaluation through an EvaluationContext reads the System, and writes only the context.  So one System can be shared by several threads, each evaluating with its own context, without copying the System.
+		*/
+		using EvaluationContext = node::StraightLineProgram::Workspace;
+
+		/**
+		\brief Make a context for thread-safe evaluation of the system.
+
+		Compiles the system if needed.  This is NOT itself thread-safe: make all contexts before sharing the system between threads, and make them again after modifying the system or changing its precision.  Parameters other than the variables and path variable take their current values.
+
+		\see EvalInPlace(EvaluationContext&, Eigen::MatrixBase<Derived>&, const Eigen::MatrixBase<OtherDerived>&)
+		*/
+		EvaluationContext MakeEvaluationContext() const
+		{
+			if (!is_compiled_)
+				Compile();
+			return compiled_functions_.MakeWorkspace();
+		}
+
+		/**
+		\brief Evaluate the system, provided the system has no path variable defined, in place, using a caller-owned context.
+
+		Does not modify the system, so is safe to call concurrently from several threads, each with its own context.  Always uses the compiled representation of the functions.
+
+		\throws std::runtime_error, if the number of variables doesn't match, a path variable is defined, or the context is out of date.
+		\param context The context, as made by MakeEvaluationContext.
+		\param function_values The values of the functions.  Must be of length NumTotalFunctions().
+		\param variable_values The values of the variables, for the evaluation.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalInPlace(EvaluationContext & context, Eigen::MatrixBase<Derived>& function_values, const Eigen::MatrixBase<OtherDerived>& variable_values) const
+		{
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
+
+			LoadContext(context, variable_values);
+			EvalFromContext(context, function_values, variable_values);
+		}
+
+		/**
+		\brief Evaluate the system, provided a path variable is defined for the system, in place, using a caller-owned context.
+
+		\throws std::runtime_error, if the number of variables doesn't match, a path variable is NOT defined, or the context is out of date.
+		\see EvalInPlace(EvaluationContext&, Eigen::MatrixBase<Derived>&, const Eigen::MatrixBase<OtherDerived>&)
+		*/
+		template<typename Derived, typename OtherDerived, typename T>
+		void EvalInPlace(EvaluationContext & context, Eigen::MatrixBase<Derived>& function_values, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
+		{
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+			LoadContext(context, variable_values);
+			if (compiled_path_variable_register_ >= 0)
+				context.Register<T>(compiled_path_variable_register_) = path_variable_value;
+			EvalFromContext(context, function_values, variable_values);
+		}
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system, provided the system has no path variable defined, in place, using a caller-owned context.
+
+		Does not modify the system, so is safe to call concurrently from several threads, each with its own context.
+
+		\throws std::runtime_error, if the number of variables doesn't match, a path variable is defined, or the context is out of date.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void JacobianInPlace(EvaluationContext & context, Eigen::MatrixBase<Derived>& J, const Eigen::MatrixBase<OtherDerived>& variable_values) const
+		{
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
+
+			LoadContext(context, variable_values);
+			JacobianFromContext(context, J, variable_values);
+		}
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system, provided a path variable is defined for the system, in place, using a caller-owned context.
+
+		\throws std::runtime_error, if the number of variables doesn't match, a path variable is NOT defined, or the context is out of date.
+		*/
+		template<typename Derived, typename OtherDerived, typename T>
+		void JacobianInPlace(EvaluationContext & context, Eigen::MatrixBase<Derived>& J, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
+		{
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+			LoadContext(context, variable_values);
+			if (compiled_path_variable_register_ >= 0)
+				context.Register<T>(compiled_path_variable_register_) = path_variable_value;
+			JacobianFromContext(context, J, variable_values);
+		}
 		
 		
 		
@@ -361,17 +745,40 @@ namespace bertini {
 				throw std::runtime_error("trying to evaluate jacobian of system in place, but input J doesn't have right number of columns or rows");
 			}
 			
-			const auto& vars = Variables();
-
-			if (!is_differentiated_)
-				Differentiate();
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
+
+				// one forward pass for the values, then one reverse pass per function for all its partial derivatives
+				CompiledEval<T>();
+				CompiledSweeps<T>([&](size_t ii, std::vector<T> const& a)
+					{
+						for (int jj = 0; jj < NumVariables(); ++jj)
+							J(ii,jj) = compiled_variable_registers_[jj] < 0 ? T(0) : a[compiled_variable_registers_[jj]];
+					});
+			}
+			else if (UsingPolynomialEvaluation())
+			{
+				polynomial_functions_.EvalWithDerivatives<T>();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					for (int jj = 0; jj < NumVariables(); ++jj)
+						J(ii,jj) = polynomial_functions_.Derivative<T>(ii,jj);
+			}
 			else
-				for (const auto& iter : jacobian_) 
-					iter->Reset();
+			{
+				const auto& vars = Variables();
+				const auto& structure = JacobianStructure();
 
-			for (int ii = 0; ii < NumFunctions(); ++ii)
-				for (int jj = 0; jj < NumVariables(); ++jj)
-					jacobian_[ii]->EvalJInPlace<T>(J(ii,jj),vars[jj]);
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					JacobianEntry(ii)->Reset();
+
+				// structural zeros are not evaluated, and from one column to the next, only the derivative parts of an entry are
+				J.setZero();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					for (auto jj : structure[ii])
+						jacobian_[ii]->EvalJColumnInPlace<T>(J(ii,jj),vars[jj]->Id());
+			}
 				
 			if (IsPatched())
 				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
@@ -558,52 +965,635 @@ namespace bertini {
 			if (!HavePathVariable())
 				throw std::runtime_error("computing time derivative of system with no path variable defined");
 
+			SetVariables(variable_values.eval()); //TODO: remove this eval()
+			SetPathVariable(path_variable_value);
+
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
+
+				CompiledEval<T>();
+				CompiledSweeps<T>([&](size_t ii, std::vector<T> const& a)
+					{
+						ds_dt(ii) = compiled_path_variable_register_ < 0 ? T(0) : a[compiled_path_variable_register_];
+					});
+			}
+			else if (UsingPolynomialEvaluation())
+			{
+				// the path variable is the input after the variables
+				polynomial_functions_.EvalWithDerivatives<T>();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					ds_dt(ii) = polynomial_functions_.Derivative<T>(ii, NumVariables());
+			}
+			else
+			{
+				if (!have_path_terms_)
+					ComputePathTerms();
+
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					ds_dt(ii) = has_path_terms_[ii] ? PathTermsDerivative<T>(ii) : JacobianEntry(ii)->EvalJ<T>(path_variable_);
+			}
+
+			if (IsPatched())
+				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
+					ds_dt(ii+NumFunctions()) = T(0);
+			
+		}
+
+		
+		
+		
+		
+		
+		/**
+		\brief Compute the time-derivative is a system. 
+		
+		If \f$S\f$ is the system, and \f$t\f$ is the path variable this computes \f$\frac{dS}{dt}\f$.
+
+		\tparam T The number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		\throws std::runtime error if the system does not have a path variable defined.
+		*/
+		template<typename Derived, typename T>
+		Vec<T> TimeDerivative(const Eigen::MatrixBase<Derived> & variable_values, const T & path_variable_value) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!HavePathVariable())
+				throw std::runtime_error("computing time derivative of system with no path variable defined");
+
+
+			Vec<T> ds_dt(NumTotalFunctions());
+			TimeDerivativeInPlace(ds_dt, variable_values, path_variable_value);
+			return ds_dt;
+		}
+
+
+		/**
+		\brief Compute the derivatives of the system with respect to its implicit parameters, at a point and time.
+
+		If \f$S\f$ is the system and \f$p\f$ its implicit parameters, this computes \f$\frac{\partial S}{\partial p}\f$, NumTotalFunctions by NumImplicitParameters.  The patches do not depend on the parameters, so their rows are zero.  With the Jacobian of the system at a solution, it gives the sensitivity of the solution to the parameters, see Tracker::ParameterSensitivity.
+
+		Always differentiates the trees, whatever the evaluation in use, as the compiled and polynomial forms of the functions do not differentiate with respect to parameters.
+
+		\param[out] dS_dp The derivatives, resized.
+		\param variable_values The point.
+		\param path_variable_value The time.
+		\throws std::runtime_error if the system does not have a path variable defined, or the point is the wrong size.
+		*/
+		template<typename T>
+		void ImplicitParameterJacobianInPlace(Mat<T> & dS_dp, Vec<T> const& variable_values, T const& path_variable_value) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("computing parameter derivatives of system, but the point has the wrong number of variables");
+			if (!HavePathVariable())
+				throw std::runtime_error("computing parameter derivatives of system with no path variable defined");
+
+			SetVariables(variable_values);
+			SetPathVariable(path_variable_value);
+
+			for (int ii = 0; ii < NumFunctions(); ++ii)
+				JacobianEntry(ii)->Reset();
+
+			dS_dp.resize(NumTotalFunctions(), NumImplicitParameters());
+			dS_dp.setZero();
+			for (int ii = 0; ii < NumFunctions(); ++ii)
+				for (int jj = 0; jj < static_cast<int>(NumImplicitParameters()); ++jj)
+					jacobian_[ii]->EvalJColumnInPlace<T>(dS_dp(ii,jj), implicit_parameters_[jj]->Id());
+		}
+
+
+		/**
+		\brief Compute the derivatives of the system with respect to its implicit parameters, at a point and time.  See ImplicitParameterJacobianInPlace.
+		*/
+		template<typename T>
+		Mat<T> ImplicitParameterJacobian(Vec<T> const& variable_values, T const& path_variable_value) const
+		{
+			Mat<T> dS_dp;
+			ImplicitParameterJacobianInPlace(dS_dp, variable_values, path_variable_value);
+			return dS_dp;
+		}
+
+
+
+		/**
+		\brief Compute the Taylor coefficients of the system in the path variable at a point, to an order, by one pass over the compiled representation of the functions on truncated series.
+
+		Column k is \f$\frac{1}{k!}\frac{\partial^k S}{\partial t^k}\f$ at the point, so column 0 is the value of the system, and column 1 its time derivative.  The patches do not depend on the path variable, so their rows are zero past column 0.  The functions are compiled if need be, whether or not compiled evaluation is in use.
+
+		\throws std::runtime_error, if the system has no path variable, or the number of values doesn't match the number of variables.
+		\tparam T The number type.  dbl or mpfr.
+		*/
+		template<typename T>
+		Mat<T> TimeTaylorCoefficients(Vec<T> const& variable_values, T const& path_variable_value, unsigned order) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("computing time Taylor coefficients of system with no path variable defined");
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to compute time Taylor coefficients of system, but number of variables doesn't match.");
+
+			std::vector<T> series;
+			EvalTaylorSeries(series, Mat<T>(variable_values), &path_variable_value, order);
+
+			Mat<T> coefficients(NumTotalFunctions(), order+1);
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				for (unsigned k = 0; k <= order; ++k)
+					coefficients(ii,k) = series[compiled_functions_.OutputRegisters()[ii]*(order+1) + k];
+
+			if (IsPatched())
+			{
+				coefficients.col(0).tail(NumPatches()) = patch_.Eval(variable_values);
+				for (unsigned k = 1; k <= order; ++k)
+					for (unsigned ii = NumFunctions(); ii < NumTotalFunctions(); ++ii)
+						coefficients(ii,k) = T(0);
+			}
+			return coefficients;
+		}
+
+
+		/**
+		\brief Compute the Taylor coefficients of the solution path through a point, \f$x(t)\f$ with \f$S(x(t),t) = 0\f$, to an order.
+
+		Column 0 is the point, and column k is \f$\frac{1}{k!}\frac{d^k x}{dt^k}\f$ at the point.  Coefficient k of \f$S(x(t),t)\f$ is linear in \f$x_k\f$, as \f$J x_k + r_k\f$, where J is the Jacobian at the point and \f$r_k\f$ that coefficient with \f$x_k = 0\f$.  So each coefficient of the path is one series evaluation of the system, see TimeTaylorCoefficients, and one solve, all with the same LU factorization of J.  This is what a Taylor or Pade predictor needs, without differentiating repeatedly.
+
+		The point must be on the path, for these to be its coefficients.
+
+		\throws std::runtime_error, if the system has no path variable, or is not square, or the number of values doesn't match the number of variables.
+		\tparam T The number type.  dbl or mpfr.
+		*/
+		template<typename T>
+		Mat<T> PathTaylorCoefficients(Vec<T> const& point, T const& path_variable_value, unsigned order) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("computing Taylor coefficients of a path of a system with no path variable defined");
+			if (point.size()!=NumVariables())
+				throw std::runtime_error("trying to compute Taylor coefficients of a path, but number of variables doesn't match.");
+			if (NumTotalFunctions()!=NumVariables())
+				throw std::runtime_error("computing Taylor coefficients of a path needs a square system");
+
+			Mat<T> x(NumVariables(), order+1);
+			x.col(0) = point;
+			for (unsigned k = 1; k <= order; ++k)
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					x(jj,k) = T(0);
+
+			auto LU = Jacobian(point, path_variable_value).lu();
+
+			std::vector<T> series;
+			Vec<T> r(NumTotalFunctions());
+			for (unsigned ii = NumFunctions(); ii < NumTotalFunctions(); ++ii)
+				r(ii) = T(0); // the patches are linear, and their constants are in coefficient 0 only
+
+			for (unsigned k = 1; k <= order; ++k)
+			{
+				EvalTaylorSeries(series, x, &path_variable_value, k);
+				for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+					r(ii) = -series[compiled_functions_.OutputRegisters()[ii]*(k+1) + k];
+				x.col(k) = LU.solve(r);
+			}
+			return x;
+		}
+
+
+
+		/**
+		\brief Evaluate the system in ball arithmetic, for balls containing its values at every point of a box.
+
+		Each variable ranges over its ball, so entry i of the result contains the value of function i at every point of the product of the balls.  With balls of radius zero, this encloses the value at a point, including its rounding error.  The functions are compiled if need be, whether or not compiled evaluation is in use.  See Ball.
+
+		\throws std::runtime_error, if a path variable IS defined, or the number of values doesn't match the number of variables.
+		\tparam T The number type of the midpoints.  dbl or mpfr.
+		*/
+		template<typename T>
+		Vec<Ball<T> > EvalBall(Vec<Ball<T> > const& variable_values) const
+		{
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for ball evaluation of system, but a path variable is defined.");
+			return EvalBall(variable_values, static_cast<T const*>(nullptr));
+		}
+
+		/**
+		\brief Evaluate the system in ball arithmetic, at a value of the path variable.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or the number of values doesn't match the number of variables.
+		*/
+		template<typename T>
+		Vec<Ball<T> > EvalBall(Vec<Ball<T> > const& variable_values, T const& path_variable_value) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for ball evaluation of system, but no path variable defined.");
+			return EvalBall(variable_values, &path_variable_value);
+		}
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system in ball arithmetic, for balls containing its entries at every point of a box.
+
+		By forward differentiation in ball arithmetic, in one pass over the compiled representation of the functions.  The patches are linear, so their rows are their coefficients.
+
+		\throws std::runtime_error, if a path variable IS defined, or the number of values doesn't match the number of variables.
+		\tparam T The number type of the midpoints.  dbl or mpfr.
+		*/
+		template<typename T>
+		Mat<Ball<T> > JacobianBall(Vec<Ball<T> > const& variable_values) const
+		{
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for ball evaluation of jacobian, but a path variable is defined.");
+			return JacobianBall(variable_values, static_cast<T const*>(nullptr));
+		}
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system in ball arithmetic, at a value of the path variable.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or the number of values doesn't match the number of variables.
+		*/
+		template<typename T>
+		Mat<Ball<T> > JacobianBall(Vec<Ball<T> > const& variable_values, T const& path_variable_value) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for ball evaluation of jacobian, but no path variable defined.");
+			return JacobianBall(variable_values, &path_variable_value);
+		}
+
+
+		/**
+		\brief The product of the Jacobian matrix of the system with a vector, \f$J v\f$, without forming J.
+
+		By one pass of forward differentiation over the compiled representation of the functions, on series of order one in the direction v, so it costs a small multiple of one evaluation, whatever the number of variables.  This is what Krylov methods and condition estimators need.  The patches are linear, so their rows are their coefficients times v.  The functions are compiled if need be, whether or not compiled evaluation is in use.
+
+		\throws std::runtime_error, if a path variable IS defined, or the sizes of the point or vector don't match the number of variables.
+		\tparam T The number type.  dbl or mpfr.
+		*/
+		template<typename T>
+		Vec<T> JacobianTimesVector(Vec<T> const& variable_values, Vec<T> const& v) const
+		{
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for product with jacobian, but a path variable is defined.");
+			return JacobianTimesVector(variable_values, static_cast<T const*>(nullptr), v);
+		}
+
+		/**
+		\brief The product of the Jacobian matrix of the system with a vector, at a value of the path variable.  The path variable is held fixed.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or the sizes of the point or vector don't match the number of variables.
+		*/
+		template<typename T>
+		Vec<T> JacobianTimesVector(Vec<T> const& variable_values, T const& path_variable_value, Vec<T> const& v) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for product with jacobian, but no path variable defined.");
+			return JacobianTimesVector(variable_values, &path_variable_value, v);
+		}
+
+		/**
+		\brief The product of a vector with the Jacobian matrix of the system, \f$w^T J\f$, as a column, without forming J.
+
+		By one evaluation and one reverse sweep over the compiled representation of the functions, seeded with the entries of w, so it costs a small multiple of one evaluation, whatever the number of functions.  The functions are compiled if need be, whether or not compiled evaluation is in use.
+
+		\param variable_values The point.
+		\param w One weight for each function, patches included.
+		\throws std::runtime_error, if a path variable IS defined, the size of the point doesn't match the number of variables, or that of w the number of functions.
+		*/
+		template<typename T>
+		Vec<T> VectorTimesJacobian(Vec<T> const& variable_values, Vec<T> const& w) const
+		{
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for product with jacobian, but a path variable is defined.");
+			return VectorTimesJacobian(variable_values, static_cast<T const*>(nullptr), w);
+		}
+
+		/**
+		\brief The product of a vector with the Jacobian matrix of the system, at a value of the path variable.
+
+		\throws std::runtime_error, if a path variable is NOT defined, the size of the point doesn't match the number of variables, or that of w the number of functions.
+		*/
+		template<typename T>
+		Vec<T> VectorTimesJacobian(Vec<T> const& variable_values, T const& path_variable_value, Vec<T> const& w) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for product with jacobian, but no path variable defined.");
+			return VectorTimesJacobian(variable_values, &path_variable_value, w);
+		}
+
+		/**
+		\brief Some columns of the Jacobian matrix of the system, the partial derivatives with respect to some of the variables, without forming the rest.
+
+		Each column is a product of the Jacobian with a unit vector, see JacobianTimesVector, so the cost is a small multiple of one evaluation per column.  For updating the columns of implicit parameters, say.
+
+		\param variable_values The point.
+		\param columns The indices of the variables, in the order of the columns of the result.
+		\throws std::runtime_error, if a path variable IS defined, the size of the point doesn't match the number of variables, or a column is out of range.
+		*/
+		template<typename T>
+		Mat<T> JacobianColumns(Vec<T> const& variable_values, std::vector<unsigned> const& columns) const
+		{
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for columns of jacobian, but a path variable is defined.");
+			return JacobianColumns(variable_values, static_cast<T const*>(nullptr), columns);
+		}
+
+		/**
+		\brief Some columns of the Jacobian matrix of the system, at a value of the path variable.
+
+		\throws std::runtime_error, if a path variable is NOT defined, the size of the point doesn't match the number of variables, or a column is out of range.
+		*/
+		template<typename T>
+		Mat<T> JacobianColumns(Vec<T> const& variable_values, T const& path_variable_value, std::vector<unsigned> const& columns) const
+		{
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for columns of jacobian, but no path variable defined.");
+			return JacobianColumns(variable_values, &path_variable_value, columns);
+		}
+
+
+
+
+		/**
+		\brief Evaluate the system and its Jacobian matrix at a point, in place, setting the point only once.
+
+		This is the entry point for Newton's method, which needs both at each iterate.  The variables and path variable are set once, and values computed for the functions are re-used for the Jacobian.  In compiled evaluation mode, a single forward pass over the program is followed by one reverse sweep per function.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the sizes of the inputs do not match.
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+
+		\param[out] function_values The values of the functions, including patches.
+		\param[out] J The Jacobian matrix, including patches.
+		\param variable_values The values of the variables, for the evaluation.
+		\param path_variable_value The current value of the path variable.
+		*/
+		template<typename Derived, typename JacDerived, typename OtherDerived, typename T>
+		void EvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<JacDerived> & J, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename JacDerived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system and jacobian, but number of variables doesn't match.");
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system and jacobian, but no path variable defined.");
+			if (function_values.size() < NumFunctions() || J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
+				throw std::runtime_error("trying to evaluate system and jacobian in place, but outputs have the wrong size");
+
+			SetVariables(variable_values.eval());
+			SetPathVariable(path_variable_value);
+
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
+
+				CompiledEval<T>();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					function_values(ii) = compiled_functions_.Output<T>(ii);
+				CompiledSweeps<T>([&](size_t ii, std::vector<T> const& a)
+					{
+						for (int jj = 0; jj < NumVariables(); ++jj)
+							J(ii,jj) = compiled_variable_registers_[jj] < 0 ? T(0) : a[compiled_variable_registers_[jj]];
+					});
+
+				if (IsPatched())
+				{
+					patch_.EvalInPlace(function_values, std::get<Vec<T> >(current_variable_values_));
+					patch_.JacobianInPlace(J, std::get<Vec<T> >(current_variable_values_));
+				}
+			}
+			else if (UsingPolynomialEvaluation())
+			{
+				// one pass for both
+				polynomial_functions_.EvalWithDerivatives<T>();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+				{
+					function_values(ii) = polynomial_functions_.Output<T>(ii);
+					for (int jj = 0; jj < NumVariables(); ++jj)
+						J(ii,jj) = polynomial_functions_.Derivative<T>(ii,jj);
+				}
+
+				if (IsPatched())
+				{
+					patch_.EvalInPlace(function_values, std::get<Vec<T> >(current_variable_values_));
+					patch_.JacobianInPlace(J, std::get<Vec<T> >(current_variable_values_));
+				}
+			}
+			else
+			{
+				EvalInPlace(function_values);
+				JacobianInPlace(J);
+			}
+		}
+
+
+
+
+		/**
+		\brief Evaluate the Jacobian matrix and the time-derivative of the system at a point, in place, setting the point only once.
+
+		This is the entry point for the stages of the Runge-Kutta predictors, which solve \f$\frac{dS}{dx} \dot{x} = -\frac{dS}{dt}\f$.  In compiled evaluation mode, each reverse sweep produces a row of the Jacobian and an entry of the time derivative together.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the sizes of the inputs do not match.
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+
+		\param[out] J The Jacobian matrix, including patches.
+		\param[out] ds_dt The derivative of the system with respect to the path variable.  Entries for the patches are 0.
+		\param variable_values The values of the variables, for the evaluation.
+		\param path_variable_value The current value of the path variable.
+		*/
+		template<typename JacDerived, typename Derived, typename OtherDerived, typename T>
+		void JacobianAndTimeDerivativeInPlace(Eigen::MatrixBase<JacDerived> & J, Eigen::MatrixBase<Derived> & ds_dt, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename JacDerived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian and time derivative, but number of variables doesn't match.");
+			if (!have_path_variable_)
+				throw std::runtime_error("computing time derivative of system with no path variable defined");
+			if (ds_dt.size() < NumFunctions() || J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian and time derivative in place, but outputs have the wrong size");
+
+			SetVariables(variable_values.eval());
+			SetPathVariable(path_variable_value);
+
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
+
+				CompiledEval<T>();
+				CompiledSweeps<T>([&](size_t ii, std::vector<T> const& a)
+					{
+						for (int jj = 0; jj < NumVariables(); ++jj)
+							J(ii,jj) = compiled_variable_registers_[jj] < 0 ? T(0) : a[compiled_variable_registers_[jj]];
+						ds_dt(ii) = compiled_path_variable_register_ < 0 ? T(0) : a[compiled_path_variable_register_];
+					});
+
+				if (IsPatched())
+					patch_.JacobianInPlace(J, std::get<Vec<T> >(current_variable_values_));
+			}
+			else if (UsingPolynomialEvaluation())
+			{
+				polynomial_functions_.EvalWithDerivatives<T>();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+				{
+					for (int jj = 0; jj < NumVariables(); ++jj)
+						J(ii,jj) = polynomial_functions_.Derivative<T>(ii,jj);
+					ds_dt(ii) = polynomial_functions_.Derivative<T>(ii, NumVariables());
+				}
+
+				if (IsPatched())
+					patch_.JacobianInPlace(J, std::get<Vec<T> >(current_variable_values_));
+			}
+			else
+			{
+				JacobianInPlace(J);
+				if (!have_path_terms_)
+					ComputePathTerms();
+
+				// at the point of the Jacobian, so only the derivative parts of the entries are evaluated again
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					if (has_path_terms_[ii])
+						ds_dt(ii) = PathTermsDerivative<T>(ii);
+					else
+						JacobianEntry(ii)->EvalJColumnInPlace<T>(ds_dt(ii), path_variable_->Id());
+			}
+
+			if (IsPatched())
+				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
+					ds_dt(ii+NumFunctions()) = T(0);
+		}
+
+
+
+		/**
+		\brief Get the structural sparsity pattern of the Jacobian of the functions, not including the patches.
+
+		For each function, the sorted indices of the variables, in the order of Variables(), which appear in it.  Every other entry of its row of the Jacobian is identically zero, and is not evaluated.  Found from the functions themselves, without differentiating them.
+		*/
+		std::vector< std::vector<unsigned> > const& JacobianStructure() const
+		{
 			if (!is_differentiated_)
-				Differentiate();
+				ClearJacobian();
+			else if (jacobian_structure_.size()!=NumFunctions())
+				ComputeJacobianStructure();
+			return jacobian_structure_;
+		}
+
+		/**
+		\brief The fraction of the entries of the Jacobian, including patches, which are not structurally zero.
+		*/
+		double JacobianDensity() const
+		{
+			size_t nonzeros = 0;
+			for (const auto& iter : JacobianStructure())
+				nonzeros += iter.size();
+			if (IsPatched())
+				for (auto size : patch_.VariableGroupSizes())
+					nonzeros += size;
+
+			return double(nonzeros) / (double(NumTotalFunctions())*NumVariables());
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system as a sparse matrix, using the previous space and time values, in place.
+
+		Only the entries in JacobianStructure(), and those of the patches, are evaluated and stored, so the pattern of J is the same at every point.  Use this with a sparse factorization such as Eigen::SparseLU when JacobianDensity() is small.
+
+		\param[out] J The Jacobian matrix, including patches.  Resized to NumTotalFunctions() by NumVariables().
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		*/
+		template<typename T>
+		void SparseJacobianInPlace(Eigen::SparseMatrix<T> & J) const
+		{
+			const auto& structure = JacobianStructure();
 
-			SetVariables(variable_values.eval()); //TODO: remove this eval()
-			SetPathVariable(path_variable_value);
+			std::vector< Eigen::Triplet<T> > entries;
+			entries.reserve(size_t(JacobianDensity()*NumTotalFunctions()*NumVariables()));
 
-			
-			for (int ii = 0; ii < NumFunctions(); ++ii)
-				ds_dt(ii) = jacobian_[ii]->EvalJ<T>(path_variable_);
+			if (use_compiled_evaluation_)
+			{
+				if (!is_compiled_)
+					Compile();
+
+				CompiledEval<T>();
+				if (!evaluation_team_)
+					compiled_functions_.ReverseSweeps<T>([&](size_t ii, std::vector<T> const& a)
+						{
+							for (auto jj : structure[ii])
+								entries.emplace_back(ii, jj, a[compiled_variable_registers_[jj]]);
+						});
+				else
+				{
+					// the rows are swept concurrently, so are gathered separately
+					std::vector< std::vector<T> > rows(NumFunctions());
+					compiled_functions_.ReverseSweeps<T>(*evaluation_team_, [&](size_t ii, std::vector<T> const& a)
+						{
+							rows[ii].reserve(structure[ii].size());
+							for (auto jj : structure[ii])
+								rows[ii].push_back(a[compiled_variable_registers_[jj]]);
+						});
+					for (int ii = 0; ii < NumFunctions(); ++ii)
+						for (size_t kk = 0; kk < structure[ii].size(); ++kk)
+							entries.emplace_back(ii, structure[ii][kk], rows[ii][kk]);
+				}
+			}
+			else
+			{
+				const auto& vars = Variables();
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					JacobianEntry(ii)->Reset();
+
+				T entry;
+				for (int ii = 0; ii < NumFunctions(); ++ii)
+					for (auto jj : structure[ii])
+					{
+						jacobian_[ii]->EvalJColumnInPlace<T>(entry, vars[jj]->Id());
+						entries.emplace_back(ii, jj, entry);
+					}
+			}
 
 			if (IsPatched())
-				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
-					ds_dt(ii+NumFunctions()) = T(0);
-			
+			{
+				auto patch_jacobian = patch_.Jacobian(std::get<Vec<T> >(current_variable_values_));
+				unsigned column = 0;
+				for (unsigned ii = 0; ii < patch_.VariableGroupSizes().size(); ++ii)
+					for (unsigned jj = 0; jj < patch_.VariableGroupSizes()[ii]; ++jj, ++column)
+						entries.emplace_back(NumFunctions()+ii, column, patch_jacobian(ii,column));
+			}
+
+			J.resize(NumTotalFunctions(), NumVariables());
+			J.setFromTriplets(entries.begin(), entries.end());
 		}
 
-		
-		
-		
-		
-		
 		/**
-		\brief Compute the time-derivative is a system. 
-		
-		If \f$S\f$ is the system, and \f$t\f$ is the path variable this computes \f$\frac{dS}{dt}\f$.
+		\brief Evaluate the Jacobian matrix of the system as a sparse matrix, provided a path variable is defined for the system, in place.
 
-		\tparam T The number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
-		\throws std::runtime error if the system does not have a path variable defined.
+		\param[out] J The Jacobian matrix, including patches.
+		\param variable_values The values of the variables, for the evaluation.
+		\param path_variable_value The current value of the path variable.
+		\see SparseJacobianInPlace(Eigen::SparseMatrix<T> &)
 		*/
 		template<typename Derived, typename T>
-		Vec<T> TimeDerivative(const Eigen::MatrixBase<Derived> & variable_values, const T & path_variable_value) const
+		void SparseJacobianInPlace(Eigen::SparseMatrix<T> & J, const Eigen::MatrixBase<Derived> & variable_values, const T & path_variable_value) const
 		{
 			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
 
-			if (!HavePathVariable())
-				throw std::runtime_error("computing time derivative of system with no path variable defined");
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate sparse jacobian, but number of variables doesn't match.");
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of sparse jacobian, but no path variable defined.");
 
+			SetVariables(variable_values.eval());
+			SetPathVariable(path_variable_value);
 
-			Vec<T> ds_dt(NumTotalFunctions());
-			TimeDerivativeInPlace(ds_dt, variable_values, path_variable_value);
-			return ds_dt;
+			SparseJacobianInPlace(J);
 		}
 	
 		/**
 		Homogenize the system, adding new homogenizing variables for each VariableGroup defined for the system.
 
+		The homogenized functions are then simplified, see node::Simplify.  If the functions have been expanded for polynomial evaluation, the expansion is homogenized in place, by multiplying its terms by powers of the homogenizing variables from its table of powers, rather than expanded again from the homogenized trees; see node::SparsePolynomials::Homogenize.
+
 		\throws std::runtime_error, if the system is not polynomial, has a mismatch on the number of homogenizing variables and the number of variable groups (this would result from a partially homogenized system), or the homogenizing variable names somehow get screwed up by having duplicates.
 		*/
 		void Homogenize();
@@ -737,23 +1727,30 @@ namespace bertini {
 			if (new_values.size()!= NumVariables())
 				throw std::runtime_error("variable vector of different length from system-owned variables in SetVariables");
 
-			const auto& vars = Variables();
+			if (!have_ordering_)
+				ConstructOrdering();
 
 			#ifndef BERTINI_DISABLE_PRECISION_CHECKS
-				if (!std::is_same<T,dbl>::value && (Precision(new_values) != this->precision()))
-					throw std::runtime_error("precision of input point in SetVariables (" + std::to_string(Precision(new_values)) + ") must match the precision of the system (" + std::to_string(this->precision()) + ").");
+				// the entries of a point share a precision, so the first stands for all, and the check costs the same for every size of system
+				if (!std::is_same<T,dbl>::value && new_values.size()>0 && (Precision(new_values(0)) != this->precision()))
+					throw std::runtime_error("precision of input point in SetVariables (" + std::to_string(Precision(new_values(0))) + ") must match the precision of the system (" + std::to_string(this->precision()) + ").");
 
-				if (!std::is_same<T,dbl>::value && (vars[0]->node::NamedSymbol::precision() != this->precision()) )
-					throw std::runtime_error("internally, precision of variables (" + std::to_string(vars[0]->node::NamedSymbol::precision()) + ") in SetVariables must match the precision of the system (" + std::to_string(this->precision()) + ").");
+				if (!std::is_same<T,dbl>::value && !variable_nodes_.empty() && (variable_nodes_[0]->node::NamedSymbol::precision() != this->precision()) )
+					throw std::runtime_error("internally, precision of variables (" + std::to_string(variable_nodes_[0]->node::NamedSymbol::precision()) + ") in SetVariables must match the precision of the system (" + std::to_string(this->precision()) + ").");
 			#endif
 
-			auto counter = 0;
+			const auto num_variables = variable_nodes_.size();
+			for (size_t ii = 0; ii < num_variables; ++ii)
+				variable_nodes_[ii]->set_current_value(new_values(ii));
 
-			for (auto iter=vars.begin(); iter!=vars.end(); iter++, counter++) {
-				(*iter)->set_current_value(new_values(counter));
-			}
+			// sizes match after the first point, so this copies into the existing entries, without allocating
+			auto& current = std::get<Vec<T> >(current_variable_values_);
+			if (current.size() != new_values.size())
+				current.resize(new_values.size());
+			for (int ii = 0; ii < new_values.size(); ++ii)
+				current(ii) = new_values(ii);
 
-			std::get<Vec<T> >(current_variable_values_) = new_values;
+			InvalidateSpaceDependentNodes();
 		}
 
 
@@ -773,6 +1770,8 @@ namespace bertini {
 				throw std::runtime_error("trying to set the value of the path variable, but one is not defined for this system");
 
 			path_variable_->set_current_value(new_value);
+
+			InvalidateTimeDependentNodes();
 		}
 
 
@@ -794,6 +1793,9 @@ namespace bertini {
 			for (auto iter=implicit_parameters_.begin(); iter!=implicit_parameters_.end(); iter++, counter++)
 				(*iter)->set_current_value(new_values(counter));
 
+			coefficient_bound_evaluations_ = 0;
+			InvalidateSpaceDependentNodes();
+
 		}
 
 
@@ -1027,6 +2029,22 @@ namespace bertini {
 			return functions_[index];
 		}
 
+		/**
+		 Get the subfunctions of the system, those not constant.
+		*/
+		auto const& Subfunctions() const
+		{
+			return subfunctions_;
+		}
+
+		/**
+		 Get the explicit parameters of the system, in the order they were added.
+		*/
+		auto const& Parameters() const
+		{
+			return explicit_parameters_;
+		}
+
 		
 
 		/**
@@ -1047,6 +2065,8 @@ namespace bertini {
 
 		/**
 		Compute an estimate of an upper bound of the absolute values of the coefficients in the system.
+
+		The estimate is the largest absolute value of the functions and their derivatives at random points of unit entries, computed in double precision, or in multiple precision if a double evaluation overflows or the system has implicit parameters, whose double values may not be set.  It is kept, and only points beyond those already used are evaluated by later calls, until the system is modified or its implicit parameters are set.
 		
 		\param num_evaluations The number of times to compute this estimate.  Default is 1.
 		\returns An upper bound on the absolute values of the coefficients.
@@ -1058,6 +2078,8 @@ namespace bertini {
          \brief Compute an upper bound on the degree of the system.  
 
          This number will be wrong if the system is non-polynomial, because degree for non-polynomial systems is not defined.
+
+         The degrees are kept, until the functions or variables of the system change.
          */
         int DegreeBound() const;
 
@@ -1118,6 +2140,15 @@ namespace bertini {
 		*/
 		void CopyPatches(System const& other);
 
+		/**
+		\brief Replace the patch, by one on the same variable groups.
+
+		Const, like SetImplicitParameters, so that a tracker may switch the patch of the system it tracks to keep the coordinates of its point bounded, see Tracker::SetPatchSwitching.  A point on the old patch is moved onto the new one by RescalePointToFitPatchInPlace.  The patch is set to the precision of the system.
+
+		\throws std::runtime_error if the system is not patched, or the patch is on variable groups of other sizes.
+		*/
+		void SetPatch(Patch const& new_patch) const;
+
 
 		Patch GetPatch() const
 		{
@@ -1209,6 +2240,380 @@ namespace bertini {
 		friend const System operator*(Nd const&  N, System const& s);
 	private:
 
+		// evaluate compiled_functions_ at the current variable values, through the evaluation team if there is one
+		template<typename T>
+		void CompiledEval() const
+		{
+			if (evaluation_team_)
+				compiled_functions_.Eval<T>(*evaluation_team_);
+			else
+				compiled_functions_.Eval<T>();
+		}
+
+		// sweep each function of compiled_functions_ for its derivatives, handing them to row(ii, adjoints), concurrently for distinct ii if there is an evaluation team
+		template<typename T, typename RowF>
+		void CompiledSweeps(RowF const& row) const
+		{
+			if (evaluation_team_)
+				compiled_functions_.ReverseSweeps<T>(*evaluation_team_, row);
+			else
+				compiled_functions_.ReverseSweeps<T>(row);
+		}
+
+		/**
+		\brief Check that a context matches the compiled functions, and write variable values into it.
+		*/
+		template<typename Derived>
+		void LoadContext(EvaluationContext & context, const Eigen::MatrixBase<Derived>& variable_values) const
+		{
+			typedef typename Derived::Scalar T;
+
+			if (variable_values.size()!=NumVariables())
+			{
+				std::stringstream ss;
+				ss << "trying to evaluate system, but number of input variables (" << variable_values.size() << ") doesn't match number of system variables (" << NumVariables() << ").";
+				throw std::runtime_error(ss.str());
+			}
+
+			if (!is_compiled_ || context.NumRegisters()!=compiled_functions_.NumRegisters())
+				throw std::runtime_error("evaluation context is out of date with the system.  make a new one with MakeEvaluationContext.");
+
+			for (unsigned jj = 0; jj < NumVariables(); ++jj)
+				if (compiled_variable_registers_[jj] >= 0)
+					context.Register<T>(compiled_variable_registers_[jj]) = variable_values(jj);
+		}
+
+		template<typename Derived, typename OtherDerived>
+		void EvalFromContext(EvaluationContext & context, Eigen::MatrixBase<Derived>& function_values, const Eigen::MatrixBase<OtherDerived>& variable_values) const
+		{
+			typedef typename Derived::Scalar T;
+
+			compiled_functions_.Eval<T>(context);
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				function_values(ii) = compiled_functions_.Output<T>(ii, context);
+
+			if (IsPatched())
+			{
+				Vec<T> x = variable_values;
+				patch_.EvalInPlace(function_values, x);
+			}
+		}
+
+		template<typename Derived, typename OtherDerived>
+		void JacobianFromContext(EvaluationContext & context, Eigen::MatrixBase<Derived>& J, const Eigen::MatrixBase<OtherDerived>& variable_values) const
+		{
+			typedef typename Derived::Scalar T;
+
+			compiled_functions_.Eval<T>(context);
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			{
+				compiled_functions_.ReverseSweep<T>(ii, context);
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					J(ii,jj) = compiled_variable_registers_[jj] < 0 ? T(0) : context.Adjoint<T>(compiled_variable_registers_[jj]);
+			}
+
+			if (IsPatched())
+			{
+				Vec<T> x = variable_values;
+				patch_.JacobianInPlace(J, x);
+			}
+		}
+
+		/**
+		\brief Compile if needed, and evaluate the compiled functions on truncated Taylor series in the path variable, about a value of it.
+
+		\param series The register file of series, see StraightLineProgram::BeginTaylor.
+		\param x The leading coefficients of the series of the variables, one column per coefficient.  Those past its columns are zero.
+		\param path_variable_value The value of the path variable about which the series are.  If null, the path variable's register is left zero.
+		\param order The order of the series.
+		\param advance_path_variable Whether the series of the path variable is \f$t + s\f$, so the series are in the path variable, or the constant t, so they are along the series of the variables only.
+		*/
+		template<typename T>
+		void EvalTaylorSeries(std::vector<T> & series, Mat<T> const& x, T const* path_variable_value, unsigned order, bool advance_path_variable = true) const
+		{
+			if (!is_compiled_)
+				Compile();
+
+			const auto K = order+1;
+			compiled_functions_.BeginTaylor(series, order);
+			for (unsigned jj = 0; jj < NumVariables(); ++jj)
+				if (compiled_variable_registers_[jj] >= 0)
+					for (unsigned k = 0; k < K && k < x.cols(); ++k)
+						series[compiled_variable_registers_[jj]*K + k] = x(jj,k);
+
+			if (compiled_path_variable_register_ >= 0 && path_variable_value)
+			{
+				series[compiled_path_variable_register_*K] = *path_variable_value;
+				if (K > 1 && advance_path_variable)
+					series[compiled_path_variable_register_*K + 1] = T(1);
+			}
+
+			compiled_functions_.EvalTaylor(series, order);
+		}
+
+		template<typename T>
+		Vec<T> JacobianTimesVector(Vec<T> const& x, T const* path_variable_value, Vec<T> const& v) const
+		{
+			if (x.size()!=NumVariables() || v.size()!=NumVariables())
+				throw std::runtime_error("trying to multiply jacobian of system by a vector, but number of variables doesn't match.");
+
+			Mat<T> series_of_x(NumVariables(), 2);
+			series_of_x.col(0) = x;
+			series_of_x.col(1) = v;
+
+			std::vector<T> series;
+			EvalTaylorSeries(series, series_of_x, path_variable_value, 1, false);
+
+			Vec<T> Jv(NumTotalFunctions());
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				Jv(ii) = series[compiled_functions_.OutputRegisters()[ii]*2 + 1];
+
+			if (IsPatched())
+				Jv.tail(NumPatches()) = PatchCoefficients<T>()*v;
+			return Jv;
+		}
+
+		template<typename T>
+		Vec<T> VectorTimesJacobian(Vec<T> const& x, T const* path_variable_value, Vec<T> const& w) const
+		{
+			if (x.size()!=NumVariables())
+				throw std::runtime_error("trying to multiply a vector by jacobian of system, but number of variables doesn't match.");
+			if (w.size()!=NumTotalFunctions())
+				throw std::runtime_error("trying to multiply a vector by jacobian of system, but number of functions doesn't match.");
+
+			if (!is_compiled_)
+				Compile();
+
+			SetVariables(x);
+			if (path_variable_value)
+				SetPathVariable(*path_variable_value);
+
+			compiled_functions_.Eval<T>();
+			compiled_functions_.WeightedReverseSweep(std::vector<T>(w.data(), w.data()+NumFunctions()));
+
+			Vec<T> wJ(NumVariables());
+			for (unsigned jj = 0; jj < NumVariables(); ++jj)
+				wJ(jj) = compiled_variable_registers_[jj] < 0 ? T(0) : compiled_functions_.Adjoint<T>(compiled_variable_registers_[jj]);
+
+			if (IsPatched())
+				wJ += PatchCoefficients<T>().transpose()*w.tail(NumPatches());
+			return wJ;
+		}
+
+		template<typename T>
+		Mat<T> JacobianColumns(Vec<T> const& x, T const* path_variable_value, std::vector<unsigned> const& columns) const
+		{
+			Mat<T> J(NumTotalFunctions(), columns.size());
+			Vec<T> e = Vec<T>::Zero(NumVariables());
+			for (size_t kk = 0; kk < columns.size(); ++kk)
+			{
+				if (columns[kk] >= NumVariables())
+					throw std::runtime_error("column of jacobian of system out of range");
+
+				e(columns[kk]) = T(1);
+				J.col(kk) = JacobianTimesVector(x, path_variable_value, e);
+				e(columns[kk]) = T(0);
+			}
+			return J;
+		}
+
+		template<typename T>
+		Vec<Ball<T> > EvalBall(Vec<Ball<T> > const& x, T const* path_variable_value) const
+		{
+			std::vector<Ball<T> > balls;
+			EvalBallRegisters(balls, x, path_variable_value, 0);
+
+			Vec<Ball<T> > f(NumTotalFunctions());
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				f(ii) = balls[compiled_functions_.OutputRegisters()[ii]];
+
+			if (IsPatched())
+			{
+				auto P = PatchCoefficients<T>();
+				for (unsigned ii = 0; ii < NumPatches(); ++ii)
+				{
+					Ball<T> value(T(-1));
+					for (unsigned jj = 0; jj < NumVariables(); ++jj)
+						value += Ball<T>(P(ii,jj))*x(jj);
+					f(NumFunctions()+ii) = value;
+				}
+			}
+			return f;
+		}
+
+		template<typename T>
+		Mat<Ball<T> > JacobianBall(Vec<Ball<T> > const& x, T const* path_variable_value) const
+		{
+			std::vector<Ball<T> > balls;
+			EvalBallRegisters(balls, x, path_variable_value, NumVariables());
+
+			const auto N = NumVariables()+1;
+			Mat<Ball<T> > J(NumTotalFunctions(), NumVariables());
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					J(ii,jj) = balls[compiled_functions_.OutputRegisters()[ii]*N + 1 + jj];
+
+			if (IsPatched())
+			{
+				auto P = PatchCoefficients<T>();
+				for (unsigned ii = 0; ii < NumPatches(); ++ii)
+					for (unsigned jj = 0; jj < NumVariables(); ++jj)
+						J(NumFunctions()+ii,jj) = Ball<T>(P(ii,jj));
+			}
+			return J;
+		}
+
+		/**
+		\brief Compile if needed, load balls for the variables, their derivatives in the directions of the variables if num_directions is not 0, and the path variable, and evaluate the compiled representation of the functions in ball arithmetic.
+
+		\throws std::runtime_error, if the number of balls doesn't match the number of variables.
+		*/
+		template<typename T>
+		void EvalBallRegisters(std::vector<Ball<T> > & balls, Vec<Ball<T> > const& x, T const* path_variable_value, unsigned num_directions) const
+		{
+			if (x.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system in ball arithmetic, but number of variables doesn't match.");
+
+			if (!is_compiled_)
+				Compile();
+
+			const auto N = num_directions+1;
+			compiled_functions_.BeginBall(balls, num_directions);
+			for (unsigned jj = 0; jj < NumVariables(); ++jj)
+				if (compiled_variable_registers_[jj] >= 0)
+				{
+					balls[compiled_variable_registers_[jj]*N] = x(jj);
+					if (num_directions > 0)
+						balls[compiled_variable_registers_[jj]*N + 1 + jj] = Ball<T>(T(1));
+				}
+
+			if (compiled_path_variable_register_ >= 0 && path_variable_value)
+				balls[compiled_path_variable_register_*N] = Ball<T>(*path_variable_value);
+
+			compiled_functions_.EvalBall(balls, num_directions);
+		}
+
+		/**
+		\brief The coefficients of the patches, their Jacobian, with a row for each patch.
+		*/
+		template<typename T>
+		Mat<T> PatchCoefficients() const
+		{
+			Mat<T> P = Mat<T>::Zero(NumPatches(), NumVariables());
+			patch_.JacobianInPlace(P);
+			return P;
+		}
+
+		/**
+		\brief Compile if needed, load a batch of points into the compiled representation of the functions, and evaluate it.
+
+		\throws std::runtime_error, if the number of rows of X doesn't match the number of variables.
+		*/
+		void PrepareBatch(Mat<dbl> const& X) const;
+
+		/**
+		\brief Copy the function values of the prepared batch into F, including the patches.
+		*/
+		void BatchFunctions(Mat<dbl> const& X, Mat<dbl> & F) const;
+
+		/**
+		\brief Reverse sweep the prepared batch, copying the Jacobian matrices into J, and the time derivatives into ds_dt if not null.
+		*/
+		void BatchDerivatives(Mat<dbl> const& X, std::vector< Mat<dbl> > & J, Mat<dbl> * ds_dt) const;
+
+		/**
+		\brief Classify the nodes of the functions according to whether their values depend on the variables, the path variable, or neither.
+
+		Fills space_dependent_nodes_ and time_dependent_nodes_, and resets the functions, so that no value stored before the classification survives it.
+		*/
+		void ComputeDependencies() const;
+
+		/**
+		\brief Gather every node of the functions, subfunctions, parameters, derivatives and variables into precision_nodes_, each once, so that changing precision adjusts each node's values once, rather than once per tree sharing it.
+		*/
+		void ComputePrecisionNodes() const;
+
+		/**
+		\brief Set the compensated summation of each sum among nodes to compensated_summation_.
+		*/
+		void ApplyCompensatedSummation(std::vector<Nd> const& nodes) const;
+
+		/**
+		\brief Start the cached degrees and coefficient bound afresh, after the system has changed.
+		*/
+		void ValidateBounds() const;
+
+		/**
+		\brief Find the variables appearing in each function, filling jacobian_structure_.
+		*/
+		void ComputeJacobianStructure() const;
+
+		/**
+		\brief Forget the derivatives of the functions, if any, and find the structure of the Jacobian afresh.
+		*/
+		void ClearJacobian() const;
+
+		/**
+		\brief Differentiate one function, filling its entry of jacobian_.
+		*/
+		void DifferentiateFunction(unsigned ii) const;
+
+		/**
+		\brief The derivative tree of a function, differentiating it if it has not been.
+		*/
+		Jac const& JacobianEntry(unsigned ii) const
+		{
+			if (!is_differentiated_)
+				ClearJacobian();
+			if (!jacobian_[ii])
+				DifferentiateFunction(ii);
+			return jacobian_[ii];
+		}
+
+		/**
+		\brief Split each function whose dependence on the path variable is only through coefficients into its terms, filling path_terms_ and has_path_terms_.
+
+		A function qualifies if it is a sum of terms, each either free of the path variable, depending only on it, or a product of one factor depending only on it and others free of it.  Straight-line homotopies \f$(1-t) f(x) + \gamma t g(x)\f$ are the common case.  The derivative of such a function with respect to the path variable is then a sum of the derivatives of the coefficients times the values of the other factors, which are shared with the functions, so that it costs no pass over the functions beyond their evaluation.
+		*/
+		void ComputePathTerms() const;
+
+		/**
+		\brief The derivative of function ii with respect to the path variable, from its path terms.
+
+		The variables and path variable must already be set, and the function to have path terms.
+		*/
+		template<typename T>
+		T PathTermsDerivative(unsigned ii) const
+		{
+			T ds_dt(0);
+			for (const auto& term : path_terms_[ii])
+			{
+				term.coefficient_derivative->Reset(); // it may depend on the path variable, but is not among the time-dependent nodes
+				T v = term.coefficient_derivative->EvalJ<T>(path_variable_);
+				for (unsigned jj = 0; jj < term.factors.size(); ++jj)
+					if (term.multiply[jj])
+						v *= term.factors[jj]->Eval<T>();
+					else
+						v /= term.factors[jj]->Eval<T>();
+
+				if (term.add)
+					ds_dt += v;
+				else
+					ds_dt -= v;
+			}
+			return ds_dt;
+		}
+
+		/**
+		\brief Invalidate the stored values of the nodes depending on the variables or implicit parameters.  Called on setting their values.
+		*/
+		void InvalidateSpaceDependentNodes() const;
+
+		/**
+		\brief Invalidate the stored values of the nodes depending on the path variable.  Called on setting its value.
+		*/
+		void InvalidateTimeDependentNodes() const;
+
 		/**
 		\brief Get the sizes according to the FIFO ordering.
 		*/
@@ -1292,6 +2697,11 @@ namespace bertini {
 	    */
 	    void ConstructOrdering() const;
 
+	    /**
+		 Gathers the variables of the stored ordering into variable_nodes_, for SetVariables.
+	    */
+	    void BindVariables() const;
+
 
 		VariableGroup ungrouped_variables_; ///< ungrouped variable nodes.  Not in an affine variable group, not in a projective group.  Just hanging out, being a variable.
 		std::vector< VariableGroup > variable_groups_; ///< Affine variable groups.  When system is homogenized, will have a corresponding homogenizing variable.
@@ -1310,11 +2720,13 @@ namespace bertini {
 		std::vector< Fn > subfunctions_; ///< Any declared subfunctions for the system.  Can use these to ensure that complicated repeated structures are only created and evaluated once.
 		std::vector< Fn > functions_; ///< The system's functions.
 		
-		class Patch patch_; ///< Patch on the variable groups.  Assumed to be in the same order as the time_order_of_variable_groups_ if the system uses FIFO ordering, or in same order as the AffHomUng variable groups if that is set.
+		mutable class Patch patch_; ///< Patch on the variable groups.  Mutable, for SetPatch.  Assumed to be in the same order as the time_order_of_variable_groups_ if the system uses FIFO ordering, or in same order as the AffHomUng variable groups if that is set.
 		bool is_patched_;	///< Indicator of whether the system has been patched.
 
-		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation.  Created when first call for a Jacobian matrix evaluation.
-		mutable bool is_differentiated_; ///< indicator for whether the jacobian tree has been populated.
+		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation, one per function.  Each is null until the function is differentiated, on first use, or by Differentiate.
+		mutable bool is_differentiated_; ///< Whether jacobian_ and jacobian_structure_ are for the current functions, those entries of jacobian_ made so far.
+		mutable node::CSEStatistics cse_statistics_; ///< The effect of the most recent merging of common subexpressions.  Not serialized.
+		mutable std::vector< std::vector<unsigned> > jacobian_structure_; ///< For each function, the indices of the variables appearing in it.  Made with the Jacobian.  Not serialized, rebuilt on demand.
 
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
@@ -1322,10 +2734,53 @@ namespace bertini {
 		mutable std::tuple< Vec<dbl>, Vec<mpfr> > current_variable_values_;
 
 		mutable VariableGroup variable_ordering_; ///< The assembled ordering of the variables in the system.
+		mutable std::vector<node::Variable*> variable_nodes_; ///< The variables of variable_ordering_, by index in one contiguous array, for SetVariables.  Rebound with the ordering, not serialized.
 		mutable bool have_ordering_;
 
 		mutable unsigned precision_; ///< the current working precision of the system 
 
+		bool use_compiled_evaluation_; ///< Whether to evaluate the functions using compiled_functions_.
+		bool use_native_evaluation_ = false; ///< Whether to compile compiled_functions_ to native code, for double precision.  Not serialized.
+		std::string native_cache_directory_; ///< Where the native code is kept.
+		mutable bool is_compiled_; ///< Whether compiled_functions_ is up to date with the functions.
+		mutable node::StraightLineProgram compiled_functions_; ///< The functions, lowered into a straight line program.  Not serialized, rebuilt on demand.
+		mutable std::vector<int> compiled_variable_registers_; ///< The registers in compiled_functions_ of the variables, in the order of Variables().  Negative for variables appearing in no function.
+		mutable int compiled_path_variable_register_; ///< The register in compiled_functions_ of the path variable.  Negative if absent.
+		std::shared_ptr<detail::ThreadTeam> evaluation_team_; ///< The threads sharing compiled evaluation, if any.  Not copied, nor serialized.
+
+		bool use_polynomial_evaluation_; ///< Whether to evaluate the functions using polynomial_functions_, when they are all polynomials.
+		bool compensated_summation_ = false; ///< Whether the sums of the trees use compensated summation in double precision.  Not serialized.
+		mutable bool is_expanded_; ///< Whether an expansion of the functions into polynomial_functions_ has been attempted since they were last modified.
+		mutable bool is_expandable_; ///< Whether that expansion succeeded.
+		mutable node::SparsePolynomials polynomial_functions_; ///< The functions, expanded into monomials in the variables, then the path variable.  Not serialized, rebuilt on demand.
+
+		mutable bool have_dependencies_; ///< Whether space_dependent_nodes_ and time_dependent_nodes_ are up to date with the functions.
+		mutable std::vector< Nd > space_dependent_nodes_; ///< The operator and function nodes of the functions whose values depend on the variables or implicit parameters.  Not serialized, rebuilt on demand.
+		mutable std::vector< Nd > time_dependent_nodes_; ///< The operator and function nodes of the functions whose values depend on the path variable.  Not serialized, rebuilt on demand.
+
+		mutable bool have_precision_nodes_; ///< Whether precision_nodes_ is up to date with the functions, derivatives and variables.
+		mutable std::vector< Nd > precision_nodes_; ///< Every node of the system, each once, however many trees share it, whose precision changes with the system's.  Not serialized, rebuilt on demand.
+
+		mutable bool have_bounds_; ///< Whether degrees_ and coefficient_bound_ are up to date with the functions and variables.
+		mutable std::vector<int> degrees_; ///< The degrees of the functions with respect to Variables(), for DegreeBound.  Empty until asked for.  Not serialized.
+		mutable mpfr_float coefficient_bound_; ///< The estimate of CoefficientBound.  Not serialized.
+		mutable unsigned coefficient_bound_evaluations_; ///< The number of random points coefficient_bound_ was estimated from, 0 if none.
+
+		/**
+		\brief A term of a function, whose derivative with respect to the path variable is the derivative of its coefficient times and divided by its other factors.
+		*/
+		struct PathTerm
+		{
+			bool add; ///< Whether the term is added, rather than subtracted.
+			Jac coefficient_derivative; ///< The derivative of the factor depending only on the path variable.
+			std::vector< Nd > factors; ///< The other factors, nodes of the functions.
+			std::vector< bool > multiply; ///< Whether each factor multiplies, rather than divides.
+		};
+
+		mutable bool have_path_terms_; ///< Whether path_terms_ and has_path_terms_ are up to date with the functions.
+		mutable std::vector< std::vector< PathTerm > > path_terms_; ///< The terms of each function depending on the path variable.  Not serialized, rebuilt on demand.
+		mutable std::vector< bool > has_path_terms_; ///< Whether each function's derivative with respect to the path variable is computed from path_terms_, rather than its Jacobian.
+
 
 		friend class boost::serialization::access;
 
@@ -1344,6 +2799,8 @@ namespace bertini {
 
 			ar & variable_ordering_;
 			ar & have_ordering_;
+			if (Archive::is_loading::value)
+				BindVariables();
 
 			ar & implicit_parameters_;
 			ar & explicit_parameters_;
@@ -1376,6 +2833,17 @@ namespace bertini {
 	If the two patches have differing variable orderings, the call to Concatenate will throw.
 	*/
 	System Concatenate(System sys1, System const& sys2);
+
+
+
+	/**
+	\brief Make a deep copy of a system, sharing no nodes with the original.
+
+	The copy constructor of System is shallow, so copies share their function trees, and cannot be evaluated at the same time.  Use this to give each thread its own system.  The copy is made by serializing, so is not cheap.
+
+	\param sys The system to copy.
+	*/
+	System Clone(System const& sys);
 	
 
 
@@ -0,0 +1,118 @@
+//This file is part of Bertini 2.
+//
+//system_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file system_cache.hpp
+
+\brief Provides SystemCache, an on-disk cache of parsed and prepared systems.
+*/
+
+#ifndef BERTINI_SYSTEM_CACHE_HPP
+#define BERTINI_SYSTEM_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "bertini2/system.hpp"
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/classic/parsing.hpp"
+
+namespace bertini {
+
+	/**
+	\brief An opt-in on-disk cache of systems, keyed by the text they were made from.
+
+	Parsing a large input, and differentiating, homogenizing, and patching the result, can take much longer than loading the finished system.  A SystemCache keeps finished systems in a directory, one file each, named by a hash of the system text and of a string describing whatever else went into preparing them, such as the relevant settings.  The full text and settings are stored in the file too, and compared on loading, so a hash collision is a miss, not a wrong system.
+
+	Files are binary archives, so the cache is for one machine and one build.  Files from other builds fail to load, which is also a miss.
+
+	\code
+	SystemCache cache("b2_cache");
+	auto sys = cache.GetOrMake(split_input, settings_description,
+				[](System & s){ s.Homogenize(); s.AutoPatch(); s.Differentiate();});
+	\endcode
+	*/
+	class SystemCache
+	{
+	public:
+
+		/**
+		\param directory Where to keep the systems.  Made if it does not exist.
+		*/
+		SystemCache(boost::filesystem::path const& directory);
+
+		/**
+		\brief Get the system for an input file from the cache, or make it and put it in the cache.
+
+		\param input The split input file, whose Input() is the system text.
+		\param settings Anything else the prepared system depends on, such as the relevant config.  Part of the key.
+		\param prepare Called on the freshly parsed system, to differentiate, homogenize, patch, etc.  Not called on a hit.
+		*/
+		template<typename PrepareT>
+		System GetOrMake(classic::SplitInputFile const& input, std::string const& settings, PrepareT prepare) const
+		{
+			System sys;
+			if (Load(input.Input(), settings, sys))
+				return sys;
+
+			sys = System(input.Input());
+			prepare(sys);
+			Store(input.Input(), settings, sys);
+			return sys;
+		}
+
+		/**
+		\brief Load a cached system.
+
+		\return Whether there was a system cached for this text and settings.  If not, sys is unchanged.
+		*/
+		bool Load(std::string const& system_text, std::string const& settings, System & sys) const;
+
+		/**
+		\brief Put a system in the cache, replacing any there for the same text and settings.
+
+		The file is written under a temporary name, then renamed, so that concurrent runs never see a partial file.
+		*/
+		void Store(std::string const& system_text, std::string const& settings, System const& sys) const;
+
+		/**
+		\brief The file a system for this text and settings is kept in.
+		*/
+		boost::filesystem::path Path(std::string const& system_text, std::string const& settings) const;
+
+		/**
+		\brief The 64 bit FNV-1a hash of the text and settings.  Stable from run to run and build to build, unlike std::hash.
+		*/
+		static std::uint64_t Key(std::string const& system_text, std::string const& settings);
+
+	private:
+
+		boost::filesystem::path directory_;
+	};
+
+} // re: namespace bertini
+
+#endif
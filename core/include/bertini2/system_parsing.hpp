@@ -421,6 +421,8 @@ namespace bertini {
 			throw std::runtime_error("unable to correctly parse string in construction of system");
 		}
 
+		sys.MergeCommonSubexpressions();
+
 		using std::swap;
 		swap(sys,*this);
 	}
@@ -35,19 +35,147 @@
 #define BERTINI_SYSTEM_POOL_HPP
 
 #include "bertini2/detail/pool.hpp"
+#include "bertini2/detail/vector_pool.hpp"
 #include "bertini2/system.hpp"
 
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace bertini {
 
+	/**
+	\brief Holds systems, and manages the replicas of a prototype system, one per thread.
+
+	The nodes of a System are not safe to evaluate from several threads at once, so each thread evaluating needs its own copy.  The replicas are made by System::Clone, so each has its own nodes, and kept in step with the prototype: SetImplicitParameters, CopyPatches, and precision act on the prototype and every replica.  Call them while no thread is evaluating.
+
+	A replica is had by Acquire, which gives one no one else holds, cloning another if none is free, and given back by Release, for the next to take.  Or by ThreadReplica, which gives each calling thread the same replica every time, until the thread gives it back by ReleaseThreadReplica.  Replicas given back are kept, so holders coming and going reuse them rather than clone more, and the pool grows only to the most held at once.
+
+	\code
+	SystemPool pool(sys, num_threads);
+	// on each thread
+	auto my_sys = pool.Acquire();
+	my_sys->Eval(x);
+	pool.Release(my_sys);
+	\endcode
+	*/
 	class SystemPool : public detail::Pool<System>
 	{
-
+	public:
+
+		SystemPool() = default;
+
+		/**
+		\param prototype The system to replicate.  It is copied.
+		\param num_replicas The number of replicas to clone now.
+		*/
+		SystemPool(System const& prototype, unsigned num_replicas);
+
+		/**
+		\brief Replace the prototype, dropping the replicas of the old one, and clone new ones.
+		*/
+		void SetPrototype(System const& prototype, unsigned num_replicas);
+
+		System const& Prototype() const
+		{
+			return prototype_;
+		}
+
+		/**
+		\brief Clone replicas until there are at least this many.
+		*/
+		void Reserve(unsigned num_replicas);
+
+		unsigned NumReplicas() const;
+
+		/**
+		\brief Get a replica by index, whether held or not.
+
+		\throws std::out_of_range, if there is no such replica.
+		*/
+		std::shared_ptr<System> Replica(unsigned index) const;
+
+		/**
+		\brief Take a replica no one holds, cloning one if there are none.  Thread safe.
+
+		The cloning is done on the calling thread, so the replica's memory is allocated where the caller runs.
+		*/
+		std::shared_ptr<System> Acquire();
+
+		/**
+		\brief Give back a replica, had from Acquire or ThreadReplica, for the next to take.  Thread safe.
+
+		\throws std::invalid_argument, if the system is not a replica of this pool.
+		*/
+		void Release(std::shared_ptr<System> const& replica);
+
+		/**
+		\brief Get the replica of the calling thread, the same one every call from that thread.
+
+		A thread calling for the first time takes a replica, as by Acquire.  Thread safe.
+		*/
+		std::shared_ptr<System> ThreadReplica();
+
+		/**
+		\brief Give back the replica of the calling thread, if it has one, forgetting the thread.  Call before the thread ends.  Thread safe.
+		*/
+		void ReleaseThreadReplica();
+
+		/**
+		\brief The number of replicas held, by Acquire or ThreadReplica, and not given back.
+		*/
+		unsigned NumHeld() const;
+
+		/**
+		\brief Set the implicit parameters of the prototype and every replica, in both double and multiple precision.
+		*/
+		void SetImplicitParameters(Vec<mpfr> const& values);
+
+		/**
+		\brief Copy the patches of a system into the prototype and every replica.
+		*/
+		void CopyPatches(System const& patched);
+
+		/**
+		\brief Change the precision of the prototype and every replica.
+		*/
+		void precision(unsigned new_precision);
+
+		/**
+		\brief The total time spent cloning replicas, in seconds.
+		*/
+		double CloneSeconds() const
+		{
+			return clone_seconds_;
+		}
+
+		/**
+		\brief The memory held by the prototype and the replicas, by component.  The components of the replicas are summed, under the prefix "replicas: ".
+		*/
+		MemoryReport MemoryUsage() const;
+
+	private:
+
+		// assume the lock is held
+		void CloneReplica();
+		unsigned Take();
+
+		System prototype_;
+		std::vector< std::shared_ptr<System> > replicas_;
+		std::vector<bool> held_; ///< Whether each replica is held, and not given back.
+		std::map<std::thread::id, unsigned> thread_replicas_; ///< The replica held by each thread by ThreadReplica.
+		double clone_seconds_ = 0;
+		mutable std::mutex mutex_;
 	};
 
+	/**
+	\brief A pool of points, recycled by size and precision.  See detail::VectorPool.
+	*/
 	template<typename NumT>
-	class PointPool : public detail::Pool<Vec<NumT> >
+	class PointPool : public detail::VectorPool<NumT>
 	{
-
+	public:
+		using detail::VectorPool<NumT>::VectorPool;
 	};
 
 
@@ -0,0 +1,60 @@
+//This file is part of Bertini 2.
+//
+//system_reader.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_reader.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_reader.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file system_reader.hpp
+
+\brief Provides a hand-written reader for systems in Bertini Classic-style input, an alternative to the Qi SystemParser for large inputs.
+*/
+
+#ifndef BERTINI_SYSTEM_READER_HPP
+#define BERTINI_SYSTEM_READER_HPP
+
+#include <string>
+#include <thread>
+
+#include "bertini2/system.hpp"
+
+namespace bertini {
+
+	/**
+	\brief Read a system from the INPUT section of a Bertini Classic-style input file.
+
+	This is a hand-written recursive descent reader, which produces the same System as System(std::string), which uses the Qi SystemParser.  It does not backtrack, and looks up names in a hash table, so its time is linear in the length of the text.  Prefer it for large, machine-generated inputs.
+
+	It accepts the same declarations and expression syntax as SystemParser, including that a leading sign applies to the whole expression following it.  It is slightly more permissive about names: a new name may begin with a name already in use, like `ex` after `e`.
+
+	Reading happens in two passes.  The first handles the declarations, in order, and finds the extent of each definition `name = expression;`.  The second reads the expressions, which are independent once the names are known, spread over threads.  An expression may use only names declared before it, as in one pass.  Inputs shorter than about 64KB are read on the calling thread only, since they take less time than starting threads.
+
+	\param input The text of the system, with comments already removed, as from classic::SplitInputFile::Input().
+	\param num_threads The most threads to read expressions with, including the calling thread.
+	\return The system, with common subexpressions merged.
+
+	\throws std::runtime_error If the text is not a valid system.  The message says where reading stopped, at the first error in the text.
+	*/
+	System ReadSystem(std::string const& input, unsigned num_threads = std::thread::hardware_concurrency());
+
+} // re: namespace bertini
+
+#endif
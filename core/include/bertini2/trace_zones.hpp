@@ -0,0 +1,156 @@
+//This file is part of Bertini 2.
+//
+//trace_zones.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trace_zones.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trace_zones.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file trace_zones.hpp
+
+\brief Named zones around the phases of tracking, for external profilers, so that their timelines show TrackerIteration, Predict, Correct, and so on, rather than the template names of the trackers and endgames.
+
+Compiled in only when the library is configured with `--with-trace_zones=itt`, for VTune and other tools reading Intel's ITT API, or `--with-trace_zones=tracy`, for Tracy.  Otherwise BERTINI_TRACE_ZONE expands to nothing, and the zones cost nothing.
+
+\code
+SuccessCode Predict(...)
+{
+	BERTINI_TRACE_ZONE("Predict");
+	...
+}
+\endcode
+
+The zones are
+
+	TrackerIteration, Predict, Correct, ChangePrecision, CircleTrack, HermiteInterpolate
+
+and, from the TimeBreakdown::Scope of each kind of timed work, Eval, Jacobian, LU, AMPCriteria, and NotifyObservers.  The zones of the timed work are made whether or not the time breakdown of the tracker is enabled.
+*/
+
+#ifndef BERTINI_TRACE_ZONES_HPP
+#define BERTINI_TRACE_ZONES_HPP
+
+#include "bertini2/config.h"
+
+#if defined(BERTINI_TRACE_ZONES_ITT) || defined(BERTINI_TRACE_ZONES_TRACY)
+	#define BERTINI_TRACE_ZONES 1
+#endif
+
+#if defined(BERTINI_TRACE_ZONES_ITT)
+	#include <ittnotify.h>
+#elif defined(BERTINI_TRACE_ZONES_TRACY)
+	#include <tracy/Tracy.hpp>
+#endif
+
+#include <cstdint>
+
+
+namespace bertini {
+	namespace trace {
+
+	#if defined(BERTINI_TRACE_ZONES_ITT)
+
+		/**
+		\brief The domain of every zone of Bertini, made at first use.
+		*/
+		inline __itt_domain* Domain()
+		{
+			static __itt_domain* domain = __itt_domain_create("bertini2");
+			return domain;
+		}
+
+		/**
+		\brief Where a zone is, made once for each place a zone is opened.
+		*/
+		struct Site
+		{
+			Site(char const* name, char const*, char const*, std::uint32_t) : handle(__itt_string_handle_create(name))
+			{}
+
+			__itt_string_handle* handle;
+		};
+
+		/**
+		\brief A task of the ITT API, from construction to destruction.
+		*/
+		class Zone
+		{
+		public:
+			explicit Zone(Site const& site)
+			{
+				__itt_task_begin(Domain(), __itt_null, __itt_null, site.handle);
+			}
+
+			~Zone()
+			{
+				__itt_task_end(Domain());
+			}
+
+			Zone(Zone const&) = delete;
+			Zone& operator=(Zone const&) = delete;
+		};
+
+	#elif defined(BERTINI_TRACE_ZONES_TRACY)
+
+		/**
+		\brief Where a zone is, made once for each place a zone is opened.  Tracy keeps a pointer to it, so it must be static.
+		*/
+		struct Site
+		{
+			Site(char const* name, char const* function, char const* file, std::uint32_t line) : location{name, function, file, line, 0}
+			{}
+
+			tracy::SourceLocationData location;
+		};
+
+		/**
+		\brief A zone of Tracy, from construction to destruction.
+		*/
+		class Zone
+		{
+		public:
+			explicit Zone(Site const& site) : zone_(&site.location)
+			{}
+
+		private:
+			tracy::ScopedZone zone_;
+		};
+
+	#endif
+
+	} // re: namespace trace
+} // re: namespace bertini
+
+
+#define BERTINI_TRACE_CONCAT_IMPL(a, b) a##b
+#define BERTINI_TRACE_CONCAT(a, b) BERTINI_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef BERTINI_TRACE_ZONES
+	/**
+	Open a zone with a name, a string literal, until the end of the enclosing scope.
+	*/
+	#define BERTINI_TRACE_ZONE(name) \
+		static const ::bertini::trace::Site BERTINI_TRACE_CONCAT(bertini_trace_site_, __LINE__)(name, __func__, __FILE__, __LINE__); \
+		const ::bertini::trace::Zone BERTINI_TRACE_CONCAT(bertini_trace_zone_, __LINE__)(BERTINI_TRACE_CONCAT(bertini_trace_site_, __LINE__))
+#else
+	#define BERTINI_TRACE_ZONE(name) do {} while (false)
+#endif
+
+#endif
@@ -209,27 +209,29 @@ public:
 
 			auto prev_precision = DefaultPrecision();
 			auto temp_higher_prec = max(prev_precision,LowestMultiplePrecision())+ PrecisionIncrement();
-			DefaultPrecision(temp_higher_prec);
-			this->GetTracker().ChangePrecision(temp_higher_prec);
+			auto result_higher_prec = Vec<mpfr>(current_sample.size());
+			{
+				ScopedPrecision higher_precision(temp_higher_prec);
+				this->GetTracker().ChangePrecision(temp_higher_prec);
 
 
-			auto next_sample_higher_prec = current_sample;
-			Precision(next_sample_higher_prec, temp_higher_prec);
+				auto next_sample_higher_prec = current_sample;
+				Precision(next_sample_higher_prec, temp_higher_prec);
 
-			auto result_higher_prec = Vec<mpfr>(current_sample.size());
+				Precision(result_higher_prec, temp_higher_prec);
 
-			auto time_higher_precision = current_time;
-			Precision(time_higher_precision,temp_higher_prec);
+				auto time_higher_precision = current_time;
+				Precision(time_higher_precision,temp_higher_prec);
 
-			assert(time_higher_precision.precision()==DefaultPrecision());
-			RT refinement_tolerance = static_cast<RT>(this->Tolerances().final_tolerance)/100;
-			refinement_success = this->GetTracker().Refine(result_higher_prec,
-			                                               next_sample_higher_prec,
-			                                               time_higher_precision,
-		                          							refinement_tolerance,
-		                          							this->EndgameSettings().max_num_newton_iterations);
+				assert(time_higher_precision.precision()==DefaultPrecision());
+				RT refinement_tolerance = static_cast<RT>(this->Tolerances().final_tolerance)/100;
+				refinement_success = this->GetTracker().Refine(result_higher_prec,
+				                                               next_sample_higher_prec,
+				                                               time_higher_precision,
+			                          							refinement_tolerance,
+			                          							this->EndgameSettings().max_num_newton_iterations);
+			}
 
-			DefaultPrecision(prev_precision);
 			this->GetTracker().ChangePrecision(prev_precision);
 			result = result_higher_prec;
 			Precision(result, prev_precision);
@@ -253,26 +255,27 @@ public:
 		{
 			auto prev_precision = DoublePrecision();
 			auto temp_higher_prec = LowestMultiplePrecision();
-			DefaultPrecision(temp_higher_prec);
-			this->GetTracker().ChangePrecision(temp_higher_prec);
-
+			Vec<mpfr> result_higher_prec;
+			{
+				ScopedPrecision higher_precision(temp_higher_prec);
+				this->GetTracker().ChangePrecision(temp_higher_prec);
 
-			auto next_sample_higher_prec = Vec<mpfr>(current_sample.size());
-			for (int ii=0; ii<current_sample.size(); ++ii)
-				next_sample_higher_prec(ii) = mpfr(current_sample(ii));
 
-			auto result_higher_prec = Vec<mpfr>(current_sample.size());
-			mpfr time_higher_precision(current_time);
+				auto next_sample_higher_prec = Vec<mpfr>(current_sample.size());
+				for (int ii=0; ii<current_sample.size(); ++ii)
+					next_sample_higher_prec(ii) = mpfr(current_sample(ii));
 
-			mpfr_float refinement_tolerance = this->Tolerances().final_tolerance/100;
-			refinement_success = this->GetTracker().Refine(result_higher_prec,
-			                                               next_sample_higher_prec,
-			                                               time_higher_precision,
-		                          							refinement_tolerance,
-		                          							this->EndgameSettings().max_num_newton_iterations);
+				result_higher_prec.resize(current_sample.size());
+				mpfr time_higher_precision(current_time);
 
+				mpfr_float refinement_tolerance = this->Tolerances().final_tolerance/100;
+				refinement_success = this->GetTracker().Refine(result_higher_prec,
+				                                               next_sample_higher_prec,
+				                                               time_higher_precision,
+			                          							refinement_tolerance,
+			                          							this->EndgameSettings().max_num_newton_iterations);
+			}
 
-			DefaultPrecision(prev_precision);
 			this->GetTracker().ChangePrecision(prev_precision);
 			for (unsigned ii(0); ii<current_sample.size(); ++ii)
 				result(ii) = dbl(result_higher_prec(ii));
@@ -44,6 +44,72 @@ namespace bertini{
 			using AdaptiveMultiplePrecisionConfig = config::AdaptiveMultiplePrecisionConfig;
 
 
+			/**
+			\brief Whether a real number converts to double without overflowing or underflowing, so that the logarithms of the criteria may be taken of it in double precision.
+
+			The right hand sides of the criteria are counts of digits, so double precision is plenty for them, and much cheaper than multiple precision.
+			*/
+			inline
+			bool InDoubleRange(double)
+			{
+				return true;
+			}
+
+			inline
+			bool InDoubleRange(mpfr_float const& x)
+			{
+				const double d = static_cast<double>(x);
+				return std::isnormal(d) || (d==0 && x==0);
+			}
+
+
+			/**
+			\brief Estimate the norm of the inverse of the Jacobian from its LU factorization, in the way chosen in the AMP settings.
+
+			\param LU The factorization of the Jacobian.
+			\param AMP_config The settings for adaptive multiple precision.
+
+			\see config::NormJInverseEstimator
+			*/
+			template<typename ComplexType>
+			typename Eigen::NumTraits<ComplexType>::Real NormJInverse(Eigen::PartialPivLU<Mat<ComplexType>> const& LU, AdaptiveMultiplePrecisionConfig const& AMP_config)
+			{
+				if (AMP_config.norm_J_inverse_estimator==config::NormJInverseEstimator::OneNorm)
+					return InverseOneNormEstimate(LU);
+				else
+					return LU.solve(RandomOfUnits<ComplexType>(LU.matrixLU().rows())).norm();
+			}
+
+
+			/**
+			\brief Estimate the norm of the inverse of the Jacobian from its LU factorization, in the way chosen in the AMP settings, without allocating.
+
+			The random-solve estimate is computed in the given vector, so the tracker's hot path does not make a temporary at every step.
+
+			\param LU The factorization of the Jacobian.
+			\param AMP_config The settings for adaptive multiple precision.
+			\param workspace Scratch space for the random right hand side.  Resized if it is not already the size of the Jacobian.
+			*/
+			template<typename ComplexType>
+			typename Eigen::NumTraits<ComplexType>::Real NormJInverse(Eigen::PartialPivLU<Mat<ComplexType>> const& LU, AdaptiveMultiplePrecisionConfig const& AMP_config, Vec<ComplexType> & workspace)
+			{
+				if (AMP_config.norm_J_inverse_estimator==config::NormJInverseEstimator::OneNorm)
+					return InverseOneNormEstimate(LU);
+
+				auto const& lu = LU.matrixLU();
+				if (workspace.size()!=lu.rows())
+					workspace.resize(lu.rows());
+				for (int ii = 0; ii < workspace.size(); ++ii)
+					workspace(ii) = RandomUnit<ComplexType>();
+
+				// solve in place, rather than through LU.solve, which makes a temporary for its result
+				workspace.applyOnTheLeft(LU.permutationP());
+				lu.template triangularView<Eigen::UnitLower>().solveInPlace(workspace);
+				lu.template triangularView<Eigen::Upper>().solveInPlace(workspace);
+				return workspace.norm();
+			}
+
+
 			/**
 			\brief Check AMP Criterion A.
 
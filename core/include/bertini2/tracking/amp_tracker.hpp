@@ -75,17 +75,17 @@ namespace bertini{
 		 From \cite AMP2, \f$C(P)\f$.  As currently implemented, this is 
 		 \f$ 10.35 + 0.13 P \f$, where P is the precision.
 		
-		 This function tells you the relative cost of arithmetic at a given precision. 
+		 This function tells you the relative cost of arithmetic at a given precision.  It is a double, being called several times on every step, and a ratio of costs needing no more.
 
 		 \todo Recompute this cost function for boost::multiprecision::mpfr_float
 		*/
 		inline
-		mpfr_float ArithmeticCost(unsigned precision)
+		double ArithmeticCost(unsigned precision)
 		{
 			if (precision==DoublePrecision())
 				return 1;
 			else
-				return mpfr_float("10.35") + mpfr_float("0.13") * precision;
+				return 10.35 + 0.13 * precision;
 		}
 
 
@@ -142,6 +142,8 @@ namespace bertini{
 		 \param AMP_config The configuration of AMP settings for tracking.
 		 \param predictor_order The order of the predictor being used.  This is the order itself, not the order of the error estimate.
 
+		 The costs are compared by their logarithms, in double precision, since the log of the stepsize satisfying Criterion B is linear in the precision.  So the search over precisions does no multiple precision arithmetic, and only the minimizing stepsize is computed in multiple precision.
+
 		 \see ArithmeticCost
 		*/
  		template <typename RealType>
@@ -152,22 +154,26 @@ namespace bertini{
 						  unsigned num_newton_iterations,
 						  unsigned predictor_order = 0)
 		{
-			mpfr_float min_cost = Eigen::NumTraits<mpfr_float>::highest();
+			double min_log_cost = std::numeric_limits<double>::infinity();
+			bool min_is_capped = false;
 			new_precision = MaxPrecisionAllowed()+1; // initialize to an impossible value.
-			new_stepsize = old_stepsize; // initialize to original step size.
+
+			const double rhs = static_cast<double>(criterion_B_rhs);
+			const double log_max_stepsize = static_cast<double>(log10(max_stepsize));
 
 			auto minimizer_routine = 
-				[&min_cost, &new_stepsize, &new_precision, criterion_B_rhs, num_newton_iterations, predictor_order, max_stepsize](unsigned candidate_precision)
+				[&min_log_cost, &min_is_capped, &new_precision, rhs, num_newton_iterations, predictor_order, log_max_stepsize](unsigned candidate_precision)
 				{
-					mpfr_float candidate_stepsize = min(StepsizeSatisfyingCriterionB(candidate_precision, criterion_B_rhs, num_newton_iterations, predictor_order),
-					                              max_stepsize);
+					// log10 of StepsizeSatisfyingCriterionB
+					const double log_stepsize = -(rhs - candidate_precision)*num_newton_iterations/(predictor_order+1);
+					const bool capped = log_stepsize >= log_max_stepsize;
 
-					mpfr_float current_cost = ArithmeticCost(candidate_precision) / abs(candidate_stepsize);
+					const double log_cost = std::log10(ArithmeticCost(candidate_precision)) - (capped ? log_max_stepsize : log_stepsize);
 
-					if (current_cost < min_cost)
+					if (log_cost < min_log_cost)
 					{
-						min_cost = current_cost;
-						new_stepsize = candidate_stepsize;
+						min_log_cost = log_cost;
+						min_is_capped = capped;
 						new_precision = candidate_precision;
 					}
 				};
@@ -191,6 +197,94 @@ namespace bertini{
 
 			for (unsigned candidate_precision = lowest_mp_precision_to_test; candidate_precision <= max_precision; candidate_precision+=PrecisionIncrement())
 				minimizer_routine(candidate_precision);
+
+			if (new_precision > MaxPrecisionAllowed())
+				new_stepsize = old_stepsize; // no candidates, so the original step size.
+			else if (min_is_capped)
+				new_stepsize = max_stepsize;
+			else
+				new_stepsize = StepsizeSatisfyingCriterionB(new_precision, criterion_B_rhs, num_newton_iterations, predictor_order);
+		}
+
+
+		/**
+		 \brief Whether decreasing precision saves more arithmetic than changing precision costs.
+
+		 Tracking for a number of steps at the current precision costs that many ArithmeticCost()s of it.  Covering the same time at the lower precision costs that many of its cost, scaled by the ratio of the stepsizes, plus the cost of changing precision.
+
+		 \param current_precision The precision tracked at.
+		 \param current_stepsize The stepsize of least cost at the current precision.
+		 \param new_precision The lower precision.
+		 \param new_stepsize The stepsize of least cost at the lower precision.
+		 \param change_cost The cost of changing precision, in steps at the current precision.
+		 \param horizon The number of steps over which to amortize the change.
+
+		 \see AdaptiveMultiplePrecisionConfig::precision_change_cost
+		*/
+		inline
+		bool PrecisionDecreasePaysOff(unsigned current_precision, mpfr_float const& current_stepsize,
+		                              unsigned new_precision, mpfr_float const& new_stepsize,
+		                              double change_cost, unsigned horizon)
+		{
+			const double stay = horizon * ArithmeticCost(current_precision);
+			const double go = horizon * ArithmeticCost(new_precision) * static_cast<double>(current_stepsize/new_stepsize) + change_cost * ArithmeticCost(current_precision);
+			return go < stay;
+		}
+
+
+		/**
+		 \brief Compute predictor, precision and stepsize minimizing the cost of tracking, over the predictors with error estimates.
+
+		 The stepsize and precision for each predictor are those of MinimizeTrackingCost for its order, and its cost per unit of time the ArithmeticCost() of the precision, times its predict::EvaluationsPerStep(), over the stepsize.  So a higher order predictor is chosen where its longer steps pay for its extra stages, and a lower order one where the stepsize is capped anyway.
+
+		 \param[in,out] predictor The predictor in use, and on return the minimizing one.  Another is chosen only if strictly cheaper.
+		 \param[out] new_precision The minimizing precision.
+		 \param[out] new_stepsize The minimizing stepsize.
+		 \param[in] min_precision The minimum considered precision.
+		 \param[in] old_stepsize The previously used stepsize.
+		 \param[in] max_precision The maximum considered precision.
+		 \param[in] max_stepsize The maximum permitted stepsize.
+		 \param[in] criterion_B_rhs The right hand side of CriterionB from \cite AMP1, \cite AMP2
+		 \param num_newton_iterations The number of allowed Newton corrector iterations.
+
+		 \see MinimizeTrackingCost
+		*/
+		template <typename RealType>
+		void MinimizeTrackingCostOverPredictors(config::Predictor & predictor,
+						  unsigned & new_precision, mpfr_float & new_stepsize,
+						  unsigned min_precision, mpfr_float const& old_stepsize,
+						  unsigned max_precision, mpfr_float const& max_stepsize,
+						  mpfr_float const& criterion_B_rhs,
+						  unsigned num_newton_iterations)
+		{
+			auto cost = [&](config::Predictor candidate, unsigned & candidate_precision, mpfr_float & candidate_stepsize)
+			{
+				MinimizeTrackingCost<RealType>(candidate_precision, candidate_stepsize,
+							min_precision, old_stepsize,
+							max_precision, max_stepsize,
+							criterion_B_rhs, num_newton_iterations,
+							predict::Order(candidate));
+				return mpfr_float(predict::EvaluationsPerStep(candidate) * ArithmeticCost(candidate_precision) / abs(candidate_stepsize));
+			};
+
+			mpfr_float min_cost = cost(predictor, new_precision, new_stepsize);
+
+			for (auto candidate : {config::Predictor::HeunEuler, config::Predictor::RKF45, config::Predictor::RKDormandPrince56, config::Predictor::RKVerner67})
+			{
+				if (candidate==predictor)
+					continue;
+
+				unsigned candidate_precision;
+				mpfr_float candidate_stepsize;
+				mpfr_float candidate_cost = cost(candidate, candidate_precision, candidate_stepsize);
+				if (candidate_cost < min_cost)
+				{
+					min_cost = candidate_cost;
+					predictor = candidate;
+					new_precision = candidate_precision;
+					new_stepsize = candidate_stepsize;
+				}
+			}
 		}
 
 
@@ -332,6 +426,14 @@ namespace bertini{
 				AMP_config_ = AMP_config;
 			}
 
+			/**
+			\brief The config for adaptive precision, set during PrecisionSetup.
+			*/
+			config::AdaptiveMultiplePrecisionConfig const& PrecisionSettings() const
+			{
+				return AMP_config_;
+			}
+
 
 			
 			/**
@@ -365,6 +467,23 @@ namespace bertini{
 			}
 
 
+			Vec<mpfr> CurrentPathDerivative() const override
+			{
+				if (this->CurrentPrecision()==DoublePrecision())
+				{
+					const auto derivative = this->PathDerivative(std::get<Vec<dbl>>(this->current_space_), dbl(this->current_time_));
+					Vec<mpfr> returnme(NumVariables());
+					for (unsigned ii = 0; ii < NumVariables(); ++ii)
+					{
+						returnme(ii) = mpfr(derivative(ii));
+					}
+					return returnme;
+				}
+				else
+					return this->PathDerivative(std::get<Vec<mpfr>>(this->current_space_), this->current_time_);
+			}
+
+
 		private:
 
 			/**
@@ -389,8 +508,9 @@ namespace bertini{
 				         );
 				#endif
 
-				NotifyObservers(Initializing<AMPTracker,mpfr>(*this,start_time, end_time, start_point));
+				NotifyObservers<Initializing<AMPTracker,mpfr>>(*this,start_time, end_time, start_point);
 
+				initial_predictor_ = predictor_->PredictorMethod();
 				initial_precision_ = Precision(start_point(0));
 				DefaultPrecision(initial_precision_);
 				// set up the master current time and the current step size
@@ -430,7 +550,7 @@ namespace bertini{
 			//                                dbl const& end_time,
 			// 							   Vec<dbl> const& start_point) const override
 			// {
-			// 	NotifyObservers(Initializing<AMPTracker,dbl>(*this,start_time, end_time, start_point));
+			// 	NotifyObservers<Initializing<AMPTracker,dbl>>(*this,start_time, end_time, start_point);
 
 			// 	// set up the master current time and the current step size
 			// 	initial_precision_ = Precision(DoublePrecision());
@@ -457,6 +577,8 @@ namespace bertini{
 				num_precision_decreases_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
 				num_successful_steps_since_precision_decrease_ = 0;
+				num_predictor_changes_ = 0;
+				num_avoided_precision_decreases_ = 0;
 				// initialize to the frequency so guaranteed to compute it the first try 	
 				num_steps_since_last_condition_number_computation_ = this->stepping_config_.frequency_of_CN_estimation;
 			}
@@ -474,7 +596,7 @@ namespace bertini{
 					do {
 						if (current_precision_ > AMP_config_.maximum_precision)
 						{
-							NotifyObservers(SingularStartPoint<EmitterType>(*this));
+							NotifyObservers<SingularStartPoint<EmitterType>>(*this);
 							return SuccessCode::SingularStartPoint;
 						}
 
@@ -518,7 +640,9 @@ namespace bertini{
 			{
 				if (preserve_precision_)
 					ChangePrecision(initial_precision_);
-				NotifyObservers(TrackingEnded<EmitterType>(*this));
+				if (predictor_->PredictorMethod()!=initial_predictor_)
+					SwitchPredictor(initial_predictor_);
+				NotifyObservers<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -581,6 +705,7 @@ namespace bertini{
 			*/
 			SuccessCode TrackerIteration() const override
 			{
+				BERTINI_TRACE_ZONE("TrackerIteration");
 				if (current_precision_==DoublePrecision())
 					return TrackerIteration<dbl, double>();
 				else
@@ -606,7 +731,7 @@ namespace bertini{
 				assert(PrecisionSanityCheck() && "precision sanity check failed.  some internal variable is not in correct precision");
 				#endif
 
-				NotifyObservers(NewStep<EmitterType>(*this));
+				NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<ComplexType>& predicted_space = std::get<Vec<ComplexType> >(temporary_space_); // this will be populated in the Predict step
 				Vec<ComplexType>& current_space = std::get<Vec<ComplexType> >(current_space_); // the thing we ultimately wish to update
@@ -616,7 +741,7 @@ namespace bertini{
 				SuccessCode predictor_code = Predict<ComplexType, RealType>(predicted_space, current_space, current_time, delta_t);
 				if (predictor_code==SuccessCode::MatrixSolveFailureFirstPartOfPrediction)
 				{
-					NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 					next_stepsize_ = current_stepsize_;
 
 					if (current_precision_==DoublePrecision())
@@ -630,19 +755,27 @@ namespace bertini{
 				}
 				else if (predictor_code==SuccessCode::MatrixSolveFailure)
 				{
-					NotifyObservers(PredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<PredictorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();// decrease stepsize, and adjust precision as necessary
 					return predictor_code;
 				}	
 				else if (predictor_code==SuccessCode::HigherPrecisionNecessary)
 				{	
-					NotifyObservers(PredictorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<PredictorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return predictor_code;
 				}
+				else if (predictor_code==SuccessCode::ReduceStepSize)
+				{
+					// longer than the predictor trusts, near a singularity of the path
+					next_precision_ = current_precision_;
+					next_stepsize_ = predictor_->SafeStepSize();
+					UpdatePrecisionAndStepsize();
+					return predictor_code;
+				}
 
 
-				NotifyObservers(SuccessfulPredict<AMPTracker, ComplexType>(*this, predicted_space));
+				NotifyObservers<SuccessfulPredict<AMPTracker, ComplexType>>(*this, predicted_space);
 
 				Vec<ComplexType>& tentative_next_space = std::get<Vec<ComplexType> >(tentative_space_); // this will be populated in the Correct step
 
@@ -654,13 +787,13 @@ namespace bertini{
 
 				if (corrector_code==SuccessCode::MatrixSolveFailure || corrector_code==SuccessCode::FailedToConverge)
 				{
-					NotifyObservers(CorrectorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();
 					return corrector_code;
 				}
 				else if (corrector_code == SuccessCode::HigherPrecisionNecessary)
 				{
-					NotifyObservers(CorrectorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<CorrectorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return corrector_code;
 				}
@@ -670,11 +803,21 @@ namespace bertini{
 					return corrector_code;
 				}
 
-				NotifyObservers(SuccessfulCorrect<AMPTracker, ComplexType>(*this, tentative_next_space));
+				NotifyObservers<SuccessfulCorrect<AMPTracker, ComplexType>>(*this, tentative_next_space);
+
+				// with the PI controller, the next stepsize follows the error of this prediction
+				double step_size_factor = static_cast<double>(stepping_config_.step_size_success_factor);
+				if (stepping_config_.step_size_controller==config::StepSizeController::PI)
+				{
+					double prediction_error = static_cast<double>((tentative_next_space - predicted_space).norm());
+					if (predictor_->HasErrorEstimate())
+						prediction_error = std::max(prediction_error, static_cast<double>(std::get<RealType>(error_estimate_)));
+					step_size_factor = ControlledStepSizeFactor(prediction_error);
+				}
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
-				return AdjustAMPStepSuccess<ComplexType,RealType>();
+				return AdjustAMPStepSuccess<ComplexType,RealType>(step_size_factor);
 			}
 
 
@@ -689,6 +832,38 @@ namespace bertini{
 					return Base::CheckGoingToInfinity<mpfr>();
 			}
 
+			/**
+			Switch the patch if the current point is large.
+			*/
+			void SwitchPatchIfLarge() const override
+			{
+				if (current_precision_ == DoublePrecision())
+					Base::SwitchPatchIfLarge<dbl>();
+				else
+					Base::SwitchPatchIfLarge<mpfr>();
+			}
+
+			/**
+			Estimate the initial stepsize, at the current precision.
+			*/
+			void EstimateInitialStepSize() const override
+			{
+				if (current_precision_ == DoublePrecision())
+					Base::EstimateInitialStepSize<dbl>();
+				else
+					Base::EstimateInitialStepSize<mpfr>();
+			}
+
+			/**
+			\brief Change the predictor in the middle of a path, at the current precision.
+			*/
+			void SwitchPredictor(config::Predictor new_predictor) const
+			{
+				predictor_->PredictorMethod(new_predictor);
+				predictor_order_ = predictor_->Order();
+			}
+
+
 			/**
 			\brief Commit the next precision and stepsize, and adjust internals.
 
@@ -718,19 +893,28 @@ namespace bertini{
 			If the most recent step was successful, maybe adjust down precision and up stepsize.  
 
 			The number of consecutive successful steps is recorded as state in this class, and if this number exceeds a user-determine threshold, the precision or stepsize are allowed to favorably change.  If not, then precision can only go up or remain the same.  Stepsize can only decrease.  These changes depend on the AMP criteria and current tracking tolerance.
+
+			With StepSizeController::PI, the stepsize may change after every successful step, up to the factor proposed by the controller.
+
+			With a precision_change_cost in the AMP settings, a lower precision is kept to only if it pays for the change, see PrecisionDecreasePaysOff, else precision stays and the decrease is counted as avoided.
+
+			\param step_size_factor The most the stepsize may grow by, the success factor, or the controller's proposal.
 			*/
 			template <typename ComplexType, typename RealType>
-			SuccessCode AdjustAMPStepSuccess() const
+			SuccessCode AdjustAMPStepSuccess(double step_size_factor) const
 			{
+				const bool controlled = stepping_config_.step_size_controller==config::StepSizeController::PI;
 				mpfr_float min_stepsize = current_stepsize_ * stepping_config_.step_size_fail_factor;
-				mpfr_float max_stepsize = min(mpfr_float(current_stepsize_ * stepping_config_.step_size_success_factor), stepping_config_.max_step_size);
+				mpfr_float max_stepsize = min(mpfr_float(current_stepsize_ * step_size_factor), stepping_config_.max_step_size);
 
 
 				unsigned min_precision = MinRequiredPrecision_BCTol<ComplexType, RealType>();
 				unsigned max_precision = max(min_precision,current_precision_);
 
-				if (num_successful_steps_since_stepsize_increase_ < stepping_config_.consecutive_successful_steps_before_stepsize_increase)
+				const bool stepsize_may_grow = controlled || num_successful_steps_since_stepsize_increase_ >= stepping_config_.consecutive_successful_steps_before_stepsize_increase;
+				if (!stepsize_may_grow)
 					max_stepsize = current_stepsize_; // disallow stepsize changing 
+				max_stepsize = min(max_stepsize, mpfr_float(predictor_->SafeStepSize()));
 
 
 				if ( (num_successful_steps_since_precision_decrease_ < AMP_config_.consecutive_successful_steps_before_precision_decrease)
@@ -739,15 +923,52 @@ namespace bertini{
 					min_precision = max(min_precision, current_precision_); // disallow precision changing 
 
 
-				MinimizeTrackingCost<RealType>(next_precision_, next_stepsize_, 
+				const mpfr_float criterion_B_rhs = B_RHS<ComplexType, RealType>();
+
+				// the predictor changes only when the stepsize may, so that its longer or shorter steps count
+				auto next_predictor = predictor_->PredictorMethod();
+				if (AMP_config_.adaptive_predictor && stepsize_may_grow)
+					MinimizeTrackingCostOverPredictors<RealType>(next_predictor, next_precision_, next_stepsize_, 
 							min_precision, min_stepsize,
 							max_precision, max_stepsize,
-							B_RHS<ComplexType, RealType>(),
+							criterion_B_rhs,
+							newton_config_.max_num_newton_iterations);
+				else
+					MinimizeTrackingCost<RealType>(next_precision_, next_stepsize_, 
+							min_precision, min_stepsize,
+							max_precision, max_stepsize,
+							criterion_B_rhs,
 							newton_config_.max_num_newton_iterations,
 							predictor_order_);
 
+				if (next_precision_ < current_precision_ && AMP_config_.precision_change_cost > 0)
+				{
+					unsigned kept_precision;
+					mpfr_float kept_stepsize;
+					MinimizeTrackingCost<RealType>(kept_precision, kept_stepsize,
+							current_precision_, min_stepsize,
+							current_precision_, max_stepsize,
+							criterion_B_rhs,
+							newton_config_.max_num_newton_iterations,
+							predict::Order(next_predictor));
 
-				if ( (next_stepsize_ > current_stepsize_) || (next_precision_ < current_precision_) )
+					if (!PrecisionDecreasePaysOff(current_precision_, kept_stepsize, next_precision_, next_stepsize_,
+					                              AMP_config_.precision_change_cost,
+					                              max(AMP_config_.consecutive_successful_steps_before_precision_decrease, 1u)))
+					{
+						next_precision_ = kept_precision;
+						next_stepsize_ = kept_stepsize;
+						++num_avoided_precision_decreases_;
+					}
+				}
+
+				if (next_predictor!=predictor_->PredictorMethod())
+				{
+					SwitchPredictor(next_predictor);
+					++num_predictor_changes_;
+					num_successful_steps_since_stepsize_increase_ = 0;
+				}
+				else if ( (next_stepsize_ > current_stepsize_) || (next_precision_ < current_precision_) )
 					num_successful_steps_since_stepsize_increase_ = 0;
 				else
 					num_successful_steps_since_stepsize_increase_++;
@@ -867,15 +1088,29 @@ namespace bertini{
 
 			/**
 			\brief Get the raw right-hand side of Criterion B based on current state.
+
+			Evaluated in double precision when its inputs are in the range of double, whatever the precision of tracking.
 			*/
 			template<typename ComplexType, typename RealType>
 			RealType B_RHS() const
 			{	
-				return max(amp::CriterionBRHS(std::get<RealType>(norm_J_), 
-				           					  std::get<RealType>(norm_J_inverse_), 
+				auto const& norm_J = std::get<RealType>(norm_J_);
+				auto const& norm_J_inverse = std::get<RealType>(norm_J_inverse_);
+				auto const& size_proportion = std::get<RealType>(size_proportion_);
+				if (amp::InDoubleRange(norm_J) && amp::InDoubleRange(norm_J_inverse) && amp::InDoubleRange(size_proportion) && amp::InDoubleRange(tracking_tolerance_))
+					return RealType(std::max(amp::CriterionBRHS(static_cast<double>(norm_J),
+					                                            static_cast<double>(norm_J_inverse),
+					                                            newton_config_.max_num_newton_iterations,
+					                                            static_cast<double>(tracking_tolerance_),
+					                                            static_cast<double>(size_proportion),
+					                                            AMP_config_),
+					                             0.0));
+
+				return max(amp::CriterionBRHS(norm_J, 
+				           					  norm_J_inverse, 
 				           					  newton_config_.max_num_newton_iterations, 
 				           					  RealType(tracking_tolerance_), 
-				           					  std::get<RealType>(size_proportion_), 
+				           					  size_proportion, 
 				           					  AMP_config_),
 				            RealType(0));
 			}
@@ -909,13 +1144,24 @@ namespace bertini{
 			
 
 			/**
-			\brief Get the raw right-hand side of Criterion B based on current state.
+			\brief Get the raw right-hand side of Criterion C based on current state.
+
+			Evaluated in double precision when its inputs are in the range of double, whatever the precision of tracking.
 			*/
 			template<typename ComplexType, typename RealType>
 			RealType C_RHS() const
 			{	
-				return max(amp::CriterionCRHS(std::get<RealType>(norm_J_inverse_), 
-				                              std::get<Vec<ComplexType> > (current_space_).norm(), 
+				auto const& norm_J_inverse = std::get<RealType>(norm_J_inverse_);
+				const RealType norm_z = std::get<Vec<ComplexType> > (current_space_).norm();
+				if (amp::InDoubleRange(norm_J_inverse) && amp::InDoubleRange(norm_z) && amp::InDoubleRange(tracking_tolerance_))
+					return RealType(std::max(amp::CriterionCRHS(static_cast<double>(norm_J_inverse),
+					                                            static_cast<double>(norm_z),
+					                                            static_cast<double>(tracking_tolerance_),
+					                                            AMP_config_),
+					                             0.0));
+
+				return max(amp::CriterionCRHS(norm_J_inverse, 
+				                              norm_z, 
 				                              RealType(tracking_tolerance_), 
 				                              AMP_config_),
 				           RealType(0));
@@ -993,7 +1239,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Tracker::IncrementBaseCountersSuccess();
-				NotifyObservers(SuccessfulStep<EmitterType>(*this));
+				NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -1004,14 +1250,14 @@ namespace bertini{
 				Tracker::IncrementBaseCountersFail();
 				num_successful_steps_since_precision_decrease_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
-				NotifyObservers(FailedStep<EmitterType>(*this));
+				NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 
@@ -1045,6 +1291,7 @@ namespace bertini{
 								const Eigen::MatrixBase<Derived>& current_space,
 								ComplexType const& current_time, ComplexType const& delta_t) const
 			{
+				BERTINI_TRACE_ZONE("Predict");
 				
 								
 				
@@ -1110,6 +1357,7 @@ namespace bertini{
 								Vec<ComplexType> const& current_space, 
 								ComplexType const& current_time) const
 			{
+				BERTINI_TRACE_ZONE("Correct");
 				static_assert(std::is_same<	typename Eigen::NumTraits<RealType>::Real, 
 			              				typename Eigen::NumTraits<ComplexType>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
@@ -1301,8 +1549,11 @@ namespace bertini{
 				if (new_precision==current_precision_) // no op
 					return SuccessCode::Success;
 
-				NotifyObservers(PrecisionChanged<EmitterType>(*this,current_precision_,new_precision));
+				TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::PrecisionChange);
+
+				NotifyObservers<PrecisionChanged<EmitterType>>(*this,current_precision_,new_precision);
 				
+				jacobian_cache_->Invalidate();
 
 				bool upsampling_needed = new_precision > current_precision_;
 				// reset the counter for estimating the condition number.  
@@ -1619,6 +1870,9 @@ namespace bertini{
 			mutable unsigned num_precision_decreases_; ///< The number of times precision has decreased this track.
 			mutable unsigned initial_precision_; ///< The precision at the start of tracking.
 			mutable unsigned num_successful_steps_since_precision_decrease_; ///< The number of successful steps since decreased precision.
+			mutable config::Predictor initial_predictor_; ///< The predictor at the start of tracking, restored after it with adaptive_predictor.
+			mutable unsigned num_predictor_changes_ = 0; ///< The number of times the predictor has changed this track.
+			mutable unsigned num_avoided_precision_decreases_ = 0; ///< The number of precision decreases not taken this track, as not paying for the change.
 
 			mutable mpfr endtime_highest_precision_;
 
@@ -1639,6 +1893,22 @@ namespace bertini{
 			{
 				return current_precision_;
 			}
+
+			/**
+			\brief The number of times the predictor changed on the most recent path, with the adaptive_predictor setting.
+			*/
+			unsigned NumPredictorChanges() const
+			{
+				return num_predictor_changes_;
+			}
+
+			/**
+			\brief The number of precision decreases not taken on the most recent path, as not paying for the change, with the precision_change_cost setting.
+			*/
+			unsigned NumAvoidedPrecisionDecreases() const
+			{
+				return num_avoided_precision_decreases_;
+			}
 		}; // re: class Tracker
 
 	} // namespace tracking
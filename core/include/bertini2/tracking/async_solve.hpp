@@ -0,0 +1,343 @@
+//This file is part of Bertini 2.
+//
+//async_solve.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//async_solve.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with async_solve.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file async_solve.hpp
+
+\brief Contains SolveAsync, which solves a system by a total degree homotopy in the background, on a pool of threads shared by the process, for programs such as services which embed Bertini and must not block.
+*/
+
+#ifndef BERTINI_TRACKING_ASYNC_SOLVE_HPP
+#define BERTINI_TRACKING_ASYNC_SOLVE_HPP
+
+#include "bertini2/tracking/parallel_solver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief A pool of threads running the jobs submitted to it, in the order submitted.
+
+		Each solve submitted by SolveAsync is one job, tracking its paths on the thread running it, and on threads of its own if asked for more than one.  Use the pool shared by the process, Shared, unless some solves must not wait behind others.
+		*/
+		class SolveExecutor
+		{
+		public:
+
+			/**
+			\param num_threads The number of solves run at once.  Defaults to the number of hardware threads.
+			*/
+			explicit SolveExecutor(unsigned num_threads = std::thread::hardware_concurrency())
+			{
+				num_threads = std::max(num_threads, 1u);
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					threads_.emplace_back([this]{ Work(); });
+			}
+
+			/**
+			\brief Runs the jobs already submitted, then joins the threads.  Cancel the solves first to be quick.
+			*/
+			~SolveExecutor()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					stopping_ = true;
+				}
+				job_ready_.notify_all();
+				for (auto& t : threads_)
+					t.join();
+			}
+
+			SolveExecutor(SolveExecutor const&) = delete;
+			SolveExecutor& operator=(SolveExecutor const&) = delete;
+
+			/**
+			\brief Queue a job, run by the first free thread.  Exceptions thrown by it are the job's to catch.
+			*/
+			void Submit(std::function<void()> job)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					jobs_.push_back(std::move(job));
+				}
+				job_ready_.notify_one();
+			}
+
+			unsigned NumThreads() const
+			{
+				return static_cast<unsigned>(threads_.size());
+			}
+
+			/**
+			\brief The pool shared by the process, with a thread per hardware thread, made at first use.
+			*/
+			static SolveExecutor& Shared()
+			{
+				static SolveExecutor shared;
+				return shared;
+			}
+
+		private:
+
+			void Work()
+			{
+				for (;;)
+				{
+					std::function<void()> job;
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						job_ready_.wait(lock, [this]{ return stopping_ || !jobs_.empty();});
+						if (jobs_.empty())
+							return;
+						job = std::move(jobs_.front());
+						jobs_.pop_front();
+					}
+					job();
+				}
+			}
+
+			std::vector<std::thread> threads_;
+			std::deque<std::function<void()>> jobs_;
+			std::mutex mutex_; ///< Guards the jobs and stopping_.
+			std::condition_variable job_ready_;
+			bool stopping_ = false;
+		};
+
+
+
+		/**
+		\brief How SolveAsync solves a system.
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam EndgameType The type of endgame to use.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		struct AsyncSolveSettings
+		{
+			using Solver = ParallelSolver<TrackerType, EndgameType>;
+
+			typename Solver::TrackerSetup tracker_setup; ///< Called once on each tracker, to set its predictor, tolerances, and precision settings.  Required.
+			typename Solver::EndgameFactory endgame_factory; ///< Makes each endgame from its tracker.  The endgame with default settings, if empty.
+			unsigned num_threads = 1; ///< The threads of the solve, including the executor's thread running it.  One, so that the executor runs as many solves at once as it has threads.
+			std::function<bool(typename Solver::PathResult const&)> on_result; ///< Called with each path's result as it finishes, never from two threads at once.  Returning false cancels the solve, say once there are enough real solutions.
+			SolveExecutor* executor = nullptr; ///< Where the solve runs.  The shared executor, if null.
+		};
+
+
+
+		/**
+		\brief A solve running in the background, as started by SolveAsync.
+
+		Copies refer to the same solve.  Dropping every handle neither cancels the solve nor waits for it.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class SolveHandle
+		{
+		public:
+			using Solver = ParallelSolver<TrackerType, EndgameType>;
+			using PathResult = typename Solver::PathResult;
+
+			/**
+			\brief The results of all the paths, by index of start point, once the solve is done.  Paths stopped by Cancel have SuccessCode::ExternallyTerminated.
+			*/
+			std::shared_future<std::vector<PathResult>> const& Future() const
+			{
+				return future_;
+			}
+
+			/**
+			\brief Block until the solve is done, then get its results, or rethrow what it threw.
+			*/
+			std::vector<PathResult> const& Get() const
+			{
+				return future_.get();
+			}
+
+			bool Done() const
+			{
+				return future_.wait_for(std::chrono::seconds(0))==std::future_status::ready;
+			}
+
+			/**
+			\brief Stop the solve, soon, from any thread.  Before it starts, it tracks nothing.  See ParallelSolver::Cancel.
+			*/
+			void Cancel() const
+			{
+				state_->Cancel();
+			}
+
+			/**
+			\brief The results of the paths finished so far, in the order they finished.
+			*/
+			std::vector<PathResult> ResultsSoFar() const
+			{
+				std::lock_guard<std::mutex> lock(state_->mutex);
+				return state_->so_far;
+			}
+
+			size_t NumFinished() const
+			{
+				std::lock_guard<std::mutex> lock(state_->mutex);
+				return state_->so_far.size();
+			}
+
+		private:
+
+			template<class T, class E>
+			friend SolveHandle<T,E> SolveAsync(System const&, AsyncSolveSettings<T,E> const&);
+
+			struct State
+			{
+				std::mutex mutex; ///< Guards the rest.
+				std::vector<PathResult> so_far;
+				bool cancelled = false;
+				Solver* solver = nullptr; ///< The solver, while it runs.
+
+				void Cancel()
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					cancelled = true;
+					if (solver)
+						solver->Cancel();
+				}
+			};
+
+			std::shared_ptr<State> state_ = std::make_shared<State>();
+			std::shared_future<std::vector<PathResult>> future_;
+		};
+
+
+
+		/**
+		\brief Solve a system by a total degree homotopy in the background, returning at once.
+
+		The system is copied, then homogenized and patched, and solved by a ParallelSolver with the settings given, on a thread of the executor, at the default precision of the calling thread.  Results come as each path finishes, to the on_result of the settings and to SolveHandle::ResultsSoFar, and all together from the future of the handle once it is done.
+
+		\code
+		AsyncSolveSettings<AMPTracker> settings;
+		settings.tracker_setup = [](AMPTracker & tracker){ tracker.Setup(...); tracker.PrecisionSetup(...);};
+		unsigned num_real = 0;
+		settings.on_result = [&num_real](auto const& r){ return !(is_real(r.solution) && ++num_real==2);}; // two are enough
+		auto handle = SolveAsync(sys, settings);
+		// ... other work ...
+		for (auto const& r : handle.Get())
+			...
+		\endcode
+
+		\param target The system to solve, polynomial, without a path variable, and not homogenized.
+		\param settings The tracker setup, the threads of the solve, and where results go as they come.
+		*/
+		template<class TrackerType, class EndgameType>
+		SolveHandle<TrackerType, EndgameType> SolveAsync(System const& target, AsyncSolveSettings<TrackerType, EndgameType> const& settings)
+		{
+			using Handle = SolveHandle<TrackerType, EndgameType>;
+			using Solver = typename Handle::Solver;
+			using PathResult = typename Handle::PathResult;
+
+			if (!settings.tracker_setup)
+				throw std::invalid_argument("solving asynchronously needs a tracker setup");
+
+			Handle handle;
+			auto state = handle.state_;
+			auto promise = std::make_shared<std::promise<std::vector<PathResult>>>();
+			handle.future_ = promise->get_future().share();
+
+			// cloned here, since homogenizing changes the functions in place, which the caller's system keeps
+			auto sys = std::make_shared<System>(Clone(target));
+			const auto precision = DefaultPrecision();
+
+			auto& executor = settings.executor ? *settings.executor : SolveExecutor::Shared();
+			executor.Submit([sys, settings, state, promise, precision]()
+				{
+					try
+					{
+						DefaultPrecision(precision);
+						sys->Homogenize();
+						sys->AutoPatch();
+						auto TD = start_system::TotalDegree(*sys);
+						TD.Homogenize();
+
+						Solver solver(*sys, TD, settings.tracker_setup, settings.num_threads);
+						if (settings.endgame_factory)
+							solver.SetEndgameFactory(settings.endgame_factory);
+						solver.SetResultHandler([&settings, state](PathResult const& r)
+							{
+								{
+									std::lock_guard<std::mutex> lock(state->mutex);
+									state->so_far.push_back(r);
+								}
+								if (settings.on_result && !settings.on_result(r))
+									state->Cancel();
+							});
+						{
+							std::lock_guard<std::mutex> lock(state->mutex);
+							state->solver = &solver;
+							solver.Cancel(state->cancelled);
+						}
+
+						try
+						{
+							solver.Solve();
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(state->mutex);
+							state->solver = nullptr;
+							throw;
+						}
+
+						{
+							std::lock_guard<std::mutex> lock(state->mutex);
+							state->solver = nullptr;
+						}
+						promise->set_value(solver.Results());
+					}
+					catch (...)
+					{
+						promise->set_exception(std::current_exception());
+					}
+				});
+
+			return handle;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
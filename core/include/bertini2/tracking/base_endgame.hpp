@@ -34,7 +34,11 @@
 \brief Contains base class, EndgameBase.
 */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <type_traits>
 #include <typeinfo>
 
 #include <boost/multiprecision/gmp.hpp>
@@ -49,6 +53,9 @@
 
 #include "bertini2/tracking/tracking_config.hpp"
 #include "bertini2/tracking/interpolation.hpp"
+#include "bertini2/tracking/certification.hpp"
+#include "bertini2/tracking/deflation.hpp"
+#include "bertini2/tracking/step_history.hpp"
 
 #include "bertini2/logging.hpp"
 
@@ -56,6 +63,117 @@ namespace bertini{
 
 	namespace tracking {
 
+		/**
+		\brief Why an endgame stopped before reaching the final tolerance or the minimum track time, on a prediction from the trend of its approximations.
+		*/
+		enum class EarlyAbort
+		{
+			None, ///< Not stopped early.
+			Diverging, ///< The approximations are growing toward the path truncation threshold.  Reported as GoingToInfinity.
+			SlowConvergence, ///< At their rate of convergence, the approximations will not meet the final tolerance before the minimum track time.  Reported as FailedToConverge.
+			PrecisionExhaustion ///< At the rate precision is rising, it will pass the maximum before the approximations meet the final tolerance.  Reported as MaxPrecisionReached.
+		};
+
+		inline std::ostream& operator<<(std::ostream& out, EarlyAbort a)
+		{
+			static char const* names[] = {"none", "diverging", "slow_convergence", "precision_exhaustion"};
+			return out << names[static_cast<unsigned>(a)];
+		}
+
+
+		/**
+		\brief Counts of the work done by an endgame on one path, for tuning its settings, such as num_sample_points and sample_factor.
+
+		Reset at the start of each Run.
+		*/
+		struct EndgameStats
+		{
+			unsigned num_samples = 0; ///< Samples tracked to, both toward the origin and around it.
+			unsigned num_circle_tracks = 0; ///< Loops around the origin, by the Cauchy endgame.
+			unsigned num_cycle_number_trials = 0; ///< Candidate cycle numbers tried by the power series endgame, or checks of whether a loop closed by the Cauchy endgame.
+			unsigned num_hermite_interpolations = 0; ///< Hermite interpolations, for approximations at the origin and for trying cycle numbers.
+			unsigned num_approximations = 0; ///< Approximations at the origin, power series or Cauchy.
+			unsigned peak_precision = 0; ///< The highest precision of a sample, in digits.
+			EarlyAbort early_abort = EarlyAbort::None; ///< Whether, and why, the endgame stopped early.
+			bool handed_off = false; ///< Whether the power series endgame handed the path to the Cauchy endgame, in the hybrid endgame.
+			bool certified = false; ///< Whether the endgame stopped on certifying its approximation to be within the final tolerance of a root, see config::Endgame::certify_approximations.
+			bool deflated = false; ///< Whether the endgame stopped on refining its approximation by Newton's method on a deflated system, see config::Endgame::deflate_endpoints.
+
+			/**
+			\brief Add the work of another endgame on the same path, as when one hands it off to another.
+			*/
+			EndgameStats& operator+=(EndgameStats const& other)
+			{
+				num_samples += other.num_samples;
+				num_circle_tracks += other.num_circle_tracks;
+				num_cycle_number_trials += other.num_cycle_number_trials;
+				num_hermite_interpolations += other.num_hermite_interpolations;
+				num_approximations += other.num_approximations;
+				peak_precision = std::max(peak_precision, other.peak_precision);
+				if (other.early_abort!=EarlyAbort::None)
+					early_abort = other.early_abort;
+				handed_off = handed_off || other.handed_off;
+				certified = certified || other.certified;
+				deflated = deflated || other.deflated;
+				return *this;
+			}
+
+			friend std::ostream& operator<<(std::ostream& out, EndgameStats const& s)
+			{
+				return out << "samples=" << s.num_samples << " circle_tracks=" << s.num_circle_tracks
+				           << " cycle_number_trials=" << s.num_cycle_number_trials << " hermite_interpolations=" << s.num_hermite_interpolations
+				           << " approximations=" << s.num_approximations << " peak_precision=" << s.peak_precision
+				           << " early_abort=" << s.early_abort << " handed_off=" << s.handed_off << " certified=" << s.certified << " deflated=" << s.deflated;
+			}
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				ar & num_samples;
+				ar & num_circle_tracks;
+				ar & num_cycle_number_trials;
+				ar & num_hermite_interpolations;
+				ar & num_approximations;
+				ar & peak_precision;
+				ar & early_abort;
+				ar & handed_off;
+				ar & certified;
+				ar & deflated;
+			}
+		};
+
+
+		/**
+		\brief What an endgame learned about a path, to warm start the endgame of the same path in a nearby solve, such as at the next point of a parameter sweep.
+
+		Record one with EndgameBase::RecordHint after Run, and pass it to the next with SetHint.  Each member is used only if nonzero, so a default hint is a cold start.
+		*/
+		struct EndgameHint
+		{
+			unsigned cycle_number = 0; ///< The cycle number, tried first by the power series endgame.
+			unsigned precision = 0; ///< The precision to start at, rather than rising to it again.  Only used by adaptive precision endgames.
+			double start_time = 0; ///< The size of the time at which to start sampling.  The endgame tracks directly to it from the endgame boundary, if it is nearer the origin and not past the minimum track time.
+
+			bool Empty() const
+			{
+				return cycle_number==0 && precision==0 && start_time==0;
+			}
+
+			friend std::ostream& operator<<(std::ostream& out, EndgameHint const& h)
+			{
+				return out << "cycle_number=" << h.cycle_number << " precision=" << h.precision << " start_time=" << h.start_time;
+			}
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				ar & cycle_number;
+				ar & precision;
+				ar & start_time;
+			}
+		};
+
+
 		namespace endgame {
 
 			
@@ -105,6 +223,238 @@ namespace bertini{
 				// state variables
 				mutable std::tuple<Vec<dbl>, Vec<mpfr> > final_approximation_at_origin_; 
 				mutable unsigned int cycle_number_ = 0; 
+				mutable EndgameStats stats_; ///< The work done on the current or most recent path.
+
+
+				/**
+				\brief The size of the current time, the difference of successive approximations, the norm of the dehomogenized approximation, and its precision, at an iteration of an endgame.
+				*/
+				struct Iteration
+				{
+					double abs_time;
+					double error;
+					double norm;
+					unsigned precision;
+				};
+
+				mutable detail::RingBuffer<Iteration> iterations_; ///< The most recent iterations of the current path, for CheckEarlyAbort.
+
+				EndgameHint hint_; ///< The warm start for each Run, from SetHint.
+				mutable double converged_time_ = 0; ///< The size of the oldest time among the samples of the final approximation, if the most recent Run converged, else 0.
+
+
+				/**
+				\brief Zero the counts, iterations, and cycle number of the most recent path, for the Run and Reset of each endgame type.  The iterations keep their storage.
+
+				\param cycle_number The cycle number to start the next path at.
+				*/
+				void ResetPathState(unsigned cycle_number = 0) const
+				{
+					stats_ = EndgameStats();
+					iterations_.clear();
+					converged_time_ = 0;
+					cycle_number_ = cycle_number;
+				}
+
+
+				/**
+				\brief Apply the precision and start time of the hint, if any, to the point at which a Run starts.
+
+				The point, and time, are raised to the precision of the hint, and the path tracked from the time to the start time of the hint.  If that tracking fails, the Run starts cold from the boundary instead.
+
+				\param[in,out] start_time The time at which to start the endgame.
+				\param[in,out] start_point The point on the path at that time.
+				*/
+				template<typename CT>
+				void WarmStart(CT & start_time, Vec<CT> & start_point) const
+				{
+					using std::abs;
+					using RT = typename Eigen::NumTraits<CT>::Real;
+
+					if (TrackerTraits<TrackerType>::IsAdaptivePrec && hint_.precision > Precision(start_point))
+					{
+						DefaultPrecision(hint_.precision);
+						Precision(start_point, hint_.precision);
+						AsDerived().EnsureAtPrecision(start_time, hint_.precision);
+					}
+
+					const double abs_start_time = static_cast<double>(abs(start_time));
+					if (hint_.start_time > 0 && hint_.start_time < abs_start_time && hint_.start_time >= static_cast<double>(endgame_settings_.min_track_time))
+					{
+						CT time = start_time * RT(hint_.start_time / abs_start_time);
+						Vec<CT> point;
+						auto tracking_success = tracker_.TrackPath(point, start_time, time, start_point);
+						if (tracking_success!=SuccessCode::Success)
+						{
+							BERTINI_LOG(debug) << "warm start to t = " << time << " failed, code " << int(tracking_success) << ", starting from the boundary";
+							return;
+						}
+						AsDerived().EnsureAtPrecision(time, Precision(point));
+						start_time = time;
+						start_point = point;
+					}
+				}
+
+
+				/**
+				\brief Record an iteration of the endgame, and predict from the trend of the most recent ones whether it will fail.
+
+				The trend is taken from the last SecuritySettings().early_abort_window iterations, and is acted on only if it holds at each of them:
+
+				- If the norm of the dehomogenized approximations grows at least as fast as |t|^(-divergence_rate), their differences grow too, and at that rate the norm would pass the path truncation threshold of the tracker before the minimum track time, the path is going to infinity.  This is checked only at security level 0 or less, as is max_norm.
+				- If the differences shrink, but even at the fastest rate among them would not meet the final tolerance before the minimum track time, or before the precision passes its maximum at the rate it is rising, the endgame would fail.
+
+				Neither prediction is made while the differences are irregular, as they may be before the endgame operating zone.  The differences and norms are compared in double precision, which suffices for their ratios.
+
+				\param time The current time, at which the newest samples were taken.
+				\param approximation The newest approximation at the origin.
+				\param error The norm of the difference of the newest approximation and the one before.
+				\return Success to continue, or the code to stop with.  The reason is kept in the stats.
+				*/
+				template<typename CT>
+				SuccessCode CheckEarlyAbort(CT const& time, Vec<CT> const& approximation, typename Eigen::NumTraits<CT>::Real const& error) const
+				{
+					using std::abs;
+					using std::log;
+					using std::pow;
+
+					const auto window = SecuritySettings().early_abort_window;
+					if (window==0)
+						return SuccessCode::Success;
+
+					iterations_.push_back({static_cast<double>(abs(time)), static_cast<double>(error),
+					                       static_cast<double>(GetSystem().DehomogenizePoint(approximation).norm()), Precision(approximation)});
+					while (iterations_.size() > window+1)
+						iterations_.pop_front();
+					if (iterations_.size() < window+1)
+						return SuccessCode::Success;
+
+					double min_norm_growth = std::numeric_limits<double>::infinity(), min_error_ratio = min_norm_growth, max_error_ratio = 0;
+					for (unsigned ii = 1; ii <= window; ++ii)
+					{
+						if (iterations_[ii-1].norm==0 || iterations_[ii-1].error==0)
+							return SuccessCode::Success;
+						min_norm_growth = std::min(min_norm_growth, iterations_[ii].norm / iterations_[ii-1].norm);
+						min_error_ratio = std::min(min_error_ratio, iterations_[ii].error / iterations_[ii-1].error);
+						max_error_ratio = std::max(max_error_ratio, iterations_[ii].error / iterations_[ii-1].error);
+					}
+
+					const auto& latest = iterations_.back();
+					const double log_sample_factor = log(static_cast<double>(EndgameSettings().sample_factor));
+					const double iterations_left = log(static_cast<double>(EndgameSettings().min_track_time) / latest.abs_time) / log_sample_factor;
+
+					if (SecuritySettings().level <= 0 && min_error_ratio >= 1
+					    && log(min_norm_growth) >= -static_cast<double>(SecuritySettings().divergence_rate) * log_sample_factor
+					    && log(latest.norm) + iterations_left*log(min_norm_growth) > log(static_cast<double>(GetTracker().PathTruncationThreshold())))
+					{
+						BERTINI_LOG(debug) << "stopping endgame early, approximations diverging, norm " << latest.norm << " growing by at least " << min_norm_growth << " per iteration";
+						stats_.early_abort = EarlyAbort::Diverging;
+						return SuccessCode::GoingToInfinity;
+					}
+
+					const double final_tolerance = static_cast<double>(Tolerances().final_tolerance);
+					if (max_error_ratio < 1 && latest.error > final_tolerance)
+					{
+						const double iterations_needed = log(final_tolerance / latest.error) / log(min_error_ratio);
+
+						const auto& oldest = iterations_.front();
+						const double precision_growth = latest.precision > oldest.precision ? double(latest.precision - oldest.precision) / window : 0;
+						const double iterations_until_max_precision = precision_growth > 0 ?
+							(double(MaximumPrecision(std::integral_constant<bool, TrackerTraits<TrackerType>::IsAdaptivePrec==1>())) - latest.precision) / precision_growth
+							: std::numeric_limits<double>::infinity();
+
+						if (iterations_needed > std::min(iterations_left, iterations_until_max_precision))
+						{
+							BERTINI_LOG(debug) << "stopping endgame early, " << iterations_needed << " more iterations needed to converge, with " << iterations_left << " left before the minimum track time and " << iterations_until_max_precision << " before the maximum precision";
+							if (iterations_until_max_precision < iterations_left)
+							{
+								stats_.early_abort = EarlyAbort::PrecisionExhaustion;
+								return SuccessCode::MaxPrecisionReached;
+							}
+							stats_.early_abort = EarlyAbort::SlowConvergence;
+							return SuccessCode::FailedToConverge;
+						}
+					}
+
+					return SuccessCode::Success;
+				}
+
+				/**
+				\brief Whether an approximation at the origin is certified, by the Krawczyk test, to be within the final tolerance of a nonsingular root of the system there, so the endgame may stop without consecutive approximations agreeing to the final tolerance.
+
+				Only if EndgameSettings().certify_approximations, and the system is square.  Approximations of singular endpoints are never certified, and cost a ball evaluation of the Jacobian to reject.  Records success in the stats.
+				*/
+				template<typename CT>
+				bool CertifiedConverged(Vec<CT> const& approximation) const
+				{
+					if (!EndgameSettings().certify_approximations || GetSystem().NumTotalFunctions()!=GetSystem().NumVariables())
+						return false;
+
+					auto certificate = Krawczyk(GetSystem(), approximation, CT(0));
+					if (!certificate.certified || certificate.radius >= static_cast<double>(Tolerances().final_tolerance))
+						return false;
+
+					BERTINI_LOG(debug) << "approximation certified within " << certificate.radius << " of a root";
+					stats_.certified = true;
+					return true;
+				}
+
+				/**
+				\brief Whether an approximation at the origin refines, by Newton's method on a deflated system, to within the final tolerance of a root of the system there, so the endgame may stop without tracking any closer to the origin.  If so, the approximation is replaced by the refined one.
+
+				Only if EndgameSettings().deflate_endpoints, and consecutive approximations agree to EndgameSettings().deflation_tolerance.  Refined in double precision if it converges there, else at the precision of the approximation.  Records success in the stats.
+
+				\param[in,out] approximation The latest approximation.
+				\param approximation_error The difference of it and the one before.
+				*/
+				template<typename CT>
+				bool DeflatedConverged(Vec<CT> & approximation, double approximation_error) const
+				{
+					if (!EndgameSettings().deflate_endpoints || approximation_error > static_cast<double>(EndgameSettings().deflation_tolerance))
+						return false;
+
+					const double tolerance = static_cast<double>(Tolerances().final_tolerance);
+					auto in_double = Deflate(GetSystem(), Vec<dbl>(approximation.template cast<dbl>()), dbl(0), tolerance, deflation_settings_);
+					if (in_double.converged)
+					{
+						BERTINI_LOG(debug) << "approximation refined in double precision after " << in_double.num_deflations << " deflations, last step " << in_double.last_step;
+						approximation = in_double.point.template cast<CT>();
+						stats_.deflated = true;
+						return true;
+					}
+					if (std::is_same<CT, dbl>::value)
+						return false;
+
+					auto refined = Deflate(GetSystem(), approximation, CT(0), tolerance, deflation_settings_);
+					if (!refined.converged)
+						return false;
+
+					BERTINI_LOG(debug) << "approximation refined at " << Precision(approximation) << " digits after " << refined.num_deflations << " deflations, last step " << refined.last_step;
+					approximation = refined.point;
+					stats_.deflated = true;
+					return true;
+				}
+
+				unsigned MaximumPrecision(std::true_type) const
+				{
+					return GetTracker().PrecisionSettings().maximum_precision;
+				}
+
+				unsigned MaximumPrecision(std::false_type) const
+				{
+					return std::numeric_limits<unsigned>::max();
+				}
+
+
+				/**
+				\brief Count a tracked sample, and its precision.
+				*/
+				template<typename CT>
+				void CountSample(Vec<CT> const& sample) const
+				{
+					++stats_.num_samples;
+					stats_.peak_precision = std::max(stats_.peak_precision, Precision(sample));
+				}
 
 
 				/**
@@ -124,6 +474,8 @@ namespace bertini{
 				*/
 				config::Security<BRT> security_;
 
+				config::Deflation deflation_settings_; ///< How approximations are refined, if EndgameSettings().deflate_endpoints.
+
 				/**
 				\brief A tracker tha must be passed into the endgame through a constructor. This tracker is what will be used to track to all time values during the endgame. 
 				*/
@@ -145,9 +497,32 @@ namespace bertini{
 
 
 				unsigned CycleNumber() const { return cycle_number_;}
+
+				/**
+				\brief Counts of the work done by the most recent Run.
+				*/
+				EndgameStats const& Stats() const { return stats_;}
 				void CycleNumber(unsigned c) { cycle_number_ = c;}
 				void IncrementCycleNumber(unsigned inc) { cycle_number_ += inc;}
 
+				/**
+				\brief Warm start the following Runs, from what an earlier solve learned about the path.  Set a default hint to start cold again.
+				*/
+				void SetHint(EndgameHint const& hint) { hint_ = hint;}
+				EndgameHint const& GetHint() const { return hint_;}
+
+				/**
+				\brief A hint for the same path of a nearby solve, from the most recent Run: its cycle number, the highest precision of a sample, and where its final samples started, if it converged.
+				*/
+				EndgameHint RecordHint() const
+				{
+					EndgameHint hint;
+					hint.cycle_number = cycle_number_;
+					hint.precision = stats_.peak_precision;
+					hint.start_time = converged_time_;
+					return hint;
+				}
+
 				
 
 				const auto& EndgameSettings() const
@@ -186,6 +561,12 @@ namespace bertini{
 				*/
 				void SetToleranceSettings(config::Tolerances<BRT> new_tolerances_settings){tolerances_ = new_tolerances_settings;}
 
+				/**
+				\brief The settings of the deflation of approximations, used if EndgameSettings().deflate_endpoints.
+				*/
+				const config::Deflation& DeflationSettings() const { return deflation_settings_;}
+				void SetDeflationSettings(config::Deflation const& new_deflation_settings){ deflation_settings_ = new_deflation_settings;}
+
 
 				/**
 				\brief Getter for the tracker used inside an instance of the endgame. 
@@ -201,6 +582,19 @@ namespace bertini{
 				{ return tracker_.GetSystem();}
 
 
+				/**
+				\brief An estimate of the memory held by the endgame, by component.
+
+				Endgames add their samples to this.  Neither the tracker nor the system is included, since the endgame refers to them rather than owning them.
+				*/
+				MemoryReport MemoryUsage() const
+				{
+					MemoryReport report;
+					report.Add("endgame", sizeof(FinalEGT) + memory::HeapBytes(final_approximation_at_origin_));
+					return report;
+				}
+
+
 				/**
 				\brief Populates time and space samples so that we are ready to start the endgame. 
 
@@ -247,8 +641,13 @@ namespace bertini{
 
 					samples.push_back(x_endgame);
 					times.push_back(start_time);
+					stats_.peak_precision = std::max(stats_.peak_precision, Precision(x_endgame));
 
 					auto num_vars = GetSystem().NumVariables();
+
+					if (endgame_settings_.dense_initial_samples && endgame_settings_.num_sample_points > 2)
+						return ComputeInitialSamplesDense(times, samples);
+
 					//start at 1, because the input point is the 0th element.
 					for(int ii=1; ii < endgame_settings_.num_sample_points; ++ii)
 					{ 
@@ -260,7 +659,60 @@ namespace bertini{
 
 						if (tracking_success!=SuccessCode::Success)
 							return tracking_success;
+						CountSample(samples[ii]);
+					}
+
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				\brief The initial samples after the first, tracking once to the last of them and keeping the steps, the ones between made by refining the interpolants of the steps at their times.
+
+				A sample whose interpolant fails to refine is tracked to from the one before it, as by ComputeInitialSamples without dense output.
+
+				\param times The times, holding the start time, to which the rest are added.
+				\param samples The samples, holding the one at the start time, to which the rest are added.
+				*/
+				template<typename CT>
+				SuccessCode ComputeInitialSamplesDense(TimeCont<CT> & times, SampCont<CT> & samples) const
+				{
+					using RT = typename Eigen::NumTraits<CT>::Real;
+					using bertini::Precision;
+
+					for(int ii=1; ii < endgame_settings_.num_sample_points; ++ii)
+					{
+						times.emplace_back(times[ii-1] * RT(endgame_settings_.sample_factor));
+						samples.emplace_back(Vec<CT>(GetSystem().NumVariables()));
+					}
+
+					const auto last = times.size()-1;
+					StepHistory<CT> history;
+					auto tracking_success = tracker_.TrackPath(samples[last],times[0],times[last],samples[0],history);
+					if (tracking_success!=SuccessCode::Success)
+						return tracking_success;
+					AsDerived().EnsureAtPrecision(times[last],Precision(samples[last]));
+
+					for (unsigned ii=1; ii < last; ++ii)
+					{
+						Vec<CT> guess;
+						auto refinement_success = SuccessCode::FailedToConverge;
+						if (history.Interpolate(guess, times[ii]))
+						{
+							AsDerived().EnsureAtPrecision(times[ii],Precision(guess));
+							refinement_success = AsDerived().RefineSample(samples[ii], guess, times[ii]);
+						}
+
+						if (refinement_success!=SuccessCode::Success)
+						{
+							tracking_success = tracker_.TrackPath(samples[ii],times[ii-1],times[ii],samples[ii-1]);
+							if (tracking_success!=SuccessCode::Success)
+								return tracking_success;
+						}
+						AsDerived().EnsureAtPrecision(times[ii],Precision(samples[ii]));
+						CountSample(samples[ii]);
 					}
+					CountSample(samples[last]);
 
 					return SuccessCode::Success;
 				}
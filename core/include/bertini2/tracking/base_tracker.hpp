@@ -34,9 +34,13 @@
 #define BERTINI_BASE_TRACKER_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 //#include "bertini2/tracking/step.hpp"
 #include "bertini2/tracking/ode_predictors.hpp"
 #include "bertini2/tracking/newton_corrector.hpp"
+#include "bertini2/tracking/time_breakdown.hpp"
+#include "bertini2/tracking/step_history.hpp"
 #include "bertini2/limbo.hpp"
 #include "bertini2/logging.hpp"
 #include "bertini2/detail/visitable.hpp"
@@ -59,6 +63,29 @@ namespace bertini{
 
 	namespace tracking{
 
+		/**
+		\brief The factor by which the proportional-integral stepsize controller scales the stepsize after a successful step.
+
+		The error ratios are those of the errors of the predictions of this step and the one before, to the CorrectablePredictionError().  The factor is Gustafsson's \f$ s\, r_n^{-0.7/k} r_{n-1}^{0.4/k} \f$, with safety factor s and k one more than the order of the predictor, bounded to the interval of the fail and success factors.  The second term damps the oscillation of a purely proportional controller, shrinking the step less after the error has grown, and growing it less after it has fallen.
+
+		\param error_ratio The ratio of the error of this step's prediction.
+		\param previous_error_ratio The ratio of the step before.  1 for the first step.
+		\param predictor_order The order of the predictor.
+		\param safety The safety factor s.
+		\param min_factor The least factor, the fail factor.
+		\param max_factor The greatest factor, the success factor.
+		*/
+		inline
+		double PIStepSizeFactor(double error_ratio, double previous_error_ratio, unsigned predictor_order,
+		                        double safety, double min_factor, double max_factor)
+		{
+			const double k = predictor_order + 1;
+			const double tiny = 1e-10; // an exact prediction would otherwise propose an infinite step
+			double factor = safety * std::pow(std::max(error_ratio, tiny), -0.7/k) * std::pow(std::max(previous_error_ratio, tiny), 0.4/k);
+			return std::min(std::max(factor, min_factor), max_factor);
+		}
+
+
 		/**
 		\class Tracker
 
@@ -156,6 +183,12 @@ namespace bertini{
 			{
 				predictor_ = std::make_shared< predict::ExplicitRKPredictor >(predict::DefaultPredictor(), sys);
 				corrector_ = std::make_shared< correct::NewtonCorrector >(sys);
+				jacobian_cache_ = std::make_shared< JacobianCache >();
+				predictor_->SetJacobianCache(jacobian_cache_);
+				corrector_->SetJacobianCache(jacobian_cache_);
+				time_breakdown_ = std::make_shared< TimeBreakdown >();
+				predictor_->SetTimeBreakdown(time_breakdown_);
+				corrector_->SetTimeBreakdown(time_breakdown_);
 				Predictor(predict::DefaultPredictor());
 			}
 
@@ -189,6 +222,92 @@ namespace bertini{
 
 
 
+			/**
+			\brief Forget the path tracked last, ready to track another, keeping the settings, and the workspace at the sizes and precisions it grew to.
+
+			Cheap, unlike setting the tracker up again.  The cached Jacobian and the endpoint stage of the predictor are dropped, since the system may have changed since the last path, and the counters are zeroed.  TrackPath calls this itself; a driver tracking many paths with one tracker may call it between paths, so the counters read from one path are not left over from the last.
+			*/
+			void Reset() const
+			{
+				jacobian_cache_->Invalidate();
+				predictor_->ForgetEndpointStage();
+				ResetCounters();
+			}
+
+
+			/**
+			\brief Watch a flag, which another thread may set to stop tracking at the next step, with SuccessCode::ExternallyTerminated.
+
+			Costs one atomic read per step.  Pass nullptr to stop watching.  The flag must outlive the tracking.
+			*/
+			void SetStopFlag(std::atomic<bool> const* stop)
+			{
+				stop_flag_ = stop;
+			}
+
+			/**
+			\brief Stop the current call to TrackPath before its next step, with SuccessCode::ExternallyTerminated, leaving the current time and point where the last step left them.
+
+			For observers, which see the tracker as const, deciding from the steps so far that the path should go no further, such as the handoff watch of a PathStatsObserver.  Unlike SetStopFlag, from the tracking thread only, and only until TrackPath returns.
+			*/
+			void RequestStop() const
+			{
+				stop_requested_ = true;
+			}
+
+
+			/**
+			\brief Keep the start and accepted steps of each path tracked in a history, for dense output between them.
+
+			Each step kept costs a Jacobian and its factorization, for the derivative of the path.  Pass nullptr to stop keeping them.  The history must outlive the tracking.
+			*/
+			void SetStepHistory(StepHistory<CT>* history)
+			{
+				step_history_ = history;
+			}
+
+
+			/**
+			\brief Switch the patch of a homogenized system while tracking, when the coordinates of the point grow past a norm, so that precision and stepsize follow the geometry of the path rather than the scaling of its coordinates on one patch.
+
+			After a successful step taking the point past max_norm, the system is given a new patch, by System::SetPatch, and the point is rescaled onto it.  The patch the path started on is put back when tracking ends, and the solution rescaled onto it, so that the system and the points returned are as without switching.  A step history being kept is cleared at the first switch, since its points are on different patches, and nothing more is kept for that path.
+
+			Only for patched systems.  Otherwise nothing is switched.
+
+			\param settings When to switch, and to what.  max_norm should be well above 1, since a point rescaled to a coordinate patch has norm up to the square root of the size of its largest variable group.
+			*/
+			void SetPatchSwitching(config::PatchSwitching<RT> const& settings)
+			{
+				patch_switching_ = settings;
+			}
+
+
+			/**
+			\brief Track a start point through time, from a start time to a target time, keeping the start and accepted steps of the path in a history.
+
+			The same as the other TrackPath, with a history for this path only, which is cleared first.  The history ends at the end time when tracking succeeds.
+			*/
+			SuccessCode TrackPath(Vec<CT> & solution_at_endtime,
+									CT const& start_time, CT const& endtime,
+									Vec<CT> const& start_point,
+									StepHistory<CT> & history
+									) const
+			{
+				auto previous = step_history_;
+				step_history_ = &history;
+				try{
+					auto code = TrackPath(solution_at_endtime, start_time, endtime, start_point);
+					step_history_ = previous;
+					return code;
+				}
+				catch (...)
+				{
+					step_history_ = previous;
+					throw;
+				}
+			}
+
+
 			/**
 			\brief Track a start point through time, from a start time to a target time.
 
@@ -208,7 +327,9 @@ namespace bertini{
 				if (start_point.size()!=tracked_system_.NumVariables())
 					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
 
-				
+				Reset();
+				patch_switched_ = false;
+				stop_requested_ = false;
 				
 				SuccessCode initialization_code = TrackerLoopInitialization(start_time, endtime, start_point);
 				if (initialization_code!=SuccessCode::Success)
@@ -217,12 +338,29 @@ namespace bertini{
 					return initialization_code;
 				}
 
+				if (reinitialize_stepsize_ && stepping_config_.estimate_initial_step_size)
+					EstimateInitialStepSize();
+
+				if (step_history_)
+				{
+					step_history_->Clear();
+					RecordStep();
+				}
+
 				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
 				while (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
 				{	
+					if (stop_requested_ || (stop_flag_ && stop_flag_->load(std::memory_order_relaxed)))
+					{
+						RestorePatch();
+						PostTrackCleanup();
+						return SuccessCode::ExternallyTerminated;
+					}
+
 					SuccessCode pre_iteration_code = PreIterationCheck();
 					if (pre_iteration_code!=SuccessCode::Success)
 					{
+						RestorePatch();
 						PostTrackCleanup();
 						return pre_iteration_code;
 					}
@@ -240,11 +378,18 @@ namespace bertini{
 					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
 					{	
 						OnInfiniteTruncation();
+						RestorePatch();
 						PostTrackCleanup();
 						return SuccessCode::GoingToInfinity;
 					}
 					else if (step_success_code_==SuccessCode::Success)
+					{
 						OnStepSuccess();
+						if (patch_switching_.max_norm > 0)
+							SwitchPatchIfLarge();
+						if (step_history_ && !patch_switched_)
+							RecordStep();
+					}
 					else
 						OnStepFail();
 
@@ -252,6 +397,7 @@ namespace bertini{
 
 
 				CopyFinalSolution(solution_at_endtime);
+				RestorePatch(&solution_at_endtime);
 				PostTrackCleanup();
 				return SuccessCode::Success;
 			}
@@ -307,6 +453,50 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Refine a point, and compute the derivatives of it with respect to the implicit parameters of the tracked system, \f$\frac{dx}{dp} = -J^{-1} \frac{\partial H}{\partial p}\f$.
+
+			The Jacobian is not evaluated or factored again.  The factorization from the last Newton iteration of the refinement is used to solve for all the parameters at once, so that the derivatives are accurate to about the length of the last Newton step, the tracking tolerance.  If that factorization cannot be used, the Jacobian is factored at the refined point.
+
+			For a ParameterHomotopy at time 0, where the parameters of the homotopy are its target, these are the derivatives of a solution with respect to the parameters of the family.  For explicit parameters, make the family with them as the target of a ParameterHomotopy.
+
+			\code
+			Vec<mpfr> refined;
+			Mat<mpfr> dx_dp;
+			tracker.ParameterSensitivity(dx_dp, refined, endpoint, mpfr(0));
+			\endcode
+
+			\param[out] dx_dp The derivatives, NumVariables by NumImplicitParameters, one column for each parameter.
+			\param[out] refined The refined point, at which they are.
+			\param point The point to refine, at the precision of the time.  YOU must ensure this, as for Refine.
+			\param time The time.
+			\return The SuccessCode of the refinement, or of the solve.
+			*/
+			template<typename C>
+			SuccessCode ParameterSensitivity(Mat<C> & dx_dp, Vec<C> & refined,
+								Vec<C> const& point, C const& time) const
+			{
+				static_assert(IsTemplateParameter<C,NeededTypes...>::value,"complex type for sensitivity must be a used type for the tracker");
+
+				auto code = Refine(refined, point, time);
+				if (code!=SuccessCode::Success)
+					return code;
+
+				Mat<C> dH_dp;
+				tracked_system_.ImplicitParameterJacobianInPlace(dH_dp, refined, time);
+				dH_dp = -dH_dp;
+
+				if (corrector_->SolveWithLastFactorization(dx_dp, dH_dp)==SuccessCode::Success)
+					return SuccessCode::Success;
+
+				auto LU = tracked_system_.Jacobian(refined, time).partialPivLu();
+				if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+					return SuccessCode::MatrixSolveFailure;
+				dx_dp = LU.solve(dH_dp);
+				return SuccessCode::Success;
+			}
+
+
 			/**
 			\brief Change tracker to use a predictor
 
@@ -348,6 +538,154 @@ namespace bertini{
 				return num_failed_steps_taken_ + num_successful_steps_taken_;
 			}
 
+			/**
+			\brief See how many of the steps taken failed.
+			*/
+			unsigned NumFailedStepsTaken () const
+			{
+				return num_failed_steps_taken_;
+			}
+
+			/**
+			\brief See how many times the patch was switched while tracking the last path.  See SetPatchSwitching.
+			*/
+			unsigned NumPatchSwitches () const
+			{
+				return num_patch_switches_;
+			}
+
+
+			/**
+			\brief The number of Newton iterations taken by the corrector, since this tracker was made.
+
+			Unlike the step counts, this and the other work counts are not reset for each path, so take differences to count the work of one path.
+			*/
+			unsigned long long NumNewtonIterations() const
+			{
+				return corrector_->NumIterations();
+			}
+
+			/**
+			\brief The number of Jacobians evaluated by the predictor and corrector, since this tracker was made.
+			*/
+			unsigned long long NumJacobianEvaluations() const
+			{
+				return predictor_->NumJacobianEvaluations() + corrector_->NumJacobianEvaluations();
+			}
+
+			/**
+			\brief The number of LU factorizations computed by the predictor and corrector, since this tracker was made.
+			*/
+			unsigned long long NumFactorizations() const
+			{
+				return predictor_->NumFactorizations() + corrector_->NumFactorizations();
+			}
+
+
+			/**
+			\brief Turn on or off timing the work of tracking, by kind: evaluating the functions and the Jacobian, linear algebra, checking the AMP criteria, changing precision, and notifying observers.
+
+			Off by default.  As with the work counts, the times are not reset for each path; see ResetTimeBreakdown.
+			*/
+			void EnableTimeBreakdown(bool enabled = true)
+			{
+				time_breakdown_->Enable(enabled);
+			}
+
+			bool TimeBreakdownEnabled() const
+			{
+				return time_breakdown_->Enabled();
+			}
+
+			/**
+			\brief The seconds spent at each kind of work, while timing was on.
+			*/
+			TimeBreakdown const& GetTimeBreakdown() const
+			{
+				return *time_breakdown_;
+			}
+
+			/**
+			\brief The seconds spent at one kind of work, while timing was on.
+			*/
+			double SecondsIn(TimedWork kind) const
+			{
+				return time_breakdown_->Seconds(kind);
+			}
+
+			void ResetTimeBreakdown() const
+			{
+				time_breakdown_->Reset();
+			}
+
+
+
+			/**
+			\brief Share the linear algebra of correction among a team of threads, for tracking one or a few paths of a system too large for one core.
+
+			Pair with System::SetEvaluationTeam, with the same team, so evaluation of the system is shared also.  See NewtonCorrector::SetThreadTeam.
+
+			\param team The threads.  May be null, to work on the calling thread only.
+			*/
+			void SetThreadTeam(std::shared_ptr<detail::ThreadTeam> const& team)
+			{
+				corrector_->SetThreadTeam(team);
+			}
+
+
+			/**
+			\brief The code of the most recent step, Success or the reason it failed.
+			*/
+			SuccessCode StepSuccessCode() const
+			{
+				return step_success_code_;
+			}
+
+			/**
+			\brief The most recent estimate of the condition number of the Jacobian made in a precision, as a double.
+
+			Estimates made in double and in multiple precision are kept apart, and precision may change at the end of a step, so pass the precision a step was taken at to get the estimate made during it.
+			*/
+			double ConditionNumberEstimate(unsigned precision) const
+			{
+				return LatestAsDouble(condition_number_estimate_, precision);
+			}
+
+			/**
+			\brief The norm of the most recent Newton correction made in a precision, as a double.  As with ConditionNumberEstimate, pass the precision of the step.
+			*/
+			double NormDeltaZ(unsigned precision) const
+			{
+				return LatestAsDouble(norm_delta_z_, precision);
+			}
+
+
+			/**
+			\brief An estimate of the memory held by the tracker, by component: the state of the path, the predictor, the corrector, and the Jacobian cache they share.
+
+			Multiple precision numbers are counted at their current precision.  The system is not included, since the tracker refers to it rather than owning it; see System::MemoryUsage.
+			*/
+			MemoryReport MemoryUsage() const
+			{
+				using memory::HeapBytes;
+
+				MemoryReport report;
+				report.Add("path state", sizeof(D)
+				           + HeapBytes(current_space_) + HeapBytes(tentative_space_) + HeapBytes(temporary_space_)
+				           + HeapBytes(condition_number_estimate_) + HeapBytes(error_estimate_) + HeapBytes(norm_J_)
+				           + HeapBytes(norm_J_inverse_) + HeapBytes(norm_delta_z_) + HeapBytes(size_proportion_)
+				           + HeapBytes(endtime_) + HeapBytes(current_time_) + HeapBytes(delta_t_)
+				           + HeapBytes(current_stepsize_) + HeapBytes(next_stepsize_)
+				           + HeapBytes(tracking_tolerance_) + HeapBytes(path_truncation_threshold_));
+				if (predictor_)
+					report.Add("predictor", predictor_->MemoryBytes());
+				if (corrector_)
+					report.Add("corrector", corrector_->MemoryBytes());
+				if (jacobian_cache_)
+					report.Add("jacobian cache", jacobian_cache_->MemoryBytes());
+				return report;
+			}
+
 			/**
 			\brief Set how large the stepsize should be.
 
@@ -376,6 +714,30 @@ namespace bertini{
 				return tracking_tolerance_;
 			}
 
+			/**
+			\brief The threshold for path truncation, set during Setup.
+			*/
+			RT const& PathTruncationThreshold() const
+			{
+				return path_truncation_threshold_;
+			}
+
+			/**
+			\brief The stepping settings, set during Setup.
+			*/
+			config::Stepping<RT> const& SteppingSettings() const
+			{
+				return stepping_config_;
+			}
+
+			/**
+			\brief The Newton settings, set during Setup.
+			*/
+			config::Newton const& NewtonSettings() const
+			{
+				return newton_config_;
+			}
+
 		private:
 
 			// convert the base tracker into the derived type.
@@ -384,6 +746,25 @@ namespace bertini{
 				return static_cast<const D&>(*this);
 			}
 
+			// the double precision member of a tuple of per-precision values comes first, if there is one, and the multiple precision one last.
+			template<typename TupleT>
+			static double LatestAsDouble(TupleT const& values, unsigned precision)
+			{
+				if (precision==DoublePrecision())
+					return ToDouble(std::get<0>(values));
+				return ToDouble(std::get<std::tuple_size<TupleT>::value-1>(values));
+			}
+
+			static double ToDouble(double x)
+			{
+				return x;
+			}
+
+			static double ToDouble(mpfr_float const& x)
+			{
+				return x.convert_to<double>();
+			}
+
 			/**
 			\brief Set up initialization of the internals for tracking a path.
 
@@ -425,8 +806,17 @@ namespace bertini{
 
 		protected:
 
+			using Observable<>::NotifyObservers;
 
-			
+			/**
+			\brief Emit an event, as Observable::NotifyObservers, timing it as observer notification when the time breakdown is on.
+			*/
+			template<typename EventT, typename... Args>
+			void NotifyObservers(Args const&... args) const
+			{
+				TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::ObserverNotification);
+				Observable<>::template NotifyObservers<EventT>(args...);
+			}
 
 
 			template <typename ComplexType>
@@ -439,6 +829,71 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief If the current point is past the norm for switching patches, switch the patch of the system and rescale the point onto it.  See SetPatchSwitching.
+			*/
+			template <typename ComplexType>
+			void SwitchPatchIfLarge() const
+			{
+				using std::abs;
+				auto& x = std::get<Vec<ComplexType> >(current_space_);
+				if (!tracked_system_.IsPatched() || !(x.norm() > patch_switching_.max_norm))
+					return;
+
+				Patch current = tracked_system_.GetPatch();
+				auto const& sizes = current.VariableGroupSizes();
+
+				Patch next;
+				if (patch_switching_.coordinate_patches)
+				{
+					// the largest coordinate of each group, which is 1 on the new patch
+					std::vector<unsigned> largest(sizes.size(), 0);
+					unsigned offset = 0;
+					for (unsigned ii = 0; ii < sizes.size(); ++ii)
+					{
+						for (unsigned jj = 1; jj < sizes[ii]; ++jj)
+							if (abs(x(offset+jj)) > abs(x(offset+largest[ii])))
+								largest[ii] = jj;
+						offset += sizes[ii];
+					}
+					next = Patch::Coordinate(sizes, largest);
+				}
+				else
+					next = Patch::Random(sizes);
+
+				if (!patch_switched_)
+				{
+					original_patch_ = current;
+					patch_switched_ = true;
+					if (step_history_)
+						step_history_->Clear();
+				}
+
+				tracked_system_.SetPatch(next);
+				tracked_system_.RescalePointToFitPatchInPlace(x);
+				jacobian_cache_->Invalidate();
+				predictor_->ForgetEndpointStage();
+				++num_patch_switches_;
+			}
+
+
+			/**
+			\brief Put back the patch the path started on, if it was switched, rescaling a solution onto it.
+
+			\param solution The solution to rescale, at the precision of the system, or null.
+			*/
+			void RestorePatch(Vec<CT>* solution = nullptr) const
+			{
+				if (!patch_switched_)
+					return;
+
+				tracked_system_.SetPatch(original_patch_);
+				if (solution)
+					tracked_system_.RescalePointToFitPatchInPlace(*solution);
+				patch_switched_ = false;
+			}
+
+
 
 			/**
 			\brief Function to be called before exiting the tracker loop.
@@ -456,6 +911,75 @@ namespace bertini{
 			void ResetCounters() const = 0;
 
 
+			/**
+			\brief Keep the current time, point, and derivative of the path in the step history.
+			*/
+			void RecordStep() const
+			{
+				step_history_->Add(current_time_, CurrentPoint(), CurrentPathDerivative());
+			}
+
+
+			/**
+			\brief The derivative dx/dt of the path at a point and time, for CurrentPathDerivative.  The system must be at the precision of the point.
+			*/
+			template<typename C>
+			Vec<C> PathDerivative(Vec<C> const& x, C const& t) const
+			{
+				return tracked_system_.Jacobian(x, t).partialPivLu().solve(-tracked_system_.TimeDerivative(x, t));
+			}
+
+
+
+			/**
+			\brief Estimate the stepsize to start the path with, from the current point and time, for config::Stepping::estimate_initial_step_size.
+
+			The first derivative \f$x'\f$ of the path comes from the Jacobian at the start, whose LU factorization also estimates its condition number \f$\kappa\f$, and the second \f$x''\f$ as the difference of it and the derivative at one Euler step of the current stepsize \f$h_0\f$.  As for the starting step of an ODE solver, the prediction error of a step \f$h\f$ is taken to be \f$\kappa\, h^{k} \max(\|x'\|,\|x''\|)\f$, with k one more than the order of the predictor, and the step chosen to make it the CorrectablePredictionError().  It is at most \f$100 h_0\f$, and bounded by the stepsizes of the stepping settings.
+
+			If the estimate is not a positive number, such as at a singular start point, the stepsize is left as it is.
+			*/
+			template <typename ComplexType>
+			void EstimateInitialStepSize() const
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+				using std::abs;
+				using std::pow;
+				using std::max;
+				using std::min;
+
+				auto const& x0 = std::get<Vec<ComplexType> >(current_space_);
+				const ComplexType t0 = static_cast<ComplexType>(current_time_);
+				const ComplexType delta = static_cast<ComplexType>(endtime_) - t0;
+				const RealType length = abs(delta);
+				if (!(length > 0))
+					return;
+				const ComplexType direction = delta / length;
+
+				const Mat<ComplexType> J = tracked_system_.Jacobian(x0, t0);
+				const auto LU = J.partialPivLu();
+				const Vec<ComplexType> dx0 = LU.solve(-tracked_system_.TimeDerivative(x0, t0));
+				const Vec<ComplexType> r = RandomOfUnits<ComplexType>(x0.size());
+				const RealType condition = J.norm() * Vec<ComplexType>(LU.solve(r)).norm() / r.norm();
+
+				const RealType h0 = min(static_cast<RealType>(current_stepsize_), length);
+				const Vec<ComplexType> x1 = x0 + dx0 * (direction*h0);
+				const Vec<ComplexType> dx1 = PathDerivative(x1, ComplexType(t0 + direction*h0));
+
+				const RealType d1 = dx0.norm();
+				const RealType d2 = (dx1 - dx0).norm() / h0;
+				const RealType scale = max(RealType(1), condition) * max(d1, d2);
+
+				const RealType correctable(CorrectablePredictionError(static_cast<double>(tracking_tolerance_), newton_config_.max_num_newton_iterations));
+				RealType h = pow(correctable / scale, RealType(1)/RealType(predictor_order_+1));
+				if (!(h > 0) || !(h < std::numeric_limits<double>::max()))
+					return;
+
+				h = min(h, RealType(100)*h0);
+				h = min(h, static_cast<RealType>(stepping_config_.max_step_size));
+				h = min(h, length/stepping_config_.min_num_steps);
+				h = max(h, static_cast<RealType>(stepping_config_.min_step_size));
+				SetStepSize(static_cast<RT>(h));
+			}
 
 
 			void ResetCountersBase() const
@@ -466,6 +990,25 @@ namespace bertini{
 				num_failed_steps_taken_ = 0;
 				num_consecutive_failed_steps_ = 0;
 				num_total_steps_taken_ = 0;
+				num_patch_switches_ = 0;
+				previous_error_ratio_ = 1;
+			}
+
+
+			/**
+			\brief With StepSizeController::PI, the factor by which to scale the stepsize after a successful step.
+
+			\param prediction_error The error of the step's prediction, the distance the corrector moved it, or a larger estimate.
+			*/
+			double ControlledStepSizeFactor(double prediction_error) const
+			{
+				double error_ratio = prediction_error / CorrectablePredictionError(static_cast<double>(tracking_tolerance_), newton_config_.max_num_newton_iterations);
+				double factor = PIStepSizeFactor(error_ratio, previous_error_ratio_, predictor_order_,
+				                                 static_cast<double>(stepping_config_.step_size_controller_safety),
+				                                 static_cast<double>(stepping_config_.step_size_fail_factor),
+				                                 static_cast<double>(stepping_config_.step_size_success_factor));
+				previous_error_ratio_ = error_ratio;
+				return factor;
 			}
 
 
@@ -513,11 +1056,30 @@ namespace bertini{
 			virtual 
 			void OnInfiniteTruncation() const = 0;
 
+			/**
+			\brief Switch the patch if the current point is large, in the number type of the current point.  See SwitchPatchIfLarge.
+			*/
+			virtual
+			void SwitchPatchIfLarge() const = 0;
+
+			/**
+			\brief Estimate the initial stepsize, in the number type of the current point.  See EstimateInitialStepSize.
+			*/
+			virtual
+			void EstimateInitialStepSize() const = 0;
+
 
 			const class System& tracked_system_; ///< Reference to the system being tracked.
 
 			bool infinite_path_truncation_ = true; /// Whether should check if the path is going to infinity while tracking.  On by default.
 			bool reinitialize_stepsize_ = true; ///< Whether should re-initialize the stepsize with each call to Trackpath.  On by default.
+			std::atomic<bool> const* stop_flag_ = nullptr; ///< A flag which stops tracking when set, see SetStopFlag.
+			mutable bool stop_requested_ = false; ///< Whether an observer asked to stop the current call to TrackPath, see RequestStop.
+			mutable StepHistory<CT>* step_history_ = nullptr; ///< Where to keep the steps of the path, see SetStepHistory.
+			config::PatchSwitching<RT> patch_switching_; ///< When to switch the patch of the system, see SetPatchSwitching.
+			mutable Patch original_patch_; ///< The patch the path started on, while it is switched.
+			mutable bool patch_switched_ = false; ///< Whether the patch of the system has been switched on the current path.
+			mutable unsigned num_patch_switches_ = 0; ///< The number of times the patch was switched on the current path.
 
 			// tracking the numbers of things
 			mutable unsigned num_total_steps_taken_; ///< The number of steps taken, including failures and successes.
@@ -529,10 +1091,12 @@ namespace bertini{
 			
 			// configuration for tracking
 			std::shared_ptr<predict::ExplicitRKPredictor > predictor_; // The predictor to use while tracking
-			unsigned predictor_order_; ///< The order of the predictor -- one less than the error estimate order.
+			mutable unsigned predictor_order_; ///< The order of the predictor -- one less than the error estimate order.
 
 			config::Stepping<RT> stepping_config_; ///< The stepping configuration.
 			std::shared_ptr<correct::NewtonCorrector> corrector_;
+			std::shared_ptr<JacobianCache> jacobian_cache_; ///< The most recent Jacobian factorization, shared by the predictor and corrector.
+			std::shared_ptr<TimeBreakdown> time_breakdown_; ///< The time spent at each kind of work, shared by the predictor and corrector.
 			config::Newton newton_config_; ///< The newton configuration.
 
 
@@ -556,6 +1120,7 @@ namespace bertini{
 
 			mutable unsigned num_steps_since_last_condition_number_computation_; ///< How many steps have passed since the most recent condition number estimate.
 			mutable unsigned num_successful_steps_since_stepsize_increase_; ///< How many successful steps have been taken since increased stepsize.
+			mutable double previous_error_ratio_ = 1; ///< With StepSizeController::PI, the error ratio of the most recent successful step.
 			mutable unsigned num_successful_steps_since_precision_decrease_; ///< The number of successful steps since decreased precision.
 
 			mutable std::tuple< Vec<NeededTypes>...> current_space_; ///< The current space value. 
@@ -597,8 +1162,75 @@ namespace bertini{
 
 			virtual Vec<CT> CurrentPoint() const = 0;
 
+			/**
+			\brief Copy the current point into a vector of doubles, rounded if tracking in multiple precision.
+
+			Unlike CurrentPoint, makes no multiple precision copy, and reuses the storage of x, so is cheap enough to call at every step.
+			*/
+			void CurrentPointInto(Vec<dbl> & x) const
+			{
+				if (TrackingInDouble())
+				{
+					x = *CurrentSpace<dbl>();
+					return;
+				}
+				auto const& m = *CurrentSpace<mpfr>();
+				x.resize(m.size());
+				for (int ii = 0; ii < m.size(); ++ii)
+					x(ii) = static_cast<dbl>(m(ii));
+			}
+
+			/**
+			\brief Copy the current point into a vector of multiple precision numbers, at the precision it is tracked at.  Reuses the storage of x.
+			*/
+			void CurrentPointInto(Vec<mpfr> & x) const
+			{
+				if (!TrackingInDouble())
+				{
+					x = *CurrentSpace<mpfr>();
+					return;
+				}
+				auto const& d = *CurrentSpace<dbl>();
+				x.resize(d.size());
+				for (int ii = 0; ii < d.size(); ++ii)
+					x(ii) = mpfr(d(ii));
+			}
+
+
+			/**
+			\brief The derivative dx/dt of the path at the current point and time, solving J dx/dt = -dH/dt.
+			*/
+			virtual Vec<CT> CurrentPathDerivative() const = 0;
+
 
 			virtual unsigned CurrentPrecision() const = 0;
+
+		private:
+
+			// the current point in a number type, or null if the tracker does not track in it
+			template<typename T>
+			Vec<T> const* CurrentSpace() const
+			{
+				return CurrentSpace<T>(std::integral_constant<bool, IsTemplateParameter<T, NeededTypes...>::value>());
+			}
+
+			template<typename T>
+			Vec<T> const* CurrentSpace(std::true_type) const
+			{
+				return &std::get<Vec<T> >(current_space_);
+			}
+
+			template<typename T>
+			Vec<T> const* CurrentSpace(std::false_type) const
+			{
+				return nullptr;
+			}
+
+			// whether the current point is in the double precision space
+			bool TrackingInDouble() const
+			{
+				return CurrentSpace<dbl>() && CurrentPrecision()==DoublePrecision();
+			}
 		};
 
 
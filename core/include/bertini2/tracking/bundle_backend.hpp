@@ -0,0 +1,81 @@
+//This file is part of Bertini 2.
+//
+//bundle_backend.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bundle_backend.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bundle_backend.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file bundle_backend.hpp
+
+\brief Contains the BundleBackend type, through which a BundleTracker hands its steps to another device.
+*/
+
+#ifndef BERTINI_TRACKING_BUNDLE_BACKEND_HPP
+#define BERTINI_TRACKING_BUNDLE_BACKEND_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <vector>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Takes the steps of a BundleTracker, in place of its own Euler prediction and Newton correction on the host.
+
+		For running bundles of thousands of paths on an accelerator.  A backend is made for one system, whose program it gets from System::CompiledProgram, with the registers of its inputs, and uploads once.  Each step then evaluates the program, factors the Jacobians, and predicts and corrects every lane, on the device.  Only the points cross to it and back.
+
+		Implementations, on CUDA, HIP, or SYCL, are built as libraries of their own, outside the core, so the core never needs a device compiler.  A step must report each lane as the host step does: converged, or not with the reason.  Lanes which fail while others succeed are peeled off the bundle, and TrackBundle finishes them with an AMPTracker, so a backend may give up on any lane it cannot handle in double precision, with SuccessCode::HigherPrecisionNecessary.
+
+		\see BundleTracker::SetBackend
+		*/
+		class BundleBackend
+		{
+		public:
+
+			virtual ~BundleBackend() = default;
+
+			/**
+			\brief Predict from (X, t) to t_next, and correct there.
+
+			\param X The current points, one column per lane.
+			\param t The current time.
+			\param delta_t The step in time, t_next - t.
+			\param t_next The time to step to.
+			\param X_next The points at t_next.  Resized if need be.  Lanes which fail may be left anywhere.
+			\param converged Whether each lane converged.  Resized to the number of lanes.
+			\param failures Why each lane which did not converge failed.  Success for those which did.  Resized to the number of lanes.
+			\param tracking_tolerance The Newton corrector must reduce the size of its update below this for a lane to converge.
+			\param newton The number of Newton iterations to use.
+			*/
+			virtual void Step(Mat<dbl> const& X, dbl const& t, dbl const& delta_t, dbl const& t_next, Mat<dbl> & X_next,
+			                  std::vector<bool> & converged, std::vector<SuccessCode> & failures,
+			                  double tracking_tolerance, config::Newton const& newton) = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,228 @@
+//This file is part of Bertini 2.
+//
+//bundle_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bundle_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bundle_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file bundle_endgame.hpp
+
+\brief Contains RunBundleEndgame, for running the power series endgame on several paths together, sampling them in lockstep with a BundleTracker.
+*/
+
+#ifndef BERTINI_BUNDLE_ENDGAME_HPP
+#define BERTINI_BUNDLE_ENDGAME_HPP
+
+#include "bertini2/tracking/bundle_tracker.hpp"
+#include "bertini2/tracking/powerseries_endgame.hpp"
+#include "bertini2/detail/vector_pool.hpp"
+
+#include <algorithm>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Run the power series endgame on a group of paths from the endgame boundary, sampling them together in double precision where possible, and finishing the rest with a scalar endgame.
+
+		The samples of the power series endgame are at the same times for every path, the powers of the sample factor times the boundary time.  So the paths, or lanes, are tracked from each sample time to the next as a bundle, and refined at it, and their derivatives computed, with one batched evaluation of the homotopy per Newton iteration for all of them.  Each lane's samples are then handed to the scalar endgame, to compute its cycle number and its approximation at the origin, in the precision of the start points.  A lane is done when two of its successive approximations agree to the final tolerance, as in PowerSeriesEndgame::Run.
+
+		A lane which the bundle cannot carry is split out, and finished by the scalar endgame's Run from its newest sample: one peeled off the bundle by BundleTracker::TrackLanes, one whose refinement fails to converge or whose Jacobian is too ill-conditioned for double precision, as near singular endpoints, and any left when the time falls below the minimum track time.  Lanes whose approximations both exceed the max norm of the security settings are stopped as in the scalar endgame.
+
+		\param bundle The bundle tracker, for the homotopy.
+		\param scalar The power series endgame, with an adaptive precision tracker, for the same homotopy.  Its settings are used for the bundle too.
+		\param[out] results The approximations at the origin, one per start point.
+		\param start_time The endgame boundary time, at which all the paths start.
+		\param start_points The points at the boundary.
+		\return The success code of each path.
+		*/
+		template<typename EndgameT>
+		std::vector<SuccessCode> RunBundleEndgame(BundleTracker const& bundle, EndgameT & scalar,
+		                                          std::vector< Vec<mpfr> > & results,
+		                                          mpfr const& start_time, std::vector< Vec<mpfr> > const& start_points)
+		{
+			struct Lane
+			{
+				size_t path;
+				Vec<dbl> point; ///< The newest sample, or the boundary point.
+				TimeCont<mpfr> times;
+				SampCont<mpfr> samples;
+				SampCont<mpfr> derivatives;
+				Vec<mpfr> approximation; ///< The previous approximation at the origin, empty until there is one.
+				unsigned cycle_number = 0;
+			};
+
+			std::vector<SuccessCode> codes(start_points.size());
+			results.resize(start_points.size());
+			if (start_points.empty())
+				return codes;
+
+			// the temporaries of every sample of every lane are drawn from the thread's pool, and go back to it when done with
+			auto& pool = detail::VectorPool<mpfr>::ThreadLocal();
+			auto to_mpfr = [&pool](Vec<dbl> const& v)
+			{
+				auto w = pool.Acquire(v.size(), DefaultPrecision());
+				for (long ii = 0; ii < v.size(); ++ii)
+					(*w)(ii) = mpfr(v(ii));
+				return w;
+			};
+
+			auto split = [&](Lane const& lane, dbl const& time, Vec<dbl> const& point)
+			{
+				codes[lane.path] = scalar.Run(mpfr(time), *to_mpfr(point));
+				results[lane.path] = scalar.template FinalApproximation<mpfr>();
+			};
+
+			const auto& endgame_settings = scalar.EndgameSettings();
+			const auto num_needed = std::max<size_t>(endgame_settings.num_sample_points, 3);
+			const auto num_kept = std::max<size_t>(endgame_settings.num_sample_points+1, 3);
+			const double sample_factor = static_cast<double>(endgame_settings.sample_factor);
+			const double min_track_time = static_cast<double>(endgame_settings.min_track_time);
+			const double refinement_tolerance = static_cast<double>(scalar.Tolerances().newton_during_endgame);
+			const auto& final_tolerance = scalar.Tolerances().final_tolerance;
+			const auto& security = scalar.SecuritySettings();
+
+			std::vector<Lane> lanes(start_points.size()), continuing;
+			for (size_t kk = 0; kk < start_points.size(); ++kk)
+			{
+				lanes[kk].path = kk;
+				lanes[kk].point.resize(start_points[kk].size());
+				for (long ii = 0; ii < start_points[kk].size(); ++ii)
+					lanes[kk].point(ii) = dbl(start_points[kk](ii));
+			}
+			scalar.SetRandVec(start_points[0]);
+
+			auto gather = [&lanes](Mat<dbl> & X)
+			{
+				X.resize(lanes[0].point.size(), lanes.size());
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+					X.col(kk) = lanes[kk].point;
+			};
+
+			dbl t(start_time);
+			Mat<dbl> X, dX_dt;
+			while (!lanes.empty())
+			{
+				// take a sample of every lane at t
+				gather(X);
+				auto refined = bundle.RefineLanes(X, t, refinement_tolerance, endgame_settings.max_num_newton_iterations);
+				auto solved = bundle.PathDerivatives(X, t, dX_dt);
+
+				continuing.clear();
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+				{
+					auto& lane = lanes[kk];
+					if (!refined[kk] || !solved[kk])
+					{
+						split(lane, t, lane.point);
+						continue;
+					}
+
+					lane.point = X.col(kk);
+					if (lane.samples.size()==num_kept)
+					{
+						lane.times.pop_front(); lane.samples.pop_front(); lane.derivatives.pop_front();
+					}
+					lane.times.push_back(mpfr(t));
+					lane.samples.push_back(*to_mpfr(lane.point));
+					lane.derivatives.push_back(*to_mpfr(dX_dt.col(kk)));
+
+					if (lane.samples.size() >= num_needed)
+					{
+						scalar.SetTimes(lane.times);
+						scalar.SetSamples(lane.samples);
+						scalar.SetDerivatives(lane.derivatives);
+						scalar.CycleNumber(lane.cycle_number);
+
+						auto approximation_handle = pool.Acquire(lane.point.size(), DefaultPrecision());
+						auto& approximation = *approximation_handle;
+						auto extrapolation_code = scalar.ComputeApproximationOfXAtT0(approximation, mpfr(0));
+						lane.cycle_number = scalar.CycleNumber();
+						if (extrapolation_code!=SuccessCode::Success)
+						{
+							split(lane, t, lane.point);
+							continue;
+						}
+
+						if (lane.approximation.size() > 0)
+						{
+							if ((approximation - lane.approximation).norm() < final_tolerance)
+							{
+								codes[lane.path] = SuccessCode::Success;
+								results[lane.path] = approximation;
+								continue;
+							}
+
+							if (security.level <= 0
+							    && scalar.GetSystem().DehomogenizePoint(approximation).norm() > security.max_norm
+							    && scalar.GetSystem().DehomogenizePoint(lane.approximation).norm() > security.max_norm)
+							{
+								codes[lane.path] = SuccessCode::SecurityMaxNormReached;
+								results[lane.path] = approximation;
+								continue;
+							}
+						}
+						lane.approximation = approximation;
+					}
+
+					continuing.push_back(std::move(lane));
+				}
+				lanes.swap(continuing);
+				if (lanes.empty())
+					break;
+
+				// advance the bundle to the next sample time
+				dbl t_next = t * sample_factor;
+				if (abs(t_next) < min_track_time)
+				{
+					for (auto const& lane : lanes)
+						split(lane, t, lane.point);
+					break;
+				}
+
+				gather(X);
+				auto tracked = bundle.TrackLanes(t, t_next, X);
+
+				continuing.clear();
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+				{
+					if (tracked[kk].success==SuccessCode::Success)
+					{
+						lanes[kk].point = tracked[kk].point;
+						continuing.push_back(std::move(lanes[kk]));
+					}
+					else
+						split(lanes[kk], tracked[kk].time, tracked[kk].point);
+				}
+				lanes.swap(continuing);
+				t = t_next;
+			}
+
+			return codes;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,469 @@
+//This file is part of Bertini 2.
+//
+//bundle_tracker.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bundle_tracker.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bundle_tracker.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file bundle_tracker.hpp
+
+\brief Contains the BundleTracker type, for tracking several paths together in double precision.
+*/
+
+#ifndef BERTINI_BUNDLE_TRACKER_HPP
+#define BERTINI_BUNDLE_TRACKER_HPP
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/bundle_backend.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Tracks a bundle of paths in lockstep, in double precision.
+
+		All the paths, or lanes, of the bundle share the path variable and the step size, so every step evaluates the homotopy at all of them with one pass of System::EvalJacobianAndTimeDerivativeBatch.  Each step is an Euler prediction followed by Newton correction, with a small dense LU factorization per lane.
+
+		A lane which fails to converge while others succeed, or whose Jacobian is too ill-conditioned for double precision at the tracking tolerance, is peeled off the bundle, so that it does not hold back the others.  Its last accepted time and point are reported, from which it can be finished by a scalar tracker.  See TrackBundle, which does this with an AMPTracker.
+
+		\code
+		BundleTracker bundle(homotopy);
+		bundle.Setup(1e-5, config::Stepping<double>(), config::Newton());
+
+		auto lanes = bundle.TrackLanes(dbl(1), dbl(0.1), start_points); // one column per path
+		\endcode
+		*/
+		class BundleTracker
+		{
+		public:
+
+			/**
+			\brief Where a lane ended up.
+			*/
+			struct LaneResult
+			{
+				SuccessCode success = SuccessCode::Failure; ///< Success if the lane reached the end time, otherwise why it was peeled off.
+				dbl time; ///< The time the lane reached.  The end time on success, otherwise the last accepted time.
+				Vec<dbl> point; ///< The point at that time.
+				unsigned num_steps = 0; ///< The number of steps the lane took part in, successful or not.
+			};
+
+
+			explicit
+			BundleTracker(System const& sys) : tracked_system_(sys)
+			{}
+
+
+			/**
+			\brief Set the tolerance and stepping for the bundle.
+
+			\param tracking_tolerance The Newton corrector must reduce the size of its update below this for a step to succeed.
+			\param stepping The step size settings, shared by all lanes.
+			\param newton The number of Newton iterations to use.
+			*/
+			void Setup(double tracking_tolerance, config::Stepping<double> const& stepping, config::Newton const& newton)
+			{
+				tracking_tolerance_ = tracking_tolerance;
+				stepping_config_ = stepping;
+				newton_config_ = newton;
+			}
+
+			const System& GetSystem() const
+			{
+				return tracked_system_;
+			}
+
+			/**
+			\brief Take the steps of the bundle on a backend, such as an accelerator, rather than on the host.  Pass nullptr to step on the host again.
+
+			The backend must have been made for the system of this tracker.  Lanes are peeled off and reported as they are when stepping on the host.
+			*/
+			void SetBackend(std::shared_ptr<BundleBackend> const& backend)
+			{
+				backend_ = backend;
+			}
+
+			std::shared_ptr<BundleBackend> const& GetBackend() const
+			{
+				return backend_;
+			}
+
+
+			/**
+			\brief Track a bundle of paths from a start time to an end time.
+
+			\param start_time The time at which all the paths start.
+			\param end_time The time to track to.
+			\param start_points The start points, one column per lane.
+			\return The outcome for each lane, in the order of the columns.
+			*/
+			std::vector<LaneResult> TrackLanes(dbl const& start_time, dbl const& end_time, Mat<dbl> const& start_points) const
+			{
+				if (start_points.rows()!=tracked_system_.NumVariables())
+					throw std::runtime_error("number of rows of start points for bundle tracking must match the number of variables of the system");
+
+				std::vector<LaneResult> results(start_points.cols());
+				std::vector<size_t> lanes(start_points.cols());
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+					lanes[kk] = kk;
+
+				Mat<dbl> X = start_points, X_next;
+				dbl t = start_time;
+				double step_size = stepping_config_.initial_step_size;
+				unsigned num_consecutive_successes = 0;
+				unsigned num_steps = 0;
+
+				Mat<dbl> F, ds_dt;
+				std::vector< Mat<dbl> > J;
+				std::vector<bool> converged;
+				std::vector<SuccessCode> failures;
+
+				auto peel = [&](size_t kk, SuccessCode code)
+				{
+					auto& r = results[lanes[kk]];
+					r.success = code;
+					r.time = t;
+					r.point = X.col(kk);
+					r.num_steps = num_steps;
+				};
+
+				while (!lanes.empty() && t!=end_time)
+				{
+					if (num_steps >= stepping_config_.max_num_steps)
+					{
+						for (size_t kk = 0; kk < lanes.size(); ++kk)
+							peel(kk, SuccessCode::MaxNumStepsTaken);
+						lanes.clear();
+						break;
+					}
+					++num_steps;
+
+					dbl remaining = end_time - t;
+					dbl delta_t = abs(remaining) <= step_size ? remaining : remaining * (step_size / abs(remaining));
+					dbl t_next = abs(remaining) <= step_size ? end_time : t + delta_t;
+
+					if (backend_)
+						backend_->Step(X, t, delta_t, t_next, X_next, converged, failures, tracking_tolerance_, newton_config_);
+					else
+						Step(X, t, delta_t, t_next, X_next, F, J, ds_dt, converged, failures);
+
+					size_t num_converged = std::count(converged.begin(), converged.end(), true);
+					if (num_converged==lanes.size())
+					{
+						X.swap(X_next);
+						t = t_next;
+
+						if (++num_consecutive_successes >= stepping_config_.consecutive_successful_steps_before_stepsize_increase)
+						{
+							step_size = std::min(step_size * stepping_config_.step_size_success_factor, stepping_config_.max_step_size);
+							num_consecutive_successes = 0;
+						}
+					}
+					else if (num_converged > 0)
+					{
+						// the lanes which failed are the outliers.  peel them off, and retry the step with the rest.
+						KeepLanes(converged, failures, X, lanes, peel);
+						num_consecutive_successes = 0;
+					}
+					else
+					{
+						step_size *= stepping_config_.step_size_fail_factor;
+						num_consecutive_successes = 0;
+
+						if (step_size < stepping_config_.min_step_size)
+						{
+							for (size_t kk = 0; kk < lanes.size(); ++kk)
+								peel(kk, SuccessCode::MinStepSizeReached);
+							lanes.clear();
+						}
+						else
+							// lanes needing more precision won't be helped by a smaller step
+							KeepLanes(converged, failures, X, lanes, peel, SuccessCode::HigherPrecisionNecessary);
+					}
+				}
+
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+				{
+					auto& r = results[lanes[kk]];
+					r.success = SuccessCode::Success;
+					r.time = t;
+					r.point = X.col(kk);
+					r.num_steps = num_steps;
+				}
+
+				return results;
+			}
+
+
+			/**
+			\brief Refine the lanes at a fixed time with Newton's method, evaluating all of them together.
+
+			Each lane stops being updated once its Newton update is smaller than the tolerance, though it is evaluated with the others until all have.
+
+			\param[in,out] X The points, one column per lane.
+			\param t The time, held fixed.
+			\param tolerance The size of Newton update at which a lane has converged.
+			\param max_num_iterations The most Newton iterations to take.
+			\return Whether each lane converged.
+			*/
+			std::vector<bool> RefineLanes(Mat<dbl> & X, dbl const& t, double tolerance, unsigned max_num_iterations) const
+			{
+				const auto num_lanes = X.cols();
+				std::vector<bool> converged(num_lanes, false), failed(num_lanes, false);
+
+				Mat<dbl> F, ds_dt;
+				std::vector< Mat<dbl> > J;
+				Vec<dbl> dx;
+				for (unsigned ii = 0; ii < max_num_iterations; ++ii)
+				{
+					tracked_system_.EvalJacobianAndTimeDerivativeBatch(X, t, F, J, ds_dt);
+
+					bool all_done = true;
+					for (long kk = 0; kk < num_lanes; ++kk)
+					{
+						if (converged[kk] || failed[kk])
+							continue;
+
+						if (!Solve(J[kk], F.col(kk), dx, tolerance))
+						{
+							failed[kk] = true;
+							continue;
+						}
+
+						X.col(kk) -= dx;
+						converged[kk] = dx.norm() < tolerance;
+						all_done = all_done && converged[kk];
+					}
+					if (all_done)
+						break;
+				}
+				return converged;
+			}
+
+
+			/**
+			\brief The derivative dx/dt of the path through each lane, solving (dH/dx) dx/dt = -dH/dt, from one evaluation of all the lanes together.
+
+			\param X The points, one column per lane.
+			\param t The time.
+			\param[out] dX_dt The derivatives, one column per lane.
+			\return Whether the solve for each lane succeeded.  Those which did not have zero derivative.
+			*/
+			std::vector<bool> PathDerivatives(Mat<dbl> const& X, dbl const& t, Mat<dbl> & dX_dt) const
+			{
+				Mat<dbl> F, ds_dt;
+				std::vector< Mat<dbl> > J;
+				tracked_system_.EvalJacobianAndTimeDerivativeBatch(X, t, F, J, ds_dt);
+
+				std::vector<bool> solved(X.cols());
+				dX_dt.resize(X.rows(), X.cols());
+				Vec<dbl> dx;
+				for (long kk = 0; kk < X.cols(); ++kk)
+				{
+					solved[kk] = Solve(J[kk], ds_dt.col(kk), dx, tracking_tolerance_);
+					if (solved[kk])
+						dX_dt.col(kk) = -dx;
+					else
+						dX_dt.col(kk).setZero();
+				}
+				return solved;
+			}
+
+		private:
+
+			/**
+			Solve one lane's linear system, failing if the Jacobian is too ill-conditioned for double precision to leave the tolerance in reach.
+			*/
+			static bool Solve(Mat<dbl> const& J, Vec<dbl> const& rhs, Vec<dbl> & sol, double tolerance)
+			{
+				// the number of digits the solve may lose, and still leave the tolerance in reach of double precision.
+				const double max_condition_number = std::pow(10.0, 15.0 + std::log10(tolerance));
+
+				Eigen::PartialPivLU< Mat<dbl> > lu(J);
+				double rcond = lu.rcond();
+				if (!(rcond > 0) || 1/rcond > max_condition_number)
+					return false;
+				sol = lu.solve(rhs);
+				return true;
+			}
+
+			/**
+			Predict with Euler's method from (X, t) to t_next, and correct with Newton's method.  converged and failures get one entry per lane.
+			*/
+			void Step(Mat<dbl> const& X, dbl const& t, dbl const& delta_t, dbl const& t_next, Mat<dbl> & X_next,
+			          Mat<dbl> & F, std::vector< Mat<dbl> > & J, Mat<dbl> & ds_dt,
+			          std::vector<bool> & converged, std::vector<SuccessCode> & failures) const
+			{
+				const auto num_lanes = X.cols();
+				converged.assign(num_lanes, true);
+				failures.assign(num_lanes, SuccessCode::Success);
+
+				auto solve = [&](long kk, Vec<dbl> const& rhs, Vec<dbl> & sol)
+				{
+					if (!Solve(J[kk], rhs, sol, tracking_tolerance_))
+					{
+						converged[kk] = false;
+						failures[kk] = SuccessCode::HigherPrecisionNecessary;
+						return false;
+					}
+					return true;
+				};
+
+				tracked_system_.EvalJacobianAndTimeDerivativeBatch(X, t, F, J, ds_dt);
+
+				X_next.resize(X.rows(), num_lanes);
+				Vec<dbl> dx;
+				for (long kk = 0; kk < num_lanes; ++kk)
+					if (solve(kk, ds_dt.col(kk), dx))
+						X_next.col(kk) = X.col(kk) - delta_t * dx;
+					else
+						X_next.col(kk) = X.col(kk);
+
+				for (unsigned ii = 0; ii < newton_config_.max_num_newton_iterations; ++ii)
+				{
+					tracked_system_.EvalJacobianAndTimeDerivativeBatch(X_next, t_next, F, J, ds_dt);
+
+					for (long kk = 0; kk < num_lanes; ++kk)
+					{
+						if (failures[kk]!=SuccessCode::Success)
+							continue;
+
+						if (!solve(kk, F.col(kk), dx))
+							continue;
+
+						X_next.col(kk) -= dx;
+
+						bool last = ii+1==newton_config_.max_num_newton_iterations;
+						bool small = dx.norm() < tracking_tolerance_;
+						if (last || (small && ii+1 >= newton_config_.min_num_newton_iterations))
+							converged[kk] = small;
+					}
+				}
+
+				for (long kk = 0; kk < num_lanes; ++kk)
+					if (!converged[kk] && failures[kk]==SuccessCode::Success)
+						failures[kk] = SuccessCode::FailedToConverge;
+			}
+
+
+			/**
+			Peel off the lanes which failed, or only those which failed with a given code, keeping the others in X and lanes.
+			*/
+			template<typename PeelT>
+			static void KeepLanes(std::vector<bool> const& converged, std::vector<SuccessCode> const& failures,
+			                      Mat<dbl> & X, std::vector<size_t> & lanes, PeelT const& peel,
+			                      SuccessCode only = SuccessCode::Success)
+			{
+				std::vector<size_t> kept;
+				for (size_t kk = 0; kk < lanes.size(); ++kk)
+				{
+					if (converged[kk] || (only!=SuccessCode::Success && failures[kk]!=only))
+						kept.push_back(kk);
+					else
+						peel(kk, failures[kk]);
+				}
+
+				if (kept.size()==lanes.size())
+					return;
+
+				Mat<dbl> X_kept(X.rows(), kept.size());
+				std::vector<size_t> lanes_kept(kept.size());
+				for (size_t kk = 0; kk < kept.size(); ++kk)
+				{
+					X_kept.col(kk) = X.col(kept[kk]);
+					lanes_kept[kk] = lanes[kept[kk]];
+				}
+				X.swap(X_kept);
+				lanes.swap(lanes_kept);
+			}
+
+
+			const System& tracked_system_; ///< The system being tracked.
+
+			double tracking_tolerance_ = 1e-5;
+			config::Stepping<double> stepping_config_;
+			config::Newton newton_config_;
+
+			std::shared_ptr<BundleBackend> backend_; ///< Takes the steps, if set.
+		};
+
+
+
+		/**
+		\brief Track a group of paths, as a bundle in double precision where possible, finishing the rest with an adaptive precision tracker.
+
+		Lanes peeled off the bundle are tracked by the scalar tracker from where they left it, at the current default precision.
+
+		\param bundle The bundle tracker.
+		\param scalar The adaptive precision tracker, for the same homotopy.
+		\param[out] results The endpoints, one per start point.
+		\param start_time The time at which all the paths start.
+		\param end_time The time to track to, such as the endgame boundary.
+		\param start_points The start points.
+		\return The success code of each path.
+		*/
+		inline
+		std::vector<SuccessCode> TrackBundle(BundleTracker const& bundle, AMPTracker const& scalar,
+		                                     std::vector< Vec<mpfr> > & results,
+		                                     mpfr const& start_time, mpfr const& end_time,
+		                                     std::vector< Vec<mpfr> > const& start_points)
+		{
+			std::vector<SuccessCode> codes(start_points.size());
+			results.resize(start_points.size());
+			if (start_points.empty())
+				return codes;
+
+			Mat<dbl> X(start_points[0].size(), start_points.size());
+			for (size_t kk = 0; kk < start_points.size(); ++kk)
+				for (long ii = 0; ii < X.rows(); ++ii)
+					X(ii,kk) = dbl(start_points[kk](ii));
+
+			auto lanes = bundle.TrackLanes(dbl(start_time), dbl(end_time), X);
+
+			for (size_t kk = 0; kk < lanes.size(); ++kk)
+			{
+				Vec<mpfr> point(lanes[kk].point.size());
+				for (long ii = 0; ii < point.size(); ++ii)
+					point(ii) = mpfr(lanes[kk].point(ii));
+
+				if (lanes[kk].success==SuccessCode::Success)
+				{
+					codes[kk] = SuccessCode::Success;
+					results[kk] = point;
+				}
+				else
+					codes[kk] = scalar.TrackPath(results[kk], mpfr(lanes[kk].time), end_time, point);
+			}
+
+			return codes;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
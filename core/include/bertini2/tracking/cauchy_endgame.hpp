@@ -29,6 +29,8 @@
 
 #include "bertini2/tracking/base_endgame.hpp"
 
+#include <thread>
+
 
 namespace bertini{ namespace tracking { namespace endgame{
 
@@ -107,7 +109,7 @@ Vec<ComplexT> result;
 //4. Track all points to 0.1
 for (unsigned ii = 0; ii < TD_start_sys.NumStartPoints(); ++ii)
 {
-    mpfr_float::default_precision(ambient_precision);
+    DefaultPrecision(ambient_precision);
     my_homotopy.precision(ambient_precision); // making sure our precision is all set up 
     auto start_point = TD_start_sys.StartPoint<ComplexT>(ii);
 
@@ -200,12 +202,57 @@ protected:
 	*/
 	mutable std::tuple<SampCont<UsedNumTs>...> cauchy_samples_;
 
+	/**
+	\brief The times and samples of the last closed loop, and its cycle number, kept by ComputeCauchySamples to predict the starts of the arcs of the next loop when tracking them concurrently.
+	*/
+	mutable std::tuple<TimeCont<UsedNumTs>...> previous_cauchy_times_;
+	mutable std::tuple<SampCont<UsedNumTs>...> previous_cauchy_samples_;
+	mutable unsigned previous_cycle_number_ = 0;
+
+	/**
+	\brief With hermite_quadrature, the number of sample points per loop, adapted after each Cauchy approximation.  0 until adapted, for num_sample_points.
+	*/
+	mutable unsigned num_circle_points_ = 0;
+
+	/**
+	\brief A copy of the system and a tracker for it, for tracking arcs on another thread.
+	*/
+	struct ArcWorker
+	{
+		System system;
+		std::unique_ptr<TrackerType> tracker;
+	};
+
+	/**
+	\brief The workers for tracking arcs concurrently, made when first needed.
+	*/
+	mutable std::vector<std::unique_ptr<ArcWorker> > arc_workers_;
+
 
 
 	
 	
 
 public:
+
+	/**
+	\brief An estimate of the memory held by the endgame, by component, including its samples at their current precision.
+	*/
+	MemoryReport MemoryUsage() const
+	{
+		using memory::HeapBytes;
+
+		auto report = EndgameBase<TrackerType, FinalEGT>::MemoryUsage();
+		report.Add("power series samples", HeapBytes(pseg_times_) + HeapBytes(pseg_samples_));
+		report.Add("cauchy samples", HeapBytes(cauchy_times_) + HeapBytes(cauchy_samples_) + HeapBytes(previous_cauchy_times_) + HeapBytes(previous_cauchy_samples_));
+		for (auto const& w : arc_workers_)
+		{
+			report.Add("circle thread system: ", w->system.MemoryUsage());
+			report.Add("circle thread tracker: ", w->tracker->MemoryUsage());
+		}
+		return report;
+	}
+
 	/**
 	\brief Function that clears all samples and times from data members for the Cauchy endgame
 	*/
@@ -215,7 +262,21 @@ public:
 		std::get<TimeCont<CT> >(pseg_times_).clear(); 
 		std::get<TimeCont<CT> >(cauchy_times_).clear(); 
 		std::get<SampCont<CT> >(pseg_samples_).clear(); 
-		std::get<SampCont<CT> >(cauchy_samples_).clear();}
+		std::get<SampCont<CT> >(cauchy_samples_).clear();
+		std::get<TimeCont<CT> >(previous_cauchy_times_).clear();
+		std::get<SampCont<CT> >(previous_cauchy_samples_).clear();
+		previous_cycle_number_ = 0;
+		num_circle_points_ = 0;}
+
+	/**
+	\brief Forget the path run on last, in each type of number used, keeping the settings and the storage of the samples.  Run does this itself, for the type of number it runs in; a driver running many paths with one endgame may call it between them.
+	*/
+	void Reset()
+	{
+		(void)std::initializer_list<int>{(ClearTimesAndSamples<UsedNumTs>(), 0)...};
+		this->ResetPathState();
+	}
+
 	/**
 	\brief Setter for the deque holding time values for the power series approximation of the Cauchy endgame. 
 	*/
@@ -275,6 +336,14 @@ public:
 	\brief Getter for the specific settings in tracking_conifg.hpp under Cauchy.
 	*/
 	auto& GetCauchySettings(){return cauchy_settings_;}
+
+	/**
+	\brief The number of sample points on each loop around the origin.  num_sample_points, unless adapted with hermite_quadrature.
+	*/
+	unsigned NumCirclePoints() const
+	{
+		return num_circle_points_ ? num_circle_points_ : this->EndgameSettings().num_sample_points;
+	}
 	
 
 	explicit CauchyEndgame(TrackerType const& tr, 
@@ -315,51 +384,47 @@ public:
 	template<typename CT> 
 	SuccessCode CircleTrack(CT const& starting_time, Vec<CT> const& starting_sample)
 	{	
+		BERTINI_TRACE_ZONE("CircleTrack");
 		using bertini::Precision;
 		assert(Precision(starting_time)==Precision(starting_sample) && "starting time and sample for circle track must be of same precision");
 		DefaultPrecision(Precision(starting_time));
 
-		using RT = typename Eigen::NumTraits<CT>::Real;
-		using std::acos;
-
-		if (this->EndgameSettings().num_sample_points < 3) // need to make sure we won't track right through the origin.
+		if (NumCirclePoints() < 3) // need to make sure we won't track right through the origin.
 		{
 			std::stringstream err_msg;
-			err_msg << "ERROR: The number of sample points " << this->EndgameSettings().num_sample_points << " for circle tracking must be >= 3";
+			err_msg << "ERROR: The number of sample points " << NumCirclePoints() << " for circle tracking must be >= 3";
 			throw std::runtime_error(err_msg.str());
 		}	
 
 		auto& circle_times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& circle_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		++this->stats_.num_circle_tracks;
 
 		// the initial sample has already been added to the sample repo... so don't do that here, please
 		
 		const auto num_vars = this->GetSystem().NumVariables();
 
-		for (unsigned ii = 0; ii < this->EndgameSettings().num_sample_points; ++ii)
+		unsigned first_sequential_arc = 0;
+		if (cauchy_settings_.num_circle_threads > 1)
+		{
+			first_sequential_arc = TrackArcsConcurrently(starting_time);
+			BERTINI_LOG(trace) << "tracked " << first_sequential_arc << " of " << NumCirclePoints() << " arcs concurrently";
+		}
+
+		for (unsigned ii = first_sequential_arc; ii < NumCirclePoints(); ++ii)
 		{
 			const Vec<CT>& current_sample = circle_samples.back();
 			const CT& current_time = circle_times.back();
 			assert(Precision(current_time)==Precision(current_sample) && "current time and sample for circle track must be of same precision");
 
 			//set up the time value for the next sample. 
-			using std::polar;
-			using bertini::polar;
-
-			RT radius = abs(starting_time), angle = arg(starting_time);
-
 			auto next_sample = Vec<CT>(num_vars);
-			auto next_time = (ii==this->EndgameSettings().num_sample_points-1) 
-								?
-							  starting_time
-								:
-							  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / (this->EndgameSettings().num_sample_points) + angle)
-							  ;
+			auto next_time = CircleTime(starting_time, ii+1);
 
 			auto tracking_success = this->GetTracker().TrackPath(next_sample, current_time, next_time, current_sample);	
 			if (tracking_success != SuccessCode::Success)
 			{
-				std::cout << "tracker fail in circle track, radius " << radius << ", type " << int(tracking_success) << std::endl;
+				std::cout << "tracker fail in circle track, radius " << abs(starting_time) << ", type " << int(tracking_success) << std::endl;
 				return tracking_success;
 			}
 
@@ -376,6 +441,7 @@ public:
 
 			circle_times.push_back(next_time);
 			circle_samples.push_back(next_sample);
+			this->CountSample(next_sample);
 
 			// down here next_sample and next_time should have the same precision.
 		}
@@ -385,6 +451,185 @@ public:
 	}//end CircleTrack
 
 
+	/**
+	\brief The time of a vertex of the polygon CircleTrack tracks around the origin, counting from the starting time.  The last vertex is the starting time itself.
+	*/
+	template<typename CT>
+	CT CircleTime(CT const& starting_time, unsigned vertex) const
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::acos;
+		using std::polar;
+		using bertini::polar;
+
+		const auto num_sample_points = NumCirclePoints();
+		if (vertex==0 || vertex==num_sample_points)
+			return starting_time;
+
+		RT radius = abs(starting_time), angle = arg(starting_time);
+		return polar(radius, vertex*2*acos(static_cast<RT>(-1)) / num_sample_points + angle);
+	}
+
+
+	/**
+		\brief Track the arcs of one circle around the origin on several threads at once, from starts predicted by the previous closed loop.
+
+		## Input: 
+				starting_time: the time at which the circle starts.  The sample there is the last of the cauchy samples.
+
+		## Output:
+				The number of arcs tracked, whose samples were added to the cauchy samples.  CircleTrack tracks the rest in sequence.  Zero if there is no previous loop to predict from.
+
+		##Details:
+				\tparam CT The complex number type.
+				The previous loop was at a larger radius, along the same ray, with some cycle number c.  Near the origin a path is a power series in s = t^(1/c), so the sample at the same angle and on the same sheet, less the center of the previous loop, scales to first order by the ratio of the radii to the power 1/c.  Each predicted start is refined by Newton's method at its time, then each arc is tracked by its own copy of the system and tracker.
+				
+				Arcs are accepted in order.  An arc whose end does not meet the refined start of the next is kept, since it was tracked from a good start, but the arcs after it are left to sequential tracking, as are any which failed.
+	*/
+	template<typename CT>
+	unsigned TrackArcsConcurrently(CT const& starting_time)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using bertini::Precision;
+		using std::pow;
+
+		auto& circle_times = std::get<TimeCont<CT> >(cauchy_times_);
+		auto& circle_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		const auto& previous_times = std::get<TimeCont<CT> >(previous_cauchy_times_);
+		const auto& previous_samples = std::get<SampCont<CT> >(previous_cauchy_samples_);
+
+		const unsigned num_arcs = NumCirclePoints();
+		const unsigned c = previous_cycle_number_;
+		const auto first = circle_samples.size()-1; // the index of the starting sample in the loop
+
+		if (c==0 || previous_samples.size()!=c*num_arcs+1 || first+num_arcs > c*num_arcs)
+			return 0;
+
+		const unsigned num_threads = std::min(cauchy_settings_.num_circle_threads, num_arcs);
+		SetupArcWorkers(num_threads);
+
+		Vec<CT> center = Vec<CT>::Zero(previous_samples.front().size());
+		for (unsigned ii = 0; ii < c*num_arcs; ++ii)
+			center += previous_samples[ii];
+		center /= static_cast<RT>(c*num_arcs);
+		const CT scale(pow(abs(starting_time)/abs(previous_times.front()), static_cast<RT>(1)/c));
+
+		std::vector<CT> arc_times(num_arcs+1);
+		std::vector<Vec<CT> > starts(num_arcs), ends(num_arcs);
+		std::vector<SuccessCode> codes(num_arcs, SuccessCode::Failure);
+
+		for (unsigned ii = 0; ii <= num_arcs; ++ii)
+			arc_times[ii] = CircleTime(starting_time, ii);
+		starts[0] = circle_samples.back();
+		for (unsigned ii = 1; ii < num_arcs; ++ii)
+		{
+			starts[ii] = center + (previous_samples[first+ii] - center) * scale;
+			AsDerived().EnsureAtPrecision(arc_times[ii], Precision(starts[ii]));
+		}
+
+		const auto precision = Precision(starting_time);
+		const RT refinement_tolerance(this->Tolerances().newton_during_endgame);
+		const auto max_iterations = this->EndgameSettings().max_num_newton_iterations;
+
+		std::vector<std::thread> threads;
+		for (unsigned tt = 0; tt < num_threads; ++tt)
+			threads.emplace_back([&, tt]()
+			{
+				DefaultPrecision(precision);
+				auto const& tracker = *arc_workers_[tt]->tracker;
+				for (unsigned ii = tt; ii < num_arcs; ii += num_threads)
+				{
+					try
+					{
+						if (ii > 0)
+						{
+							codes[ii] = tracker.Refine(starts[ii], starts[ii], arc_times[ii], refinement_tolerance, max_iterations);
+							if (codes[ii] != SuccessCode::Success)
+								continue;
+						}
+						codes[ii] = tracker.TrackPath(ends[ii], arc_times[ii], arc_times[ii+1], starts[ii]);
+					}
+					catch (std::exception const& e)
+					{
+						BERTINI_LOG(debug) << "concurrent arc " << ii << " threw: " << e.what();
+						codes[ii] = SuccessCode::Failure;
+					}
+				}
+			});
+		for (auto& t : threads)
+			t.join();
+
+		unsigned num_accepted = 0;
+		while (num_accepted < num_arcs && codes[num_accepted] == SuccessCode::Success)
+		{
+			const auto ii = num_accepted;
+			CT& next_time = arc_times[ii+1];
+			Vec<CT>& next_sample = ends[ii];
+
+			AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
+			if (AsDerived().RefineSample(next_sample, next_sample, next_time) != SuccessCode::Success)
+				break;
+			AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
+
+			circle_times.push_back(next_time);
+			circle_samples.push_back(next_sample);
+			this->CountSample(next_sample);
+			++num_accepted;
+
+			// the next arc started on the path only if this one ends where it started
+			if (ii+1 < num_arcs && (next_sample - starts[ii+1]).norm() > this->GetTracker().TrackingTolerance())
+			{
+				BERTINI_LOG(debug) << "concurrent arcs " << ii << " and " << ii+1 << " do not meet, tracking the rest in sequence";
+				break;
+			}
+		}
+		return num_accepted;
+	}
+
+
+	/**
+	\brief Make, or remake, the copies of the system and tracker for tracking arcs concurrently, and give the trackers the settings of the endgame's tracker.
+	*/
+	void SetupArcWorkers(unsigned num_workers) const
+	{
+		const auto& tracker = this->GetTracker();
+
+		bool remake = arc_workers_.size()!=num_workers;
+		if (TrackerTraits<TrackerType>::IsFixedPrec)
+			for (auto const& w : arc_workers_)
+				remake = remake || w->tracker->CurrentPrecision()!=tracker.CurrentPrecision();
+
+		if (remake)
+		{
+			arc_workers_.clear();
+			for (unsigned ii = 0; ii < num_workers; ++ii)
+			{
+				std::unique_ptr<ArcWorker> w(new ArcWorker);
+				w->system = Clone(this->GetSystem());
+				w->tracker.reset(new TrackerType(w->system));
+				arc_workers_.push_back(std::move(w));
+			}
+		}
+
+		for (auto& w : arc_workers_)
+		{
+			w->system.precision(this->GetSystem().precision());
+			w->tracker->Setup(tracker.Predictor(), tracker.TrackingTolerance(), tracker.PathTruncationThreshold(), tracker.SteppingSettings(), tracker.NewtonSettings());
+			PrecisionSetupArcTracker(*w, std::integral_constant<bool, TrackerTraits<TrackerType>::IsAdaptivePrec==1>());
+		}
+	}
+
+	void PrecisionSetupArcTracker(ArcWorker & w, std::true_type) const
+	{
+		w.tracker->PrecisionSetup(this->GetTracker().PrecisionSettings());
+	}
+
+	void PrecisionSetupArcTracker(ArcWorker & w, std::false_type) const
+	{
+		w.tracker->PrecisionSetup(typename TrackerTraits<TrackerType>::PrecisionConfig(w.system));
+	}
+
+
 	/**
 		\brief A function that uses the assumption of being in the endgame operating zone to compute an approximation of the ratio c over k. 
 			When the cycle number stabilizes we will see that the different approximations of c over k will stabilize. 
@@ -416,7 +661,7 @@ public:
 		const Vec<CT> & sample1 = pseg_samples[1];
 		const Vec<CT> & sample2 = pseg_samples[2];
 
-		Vec<CT> rand_vector = Vec<CT>::Random(sample0.size()); //should be a row vector for ease in multiplying.
+		Vec<CT> rand_vector = RandomOfUnits<CT>(sample0.size()); //should be a row vector for ease in multiplying.
 
 
 		// //DO NOT USE Eigen .dot() it will do conjugate transpose which is not what we want.
@@ -542,6 +787,7 @@ public:
 		using RT = typename Eigen::NumTraits<CT>::Real;
 		auto& times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& samples = std::get<SampCont<CT> >(cauchy_samples_);
+		++this->stats_.num_cycle_number_trials;
 
 		if((samples.front() - samples.back()).norm() < this->GetTracker().TrackingTolerance())
 		{
@@ -601,7 +847,7 @@ public:
 		else
 		{
 			RT norm;
-			for(unsigned int ii=0; ii < this->EndgameSettings().num_sample_points; ++ii)
+			for(unsigned int ii=0; ii < NumCirclePoints(); ++ii)
 			{
 				norm = samples[ii].norm();
 				if(norm > max)
@@ -739,6 +985,7 @@ public:
 
 				if(tracking_success != SuccessCode::Success)
 					return tracking_success;
+				this->CountSample(next_sample);
 			}
 		} //end while(continue_loop)
 
@@ -773,11 +1020,6 @@ public:
 	SuccessCode InitialPowerSeriesApproximation(CT const& start_time, Vec<CT> const& start_point, 
 	                                            CT const& approximation_time, Vec<CT> & approximation)
 	{	
-		using RT = typename Eigen::NumTraits<CT>::Real;
-
-		//initialize array holding c_over_k estimates
-		std::deque<RT> c_over_k; 
-
 		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
 		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
 
@@ -786,6 +1028,26 @@ public:
 		if (initial_sample_success!=SuccessCode::Success)
 			return initial_sample_success;
 
+		return InitialPowerSeriesApproximationFromSamples(approximation_time, approximation);
+	}
+
+
+	/**
+	\brief The part of InitialPowerSeriesApproximation after the initial samples, starting from the samples already in pseg_times_ and pseg_samples_.
+
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	SuccessCode InitialPowerSeriesApproximationFromSamples(CT const& approximation_time, Vec<CT> & approximation)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+
+		//initialize array holding c_over_k estimates
+		std::deque<RT> c_over_k; 
+
+		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
+		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
+
 		c_over_k.push_back(ComputeCOverK<CT>());
 
 		Vec<CT> next_sample;
@@ -802,6 +1064,7 @@ public:
 				return tracking_success;
 
 			AsDerived().EnsureAtPrecision(next_time, Precision(next_sample));
+			this->CountSample(next_sample);
 
 			ps_samples.pop_front();
 			ps_times.pop_front();
@@ -824,6 +1087,7 @@ public:
 				return tracking_success;
 
 			AsDerived().EnsureAtPrecision(next_time, Precision(next_sample));
+			this->CountSample(next_sample);
 
 			c_over_k.pop_front();
 			ps_samples.pop_front();
@@ -911,6 +1175,8 @@ public:
 			s_times[ii] =  pow(ps_times[ii], 1/c);
 		}
 
+		++this->stats_.num_hermite_interpolations;
+		++this->stats_.num_approximations;
 		result = HermiteInterpolateAndSolve(time_t0, num_sample_points, 
                                             s_times, ps_samples, s_derivatives);
 		return SuccessCode::Success;
@@ -929,6 +1195,10 @@ public:
 		##Details:
 	\tparam CT The complex number type.
 				We can compute the Cauchy Integral Formula in this particular instance by computing the mean of the samples we have collected around the origin. 
+
+				The mean is the trapezoid rule on the loops, in \f$s = t^{1/c}\f$, where the path is a power series.  Of the \f$M = cN\f$ samples, for N points per loop, it is exact but for the coefficients of \f$s^M, s^{2M}, \dots\f$.  With hermite_quadrature, the mean of \f$s \frac{dx}{ds} = c t \frac{dx}{dt}\f$ over the samples, M times the first of those, is subtracted, so that the approximation is exact but for \f$s^{2M}, \dots\f$, as that of twice the samples.  Each derivative is one linear solve at a sample, rather than the tracking of an arc.
+
+				The correction is the error of the plain mean, from which the number of points on later loops is adapted: one fewer, down to min_num_circle_points, when it is within the final tolerance, and one more, up to num_sample_points, when its square is not.
 	*/
 	template<typename CT>
 	SuccessCode ComputeCauchyApproximationOfXAtT0(Vec<CT>& result)
@@ -937,14 +1207,17 @@ public:
 		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
-		if (cau_samples.size() != this->CycleNumber() * this->EndgameSettings().num_sample_points+1)
+		const unsigned num_circle_points = NumCirclePoints();
+		if (cau_samples.size() != this->CycleNumber() * num_circle_points+1)
 		{
 			std::stringstream err_msg;
-			err_msg << "to compute cauchy approximation, cauchy_samples must be of size " << this->CycleNumber() * this->EndgameSettings().num_sample_points+1 << " but is of size " << cau_samples.size() << '\n';
+			err_msg << "to compute cauchy approximation, cauchy_samples must be of size " << this->CycleNumber() * num_circle_points+1 << " but is of size " << cau_samples.size() << '\n';
 			throw std::runtime_error(err_msg.str());
 		}
 
+		++this->stats_.num_approximations;
 		result = Vec<CT>::Zero(this->GetSystem().NumVariables());//= (cau_samples[0]+cau_samples.back())/2; 
+		Vec<CT> correction = Vec<CT>::Zero(this->GetSystem().NumVariables());
 
 		if (TrackerTraits<TrackerType>::IsAdaptivePrec)
 		{
@@ -952,14 +1225,35 @@ public:
 			auto new_precision = AsDerived().EnsureAtUniformPrecision(cau_times, cau_samples);
 		}
 
-		for(unsigned int ii = 0; ii < this->CycleNumber() * this->EndgameSettings().num_sample_points; ++ii)
+		for(unsigned int ii = 0; ii < this->CycleNumber() * num_circle_points; ++ii)
 		{
 			auto refine_code = AsDerived().RefineSample(cau_samples[ii],cau_samples[ii],cau_times[ii]);
 			if (refine_code!=SuccessCode::Success)
 				return refine_code;
 			result += cau_samples[ii];
+
+			if (cauchy_settings_.hermite_quadrature)
+			{
+				Vec<CT> dx_dt = this->GetSystem().Jacobian(cau_samples[ii],cau_times[ii]).partialPivLu().solve(-this->GetSystem().TimeDerivative(cau_samples[ii],cau_times[ii]));
+				correction += cau_times[ii]*dx_dt;
+			}
+		}
+		result /= static_cast<RT>(this->CycleNumber() * num_circle_points);
+
+		if (cauchy_settings_.hermite_quadrature)
+		{
+			using std::max;
+			correction /= static_cast<RT>(this->CycleNumber() * num_circle_points * num_circle_points);
+			result -= correction;
+
+			const RT norm_correction = correction.norm();
+			const RT tolerance(this->Tolerances().final_tolerance);
+			const unsigned fewest = max(3u, cauchy_settings_.min_num_circle_points);
+			if (norm_correction < tolerance && num_circle_points > fewest)
+				num_circle_points_ = num_circle_points-1;
+			else if (norm_correction*norm_correction > tolerance*max(RT(1),RT(result.norm())) && num_circle_points < this->EndgameSettings().num_sample_points)
+				num_circle_points_ = num_circle_points+1;
 		}
-		result /= static_cast<RT>(this->CycleNumber() * this->EndgameSettings().num_sample_points);
 		return SuccessCode::Success;
 
 	}
@@ -990,6 +1284,11 @@ public:
 		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
+		// keep the closed loop, to predict the arcs of this one
+		std::swap(cau_times, std::get<TimeCont<CT> >(previous_cauchy_times_));
+		std::swap(cau_samples, std::get<SampCont<CT> >(previous_cauchy_samples_));
+		previous_cycle_number_ = this->CycleNumber();
+
 		cau_times.clear();
 		cau_samples.clear();
 		cau_times.push_back(starting_time);
@@ -1051,28 +1350,88 @@ public:
 
 		assert(Precision(start_time)==Precision(start_time) && ("CauchyEG Run time and point must be of matching precision"));
 
-		using RT = typename Eigen::NumTraits<CT>::Real;
+		ClearTimesAndSamples<CT>(); //clear times and samples before we begin.
+		this->ResetPathState();
+
+		CT origin(0,0); // this should really be input, not set hardcoded.
+
+		Vec<CT> prev_approx;
+
+		// the cycle number of a hint is not used, since the loops must be tracked around anyway to find it.
+		CT warm_start_time = start_time;
+		Vec<CT> warm_start_point = start_point;
+		this->WarmStart(warm_start_time, warm_start_point);
+
+		//Compute the first approximation using the power series approximation technique. 
+		auto initial_ps_success = InitialPowerSeriesApproximation(warm_start_time, warm_start_point, origin, prev_approx);  // last argument is output here
+		if(initial_ps_success != SuccessCode::Success)
+			return initial_ps_success;
+
+		return ApproximateUntilConverged(prev_approx);
+	} //end main CauchyEG function
+
+
+	/**
+	\brief Run the Cauchy endgame from samples already collected on the path, toward the origin at the sample factor, such as by a power series endgame which is being switched from.
+
+	The newest num_sample_points of them are used as the initial samples, so none are tracked to again.  Otherwise as Run.
+
+	\param times The times of the samples, oldest first.
+	\param samples The samples on the path at those times.
+
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	SuccessCode RunFromSamples(TimeCont<CT> const& times, SampCont<CT> const& samples)
+	{
+		const auto num_sample_points = this->EndgameSettings().num_sample_points;
+		if (samples.size()!=times.size() || samples.size() < num_sample_points)
+		{
+			std::stringstream err_msg;
+			err_msg << "CauchyEG needs " << num_sample_points << " samples with times to run from, got " << samples.size() << " samples and " << times.size() << " times";
+			throw std::runtime_error(err_msg.str());
+		}
+
+		ClearTimesAndSamples<CT>();
+		this->ResetPathState();
 
-		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
-		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
 		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
 		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
+		for (auto ii = samples.size()-num_sample_points; ii < samples.size(); ++ii)
+		{
+			ps_times.push_back(times[ii]);
+			ps_samples.push_back(samples[ii]);
+		}
 
+		CT origin(0,0);
+		Vec<CT> prev_approx;
+		auto initial_ps_success = InitialPowerSeriesApproximationFromSamples(origin, prev_approx);
+		if(initial_ps_success != SuccessCode::Success)
+			return initial_ps_success;
 
-		ClearTimesAndSamples<CT>(); //clear times and samples before we begin.
-		this->CycleNumber(0);
+		return ApproximateUntilConverged(prev_approx);
+	}
 
-		CT origin(0,0); // this should really be input, not set hardcoded.
 
-		Vec<CT> prev_approx, latest_approx;
+	/**
+	\brief The main loop of the Cauchy endgame, from the first approximation of the origin on: loop around the origin, approximate with the Cauchy integral formula, and move toward the origin, until two approximations agree to the final tolerance.
+
+	\param prev_approx The first approximation, from InitialPowerSeriesApproximation.
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	SuccessCode ApproximateUntilConverged(Vec<CT> prev_approx)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+
+		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
+		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
+		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
+
+		Vec<CT> latest_approx;
 		RT approximate_error;
 		Vec<CT>& final_approx = std::get<Vec<CT> >(this->final_approximation_at_origin_);
-	
-
-		//Compute the first approximation using the power series approximation technique. 
-		auto initial_ps_success = InitialPowerSeriesApproximation(start_time, start_point, origin, prev_approx);  // last argument is output here
-		if(initial_ps_success != SuccessCode::Success)
-			return initial_ps_success;
 
 		CT next_time = ps_times.back();
 		RT norm_of_dehom_of_prev_approx, norm_of_dehom_of_latest_approx;
@@ -1096,9 +1455,10 @@ public:
 			// dehom of prev approx and last approx not used because they are not updated with the most current information. However, prev approx and last approx are 
 			// the most current. 
 
-			if (approximate_error < this->Tolerances().final_tolerance)
+			if (approximate_error < this->Tolerances().final_tolerance || this->CertifiedConverged(latest_approx) || this->DeflatedConverged(latest_approx, static_cast<double>(approximate_error)))
 			{
 				final_approx = latest_approx;
+				this->converged_time_ = static_cast<double>(abs(ps_times.front()));
 				return SuccessCode::Success;
 			}
 			else if (abs(cau_times.front()) < this->EndgameSettings().min_track_time)
@@ -1114,6 +1474,13 @@ public:
 				return SuccessCode::SecurityMaxNormReached;
 			}
 
+			auto early_abort_code = this->CheckEarlyAbort(cau_times.front(), latest_approx, approximate_error);
+			if (early_abort_code != SuccessCode::Success)
+			{
+				final_approx = latest_approx;
+				return early_abort_code;
+			}
+
 
 			prev_approx = latest_approx;
 			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
@@ -1125,6 +1492,7 @@ public:
 				return tracking_success;
 
 			AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
+			this->CountSample(next_sample);
 
 			ps_times.push_back(next_time);  ps_times.pop_front();
 			ps_samples.push_back(next_sample); ps_samples.pop_front();
@@ -1150,8 +1518,9 @@ public:
 		} while (approximate_error > this->Tolerances().final_tolerance);
 
 		final_approx = latest_approx;
+		this->converged_time_ = static_cast<double>(abs(ps_times.front()));
 		return SuccessCode::Success;
-	} //end main CauchyEG function
+	} //end ApproximateUntilConverged
 };
 
 
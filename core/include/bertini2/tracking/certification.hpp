@@ -0,0 +1,296 @@
+//This file is part of Bertini 2.
+//
+//certification.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//certification.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with certification.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file certification.hpp
+
+\brief Contains Krawczyk, which certifies that a point approximates a nonsingular root of a system, and CertifyPoints, which does so for many points over several threads.
+*/
+
+#ifndef BERTINI_TRACKING_CERTIFICATION_HPP
+#define BERTINI_TRACKING_CERTIFICATION_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/ball_arithmetic.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <Eigen/LU>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The outcome of certifying a point.
+		*/
+		struct Certificate
+		{
+			bool certified = false; ///< Whether the box of radius radius about the point provably contains exactly one root, which is nonsingular.
+			double radius = std::numeric_limits<double>::infinity(); ///< The distance in each coordinate within which the root lies.  Infinite if not certified.
+		};
+
+
+		/**
+		\brief Certify that a point approximates a nonsingular root, by the Krawczyk test, given ball evaluations of a square system and its Jacobian.
+
+		With Y the inverse of the Jacobian at the point \f$\tilde x\f$, and X the box of radius \f$\rho\f$ about it, the Krawczyk operator
+		\f[ K(X) = \tilde x - Y f(\tilde x) + (I - Y J(X))(X - \tilde x) \f]
+		contains every root in X.  If it is in the interior of X, X contains exactly one root, and J is nonsingular on X, see Rump, Verification methods, Acta Numerica 19, 2010.  The root is then within the radius of K(X) of the point.  Here \f$f(\tilde x)\f$ and \f$J(X)\f$ are enclosed in ball arithmetic, and the products with Y are bounded with their rounding errors.
+
+		The first box tried is settings.inflation times the length of the Newton step, and each failed box whose Jacobian varies little enough suggests the least radius which could succeed, of which settings.inflation times is tried next.
+
+		\param x The point.
+		\param eval Given a vector of balls, returns the balls of the values of the functions, as System::EvalBall.
+		\param jacobian Given a vector of balls, returns the balls of the Jacobian, as System::JacobianBall.
+		\param settings The inflation of the boxes, and how many to try.
+		*/
+		template<typename T, typename EvalF, typename JacobianF>
+		Certificate Krawczyk(Vec<T> const& x, EvalF const& eval, JacobianF const& jacobian, config::Certification const& settings = config::Certification())
+		{
+			using bertini::detail::ball::ToDouble;
+			using bertini::detail::ball::Up;
+
+			Certificate certificate;
+			const auto n = x.size();
+			if (n==0)
+				return certificate;
+
+			// rounding of sums of n products, in the precision of the point, and in double
+			const double gamma = Up((n+2)*bertini::detail::ball::UnitRoundoff(x(0)));
+			const double slack = 1 + 2*(n+2)*std::numeric_limits<double>::epsilon();
+			auto magnitude = [](T const& z){ return Up(std::abs(ToDouble(z))); };
+
+			Vec<Ball<T> > X(n);
+			for (int ii = 0; ii < n; ++ii)
+				X(ii) = Ball<T>(x(ii));
+
+			Vec<Ball<T> > f = eval(X);
+			Mat<Ball<T> > J = jacobian(X);
+
+			Mat<T> J_mid(n,n);
+			for (int ii = 0; ii < n; ++ii)
+				for (int jj = 0; jj < n; ++jj)
+					J_mid(ii,jj) = J(ii,jj).Mid();
+
+			Mat<T> Y = Eigen::PartialPivLU<Mat<T> >(J_mid).inverse();
+			Eigen::MatrixXd abs_Y(n,n);
+			for (int ii = 0; ii < n; ++ii)
+				for (int jj = 0; jj < n; ++jj)
+					abs_Y(ii,jj) = magnitude(Y(ii,jj));
+			if (!abs_Y.allFinite())
+				return certificate;
+
+			Vec<T> f_mid(n);
+			Eigen::VectorXd f_rad(n), abs_f(n);
+			for (int ii = 0; ii < n; ++ii)
+			{
+				if (!f(ii).IsFinite())
+					return certificate;
+				f_mid(ii) = f(ii).Mid();
+				f_rad(ii) = f(ii).Rad();
+				abs_f(ii) = magnitude(f_mid(ii));
+			}
+
+			// the balls of the Newton step, Y f(x), have radii d
+			Vec<T> step = Y*f_mid;
+			Eigen::VectorXd d = ((abs_Y*f_rad + gamma*(abs_Y*abs_f))*slack);
+			double max_x = 0;
+			for (int ii = 0; ii < n; ++ii)
+			{
+				d(ii) = Up(d(ii) + magnitude(step(ii)));
+				max_x = std::max(max_x, magnitude(x(ii)));
+			}
+
+			double rho = std::max(settings.inflation*d.maxCoeff(), Up(4*gamma*(1 + max_x)));
+
+			for (unsigned attempt = 0; attempt < settings.max_attempts && std::isfinite(rho); ++attempt)
+			{
+				for (int ii = 0; ii < n; ++ii)
+					X(ii) = Ball<T>(x(ii), rho);
+				J = jacobian(X);
+
+				Eigen::MatrixXd J_rad(n,n), abs_J(n,n);
+				for (int ii = 0; ii < n; ++ii)
+					for (int jj = 0; jj < n; ++jj)
+					{
+						if (!J(ii,jj).IsFinite())
+							return certificate;
+						J_mid(ii,jj) = J(ii,jj).Mid();
+						J_rad(ii,jj) = J(ii,jj).Rad();
+						abs_J(ii,jj) = magnitude(J_mid(ii,jj));
+					}
+
+				// the rows of |I - Y J(X)|, the contraction of K on X
+				Mat<T> M = Mat<T>::Identity(n,n) - Y*J_mid;
+				Eigen::MatrixXd R = (abs_Y*J_rad + gamma*(abs_Y*abs_J) + gamma*Eigen::MatrixXd::Identity(n,n))*slack;
+				Eigen::VectorXd q(n);
+				for (int ii = 0; ii < n; ++ii)
+				{
+					double row = 0;
+					for (int jj = 0; jj < n; ++jj)
+						row += magnitude(M(ii,jj)) + R(ii,jj);
+					q(ii) = Up(row*slack);
+				}
+
+				Eigen::VectorXd k(n);
+				for (int ii = 0; ii < n; ++ii)
+					k(ii) = Up(d(ii) + Up(q(ii)*rho));
+
+				if (k.maxCoeff() < rho)
+				{
+					certificate.certified = true;
+					certificate.radius = k.maxCoeff();
+					return certificate;
+				}
+
+				if (q.maxCoeff() >= 1)
+					return certificate;
+
+				double needed = 0;
+				for (int ii = 0; ii < n; ++ii)
+					needed = std::max(needed, d(ii) / (1 - q(ii)));
+				rho = std::max(settings.inflation*needed, Up(rho*settings.inflation));
+			}
+
+			return certificate;
+		}
+
+
+		/**
+		\brief Certify that a point approximates a nonsingular root of a square system without a path variable, by the Krawczyk test.
+
+		\code
+		auto c = Krawczyk(sys, x);
+		if (c.certified)
+			std::cout << "a root is within " << c.radius << " of x in each coordinate\n";
+		\endcode
+
+		\throws std::runtime_error, if the system is not square, or the point is not of the number of its variables.
+		*/
+		template<typename T>
+		Certificate Krawczyk(System const& sys, Vec<T> const& x, config::Certification const& settings = config::Certification())
+		{
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("certifying a root needs a square system");
+
+			return Krawczyk(x,
+			                [&sys](Vec<Ball<T> > const& X){ return sys.EvalBall(X);},
+			                [&sys](Vec<Ball<T> > const& X){ return sys.JacobianBall(X);},
+			                settings);
+		}
+
+		/**
+		\brief Certify that a point approximates a nonsingular root of a square system at a value of its path variable, by the Krawczyk test.
+
+		\throws std::runtime_error, if the system is not square, or the point is not of the number of its variables.
+		*/
+		template<typename T>
+		Certificate Krawczyk(System const& sys, Vec<T> const& x, T const& path_variable_value, config::Certification const& settings = config::Certification())
+		{
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("certifying a root needs a square system");
+
+			return Krawczyk(x,
+			                [&](Vec<Ball<T> > const& X){ return sys.EvalBall(X, path_variable_value);},
+			                [&](Vec<Ball<T> > const& X){ return sys.JacobianBall(X, path_variable_value);},
+			                settings);
+		}
+
+
+		// bring a system to the precision of a point
+		inline void AdjustPrecision(System & sys, dbl const&)
+		{}
+
+		inline void AdjustPrecision(System & sys, mpfr const& z)
+		{
+			if (sys.precision()!=Precision(z))
+				sys.precision(Precision(z));
+		}
+
+
+		/**
+		\brief Certify many points, such as the endpoints of a solve, as approximate roots of a square system without a path variable, over several threads.
+
+		Each thread certifies every num_threads'th point, with its own copy of the system, made on the calling thread, at the default precision of the calling thread.  Multiple precision points are certified at their own precision.
+
+		\code
+		std::vector<Vec<dbl>> endpoints;
+		for (auto const& r : solver.Results())
+			endpoints.push_back(r.success==SuccessCode::Success ? r.solution : Vec<dbl>());
+		auto certificates = CertifyPoints(target, endpoints, config::Certification(), solver.NumThreads());
+		\endcode
+
+		\param sys The system.  Square, without a path variable.
+		\param points The points, in the order of the variables of the system.  Empty ones, such as those of failed paths, are not certified.
+		\param settings The inflation of the boxes, and how many to try.
+		\param num_threads The number of threads to use, including the calling thread.
+		\return The certificate of each point.
+		*/
+		template<typename T>
+		std::vector<Certificate> CertifyPoints(System const& sys, std::vector<Vec<T> > const& points, config::Certification const& settings = config::Certification(), unsigned num_threads = 1)
+		{
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("certifying a root needs a square system");
+
+			num_threads = std::max(1u, std::min<unsigned>(num_threads, points.size()));
+			const auto precision = DefaultPrecision();
+
+			std::vector<System> systems;
+			for (unsigned t = 0; t < num_threads; ++t)
+				systems.push_back(Clone(sys));
+
+			std::vector<Certificate> certificates(points.size());
+			auto certify = [&](unsigned t)
+				{
+					DefaultPrecision(precision);
+					for (size_t ii = t; ii < points.size(); ii += num_threads)
+					{
+						if (points[ii].size()!=sys.NumVariables())
+							continue;
+						AdjustPrecision(systems[t], points[ii](0));
+						certificates[ii] = Krawczyk(systems[t], points[ii], settings);
+					}
+				};
+
+			std::vector<std::thread> threads;
+			for (unsigned t = 1; t < num_threads; ++t)
+				threads.emplace_back(certify, t);
+			certify(0);
+			for (auto& th : threads)
+				th.join();
+
+			return certificates;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,255 @@
+//This file is part of Bertini 2.
+//
+//deflation.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//deflation.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with deflation.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file deflation.hpp
+
+\brief Contains Deflate, which refines an approximation of a singular root by Newton's method on a deflated system, regular at the root.
+*/
+
+#ifndef BERTINI_TRACKING_DEFLATION_HPP
+#define BERTINI_TRACKING_DEFLATION_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <Eigen/SVD>
+
+#include <functional>
+#include <limits>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The outcome of refining a point by deflation.
+		*/
+		template<typename T>
+		struct DeflationResult
+		{
+			bool converged = false; ///< Whether Newton's method on the regular deflated system took a step shorter than the tolerance.
+			Vec<T> point; ///< The refined point, in the variables of the original system.  The starting point if not converged.
+			unsigned num_deflations = 0; ///< The times the system was deflated before it was regular at the point.
+			unsigned num_iterations = 0; ///< The Newton iterations on the deflated system.
+			double last_step = std::numeric_limits<double>::infinity(); ///< The length of the last Newton step, in the variables of the original system.
+		};
+
+
+		/**
+		\brief The derivative of a Jacobian along a direction, \f$\frac{d}{ds} J(x + s w)\f$ at s=0, by the trapezoid rule for Cauchy's integral on a circle of 8 points about x.
+
+		The error is of the order of the radius to the 8th power, so the derivative is exact up to rounding for systems of degree at most 9, and the rounding error is that of the Jacobian over the radius.  With symmetric second derivatives, column k of the result is the derivative of \f$J(x)w\f$ by \f$x_k\f$.
+
+		\param jacobian Given a point, its Jacobian.
+		\param x The point.
+		\param w The direction.
+		\param radius The radius of the circle, relative to the larger of 1 and the norm of x.
+		*/
+		template<typename T, typename JacobianF>
+		Mat<T> DerivativeAlong(JacobianF const& jacobian, Vec<T> const& x, Vec<T> const& w, double radius)
+		{
+			using RT = typename Eigen::NumTraits<T>::Real;
+			using std::sqrt;
+
+			const RT w_norm = w.norm();
+			if (w_norm==0)
+			{
+				Mat<T> J = jacobian(x);
+				J.setZero();
+				return J;
+			}
+
+			const unsigned num_points = 8;
+			const RT r = RT(radius) * std::max(RT(1), RT(x.norm()));
+			const Vec<T> u = w / w_norm;
+			const RT half_root_2 = sqrt(RT(2))/2;
+			const T omega(half_root_2, half_root_2);
+
+			Mat<T> D;
+			T root(1);
+			for (unsigned k = 0; k < num_points; ++k)
+			{
+				Mat<T> J = jacobian(Vec<T>(x + (r*root) * u));
+				if (k==0)
+					D = J;
+				else
+					D += J / root;
+				root *= omega;
+			}
+			return D * T(w_norm / (num_points * r));
+		}
+
+
+		/**
+		\brief Refine an approximation of a root, singular or not, by Newton's method on a deflated system, given evaluations of a system and its Jacobian.
+
+		While the Jacobian at the point has rank r less than the number of variables n, deflating, as in Leykin, Verschelde, and Zhao, Newton's method with deflation for isolated singularities of polynomial systems, Theor. Comp. Sci. 359, 2006, adds r+1 variables \f$\lambda\f$, and the equations
+		\f[ J(x) B \lambda = 0, \quad h^T \lambda = 1, \f]
+		with B and h random, which have a solution at the root only in the null space of the Jacobian.  An isolated root of multiplicity \f$\mu\f$ is regular after fewer than \f$\mu\f$ deflations, where Newton's method, in the least squares sense, converges quadratically, so a singular endpoint needs no more tracking toward it once its approximation is near enough.
+
+		The Jacobian of the new equations needs the second derivatives of the system, see DerivativeAlong.  Since each deflation differentiates the Jacobian of the one before, each costs 8 times the evaluations of the one before.
+
+		\param x The approximation.
+		\param eval Given a point, the values of the functions, as System::Eval.
+		\param jacobian Given a point, the Jacobian, as System::Jacobian.
+		\param tolerance The length of Newton step, in the variables of x, at which the refinement has converged.
+		\param settings The rank tolerance, and the most deflations and iterations.
+		*/
+		template<typename T, typename EvalF, typename JacobianF>
+		DeflationResult<T> Deflate(Vec<T> const& x, EvalF const& eval, JacobianF const& jacobian, double tolerance, config::Deflation const& settings = config::Deflation())
+		{
+			using Evaluator = std::function<void(Vec<T> const&, Vec<T>&, Mat<T>&)>;
+
+			DeflationResult<T> result;
+			result.point = x;
+			const auto n = x.size();
+
+			Evaluator evaluate = [&eval, &jacobian](Vec<T> const& z, Vec<T> & f, Mat<T> & J)
+				{
+					f = eval(z);
+					J = jacobian(z);
+				};
+
+			Vec<T> z = x;
+			Vec<T> f;
+			Mat<T> J;
+			for (;;)
+			{
+				evaluate(z, f, J);
+				auto singular_values = Eigen::JacobiSVD< Mat<T> >(J).singularValues();
+				const double largest = singular_values.size() ? static_cast<double>(singular_values(0)) : 0;
+				Eigen::Index rank = 0;
+				while (rank < singular_values.size() && static_cast<double>(singular_values(rank)) > settings.rank_tolerance * std::max(largest, 1.0))
+					++rank;
+
+				if (rank==J.cols())
+					break;
+				if (result.num_deflations==settings.max_deflations)
+					return result;
+
+				// deflate, in the variables and equations of the system so far
+				const auto m = J.rows(), num_vars = J.cols();
+				Mat<T> B = RandomOfUnits<T>(num_vars, rank+1);
+				Vec<T> h = RandomOfUnits<T>(rank+1);
+
+				Mat<T> A(m+1, rank+1);
+				A << J*B, h.transpose();
+				Vec<T> rhs = Vec<T>::Zero(m+1);
+				rhs(m) = T(1);
+				Vec<T> lambda = Eigen::JacobiSVD< Mat<T> >(A, Eigen::ComputeThinU | Eigen::ComputeThinV).solve(rhs);
+
+				Evaluator previous = evaluate;
+				const double radius = settings.contour_radius;
+				evaluate = [previous, B, h, num_vars, radius](Vec<T> const& zz, Vec<T> & g, Mat<T> & JG)
+					{
+						const Vec<T> y = zz.head(num_vars);
+						const Vec<T> l = zz.tail(h.size());
+						const Vec<T> w = B*l;
+
+						Vec<T> fy;
+						Mat<T> Jy;
+						previous(y, fy, Jy);
+						const auto rows = fy.size();
+
+						g.resize(2*rows+1);
+						g << fy, Jy*w, Vec<T>::Constant(1, h.cwiseProduct(l).sum() - T(1));
+
+						auto jacobian_of_previous = [&previous](Vec<T> const& p){ Vec<T> fp; Mat<T> Jp; previous(p, fp, Jp); return Jp;};
+						JG = Mat<T>::Zero(2*rows+1, num_vars+h.size());
+						JG.block(0, 0, rows, num_vars) = Jy;
+						JG.block(rows, 0, rows, num_vars) = DerivativeAlong(jacobian_of_previous, y, w, radius);
+						JG.block(rows, num_vars, rows, h.size()) = Jy*B;
+						JG.block(2*rows, num_vars, 1, h.size()) = h.transpose();
+					};
+
+				Vec<T> extended(z.size() + lambda.size());
+				extended << z, lambda;
+				z = extended;
+				++result.num_deflations;
+			}
+
+			// Newton's method on the regular system, in the least squares sense if overdetermined
+			double previous_step = std::numeric_limits<double>::infinity();
+			for (unsigned ii = 0; ii < settings.max_newton_iterations; ++ii)
+			{
+				if (ii > 0)
+					evaluate(z, f, J);
+				Vec<T> delta = Eigen::JacobiSVD< Mat<T> >(J, Eigen::ComputeThinU | Eigen::ComputeThinV).solve(Vec<T>(-f));
+				z += delta;
+				++result.num_iterations;
+
+				result.last_step = static_cast<double>(delta.head(n).norm());
+				if (result.last_step < tolerance)
+				{
+					result.converged = true;
+					result.point = z.head(n);
+					return result;
+				}
+				if (ii > 1 && result.last_step > previous_step)
+					return result; // diverging, or stalled at the rounding error
+				previous_step = result.last_step;
+			}
+			return result;
+		}
+
+
+		/**
+		\brief Refine an approximation of a root of a system without a path variable, by Newton's method on a deflated system.
+
+		\code
+		auto refined = Deflate(sys, approximation, 1e-11);
+		if (refined.converged)
+			std::cout << "refined after " << refined.num_deflations << " deflations\n";
+		\endcode
+		*/
+		template<typename T>
+		DeflationResult<T> Deflate(System const& sys, Vec<T> const& x, double tolerance, config::Deflation const& settings = config::Deflation())
+		{
+			return Deflate(x,
+			               [&sys](Vec<T> const& z){ return sys.Eval(z);},
+			               [&sys](Vec<T> const& z){ return sys.Jacobian(z);},
+			               tolerance, settings);
+		}
+
+		/**
+		\brief Refine an approximation of a root of a system at a value of its path variable, such as the target system of a homotopy at 0, by Newton's method on a deflated system.
+
+		The endgames refine their approximations this way, see config::Endgame::deflate_endpoints.
+		*/
+		template<typename T>
+		DeflationResult<T> Deflate(System const& sys, Vec<T> const& x, T const& path_variable_value, double tolerance, config::Deflation const& settings = config::Deflation())
+		{
+			return Deflate(x,
+			               [&](Vec<T> const& z){ return sys.Eval(z, path_variable_value);},
+			               [&](Vec<T> const& z){ return sys.Jacobian(z, path_variable_value);},
+			               tolerance, settings);
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,296 @@
+//This file is part of Bertini 2.
+//
+//distributed_solver.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//distributed_solver.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with distributed_solver.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file distributed_solver.hpp
+
+\brief Contains the DistributedSolver type, for tracking all the paths of a homotopy over several MPI processes.
+
+Only available if Bertini2 was configured with --enable-mpi.
+*/
+
+#ifndef BERTINI_TRACKING_DISTRIBUTED_SOLVER_HPP
+#define BERTINI_TRACKING_DISTRIBUTED_SOLVER_HPP
+
+#include "bertini2/config.h"
+
+#if BERTINI_ENABLE_MPI
+
+#include "bertini2/tracking/parallel_solver.hpp"
+
+#include <boost/mpi.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <sstream>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Tracks every path of a homotopy over the processes of an MPI communicator, gathering the solutions on rank 0.
+
+		Rank 0 broadcasts the target and start systems, serialized, and then hands out ranges of start point indices to the other ranks as they ask for work.  Each of those ranks tracks its range with a ParallelSolver, over its own threads, and sends the results back to rank 0, which gives it another range until all are done.  Since ranges are handed out on demand, ranks which draw cheap paths simply do more ranges.
+
+		Rank 0 only coordinates, unless it is the only rank, in which case it tracks all the paths itself.
+
+		\code
+		boost::mpi::environment env(argc, argv);
+		boost::mpi::communicator world;
+
+		DistributedSolver<AMPTracker> solver(world, setup);
+		solver.Solve(sys, TD); // on every rank.  sys and TD are only read on rank 0.
+
+		if (world.rank()==0)
+			for (auto const& r : solver.Results())
+				...
+		\endcode
+
+		If tracking throws on any rank, the run cannot be recovered, and the communicator should be aborted.
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam StartSystemType The type of the start system.  Must be serializable.
+		\tparam EndgameType The type of endgame to use.  Defaults to the power series endgame for the tracker type.
+		*/
+		template<class TrackerType, class StartSystemType = start_system::TotalDegree, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class DistributedSolver
+		{
+		public:
+
+			using LocalSolver = ParallelSolver<TrackerType, EndgameType>;
+			using PathResult = typename LocalSolver::PathResult;
+			using TrackerSetup = typename LocalSolver::TrackerSetup;
+			using ResultHandler = std::function<void(PathResult const&)>;
+			using SolverSetup = std::function<void(LocalSolver &)>;
+
+			/**
+			\param world The communicator over whose processes the paths are tracked.
+			\param tracker_setup Called on each thread's tracker on each rank, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use on each rank.  Defaults to the number of hardware threads.
+			\param chunk_size The number of paths handed out at a time.  Larger ranges mean fewer messages, smaller ones better balance.
+			*/
+			DistributedSolver(boost::mpi::communicator const& world, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency(), size_t chunk_size = 256) :
+				world_(world),
+				tracker_setup_(tracker_setup),
+				num_threads_(num_threads),
+				chunk_size_(std::max(chunk_size, size_t(1)))
+			{}
+
+
+			/**
+			\brief Set a function to be called on rank 0 with each result as it arrives, for instance to write it out.
+			*/
+			void SetResultHandler(ResultHandler handler)
+			{
+				result_handler_ = handler;
+			}
+
+			/**
+			\brief Set a function to be called on the ParallelSolver of each rank which tracks paths, before it tracks any, for instance to set its endgame factory, endgame boundary, or sharpening.
+			*/
+			void SetSolverSetup(SolverSetup setup)
+			{
+				solver_setup_ = setup;
+			}
+
+
+			/**
+			\brief Track all the paths.  Collective: must be called on every rank of the communicator.
+
+			\param target The system to solve.  Only read on rank 0.
+			\param start The start system.  Only read on rank 0.
+			*/
+			void Solve(System const& target, StartSystemType const& start)
+			{
+				unsigned precision = DefaultPrecision();
+				boost::mpi::broadcast(world_, precision, 0);
+				DefaultPrecision(precision);
+
+				std::string serialized;
+				if (world_.rank()==0)
+					serialized = ToString(std::make_pair(target, start));
+				boost::mpi::broadcast(world_, serialized, 0);
+
+				results_.clear();
+
+				if (world_.size()==1)
+					SolveAlone(target, start);
+				else if (world_.rank()==0)
+					Coordinate(start.NumStartPoints().template convert_to<size_t>());
+				else
+				{
+					auto systems = FromString<std::pair<System, StartSystemType> >(serialized);
+					Work(systems.first, systems.second);
+				}
+			}
+
+
+			/**
+			\brief On rank 0, the results of all the paths, in order of start point.  Empty on other ranks.
+			*/
+			std::vector<PathResult> const& Results() const
+			{
+				return results_;
+			}
+
+		private:
+
+			enum Tag
+			{
+				WorkTag = 1, ///< A range of paths to track, from rank 0.
+				ResultsTag = 2, ///< The results of a range, to rank 0.
+				StopTag = 3 ///< No more work, from rank 0.
+			};
+
+
+			template<typename T>
+			static std::string ToString(T const& t)
+			{
+				std::stringstream ss;
+				{
+					boost::archive::text_oarchive oa(ss);
+					oa << t;
+				}
+				return ss.str();
+			}
+
+			template<typename T>
+			static T FromString(std::string const& s)
+			{
+				std::stringstream ss(s);
+				boost::archive::text_iarchive ia(ss);
+				T t;
+				ia >> t;
+				return t;
+			}
+
+
+			void Store(PathResult const& r)
+			{
+				if (result_handler_)
+					result_handler_(r);
+				results_[r.path] = r;
+			}
+
+
+			void SolveAlone(System const& target, StartSystemType const& start)
+			{
+				LocalSolver solver(target, start, tracker_setup_, num_threads_);
+				if (solver_setup_)
+					solver_setup_(solver);
+				solver.Solve();
+
+				results_.resize(solver.Results().size());
+				for (auto const& r : solver.Results())
+					Store(r);
+			}
+
+
+			// rank 0.  hands out ranges until none are left, then stops each rank as it reports back.
+			void Coordinate(size_t num_paths)
+			{
+				results_.resize(num_paths);
+
+				size_t next = 0;
+				auto send_work = [&](int rank)
+				{
+					std::vector<size_t> range{next, std::min(next+chunk_size_, num_paths)};
+					next = range[1];
+					world_.send(rank, WorkTag, range);
+				};
+
+				int num_active = 0;
+				for (int rank = 1; rank < world_.size(); ++rank)
+				{
+					if (next < num_paths)
+					{
+						send_work(rank);
+						++num_active;
+					}
+					else
+						world_.send(rank, StopTag);
+				}
+
+				while (num_active > 0)
+				{
+					std::string payload;
+					auto status = world_.recv(boost::mpi::any_source, ResultsTag, payload);
+					for (auto const& r : FromString<std::vector<PathResult> >(payload))
+						Store(r);
+
+					if (next < num_paths)
+						send_work(status.source());
+					else
+					{
+						world_.send(status.source(), StopTag);
+						--num_active;
+					}
+				}
+			}
+
+
+			// ranks other than 0.  tracks ranges until told to stop.
+			void Work(System const& target, StartSystemType const& start)
+			{
+				LocalSolver solver(target, start, tracker_setup_, num_threads_);
+				if (solver_setup_)
+					solver_setup_(solver);
+
+				while (true)
+				{
+					auto status = world_.probe(0, boost::mpi::any_tag);
+					if (status.tag()==StopTag)
+					{
+						world_.recv(0, StopTag);
+						return;
+					}
+
+					std::vector<size_t> range;
+					world_.recv(0, WorkTag, range);
+
+					solver.Solve(range[0], range[1]);
+					world_.send(0, ResultsTag, ToString(solver.Results()));
+				}
+			}
+
+
+			boost::mpi::communicator world_;
+			TrackerSetup tracker_setup_;
+			unsigned num_threads_;
+			size_t chunk_size_;
+
+			ResultHandler result_handler_;
+			SolverSetup solver_setup_;
+			std::vector<PathResult> results_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif // BERTINI_ENABLE_MPI
+
+#endif
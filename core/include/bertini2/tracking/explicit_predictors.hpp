@@ -34,11 +34,16 @@
 
 #include "bertini2/tracking/amp_criteria.hpp"
 #include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/tracking/jacobian_cache.hpp"
+#include "bertini2/tracking/time_breakdown.hpp"
 
 #include "bertini2/system.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include <Eigen/LU>
 
+#include <limits>
+#include <map>
+
 #include <boost/type_index.hpp>
 
 
@@ -93,6 +98,8 @@ namespace bertini{
 						return 5;
 					case (Predictor::RKVerner67):
 						return 6;
+					case (Predictor::Pade):
+						return 3;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in Order");
@@ -100,6 +107,43 @@ namespace bertini{
 				}
 			}
 			
+			/**
+			\brief The number of Jacobian evaluations and factorizations of a step following an accepted one.
+
+			This is the number of stages, less the first one for the methods with a stage at the end of the step, which is taken from the step before.  \see ExplicitRKPredictor::NumReusedEndpointStages
+
+			 \return The evaluations of a step.
+			 \param predictor_choice The predictor method to query.
+			 */
+			inline
+			unsigned EvaluationsPerStep(Predictor predictor_choice)
+			{
+				switch (predictor_choice)
+				{
+					case (Predictor::Euler):
+						return 1;
+					case (Predictor::HeunEuler):
+						return 1;
+					case (Predictor::RK4):
+						return 3;
+					case (Predictor::RKF45):
+						return 5;
+					case (Predictor::RKCashKarp45):
+						return 5;
+					case (Predictor::RKDormandPrince56):
+						return 7;
+					case (Predictor::RKVerner67):
+						return 9;
+					case (Predictor::Pade):
+						return 1;
+					default:
+					{
+						throw std::runtime_error("incompatible predictor choice in EvaluationsPerStep");
+					}
+				}
+			}
+			
+			
 			/**
 			\brief Ask whether a predictor method provides an error estimate.
 
@@ -124,6 +168,8 @@ namespace bertini{
 						return true;
 					case (Predictor::RKVerner67):
 						return true;
+					case (Predictor::Pade):
+						return true;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in HasErrorEstimate");
@@ -219,94 +265,26 @@ namespace bertini{
 				 */
 				void PredictorMethod(Predictor method)
 				{
-					predictor_ = method;
-					p_ = predict::Order(method);
-					switch(method)
-					{
-						case Predictor::Euler:
-						{
-							s_ = 1;
-							Mat<double>& arefd = std::get< Mat<double> >(a_);
-							Vec<double>& brefd = std::get< Vec<double> >(b_);
-							Vec<double>& crefd = std::get< Vec<double> >(c_);
-							crefd.resize(s_); crefd(0) = static_cast<double>(cEuler_(0));
-							arefd.resize(s_,s_); arefd(0,0) = static_cast<double>(aEuler_(0,0));
-							brefd.resize(s_); brefd(0) = static_cast<double>(bEuler_(0));
-							Mat<mpfr_float>& arefmp = std::get< Mat<mpfr_float> >(a_);
-							Vec<mpfr_float>& brefmp = std::get< Vec<mpfr_float> >(b_);
-							Vec<mpfr_float>& crefmp = std::get< Vec<mpfr_float> >(c_);
-							crefmp.resize(s_); crefmp(0) = static_cast<mpfr_float>(cEuler_(0));
-							arefmp.resize(s_,s_); arefmp(0,0) = static_cast<mpfr_float>(aEuler_(0,0));
-							brefmp.resize(s_); brefmp(0) = static_cast<mpfr_float>(bEuler_(0));
-							uses_embedded_ = false;
-							break;
-						}
-						case Predictor::HeunEuler:
-						{
-							s_ = 2;
-							
-							FillButcherTable<double>(s_, aHeunEuler_, bHeunEuler_, b_minus_bstarHeunEuler_, cHeunEuler_);
-							FillButcherTable<mpfr_float>(s_, aHeunEuler_, bHeunEuler_, b_minus_bstarHeunEuler_, cHeunEuler_);
-							
-							break;
-						}
-						case Predictor::RK4:
-						{
-							s_ = 4;
-							
-							FillButcherTable<double>(s_, aRK4_, bRK4_, cRK4_);
-							FillButcherTable<mpfr_float>(s_, aRK4_, bRK4_, cRK4_);
-							
-							break;
-						}
-							
-						case Predictor::RKF45:
-						{
-							s_ = 6;
-							
-							FillButcherTable<double>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
-							FillButcherTable<mpfr_float>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
-							
-							break;
-						}
-							
-						case Predictor::RKCashKarp45:
-						{
-							s_ = 6;
-							
-							FillButcherTable<double>(s_, aRKCK45_, bRKCK45_, b_minus_bstarRKCK45_, cRKCK45_);
-							FillButcherTable<mpfr_float>(s_, aRKCK45_, bRKCK45_, b_minus_bstarRKCK45_, cRKCK45_);
-							
-							break;
-						}
-							
-						case Predictor::RKDormandPrince56:
-						{
-							s_ = 8;
-							
-							FillButcherTable<double>(s_, aRKDP56_, bRKDP56_, b_minus_bstarRKDP56_, cRKDP56_);
-							FillButcherTable<mpfr_float>(s_, aRKDP56_, bRKDP56_, b_minus_bstarRKDP56_, cRKDP56_);
-							
-							break;
-						}
-							
-						case Predictor::RKVerner67:
-						{
-							s_ = 10;
-							
-							FillButcherTable<double>(s_, aRKV67_, bRKV67_, b_minus_bstarRKV67_, cRKV67_);
-							FillButcherTable<mpfr_float>(s_, aRKV67_, bRKV67_, b_minus_bstarRKV67_, cRKV67_);
-							
-							break;
-						}
-							
-						default:
-						{
-							throw std::runtime_error("incompatible predictor choice in ExplicitPredict");
-						}
+					if (s_ > 0 && method==predictor_)
+					{ // same method again, as when a tracker is set up once more between paths.  keep the tables, and the tiers at their precisions
+						ForgetEndpointStage();
+						return;
 					}
-					ResizeK();
-				}; // re: PredictorMethod
+
+					precision_tiers_.clear(); // they hold the Butcher table of the old method
+					FillButcherTables(method);
+					ForgetEndpointStage();
+				}
+
+
+				/**
+				\brief Forget the endpoint stage of the most recent prediction, so the next prediction evaluates its first stage.  The tracker calls this at the start of each path.
+				*/
+				void ForgetEndpointStage()
+				{
+					std::get< EndpointStage<dbl> >(endpoint_stages_).valid = false;
+					std::get< EndpointStage<mpfr> >(endpoint_stages_).valid = false;
+				}
 				
 				
 				
@@ -321,6 +299,14 @@ namespace bertini{
 				{
 					numTotalFunctions_ = S.NumTotalFunctions();
 					numVariables_ = S.NumVariables();
+					precision_tiers_.clear();
+					ResizeWorkspaces();
+					ForgetEndpointStage();
+				}
+				
+				
+				void ResizeWorkspaces()
+				{
 					// you cannot set K_ here, because s_ may not have been set
 					std::get< Mat<dbl> >(dh_dx_0_).resize(numTotalFunctions_, numVariables_);
 					std::get< Mat<mpfr> >(dh_dx_0_).resize(numTotalFunctions_, numVariables_);
@@ -328,6 +314,12 @@ namespace bertini{
 					std::get< Mat<mpfr> >(dh_dx_temp_).resize(numTotalFunctions_, numVariables_);
 					std::get< Vec<dbl> >(dh_dt_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(dh_dt_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(stage_sum_).resize(numTotalFunctions_);
+					std::get< Vec<mpfr> >(stage_sum_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(stage_space_).resize(numVariables_);
+					std::get< Vec<mpfr> >(stage_space_).resize(numVariables_);
+					std::get< Vec<dbl> >(norm_workspace_).resize(numVariables_);
+					std::get< Vec<mpfr> >(norm_workspace_).resize(numVariables_);
 
 					ResizeK();
 				}
@@ -351,23 +343,49 @@ namespace bertini{
 				/** 
 				 /brief Change the precision of the predictor variables and reassign the Butcher table variables.
 				 
+				 The multiple precision workspaces and Butcher table are kept for each precision used.  Changing back to a precision swaps them back in, instead of setting the precision of every entry and converting the Butcher table again.
+				 
 				 \param new_precision The new precision.
 				 
 				 */
 				void ChangePrecision(unsigned new_precision)
 				{
+					std::get< EndpointStage<mpfr> >(endpoint_stages_).valid = false;
+
+					auto& outgoing = precision_tiers_[current_precision_];
+					SwapPrecisionTier(outgoing);
+					outgoing.valid = true;
+
+					auto& incoming = precision_tiers_[new_precision];
+					if (incoming.valid)
+					{
+						SwapPrecisionTier(incoming);
+						incoming.valid = false;
+
+						current_precision_ = new_precision;
+						PrecisionSanityCheck();
+						return;
+					}
+
+					// first time at this precision.  whatever was swapped out of the tier is reused as storage.
+					ResizeWorkspaces();
+
 					Precision(std::get< Mat<mpfr> >(K_),new_precision);
 
 					Precision(std::get< Vec<mpfr> >(dh_dt_temp_),new_precision);
 					Precision(std::get< Mat<mpfr> >(dh_dx_0_),new_precision);
 					Precision(std::get< Mat<mpfr> >(dh_dx_temp_),new_precision);
+					Precision(std::get< Vec<mpfr> >(stage_sum_),new_precision);
+					Precision(std::get< Vec<mpfr> >(stage_space_),new_precision);
+					Precision(std::get< Vec<mpfr> >(norm_workspace_),new_precision);
+					std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_stage_) = Eigen::PartialPivLU<Mat<mpfr>>();
 
 					Precision(std::get< Mat<mpfr_float> >(a_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_minus_bstar_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(c_),new_precision);
 
-					PredictorMethod(predictor_);
+					FillButcherTables(predictor_);
 
 					current_precision_ = new_precision;
 
@@ -432,6 +450,7 @@ namespace bertini{
 					static_assert(std::is_same<typename Eigen::NumTraits<RealType>::Real, typename Eigen::NumTraits<ComplexType>::Real>::value,"underlying complex type and the type for comparisons must match");
 					static_assert(std::is_same<typename Derived::Scalar, ComplexType>::value, "scalar types must match");
 
+					endpoint_tolerance_ = static_cast<double>(tracking_tolerance);
 					return FullStep<ComplexType, RealType>(next_space, S, current_space, current_time, delta_t);
 				}
 				
@@ -484,15 +503,14 @@ namespace bertini{
 					if(success_code != SuccessCode::Success)
 						return success_code;
 					
+					TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::AMPCriteria);
+
 					// Calculate condition number and updated if needed
 					Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
 					Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 					
-					Vec<ComplexType> randy = RandomOfUnits<ComplexType>(S.NumVariables());
-					Vec<ComplexType> temp_soln = LUref.solve(randy);
-					
 					norm_J = dhdxref.norm();
-					norm_J_inverse = temp_soln.norm();
+					norm_J_inverse = amp::NormJInverse(LUref, AMP_config, std::get< Vec<ComplexType> >(norm_workspace_));
 					
 					if (num_steps_since_last_condition_number_computation >= frequency_of_CN_estimation)
 					{
@@ -588,6 +606,83 @@ namespace bertini{
 				
 				
 				
+				/**
+				\brief Share a cache of Jacobian factorizations, so that the first stage of a prediction retried from the same point is not evaluated and factored again.
+
+				\param cache The cache.  May be null, to stop caching.
+				*/
+				void SetJacobianCache(std::shared_ptr<JacobianCache> const& cache)
+				{
+					jacobian_cache_ = cache;
+				}
+
+
+				/**
+				\brief Share an accumulator of the time spent evaluating, factoring, and checking the AMP criteria.
+
+				\param breakdown The accumulator.  May be null, to not time.
+				*/
+				void SetTimeBreakdown(std::shared_ptr<TimeBreakdown> const& breakdown)
+				{
+					time_breakdown_ = breakdown;
+				}
+
+
+				/**
+				\brief The number of Jacobians evaluated since construction, not counting those found in the Jacobian cache.
+				*/
+				unsigned long long NumJacobianEvaluations() const
+				{
+					return num_jacobian_evaluations_;
+				}
+
+				/**
+				\brief The number of LU factorizations computed since construction.
+				*/
+				unsigned long long NumFactorizations() const
+				{
+					return num_factorizations_;
+				}
+
+				/**
+				\brief The number of first stages taken from the endpoint stage of the prediction before, rather than evaluated and factored, since construction.
+				*/
+				unsigned long long NumReusedEndpointStages() const
+				{
+					return num_reused_endpoint_stages_;
+				}
+
+
+				/**
+				\brief An estimate of the bytes held by the predictor: its workspaces and Butcher tables, at the current precision and at the others it keeps.  The Jacobian cache, shared with the corrector, is not included.
+				*/
+				std::size_t MemoryBytes() const
+				{
+					using memory::HeapBytes;
+
+					std::size_t bytes = sizeof(ExplicitRKPredictor)
+					       + HeapBytes(K_) + HeapBytes(dh_dx_0_) + HeapBytes(dh_dx_temp_) + HeapBytes(dh_dt_temp_)
+					       + HeapBytes(stage_sum_) + HeapBytes(stage_space_) + HeapBytes(norm_workspace_) + HeapBytes(LU_stage_)
+					       + HeapBytes(LU_d_) + HeapBytes(a_) + HeapBytes(b_) + HeapBytes(b_minus_bstar_) + HeapBytes(c_)
+					       + HeapBytes(std::get< EndpointStage<dbl> >(endpoint_stages_)) + HeapBytes(std::get< EndpointStage<mpfr> >(endpoint_stages_));
+
+					for (auto const& lu : LU_mp_)
+						bytes += sizeof(lu) + HeapBytes(lu.second);
+
+					for (auto const& t : precision_tiers_)
+					{
+						auto const& tier = t.second;
+						bytes += sizeof(t) + HeapBytes(tier.K) + HeapBytes(tier.dh_dx_0) + HeapBytes(tier.dh_dx_temp)
+						       + HeapBytes(tier.dh_dt_temp) + HeapBytes(tier.stage_sum) + HeapBytes(tier.stage_space) + HeapBytes(tier.norm_workspace)
+						       + HeapBytes(tier.LU_stage) + HeapBytes(tier.a) + HeapBytes(tier.b) + HeapBytes(tier.b_minus_bstar) + HeapBytes(tier.c);
+					}
+					return bytes;
+				}
+				
+				
+				
+				
+				
 				/**
 				\brief Get the currently used prediction method.
 
@@ -623,6 +718,14 @@ namespace bertini{
 				{
 					return predict::HasErrorEstimate(predictor_);
 				}
+
+				/**
+				\brief The longest step the Pade predictor trusts, a fraction of its estimate of the distance from the most recent prediction to the nearest singularity of the path.  The largest double for the Runge-Kutta methods.
+				*/
+				double SafeStepSize() const
+				{
+					return predictor_==Predictor::Pade ? pade_trust_fraction_*trust_radius_ : std::numeric_limits<double>::max();
+				}
 				
 				
 				
@@ -636,6 +739,200 @@ namespace bertini{
 				//
 				////////////////////
 				
+				/**
+				 \brief Set the order and Butcher table, in double and the current multiple precision, for a predictor method.
+				 
+				 \param method Enum class that determines the predictor method
+				 */
+				void FillButcherTables(Predictor method)
+				{
+					predictor_ = method;
+					p_ = predict::Order(method);
+					switch(method)
+					{
+						case Predictor::Euler:
+						{
+							s_ = 1;
+							Mat<double>& arefd = std::get< Mat<double> >(a_);
+							Vec<double>& brefd = std::get< Vec<double> >(b_);
+							Vec<double>& crefd = std::get< Vec<double> >(c_);
+							crefd.resize(s_); crefd(0) = static_cast<double>(cEuler_(0));
+							arefd.resize(s_,s_); arefd(0,0) = static_cast<double>(aEuler_(0,0));
+							brefd.resize(s_); brefd(0) = static_cast<double>(bEuler_(0));
+							Mat<mpfr_float>& arefmp = std::get< Mat<mpfr_float> >(a_);
+							Vec<mpfr_float>& brefmp = std::get< Vec<mpfr_float> >(b_);
+							Vec<mpfr_float>& crefmp = std::get< Vec<mpfr_float> >(c_);
+							crefmp.resize(s_); crefmp(0) = static_cast<mpfr_float>(cEuler_(0));
+							arefmp.resize(s_,s_); arefmp(0,0) = static_cast<mpfr_float>(aEuler_(0,0));
+							brefmp.resize(s_); brefmp(0) = static_cast<mpfr_float>(bEuler_(0));
+							uses_embedded_ = false;
+							break;
+						}
+						case Predictor::HeunEuler:
+						{
+							s_ = 2;
+							
+							FillButcherTable<double>(s_, aHeunEuler_, bHeunEuler_, b_minus_bstarHeunEuler_, cHeunEuler_);
+							FillButcherTable<mpfr_float>(s_, aHeunEuler_, bHeunEuler_, b_minus_bstarHeunEuler_, cHeunEuler_);
+							
+							break;
+						}
+						case Predictor::RK4:
+						{
+							s_ = 4;
+							
+							FillButcherTable<double>(s_, aRK4_, bRK4_, cRK4_);
+							FillButcherTable<mpfr_float>(s_, aRK4_, bRK4_, cRK4_);
+							
+							break;
+						}
+							
+						case Predictor::RKF45:
+						{
+							s_ = 6;
+							
+							FillButcherTable<double>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
+							FillButcherTable<mpfr_float>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
+							
+							break;
+						}
+							
+						case Predictor::RKCashKarp45:
+						{
+							s_ = 6;
+							
+							FillButcherTable<double>(s_, aRKCK45_, bRKCK45_, b_minus_bstarRKCK45_, cRKCK45_);
+							FillButcherTable<mpfr_float>(s_, aRKCK45_, bRKCK45_, b_minus_bstarRKCK45_, cRKCK45_);
+							
+							break;
+						}
+							
+						case Predictor::RKDormandPrince56:
+						{
+							s_ = 8;
+							
+							FillButcherTable<double>(s_, aRKDP56_, bRKDP56_, b_minus_bstarRKDP56_, cRKDP56_);
+							FillButcherTable<mpfr_float>(s_, aRKDP56_, bRKDP56_, b_minus_bstarRKDP56_, cRKDP56_);
+							
+							break;
+						}
+							
+						case Predictor::RKVerner67:
+						{
+							s_ = 10;
+							
+							FillButcherTable<double>(s_, aRKV67_, bRKV67_, b_minus_bstarRKV67_, cRKV67_);
+							FillButcherTable<mpfr_float>(s_, aRKV67_, bRKV67_, b_minus_bstarRKV67_, cRKV67_);
+							
+							break;
+						}
+
+						case Predictor::Pade:
+						{
+							// not a Runge-Kutta method.  the columns of K are the Taylor coefficients of the path, and the tables are unused.
+							s_ = 3;
+
+							std::get< Mat<double> >(a_) = Mat<double>::Zero(s_,s_);
+							std::get< Vec<double> >(b_) = Vec<double>::Zero(s_);
+							std::get< Vec<double> >(b_minus_bstar_) = Vec<double>::Zero(s_);
+							std::get< Vec<double> >(c_) = Vec<double>::Zero(s_);
+							std::get< Mat<mpfr_float> >(a_) = Mat<mpfr_float>::Zero(s_,s_);
+							std::get< Vec<mpfr_float> >(b_) = Vec<mpfr_float>::Zero(s_);
+							std::get< Vec<mpfr_float> >(b_minus_bstar_) = Vec<mpfr_float>::Zero(s_);
+							std::get< Vec<mpfr_float> >(c_) = Vec<mpfr_float>::Zero(s_);
+							uses_embedded_ = true;
+							break;
+						}
+							
+						default:
+						{
+							throw std::runtime_error("incompatible predictor choice in ExplicitPredict");
+						}
+					}
+					ResizeK();
+
+					// the last stage at the end of the step, if any.  its point is a prediction too, of lower order, or the same for a first-same-as-last table.
+					endpoint_stage_index_ = s_;
+					const Vec<double>& crefd = std::get< Vec<double> >(c_);
+					for (unsigned ii = 1; ii < s_; ++ii)
+						if (crefd(ii)==1)
+							endpoint_stage_index_ = ii;
+				}; // re: FillButcherTables
+
+
+				/**
+				\brief The stage of a prediction at the end of the step, kept so that it can be the first stage of the next prediction.
+
+				The next step starts at the corrected prediction, which is not the point of this stage, but for the embedded tables is within about the error estimate of it.  If it is within the tracking tolerance, the slope there differs from the one here by no more than the corrector then removes, so the Jacobian, time derivative and factorization are reused rather than evaluated again.
+				*/
+				template<typename ComplexType>
+				struct EndpointStage
+				{
+					bool valid = false;
+					ComplexType time;
+					Vec<ComplexType> space;
+					Mat<ComplexType> dh_dx;
+					Vec<ComplexType> dh_dt;
+					Eigen::PartialPivLU<Mat<ComplexType>> LU;
+
+					friend std::size_t HeapBytes(EndpointStage const& e)
+					{
+						using memory::HeapBytes;
+						return HeapBytes(e.time) + HeapBytes(e.space) + HeapBytes(e.dh_dx) + HeapBytes(e.dh_dt) + HeapBytes(e.LU);
+					}
+				};
+
+
+				/**
+				\brief Keep the stage just evaluated, at the end of the step, for the next prediction.
+				*/
+				template<typename ComplexType>
+				void KeepEndpointStage(Vec<ComplexType> const& space, ComplexType const& time)
+				{
+					auto& endpoint = std::get< EndpointStage<ComplexType> >(endpoint_stages_);
+					endpoint.time = time;
+					endpoint.space = space;
+					endpoint.dh_dx = std::get< Mat<ComplexType> >(dh_dx_temp_);
+					endpoint.dh_dt = std::get< Vec<ComplexType> >(dh_dt_temp_);
+					endpoint.LU = std::get< Eigen::PartialPivLU<Mat<ComplexType>> >(LU_stage_);
+					endpoint.valid = true;
+				}
+				
+				
+				/**
+				 \brief The multiple precision workspaces and Butcher table of the predictor at one precision, kept while working at another.
+				 */
+				struct PrecisionTier
+				{
+					bool valid = false; // Whether this holds the state at its precision, rather than storage left over from a swap
+					Mat<mpfr> K, dh_dx_0, dh_dx_temp;
+					Vec<mpfr> dh_dt_temp, stage_sum, stage_space, norm_workspace;
+					Eigen::PartialPivLU<Mat<mpfr>> LU_stage;
+					Mat<mpfr_float> a;
+					Vec<mpfr_float> b, b_minus_bstar, c;
+				};
+				
+				/**
+				 \brief Exchange the multiple precision workspaces and Butcher table with those in a tier.  Only pointers are swapped.
+				 */
+				void SwapPrecisionTier(PrecisionTier & tier)
+				{
+					using std::swap;
+					std::get< Mat<mpfr> >(K_).swap(tier.K);
+					std::get< Mat<mpfr> >(dh_dx_0_).swap(tier.dh_dx_0);
+					std::get< Mat<mpfr> >(dh_dx_temp_).swap(tier.dh_dx_temp);
+					std::get< Vec<mpfr> >(dh_dt_temp_).swap(tier.dh_dt_temp);
+					std::get< Vec<mpfr> >(stage_sum_).swap(tier.stage_sum);
+					std::get< Vec<mpfr> >(stage_space_).swap(tier.stage_space);
+					std::get< Vec<mpfr> >(norm_workspace_).swap(tier.norm_workspace);
+					swap(std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_stage_), tier.LU_stage);
+					std::get< Mat<mpfr_float> >(a_).swap(tier.a);
+					std::get< Vec<mpfr_float> >(b_).swap(tier.b);
+					std::get< Vec<mpfr_float> >(b_minus_bstar_).swap(tier.b_minus_bstar);
+					std::get< Vec<mpfr_float> >(c_).swap(tier.c);
+				}
+				
+				
 				template <typename T>
 				Eigen::PartialPivLU<Mat<T>>& GetLU()
 				{
@@ -673,13 +970,17 @@ namespace bertini{
 									 ComplexType const& delta_t)
 				{
 					static_assert(std::is_same<typename Derived::Scalar, ComplexType>::value, "scalar types must match");
+
+					if (predictor_==Predictor::Pade)
+						return PadeStep<ComplexType, RealType>(next_space, S, current_space, current_time, delta_t);
 					
 					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
 					Mat<RealType>& aref = std::get< Mat<RealType> >(a_);
 					Vec<RealType>& bref = std::get< Vec<RealType> >(b_);
 					Vec<RealType>& cref = std::get< Vec<RealType> >(c_);
+					Vec<ComplexType>& temp = std::get< Vec<ComplexType> >(stage_sum_);
+					Vec<ComplexType>& stage_space = std::get< Vec<ComplexType> >(stage_space_);
 					Kref.fill(ComplexType(0));
-					Vec<ComplexType> temp(S.NumTotalFunctions());
 					
 					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
 					{
@@ -695,10 +996,15 @@ namespace bertini{
 							
 						}
 						
-						if(EvalRHS(S, current_space + delta_t*temp, current_time + cref(ii)*delta_t, Kref, ii) != SuccessCode::Success)
+						stage_space = current_space + delta_t*temp;
+						const ComplexType stage_time = current_time + cref(ii)*delta_t;
+						if(EvalRHS(S, stage_space, stage_time, Kref, ii) != SuccessCode::Success)
 						{
 							return SuccessCode::MatrixSolveFailure;
 						}
+
+						if (ii==endpoint_stage_index_)
+							KeepEndpointStage(stage_space, stage_time);
 					}
 					
 					
@@ -713,6 +1019,101 @@ namespace bertini{
 					return SuccessCode::Success;
 				};
 
+
+				/**
+				 \brief Predict with the Pade approximant of the path, from its Taylor coefficients, unless the step is outside the trust region.
+
+				 The first Taylor coefficient is the solution of the Davidenko equation, as for the first stage of the Runge-Kutta methods.  Each one after is the solution of the Jacobian at the current point with the corresponding coefficient of the homotopy along the Taylor polynomial so far, which vanishes to that order, computed by the Cauchy integral over a circle of radius \f$|\Delta t|\f$.  So they take function evaluations, num_pade_samples_ per coefficient, but no more Jacobians or factorizations.
+
+				 Each coordinate is predicted by its [2/1] Pade approximant, whose pole models the nearest singularity, or by its Taylor polynomial if the cubic coefficient vanishes.  The ratio of the norms of the quadratic and cubic coefficients estimates the distance to the nearest singularity of the path.  A step longer than pade_trust_fraction_ of that distance may jump paths, and is refused with ReduceStepSize; the tracker retries it with SafeStepSize().  The error estimate is the difference of the Pade and Taylor predictions, left in stage_sum_ for SetErrorEstimate.
+
+				 \param next_space The computed prediction space
+				 \param S The homotopy system
+				 \param current_space The current space values
+				 \param current_time The current time values
+				 \param delta_t The time step
+
+				 \return SuccessCode determining result of the computation
+				 */
+				template<typename ComplexType, typename RealType, typename Derived>
+				SuccessCode PadeStep(Vec<typename Derived::Scalar> & next_space,
+									System const& S,
+									 Eigen::MatrixBase<Derived> const& current_space, ComplexType const& current_time,
+									 ComplexType const& delta_t)
+				{
+					using std::acos;
+					using std::polar;
+					using bertini::polar;
+					using std::abs;
+
+					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
+					Vec<ComplexType>& err = std::get< Vec<ComplexType> >(stage_sum_);
+					Vec<ComplexType>& point = std::get< Vec<ComplexType> >(stage_space_);
+					Vec<ComplexType>& values = std::get< Vec<ComplexType> >(dh_dt_temp_); // free after the first stage
+					Kref.fill(ComplexType(0));
+
+					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
+						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
+
+					auto& LU = GetLU<ComplexType>();
+					const unsigned num_samples = num_pade_samples_;
+					const RealType radius = abs(delta_t);
+					const RealType two_pi = 2*acos(static_cast<RealType>(-1));
+					for (unsigned order = 2; order <= 3; ++order)
+					{
+						// the coefficient of s^order of H(x(s), t+s), for the Taylor polynomial x(s) so far
+						err.setZero();
+						for (unsigned jj = 0; jj < num_samples; ++jj)
+						{
+							const ComplexType s = polar(radius, RealType(two_pi*jj/num_samples));
+							ComplexType power = s;
+							point = current_space;
+							for (unsigned kk = 0; kk+1 < order; ++kk, power *= s)
+								point += power*Kref.col(kk);
+
+							{
+								TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::FunctionEvaluation);
+								S.EvalInPlace(values, point, ComplexType(current_time + s));
+							}
+							err += polar(static_cast<RealType>(1), RealType(-two_pi*jj*order/num_samples)) * values;
+						}
+						RealType scale(num_samples);
+						for (unsigned kk = 0; kk < order; ++kk)
+							scale *= radius;
+						err /= ComplexType(scale);
+
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+						Kref.col(order-1) = LU.solve(-err);
+					}
+
+					const RealType cubic_norm = Kref.col(2).norm();
+					trust_radius_ = cubic_norm > 0 ? static_cast<double>(RealType(Kref.col(1).norm() / cubic_norm)) : std::numeric_limits<double>::max();
+					if (static_cast<double>(radius) > pade_trust_fraction_*trust_radius_)
+						return SuccessCode::ReduceStepSize;
+
+					next_space.resize(current_space.size());
+					for (int ii = 0; ii < current_space.size(); ++ii)
+					{
+						const ComplexType& x0 = current_space(ii);
+						const ComplexType& x1 = Kref(ii,0);
+						const ComplexType& x2 = Kref(ii,1);
+						const ComplexType& x3 = Kref(ii,2);
+						const ComplexType taylor = x0 + delta_t*(x1 + delta_t*(x2 + delta_t*x3));
+
+						if (abs(x3*delta_t) < abs(x2)) // the pole is outside the step
+						{
+							const ComplexType b = -x3/x2;
+							next_space(ii) = (x0 + delta_t*((x1 + b*x0) + delta_t*(x2 + b*x1))) / (ComplexType(1) + b*delta_t);
+						}
+						else
+							next_space(ii) = taylor;
+
+						err(ii) = next_space(ii) - taylor;
+					}
+
+					return SuccessCode::Success;
+				}
+
 				
 				
 				
@@ -730,11 +1131,16 @@ namespace bertini{
 				template<typename ComplexType, typename RealType>
 				SuccessCode SetErrorEstimate(RealType & error_estimate, ComplexType const& delta_t)
 				{
+					if (predictor_==Predictor::Pade) // PadeStep left the difference of its predictions
+					{
+						error_estimate = std::get< Vec<ComplexType> >(stage_sum_).norm();
+						return SuccessCode::Success;
+					}
+
 					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
 					Vec<RealType>& b_minus_bstar_ref = std::get< Vec<RealType> >(b_minus_bstar_);
 					
-					auto numFuncs = Kref.rows();
-					Vec<ComplexType> err(numFuncs);
+					Vec<ComplexType>& err = std::get< Vec<ComplexType> >(stage_sum_);
 					
 					err.setZero();
 					for(int ii = 0; ii < s_; ++ii)
@@ -824,8 +1230,36 @@ namespace bertini{
 							assert(Precision(K)==current_precision_);
 						}
 
-						S.JacobianInPlace(dhdxref, space, time);
-						LUref = dhdxref.lu();
+						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
+						auto const& endpoint = std::get< EndpointStage<ComplexType> >(endpoint_stages_);
+						bool cached = jacobian_cache_ && jacobian_cache_->Matches(space, time);
+						if (cached) // retrying a failed step from the same point
+						{
+							dhdxref = jacobian_cache_->Jacobian<ComplexType>();
+							dhdtref = jacobian_cache_->TimeDerivative<ComplexType>();
+							LUref = jacobian_cache_->LU<ComplexType>();
+						}
+						else if (endpoint.valid && endpoint.time==time && static_cast<double>((space - endpoint.space).norm()) <= endpoint_tolerance_)
+						{
+							// continuing from the end of the previous step, whose last stage was evaluated near here
+							dhdxref = endpoint.dh_dx;
+							dhdtref = endpoint.dh_dt;
+							LUref = endpoint.LU;
+							++num_reused_endpoint_stages_;
+						}
+						else
+						{
+							{
+								TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+								S.JacobianAndTimeDerivativeInPlace(dhdxref, dhdtref, space, time);
+							}
+							{
+								TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+								LUref.compute(dhdxref);
+							}
+							++num_jacobian_evaluations_;
+							++num_factorizations_;
+						}
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
 							assert(Precision(dhdxref)==current_precision_);
@@ -840,8 +1274,10 @@ namespace bertini{
 						if (LUPartialPivotDecompositionSuccessful(LUref.matrixLU())!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref, space, time);
+						if (jacobian_cache_ && !cached)
+							jacobian_cache_->Store(space, time, dhdxref, dhdtref, LUref);
+
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
 						K.col(stage) = LUref.solve(-dhdtref);
 						
 						return SuccessCode::Success;
@@ -850,14 +1286,20 @@ namespace bertini{
 					else
 					{
 						Mat<ComplexType>& dhdxtempref = std::get< Mat<ComplexType> >(dh_dx_temp_);
-						S.JacobianInPlace(dhdxtempref,space, time);
-						auto LU = dhdxtempref.lu();
+						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
+						{
+							TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+							S.JacobianAndTimeDerivativeInPlace(dhdxtempref, dhdtref, space, time);
+						}
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+						Eigen::PartialPivLU<Mat<ComplexType>>& LU = std::get< Eigen::PartialPivLU<Mat<ComplexType>> >(LU_stage_);
+						LU.compute(dhdxtempref);
+						++num_jacobian_evaluations_;
+						++num_factorizations_;
 						
 						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref, space, time);
 						K.col(stage) = LU.solve(-dhdtref);
 						
 						return SuccessCode::Success;
@@ -996,10 +1438,29 @@ namespace bertini{
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_0_;  // Jacobian for the initial stage.  Use for AMP testing
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_temp_;  // Temporary jacobian for all other stages
 				mutable std::tuple< Vec<dbl>, Vec<mpfr> > dh_dt_temp_;  // Temporary time derivative used for all stages
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > stage_sum_;  // Weighted sum of the stage variables, for the next stage, the step, and the error estimate
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > stage_space_;  // The point at which a stage after the first is evaluated
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > norm_workspace_;  // Right hand side for estimating the norm of the inverse of the Jacobian
+				mutable std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_stage_;  // LU for the stages after the first.  Reset on precision change
 				// std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_0_;  // LU from the intial stage used for AMP testing
 
 				mutable Eigen::PartialPivLU<Mat<dbl>> LU_d_;
 				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr>>> LU_mp_;
+
+				std::shared_ptr<JacobianCache> jacobian_cache_; // Shared with the corrector.  Optional.
+				std::shared_ptr<TimeBreakdown> time_breakdown_; // Shared with the corrector and the tracker.  Optional.
+
+				mutable unsigned long long num_jacobian_evaluations_ = 0; // Counted for PathStatsObserver, never reset
+				mutable unsigned long long num_factorizations_ = 0;
+				mutable unsigned long long num_reused_endpoint_stages_ = 0;
+
+				mutable std::tuple< EndpointStage<dbl>, EndpointStage<mpfr> > endpoint_stages_; // The stage at the end of the most recent prediction, for the next one.  Forgotten with the path, precision, system, or method
+				unsigned endpoint_stage_index_ = 0; // The last stage at the end of the step, or s_ if none
+				double endpoint_tolerance_ = 0; // How near the endpoint stage the next prediction must start to reuse it, the tracking tolerance
+
+				double trust_radius_ = std::numeric_limits<double>::max(); // The Pade predictor's most recent estimate of the distance to the nearest singularity
+				static constexpr double pade_trust_fraction_ = 0.25; // The fraction of that distance the Pade predictor steps at most.  The ratio of the coefficients overestimates the distance to a square root branch point by a factor of two
+				static constexpr unsigned num_pade_samples_ = 8; // The points on the circle for each Taylor coefficient of the Pade predictor
 				
 				
 				// Butcher Table (notation from https://en.wikipedia.org/wiki/List_of_Runge%E2%80%93Kutta_methods)
@@ -1009,6 +1470,8 @@ namespace bertini{
 				mutable std::tuple< Vec<double>, Vec<mpfr_float> > b_minus_bstar_;
 				mutable std::tuple< Vec<double>, Vec<mpfr_float> > c_;
 				
+				std::map<unsigned, PrecisionTier> precision_tiers_; // The multiple precision state at each precision used other than the current.  Cleared with the system or method
+				
 				mutable bool uses_embedded_;
 				mutable unsigned current_precision_;
 				
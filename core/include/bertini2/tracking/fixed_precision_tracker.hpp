@@ -89,6 +89,12 @@ namespace bertini{
 			}
 
 
+			Vec<CT> CurrentPathDerivative() const override
+			{
+				return this->PathDerivative(std::get<Vec<CT>>(this->current_space_), this->current_time_);
+			}
+
+
 			void ResetCounters() const override
 			{
 				Base::ResetCountersBase();
@@ -125,7 +131,7 @@ namespace bertini{
 
 			void PostTrackCleanup() const override
 			{
-				this->NotifyObservers(TrackingEnded<EmitterType>(*this));
+				this->template NotifyObservers<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -161,11 +167,12 @@ namespace bertini{
 			*/
 			SuccessCode TrackerIteration() const override
 			{
+				BERTINI_TRACE_ZONE("TrackerIteration");
 				static_assert(std::is_same<	typename Eigen::NumTraits<RT>::Real, 
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
-				this->NotifyObservers(NewStep<EmitterType >(*this));
+				this->template NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<CT>& predicted_space = std::get<Vec<CT> >(this->temporary_space_); // this will be populated in the Predict step
 				Vec<CT>& current_space = std::get<Vec<CT> >(this->current_space_); // the thing we ultimately wish to update
@@ -174,9 +181,16 @@ namespace bertini{
 
 				SuccessCode predictor_code = Predict(predicted_space, current_space, current_time, delta_t);
 
-				if (predictor_code!=SuccessCode::Success)
+				if (predictor_code==SuccessCode::ReduceStepSize)
 				{
-					this->NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType >(*this));
+					// longer than the predictor trusts, near a singularity of the path
+					this->next_stepsize_ = RT(this->predictor_->SafeStepSize());
+					UpdateStepsize();
+					return predictor_code;
+				}
+				else if (predictor_code!=SuccessCode::Success)
+				{
+					this->template NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 
@@ -185,7 +199,7 @@ namespace bertini{
 					return predictor_code;
 				}
 
-				this->NotifyObservers(SuccessfulPredict<EmitterType , CT>(*this, predicted_space));
+				this->template NotifyObservers<SuccessfulPredict<EmitterType, CT>>(*this, predicted_space);
 
 				Vec<CT>& tentative_next_space = std::get<Vec<CT> >(this->tentative_space_); // this will be populated in the Correct step
 
@@ -202,7 +216,7 @@ namespace bertini{
 				}
 				else if (corrector_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(CorrectorMatrixSolveFailure<EmitterType >(*this));
+					this->template NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 					UpdateStepsize();
@@ -211,7 +225,15 @@ namespace bertini{
 				}
 
 				
-				this->NotifyObservers(SuccessfulCorrect<EmitterType , CT>(*this, tentative_next_space));
+				this->template NotifyObservers<SuccessfulCorrect<EmitterType, CT>>(*this, tentative_next_space);
+
+				// with the PI controller, the next stepsize follows the error of this prediction, the distance the corrector moved it
+				if (this->stepping_config_.step_size_controller==config::StepSizeController::PI)
+				{
+					double factor = this->ControlledStepSizeFactor(static_cast<double>((tentative_next_space - predicted_space).norm()));
+					this->next_stepsize_ = min(RT(this->current_stepsize_*factor), min(RT(this->stepping_config_.max_step_size), RT(this->predictor_->SafeStepSize())));
+					UpdateStepsize();
+				}
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -227,6 +249,22 @@ namespace bertini{
 				return Base::template CheckGoingToInfinity<CT>();
 			}
 
+			/**
+			Switch the patch if the current point is large.
+			*/
+			void SwitchPatchIfLarge() const override
+			{
+				Base::template SwitchPatchIfLarge<CT>();
+			}
+
+			/**
+			Estimate the initial stepsize.
+			*/
+			void EstimateInitialStepSize() const override
+			{
+				Base::template EstimateInitialStepSize<CT>();
+			}
+
 			
 
 
@@ -256,7 +294,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Base::IncrementBaseCountersSuccess();
-				this->NotifyObservers(SuccessfulStep<EmitterType >(*this));
+				this->template NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -266,14 +304,14 @@ namespace bertini{
 			{
 				Base::IncrementBaseCountersFail();
 				this->num_successful_steps_since_stepsize_increase_ = 0;
-				this->NotifyObservers(FailedStep<EmitterType >(*this));
+				this->template NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				this->NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				this->template NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 			//////////////
@@ -297,6 +335,7 @@ namespace bertini{
 								Vec<CT> const& current_space, 
 								CT const& current_time, CT const& delta_t) const
 			{
+				BERTINI_TRACE_ZONE("Predict");
 				static_assert(std::is_same<	typename Eigen::NumTraits<CT>::Real, 
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
@@ -335,6 +374,7 @@ namespace bertini{
 								Vec<CT> const& current_space, 
 								CT const& current_time) const
 			{
+				BERTINI_TRACE_ZONE("Correct");
 				static_assert(std::is_same<	typename Eigen::NumTraits<RT>::Real, 
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
@@ -479,7 +519,7 @@ namespace bertini{
 			                               BaseComplexType const& end_time,
 										   Vec<BaseComplexType> const& start_point) const override
 			{
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -566,7 +606,7 @@ namespace bertini{
 				}
 
 
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
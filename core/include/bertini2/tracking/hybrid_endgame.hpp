@@ -0,0 +1,218 @@
+//This file is part of Bertini 2.
+//
+//hybrid_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//hybrid_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with hybrid_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+#pragma once
+
+/**
+\file hybrid_endgame.hpp
+
+\brief Contains the hybrid endgame type, which runs the power series endgame, and switches to the Cauchy endgame on paths with high cycle number.
+*/
+
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/amp_cauchy_endgame.hpp"
+#include "bertini2/tracking/fixed_prec_powerseries_endgame.hpp"
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+
+
+namespace bertini{ namespace tracking { namespace endgame {
+
+/**
+\brief Runs the power series endgame on each path, handing it to the Cauchy endgame if its cycle number looks high.
+
+The power series endgame is the cheaper of the two on nonsingular paths and those of low cycle number, and the Cauchy endgame the more robust for high cycle numbers.  So each path starts with the power series endgame, which stops with CycleNumTooHigh once its upper bound on the cycle number exceeds cycle_number_bound_for_handoff, or stalled_approximations_for_handoff successive approximations fail to get closer together, in its settings.  The Cauchy endgame then continues from its newest samples, without tracking to them again.
+
+The stats are those of both endgames, with handed_off set if the Cauchy endgame ran.  Configure the two endgames through PowerSeries and Cauchy.
+
+A path warm started with a hint whose cycle number is past the bound goes straight to the Cauchy endgame.
+
+\code
+using EGT = EndgameSelector<AMPTracker>::Hybrid;
+EGT endgame(tracker);
+endgame.Run(t_endgame_boundary, point_at_boundary);
+\endcode
+
+\tparam TrackerType The type of tracker, shared by the two endgames.
+*/
+template<typename TrackerType>
+class HybridEndgame
+{
+public:
+
+	using PowerSeriesType = typename EndgameSelector<TrackerType>::PSEG;
+	using CauchyType = typename EndgameSelector<TrackerType>::Cauchy;
+
+	/**
+	\param tr The tracker, for both endgames.
+	\param cycle_number_bound The upper bound on the cycle number past which the power series endgame hands off.
+	\param num_stalled The number of successive approximations failing to get closer, at which the power series endgame hands off.
+	*/
+	explicit HybridEndgame(TrackerType const& tr, unsigned cycle_number_bound = 10, unsigned num_stalled = 2) : power_series_(tr), cauchy_(tr)
+	{
+		auto settings = power_series_.PowerSeriesSettings();
+		settings.cycle_number_bound_for_handoff = cycle_number_bound;
+		settings.stalled_approximations_for_handoff = num_stalled;
+		power_series_.SetPowerSeriesSettings(settings);
+	}
+
+
+	/**
+	\brief Run the endgame on a path, from a point at the endgame boundary.
+
+	\param start_time The time at the endgame boundary.
+	\param start_point The point on the path at that time.
+	\return The success code of the power series endgame, or of the Cauchy endgame if it was handed the path.
+	*/
+	template<typename CT>
+	SuccessCode Run(CT const& start_time, Vec<CT> const& start_point)
+	{
+		const auto bound = power_series_.PowerSeriesSettings().cycle_number_bound_for_handoff;
+		if (bound > 0 && power_series_.GetHint().cycle_number > bound)
+		{
+			handed_off_ = true;
+			auto code = cauchy_.Run(start_time, start_point);
+			stats_ = cauchy_.Stats();
+			stats_.handed_off = true;
+			return code;
+		}
+
+		handed_off_ = false;
+		auto code = power_series_.Run(start_time, start_point);
+		stats_ = power_series_.Stats();
+		if (code!=SuccessCode::CycleNumTooHigh)
+			return code;
+
+		BERTINI_LOG(debug) << "handing path off from power series to Cauchy endgame at t = " << power_series_.template GetTimes<CT>().back();
+		handed_off_ = true;
+		code = cauchy_.RunFromSamples(power_series_.template GetTimes<CT>(), power_series_.template GetSamples<CT>());
+		stats_ += cauchy_.Stats();
+		stats_.handed_off = true;
+		return code;
+	}
+
+	template<typename CT>
+	const Vec<CT>& FinalApproximation() const
+	{
+		return handed_off_ ? cauchy_.template FinalApproximation<CT>() : power_series_.template FinalApproximation<CT>();
+	}
+
+	unsigned CycleNumber() const
+	{
+		return handed_off_ ? cauchy_.CycleNumber() : power_series_.CycleNumber();
+	}
+
+	/**
+	\brief Forget the path run on last, in both endgames.
+	*/
+	void Reset()
+	{
+		power_series_.Reset();
+		cauchy_.Reset();
+		stats_ = EndgameStats();
+		handed_off_ = false;
+	}
+
+	/**
+	\brief Counts of the work done by both endgames on the most recent path.
+	*/
+	EndgameStats const& Stats() const
+	{
+		return stats_;
+	}
+
+	/**
+	\brief Warm start the following Runs of both endgames, from what an earlier solve learned about the path.
+	*/
+	void SetHint(EndgameHint const& hint)
+	{
+		power_series_.SetHint(hint);
+		cauchy_.SetHint(hint);
+	}
+
+	/**
+	\brief A hint for the same path of a nearby solve, from the endgame which finished the most recent path, with the highest precision of either.
+	*/
+	EndgameHint RecordHint() const
+	{
+		auto hint = handed_off_ ? cauchy_.RecordHint() : power_series_.RecordHint();
+		hint.precision = stats_.peak_precision;
+		return hint;
+	}
+
+	/**
+	\brief Whether the most recent path was handed to the Cauchy endgame.
+	*/
+	bool HandedOff() const
+	{
+		return handed_off_;
+	}
+
+	const System& GetSystem() const
+	{
+		return power_series_.GetSystem();
+	}
+
+	PowerSeriesType& PowerSeries()
+	{
+		return power_series_;
+	}
+
+	PowerSeriesType const& PowerSeries() const
+	{
+		return power_series_;
+	}
+
+	CauchyType& Cauchy()
+	{
+		return cauchy_;
+	}
+
+	CauchyType const& Cauchy() const
+	{
+		return cauchy_;
+	}
+
+	/**
+	\brief An estimate of the memory held by both endgames, by component.
+	*/
+	MemoryReport MemoryUsage() const
+	{
+		MemoryReport report;
+		report.Add("power series: ", power_series_.MemoryUsage());
+		report.Add("cauchy: ", cauchy_.MemoryUsage());
+		return report;
+	}
+
+private:
+
+	PowerSeriesType power_series_;
+	CauchyType cauchy_;
+	EndgameStats stats_;
+	bool handed_off_ = false;
+};
+
+
+}}} // re: namespaces
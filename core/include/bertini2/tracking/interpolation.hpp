@@ -30,6 +30,10 @@
 #pragma once
 
 #include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/memory_usage.hpp"
+#include "bertini2/trace_zones.hpp"
+
+#include <vector>
 
 namespace bertini{
 	namespace tracking{
@@ -62,6 +66,7 @@ Details:
 template<typename CT>		
 	Vec<CT> HermiteInterpolateAndSolve(CT const& target_time, const unsigned int num_sample_points, const TimeCont<CT> & times, const SampCont<CT> & samples, const SampCont<CT> & derivatives)
 {
+	BERTINI_TRACE_ZONE("HermiteInterpolate");
 	assert((times.size() >= num_sample_points) && "must have sufficient number of sample times");
 	assert((samples.size() >= num_sample_points) && "must have sufficient number of sample points");
 	assert((derivatives.size() >= num_sample_points) && "must have sufficient number of derivatives");
@@ -118,4 +123,175 @@ template<typename CT>
 	return (Result * (target_time - time_differences(0)) + space_differences(0,0)).eval(); 
 } //re: HermiteInterpolateAndSolve
 
+
+
+/**
+\brief Hermite interpolation over a sliding window of samples, updated one sample at a time.
+
+Holds the divided differences of the most recent samples, each sample a time, a space value, and a derivative, so each is two nodes of the interpolating polynomial.  Pushing a sample computes only the two new rows of divided differences, against the nodes already held, and forgets the oldest sample once more than the capacity are held.  Evaluating uses the Newton form at the newest nodes, so costs one pass over a row.  Both are linear in the number of samples, where HermiteInterpolateAndSolve builds the whole table each call.
+
+The table is one contiguous buffer, allocated by Reset and reused after, so pushing and evaluating allocate no containers.
+
+Evaluating with n samples gives the value of the polynomial of degree 2n-1 matching the samples and their derivatives, so polynomials of that degree are reproduced up to roundoff.
+
+\code
+HermiteInterpolator<dbl> interp;
+interp.Reset(num_sample_points+1, num_variables);
+for (unsigned ii = 0; ii < times.size(); ++ii)
+	interp.Push(times[ii], samples[ii], derivatives[ii]);
+interp.Evaluate(result, dbl(0), num_sample_points); // the newest num_sample_points samples
+interp.Evaluate(result, times.back(), num_sample_points, 1); // the ones before the newest
+\endcode
+
+\tparam CT The complex number type.
+*/
+template<typename CT>
+class HermiteInterpolator
+{
+public:
+
+	/**
+	\brief Forget all samples, and size the table for a number of them, in a dimension.
+
+	\param capacity The most samples held.  To evaluate with n of them while skipping the newest k, the capacity must be at least n+k.
+	\param dimension The length of the samples and derivatives.
+	*/
+	void Reset(unsigned capacity, unsigned dimension)
+	{
+		assert(capacity>0 && "capacity of interpolator must be positive");
+		capacity_ = capacity;
+		dimension_ = dimension;
+		num_pushed_ = 0;
+		nodes_.resize(NumNodes());
+		table_.resize(NumNodes()*NumNodes()*dimension_);
+	}
+
+	/**
+	\brief The most samples held.
+	*/
+	unsigned Capacity() const
+	{
+		return capacity_;
+	}
+
+	unsigned Dimension() const
+	{
+		return dimension_;
+	}
+
+	/**
+	\brief The number of samples held, at most the capacity.
+	*/
+	unsigned NumPoints() const
+	{
+		return num_pushed_ < capacity_ ? num_pushed_ : capacity_;
+	}
+
+	/**
+	\brief Add a sample as the newest, forgetting the oldest if already at capacity.
+
+	\param time The time of the sample.  Must differ from the times of the samples held.
+	\param sample The space value at that time.
+	\param derivative The derivative of the space value with respect to time.
+	*/
+	void Push(CT const& time, Vec<CT> const& sample, Vec<CT> const& derivative)
+	{
+		assert(sample.size()==dimension_ && derivative.size()==dimension_ && "sample and derivative must match the dimension of the interpolator");
+
+		const unsigned num_nodes = NumNodes();
+		const unsigned first = 2*num_pushed_, second = first+1;
+
+		nodes_[first % num_nodes] = time;
+		nodes_[second % num_nodes] = time;
+
+		// the first copy of the node only differences against the nodes of the samples held
+		const unsigned first_max = first < num_nodes-2 ? first : num_nodes-2;
+		for (unsigned ii = 0; ii < dimension_; ++ii)
+			Entry(first,0)[ii] = sample(ii);
+		for (unsigned k = 1; k <= first_max; ++k)
+		{
+			const CT denominator = time - nodes_[(first-k) % num_nodes];
+			for (unsigned ii = 0; ii < dimension_; ++ii)
+				Entry(first,k)[ii] = (Entry(first,k-1)[ii] - Entry(first-1,k-1)[ii]) / denominator;
+		}
+
+		// the second, against the first, gets the derivative
+		const unsigned second_max = second < num_nodes-1 ? second : num_nodes-1;
+		for (unsigned ii = 0; ii < dimension_; ++ii)
+		{
+			Entry(second,0)[ii] = sample(ii);
+			Entry(second,1)[ii] = derivative(ii);
+		}
+		for (unsigned k = 2; k <= second_max; ++k)
+		{
+			const CT denominator = time - nodes_[(second-k) % num_nodes];
+			for (unsigned ii = 0; ii < dimension_; ++ii)
+				Entry(second,k)[ii] = (Entry(second,k-1)[ii] - Entry(first,k-1)[ii]) / denominator;
+		}
+
+		++num_pushed_;
+	}
+
+	/**
+	\brief Evaluate the Hermite interpolant of some of the newest samples.
+
+	\param[out] result The value of the interpolant at the target time.  Resized to the dimension.
+	\param target_time The time at which to evaluate.
+	\param num_points The number of samples to interpolate.
+	\param skip_newest The number of the newest samples to leave out, such as one to predict the newest from the others.
+	*/
+	void Evaluate(Vec<CT> & result, CT const& target_time, unsigned num_points, unsigned skip_newest = 0) const
+	{
+		assert(num_points>0 && "must interpolate at least one sample");
+		assert(num_points+skip_newest <= NumPoints() && "must hold sufficiently many samples to interpolate");
+
+		const unsigned num_nodes = NumNodes();
+		const unsigned last = 2*(num_pushed_-skip_newest)-1;
+		const unsigned degree = 2*num_points-1;
+
+		result.resize(dimension_);
+		for (unsigned ii = 0; ii < dimension_; ++ii)
+			result(ii) = Entry(last,degree)[ii];
+
+		for (unsigned k = degree; k-- > 0; )
+		{
+			const CT factor = target_time - nodes_[(last-k) % num_nodes];
+			for (unsigned ii = 0; ii < dimension_; ++ii)
+				result(ii) = result(ii)*factor + Entry(last,k)[ii];
+		}
+	}
+
+	friend std::size_t HeapBytes(HermiteInterpolator const& h)
+	{
+		return memory::HeapBytes(h.nodes_) + memory::HeapBytes(h.table_);
+	}
+
+private:
+
+	unsigned NumNodes() const
+	{
+		return 2*capacity_;
+	}
+
+	/**
+	The divided differences of the node at a position, against the k nodes before it, one per coordinate.  Rows are reused as the nodes they held are forgotten.
+	*/
+	CT* Entry(unsigned node, unsigned k)
+	{
+		return table_.data() + ((node % NumNodes())*NumNodes() + k)*dimension_;
+	}
+
+	CT const* Entry(unsigned node, unsigned k) const
+	{
+		return table_.data() + ((node % NumNodes())*NumNodes() + k)*dimension_;
+	}
+
+	unsigned capacity_ = 0;
+	unsigned dimension_ = 0;
+	unsigned num_pushed_ = 0;
+	std::vector<CT> nodes_; ///< The times of the nodes, two per sample, in a ring.
+	std::vector<CT> table_; ///< The divided differences, a row per node, in a ring.
+};
+
+
 }}  // re: namespaces
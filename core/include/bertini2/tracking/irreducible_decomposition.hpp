@@ -0,0 +1,608 @@
+//This file is part of Bertini 2.
+//
+//irreducible_decomposition.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//irreducible_decomposition.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with irreducible_decomposition.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file irreducible_decomposition.hpp
+
+\brief Contains the NumericalIrreducibleDecomposition type, for breaking the solutions of a polynomial system into irreducible components, each given by a witness set.
+*/
+
+#ifndef BERTINI_TRACKING_IRREDUCIBLE_DECOMPOSITION_HPP
+#define BERTINI_TRACKING_IRREDUCIBLE_DECOMPOSITION_HPP
+
+#include "bertini2/witness_set.hpp"
+#include "bertini2/tracking/parallel_solver.hpp"
+#include "bertini2/tracking/post_processing.hpp"
+#include "bertini2/tracking/witness_sampler.hpp"
+#include "bertini2/tracking/deflation.hpp"
+#include "bertini2/detail/work_stealing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Breaks the solutions of a polynomial system into irreducible components, dimension by dimension, each given by a witness set.
+
+		For each dimension d, from the highest down, the system is randomized to as many functions as variables less d, and sliced by a random LinearSlice of dimension d.  The finite solutions of this square system, found by a total degree homotopy, at which the functions of the system vanish, are the witness superset: the points cut by the slice from the components of dimension d, and junk, points on components of higher dimension.  The junk is removed as config::TrackBack says, by the local dimension test, which deflates the sliced system at each singular point, since the points on a component of higher dimension are not isolated in the slice, or by membership tests in the witness sets of the higher dimensions.  The points left are the pure witness set of dimension d.
+
+		The pure witness set is then broken into components by monodromy, and the linear trace test, see config::Decomposition.  Moving the slice around a loop permutes the points of each component among themselves, so the points joined by the loops are each in one component.  The trace of a group of points, the sum of a random linear function at them, is linear as the slice is translated in parallel exactly when the group is a union of components, so a group of joined points whose trace is linear is a whole component.
+
+		Every stage is shared between threads over the points: the paths of the total degree homotopies and of the slices moved by ParallelSolvers, the local dimension tests over a work-stealing pool.  The stages depend on each other, so run in turn.
+
+		The points of a component of multiplicity more than 1 are singular, so are not moved well by the loops, and such a component is usually left unverified.
+
+		\code
+		NumericalIrreducibleDecomposition<AMPTracker> decomposition(sys, [](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+			});
+		decomposition.Decompose();
+
+		for (auto const& c : decomposition.Components())
+			std::cout << "dimension " << c.witness_set.Dimension() << ", degree " << c.witness_set.Degree() << std::endl;
+		\endcode
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam EndgameType The type of endgame to use.  Defaults to the power series endgame for the tracker type.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class NumericalIrreducibleDecomposition
+		{
+		public:
+
+			using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			using Solver = ParallelSolver<TrackerType, EndgameType>;
+			using TrackerSetup = typename Solver::TrackerSetup;
+
+			/**
+			\brief An irreducible component, or, if not verified, a union of them which the decomposition could not break up.
+			*/
+			struct IrreducibleComponent
+			{
+				WitnessSet witness_set; ///< The points cut from the component by the slice of the pure witness set of its dimension.
+				bool verified = false; ///< Whether the points pass the linear trace test, and were joined by monodromy or no fewer of them pass it, so are a whole irreducible component.
+			};
+
+			/**
+			\brief Set up a decomposition of the solutions of a system.
+
+			\throws std::runtime_error, if the system is not polynomial, has a path variable already, has other than one affine variable group, or is homogenized.
+
+			\param target The system whose solutions are decomposed.  Need not be square.
+			\param tracker_setup Called once on each thread's tracker of each stage, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			NumericalIrreducibleDecomposition(System const& target, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				target_(target),
+				tracker_setup_(tracker_setup),
+				num_threads_(std::max(num_threads, 1u))
+			{
+				if (target.HavePathVariable())
+					throw std::runtime_error("attempting to decompose a system, but it has a path variable declared already");
+
+				if (target.NumVariableGroups() != 1 || target.NumHomVariableGroups() > 0 || target.NumUngroupedVariables() > 0)
+					throw std::runtime_error("irreducible decomposition needs a single affine variable group");
+
+				if (target.NumHomVariables() > 0)
+					throw std::runtime_error("irreducible decomposition works on affine systems, but the system is homogenized");
+
+				if (!target.IsPolynomial())
+					throw std::runtime_error("attempting to decompose a non-polynomial system");
+
+				variables_ = target.AffineVariableGroup(0);
+				for (auto d : target.Degrees())
+					max_degree_ = std::max(max_degree_, d);
+			}
+
+
+			void SetSettings(config::Decomposition<BaseRealType> const& settings)
+			{
+				settings_ = settings;
+			}
+
+			config::Decomposition<BaseRealType> const& Settings() const
+			{
+				return settings_;
+			}
+
+			void SetTrackBack(config::TrackBack const& settings)
+			{
+				track_back_ = settings;
+			}
+
+			config::TrackBack const& TrackBackSettings() const
+			{
+				return track_back_;
+			}
+
+			/**
+			\brief Set the thresholds by which endpoints of the witness supersets are found infinite, and are clustered.
+			*/
+			void SetPostProcessing(config::PostProcessing<BaseRealType> const& settings)
+			{
+				post_processing_ = settings;
+			}
+
+
+			/**
+			\brief Find the witness supersets, remove their junk, and break the pure witness sets into components, dimension by dimension, blocking until done.
+
+			Threads run at the default precision of the calling thread.
+			*/
+			void Decompose()
+			{
+				components_.clear();
+				pure_witness_sets_.clear();
+				isolated_solutions_.clear();
+				num_junk_points_ = 0;
+				num_paths_tracked_ = 0;
+
+				const auto n = static_cast<unsigned>(variables_.size());
+				const auto m = static_cast<unsigned>(target_.NumTotalFunctions());
+				const unsigned lowest = m >= n ? 0 : n - m; // every component has at least this dimension
+
+				for (unsigned d = n; d-- > lowest; )
+				{
+					auto randomized = Randomized(n-d);
+
+					if (d==0)
+					{
+						auto points = WitnessSuperset(randomized);
+						isolated_solutions_ = RemoveJunk(randomized, points);
+						break;
+					}
+
+					WitnessSet superset(randomized, LinearSlice::RandomComplex(variables_, d));
+					auto sliced = superset.SlicedSystem();
+					auto points = RemoveJunk(sliced, WitnessSuperset(sliced));
+					if (points.empty())
+						continue;
+
+					pure_witness_sets_.emplace_back(randomized, superset.Slice(), points);
+					BreakIntoComponents(pure_witness_sets_.back());
+				}
+			}
+
+
+			/**
+			\brief The components of positive dimension found by the most recent Decompose, from the highest dimension down.
+			*/
+			std::vector<IrreducibleComponent> const& Components() const
+			{
+				return components_;
+			}
+
+			/**
+			\brief The pure witness set of each positive dimension with any components, from the highest down, the union of the witness sets of the components of that dimension.
+			*/
+			std::vector<WitnessSet> const& PureWitnessSets() const
+			{
+				return pure_witness_sets_;
+			}
+
+			/**
+			\brief The isolated solutions, the components of dimension 0, if the system has at least as many functions as variables.
+			*/
+			std::vector<Vec<mpfr>> const& IsolatedSolutions() const
+			{
+				return isolated_solutions_;
+			}
+
+			/**
+			\brief The number of points of the witness supersets found on components of higher dimension, over all dimensions.
+			*/
+			size_t NumJunkPoints() const
+			{
+				return num_junk_points_;
+			}
+
+			/**
+			\brief The number of paths tracked by the most recent Decompose, over all stages.
+			*/
+			size_t NumPathsTracked() const
+			{
+				return num_paths_tracked_;
+			}
+
+		private:
+
+			using Nd = std::shared_ptr<node::Node>;
+
+			// the first k functions of the target, each plus a random combination of those after.  the solutions of the target are among its solutions, and its components of dimension n-k are of the target, or not on it at all.
+			System Randomized(unsigned k) const
+			{
+				System s;
+				s.AddVariableGroup(variables_);
+				for (unsigned ii = 0; ii < k; ++ii)
+				{
+					Nd f = target_.Function(ii)->entry_node();
+					for (unsigned jj = k; jj < target_.NumTotalFunctions(); ++jj)
+						f = f + std::make_shared<node::Rational>(node::Rational::Rand())*target_.Function(jj)->entry_node();
+					s.AddFunction(f);
+				}
+				return s;
+			}
+
+
+			// the finite solutions of a square system at which the target vanishes, by a total degree homotopy on a homogenized copy.
+			std::vector<Vec<mpfr>> WitnessSuperset(System const& square)
+			{
+				using std::max;
+				using std::pow;
+
+				auto homogenized = Clone(square); // homogenizing changes the functions in place, which the square system shares with the target
+				homogenized.Homogenize();
+				homogenized.AutoPatch();
+
+				auto TD = start_system::TotalDegree(homogenized);
+				TD.Homogenize();
+
+				Solver solver(homogenized, TD, tracker_setup_, num_threads_);
+				solver.Solve();
+				num_paths_tracked_ += solver.Results().size();
+
+				std::vector<Vec<mpfr>> points;
+				for (auto const& s : ClusterResults(solver.Results(), post_processing_, num_threads_))
+				{
+					if (!s.is_finite)
+						continue;
+
+					BaseRealType scale = pow(max(BaseRealType(1), BaseRealType(s.solution.norm())), max_degree_);
+					if (BaseRealType(target_.Eval(s.solution).norm()) <= settings_.residual_tolerance * scale)
+						points.push_back(ToMultiple(s.solution));
+				}
+				return points;
+			}
+
+
+			// the points of a witness superset not on the components of higher dimension.
+			std::vector<Vec<mpfr>> RemoveJunk(System const& sliced, std::vector<Vec<mpfr>> const& points)
+			{
+				if (pure_witness_sets_.empty())
+					return points; // there is nothing of higher dimension for junk to be on
+
+				// the points nonsingular in the slice are isolated in it, so are never junk.  the local dimension test deflates the others.
+				auto isolated = Isolated(sliced, points, track_back_.junk_removal_test ? track_back_.max_depth_LDT : 0);
+
+				// otherwise the singular points are junk if on the components of some higher dimension, moving the slice of its pure witness set through them
+				std::vector<char> junk(points.size(), track_back_.junk_removal_test ? 1 : 0);
+				if (!track_back_.junk_removal_test)
+					for (auto const& w : pure_witness_sets_)
+					{
+						WitnessSampler<TrackerType, EndgameType> sampler(w, tracker_setup_, num_threads_);
+						for (size_t ii = 0; ii < points.size(); ++ii)
+							if (!isolated[ii] && !junk[ii])
+							{
+								junk[ii] = sampler.Contains(ToBase(points[ii]), settings_.same_point_tolerance);
+								num_paths_tracked_ += sampler.GetSolver().Results().size();
+							}
+					}
+
+				std::vector<Vec<mpfr>> pure;
+				for (size_t ii = 0; ii < points.size(); ++ii)
+					if (isolated[ii] || !junk[ii])
+						pure.push_back(points[ii]);
+				num_junk_points_ += points.size() - pure.size();
+				return pure;
+			}
+
+
+			// whether each point is isolated in the solutions of the sliced system, by deflating it there up to the given times, over the threads.
+			std::vector<char> Isolated(System const& sliced, std::vector<Vec<mpfr>> const& points, unsigned max_depth)
+			{
+				config::Deflation deflation;
+				deflation.max_deflations = max_depth;
+				const double tolerance = static_cast<double>(settings_.same_point_tolerance);
+
+				// done on the calling thread, since cloning reads the shared system
+				std::vector<System> copies;
+				for (unsigned ii = 0; ii < num_threads_; ++ii)
+					copies.push_back(Clone(sliced));
+
+				std::vector<char> isolated(points.size(), 0);
+				detail::WorkStealingQueues<size_t> queues(num_threads_);
+				for (size_t ii = 0; ii < points.size(); ++ii)
+					queues.Push(static_cast<unsigned>(ii % num_threads_), ii);
+
+				auto precision = DefaultPrecision();
+				detail::RunWorkStealing<size_t>(queues, [&](unsigned worker, size_t const& ii)
+					{
+						DefaultPrecision(precision);
+						isolated[ii] = Deflate(copies[worker], ToBase(points[ii]), tolerance, deflation).converged;
+					});
+				return isolated;
+			}
+
+
+			// join the points of a pure witness set by monodromy, and group them into components by the trace test.
+			void BreakIntoComponents(WitnessSet const& pure)
+			{
+				using std::abs;
+				using std::max;
+
+				auto const& points = pure.Points();
+				const auto n = points.size();
+				auto const& slice = pure.Slice();
+				const Vec<mpfr> base = WitnessSet::SliceParameters(slice);
+				const auto num_coefficients = slice.Coefficients().rows()*slice.Coefficients().cols();
+
+				std::vector<Vec<BaseComplexType>> starts;
+				for (auto const& x : points)
+					starts.push_back(ToBase(x));
+				Solver out(pure.SliceMovingHomotopy(), starts, tracker_setup_, num_threads_);
+
+				// the second difference of the trace of each point, as the slice is translated in parallel by -1, 0, and 1 times a random direction.
+				const Vec<mpfr> functional = RandomOfUnits<mpfr>(variables_.size());
+				const Vec<mpfr> direction = RandomOfUnits<mpfr>(slice.Dimension());
+				std::vector<mpfr> defect(n);
+				std::vector<BaseRealType> size(n);
+				std::vector<char> have_trace(n, 1);
+				for (size_t ii = 0; ii < n; ++ii)
+				{
+					defect[ii] = mpfr(-2)*functional.cwiseProduct(points[ii]).sum();
+					size[ii] = BaseRealType(points[ii].norm());
+				}
+				for (int sign : {1, -1})
+				{
+					Vec<mpfr> translated = base;
+					for (unsigned ii = 0; ii < slice.Dimension(); ++ii)
+						translated(num_coefficients + ii) += mpfr(sign)*direction(ii);
+
+					auto moved = MoveAll(out, translated, n);
+					for (size_t ii = 0; ii < n; ++ii)
+						if (moved[ii].size()==0)
+							have_trace[ii] = 0;
+						else
+							defect[ii] += functional.cwiseProduct(ToMultiple(moved[ii])).sum();
+				}
+
+				auto passes = [&](std::vector<size_t> const& group)
+					{
+						mpfr sum(0);
+						BaseRealType scale(1);
+						for (auto ii : group)
+						{
+							if (!have_trace[ii])
+								return false;
+							sum += defect[ii];
+							scale += size[ii];
+						}
+						return BaseRealType(abs(sum)) <= settings_.trace_tolerance * scale;
+					};
+
+				// the points joined so far, as a forest, each tree a group
+				std::vector<size_t> parent(n);
+				for (size_t ii = 0; ii < n; ++ii)
+					parent[ii] = ii;
+				auto find = [&parent](size_t ii)
+					{
+						while (parent[ii]!=ii)
+							ii = parent[ii] = parent[parent[ii]];
+						return ii;
+					};
+				auto groups = [&]()
+					{
+						std::map<size_t, std::vector<size_t>> by_root;
+						for (size_t ii = 0; ii < n; ++ii)
+							by_root[find(ii)].push_back(ii);
+						std::vector<std::vector<size_t>> g;
+						for (auto& r : by_root)
+							g.push_back(std::move(r.second));
+						return g;
+					};
+				auto all_pass = [&]()
+					{
+						for (auto const& g : groups())
+							if (!passes(g))
+								return false;
+						return true;
+					};
+
+				unsigned num_stale = 0;
+				while (num_stale < settings_.max_num_stale_loops && !all_pass())
+				{
+					// out to a random slice along the one homotopy, and back along one with its own gamma
+					auto far = LinearSlice::RandomComplex(slice.Variables(), slice.Dimension());
+					auto there = MoveAll(out, WitnessSet::SliceParameters(far), n);
+
+					std::vector<Vec<BaseComplexType>> far_points;
+					std::vector<size_t> from;
+					for (size_t ii = 0; ii < n; ++ii)
+						if (there[ii].size())
+						{
+							far_points.push_back(there[ii]);
+							from.push_back(ii);
+						}
+
+					bool joined = false;
+					if (!far_points.empty())
+					{
+						Solver back(WitnessSet(pure.GetSystem(), far).SliceMovingHomotopy(), far_points, tracker_setup_, num_threads_);
+						auto returned = MoveAll(back, base, far_points.size());
+						for (size_t jj = 0; jj < returned.size(); ++jj)
+						{
+							if (returned[jj].size()==0)
+								continue;
+							auto kk = Nearest(points, ToMultiple(returned[jj]));
+							if (kk < n && find(kk)!=find(from[jj]))
+							{
+								parent[find(kk)] = find(from[jj]);
+								joined = true;
+							}
+						}
+					}
+					num_stale = joined ? 0 : num_stale+1;
+				}
+
+				// the groups passing are components.  the rest are combined, fewest first.
+				std::vector<std::vector<size_t>> failing;
+				for (auto const& g : groups())
+					if (passes(g))
+						AddComponent(pure, g, true);
+					else
+						failing.push_back(g);
+
+				std::vector<size_t> left;
+				if (failing.size() <= settings_.max_num_combined_groups)
+				{
+					const unsigned num_failing = static_cast<unsigned>(failing.size());
+					unsigned long used = 0;
+					for (unsigned k = 2; k <= num_failing; ++k)
+						for (unsigned long mask = 0; mask < (1ul << num_failing); ++mask)
+						{
+							if ((mask & used) || Popcount(mask)!=k)
+								continue;
+							std::vector<size_t> combined;
+							for (unsigned ii = 0; ii < num_failing; ++ii)
+								if (mask & (1ul << ii))
+									combined.insert(combined.end(), failing[ii].begin(), failing[ii].end());
+							if (passes(combined))
+							{
+								AddComponent(pure, combined, true);
+								used |= mask;
+							}
+						}
+					for (unsigned ii = 0; ii < num_failing; ++ii)
+						if (!(used & (1ul << ii)))
+							left.insert(left.end(), failing[ii].begin(), failing[ii].end());
+				}
+				else
+					for (auto const& g : failing)
+						left.insert(left.end(), g.begin(), g.end());
+
+				if (!left.empty())
+					AddComponent(pure, left, false);
+			}
+
+
+			// the endpoints of moving the start points of a slice-moving solver to a slice, by start point, empty where the path failed.
+			std::vector<Vec<BaseComplexType>> MoveAll(Solver & solver, Vec<mpfr> const& parameters, size_t num_points)
+			{
+				Vec<BaseComplexType> target(parameters.size());
+				for (int ii = 0; ii < parameters.size(); ++ii)
+					target(ii) = static_cast<BaseComplexType>(parameters(ii));
+
+				solver.SetImplicitParameters(target);
+				solver.Solve();
+				num_paths_tracked_ += solver.Results().size();
+
+				std::vector<Vec<BaseComplexType>> endpoints(num_points);
+				for (auto const& r : solver.Results())
+					if (r.success==SuccessCode::Success)
+						endpoints[r.path] = r.solution;
+				return endpoints;
+			}
+
+
+			// the index of the point within the same point tolerance of x, or the number of points if none is.
+			size_t Nearest(std::vector<Vec<mpfr>> const& points, Vec<mpfr> const& x) const
+			{
+				using std::max;
+
+				size_t nearest = points.size();
+				BaseRealType best(0);
+				for (size_t ii = 0; ii < points.size(); ++ii)
+				{
+					BaseRealType distance((points[ii]-x).norm());
+					BaseRealType scale = max(BaseRealType(1), max(BaseRealType(points[ii].norm()), BaseRealType(x.norm())));
+					if (distance <= settings_.same_point_tolerance * scale && (nearest==points.size() || distance < best))
+					{
+						nearest = ii;
+						best = distance;
+					}
+				}
+				return nearest;
+			}
+
+
+			void AddComponent(WitnessSet const& pure, std::vector<size_t> group, bool verified)
+			{
+				std::sort(group.begin(), group.end());
+				std::vector<Vec<mpfr>> points;
+				for (auto ii : group)
+					points.push_back(pure.Points()[ii]);
+				components_.push_back(IrreducibleComponent{WitnessSet(pure.GetSystem(), pure.Slice(), points), verified});
+			}
+
+
+			static unsigned Popcount(unsigned long mask)
+			{
+				unsigned count = 0;
+				for (; mask; mask &= mask-1)
+					++count;
+				return count;
+			}
+
+			static Vec<mpfr> ToMultiple(Vec<mpfr> const& x)
+			{
+				return x;
+			}
+
+			static Vec<mpfr> ToMultiple(Vec<dbl> const& x)
+			{
+				Vec<mpfr> y(x.size());
+				for (int ii = 0; ii < x.size(); ++ii)
+					y(ii) = mpfr(x(ii).real(), x(ii).imag());
+				return y;
+			}
+
+			static Vec<BaseComplexType> ToBase(Vec<mpfr> const& x)
+			{
+				Vec<BaseComplexType> y(x.size());
+				for (int ii = 0; ii < x.size(); ++ii)
+					y(ii) = static_cast<BaseComplexType>(x(ii));
+				return y;
+			}
+
+
+			System target_;
+			VariableGroup variables_;
+			int max_degree_ = 0;
+			TrackerSetup tracker_setup_;
+			unsigned num_threads_;
+
+			config::Decomposition<BaseRealType> settings_;
+			config::TrackBack track_back_;
+			config::PostProcessing<BaseRealType> post_processing_;
+
+			std::vector<IrreducibleComponent> components_;
+			std::vector<WitnessSet> pure_witness_sets_;
+			std::vector<Vec<mpfr>> isolated_solutions_;
+			size_t num_junk_points_ = 0;
+			size_t num_paths_tracked_ = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
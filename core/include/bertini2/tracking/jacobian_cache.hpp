@@ -0,0 +1,160 @@
+//This file is part of Bertini 2.
+//
+//jacobian_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//jacobian_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with jacobian_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file jacobian_cache.hpp
+
+\brief Contains the JacobianCache type, through which the predictor and corrector of a tracker share Jacobian factorizations.
+*/
+
+#ifndef BERTINI_TRACKING_JACOBIAN_CACHE_HPP
+#define BERTINI_TRACKING_JACOBIAN_CACHE_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/memory_usage.hpp"
+#include <Eigen/LU>
+
+#include <tuple>
+
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief The most recently factored Jacobian of a step, tagged with the point, time, and precision at which it was evaluated.
+
+		A tracker owns one of these, and hands it to its predictor and corrector.  The predictor stores the Jacobian, time derivative, and LU factorization from the first stage of each prediction.  When a step fails and is retried from the same point with a smaller step size, the predictor finds them here instead of evaluating and factoring again.  In chord mode, the corrector starts from the predictor's factorization rather than making its own.
+
+		There is one entry for double and one for multiple precision.  A multiple precision entry only matches at the precision it was made, so changing precision implicitly invalidates it.  The tracker invalidates the cache at the start of each path, since the system may have been changed in between.
+		*/
+		class JacobianCache
+		{
+		public:
+
+			/**
+			\brief Whether the stored entry was made at exactly this point and time, at the current precision.
+			*/
+			template<typename ComplexType, typename Derived>
+			bool Matches(Eigen::MatrixBase<Derived> const& space, ComplexType const& time) const
+			{
+				auto const& e = std::get< Entry<ComplexType> >(entries_);
+				return e.valid && e.precision==Precision(time) && e.space.size()==space.size()
+				       && e.time==time && e.space==space;
+			}
+
+			/**
+			\brief Whether there is a factorization of the right size at the current precision, at any point.
+
+			\param num_variables The size of the Jacobian wanted.
+			\param precision The current precision.
+			*/
+			template<typename ComplexType>
+			bool HasFactorization(unsigned num_variables, unsigned precision) const
+			{
+				auto const& e = std::get< Entry<ComplexType> >(entries_);
+				return e.valid && e.precision==precision && e.space.size()==num_variables;
+			}
+
+			/**
+			\brief Remember the Jacobian and its factorization, replacing whatever was stored for this type.
+			*/
+			template<typename ComplexType, typename Derived>
+			void Store(Eigen::MatrixBase<Derived> const& space, ComplexType const& time,
+			           Mat<ComplexType> const& dh_dx, Vec<ComplexType> const& dh_dt,
+			           Eigen::PartialPivLU<Mat<ComplexType>> const& LU)
+			{
+				auto& e = std::get< Entry<ComplexType> >(entries_);
+				e.space = space;
+				e.time = time;
+				e.dh_dx = dh_dx;
+				e.dh_dt = dh_dt;
+				e.LU = LU;
+				e.precision = Precision(time);
+				e.valid = true;
+			}
+
+			template<typename ComplexType>
+			Mat<ComplexType> const& Jacobian() const
+			{
+				return std::get< Entry<ComplexType> >(entries_).dh_dx;
+			}
+
+			template<typename ComplexType>
+			Vec<ComplexType> const& TimeDerivative() const
+			{
+				return std::get< Entry<ComplexType> >(entries_).dh_dt;
+			}
+
+			template<typename ComplexType>
+			Eigen::PartialPivLU<Mat<ComplexType>> const& LU() const
+			{
+				return std::get< Entry<ComplexType> >(entries_).LU;
+			}
+
+			/**
+			\brief An estimate of the bytes held by the cache, at the current precision of its entries.
+			*/
+			std::size_t MemoryBytes() const
+			{
+				return sizeof(JacobianCache) + EntryHeapBytes(std::get< Entry<dbl> >(entries_)) + EntryHeapBytes(std::get< Entry<mpfr> >(entries_));
+			}
+
+			/**
+			\brief Forget both entries.
+			*/
+			void Invalidate()
+			{
+				std::get< Entry<dbl> >(entries_).valid = false;
+				std::get< Entry<mpfr> >(entries_).valid = false;
+			}
+
+		private:
+
+			template<typename ComplexType>
+			struct Entry
+			{
+				bool valid = false;
+				unsigned precision = 0;
+				Vec<ComplexType> space;
+				ComplexType time;
+				Mat<ComplexType> dh_dx;
+				Vec<ComplexType> dh_dt;
+				Eigen::PartialPivLU<Mat<ComplexType>> LU;
+			};
+
+			template<typename ComplexType>
+			static std::size_t EntryHeapBytes(Entry<ComplexType> const& e)
+			{
+				using memory::HeapBytes;
+				return HeapBytes(e.space) + HeapBytes(e.time) + HeapBytes(e.dh_dx) + HeapBytes(e.dh_dt) + HeapBytes(e.LU);
+			}
+
+			std::tuple< Entry<dbl>, Entry<mpfr> > entries_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,214 @@
+//This file is part of Bertini 2.
+//
+//lapack_lu.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//lapack_lu.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with lapack_lu.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file lapack_lu.hpp
+
+\brief Contains the LapackLU type, LU factorizations of large double precision matrices by the LAPACK found at configure time.
+*/
+
+#ifndef BERTINI_TRACKING_LAPACK_LU_HPP
+#define BERTINI_TRACKING_LAPACK_LU_HPP
+
+#include "bertini2/config.h"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <complex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef BERTINI_ENABLE_LAPACK
+extern "C" {
+	// the Fortran interface, with 32 bit integers, and the hidden lengths of the character arguments, as gfortran passes them
+	void zgetrf_(int const* m, int const* n, std::complex<double>* a, int const* lda, int* ipiv, int* info);
+	void zgetrs_(char const* trans, int const* n, int const* nrhs, std::complex<double> const* a, int const* lda, int const* ipiv, std::complex<double>* b, int const* ldb, int* info, std::size_t trans_length);
+
+	#ifdef HAVE_OPENBLAS_SET_NUM_THREADS
+	void openblas_set_num_threads(int num_threads);
+	#endif
+	#ifdef HAVE_MKL_SET_NUM_THREADS
+	void MKL_Set_Num_Threads(int num_threads);
+	#endif
+}
+#endif
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Set the number of threads the BLAS under LAPACK uses, where the installed one can be told to.
+
+		Does nothing unless Bertini2 was configured with LAPACK, and found OpenBLAS or MKL.  The setting is for the whole process.
+
+		\param num_threads The number of threads, at least 1.
+		*/
+		inline void LapackThreads(int num_threads)
+		{
+		#ifdef HAVE_OPENBLAS_SET_NUM_THREADS
+			openblas_set_num_threads(num_threads);
+		#endif
+		#ifdef HAVE_MKL_SET_NUM_THREADS
+			MKL_Set_Num_Threads(num_threads);
+		#endif
+			(void)num_threads;
+		}
+
+		/**
+		\brief Make the BLAS under LAPACK run on the calling thread only, where the installed one can be told to.
+
+		Called by ParallelSolver before tracking over several threads, each of which factors its own Jacobians, so the BLAS's own threads would only compete with them.  Does nothing unless Bertini2 was configured with LAPACK, and found OpenBLAS or MKL.  Link a sequential BLAS otherwise.
+		*/
+		inline void SequentialLapack()
+		{
+			LapackThreads(1);
+		}
+
+
+		/**
+		\brief The LU factorization with partial pivoting of a square double precision matrix, by LAPACK's zgetrf, and solves with it by zgetrs.
+
+		A tuned LAPACK and BLAS factor matrices of more than a few dozen variables several times faster than Eigen's kernel, and slower than it for smaller ones, so matrices are factored here only from a size up, config::Newton::lapack_threshold.  LAPACK is found by configuring with --with-lapack, which defines BERTINI_ENABLE_LAPACK.  zgetrf stores the factors and pivots as Eigen::PartialPivLU does, so the results are those of the Eigen factorization, up to rounding.
+
+		Only double precision is supported, and only when configured with LAPACK.  The other overloads exist so generic code compiles, and throw; see Handles.
+		*/
+		class LapackLU
+		{
+		public:
+
+			/**
+			\brief Whether square matrices of a number type and size are factored by a LapackLU, for a threshold on their size.
+			*/
+			template<typename NumT>
+			static bool Handles(Eigen::Index rows, Eigen::Index cols, unsigned threshold)
+			{
+			#ifdef BERTINI_ENABLE_LAPACK
+				return std::is_same<NumT,dbl>::value && rows==cols && rows >= 1 && rows >= static_cast<Eigen::Index>(threshold);
+			#else
+				return false;
+			#endif
+			}
+
+
+			/**
+			\brief Factor a matrix.
+
+			\return Whether the factorization succeeded, as LUPartialPivotDecompositionSuccessful.
+			\param J A square matrix.
+			*/
+			MatrixSuccessCode Compute(Mat<dbl> const& J)
+			{
+			#ifdef BERTINI_ENABLE_LAPACK
+				lu_ = J;
+				const int n = static_cast<int>(J.rows());
+				pivots_.resize(n);
+				int info = 0;
+				zgetrf_(&n, &n, lu_.data(), &n, pivots_.data(), &info);
+				if (info > 0) // an exactly zero pivot
+					return MatrixSuccessCode::SmallValue;
+				if (info < 0)
+					throw std::logic_error("zgetrf rejected argument " + std::to_string(-info));
+				return LUPartialPivotDecompositionSuccessful(lu_);
+			#else
+				throw std::logic_error("LapackLU used, but Bertini2 was configured without LAPACK");
+			#endif
+			}
+
+			MatrixSuccessCode Compute(Mat<mpfr> const& /*J*/)
+			{
+				throw std::logic_error("LapackLU factors only double precision matrices");
+			}
+
+
+			/**
+			\brief Solve with the factored matrix.  x is resized if need be.
+			*/
+			void Solve(Vec<dbl> & x, Vec<dbl> const& b) const
+			{
+				Solve(x, b, 'N');
+			}
+
+			void Solve(Vec<mpfr> & /*x*/, Vec<mpfr> const& /*b*/) const
+			{
+				throw std::logic_error("LapackLU solves only in double precision");
+			}
+
+
+			/**
+			\brief The norm of the inverse of the factored matrix, in the way chosen in the AMP settings, as amp::NormJInverse.
+			*/
+			double NormInverse(config::AdaptiveMultiplePrecisionConfig const& AMP_config) const
+			{
+				if (AMP_config.norm_J_inverse_estimator==config::NormJInverseEstimator::OneNorm)
+					return InverseOneNormEstimate<dbl>(Size(),
+						[this](Vec<dbl> const& b){ Vec<dbl> x; Solve(x, b, 'N'); return x; },
+						[this](Vec<dbl> const& b){ Vec<dbl> x; Solve(x, b, 'C'); return x; });
+
+				Vec<dbl> x;
+				Solve(x, RandomOfUnits<dbl>(Size()), 'N');
+				return x.norm();
+			}
+
+
+			/**
+			\brief The size of the factored matrix.  0 if none has been.
+			*/
+			Eigen::Index Size() const
+			{
+				return lu_.rows();
+			}
+
+			/**
+			\brief The bytes of the factors and pivots.
+			*/
+			std::size_t HeapBytes() const
+			{
+				return lu_.size()*sizeof(dbl) + pivots_.capacity()*sizeof(int);
+			}
+
+		private:
+
+			// with trans 'N', solve A x = b, and with 'C', A^* x = b
+			void Solve(Vec<dbl> & x, Vec<dbl> const& b, char trans) const
+			{
+			#ifdef BERTINI_ENABLE_LAPACK
+				x = b;
+				const int n = static_cast<int>(lu_.rows()), one = 1;
+				int info = 0;
+				zgetrs_(&trans, &n, &one, lu_.data(), &n, pivots_.data(), x.data(), &n, &info, 1);
+			#else
+				throw std::logic_error("LapackLU used, but Bertini2 was configured without LAPACK");
+			#endif
+			}
+
+			Mat<dbl> lu_; // the factors, as Eigen::PartialPivLU::matrixLU
+			std::vector<int> pivots_; // the row exchanged with each, from 1, as LAPACK numbers them
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
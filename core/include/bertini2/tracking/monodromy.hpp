@@ -0,0 +1,362 @@
+//This file is part of Bertini 2.
+//
+//monodromy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//monodromy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with monodromy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file monodromy.hpp
+
+\brief Contains the MonodromySolver type, for finding the solutions of a parametrized family of systems at generic parameters, from one, by tracking them around loops in parameter space.
+*/
+
+#ifndef BERTINI_TRACKING_MONODROMY_HPP
+#define BERTINI_TRACKING_MONODROMY_HPP
+
+#include "bertini2/parameter_homotopy.hpp"
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/detail/work_stealing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Finds the solutions of a parametrized family of systems at a base point of its parameter space, from a few known ones, by monodromy.
+
+		The solutions of the family at generic parameters are permuted by tracking them around loops in parameter space.  The solver keeps a graph of parameter points, each with the solutions found there, and every two points joined by a ParameterHomotopy each way, each bent by its own random gamma.  Each solution found at a point is tracked along every edge out of it, and each endpoint not yet known at the far point is added there, and tracked on in turn, until no edge gives anything new.  Then, if the target number of solutions is not reached, a point is added, see config::Monodromy.
+
+		Only as many paths are tracked as it takes to move the solutions around the graph, so a family with modestly many solutions is solved without the paths of a start system, whose count may be far larger, even when polyhedral.  The parameters are generic, so the paths end at nonsingular points, and no endgame is needed.
+
+		Tracking an endpoint on along the next edges is queued as soon as it is found, over a work-stealing pool, so the threads are kept busy without waiting for the edges to finish.  Each thread owns a copy of the homotopy of each edge, with its tracker, made once and kept between the parameter points added.
+
+		A base point with a known solution is usually made by choosing the solution at random, and solving for parameters which fit it, which is easy when the parameters enter linearly.
+
+		\code
+		MonodromySolver<AMPTracker> solver(family, base_parameters, {seed}, [](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+			});
+		solver.Solve();
+
+		for (auto const& s : solver.Solutions())
+			std::cout << s << std::endl;
+		\endcode
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		*/
+		template<class TrackerType>
+		class MonodromySolver
+		{
+		public:
+
+			using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			using TrackerSetup = std::function<void(TrackerType &)>;
+
+			/**
+			\brief Set up a solver for a family at a base point of its parameter space.
+
+			\param family The parametrized family, whose explicit parameters are the parameters, as for ParameterHomotopy.
+			\param base_parameters The parameters at which the solutions are wanted.
+			\param seed_solutions Solutions of the family at the base parameters, at least one.
+			\param tracker_setup Called once on each tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			MonodromySolver(System const& family, Vec<mpfr> const& base_parameters, std::vector<Vec<BaseComplexType>> const& seed_solutions, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				family_(family),
+				seed_solutions_(seed_solutions),
+				tracker_setup_(tracker_setup),
+				num_threads_(std::max(num_threads, 1u))
+			{
+				if (seed_solutions.empty())
+					throw std::runtime_error("monodromy needs at least one solution at the base parameters to start from");
+
+				points_.push_back(ParameterPoint{base_parameters, {}});
+			}
+
+
+			void SetSettings(config::Monodromy<BaseRealType> const& settings)
+			{
+				settings_ = settings;
+			}
+
+			config::Monodromy<BaseRealType> const& Settings() const
+			{
+				return settings_;
+			}
+
+
+			/**
+			\brief Track solutions around the graph until the target number of solutions is found at the base point, or the count stops growing.
+
+			May be called again, to carry on with the same graph, for instance after raising the number of stale points allowed.  Threads run at the default precision of the calling thread.  If tracking any path throws, the exception is rethrown here once all threads have stopped.
+			*/
+			void Solve()
+			{
+				if (workers_.empty())
+					for (unsigned ii = 0; ii < num_threads_; ++ii)
+						workers_.emplace_back(new Worker);
+
+				detail::WorkStealingQueues<PathTask> queues(num_threads_);
+				found_all_ = settings_.target_num_solutions > 0 && points_[0].solutions.size() >= settings_.target_num_solutions;
+
+				if (points_.size()==1)
+				{
+					while (points_.size() < std::max(settings_.num_parameter_points, 2u))
+						AddParameterPoint();
+					for (auto const& s : seed_solutions_)
+						AddSolution(0, s, queues);
+				}
+				RunTasks(queues);
+
+				unsigned num_stale = 0;
+				while (!found_all_ && num_stale < settings_.max_num_stale_points)
+				{
+					auto num_before = points_[0].solutions.size();
+
+					auto first_new_edge = edges_.size();
+					AddParameterPoint();
+					for (size_t ii = first_new_edge; ii < edges_.size(); ++ii)
+						for (auto const& s : points_[edges_[ii].from].solutions)
+							queues.Push(static_cast<unsigned>(ii % num_threads_), PathTask{ii, s});
+					RunTasks(queues);
+
+					num_stale = (points_[0].solutions.size()==num_before) ? num_stale+1 : 0;
+				}
+			}
+
+
+			/**
+			\brief The distinct solutions found at the base parameters.
+			*/
+			std::vector<Vec<BaseComplexType>> const& Solutions() const
+			{
+				return points_[0].solutions;
+			}
+
+			/**
+			\brief The number of points in the graph, including the base point.
+			*/
+			size_t NumParameterPoints() const
+			{
+				return points_.size();
+			}
+
+			/**
+			\brief The parameters of a point of the graph.  The base point is 0.
+			*/
+			Vec<mpfr> const& Parameters(size_t point) const
+			{
+				return points_[point].parameters;
+			}
+
+			/**
+			\brief The distinct solutions found at a point of the graph.  The base point is 0.
+			*/
+			std::vector<Vec<BaseComplexType>> const& Solutions(size_t point) const
+			{
+				return points_[point].solutions;
+			}
+
+			/**
+			\brief The number of paths tracked, over all Solves.
+			*/
+			size_t NumPathsTracked() const
+			{
+				return num_paths_tracked_;
+			}
+
+			/**
+			\brief The number of paths tracked which failed, over all Solves.
+			*/
+			size_t NumPathFailures() const
+			{
+				return num_path_failures_;
+			}
+
+			unsigned NumThreads() const
+			{
+				return num_threads_;
+			}
+
+		private:
+
+			/**
+			A point of parameter space, and the solutions found there.
+			*/
+			struct ParameterPoint
+			{
+				Vec<mpfr> parameters;
+				std::vector<Vec<BaseComplexType>> solutions;
+			};
+
+			/**
+			A homotopy from one point to another.
+			*/
+			struct Edge
+			{
+				size_t from;
+				size_t to;
+				std::shared_ptr<ParameterHomotopy> homotopy;
+			};
+
+			/**
+			Tracking a solution at the start of an edge to its end.
+			*/
+			struct PathTask
+			{
+				size_t edge;
+				Vec<BaseComplexType> start;
+			};
+
+			/**
+			A thread's copy of the homotopy of an edge, and its tracker, which refers to it.
+			*/
+			struct EdgeTracker
+			{
+				System homotopy;
+				std::unique_ptr<TrackerType> tracker;
+			};
+
+			/**
+			The objects owned by each thread, one per edge.
+			*/
+			struct Worker
+			{
+				std::vector< std::unique_ptr<EdgeTracker> > edges;
+			};
+
+
+			// a random point, joined each way to every point already in the graph.  done on the calling thread, since cloning reads the shared homotopies.
+			void AddParameterPoint()
+			{
+				auto num_parameters = points_[0].parameters.size();
+				points_.push_back(ParameterPoint{RandomOfUnits<mpfr>(num_parameters), {}});
+				auto added = points_.size()-1;
+
+				for (size_t ii = 0; ii < added; ++ii)
+				{
+					AddEdge(ii, added);
+					AddEdge(added, ii);
+				}
+			}
+
+
+			void AddEdge(size_t from, size_t to)
+			{
+				auto homotopy = std::make_shared<ParameterHomotopy>(family_, points_[from].parameters);
+				edges_.push_back(Edge{from, to, homotopy});
+
+				auto const& target = points_[to].parameters;
+				for (auto& w : workers_)
+				{
+					std::unique_ptr<EdgeTracker> e(new EdgeTracker);
+					e->homotopy = Clone(homotopy->Homotopy());
+					e->homotopy.SetImplicitParameters(target);
+					e->homotopy.SetImplicitParameters(Vec<dbl>(target.template cast<dbl>()));
+					e->tracker.reset(new TrackerType(e->homotopy));
+					tracker_setup_(*e->tracker);
+					w->edges.push_back(std::move(e));
+				}
+			}
+
+
+			// add a solution to a point if it is new there, and queue tracking it along every edge out of the point.
+			void AddSolution(size_t point, Vec<BaseComplexType> const& solution, detail::WorkStealingQueues<PathTask> & queues, unsigned worker = 0)
+			{
+				using std::max;
+				{
+					std::lock_guard<std::mutex> lock(solutions_mutex_);
+					auto& known = points_[point].solutions;
+					for (auto const& s : known)
+						if ((s-solution).norm() <= settings_.same_point_tolerance * max(BaseRealType(1), max(s.norm(), solution.norm())))
+							return;
+					known.push_back(solution);
+
+					if (point==0 && known.size()==settings_.target_num_solutions)
+						found_all_ = true;
+					if (found_all_)
+						return;
+				}
+
+				for (size_t ii = 0; ii < edges_.size(); ++ii)
+					if (edges_[ii].from==point)
+						queues.Push(worker, PathTask{ii, solution});
+			}
+
+
+			void RunTasks(detail::WorkStealingQueues<PathTask> & queues)
+			{
+				auto precision = DefaultPrecision();
+
+				detail::RunWorkStealing<PathTask>(queues, [this, precision, &queues](unsigned worker, PathTask const& task)
+					{
+						DefaultPrecision(precision);
+						if (found_all_)
+							return;
+
+						auto& e = *workers_[worker]->edges[task.edge];
+						Vec<BaseComplexType> endpoint;
+						auto success = e.tracker->TrackPath(endpoint, BaseComplexType(1), BaseComplexType(0), task.start);
+
+						{
+							std::lock_guard<std::mutex> lock(solutions_mutex_);
+							++num_paths_tracked_;
+							if (success!=SuccessCode::Success)
+								++num_path_failures_;
+						}
+
+						if (success==SuccessCode::Success)
+							AddSolution(edges_[task.edge].to, endpoint, queues, worker);
+					});
+			}
+
+
+			System family_; ///< The parametrized family, from which the homotopy of each edge is made.
+			std::vector<Vec<BaseComplexType>> seed_solutions_; ///< The solutions known at the base point, from which the first Solve starts.
+			TrackerSetup tracker_setup_;
+			unsigned num_threads_;
+			config::Monodromy<BaseRealType> settings_;
+
+			std::vector<ParameterPoint> points_; ///< The points of the graph, the base point first.
+			std::vector<Edge> edges_; ///< The homotopies between the points, only added between runs of the threads.
+			std::vector< std::unique_ptr<Worker> > workers_;
+
+			std::mutex solutions_mutex_; ///< Guards the solutions of the points, and the counts of paths.
+			std::atomic<bool> found_all_{false}; ///< Whether the target number of solutions has been found at the base point, so the queued paths are skipped.
+			size_t num_paths_tracked_ = 0;
+			size_t num_path_failures_ = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,524 @@
+//This file is part of Bertini 2.
+//
+//multiprecision_lu.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//multiprecision_lu.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with multiprecision_lu.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file multiprecision_lu.hpp
+
+\brief Contains the MultiprecisionLU type, a blocked LU factorization of multiple precision matrices, stored contiguously at a fixed precision.
+*/
+
+#ifndef BERTINI_TRACKING_MULTIPRECISION_LU_HPP
+#define BERTINI_TRACKING_MULTIPRECISION_LU_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/detail/thread_team.hpp"
+
+#include <mpfr.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief The LU factorization with partial pivoting of a square multiple precision matrix, with its factors in one contiguous buffer of limbs at the precision of the matrix.
+
+		Eigen::PartialPivLU on Mat<mpfr> runs Eigen's generic kernel, in which every product makes temporaries, on a matrix whose entries each point to their own limbs elsewhere on the heap.  Here the real and imaginary parts of the entries are MPFR numbers set up with MPFR's custom interface, their limbs row after row in one buffer made once per size and precision, and the updates of the factorization are fused multiply-subtracts done in place on them, rounded once each where the installed MPFR has mpfr_fmms.  Rows are pivoted by exchanging the headers of the numbers, not their limbs.
+
+		The factorization is right-looking and blocked: each panel of BlockSize columns is factored, the rows of U to its right are solved for, and the rest of the matrix is updated tile by tile, so the limbs of a tile are reused from cache for every column of the panel.  The pivots are those of Eigen::PartialPivLU, the entry of largest magnitude in the column, so the factors are the same up to rounding.
+
+		Only multiple precision is supported.  The overloads for double precision exist so generic code compiles, and throw; see Handles.  Solves use workspace held in the factorization, so one factorization must not be solved with from several threads at once.
+		*/
+		class MultiprecisionLU
+		{
+		public:
+
+			static constexpr Eigen::Index BlockSize = 16;
+
+			/**
+			\brief Whether matrices of a number type and shape can be factored by a MultiprecisionLU.
+			*/
+			template<typename NumT>
+			static bool Handles(Eigen::Index rows, Eigen::Index cols)
+			{
+				return std::is_same<NumT,mpfr>::value && rows==cols && rows >= 1;
+			}
+
+
+			MultiprecisionLU() = default;
+			MultiprecisionLU(MultiprecisionLU &&) = default; // moving the buffers keeps their addresses, so the headers stay valid
+			MultiprecisionLU& operator=(MultiprecisionLU &&) = default;
+
+			MultiprecisionLU(MultiprecisionLU const& other) : size_(other.size_), precision_(other.precision_), limbs_per_number_(other.limbs_per_number_), limbs_(other.limbs_), numbers_(other.numbers_), permutation_(other.permutation_), num_scratch_sets_(other.num_scratch_sets_), team_(other.team_)
+			{
+				// point the copied headers at the copied limbs
+				for (std::size_t ii = 0; ii < numbers_.size(); ++ii)
+				{
+					auto offset = static_cast<mp_limb_t const*>(mpfr_custom_get_significand(&other.numbers_[ii])) - other.limbs_.data();
+					mpfr_custom_move(&numbers_[ii], limbs_.data() + offset);
+				}
+			}
+
+			MultiprecisionLU& operator=(MultiprecisionLU const& other)
+			{
+				MultiprecisionLU copy(other);
+				return *this = std::move(copy);
+			}
+
+
+			/**
+			\brief Factor a matrix, at the precision of its first entry.
+
+			The buffer is made again only if the size or precision differs from the last factorization.
+
+			\return Whether the factorization succeeded, by the tests of LUPartialPivotDecompositionSuccessful.
+			\param A A square matrix, all of whose entries are at one precision.
+			*/
+			MatrixSuccessCode Compute(Mat<mpfr> const& A)
+			{
+				if (!Handles<mpfr>(A.rows(), A.cols()))
+					throw std::logic_error("MultiprecisionLU factors only non-empty square matrices");
+
+				Allocate(A.rows(), A(0,0).precision());
+				const auto n = size_;
+
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					permutation_[ii] = ii;
+					for (Eigen::Index jj = 0; jj < n; ++jj)
+					{
+						mpfr_set(Re(ii,jj), A(ii,jj).real().backend().data(), MPFR_RNDN);
+						mpfr_set(Im(ii,jj), A(ii,jj).imag().backend().data(), MPFR_RNDN);
+					}
+				}
+
+				if (team_ && team_->NumThreads() > 1 && n >= 2*BlockSize)
+					ComputeBlocks(*team_);
+				else
+					for (Eigen::Index kb = 0; kb < n; kb += BlockSize)
+					{
+						const auto ke = std::min(kb + BlockSize, n);
+
+						FactorPanel(kb, ke);
+						if (ke==n)
+							break;
+
+						UpdateRowsOfU(kb, ke, ke, n);
+						for (Eigen::Index ib = ke; ib < n; ib += BlockSize)
+							for (Eigen::Index jb = ke; jb < n; jb += BlockSize)
+								UpdateTile(kb, ke, ib, jb);
+					}
+
+				return CheckPivots();
+			}
+
+			MatrixSuccessCode Compute(Mat<dbl> const& /*A*/)
+			{
+				throw std::logic_error("MultiprecisionLU factors only multiple precision matrices");
+			}
+
+
+			/**
+			\brief Solve \f$A x = b\f$ with the factored matrix.  x is resized if need be, and is at the precision of the factorization.
+			*/
+			void Solve(Vec<mpfr> & x, Vec<mpfr> const& b) const
+			{
+				const auto n = size_;
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					mpfr_set(WorkRe(ii), b(permutation_[ii]).real().backend().data(), MPFR_RNDN);
+					mpfr_set(WorkIm(ii), b(permutation_[ii]).imag().backend().data(), MPFR_RNDN);
+				}
+
+				for (Eigen::Index ii = 1; ii < n; ++ii)
+					for (Eigen::Index k = 0; k < ii; ++k)
+						SubtractProduct(WorkRe(ii), WorkIm(ii), Re(ii,k), Im(ii,k), WorkRe(k), WorkIm(k));
+
+				for (Eigen::Index ii = n-1; ii >= 0; --ii)
+				{
+					for (Eigen::Index k = ii+1; k < n; ++k)
+						SubtractProduct(WorkRe(ii), WorkIm(ii), Re(ii,k), Im(ii,k), WorkRe(k), WorkIm(k));
+					MultiplyInPlace(WorkRe(ii), WorkIm(ii), ReciprocalRe(ii), ReciprocalIm(ii));
+				}
+
+				CopyOut(x, [](Eigen::Index ii){ return ii; });
+			}
+
+			void Solve(Vec<dbl> & /*x*/, Vec<dbl> const& /*b*/) const
+			{
+				throw std::logic_error("MultiprecisionLU solves only in multiple precision");
+			}
+
+
+			/**
+			\brief Solve \f$A^* x = b\f$ with the factored matrix.  x is resized if need be, and is at the precision of the factorization.
+
+			PA = LU, so \f$A^* = U^* L^* P\f$.
+			*/
+			void SolveAdjoint(Vec<mpfr> & x, Vec<mpfr> const& b) const
+			{
+				const auto n = size_;
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					mpfr_set(WorkRe(ii), b(ii).real().backend().data(), MPFR_RNDN);
+					mpfr_set(WorkIm(ii), b(ii).imag().backend().data(), MPFR_RNDN);
+				}
+
+				// the conjugates of the entries of U and L are their transposes' in the adjoint, so the products are conjugated
+				for (Eigen::Index ii = 0; ii < n; ++ii)
+				{
+					for (Eigen::Index k = 0; k < ii; ++k)
+						SubtractProduct(WorkRe(ii), WorkIm(ii), Re(k,ii), Im(k,ii), WorkRe(k), WorkIm(k), true);
+					// dividing by the conjugate of the pivot is multiplying by the conjugate of its reciprocal
+					MultiplyInPlace(WorkRe(ii), WorkIm(ii), ReciprocalRe(ii), ReciprocalIm(ii), true);
+				}
+
+				for (Eigen::Index ii = n-2; ii >= 0; --ii)
+					for (Eigen::Index k = ii+1; k < n; ++k)
+						SubtractProduct(WorkRe(ii), WorkIm(ii), Re(k,ii), Im(k,ii), WorkRe(k), WorkIm(k), true);
+
+				CopyOut(x, [this](Eigen::Index ii){ return permutation_[ii]; });
+			}
+
+			void SolveAdjoint(Vec<dbl> & /*x*/, Vec<dbl> const& /*b*/) const
+			{
+				throw std::logic_error("MultiprecisionLU solves only in multiple precision");
+			}
+
+
+			/**
+			\brief The norm of the inverse of the factored matrix, in the way chosen in the AMP settings, as amp::NormJInverse.
+			*/
+			mpfr_float NormInverse(config::AdaptiveMultiplePrecisionConfig const& AMP_config) const
+			{
+				if (AMP_config.norm_J_inverse_estimator==config::NormJInverseEstimator::OneNorm)
+					return InverseOneNormEstimate<mpfr>(size_,
+						[this](Vec<mpfr> const& b){ Vec<mpfr> x; Solve(x, b); return x; },
+						[this](Vec<mpfr> const& b){ Vec<mpfr> x; SolveAdjoint(x, b); return x; });
+
+				Vec<mpfr> x;
+				Solve(x, RandomOfUnits<mpfr>(size_));
+				return x.norm();
+			}
+
+
+			/**
+			\brief Share factorizations among a team of threads, or stop doing so.
+
+			Matrices of at least twice BlockSize rows are then factored by the team: the first thread factors each panel, and the threads share the columns of the rows of U to its right and the tiles of the rest of the matrix.  The factors are the same as without the team, as each entry is updated by the same operations in the same order.  Solves remain serial.
+
+			\param team The threads, or nullptr to factor in the calling thread.
+			*/
+			void SetThreadTeam(std::shared_ptr<detail::ThreadTeam> const& team)
+			{
+				team_ = team;
+			}
+
+			/**
+			\brief The size of the factored matrix.  0 if none has been.
+			*/
+			Eigen::Index Size() const
+			{
+				return size_;
+			}
+
+			/**
+			\brief The precision of the factorization, that of the matrix factored.
+			*/
+			unsigned Precision() const
+			{
+				return precision_;
+			}
+
+			/**
+			\brief The bytes of the buffer of limbs, the headers of the numbers in it, and the permutation.
+			*/
+			std::size_t HeapBytes() const
+			{
+				return limbs_.capacity()*sizeof(mp_limb_t) + numbers_.capacity()*sizeof(__mpfr_struct) + permutation_.capacity()*sizeof(Eigen::Index);
+			}
+
+		private:
+
+			// the numbers are, in order: the real and imaginary parts of the factors, row by row, of the reciprocals of the pivots, of the workspace for solves, and the scratch, a set for each thread of the team
+			static constexpr std::size_t NumScratch = 3;
+
+			void Allocate(Eigen::Index size, unsigned precision)
+			{
+				const unsigned num_scratch_sets = team_ ? team_->NumThreads() : 1;
+				if (size==size_ && precision==precision_ && num_scratch_sets <= num_scratch_sets_)
+					return;
+
+				size_ = size;
+				precision_ = precision;
+				num_scratch_sets_ = num_scratch_sets;
+				permutation_.resize(size);
+
+				const std::size_t num_numbers = 2*size*size + 4*size + NumScratch*num_scratch_sets;
+				limbs_per_number_ = (mpfr_custom_get_size(precision) + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t);
+				limbs_.assign(num_numbers*limbs_per_number_, 0);
+				numbers_.resize(num_numbers);
+				for (std::size_t ii = 0; ii < num_numbers; ++ii)
+				{
+					mp_limb_t * significand = limbs_.data() + ii*limbs_per_number_;
+					mpfr_custom_init(significand, precision);
+					mpfr_custom_init_set(&numbers_[ii], MPFR_ZERO_KIND, 0, precision, significand);
+				}
+			}
+
+			mpfr_ptr Re(Eigen::Index ii, Eigen::Index jj) const { return &numbers_[2*(ii*size_ + jj)]; }
+			mpfr_ptr Im(Eigen::Index ii, Eigen::Index jj) const { return &numbers_[2*(ii*size_ + jj) + 1]; }
+			mpfr_ptr ReciprocalRe(Eigen::Index ii) const { return &numbers_[2*size_*size_ + 2*ii]; }
+			mpfr_ptr ReciprocalIm(Eigen::Index ii) const { return &numbers_[2*size_*size_ + 2*ii + 1]; }
+			mpfr_ptr WorkRe(Eigen::Index ii) const { return &numbers_[2*size_*size_ + 2*size_ + 2*ii]; }
+			mpfr_ptr WorkIm(Eigen::Index ii) const { return &numbers_[2*size_*size_ + 2*size_ + 2*ii + 1]; }
+			mpfr_ptr Scratch(unsigned ii, unsigned thread = 0) const { return &numbers_[2*size_*size_ + 4*size_ + thread*NumScratch + ii]; }
+
+
+			// a*b + c*d, and a*b - c*d, rounded once where the installed MPFR can.  Scratch(2) of the thread is used otherwise.
+			void Fmma(mpfr_ptr result, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c, mpfr_srcptr d, unsigned thread = 0) const
+			{
+			#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+				mpfr_fmma(result, a, b, c, d, MPFR_RNDN);
+			#else
+				mpfr_mul(Scratch(2, thread), c, d, MPFR_RNDN);
+				mpfr_fma(result, a, b, Scratch(2, thread), MPFR_RNDN);
+			#endif
+			}
+
+			void Fmms(mpfr_ptr result, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c, mpfr_srcptr d, unsigned thread = 0) const
+			{
+			#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+				mpfr_fmms(result, a, b, c, d, MPFR_RNDN);
+			#else
+				mpfr_mul(Scratch(2, thread), c, d, MPFR_RNDN);
+				mpfr_fms(result, a, b, Scratch(2, thread), MPFR_RNDN);
+			#endif
+			}
+
+			// c -= a*b, or c -= conj(a)*b
+			void SubtractProduct(mpfr_ptr c_re, mpfr_ptr c_im, mpfr_srcptr a_re, mpfr_srcptr a_im, mpfr_srcptr b_re, mpfr_srcptr b_im, bool conjugate = false, unsigned thread = 0) const
+			{
+				mpfr_ptr t = Scratch(0, thread);
+				if (conjugate)
+					Fmma(t, a_re, b_re, a_im, b_im, thread);
+				else
+					Fmms(t, a_re, b_re, a_im, b_im, thread);
+				mpfr_sub(c_re, c_re, t, MPFR_RNDN);
+
+				if (conjugate)
+					Fmms(t, a_re, b_im, a_im, b_re, thread);
+				else
+					Fmma(t, a_re, b_im, a_im, b_re, thread);
+				mpfr_sub(c_im, c_im, t, MPFR_RNDN);
+			}
+
+			// a *= b, or a *= conj(b)
+			void MultiplyInPlace(mpfr_ptr a_re, mpfr_ptr a_im, mpfr_srcptr b_re, mpfr_srcptr b_im, bool conjugate = false, unsigned thread = 0) const
+			{
+				mpfr_ptr t = Scratch(0, thread);
+				if (conjugate)
+				{
+					Fmma(t, a_re, b_re, a_im, b_im, thread);
+					Fmms(a_im, a_im, b_re, a_re, b_im, thread);
+				}
+				else
+				{
+					Fmms(t, a_re, b_re, a_im, b_im, thread);
+					Fmma(a_im, a_re, b_im, a_im, b_re, thread);
+				}
+				mpfr_set(a_re, t, MPFR_RNDN);
+			}
+
+			// |a|^2
+			void Abs2(mpfr_ptr result, mpfr_srcptr a_re, mpfr_srcptr a_im) const
+			{
+				Fmma(result, a_re, a_re, a_im, a_im);
+			}
+
+
+			// choose the row of the largest entry in column k, on or below the diagonal, exchange it with row k, and invert the pivot.  false if the column is zero there.
+			bool Pivot(Eigen::Index k)
+			{
+				mpfr_ptr largest = Scratch(1), candidate = Scratch(0);
+				Eigen::Index pivot_row = k;
+				Abs2(largest, Re(k,k), Im(k,k));
+				for (Eigen::Index ii = k+1; ii < size_; ++ii)
+				{
+					Abs2(candidate, Re(ii,k), Im(ii,k));
+					if (mpfr_greater_p(candidate, largest))
+					{
+						mpfr_set(largest, candidate, MPFR_RNDN);
+						pivot_row = ii;
+					}
+				}
+
+				if (pivot_row!=k)
+				{
+					std::swap_ranges(Re(k,0), Re(k,0) + 2*size_, Re(pivot_row,0));
+					std::swap(permutation_[k], permutation_[pivot_row]);
+				}
+
+				// 1/p = conj(p)/|p|^2
+				if (mpfr_zero_p(largest))
+				{
+					mpfr_set_zero(ReciprocalRe(k), 1);
+					mpfr_set_zero(ReciprocalIm(k), 1);
+					return false;
+				}
+				mpfr_div(ReciprocalRe(k), Re(k,k), largest, MPFR_RNDN);
+				mpfr_div(ReciprocalIm(k), Im(k,k), largest, MPFR_RNDN);
+				mpfr_neg(ReciprocalIm(k), ReciprocalIm(k), MPFR_RNDN);
+				return true;
+			}
+
+
+			// factor the panel of columns kb to ke, unblocked
+			void FactorPanel(Eigen::Index kb, Eigen::Index ke)
+			{
+				for (Eigen::Index k = kb; k < ke; ++k)
+				{
+					if (!Pivot(k))
+						continue; // as Eigen, leave the column, and let the test of the pivots fail
+
+					for (Eigen::Index ii = k+1; ii < size_; ++ii)
+						MultiplyInPlace(Re(ii,k), Im(ii,k), ReciprocalRe(k), ReciprocalIm(k));
+					for (Eigen::Index ii = k+1; ii < size_; ++ii)
+						for (Eigen::Index jj = k+1; jj < ke; ++jj)
+							SubtractProduct(Re(ii,jj), Im(ii,jj), Re(ii,k), Im(ii,k), Re(k,jj), Im(k,jj));
+				}
+			}
+
+			// columns jb to je of the rows of U right of the panel kb to ke, by the unit lower triangle of the panel
+			void UpdateRowsOfU(Eigen::Index kb, Eigen::Index ke, Eigen::Index jb, Eigen::Index je, unsigned thread = 0)
+			{
+				for (Eigen::Index k = kb; k < ke; ++k)
+					for (Eigen::Index ii = k+1; ii < ke; ++ii)
+						for (Eigen::Index jj = jb; jj < je; ++jj)
+							SubtractProduct(Re(ii,jj), Im(ii,jj), Re(ii,k), Im(ii,k), Re(k,jj), Im(k,jj), false, thread);
+			}
+
+			// the tile of the trailing matrix at ib, jb, by the panel kb to ke
+			void UpdateTile(Eigen::Index kb, Eigen::Index ke, Eigen::Index ib, Eigen::Index jb, unsigned thread = 0)
+			{
+				const auto ie = std::min(ib + BlockSize, size_), je = std::min(jb + BlockSize, size_);
+				for (Eigen::Index ii = ib; ii < ie; ++ii)
+					for (Eigen::Index k = kb; k < ke; ++k)
+						for (Eigen::Index jj = jb; jj < je; ++jj)
+							SubtractProduct(Re(ii,jj), Im(ii,jj), Re(ii,k), Im(ii,k), Re(k,jj), Im(k,jj), false, thread);
+			}
+
+			// the blocked factorization, its updates shared among a team
+			void ComputeBlocks(detail::ThreadTeam & team)
+			{
+				const auto n = size_;
+				const auto num_threads = team.NumThreads();
+				team.Run([&](unsigned thread)
+					{
+						for (Eigen::Index kb = 0; kb < n; kb += BlockSize)
+						{
+							const auto ke = std::min(kb + BlockSize, n);
+
+							if (thread==0)
+								FactorPanel(kb, ke);
+							team.Sync();
+							if (ke==n)
+								break;
+
+							for (Eigen::Index jb = ke + thread*BlockSize; jb < n; jb += num_threads*BlockSize)
+								UpdateRowsOfU(kb, ke, jb, std::min(jb + BlockSize, n), thread);
+							team.Sync();
+
+							const auto num_tiles = (n - ke + BlockSize - 1) / BlockSize;
+							for (Eigen::Index t = thread; t < num_tiles*num_tiles; t += num_threads)
+								UpdateTile(kb, ke, ke + (t / num_tiles)*BlockSize, ke + (t % num_tiles)*BlockSize, thread);
+							team.Sync();
+						}
+					});
+			}
+
+
+			// the tests of LUPartialPivotDecompositionSuccessful, on the diagonal of U
+			MatrixSuccessCode CheckPivots() const
+			{
+				Vec<mpfr> pivots(size_);
+				for (Eigen::Index ii = 0; ii < size_; ++ii)
+				{
+					pivots(ii).precision(precision_);
+					// the parts are members of pivots(ii), which is not const
+					mpfr_set(const_cast<mpfr_float&>(pivots(ii).real()).backend().data(), Re(ii,ii), MPFR_RNDN);
+					mpfr_set(const_cast<mpfr_float&>(pivots(ii).imag()).backend().data(), Im(ii,ii), MPFR_RNDN);
+				}
+
+				for (Eigen::Index ii = size_-1; ii > 0; --ii)
+				{
+					if (IsSmallValue(pivots(ii)))
+						return MatrixSuccessCode::SmallValue;
+					if (IsLargeChange(pivots(ii-1), pivots(ii)))
+						return MatrixSuccessCode::LargeChange;
+				}
+				if (IsSmallValue(pivots(0)))
+					return MatrixSuccessCode::SmallValue;
+				return MatrixSuccessCode::Success;
+			}
+
+
+			// x(index(ii)) = the workspace's ii-th entry
+			template<typename IndexF>
+			void CopyOut(Vec<mpfr> & x, IndexF index) const
+			{
+				if (x.size()!=size_)
+					x.resize(size_);
+				for (Eigen::Index ii = 0; ii < size_; ++ii)
+				{
+					mpfr & z = x(index(ii));
+					if (z.precision()!=precision_)
+						z.precision(precision_);
+					// the parts are members of z, which is not const
+					mpfr_set(const_cast<mpfr_float&>(z.real()).backend().data(), WorkRe(ii), MPFR_RNDN);
+					mpfr_set(const_cast<mpfr_float&>(z.imag()).backend().data(), WorkIm(ii), MPFR_RNDN);
+				}
+			}
+
+
+			Eigen::Index size_ = 0;
+			unsigned precision_ = 0;
+			std::size_t limbs_per_number_ = 0;
+			mutable std::vector<mp_limb_t> limbs_; // the significands of all the numbers, each limbs_per_number_ long.  Written by solves
+			mutable std::vector<__mpfr_struct> numbers_; // their headers, pointing into limbs_.  Written by solves
+			std::vector<Eigen::Index> permutation_; // row ii of the factors is row permutation_[ii] of the matrix
+			unsigned num_scratch_sets_ = 0; // the sets of scratch numbers, one per thread of the team
+			std::shared_ptr<detail::ThreadTeam> team_; // the threads sharing factorizations, if any
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
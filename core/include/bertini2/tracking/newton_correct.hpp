@@ -62,6 +62,8 @@ namespace bertini{
 			\param path_truncation_threshold Correcting stops the the norm of the current solution exceeds this number.
 			\param min_num_newton_iterations The corrector must take at least this many steps.  This should be at least 1.
 			\param max_num_newton_iterations The maximum number of iterations to run Newton's method for.
+			\param use_chord Whether to reuse the Jacobian and its LU factorization across iterations, refactoring only when the steps stop contracting by chord_max_contraction.
+			\param chord_max_contraction With use_chord, refactor when a step is longer than this fraction of the one before it.
 
 			*/
 			template <typename ComplexType, typename RealType>
@@ -71,7 +73,9 @@ namespace bertini{
 					               ComplexType const& current_time, 
 					               RealType const& tracking_tolerance,
 					               unsigned min_num_newton_iterations,
-					               unsigned max_num_newton_iterations)
+					               unsigned max_num_newton_iterations,
+					               bool use_chord = false,
+					               double chord_max_contraction = 0.5)
 			{
 				#ifndef BERTINI_DISABLE_ASSERTS
 				assert(max_num_newton_iterations >= min_num_newton_iterations && "max number newton iterations must be at least the min.");
@@ -79,19 +83,30 @@ namespace bertini{
 
 
 				next_space = current_space;
+				Mat<ComplexType> J;
+				Eigen::PartialPivLU< Mat<ComplexType> > LU;
+				bool refactor = true;
+				RealType previous_norm_delta_z(0);
 				for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 				{
 					auto f = S.Eval(next_space, current_time);
-					auto J = S.Jacobian(next_space, current_time);
-					auto LU = J.lu();
+					if (refactor || !use_chord)
+					{
+						J = S.Jacobian(next_space, current_time);
+						LU = J.lu();
 
-					if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
-						return SuccessCode::MatrixSolveFailure;
+						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+					}
 
-					auto delta_z = LU.solve(-f);
+					Vec<ComplexType> delta_z = LU.solve(-f);
 					next_space += delta_z;
 
-					if ( (delta_z.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+					RealType norm_delta_z = delta_z.norm();
+					refactor = ii > 0 && norm_delta_z > previous_norm_delta_z * RealType(chord_max_contraction);
+					previous_norm_delta_z = norm_delta_z;
+
+					if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 						return SuccessCode::Success;
 				}
 
@@ -118,6 +133,8 @@ namespace bertini{
 			\param min_num_newton_iterations The corrector must take at least this many steps.  This should be at least 1.
 			\param max_num_newton_iterations The maximum number of iterations to run Newton's method for.
 			\param AMP_config Adaptive multiple precision settings.  Using this argument is how Bertini2 knows you want to use adaptive precision.
+			\param use_chord Whether to reuse the Jacobian and its LU factorization across iterations, refactoring only when the steps stop contracting by chord_max_contraction.  The AMP criteria are checked against the Jacobian actually used.
+			\param chord_max_contraction With use_chord, refactor when a step is longer than this fraction of the one before it.
 			*/
 			template <typename ComplexType, typename RealType>
 			SuccessCode NewtonLoop(Vec<ComplexType> & next_space,
@@ -127,7 +144,9 @@ namespace bertini{
 					               RealType const& tracking_tolerance,
 					               unsigned min_num_newton_iterations,
 					               unsigned max_num_newton_iterations,
-					               config::AdaptiveMultiplePrecisionConfig const& AMP_config)
+					               config::AdaptiveMultiplePrecisionConfig const& AMP_config,
+					               bool use_chord = false,
+					               double chord_max_contraction = 0.5)
 			{
 				#ifndef BERTINI_DISABLE_ASSERTS
 				assert(max_num_newton_iterations >= min_num_newton_iterations && "max number newton iterations must be at least the min.");
@@ -135,25 +154,39 @@ namespace bertini{
 
 
 				next_space = current_space;
+				Mat<ComplexType> J;
+				Eigen::PartialPivLU< Mat<ComplexType> > LU;
+				RealType norm_J_inverse;
+				bool refactor = true;
+				RealType previous_norm_delta_z(0);
 				for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 				{
 					//TODO: wrap these into a single line.
 					auto f = S.Eval(next_space, current_time);
-					auto J = S.Jacobian(next_space, current_time);
-					auto LU = J.lu();
+					bool refactored = refactor || !use_chord;
+					if (refactored)
+					{
+						J = S.Jacobian(next_space, current_time);
+						LU = J.lu();
 
-					if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
-						return SuccessCode::MatrixSolveFailure;
+						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+					}
 
 
-					auto delta_z = LU.solve(-f);
+					Vec<ComplexType> delta_z = LU.solve(-f);
 					next_space += delta_z;
 
-					if ( (delta_z.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+					RealType norm_delta_z = delta_z.norm();
+					refactor = ii > 0 && norm_delta_z > previous_norm_delta_z * RealType(chord_max_contraction);
+					previous_norm_delta_z = norm_delta_z;
+
+					if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 						return SuccessCode::Success;
 
-					auto norm_J_inverse = LU.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
-					if (!amp::CriterionB(J.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, delta_z.norm(), AMP_config))
+					if (refactored)
+						norm_J_inverse = amp::NormJInverse(LU, AMP_config);
+					if (!amp::CriterionB(J.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config))
 						return SuccessCode::HigherPrecisionNecessary;
 
 					if (!amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
@@ -190,6 +223,8 @@ namespace bertini{
 			\param min_num_newton_iterations The corrector must take at least this many steps.  This should be at least 1.
 			\param max_num_newton_iterations The maximum number of iterations to run Newton's method for.
 			\param AMP_config Adaptive multiple precision settings.  Using this argument is how Bertini2 knows you want to use adaptive precision.
+			\param use_chord Whether to reuse the Jacobian and its LU factorization across iterations, refactoring only when the steps stop contracting by chord_max_contraction.  The AMP criteria are checked against the Jacobian actually used.
+			\param chord_max_contraction With use_chord, refactor when a step is longer than this fraction of the one before it.
 			*/
 			template <typename ComplexType, typename RealType>
 			SuccessCode NewtonLoop(Vec<ComplexType> & next_space,
@@ -203,7 +238,9 @@ namespace bertini{
 					               RealType const& tracking_tolerance,
 					               unsigned min_num_newton_iterations,
 					               unsigned max_num_newton_iterations,
-					               config::AdaptiveMultiplePrecisionConfig const& AMP_config)
+					               config::AdaptiveMultiplePrecisionConfig const& AMP_config,
+					               bool use_chord = false,
+					               double chord_max_contraction = 0.5)
 			{
 				#ifndef BERTINI_DISABLE_ASSERTS
 				assert(max_num_newton_iterations >= min_num_newton_iterations && "max number newton iterations must be at least the min.");
@@ -211,26 +248,40 @@ namespace bertini{
 
 
 				next_space = current_space;
+				Mat<ComplexType> J;
+				Eigen::PartialPivLU< Mat<ComplexType> > LU;
+				bool refactor = true;
+				RealType previous_norm_delta_z(0);
 				for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 				{
 					//TODO: wrap these into a single line.
 					auto f = S.Eval(next_space, current_time);
-					auto J = S.Jacobian(next_space, current_time);
-					auto LU = J.lu();
+					bool refactored = refactor || !use_chord;
+					if (refactored)
+					{
+						J = S.Jacobian(next_space, current_time);
+						LU = J.lu();
 
 
-					if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
-						return SuccessCode::MatrixSolveFailure;
+						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+					}
 
 
-					auto delta_z = LU.solve(-f);
+					Vec<ComplexType> delta_z = LU.solve(-f);
 					next_space += delta_z;
 
 
 					norm_delta_z = delta_z.norm();
-					norm_J = J.norm();
-					norm_J_inverse = LU.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
-					condition_number_estimate = norm_J*norm_J_inverse;
+					refactor = ii > 0 && norm_delta_z > previous_norm_delta_z * RealType(chord_max_contraction);
+					previous_norm_delta_z = norm_delta_z;
+
+					if (refactored)
+					{
+						norm_J = J.norm();
+						norm_J_inverse = amp::NormJInverse(LU, AMP_config);
+						condition_number_estimate = norm_J*norm_J_inverse;
+					}
 
 
 
@@ -11,11 +11,33 @@
 
 #include "bertini2/tracking/amp_criteria.hpp"
 #include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/tracking/jacobian_cache.hpp"
+#include "bertini2/tracking/lapack_lu.hpp"
+#include "bertini2/tracking/multiprecision_lu.hpp"
+#include "bertini2/tracking/small_lu.hpp"
+#include "bertini2/tracking/time_breakdown.hpp"
 #include "bertini2/system.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+
 
 namespace bertini{
 	namespace tracking{
+
+		/**
+		\brief The largest error of a prediction Newton's method can remove in some iterations, to the tracking tolerance.
+
+		Assuming quadratic convergence, \f$ \tau^{2^{1-n}} \f$ for tracking tolerance \f$\tau\f$ and n iterations.  So the tolerance itself for one iteration, and its square root for two.
+		*/
+		inline
+		double CorrectablePredictionError(double tracking_tolerance, unsigned max_num_newton_iterations)
+		{
+			return std::pow(tracking_tolerance, std::pow(0.5, double(std::max(max_num_newton_iterations,1u))-1));
+		}
+
+
 		namespace correct{
 
 
@@ -73,19 +95,125 @@ namespace bertini{
 	
 				
 				
+				/**
+				 \brief Share a cache of Jacobian factorizations.  In chord mode, the first iteration uses the factorization found there, if any, rather than factoring anew.
+				 
+				 \param cache The cache.  May be null.
+				 */
+				void SetJacobianCache(std::shared_ptr<JacobianCache> const& cache)
+				{
+					jacobian_cache_ = cache;
+				}
+
+
+				/**
+				 \brief Share an accumulator of the time spent evaluating, factoring, and checking the AMP criteria.
+				 
+				 \param breakdown The accumulator.  May be null, to not time.
+				 */
+				void SetTimeBreakdown(std::shared_ptr<TimeBreakdown> const& breakdown)
+				{
+					time_breakdown_ = breakdown;
+				}
+
+
+				/**
+				 \brief Share the factorization of large Jacobians among a team of threads, for tracking few paths of a large system.
+				 
+				 In multiple precision, MultiprecisionLU factors with the team.  In double precision, the BLAS under LapackLU is told to use as many threads, which is a setting of the whole process, so should not be done while tracking paths in parallel; Eigen's factorization, of Jacobians smaller than the LAPACK threshold or without LAPACK, is parallel only if Eigen was built with OpenMP.
+				 
+				 \param team The threads.  May be null, to factor on the calling thread.
+				 */
+				void SetThreadTeam(std::shared_ptr<detail::ThreadTeam> const& team)
+				{
+					thread_team_ = team;
+					multiprecision_LU_.SetThreadTeam(team);
+					LapackThreads(team ? static_cast<int>(team->NumThreads()) : 1);
+				}
+
+
+
+				/**
+				 \brief The number of Newton iterations taken since construction, full or chord.
+				 */
+				unsigned long long NumIterations() const
+				{
+					return num_iterations_;
+				}
+
+				/**
+				 \brief The number of Jacobians evaluated since construction.
+				 */
+				unsigned long long NumJacobianEvaluations() const
+				{
+					return num_jacobian_evaluations_;
+				}
+
+				/**
+				 \brief The number of LU factorizations, dense or sparse, computed since construction.
+				 */
+				unsigned long long NumFactorizations() const
+				{
+					return num_factorizations_;
+				}
+
+
+				/**
+				 \brief An estimate of the bytes held by the corrector: its workspaces and dense factorizations, at the current precision and at the others it keeps.  Sparse factorizations and the Jacobian cache, shared with the predictor, are not included.
+				 */
+				std::size_t MemoryBytes() const
+				{
+					using memory::HeapBytes;
+
+					std::size_t bytes = sizeof(NewtonCorrector)
+					       + HeapBytes(f_temp_) + HeapBytes(step_temp_) + HeapBytes(J_temp_) + HeapBytes(norm_workspace_)
+					       + HeapBytes(LU_) + HeapBytes(LU_low_) + HeapBytes(J_sparse_) + HeapBytes(J_low_) + HeapBytes(krylov_space_)
+					       + multiprecision_LU_.HeapBytes() + lapack_LU_.HeapBytes();
+
+					for (auto const& t : precision_tiers_)
+					{
+						auto const& tier = t.second;
+						bytes += sizeof(t) + HeapBytes(tier.f_temp) + HeapBytes(tier.step_temp) + HeapBytes(tier.norm_workspace)
+						       + HeapBytes(tier.J_temp) + HeapBytes(tier.LU) + HeapBytes(tier.J_sparse) + tier.multiprecision_LU.HeapBytes();
+					}
+					return bytes;
+				}
+				
+				
+				
 				/**
 				 /brief Change the precision of the predictor variables and reassign the Butcher table variables.
 				 
+				 The multiple precision workspaces and factorizations are kept for each precision used, and swapped back in on returning to it.
+				 
 				 \param new_precision The new precision.
 				 
 				 */
 				void ChangePrecision(unsigned new_precision)
 				{
+					factored_precision_ = 0;
+					auto& outgoing = precision_tiers_[current_precision_];
+					SwapPrecisionTier(outgoing);
+					outgoing.valid = true;
+
+					auto& incoming = precision_tiers_[new_precision];
+					if (incoming.valid)
+					{
+						SwapPrecisionTier(incoming);
+						incoming.valid = false;
+						current_precision_ = new_precision;
+						return;
+					}
+
+					// first time at this precision.  whatever was swapped out of the tier is reused as storage.
+					ResizeWorkspaces();
 					Precision(std::get< Vec<mpfr> >(f_temp_), new_precision);
 					Precision(std::get< Vec<mpfr> >(step_temp_), new_precision);
 					Precision(std::get< Mat<mpfr> >(J_temp_), new_precision);
+					Precision(std::get< Vec<mpfr> >(norm_workspace_), new_precision);
 
 					std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr>>(numTotalFunctions_);
+					std::get< std::shared_ptr< SparseLU<mpfr> > >(sparse_LU_).reset();
 
 					current_precision_ = new_precision;				
 				}
@@ -106,12 +234,27 @@ namespace bertini{
 				{
 					numTotalFunctions_ = S.NumTotalFunctions();
 					numVariables_ = S.NumVariables();
+					precision_tiers_.clear();
+					ResizeWorkspaces();
+					
+					// the pattern of the sparse Jacobian may differ
+					std::get< std::shared_ptr< SparseLU<dbl> > >(sparse_LU_).reset();
+					std::get< std::shared_ptr< SparseLU<mpfr> > >(sparse_LU_).reset();
+					density_system_ = nullptr;
+				}
+
+
+				void ResizeWorkspaces()
+				{
 					std::get< Mat<dbl> >(J_temp_).resize(numTotalFunctions_, numVariables_);
 					std::get< Mat<mpfr> >(J_temp_).resize(numTotalFunctions_, numVariables_);
 					std::get< Vec<dbl> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(step_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(norm_workspace_).resize(numVariables_);
+					std::get< Vec<mpfr> >(norm_workspace_).resize(numVariables_);
+					J_low_.resize(numTotalFunctions_, numVariables_);
 				}
 
 				
@@ -157,17 +300,27 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
+					bool refactor = !SeedFromCache(S, current_time);
+					RealType previous_norm_step(0);
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						bool refactored = refactor || !newton_config_.use_chord;
+						auto success_code = refactored ? EvalIterationStep(step_ref, S, next_space, current_time)
+						                               : EvalChordStep(step_ref, S, next_space, current_time);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
+						bool converged = PredictedConverged(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance);
+						bool hopeless = CorrectionHopeless(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance, max_num_newton_iterations);
+						refactor = ContractionDegraded(RealType(step_ref.norm()), previous_norm_step, ii);
 						
-						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+						if ( (step_ref.norm() < tracking_tolerance || converged) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
+
+						if (hopeless)
+							return SuccessCode::FailedToConverge;
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -216,27 +369,42 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
+					bool refactor = !SeedFromCache(S, current_time);
+					RealType previous_norm_step(0);
+					RealType norm_J_inverse;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						bool refactored = refactor || !newton_config_.use_chord;
+						auto success_code = refactored ? EvalIterationStep(step_ref, S, next_space, current_time)
+						                               : EvalChordStep(step_ref, S, next_space, current_time);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
-						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+						bool converged = PredictedConverged(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance);
+						bool hopeless = CorrectionHopeless(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance, max_num_newton_iterations);
+						refactor = ContractionDegraded(RealType(step_ref.norm()), previous_norm_step, ii);
 						
 						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
 						
-						auto norm_J_inverse = LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
-						if (!amp::CriterionB(J_temp_ref.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, step_ref.norm(), AMP_config))
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::AMPCriteria);
+						// the criteria are checked against the Jacobian actually used for the step, so a reused factorization keeps its estimate.
+						if (refactored || ii==0)
+							norm_J_inverse = EstimateNormJInverse<ComplexType>(AMP_config);
+						if (!amp::CriterionB(NormJ<ComplexType>(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, step_ref.norm(), AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
 						
 						if (!amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
+
+						// accepted early only once the criteria hold for the iterate
+						if (converged && (ii >= (min_num_newton_iterations-1)) )
+							return SuccessCode::Success;
+
+						if (hopeless)
+							return SuccessCode::FailedToConverge;
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -290,23 +458,30 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
+					bool refactor = !SeedFromCache(S, current_time);
+					RealType previous_norm_step(0);
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						bool refactored = refactor || !newton_config_.use_chord;
+						auto success_code = refactored ? EvalIterationStep(step_ref, S, next_space, current_time)
+						                               : EvalChordStep(step_ref, S, next_space, current_time);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
-						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
+						bool converged = PredictedConverged(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance);
+						bool hopeless = CorrectionHopeless(RealType(step_ref.norm()), previous_norm_step, ii, tracking_tolerance, max_num_newton_iterations);
+						refactor = ContractionDegraded(RealType(step_ref.norm()), previous_norm_step, ii);
 						
 						norm_delta_z = step_ref.norm();
-						norm_J = J_temp_ref.norm();
-						norm_J_inverse = LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
-						condition_number_estimate = norm_J*norm_J_inverse;
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::AMPCriteria);
+						if (refactored || ii==0)
+						{
+							norm_J = NormJ<ComplexType>();
+							norm_J_inverse = EstimateNormJInverse<ComplexType>(AMP_config);
+							condition_number_estimate = norm_J*norm_J_inverse;
+						}
 						
 						
 						
@@ -318,11 +493,56 @@ namespace bertini{
 						
 						if (!amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
+
+						// accepted early only once the criteria hold for the iterate
+						if (converged && (ii >= (min_num_newton_iterations-1)) )
+							return SuccessCode::Success;
+
+						if (hopeless)
+							return SuccessCode::FailedToConverge;
 					}
 					
 					return SuccessCode::FailedToConverge;
 				}
 
+
+				/**
+				 \brief Solve \f$J X = B\f$ for many right hand sides at once, with the factorization of the Jacobian from the last Newton iteration, without evaluating or factoring anything.
+
+				 After a correction to a point, that is the Jacobian at the next to last iterate, which differs from the one at the corrected point by about the length of the last step.  For the sensitivity of the point to parameters, see Tracker::ParameterSensitivity.
+
+				 \param[out] X The solutions, one column for each column of B.
+				 \param B The right hand sides, NumTotalFunctions rows.
+				 \return MatrixSolveFailure if there is no factorization to use: none yet, one of a different number type or precision than B, or only a preconditioner, with use_krylov.
+				 */
+				template<typename ComplexType>
+				SuccessCode SolveWithLastFactorization(Mat<ComplexType> & X, Mat<ComplexType> const& B)
+				{
+					const bool multiple = std::is_same<ComplexType,mpfr>::value;
+					if (krylov_factored_ || factored_precision_==0 || factored_in_multiple_precision_!=multiple
+					    || factored_precision_!=(multiple ? DefaultPrecision() : DoublePrecision())
+					    || B.rows()!=numTotalFunctions_)
+						return SuccessCode::MatrixSolveFailure;
+
+					X.resize(numVariables_, B.cols());
+					if (!(sparse_factored_ || small_factored_ || multiprecision_factored_ || lapack_factored_ || UsingLowPrecisionFactorization<ComplexType>()))
+					{
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+						X = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_).solve(B);
+						return SuccessCode::Success;
+					}
+
+					Vec<ComplexType> x;
+					for (Eigen::Index jj = 0; jj < B.cols(); ++jj)
+					{
+						auto code = Solve(x, Vec<ComplexType>(B.col(jj)));
+						if (code!=SuccessCode::Success)
+							return code;
+						X.col(jj) = x;
+					}
+					return SuccessCode::Success;
+				}
+
 				
 			private:
 
@@ -351,19 +571,562 @@ namespace bertini{
 					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
 					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
 					
+					++num_iterations_;
+					++num_jacobian_evaluations_;
+					if (UseKrylov<ComplexType>())
+					{
+						{
+							TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+							S.EvalInPlace(f_temp_ref, current_space, current_time);
+							std::get< Vec<ComplexType> >(krylov_space_) = current_space;
+							std::get< ComplexType >(krylov_time_) = current_time;
+							S.JacobianInPlace(J_low_, Vec<dbl>(current_space.template cast<dbl>()), static_cast<dbl>(current_time));
+						}
+						
+						f_temp_ref = -f_temp_ref;
+						if (FactorPreconditioner()==SuccessCode::Success)
+							return SolveKrylov(newton_step, S, f_temp_ref);
+						
+						// too near singular for double precision to precondition
+						{
+							TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+							S.JacobianInPlace(J_temp_ref, current_space, current_time);
+						}
+						if (Factor<ComplexType>()!=SuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+						return Solve(newton_step, f_temp_ref);
+					}
+					
+					if (UseSparse(S))
+					{
+						{
+							TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+							S.EvalInPlace(f_temp_ref, current_space, current_time);
+							S.SparseJacobianInPlace(std::get< Eigen::SparseMatrix<ComplexType> >(J_sparse_));
+						}
+						
+						if (FactorSparse<ComplexType>()!=SuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+						
+						f_temp_ref = -f_temp_ref;
+						return Solve(newton_step, f_temp_ref);
+					}
+					
+					{
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+						S.EvalAndJacobianInPlace(f_temp_ref, J_temp_ref, current_space, current_time);
+					}
+					
+					if (Factor<ComplexType>()!=SuccessCode::Success)
+						return SuccessCode::MatrixSolveFailure;
+					
+					f_temp_ref = -f_temp_ref;
+					return Solve(newton_step, f_temp_ref);
+					
+				}
+
+
+				/**
+				 \brief Computes a chord Newton step, reusing the Jacobian and LU factorization from the most recent full step.
+				 
+				 Only the functions are evaluated, at the current point.
+				 
+				 \param newton_step The computed step for Newton's method
+				 \param S The system used in the computations
+				 \param current_space The space from the previous Newton iteration
+				 \param current_time The time from the previous Newton iteration
+				 */
+				template<typename ComplexType, typename Derived>
+				SuccessCode EvalChordStep(Vec<ComplexType> & newton_step,
+										  const System& S,
+										  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time)
+				{
+					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
+					
+					++num_iterations_;
+					{
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::FunctionEvaluation);
+						S.EvalInPlace(f_temp_ref, current_space, current_time);
+					}
+					f_temp_ref = -f_temp_ref;
+					if (krylov_factored_)
+						return SolveKrylov(newton_step, S, f_temp_ref);
+					return Solve(newton_step, f_temp_ref);
+				}
+
+
+				/**
+				 \brief Factor the Jacobian in J_temp_.
+				 
+				 In multiple precision with mixed_precision_solve set, the factorization is done in double precision, unless the Jacobian is too near singular for that, in which case it is done in the current precision, see FactorInCurrentPrecision.
+				 */
+				template<typename ComplexType>
+				SuccessCode Factor()
+				{
+					TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
+					
+					RecordFactoredPrecision<ComplexType>();
+					sparse_factored_ = false;
+					krylov_factored_ = false;
+					multiprecision_factored_ = false;
+					lapack_factored_ = false;
+					small_factored_ = newton_config_.fixed_size_solve && J_temp_ref.rows()==J_temp_ref.cols() && SmallLU::Handles<ComplexType>(J_temp_ref.rows());
+					if (small_factored_)
+					{
+						++num_factorizations_;
+						low_precision_factored_ = false;
+						if (small_LU_.Compute(J_temp_ref)!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+						return SuccessCode::Success;
+					}
+					
+					lapack_factored_ = LapackLU::Handles<ComplexType>(J_temp_ref.rows(), J_temp_ref.cols(), newton_config_.lapack_threshold);
+					if (lapack_factored_)
+					{
+						++num_factorizations_;
+						low_precision_factored_ = false;
+						if (lapack_LU_.Compute(J_temp_ref)!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+						return SuccessCode::Success;
+					}
+
+					low_precision_factored_ = std::is_same<ComplexType,mpfr>::value && newton_config_.mixed_precision_solve;
+					if (low_precision_factored_)
+					{
+						++num_factorizations_;
+						LU_low_ = J_temp_ref.template cast<dbl>().lu();
+						if (LU_low_.matrixLU().allFinite() && LUPartialPivotDecompositionSuccessful(LU_low_.matrixLU())==MatrixSuccessCode::Success)
+							return SuccessCode::Success;
+						low_precision_factored_ = false;
+					}
+					
+					return FactorInCurrentPrecision<ComplexType>();
+				}
+
+
+				/**
+				 \brief Factor the Jacobian in J_temp_ in the current precision.
+				 
+				 In multiple precision with multiprecision_lu set, by MultiprecisionLU, otherwise by Eigen::PartialPivLU into LU_.
+				 */
+				template<typename ComplexType>
+				SuccessCode FactorInCurrentPrecision()
+				{
+					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
 					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 					
-					S.EvalInPlace(f_temp_ref, current_space, current_time);
-					S.JacobianInPlace(J_temp_ref, current_space, current_time);
-					LU_ref = J_temp_ref.lu();
+					++num_factorizations_;
+					multiprecision_factored_ = newton_config_.multiprecision_lu && MultiprecisionLU::Handles<ComplexType>(J_temp_ref.rows(), J_temp_ref.cols());
+					if (multiprecision_factored_)
+					{
+						if (multiprecision_LU_.Compute(J_temp_ref)!=MatrixSuccessCode::Success)
+							return SuccessCode::MatrixSolveFailure;
+						return SuccessCode::Success;
+					}
+					
+					LU_ref.compute(J_temp_ref);
 					
 					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
 						return SuccessCode::MatrixSolveFailure;
 					
-					newton_step = LU_ref.solve(-f_temp_ref);
+					return SuccessCode::Success;
+				}
+
+
+				template<typename ComplexType>
+				bool UseKrylov() const
+				{
+					return std::is_same<ComplexType,mpfr>::value && newton_config_.use_krylov && numTotalFunctions_==numVariables_;
+				}
+
+
+				/**
+				 \brief Factor the double precision Jacobian in J_low_, to precondition GMRES.
+				 */
+				SuccessCode FactorPreconditioner()
+				{
+					TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
 					
+					++num_factorizations_;
+					LU_low_.compute(J_low_);
+					
+					sparse_factored_ = false;
+					small_factored_ = false;
+					low_precision_factored_ = false;
+					multiprecision_factored_ = false;
+					lapack_factored_ = false;
+					krylov_factored_ = LU_low_.matrixLU().allFinite() && LUPartialPivotDecompositionSuccessful(LU_low_.matrixLU())==MatrixSuccessCode::Success;
+					return krylov_factored_ ? SuccessCode::Success : SuccessCode::MatrixSolveFailure;
+				}
+
+
+				/**
+				 \brief Solve \f$J x = b\f$, with J the Jacobian at the point saved in krylov_space_ and krylov_time_, by GMRES.
+				 
+				 Right preconditioned by the double precision factorization in LU_low_, so the Krylov space is that of \f$J M^{-1}\f$, which is near the identity, and each iteration gains about as many digits as double precision has less those lost to the conditioning of J.  Each iteration is one product of J with a vector, see System::JacobianTimesVector, and one solve with LU_low_.  The residuals are kept by Givens rotations of the Hessenberg matrix, without forming x until the end.
+				 
+				 The triangular factor R of the rotated Hessenberg matrix has the singular values of \f$J M^{-1}\f$ restricted to the Krylov space, so \f$\|R^{-1}\|\f$ times the norm of \f$M^{-1}\f$ is kept as the estimate of the norm of the inverse of J, see EstimateNormJInverse.
+				 
+				 If GMRES does not converge in max_num_krylov_iterations, the Jacobian is evaluated and factored in the current precision, and the system solved with that.
+				 */
+				template<typename ComplexType>
+				SuccessCode SolveKrylov(Vec<ComplexType> & x, const System& S, Vec<ComplexType> const& b)
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					
+					auto const& point = std::get< Vec<ComplexType> >(krylov_space_);
+					auto const& time = std::get< ComplexType >(krylov_time_);
+					
+					bool converged = false;
+					{
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+						
+						const unsigned m = std::max(1u, newton_config_.max_num_krylov_iterations);
+						const RealType tolerance = newton_config_.krylov_relative_tolerance > 0 ? RealType(newton_config_.krylov_relative_tolerance) : RealType(10*Eigen::NumTraits<ComplexType>::epsilon());
+						const RealType beta = b.norm();
+						
+						x = Vec<ComplexType>::Zero(b.size());
+						if (beta==0)
+						{
+							krylov_norm_preconditioned_inverse_ = 1;
+							return SuccessCode::Success;
+						}
+						
+						// the orthonormal basis V of the Krylov space, and Z = M^{-1} V
+						std::vector< Vec<ComplexType> > V(1, b*ComplexType(RealType(1)/beta)), Z;
+						Mat<ComplexType> H = Mat<ComplexType>::Zero(m+1, m);
+						Vec<ComplexType> g = Vec<ComplexType>::Zero(m+1);
+						g(0) = ComplexType(beta);
+						std::vector<RealType> c(m);
+						std::vector<ComplexType> s(m);
+						
+						// the rotation [c s; -conj(s) c] of a pair of entries
+						auto rotate = [](ComplexType & p, ComplexType & q, RealType const& cc, ComplexType const& ss)
+							{
+								ComplexType rotated = ComplexType(cc)*p + ss*q;
+								q = -conj(ss)*p + ComplexType(cc)*q;
+								p = rotated;
+							};
+						
+						unsigned k = 0;
+						while (k < m && !converged)
+						{
+							Z.push_back(LU_low_.solve(V[k].template cast<dbl>()).template cast<ComplexType>());
+							Vec<ComplexType> w = S.JacobianTimesVector(point, time, Z[k]);
+							
+							for (unsigned j = 0; j <= k; ++j)
+							{
+								H(j,k) = V[j].dot(w);
+								w -= H(j,k)*V[j];
+							}
+							const RealType h = w.norm();
+							
+							for (unsigned j = 0; j < k; ++j)
+								rotate(H(j,k), H(j+1,k), c[j], s[j]);
+							
+							const RealType a = abs(H(k,k));
+							const RealType rho = sqrt(a*a + h*h);
+							if (a==0)
+							{
+								c[k] = 0;
+								s[k] = ComplexType(1);
+							}
+							else
+							{
+								c[k] = a/rho;
+								s[k] = H(k,k)/ComplexType(a)*ComplexType(h/rho);
+							}
+							H(k,k) = ComplexType(c[k])*H(k,k) + s[k]*ComplexType(h);
+							rotate(g(k), g(k+1), c[k], s[k]);
+							++k;
+							
+							converged = h==0 || abs(g(k)) <= tolerance*beta;
+							if (!converged)
+								V.push_back(w*ComplexType(RealType(1)/h));
+						}
+						
+						Vec<ComplexType> y = H.topLeftCorner(k,k).template triangularView<Eigen::Upper>().solve(g.head(k));
+						for (unsigned j = 0; j < k; ++j)
+							x += Z[j]*y(j);
+						
+						Mat<dbl> R = H.topLeftCorner(k,k).template cast<dbl>();
+						krylov_norm_preconditioned_inverse_ = Mat<dbl>(R.triangularView<Eigen::Upper>().solve(Mat<dbl>::Identity(k,k))).norm();
+					}
+					
+					if (converged)
+						return SuccessCode::Success;
+					
+					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
+					{
+						TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::JacobianEvaluation);
+						++num_jacobian_evaluations_;
+						S.JacobianInPlace(J_temp_ref, point, time);
+					}
+					if (Factor<ComplexType>()!=SuccessCode::Success)
+						return SuccessCode::MatrixSolveFailure;
+					return Solve(x, b);
+				}
+
+
+				/**
+				 \brief Whether to factor the Jacobian of S as a sparse matrix.  Its density is found once for each system, rather than at every Newton iteration, since it depends only on the structure of the functions.
+				 */
+				bool UseSparse(const System& S) const
+				{
+					if (newton_config_.sparse_density_threshold <= 0)
+						return false;
+					if (density_system_!=&S)
+					{
+						jacobian_density_ = S.JacobianDensity();
+						density_system_ = &S;
+					}
+					return jacobian_density_ < newton_config_.sparse_density_threshold;
+				}
+
+
+				/**
+				 \brief Factor the sparse Jacobian in J_sparse_.  Its pattern is analyzed on first use, since it is the same at every point.
+				 */
+				template<typename ComplexType>
+				SuccessCode FactorSparse()
+				{
+					TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+					auto& J = std::get< Eigen::SparseMatrix<ComplexType> >(J_sparse_);
+					auto& LU = std::get< std::shared_ptr< SparseLU<ComplexType> > >(sparse_LU_);
+					
+					if (!LU)
+					{
+						LU = std::make_shared< SparseLU<ComplexType> >();
+						LU->analyzePattern(J);
+					}
+					++num_factorizations_;
+					LU->factorize(J);
+					RecordFactoredPrecision<ComplexType>();
+					
+					sparse_factored_ = true;
+					low_precision_factored_ = false;
+					small_factored_ = false;
+					krylov_factored_ = false;
+					multiprecision_factored_ = false;
+					lapack_factored_ = false;
+					
+					if (LU->info()!=Eigen::Success)
+						return SuccessCode::MatrixSolveFailure;
 					return SuccessCode::Success;
+				}
+
+
+				/**
+				 \brief Solve \f$J x = b\f$ with the current factorization of the Jacobian in J_temp_.
+				 
+				 If the factorization is in double precision, the solution is refined with residuals computed in the current precision.  If refinement stalls, the Jacobian is factored in the current precision, which is then used until the next factorization.
+				 */
+				template<typename ComplexType>
+				SuccessCode Solve(Vec<ComplexType> & x, Vec<ComplexType> const& b)
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					TimeBreakdown::Scope timed(time_breakdown_.get(), TimedWork::LinearAlgebra);
+					
+					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
+					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+					
+					if (sparse_factored_)
+					{
+						x = std::get< std::shared_ptr< SparseLU<ComplexType> > >(sparse_LU_)->solve(b);
+						return SuccessCode::Success;
+					}
+					
+					if (small_factored_)
+					{
+						small_LU_.Solve(x, b);
+						return SuccessCode::Success;
+					}
+					
+					if (multiprecision_factored_)
+					{
+						multiprecision_LU_.Solve(x, b);
+						return SuccessCode::Success;
+					}
+					
+					if (lapack_factored_)
+					{
+						lapack_LU_.Solve(x, b);
+						return SuccessCode::Success;
+					}
+					
+					if (!UsingLowPrecisionFactorization<ComplexType>())
+					{
+						x = LU_ref.solve(b);
+						return SuccessCode::Success;
+					}
+					
+					x = LU_low_.solve(b.template cast<dbl>()).template cast<ComplexType>();
+					double previous_norm_correction = 0;
+					for (unsigned ii = 0; ii < newton_config_.max_num_refinement_iterations; ++ii)
+					{
+						Vec<dbl> correction = LU_low_.solve(Vec<ComplexType>(b - J_temp_ref*x).template cast<dbl>());
+						x += correction.template cast<ComplexType>();
+						
+						double norm_correction = correction.norm();
+						if (RealType(norm_correction) <= 10*Eigen::NumTraits<ComplexType>::epsilon()*x.norm())
+							return SuccessCode::Success;
+						
+						if (ii > 0 && norm_correction > 0.5*previous_norm_correction) // stalled
+							break;
+						previous_norm_correction = norm_correction;
+					}
+					
+					low_precision_factored_ = false;
+					if (FactorInCurrentPrecision<ComplexType>()!=SuccessCode::Success)
+						return SuccessCode::MatrixSolveFailure;
 					
+					return Solve(x, b);
+				}
+
+
+				template<typename ComplexType>
+				bool UsingLowPrecisionFactorization() const
+				{
+					return std::is_same<ComplexType,mpfr>::value && low_precision_factored_;
+				}
+
+
+				/**
+				 \brief Note the number type and precision of a factorization being made, for SolveWithLastFactorization.
+				 */
+				template<typename ComplexType>
+				void RecordFactoredPrecision()
+				{
+					factored_in_multiple_precision_ = std::is_same<ComplexType,mpfr>::value;
+					factored_precision_ = factored_in_multiple_precision_ ? DefaultPrecision() : DoublePrecision();
+				}
+
+
+				/**
+				 \brief The Frobenius norm of the Jacobian of the current factorization, sparse or dense.
+				 */
+				template<typename ComplexType>
+				typename Eigen::NumTraits<ComplexType>::Real NormJ() const
+				{
+					if (sparse_factored_)
+						return std::get< Eigen::SparseMatrix<ComplexType> >(J_sparse_).norm();
+					else if (krylov_factored_)
+						return typename Eigen::NumTraits<ComplexType>::Real(J_low_.norm());
+					else
+						return std::get< Mat<ComplexType> >(J_temp_).norm();
+				}
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the Jacobian in J_temp_, from whichever factorization of it is current.
+				 
+				 With GMRES, J_temp_ is not formed, and the estimate is the product of those of the norms of the inverses of the double precision Jacobian and of the preconditioned Jacobian, from the Krylov process, see SolveKrylov.
+				 */
+				template<typename ComplexType>
+				typename Eigen::NumTraits<ComplexType>::Real EstimateNormJInverse(config::AdaptiveMultiplePrecisionConfig const& AMP_config) const
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					if (sparse_factored_) // the 1-norm estimator needs a dense factorization
+					{
+						auto const& LU = std::get< std::shared_ptr< SparseLU<ComplexType> > >(sparse_LU_);
+						return Vec<ComplexType>(LU->solve(RandomOfUnits<ComplexType>(numVariables_))).norm();
+					}
+					else if (small_factored_)
+						return RealType(small_LU_.NormInverse(AMP_config));
+					else if (multiprecision_factored_)
+						return RealType(multiprecision_LU_.NormInverse(AMP_config));
+					else if (lapack_factored_)
+						return RealType(lapack_LU_.NormInverse(AMP_config));
+					else if (krylov_factored_)
+						return RealType(amp::NormJInverse(LU_low_, AMP_config) * krylov_norm_preconditioned_inverse_);
+					else if (UsingLowPrecisionFactorization<ComplexType>())
+						return RealType(amp::NormJInverse(LU_low_, AMP_config));
+					else
+						return amp::NormJInverse(std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_), AMP_config, std::get< Vec<ComplexType> >(norm_workspace_));
+				}
+
+
+				/**
+				 \brief In chord mode, start from the factorization in the shared cache, typically the predictor's, instead of making a new one.
+				 
+				 \return Whether the Jacobian and LU factorization were taken from the cache.
+				 */
+				template<typename ComplexType>
+				bool SeedFromCache(const System& S, const ComplexType& current_time)
+				{
+					if (!newton_config_.use_chord || !jacobian_cache_
+					    || !jacobian_cache_->HasFactorization<ComplexType>(S.NumVariables(), Precision(current_time)))
+						return false;
+					
+					std::get< Mat<ComplexType> >(J_temp_) = jacobian_cache_->Jacobian<ComplexType>();
+					std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_) = jacobian_cache_->LU<ComplexType>();
+					RecordFactoredPrecision<ComplexType>();
+					low_precision_factored_ = false;
+					sparse_factored_ = false;
+					small_factored_ = false;
+					krylov_factored_ = false;
+					multiprecision_factored_ = false;
+					lapack_factored_ = false;
+					return true;
+				}
+
+
+				/**
+				 \brief Decide whether a chord iteration must refactor, because its steps are no longer contracting fast enough.
+				 
+				 \param norm_step The length of the step just taken.
+				 \param previous_norm_step The length of the step before it.  Updated to norm_step.
+				 \param iteration The index of the step just taken.
+				 */
+				/**
+				 \brief With contraction_control, whether a correction has converged before the step after this one is taken.
+
+				 The contraction \f$\theta\f$ is the ratio of the lengths of the last two steps, and the step after them is predicted to be at most \f$\theta/(1-\theta)\f$ times the last, the distance left to the limit if the steps keep contracting at least as fast.  When that is less than the tracking tolerance, so is the error of the current iterate, and the evaluation and factorization of another iteration are skipped.
+
+				 \param norm_step The length of the step just taken.
+				 \param previous_norm_step The length of the step before it.
+				 \param iteration The index of the step just taken.  The first step has no contraction to go on.
+				 */
+				template<typename RealType>
+				bool PredictedConverged(RealType const& norm_step, RealType const& previous_norm_step, unsigned iteration, RealType const& tracking_tolerance) const
+				{
+					if (!newton_config_.contraction_control || iteration==0)
+						return false;
+
+					RealType theta = norm_step / previous_norm_step;
+					return theta < 1 && theta/(1-theta)*norm_step < tracking_tolerance;
+				}
+
+
+				/**
+				 \brief With contraction_control, whether a correction cannot converge in its iterations, so should be given up at once.
+
+				 After the first step, when it is longer than the CorrectablePredictionError() of all the iterations, which under quadratic convergence is the most they can shorten to the tolerance.  After any other, when the steps stop contracting.
+
+				 \param norm_step The length of the step just taken.
+				 \param previous_norm_step The length of the step before it.
+				 \param iteration The index of the step just taken.
+				 */
+				template<typename RealType>
+				bool CorrectionHopeless(RealType const& norm_step, RealType const& previous_norm_step, unsigned iteration, RealType const& tracking_tolerance, unsigned max_num_newton_iterations) const
+				{
+					if (!newton_config_.contraction_control || iteration+1 >= max_num_newton_iterations)
+						return false;
+
+					if (iteration==0)
+						return norm_step > RealType(CorrectablePredictionError(static_cast<double>(tracking_tolerance), max_num_newton_iterations));
+
+					return !(norm_step < previous_norm_step);
+				}
+
+
+				template<typename RealType>
+				bool ContractionDegraded(RealType const& norm_step, RealType & previous_norm_step, unsigned iteration) const
+				{
+					bool degraded = iteration > 0 && norm_step > previous_norm_step * RealType(newton_config_.chord_max_contraction);
+					previous_norm_step = norm_step;
+					return degraded;
 				}
 				
 
@@ -380,13 +1143,84 @@ namespace bertini{
 				std::tuple< Vec<dbl>, Vec<mpfr> > f_temp_; // Variable to hold temporary evaluation of the system
 				std::tuple< Vec<dbl>, Vec<mpfr> > step_temp_; // Variable to hold temporary evaluation of the newton step
 				std::tuple< Mat<dbl>, Mat<mpfr> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > norm_workspace_; // Right hand side for estimating the norm of the inverse of the Jacobian
 				
 				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_; // The LU factorization from the Newton iterates
+				Eigen::PartialPivLU<Mat<dbl>> LU_low_; // With mixed_precision_solve, the double precision factorization of a multiple precision Jacobian
+				bool low_precision_factored_ = false; // Whether LU_low_, rather than LU_, holds the current factorization
+				
+				template<typename T>
+				using SparseLU = Eigen::SparseLU< Eigen::SparseMatrix<T>, Eigen::COLAMDOrdering<int> >;
+				
+				std::tuple< Eigen::SparseMatrix<dbl>, Eigen::SparseMatrix<mpfr> > J_sparse_; // With sparse_density_threshold, the sparse Jacobian
+				std::tuple< std::shared_ptr< SparseLU<dbl> >, std::shared_ptr< SparseLU<mpfr> > > sparse_LU_; // Its factorization.  Made on first use, once its pattern is known
+				bool sparse_factored_ = false; // Whether sparse_LU_, rather than LU_ or LU_low_, holds the current factorization
+				mutable double jacobian_density_ = 1; // The JacobianDensity() of density_system_, found on the first use of sparse_density_threshold
+				mutable System const* density_system_ = nullptr; // The system whose density is in jacobian_density_.  Cleared by ChangeSystem
+				
+				SmallLU small_LU_; // With fixed_size_solve, the factorization of a small Jacobian in double precision
+				bool small_factored_ = false; // Whether small_LU_, rather than LU_, holds the current factorization
+				
+				MultiprecisionLU multiprecision_LU_; // With multiprecision_lu, the factorization of a multiple precision Jacobian in the current precision
+				bool multiprecision_factored_ = false; // Whether multiprecision_LU_, rather than LU_, holds the current factorization
+				
+				LapackLU lapack_LU_; // When configured with LAPACK, the factorization of a large Jacobian in double precision
+				bool lapack_factored_ = false; // Whether lapack_LU_, rather than LU_, holds the current factorization
+				
+				Mat<dbl> J_low_; // With use_krylov, the Jacobian in double precision, whose factorization in LU_low_ preconditions GMRES
+				std::tuple< Vec<dbl>, Vec<mpfr> > krylov_space_; // With use_krylov, the point of the Jacobian whose products GMRES uses, kept for chord steps
+				std::tuple< dbl, mpfr > krylov_time_; // and the time
+				bool krylov_factored_ = false; // Whether steps are solved by GMRES, rather than with any factorization in the current precision
+				double krylov_norm_preconditioned_inverse_ = 1; // From the latest GMRES solve, the estimate of the norm of the inverse of the preconditioned Jacobian
+				
+				unsigned factored_precision_ = 0; // The precision of the latest factorization, 0 if none or if the precision has changed since
+				bool factored_in_multiple_precision_ = false; // Whether the latest factorization is of a multiple precision Jacobian
 				
 				unsigned current_precision_;
 
 				config::Newton newton_config_; // Hold the settings of the Newton iteration
 
+				std::shared_ptr<JacobianCache> jacobian_cache_; // Shared with the predictor.  Optional.
+				std::shared_ptr<TimeBreakdown> time_breakdown_; // Shared with the predictor and the tracker.  Optional.
+				std::shared_ptr<detail::ThreadTeam> thread_team_; // The threads sharing factorizations.  Optional.
+
+				unsigned long long num_iterations_ = 0; // Counted for PathStatsObserver, never reset
+				unsigned long long num_jacobian_evaluations_ = 0;
+				unsigned long long num_factorizations_ = 0;
+				
+				/**
+				 \brief The multiple precision workspaces and factorizations at one precision, kept while working at another.
+				 */
+				struct PrecisionTier
+				{
+					bool valid = false; // Whether this holds the state at its precision, rather than storage left over from a swap
+					Vec<mpfr> f_temp, step_temp, norm_workspace;
+					Mat<mpfr> J_temp;
+					Eigen::PartialPivLU<Mat<mpfr>> LU;
+					MultiprecisionLU multiprecision_LU;
+					Eigen::SparseMatrix<mpfr> J_sparse;
+					std::shared_ptr< SparseLU<mpfr> > sparse_LU;
+				};
+				
+				std::map<unsigned, PrecisionTier> precision_tiers_; // The multiple precision state at each precision used other than the current.  Cleared with the system
+				
+				/**
+				 \brief Exchange the multiple precision workspaces and factorizations with those in a tier.  Only pointers are swapped.
+				 */
+				void SwapPrecisionTier(PrecisionTier & tier)
+				{
+					using std::swap;
+					std::get< Vec<mpfr> >(f_temp_).swap(tier.f_temp);
+					std::get< Vec<mpfr> >(step_temp_).swap(tier.step_temp);
+					std::get< Vec<mpfr> >(norm_workspace_).swap(tier.norm_workspace);
+					std::get< Mat<mpfr> >(J_temp_).swap(tier.J_temp);
+					swap(std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_), tier.LU);
+					swap(multiprecision_LU_, tier.multiprecision_LU);
+					multiprecision_LU_.SetThreadTeam(thread_team_); // a tier made before the team was set has none
+					std::get< Eigen::SparseMatrix<mpfr> >(J_sparse_).swap(tier.J_sparse);
+					std::get< std::shared_ptr< SparseLU<mpfr> > >(sparse_LU_).swap(tier.sparse_LU);
+				}
+
 				
 			}; //re: class NewtonCorrector
 			
@@ -35,6 +35,13 @@
 #include "bertini2/tracking/base_tracker.hpp"
 #include "bertini2/logging.hpp"
 #include <boost/type_index.hpp>
+#include <boost/serialization/version.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <typeinfo>
 
 namespace bertini {
 
@@ -72,8 +79,12 @@ namespace bertini {
 		};
 
 		/**
+		\brief Keeps a multiple precision copy of every point at which the tracker emits an event of a type, for as long as it lives.
+
+		For short paths and tests.  To record long paths, or paths in production runs, use PathRecorder, which keeps points in double precision unless asked for more, thins them, and bounds the memory they take.
+
 		Example usage:
-		PathAccumulator<AMPTracker> path_accumulator;
+		AMPPathAccumulator<AMPTracker> path_accumulator;
 		*/
 		template<class TrackerT, template<class> class EventT = SuccessfulStep>
 		class AMPPathAccumulator : public Observer<TrackerT>
@@ -108,6 +119,333 @@ namespace bertini {
 
 
 
+		/**
+		\brief Accumulates the wall time a tracker spends at each precision, from the events it emits.
+
+		The time between two events of a path is charged to the precision the tracker had at the first of them.  Time between paths, from TrackingEnded to the next event, is not counted.
+
+		Example usage:
+		PrecisionTimer<AMPTracker> timer;
+		tracker.AddObserver(&timer);
+		*/
+		template<class TrackerT>
+		class PrecisionTimer : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using Clock = std::chrono::steady_clock;
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				const TrackingEvent<EmitterT>* p = dynamic_cast<const TrackingEvent<EmitterT>*>(&e);
+				if (p)
+				{
+					Visit(p->Get());
+					if (dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
+						tracking_ = false;
+				}
+			}
+
+
+			virtual void Visit(TrackerT const& t) override
+			{
+				auto now = Clock::now();
+				if (tracking_)
+					seconds_[precision_] += std::chrono::duration<double>(now - last_event_).count();
+
+				tracking_ = true;
+				last_event_ = now;
+				precision_ = t.CurrentPrecision();
+			}
+
+		public:
+			/**
+			\brief The seconds spent at each precision, in digits, so far.
+			*/
+			const std::map<unsigned, double>& Seconds() const
+			{
+				return seconds_;
+			}
+
+			void Reset()
+			{
+				seconds_.clear();
+				tracking_ = false;
+			}
+
+		private:
+			std::map<unsigned, double> seconds_;
+			bool tracking_ = false;
+			Clock::time_point last_event_;
+			unsigned precision_ = 0;
+		};
+
+
+
+		/**
+		\brief Counts of the work done on one path, as gathered by a PathStatsObserver.
+		*/
+		struct PathStats
+		{
+			unsigned long long num_steps = 0; ///< Steps taken, successful or not.
+			unsigned long long num_failed_steps = 0; ///< Steps which failed.
+			unsigned long long num_newton_iterations = 0; ///< Newton iterations of the corrector, full or chord.
+			unsigned long long num_jacobian_evaluations = 0; ///< Jacobians evaluated by the predictor and corrector.
+			unsigned long long num_factorizations = 0; ///< LU factorizations computed by the predictor and corrector.
+			unsigned num_precision_increases = 0;
+			unsigned num_precision_decreases = 0;
+			unsigned num_avoided_precision_decreases = 0; ///< Precision decreases not taken, as not paying for the change.  Only counted by the AMPTracker.
+			unsigned max_precision = 0; ///< The highest precision tracked at, in digits.
+			double seconds_double = 0; ///< Wall time spent tracking in double precision.
+			double seconds_multiple = 0; ///< Wall time spent tracking in multiple precision.
+
+			PathStats& operator+=(PathStats const& other)
+			{
+				num_steps += other.num_steps;
+				num_failed_steps += other.num_failed_steps;
+				num_newton_iterations += other.num_newton_iterations;
+				num_jacobian_evaluations += other.num_jacobian_evaluations;
+				num_factorizations += other.num_factorizations;
+				num_precision_increases += other.num_precision_increases;
+				num_precision_decreases += other.num_precision_decreases;
+				num_avoided_precision_decreases += other.num_avoided_precision_decreases;
+				max_precision = std::max(max_precision, other.max_precision);
+				seconds_double += other.seconds_double;
+				seconds_multiple += other.seconds_multiple;
+				return *this;
+			}
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				ar & num_steps;
+				ar & num_failed_steps;
+				ar & num_newton_iterations;
+				ar & num_jacobian_evaluations;
+				ar & num_factorizations;
+				ar & num_precision_increases;
+				ar & num_precision_decreases;
+				if (version >= 1)
+					ar & num_avoided_precision_decreases;
+				ar & max_precision;
+				ar & seconds_double;
+				ar & seconds_multiple;
+			}
+		};
+
+
+		/**
+		\brief Gathers PathStats for the paths a tracker tracks, cheaply enough to leave on for every path.
+
+		Nothing is stored per step.  The step and work counts are read from the tracker's own counters when a call to TrackPath starts and ends, the clock is read only then and when precision changes, and it subscribes only to the three event types it uses, four while watching for the handoff, which it tells apart by exact type rather than by trying casts.
+
+		The stats of successive calls to TrackPath add up, so that a path tracked to the endgame boundary and then through an endgame, which calls TrackPath many times, is counted as one.  Take the stats of a path, and start counting the next, with Take.
+
+		With WatchHandoff, it also watches each step for signs of the path going singular, and stops tracking at the first, for a driver to start the endgame there.
+
+		Example usage:
+		PathStatsObserver<AMPTracker> stats;
+		tracker.AddObserver(&stats);
+		tracker.TrackPath(result, t_start, t_end, start_point);
+		auto path_stats = stats.Take();
+		*/
+		template<class TrackerT>
+		class PathStatsObserver : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using Clock = std::chrono::steady_clock;
+
+			virtual bool Subscribes(std::type_info const& event_type) const override
+			{
+				return event_type==typeid(NewStep<EmitterT>)
+				    || event_type==typeid(PrecisionChanged<EmitterT>)
+				    || event_type==typeid(TrackingEnded<EmitterT>)
+				    || (handoff_ && event_type==typeid(SuccessfulStep<EmitterT>));
+			}
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				auto const& type = typeid(e);
+
+				if (type==typeid(NewStep<EmitterT>))
+				{
+					auto const& t = static_cast<const NewStep<EmitterT>&>(e).Get();
+					if (!tracking_)
+						Start(t);
+					step_precision_ = t.CurrentPrecision();
+				}
+				else if (type==typeid(PrecisionChanged<EmitterT>))
+				{
+					if (tracking_)
+					{
+						auto const& p = static_cast<const PrecisionChanged<EmitterT>&>(e);
+						ChargeTime(Clock::now());
+						precision_ = p.Next();
+						stats_.max_precision = std::max(stats_.max_precision, precision_);
+						if (p.Next() > p.Previous())
+						{
+							++stats_.num_precision_increases;
+							++watched_precision_increases_;
+						}
+						else
+							++stats_.num_precision_decreases;
+					}
+				}
+				else if (type==typeid(SuccessfulStep<EmitterT>))
+				{
+					if (tracking_ && handoff_)
+						WatchStep(static_cast<const SuccessfulStep<EmitterT>&>(e).Get());
+				}
+				else if (type==typeid(TrackingEnded<EmitterT>))
+				{
+					if (tracking_)
+						Visit(static_cast<const TrackingEnded<EmitterT>&>(e).Get());
+				}
+			}
+
+
+			/**
+			Called at the end of a call to TrackPath.
+			*/
+			virtual void Visit(TrackerT const& t) override
+			{
+				ChargeTime(Clock::now());
+				tracking_ = false;
+
+				stats_.num_steps += t.NumTotalStepsTaken();
+				stats_.num_failed_steps += t.NumFailedStepsTaken();
+				stats_.num_newton_iterations += t.NumNewtonIterations() - newton_iterations_at_start_;
+				stats_.num_jacobian_evaluations += t.NumJacobianEvaluations() - jacobian_evaluations_at_start_;
+				stats_.num_factorizations += t.NumFactorizations() - factorizations_at_start_;
+				stats_.num_avoided_precision_decreases += AvoidedPrecisionDecreases(t, std::integral_constant<bool, TrackerTraits<TrackerT>::IsAdaptivePrec>());
+			}
+
+			static unsigned AvoidedPrecisionDecreases(TrackerT const& t, std::true_type)
+			{
+				return t.NumAvoidedPrecisionDecreases();
+			}
+
+			static unsigned AvoidedPrecisionDecreases(TrackerT const&, std::false_type)
+			{
+				return 0;
+			}
+
+		public:
+
+			/**
+			\brief The stats gathered since construction, or the last Take.
+			*/
+			PathStats const& Stats() const
+			{
+				return stats_;
+			}
+
+			/**
+			\brief Get the stats gathered so far, and start again from zero.
+			*/
+			PathStats Take()
+			{
+				PathStats taken = stats_;
+				stats_ = PathStats();
+				return taken;
+			}
+
+			/**
+			\brief Watch the steps of the following calls to TrackPath for signs of the path going singular, and stop tracking at the first, with RequestStop.  Pass nullptr to stop watching.
+
+			Each sign is measured from the steps of the call so far: the condition number against the smallest it was, and the stepsize against the largest.  Costs a few comparisons per step while watching.
+
+			\param handoff The thresholds of the signs, which must outlive the watching.
+			*/
+			void WatchHandoff(config::EndgameHandoff const* handoff)
+			{
+				handoff_ = handoff;
+			}
+
+			/**
+			\brief The sign which stopped the most recent call to TrackPath while watching, or None if it went on to its end or failed.
+			*/
+			config::HandoffSignal HandoffSignalSeen() const
+			{
+				return signal_;
+			}
+
+		private:
+
+			// called at the first step of a call to TrackPath.
+			void Start(TrackerT const& t)
+			{
+				tracking_ = true;
+				signal_ = config::HandoffSignal::None;
+				watched_precision_increases_ = 0;
+				min_condition_number_ = std::numeric_limits<double>::infinity();
+				max_stepsize_ = 0;
+				last_time_ = Clock::now();
+				precision_ = t.CurrentPrecision();
+				stats_.max_precision = std::max(stats_.max_precision, precision_);
+
+				newton_iterations_at_start_ = t.NumNewtonIterations();
+				jacobian_evaluations_at_start_ = t.NumJacobianEvaluations();
+				factorizations_at_start_ = t.NumFactorizations();
+			}
+
+			// called after each successful step while watching for the handoff.
+			void WatchStep(TrackerT const& t)
+			{
+				if (signal_!=config::HandoffSignal::None)
+					return;
+
+				double condition_number = t.ConditionNumberEstimate(step_precision_);
+				double stepsize = static_cast<double>(t.CurrentStepsize());
+
+				if (handoff_->precision_increases > 0 && watched_precision_increases_ >= handoff_->precision_increases)
+					signal_ = config::HandoffSignal::PrecisionIncrease;
+				else if (condition_number > handoff_->condition_growth * min_condition_number_)
+					signal_ = config::HandoffSignal::ConditionGrowth;
+				else if (stepsize < handoff_->stepsize_collapse * max_stepsize_)
+					signal_ = config::HandoffSignal::StepsizeCollapse;
+
+				if (signal_!=config::HandoffSignal::None)
+				{
+					t.RequestStop();
+					return;
+				}
+
+				if (condition_number > 0)
+					min_condition_number_ = std::min(min_condition_number_, condition_number);
+				max_stepsize_ = std::max(max_stepsize_, stepsize);
+			}
+
+			void ChargeTime(Clock::time_point now)
+			{
+				double seconds = std::chrono::duration<double>(now - last_time_).count();
+				if (precision_==DoublePrecision())
+					stats_.seconds_double += seconds;
+				else
+					stats_.seconds_multiple += seconds;
+				last_time_ = now;
+			}
+
+			PathStats stats_;
+
+			bool tracking_ = false;
+			unsigned precision_ = 0;
+			Clock::time_point last_time_;
+			unsigned long long newton_iterations_at_start_ = 0;
+			unsigned long long jacobian_evaluations_at_start_ = 0;
+			unsigned long long factorizations_at_start_ = 0;
+
+			config::EndgameHandoff const* handoff_ = nullptr; ///< The thresholds of the signs of going singular, if watching for them.
+			config::HandoffSignal signal_ = config::HandoffSignal::None;
+			unsigned step_precision_ = 0; ///< The precision the current step started at.
+			unsigned watched_precision_increases_ = 0; ///< In the current call to TrackPath.
+			double min_condition_number_ = std::numeric_limits<double>::infinity(); ///< Over the steps of the current call to TrackPath.
+			double max_stepsize_ = 0; ///< Over the steps of the current call to TrackPath.
+		};
+
+
+
 		template<class TrackerT>
 		class GoryDetailLogger : public Observer<TrackerT>
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
@@ -117,27 +455,29 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				
+				// nothing here is more severe than debug, so skip the casts when none of it would be written.
+				if (!LogEnabled(severity_level::debug))
+					return;
 
 				if (auto p = dynamic_cast<const Initializing<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
+					BERTINI_LOG(debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
 				}
 				else if (auto p = dynamic_cast<const Initializing<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
+					BERTINI_LOG(debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
 				}
 
 				else if(auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking ended";
+					BERTINI_LOG(trace) << "tracking ended";
 
 				else if (auto p = dynamic_cast<const NewStep<EmitterT>*>(&e))
 				{
 					auto& t = p->Get();
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
+					BERTINI_LOG(trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
 
 					
-					BOOST_LOG_TRIVIAL(severity_level::trace) 
+					BERTINI_LOG(trace) 
 						<< "t = " << t.CurrentTime() 
 						<< "\ncurrent stepsize: " << t.CurrentStepsize() 
 						<< "\ndelta_t = " << t.DeltaT() << "\ncurrent x = "
@@ -147,21 +487,21 @@ namespace bertini {
 
 
 				else if (auto p = dynamic_cast<const SingularStartPoint<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "singular start point";
+					BERTINI_LOG(trace) << "singular start point";
 				else if (auto p = dynamic_cast<const InfinitePathTruncation<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration indicated going to infinity, truncated path";
+					BERTINI_LOG(trace) << "tracker iteration indicated going to infinity, truncated path";
 
 
 
 
 				else if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration successful\n\n\n";
+					BERTINI_LOG(trace) << "tracker iteration successful\n\n\n";
 				}
 				
 				else if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration unsuccessful\n\n\n";
+					BERTINI_LOG(trace) << "tracker iteration unsuccessful\n\n\n";
 				}
 
 
@@ -171,43 +511,43 @@ namespace bertini {
 
 				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "prediction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG(trace) << "prediction successful, result:\n" << p->ResultingPoint();
 				}
 				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "prediction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG(trace) << "prediction successful, result:\n" << p->ResultingPoint();
 				}
 
 				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "correction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG(trace) << "correction successful, result:\n" << p->ResultingPoint();
 				}
 				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "correction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG(trace) << "correction successful, result:\n" << p->ResultingPoint();
 				}
 
 
 				else if (auto p = dynamic_cast<const PredictorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, higher precision necessary";
+					BERTINI_LOG(trace) << "Predictor, higher precision necessary";
 				else if (auto p = dynamic_cast<const CorrectorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, higher precision necessary";				
+					BERTINI_LOG(trace) << "corrector, higher precision necessary";				
 
 
 
 				else if (auto p = dynamic_cast<const CorrectorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, matrix solve failure or failure to converge";				
+					BERTINI_LOG(trace) << "corrector, matrix solve failure or failure to converge";				
 				else if (auto p = dynamic_cast<const PredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "predictor, matrix solve failure or failure to converge";	
+					BERTINI_LOG(trace) << "predictor, matrix solve failure or failure to converge";	
 				else if (auto p = dynamic_cast<const FirstStepPredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, matrix solve failure in initial solve of prediction";	
+					BERTINI_LOG(trace) << "Predictor, matrix solve failure in initial solve of prediction";	
 
 					
 				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "changing precision from " << p->Previous() << " to " << p->Next();
+					BERTINI_LOG(debug) << "changing precision from " << p->Previous() << " to " << p->Next();
 				
 				else
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "unlogged event, of type: " << boost::typeindex::type_id_runtime(e).pretty_name();
+					BERTINI_LOG(debug) << "unlogged event, of type: " << boost::typeindex::type_id_runtime(e).pretty_name();
 			}
 
 			virtual void Visit(TrackerT const& t) override
@@ -236,3 +576,6 @@ namespace bertini {
 	} //re: namespace tracking
 
 }// re: namespace bertini
+
+// version 1 added num_avoided_precision_decreases
+BOOST_CLASS_VERSION(bertini::tracking::PathStats, 1)
@@ -0,0 +1,1752 @@
+//This file is part of Bertini 2.
+//
+//parallel_solver.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_solver.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_solver.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file parallel_solver.hpp
+
+\brief Contains the ParallelSolver type, for tracking all the paths of a homotopy over several threads.
+*/
+
+#ifndef BERTINI_TRACKING_PARALLEL_SOLVER_HPP
+#define BERTINI_TRACKING_PARALLEL_SOLVER_HPP
+
+#include "bertini2/start_system.hpp"
+#include "bertini2/parameter_homotopy.hpp"
+#include "bertini2/straight_line_homotopy.hpp"
+#include "bertini2/system_pool.hpp"
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/endgame.hpp"
+#include "bertini2/tracking/lapack_lu.hpp"
+#include "bertini2/tracking/observers.hpp"
+#include "bertini2/tracking/sharpen.hpp"
+#include "bertini2/detail/work_stealing.hpp"
+#include "bertini2/detail/thread_placement.hpp"
+#include "bertini2/detail/append_log.hpp"
+#include "bertini2/detail/close_points.hpp"
+#include "bertini2/tracking/solution_writer.hpp"
+#include "bertini2/tracking/solve_metrics.hpp"
+#include "bertini2/tracking/step_trace.hpp"
+#include "bertini2/tracking/stop_criteria.hpp"
+
+#include <boost/serialization/traits.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Tracks every path of a homotopy from a start system to a target system, over several threads.
+
+		The homotopy \f$(1-t) f + t g\f$ is formed from the target system \f$f\f$ and the start system \f$g\f$, and each start point is tracked from \f$t=1\f$ to the endgame boundary, after which the endgame is run to \f$t=0\f$.  Or the homotopy is a ParameterHomotopy, and the paths start at the solutions known at its start parameters, so a sweep over target parameters tracks only as many paths as the family has solutions.  The paths are scheduled over a work-stealing pool, so a thread which finishes its share of cheap paths takes paths from threads still busy.
+
+Tracking to the endgame boundary and running the endgame are separate tasks.  When a path reaches the boundary, its endgame is queued with a priority estimating its cost, from the number of steps the tracker took and the arithmetic cost of the precision it ended at.  Endgames are taken before new paths are started, most expensive first, and idle threads steal them, so a few slow high-precision endgames do not leave all but one thread idle at the end of a run.  Likewise the paths are started most expensive first, if their costs are known from a previous solve, see SetPathCosts, or predicted from their start points, see SetPathCostPrediction.
+
+		Each thread owns a deep copy of the homotopy, and its own tracker and endgame, so nothing is shared between threads while tracking except the start system, whose points are generated one at a time under a lock.  The copies are held in a SystemPool, and given back to it when the threads' trackers are made again, after a change of settings, so they are cloned once, not at every change.
+
+		A long run may checkpoint to a log file, see SetCheckpointFile, so that a run which is killed resumes from where it was rather than starting over.  And it may be watched while it runs, by its live counts of paths, steps, and what each thread is doing, see Metrics and SetMetricsFile.
+
+		Once all paths are done, those which crossed another, so are at the same point at the endgame boundary, or jumped onto another, so end at the same nonsingular point, are found with a spatial index and tracked again with tighter settings, see SetPathCrossing.  Only those paths are tracked again, not the whole solve.
+
+		\code
+		auto TD = bertini::start_system::TotalDegree(sys);
+		TD.Homogenize();
+
+		ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-5"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+			});
+		solver.Solve();
+
+		for (auto const& r : solver.Results())
+			if (r.success==SuccessCode::Success)
+				std::cout << r.solution << std::endl;
+		\endcode
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam EndgameType The type of endgame to use.  Defaults to the power series endgame for the tracker type.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class ParallelSolver
+		{
+		public:
+
+			using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			using TrackerSetup = std::function<void(TrackerType &)>;
+			using EndgameFactory = std::function<std::unique_ptr<EndgameType>(TrackerType const&)>;
+
+			/**
+			\brief The outcome of tracking one path.
+
+			Archived at class version 1, which added boundary_time and handoff_signal.  A nested type of a template cannot be given BOOST_CLASS_VERSION, so the version is set by deriving from boost::serialization::traits.
+			*/
+			struct PathResult : boost::serialization::traits<PathResult, boost::serialization::object_class_info, boost::serialization::track_selectively, 1>
+			{
+				size_t path = 0; ///< The index of the start point of the path.
+				SuccessCode success = SuccessCode::Failure; ///< Whether both tracking and the endgame succeeded, or the code of the first to fail.
+				Vec<BaseComplexType> solution; ///< The dehomogenized approximation at t=0 from the endgame.  Empty if tracking to the endgame boundary failed.
+				unsigned cycle_number = 0; ///< The cycle number computed by the endgame.
+				unsigned num_steps_to_boundary = 0; ///< The number of steps, successful or not, taken to reach the endgame boundary.
+				unsigned precision_at_boundary = 0; ///< The precision of the tracker at the endgame boundary.
+				double seconds = 0; ///< The wall time spent tracking the path and running its endgame, not counting time it waited in the queue between them.
+				PathStats stats; ///< Counts of the work done on the path, tracking and in its endgame.
+				EndgameStats endgame_stats; ///< Counts of the samples, loops, and interpolations made by the endgame, and the highest precision it reached.
+				EndgameHint endgame_hint; ///< What the endgame learned about the path, to warm start it in a nearby solve with SetEndgameHints.
+				unsigned num_retracks = 0; ///< The number of times the path was tracked again, having crossed or jumped onto another.  The other fields are of the last time.
+				unsigned num_retries = 0; ///< The number of rungs of the retry ladder the path was tracked again with, having failed.  The seconds are of all the tries, the other fields of the last.
+				SuccessCode first_failure = SuccessCode::Success; ///< The code of the failure of the first try, if the path was retried.
+				unsigned sharpened_digits = 0; ///< The estimated correct digits of the solution, if it was sharpened, see SetSharpening.  Otherwise 0.
+				double condition_number = 0; ///< The tracker's estimate of the condition number of the Jacobian at the last step of the endgame, or of the refinement at 0 of a path without one.  0 if tracking to the endgame boundary failed.
+				BaseComplexType boundary_time = BaseComplexType(0); ///< The time the endgame started at: the endgame boundary, or later for a path handed off automatically.  0 if the path reached 0 without an endgame, or failed before the boundary.
+				config::HandoffSignal handoff_signal = config::HandoffSignal::None; ///< The sign of going singular which started the endgame of a path handed off automatically past the boundary, see SetEndgameHandoff.
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & path;
+					ar & success;
+					ar & solution;
+					ar & cycle_number;
+					ar & num_steps_to_boundary;
+					ar & precision_at_boundary;
+					ar & seconds;
+					ar & stats;
+					ar & endgame_stats;
+					ar & endgame_hint;
+					ar & num_retracks;
+					ar & num_retries;
+					ar & first_failure;
+					ar & sharpened_digits;
+					ar & condition_number;
+					if (version >= 1)
+					{
+						ar & boundary_time;
+						ar & handoff_signal;
+					}
+				}
+			};
+
+			/**
+			\brief The state of a path not yet finished, as checkpointed.
+			*/
+			struct PathProgress
+			{
+				size_t path = 0; ///< The index of the start point of the path.
+				BaseComplexType time; ///< The time reached.
+				Vec<BaseComplexType> point; ///< The point at that time.
+				BaseRealType stepsize; ///< The stepsize the tracker would take next.
+				unsigned precision = 0; ///< The precision of the tracker, and of the point.
+				bool at_boundary = false; ///< Whether the path has reached the endgame boundary, so only its endgame remains.
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & path;
+					ar & time;
+					ar & point;
+					ar & stepsize;
+					ar & precision;
+					ar & at_boundary;
+				}
+			};
+
+
+			/**
+			\brief Set up a solver for a target system, with paths starting at the points of a start system.
+
+			\param target The system to solve.  Must have the same variable structure as the start system, and be homogenized and patched the same way.
+			\param start The start system.  It is referred to, not copied, so must outlive the solver.
+			\param tracker_setup Called once on each thread's tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			ParallelSolver(System const& target, start_system::StartSystem const& start, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				num_start_points_([&start](){ return start.NumStartPoints(); }),
+				start_point_([&start](size_t path){ return start.template StartPoint<BaseComplexType>(path); }),
+				tracker_setup_(tracker_setup),
+				endgame_factory_([](TrackerType const& tracker){ return std::unique_ptr<EndgameType>(new EndgameType(tracker));}),
+				num_threads_(std::max(num_threads, 1u)),
+				endgame_boundary_(0.1)
+			{
+				auto t = std::make_shared<node::Variable>("t");
+				homotopy_ = (1-t)*target + t*start;
+				homotopy_.AddPathVariable(t);
+			}
+
+
+			/**
+			\brief Set up a solver for a parameter homotopy, with paths starting at the solutions known at its start parameters.
+
+			Set the target parameters with SetImplicitParameters before solving.  Moving to another target keeps the threads' copies of the homotopy, with their derivatives and compiled forms, and their trackers and endgames.
+
+			\param homotopy The parameter homotopy.  It is copied.
+			\param start_solutions The solutions of the family at the start parameters of the homotopy.
+			\param tracker_setup Called once on each thread's tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			ParallelSolver(ParameterHomotopy const& homotopy, std::vector<Vec<BaseComplexType>> const& start_solutions, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				homotopy_(homotopy.Homotopy()),
+				num_start_points_([start_solutions](){ return mpz_int(start_solutions.size()); }),
+				start_point_([start_solutions](size_t path){ return start_solutions[path]; }),
+				tracker_setup_(tracker_setup),
+				endgame_factory_([](TrackerType const& tracker){ return std::unique_ptr<EndgameType>(new EndgameType(tracker));}),
+				num_threads_(std::max(num_threads, 1u)),
+				endgame_boundary_(0.1)
+			{}
+
+
+			/**
+			\brief Set up a solver for a parameter homotopy, with paths starting at solutions read in place from a binary solution file, such as by a MappedSolutionFile.
+
+			Each start point is decoded by the thread tracking its path, as the path starts, at the default precision of the solve, so nothing is made up front, and threads do not wait for each other to decode.
+
+			\param homotopy The parameter homotopy.  It is copied.
+			\param start_solutions The solutions of the family at the start parameters of the homotopy, one path for each record.  The view is copied, but the data it reads is referred to, so must outlive the solver.
+			\param tracker_setup Called once on each thread's tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			ParallelSolver(ParameterHomotopy const& homotopy, BinarySolutionView const& start_solutions, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				homotopy_(homotopy.Homotopy()),
+				num_start_points_([start_solutions](){ return mpz_int(start_solutions.NumRecords()); }),
+				start_point_([start_solutions](size_t path)
+					{
+						auto v = start_solutions.template Solution<BaseComplexType>(path);
+						bertini::Precision(v, DefaultPrecision());
+						return v;
+					}),
+				start_points_concurrent_(true),
+				tracker_setup_(tracker_setup),
+				endgame_factory_([](TrackerType const& tracker){ return std::unique_ptr<EndgameType>(new EndgameType(tracker));}),
+				num_threads_(std::max(num_threads, 1u)),
+				endgame_boundary_(0.1)
+			{}
+
+
+			/**
+			\brief Set up a solver for a straight line homotopy, with paths starting at the points of a start system.
+
+			The gamma of the homotopy is the implicit parameter, set to its current value.  Choose another by SetImplicitParameters, which keeps the threads' copies of the homotopy, with their derivatives and compiled forms, and their trackers and endgames.
+
+			\param homotopy The homotopy.  It is copied.
+			\param start The start system the homotopy was made from.  It is referred to, not copied, so must outlive the solver.
+			\param tracker_setup Called once on each thread's tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			ParallelSolver(StraightLineHomotopy const& homotopy, start_system::StartSystem const& start, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				homotopy_(homotopy.Homotopy()),
+				num_start_points_([&start](){ return start.NumStartPoints(); }),
+				start_point_([&start](size_t path){ return start.template StartPoint<BaseComplexType>(path); }),
+				tracker_setup_(tracker_setup),
+				endgame_factory_([](TrackerType const& tracker){ return std::unique_ptr<EndgameType>(new EndgameType(tracker));}),
+				num_threads_(std::max(num_threads, 1u)),
+				endgame_boundary_(0.1)
+			{
+				implicit_parameters_.resize(1);
+				implicit_parameters_(0) = static_cast<BaseComplexType>(homotopy.Gamma());
+				gamma_is_parameter_ = true;
+			}
+
+
+			/**
+			\brief Set the values of the implicit parameters of the homotopy, in it and in each thread's copy of it, for the following Solves.  For a ParameterHomotopy, these are the target parameters.
+
+			The values are read by every evaluation, so this changes nothing else, and the threads are kept.
+			*/
+			void SetImplicitParameters(Vec<BaseComplexType> const& values)
+			{
+				if (static_cast<size_t>(values.size())!=homotopy_.NumImplicitParameters())
+					throw std::runtime_error("number of implicit parameter values (" + std::to_string(values.size()) + ") doesn't match number of implicit parameters of the homotopy (" + std::to_string(homotopy_.NumImplicitParameters()) + ")");
+
+				implicit_parameters_ = values;
+				ApplyImplicitParameters(homotopy_);
+				for (auto& w : workers_)
+					ApplyImplicitParameters(*w->homotopy);
+			}
+
+
+			/**
+			\brief Set how each thread's endgame is made from its tracker, for instance to pass it endgame settings.
+			*/
+			void SetEndgameFactory(EndgameFactory factory)
+			{
+				endgame_factory_ = factory;
+				workers_.clear();
+			}
+
+			/**
+			\brief Send each path's result to a SolutionWriter as soon as it is known, from whichever thread tracked it.  Pass nullptr to stop.
+
+			The writer is not closed by the solver, so several Solves may write to one writer.
+			*/
+			void SetSolutionWriter(std::shared_ptr<SolutionWriter<BaseComplexType>> writer)
+			{
+				solution_writer_ = writer;
+			}
+
+			/**
+			\brief Call a function with each path's result as soon as it is known, for instance to stop early, with Cancel, once there are enough real solutions.  Pass an empty function to stop.
+
+			Called from whichever thread tracked the path, but never from two at once.  Paths stopped by Cancel are not passed to it.
+			*/
+			void SetResultHandler(std::function<void(PathResult const&)> handler)
+			{
+				std::lock_guard<std::mutex> lock(result_handler_mutex_);
+				result_handler_ = handler;
+			}
+
+			/**
+			\brief Stop solving, from any thread, including a result handler.
+
+			Paths being tracked stop at their next step, and paths not yet started are not, so Solve returns soon after, without tracking crossed paths again.  Their results have SuccessCode::ExternallyTerminated, and they are neither written nor checkpointed as finished, so a checkpointed run resumes them.  The solver stays cancelled, and Solve tracks nothing, until Cancel(false).
+			*/
+			void Cancel(bool cancel = true)
+			{
+				cancelled_ = cancel;
+			}
+
+			/**
+			\brief Whether Cancel was called, and not undone.
+			*/
+			bool IsCancelled() const
+			{
+				return cancelled_;
+			}
+
+			/**
+			\brief Stop solving once a predicate of the latest result and the running counts of the solve holds, as for the first few finite, or real, or positive solutions.  Pass an empty function to stop checking.
+
+			Called as each path finishes, after the result handler, never from two threads at once.  Once it holds, the solve is cancelled, see Cancel, and StoppedEarly is true until the next Solve, which tracks the paths it is asked to as usual.  See StopAfter and StopAfterSolutions.
+			*/
+			void SetStopWhen(std::function<bool(PathResult const&, SolveProgress const&)> predicate)
+			{
+				std::lock_guard<std::mutex> lock(result_handler_mutex_);
+				stop_when_ = predicate;
+			}
+
+			/**
+			\brief Whether the most recent Solve was stopped by the predicate of SetStopWhen.
+			*/
+			bool StoppedEarly() const
+			{
+				return stopped_early_;
+			}
+
+			/**
+			\brief The running counts of the most recent Solve.
+			*/
+			SolveProgress const& Progress() const
+			{
+				return progress_;
+			}
+
+			/**
+			\brief Give up on paths whose dehomogenized point at the endgame boundary fails a test, say of lying in a region of no interest, without running their endgames.  Pass an empty function to keep every path.
+
+			Paths given up on have SuccessCode::ExternallyTerminated, with the point at the boundary as their solution.  Paths going to infinity are already given up on by the trackers, see the path truncation threshold.
+			*/
+			void SetBoundaryFilter(std::function<bool(Vec<BaseComplexType> const&)> keep)
+			{
+				boundary_filter_ = keep;
+			}
+
+			/**
+			\brief Checkpoint the run to a log file, and resume from it.  Pass an empty path to stop.
+
+			The log is only appended to.  It gets the result of each path as it finishes, the point of each path as it reaches the endgame boundary, and, every interval seconds, the time, point, stepsize and precision of the path each thread is tracking.  Each entry is small and flushed as it is written, so checkpointing costs little however many paths there are.
+
+			When Solve is called, paths already finished in the log are not tracked again, their results are read from it, paths which reached the endgame boundary go straight to their endgame, and paths in flight resume tracking from their last checkpoint.  A log is only meaningful for the same target system, start system, and settings which wrote it, and on the same type of machine.
+
+			\param file The log.  Need not exist.
+			\param interval_seconds The least time between checkpoints of the path a thread is tracking.
+			*/
+			void SetCheckpointFile(boost::filesystem::path const& file, double interval_seconds = 60)
+			{
+				checkpoint_file_ = file;
+				checkpoint_interval_ = std::chrono::duration<double>(interval_seconds);
+				checkpoint_log_.reset();
+			}
+
+			/**
+			\brief Record every step of every path to a binary step trace file.  Pass an empty path to stop.
+
+			Each thread's tracker gets a StepTraceRecorder, whose records carry the index of the start point of the path, in tracking and in its endgame.  The file is flushed at the end of each Solve, and closed when another is set, or the solver is destroyed.  Read it with ReadStepTrace.
+
+			\param file The trace file.  An existing file is replaced.
+			*/
+			void SetStepTraceFile(boost::filesystem::path const& file)
+			{
+				workers_.clear();
+				step_trace_file_.reset();
+				if (!file.empty())
+					step_trace_file_ = std::make_shared<StepTraceFile>(file);
+			}
+
+			/**
+			\brief Write the live counts of each Solve to a file every interval, as it runs, and once more at its end, for watching a long run from outside, see SolveMetrics.  Pass an empty path to stop.
+
+			Each write replaces the file whole, by renaming a temporary file over it.  For Prometheus, point the textfile collector of the node exporter at a file ending .prom, and alert on, say, a thread long busy without a step.
+
+			\param file The metrics file.  An existing file is replaced.
+			\param interval_seconds The time between writes.
+			\param format JSON, or the Prometheus text format.
+			*/
+			void SetMetricsFile(boost::filesystem::path const& file, double interval_seconds = 10, MetricsFormat format = MetricsFormat::Json)
+			{
+				metrics_file_ = file;
+				metrics_interval_ = std::chrono::duration<double>(interval_seconds);
+				metrics_format_ = format;
+			}
+
+			/**
+			\brief The live counts of the running Solve, or of the most recent one if none is running.  Safe to Take from any thread, at any time.
+
+			Paths finished in the checkpoint log count as finished, paths which crossed another count as in flight again while they are tracked again, and paths in flight when the solve is cancelled count as stopped.
+			*/
+			SolveMetrics const& Metrics() const
+			{
+				return metrics_;
+			}
+
+			/**
+			\brief The number of paths of the most recent Solve which were finished, or reached the endgame boundary, or were in flight, in the checkpoint log when it started.
+			*/
+			size_t NumResumed() const
+			{
+				return num_resumed_;
+			}
+
+			/**
+			\brief Set the time at which tracking stops and the endgame starts.  Defaults to 0.1.
+			*/
+			void SetEndgameBoundary(BaseComplexType const& t)
+			{
+				endgame_boundary_ = t;
+			}
+
+			/**
+			\brief Set where each path stops tracking and starts its endgame.  By default, every path at the endgame boundary.
+
+			Automatically, each path which reaches the boundary is tracked on toward 0 with its worker's PathStatsObserver watching for signs of it going singular, and its endgame starts at the step of the first.  A path with none reaches 0, is refined there, and is finished without an endgame, with cycle number 1.  If tracking past the boundary or the refinement fails, the endgame starts at the boundary, as if by default.
+
+			Paths are still checked for crossing at the boundary, which is where a path checkpointed past it resumes from.
+
+			\code
+			config::EndgameHandoff handoff;
+			handoff.automatic = true;
+			solver.SetEndgameBoundary(0.5);
+			solver.SetEndgameHandoff(handoff);
+			\endcode
+			*/
+			void SetEndgameHandoff(config::EndgameHandoff const& handoff)
+			{
+				handoff_ = handoff;
+			}
+
+			/**
+			\brief Warm start the endgames of the following Solves, one hint per path by index of start point, as recorded in the results of a solve of a nearby system, such as the previous point of a parameter sweep.
+
+			Paths past the end of the hints, and those with default hints, start their endgames cold.  Pass no hints to start them all cold again.
+
+			\code
+			solver.Solve();
+			std::vector<EndgameHint> hints;
+			for (auto const& r : solver.Results())
+				hints.push_back(r.endgame_hint);
+			// ... change the parameters of the target system, and make a new solver for it
+			next_solver.SetEndgameHints(hints);
+			next_solver.Solve();
+			\endcode
+			*/
+			void SetEndgameHints(std::vector<EndgameHint> hints)
+			{
+				endgame_hints_ = std::move(hints);
+			}
+
+			/**
+			\brief Start the paths of the following Solves most expensive first, by their costs in a solve of a nearby system, one per path by index of start point, such as the previous point of a parameter sweep.
+
+			Starting the expensive paths first keeps a hard path from being started last, while the other threads run out of work.  The costs are only compared, so any measure will do, such as the seconds of each path's result.  Paths past the end of the costs, and those of cost 0, are predicted if SetPathCostPrediction is on, or started last otherwise.  Pass no costs to drop them.
+
+			\code
+			solver.Solve();
+			std::vector<double> costs;
+			for (auto const& r : solver.Results())
+				costs.push_back(r.seconds);
+			next_solver.SetPathCosts(costs);
+			\endcode
+			*/
+			void SetPathCosts(std::vector<double> costs)
+			{
+				path_costs_ = std::move(costs);
+			}
+
+			/**
+			\brief Whether to predict the cost of each path whose cost is not set, before starting any, to start the most expensive first.  Off by default.
+
+			Paths starting where the homotopy is badly conditioned, or far from the origin, tend to be harder.  The prediction is the log of the condition number of the Jacobian of the homotopy at the start point, plus the log of one plus its norm, in double precision.  It costs one evaluation of the Jacobian and its singular values per path, spread over the threads.
+			*/
+			void SetPathCostPrediction(bool predict)
+			{
+				predict_path_costs_ = predict;
+			}
+
+			/**
+			\brief Set the ladder of settings with which paths which fail are tracked again, one rung per try.  Empty by default, so failed paths are left failed.
+
+			A path whose tracking or endgame fails with a code which different settings might fix, such as MaxNumStepsTaken, MinStepSizeReached, MaxPrecisionReached, or MatrixSolveFailure, is tracked again from its start point with the next rung, until it succeeds or the rungs run out.  Paths going to infinity are not retried.  The tries are queued below every path not yet started, so failures do not hold up the rest of the run.  Each result records its number of retries and its first failure.
+
+			\code
+			config::Retry<mpfr_float> tighter, drastic;
+			drastic.tracking_tolerance_factor = mpfr_float("1e-3");
+			drastic.change_predictor = true;
+			drastic.predictor = config::Predictor::HeunEuler;
+			drastic.maximum_precision = 1000;
+			solver.SetRetryLadder({tighter, drastic});
+			\endcode
+			*/
+			void SetRetryLadder(std::vector<config::Retry<BaseRealType>> ladder)
+			{
+				retry_ladder_ = std::move(ladder);
+			}
+
+			std::vector<config::Retry<BaseRealType>> const& RetryLadder() const
+			{
+				return retry_ladder_;
+			}
+
+
+			/**
+			\brief Sharpen the solutions of nonsingular endpoints, those of cycle number 1, to many digits, by Newton's method doubling the precision, see tracking::Sharpen, rather than running the endgame to them in high precision.
+
+			Only for multiple precision trackers.  Each sharpened result records its digits.  Solutions which fail to sharpen, as near singular roots, are left as the endgame found them.
+
+			\code
+			config::Sharpening sharpening;
+			sharpening.digits = 100;
+			solver.SetSharpening(sharpening);
+			\endcode
+			*/
+			void SetSharpening(config::Sharpening const& settings)
+			{
+				sharpening_ = settings;
+			}
+
+			config::Sharpening const& SharpeningSettings() const
+			{
+				return sharpening_;
+			}
+
+			/**
+			\brief The number of paths of the most recent Solve which were retried, having failed.
+			*/
+			size_t NumRetried() const
+			{
+				return std::count_if(results_.begin(), results_.end(), [](PathResult const& r){ return r.num_retries > 0; });
+			}
+
+			/**
+			\brief Set how paths which crossed or jumped onto another are found and tracked again.  Set max_num_retracks to 0 to turn it off.
+
+			Both paths of a pair at one point at the endgame boundary, and of a pair ending at one point with cycle number 1, are tracked again from their start points, with the tracking tolerance and the max step size of the trackers scaled by the retrack factors, and their endgames run again.  This repeats, with the settings scaled again each time, until no such pairs are left, or the paths have been tracked again max_num_retracks times.  The trackers are then set back as they were.
+
+			A path ending at a singular point of multiplicity more than one but cycle number 1 is tracked again to no avail, so costs at most max_num_retracks more tracks.
+			*/
+			void SetPathCrossing(config::PathCrossing<BaseRealType> const& settings)
+			{
+				path_crossing_ = settings;
+			}
+
+			config::PathCrossing<BaseRealType> const& PathCrossingSettings() const
+			{
+				return path_crossing_;
+			}
+
+			/**
+			\brief Set which cpus the threads run on, whether each thread's objects are made in the memory of its NUMA node, and whether threads steal from their own node first.  Defaults to leaving the threads to the operating system.
+
+			The threads' trackers and endgames are made again at the next Solve.  Pinning affects the calling thread too, as the first worker, but its cpus are set back when Solve returns.
+			*/
+			void SetThreadPlacement(config::ThreadPlacement const& settings)
+			{
+				placement_ = settings;
+				workers_.clear();
+			}
+
+			config::ThreadPlacement const& ThreadPlacementSettings() const
+			{
+				return placement_;
+			}
+
+			/**
+			\brief The cpu and NUMA node of each thread, as placed for the most recent Solve.  The cpus are -1 if not pinned.
+			*/
+			std::vector<detail::ThreadSlot> const& ThreadSlots() const
+			{
+				return slots_;
+			}
+
+			/**
+			\brief The number of tasks, of tracking a path or running its endgame, which a thread took from another's queue during the most recent Solve.
+			*/
+			size_t NumSteals() const
+			{
+				return num_steals_;
+			}
+
+			/**
+			\brief The number of the steals which took a task from a thread of another NUMA node.  Those tasks' paths were started on the other node, so a high count means the work was unevenly split between nodes.
+			*/
+			size_t NumRemoteSteals() const
+			{
+				return num_remote_steals_;
+			}
+
+			/**
+			\brief The number of paths of the most recent Solve which were tracked again, having crossed or jumped onto another.
+			*/
+			size_t NumRetracked() const
+			{
+				return std::count_if(results_.begin(), results_.end(), [](PathResult const& r){ return r.num_retracks > 0; });
+			}
+
+			unsigned NumThreads() const
+			{
+				return num_threads_;
+			}
+
+			/**
+			\brief The homotopy being tracked.  Dehomogenize points with this system.
+			*/
+			System const& Homotopy() const
+			{
+				return homotopy_;
+			}
+
+
+			/**
+			\brief Track all the paths, blocking until they are done.
+
+			Threads run at the default precision of the calling thread.  If tracking any path throws, the exception is rethrown here once all threads have stopped.  Paths which crossed or jumped onto another are then tracked again, see SetPathCrossing.
+			*/
+			void Solve()
+			{
+				Solve(0, num_start_points_().template convert_to<size_t>());
+			}
+
+			/**
+			\brief Track the paths with start point indices in [first, last), blocking until they are done.
+
+			Use this to split the paths of a large run into pieces, for instance between processes.  The threads' trackers and endgames are kept between calls.
+
+			\param first The index of the first start point to track.
+			\param last One past the index of the last start point to track.
+			*/
+			void Solve(size_t first, size_t last)
+			{
+				if (last < first || mpz_int(last) > num_start_points_())
+					throw std::out_of_range("range of paths to solve must be within the start points of the start system");
+
+				if (static_cast<size_t>(implicit_parameters_.size())!=homotopy_.NumImplicitParameters())
+					throw std::runtime_error("the homotopy has implicit parameters, whose values must be set with SetImplicitParameters before solving");
+
+				first_path_ = first;
+				auto num_paths = last - first;
+				results_.assign(num_paths, PathResult());
+
+				if (stopped_early_)
+				{
+					stopped_early_ = false;
+					cancelled_ = false;
+				}
+				progress_ = SolveProgress();
+				progress_.num_paths = num_paths;
+
+				precision_ = DefaultPrecision();
+				if (workers_.empty())
+					MakeWorkers();
+				if (num_threads_ > 1)
+					SequentialLapack();
+
+				boundary_points_.assign(num_paths, Vec<BaseComplexType>());
+				handoff_points_.assign(num_paths, Vec<BaseComplexType>());
+				retry_gammas_.assign(num_paths, Vec<BaseComplexType>());
+				num_steals_ = 0;
+				num_remote_steals_ = 0;
+
+				std::vector<bool> finished(num_paths, false);
+				resume_points_.clear();
+				num_resumed_ = 0;
+				if (!checkpoint_file_.empty())
+					ReadCheckpoint(finished);
+
+				auto start_priorities = StartPriorities(first, last, finished);
+
+				metrics_.Start(num_paths);
+				detail::WorkStealingQueues<PathTask> queues(num_threads_);
+				for (size_t ii = first; ii < last; ++ii)
+				{
+					if (finished[ii-first])
+					{
+						metrics_.PathStarted();
+						metrics_.PathFinished(results_[ii-first].success, PeakPrecision(results_[ii-first]));
+						continue;
+					}
+
+					if (boundary_points_[ii-first].size()>0)
+					{
+						metrics_.PathStarted();
+						queues.Push(ii % num_threads_, PathTask{ii, true}, 1);
+					}
+					else
+						queues.Push(ii % num_threads_, PathTask{ii, false}, start_priorities[ii-first]);
+				}
+
+				std::unique_ptr<MetricsDumper> metrics_dumper;
+				if (!metrics_file_.empty())
+					metrics_dumper.reset(new MetricsDumper(metrics_, metrics_file_, metrics_format_, metrics_interval_));
+
+				RunTasks(queues);
+
+				resume_points_.clear();
+				if (!cancelled_)
+					RetrackCrossedPaths();
+
+				boundary_points_.clear();
+				handoff_points_.clear();
+				retry_gammas_.clear();
+
+				if (step_trace_file_)
+					step_trace_file_->Flush();
+			}
+
+			/**
+			\brief The results of the most recent Solve, in order of start point.
+			*/
+			std::vector<PathResult> const& Results() const
+			{
+				return results_;
+			}
+
+			/**
+			\brief Write one line per path of the most recent Solve, with the work its endgame did.
+
+			The columns are the path, its success code, cycle number, the endgame's counts as written by EndgameStats, and the seconds the path took.  Compare the counts across paths, and runs, when choosing settings such as the number of sample points and the sample factor.
+			*/
+			void WriteEndgameSummary(std::ostream & out) const
+			{
+				for (auto const& r : results_)
+					out << r.path << " " << int(r.success) << " " << r.cycle_number << " " << r.endgame_stats << " " << r.seconds << "\n";
+			}
+
+			/**
+			\brief For each thread, an estimate of the most memory held by its copy of the homotopy, its tracker, and its endgame, by component.
+
+			Sampled at the end of tracking each path to the endgame boundary, and of each endgame, since the threads were made.  The threads are kept between calls of Solve, so this covers all of them since construction, or since the step trace file was last set.  Use this to choose a number of threads which fits in memory, from a run of a few paths at the intended precision settings.
+			*/
+			std::vector<MemoryReport> PeakThreadMemory() const
+			{
+				std::vector<MemoryReport> peaks;
+				for (auto const& w : workers_)
+					peaks.push_back(w->peak_memory);
+				return peaks;
+			}
+
+		private:
+
+			/**
+			A unit of work: either tracking a path to the endgame boundary, or running its endgame.
+			*/
+			struct PathTask
+			{
+				size_t path;
+				bool is_endgame;
+				unsigned retry = 0; ///< The rung of the retry ladder, counting from 1, or 0 for the first try.
+			};
+
+			/**
+			The objects owned by each thread.  Held by pointer, since the tracker and endgame refer to the homotopy.
+			*/
+			struct Worker
+			{
+				Worker(SystemPool & pool) : pool(pool), homotopy(pool.Acquire())
+				{}
+
+				~Worker()
+				{
+					pool.Release(homotopy);
+				}
+
+				Worker(Worker const&) = delete;
+				Worker& operator=(Worker const&) = delete;
+
+				SystemPool & pool; ///< Where the homotopy came from, and goes back to.
+				std::shared_ptr<System> homotopy; ///< This thread's copy of the homotopy, from the solver's pool.
+				std::unique_ptr<TrackerType> tracker;
+				std::unique_ptr<EndgameType> endgame;
+				std::unique_ptr<AnyObserver> checkpointer;
+				PathStatsObserver<TrackerType> stats;
+				std::unique_ptr<StepTraceRecorder<TrackerType>> trace; ///< Only if recording a step trace.
+
+				unsigned index = 0; ///< The index of the worker, and of its thread.
+				size_t path = 0; ///< The path being tracked.
+				std::chrono::steady_clock::time_point last_checkpoint; ///< When the path being tracked was started, or last checkpointed.
+				MemoryReport peak_memory; ///< The largest sample of the memory held by this worker.
+			};
+
+			/**
+			Watches a worker's tracker, counting its successful steps in the metrics, and checkpointing the path it is tracking after them, at most once an interval.
+			*/
+			class Checkpointer : public Observer<TrackerType>
+			{
+				using EmitterT = typename TrackerTraits<TrackerType>::EventEmitterType;
+
+			public:
+				Checkpointer(ParallelSolver & solver, Worker & worker) : solver_(solver), worker_(worker)
+				{}
+
+				virtual bool Subscribes(std::type_info const& event_type) const override
+				{
+					return event_type==typeid(SuccessfulStep<EmitterT>);
+				}
+
+				virtual void Observe(AnyEvent const& e) override
+				{
+					const SuccessfulStep<EmitterT>* p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e);
+					if (p)
+					{
+						Visit(p->Get());
+					}
+				}
+
+				virtual void Visit(TrackerType const& t) override
+				{
+					solver_.CheckpointInFlight(worker_, t);
+				}
+
+			private:
+				ParallelSolver & solver_;
+				Worker & worker_;
+			};
+
+			/**
+			The kinds of entry in the checkpoint log.
+			*/
+			enum CheckpointKind : std::uint8_t
+			{
+				FinishedPath = 1, ///< A PathResult.
+				InFlightPath = 2 ///< A PathProgress.
+			};
+
+
+			// the trackers evaluate in double precision too, so both are set.
+			void ApplyImplicitParameters(System const& homotopy) const
+			{
+				ApplyImplicitParameters(homotopy, implicit_parameters_);
+			}
+
+			static void ApplyImplicitParameters(System const& homotopy, Vec<BaseComplexType> const& values)
+			{
+				if (values.size()==0)
+					return;
+
+				homotopy.SetImplicitParameters(values);
+				if (!std::is_same<BaseComplexType,dbl>::value)
+					homotopy.SetImplicitParameters(Vec<dbl>(values.template cast<dbl>()));
+			}
+
+
+			// one at a time, since cloning reads the shared homotopy.  replicas given back by workers destroyed before are reused, without cloning.  with pinning, each is made on a thread on the cpu which will use it, so that its memory is in that cpu's node.  the default precision and random numbers of the calling thread are passed along, as if it had made them.
+			void MakeWorkers()
+			{
+				if (!have_replicas_)
+				{
+					replicas_.SetPrototype(homotopy_, 0);
+					have_replicas_ = true;
+				}
+
+				if (placement_.pinning==config::ThreadPinning::None)
+					slots_.assign(num_threads_, detail::ThreadSlot());
+				else
+					slots_ = detail::PlaceThreads(detail::CpuTopology::Detect(), num_threads_, placement_.pinning==config::ThreadPinning::Spread);
+
+				for (unsigned ii = 0; ii < num_threads_; ++ii)
+				{
+					if (slots_[ii].cpu < 0 || !placement_.local_allocation)
+					{
+						workers_.push_back(MakeWorker());
+						continue;
+					}
+
+					auto precision = DefaultPrecision();
+					Philox4x32 engine = RandomEngine();
+					std::exception_ptr error;
+					std::thread maker([&]()
+						{
+							detail::PinThisThread(slots_[ii].cpu);
+							DefaultPrecision(precision);
+							RandomEngine() = engine;
+							try
+							{
+								workers_.push_back(MakeWorker());
+							}
+							catch (...)
+							{
+								error = std::current_exception();
+							}
+							engine = RandomEngine();
+						});
+					maker.join();
+					RandomEngine() = engine;
+
+					if (error)
+						std::rethrow_exception(error);
+				}
+			}
+
+
+			std::unique_ptr<Worker> MakeWorker()
+			{
+				std::unique_ptr<Worker> w(new Worker(replicas_));
+				w->index = static_cast<unsigned>(workers_.size());
+				ApplyImplicitParameters(*w->homotopy);
+				w->tracker.reset(new TrackerType(*w->homotopy));
+				tracker_setup_(*w->tracker);
+				w->tracker->SetStopFlag(&cancelled_);
+				w->endgame = endgame_factory_(*w->tracker);
+				w->checkpointer.reset(new Checkpointer(*this, *w));
+				w->tracker->AddObserver(w->checkpointer.get());
+				w->tracker->AddObserver(&w->stats);
+				if (step_trace_file_)
+				{
+					w->trace.reset(new StepTraceRecorder<TrackerType>(step_trace_file_));
+					w->tracker->AddObserver(w->trace.get());
+				}
+				return w;
+			}
+
+
+			void RunTasks(detail::WorkStealingQueues<PathTask> & queues)
+			{
+				bool pinned = placement_.pinning!=config::ThreadPinning::None;
+				if (pinned && placement_.local_stealing)
+				{
+					std::vector<unsigned> nodes;
+					for (auto const& slot : slots_)
+						nodes.push_back(slot.node);
+					queues.SetGroups(nodes);
+				}
+
+				// the calling thread is the first worker
+				detail::ScopedAffinity calling_thread_cpus;
+
+				detail::RunWorkStealing<PathTask>(queues, [this, &queues](unsigned worker, PathTask const& task)
+					{
+						if (cancelled_)
+						{
+							auto& result = results_[task.path-first_path_];
+							if (task.is_endgame || task.retry > 0 || result.num_retracks > 0)
+								metrics_.PathStopped();
+							result.path = task.path;
+							result.success = SuccessCode::ExternallyTerminated;
+							return;
+						}
+
+						metrics_.TaskStarted(worker, task.path, task.is_endgame ? ThreadActivity::Endgame : ThreadActivity::Tracking, queues.NumQueued(worker));
+						if (task.is_endgame)
+							RunEndgame(*workers_[worker], task, queues, worker);
+						else
+							TrackToBoundary(*workers_[worker], task, queues, worker);
+						metrics_.TaskDone(worker, queues.NumQueued(worker));
+					},
+					[this, pinned](unsigned worker)
+					{
+						if (pinned)
+							detail::PinThisThread(slots_[worker].cpu);
+					});
+
+				num_steals_ += queues.NumSteals();
+				num_remote_steals_ += queues.NumRemoteSteals();
+				metrics_.ClearQueues();
+			}
+
+
+			/**
+			The priority of starting each path, in [0,1) so that every endgame, of priority at least 1, is still taken first.  Increasing in the path's cost, as set, or predicted, or 0.
+			*/
+			std::vector<double> StartPriorities(size_t first, size_t last, std::vector<bool> const& finished)
+			{
+				std::vector<double> costs(last-first, 0);
+				detail::WorkStealingQueues<size_t> to_predict(num_threads_);
+				for (size_t ii = first; ii < last; ++ii)
+				{
+					if (ii < path_costs_.size() && path_costs_[ii] > 0)
+						costs[ii-first] = path_costs_[ii];
+					else if (predict_path_costs_ && !finished[ii-first] && boundary_points_[ii-first].size()==0)
+						to_predict.Push(ii % num_threads_, ii);
+				}
+
+				if (!to_predict.AllDone())
+					detail::RunWorkStealing<size_t>(to_predict, [this, first, &costs](unsigned worker, size_t const& path)
+						{
+							costs[path-first] = PredictCost(*workers_[worker], path);
+						});
+
+				for (auto& c : costs)
+					c = c / (1 + c);
+				return costs;
+			}
+
+
+			/**
+			The log of the condition number of the Jacobian of the homotopy at the start point of a path, plus the log of one plus the norm of the point.  At least 0.
+			*/
+			double PredictCost(Worker & w, size_t path)
+			{
+				DefaultPrecision(precision_);
+
+				Vec<BaseComplexType> start_point;
+				{
+					std::unique_lock<std::mutex> lock(start_point_mutex_, std::defer_lock);
+					if (!start_points_concurrent_)
+						lock.lock();
+					start_point = start_point_(path);
+				}
+				Vec<dbl> x = start_point.template cast<dbl>();
+
+				auto singular_values = Eigen::JacobiSVD< Mat<dbl> >(w.homotopy->Jacobian(x, dbl(1))).singularValues();
+				if (singular_values.size()==0)
+					return 0;
+
+				double largest = singular_values(0), smallest = singular_values(singular_values.size()-1);
+				double log_condition = (smallest > 0 && largest > 0) ? std::log10(largest/smallest) : 300;
+				if (!std::isfinite(log_condition))
+					log_condition = 300;
+				return std::max(0.0, log_condition) + std::log10(1 + x.norm());
+			}
+
+
+			/**
+			Tracks the paths which crossed or jumped onto another again, with the trackers' settings tightened a little more each round, until none are left or the rounds run out.  The trackers are set back as they were after, even if tracking throws.
+			*/
+			void RetrackCrossedPaths()
+			{
+				if (path_crossing_.max_num_retracks==0)
+					return;
+
+				auto const& tracker = *workers_.front()->tracker;
+				const BaseRealType tracking_tolerance = tracker.TrackingTolerance();
+				const config::Stepping<BaseRealType> stepping = tracker.SteppingSettings();
+
+				try
+				{
+					BaseRealType tolerance_scale(1), step_size_scale(1);
+					for (unsigned round = 1; round <= path_crossing_.max_num_retracks; ++round)
+					{
+						auto crossed = CrossedPaths();
+						if (crossed.empty())
+							break;
+
+						BERTINI_LOG(debug) << "retracking " << crossed.size() << " paths which crossed or jumped onto another, round " << round;
+
+						tolerance_scale *= path_crossing_.retrack_tolerance_factor;
+						step_size_scale *= path_crossing_.retrack_step_size_factor;
+						auto tightened = stepping;
+						tightened.max_step_size = stepping.max_step_size * step_size_scale;
+						tightened.initial_step_size = std::min(stepping.initial_step_size, tightened.max_step_size);
+						SetupTrackers(tracking_tolerance * tolerance_scale, tightened);
+
+						detail::WorkStealingQueues<PathTask> queues(num_threads_);
+						for (auto path : crossed)
+						{
+							auto& result = results_[path-first_path_];
+							metrics_.PathReopened(result.success, PeakPrecision(result));
+							metrics_.PathStarted();
+							result.num_retracks = round;
+							queues.Push(path % num_threads_, PathTask{path, false});
+						}
+						RunTasks(queues);
+					}
+				}
+				catch (...)
+				{
+					SetupTrackers(tracking_tolerance, stepping);
+					throw;
+				}
+				SetupTrackers(tracking_tolerance, stepping);
+			}
+
+
+			/**
+			The paths, by index of start point, of the pairs of paths at one point at the endgame boundary, or at one endpoint of cycle number 1.
+			*/
+			std::vector<size_t> CrossedPaths() const
+			{
+				std::set<size_t> crossed;
+				for (auto const& p : detail::ClosePairs(boundary_points_, path_crossing_.boundary_tolerance))
+				{
+					crossed.insert(p.first + first_path_);
+					crossed.insert(p.second + first_path_);
+				}
+
+				std::vector<Vec<BaseComplexType>> endpoints(results_.size());
+				for (size_t ii = 0; ii < results_.size(); ++ii)
+					if (results_[ii].success==SuccessCode::Success && results_[ii].cycle_number==1)
+						endpoints[ii] = results_[ii].solution;
+				for (auto const& p : detail::ClosePairs(endpoints, path_crossing_.endpoint_tolerance))
+				{
+					crossed.insert(p.first + first_path_);
+					crossed.insert(p.second + first_path_);
+				}
+
+				return std::vector<size_t>(crossed.begin(), crossed.end());
+			}
+
+
+			void SetupTrackers(BaseRealType const& tracking_tolerance, config::Stepping<BaseRealType> const& stepping)
+			{
+				for (auto& w : workers_)
+				{
+					auto& tracker = *w->tracker;
+					tracker.Setup(tracker.Predictor(), tracking_tolerance, tracker.PathTruncationThreshold(), stepping, tracker.NewtonSettings());
+				}
+			}
+
+
+			void TrackToBoundary(Worker & w, PathTask const& task, detail::WorkStealingQueues<PathTask> & queues, unsigned worker)
+			{
+				auto started = std::chrono::steady_clock::now();
+				auto path = task.path;
+				DefaultPrecision(precision_);
+				w.homotopy->precision(precision_);
+
+				// the random numbers of a path depend only on its index and try, not on the worker, or the paths before
+				ScopedRandomStream stream(RandomStreamOf(task, false));
+
+				PathResult& result = results_[path-first_path_];
+				result.path = path;
+				result.boundary_time = BaseComplexType(0);
+				result.handoff_signal = config::HandoffSignal::None;
+				handoff_points_[path-first_path_].resize(0);
+				double previous_seconds = task.retry > 0 ? result.seconds : 0;
+				if (task.retry==0 && result.num_retracks==0)
+					metrics_.PathStarted();
+
+				if (task.retry > 0 && retry_ladder_[task.retry-1].new_gamma && gamma_is_parameter_)
+					retry_gammas_[path-first_path_] = Vec<BaseComplexType>::Constant(1, RandomUnit<BaseComplexType>());
+				RetryScope retry_settings(*this, w, task);
+
+				w.path = path;
+				w.last_checkpoint = std::chrono::steady_clock::now();
+				w.tracker->Reset(); // the worker's tracker is kept from path to path, workspace and all
+				w.stats.Take();
+				if (w.trace)
+					w.trace->SetPath(path);
+
+				auto resume = task.retry==0 ? resume_points_.find(path) : resume_points_.end();
+				if (resume!=resume_points_.end())
+				{
+					PathProgress const& progress = resume->second;
+					w.tracker->SetStepSize(progress.stepsize);
+					w.tracker->ReinitializeInitialStepSize(false);
+					result.success = w.tracker->TrackPath(boundary_points_[path-first_path_], progress.time, endgame_boundary_, progress.point);
+					w.tracker->ReinitializeInitialStepSize(true);
+				}
+				else
+				{
+					Vec<BaseComplexType> start_point;
+					{
+						std::unique_lock<std::mutex> lock(start_point_mutex_, std::defer_lock);
+						if (!start_points_concurrent_)
+							lock.lock();
+						start_point = start_point_(path);
+					}
+					result.success = w.tracker->TrackPath(boundary_points_[path-first_path_], BaseComplexType(1), endgame_boundary_, start_point);
+				}
+
+				result.num_steps_to_boundary = w.tracker->NumTotalStepsTaken();
+				result.precision_at_boundary = w.tracker->CurrentPrecision();
+				result.seconds = previous_seconds + std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+				result.stats = w.stats.Take();
+				SampleMemory(w);
+				if (result.success!=SuccessCode::Success)
+				{
+					boundary_points_[path-first_path_].resize(0);
+					if (!Interrupted(result) && !Retry(task, result, queues, worker))
+						Finish(result);
+					return;
+				}
+
+				if (boundary_filter_)
+				{
+					auto point = w.homotopy->DehomogenizePoint(boundary_points_[path-first_path_]);
+					if (!boundary_filter_(point))
+					{
+						result.success = SuccessCode::ExternallyTerminated;
+						result.solution = point;
+						boundary_points_[path-first_path_].resize(0);
+						Finish(result);
+						return;
+					}
+				}
+
+				if (checkpoint_log_)
+				{
+					PathProgress progress;
+					progress.path = path;
+					progress.time = endgame_boundary_;
+					progress.point = boundary_points_[path-first_path_];
+					progress.stepsize = w.tracker->CurrentStepsize();
+					progress.precision = result.precision_at_boundary;
+					progress.at_boundary = true;
+					checkpoint_log_->Append(InFlightPath, progress);
+				}
+
+				result.boundary_time = endgame_boundary_;
+				if (handoff_.automatic && TrackPastBoundary(w, result))
+					return;
+
+				// at least 1, so that every endgame is taken before any path not yet started.
+				double cost = std::max(1.0, result.num_steps_to_boundary * double(ArithmeticCost(result.precision_at_boundary)));
+				queues.Push(worker, PathTask{path, true, task.retry}, cost);
+			}
+
+
+			void RunEndgame(Worker & w, PathTask const& task, detail::WorkStealingQueues<PathTask> & queues, unsigned worker)
+			{
+				auto started = std::chrono::steady_clock::now();
+				auto path = task.path;
+				// kept, to check for paths which crossed once all are done
+				Vec<BaseComplexType> const& at_boundary = boundary_points_[path-first_path_];
+				Vec<BaseComplexType> const& start = handoff_points_[path-first_path_].size() > 0 ? handoff_points_[path-first_path_] : at_boundary;
+
+				auto precision = Precision(start(0));
+				DefaultPrecision(precision);
+				w.homotopy->precision(precision);
+
+				ScopedRandomStream stream(RandomStreamOf(task, true));
+				RetryScope retry_settings(*this, w, task);
+
+				PathResult& result = results_[path-first_path_];
+				w.stats.Take();
+				if (w.trace)
+					w.trace->SetPath(path);
+				w.endgame->Reset();
+				w.endgame->SetHint(path < endgame_hints_.size() ? endgame_hints_[path] : EndgameHint());
+				result.success = w.endgame->Run(result.boundary_time, start);
+				result.cycle_number = w.endgame->CycleNumber();
+				result.condition_number = w.tracker->ConditionNumberEstimate(w.tracker->CurrentPrecision());
+				result.endgame_stats = w.endgame->Stats();
+				result.endgame_hint = w.endgame->RecordHint();
+				result.solution = w.homotopy->DehomogenizePoint(w.endgame->template FinalApproximation<BaseComplexType>());
+				result.sharpened_digits = 0;
+				if (result.success==SuccessCode::Success && sharpening_.digits > 0 && result.cycle_number <= 1)
+					SharpenEndpoint(w, result, w.endgame->template FinalApproximation<BaseComplexType>());
+				result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+				result.stats += w.stats.Take();
+				SampleMemory(w);
+				handoff_points_[path-first_path_].resize(0);
+				if (result.success!=SuccessCode::Success && (Interrupted(result) || Retry(task, result, queues, worker)))
+					return;
+				Finish(result);
+			}
+
+
+			/**
+			Tracks a path on from the endgame boundary toward 0, for SetEndgameHandoff, with the worker's stats watching for signs of it going singular.  At the first, the endgame is set to start where tracking stopped.  A path which reaches 0 and refines there is finished.  Otherwise the endgame is left to start at the boundary.
+
+			\return Whether the path is done, finished or stopped by Cancel, so needs no endgame.
+			*/
+			bool TrackPastBoundary(Worker & w, PathResult & result)
+			{
+				auto started = std::chrono::steady_clock::now();
+				auto index = result.path-first_path_;
+
+				Vec<BaseComplexType> endpoint;
+				SuccessCode code;
+				{
+					HandoffScope watching(w, handoff_);
+					code = w.tracker->TrackPath(endpoint, endgame_boundary_, BaseComplexType(0), boundary_points_[index]);
+				}
+				result.stats += w.stats.Take();
+
+				if (code==SuccessCode::ExternallyTerminated && Interrupted(result))
+				{
+					result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+					return true;
+				}
+
+				auto signal = w.stats.HandoffSignalSeen();
+				if (code==SuccessCode::ExternallyTerminated && signal!=config::HandoffSignal::None)
+				{
+					auto& handoff_point = handoff_points_[index];
+					handoff_point = w.tracker->CurrentPoint();
+					if (w.homotopy->IsPatched())
+						w.homotopy->RescalePointToFitPatchInPlace(handoff_point); // in case the tracker switched patches
+					result.boundary_time = w.tracker->CurrentTime();
+					result.handoff_signal = signal;
+				}
+				else if (code==SuccessCode::Success && RefineAtOrigin(w, result, endpoint))
+				{
+					result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+					SampleMemory(w);
+					Finish(result);
+					return true;
+				}
+
+				result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+				return false;
+			}
+
+
+			/**
+			Refines the endpoint of a path which reached 0 without an endgame, and if it converges, makes it the solution of the result, sharpened if set.
+
+			\return Whether the refinement converged.
+			*/
+			bool RefineAtOrigin(Worker & w, PathResult & result, Vec<BaseComplexType> const& endpoint)
+			{
+				auto precision = Precision(endpoint(0));
+				DefaultPrecision(precision);
+				w.homotopy->precision(precision);
+
+				Vec<BaseComplexType> refined;
+				BaseComplexType origin(0);
+				auto code = w.tracker->Refine(refined, endpoint, origin, BaseRealType(handoff_.refinement_tolerance), handoff_.max_refinement_iterations);
+				if (code!=SuccessCode::Success)
+					return false;
+
+				result.success = SuccessCode::Success;
+				result.boundary_time = BaseComplexType(0);
+				result.cycle_number = 1;
+				result.condition_number = w.tracker->ConditionNumberEstimate(w.tracker->CurrentPrecision());
+				result.endgame_stats = EndgameStats();
+				result.endgame_hint = EndgameHint();
+				result.solution = w.homotopy->DehomogenizePoint(refined);
+				result.sharpened_digits = 0;
+				if (sharpening_.digits > 0)
+					SharpenEndpoint(w, result, refined);
+				return true;
+			}
+
+
+			/**
+			Sets a worker's stats watching for the handoff, and its tracker continuing with the stepsize it has, for its lifetime, setting them back after.
+			*/
+			class HandoffScope
+			{
+			public:
+				HandoffScope(Worker & w, config::EndgameHandoff const& handoff) : w_(w)
+				{
+					w.stats.WatchHandoff(&handoff);
+					w.tracker->ReinitializeInitialStepSize(false);
+				}
+
+				~HandoffScope()
+				{
+					w_.stats.WatchHandoff(nullptr);
+					w_.tracker->ReinitializeInitialStepSize(true);
+				}
+
+				HandoffScope(HandoffScope const&) = delete;
+				HandoffScope& operator=(HandoffScope const&) = delete;
+
+			private:
+				Worker & w_;
+			};
+
+
+			/**
+			Sharpen the approximation of a nonsingular endpoint to the digits wanted, in the homotopy at t=0, replacing the solution of the result if it converges.
+			*/
+			void SharpenEndpoint(Worker & w, PathResult & result, Vec<mpfr> approximation)
+			{
+				auto sharpened = Sharpen(*w.homotopy, approximation, mpfr(0), sharpening_.digits, sharpening_);
+				if (!sharpened.converged)
+					return;
+
+				DefaultPrecision(sharpened.final_precision);
+				w.homotopy->precision(sharpened.final_precision);
+				result.solution = w.homotopy->DehomogenizePoint(approximation);
+				result.sharpened_digits = sharpened.digits;
+			}
+
+			// in double precision, there are no more digits to sharpen to
+			void SharpenEndpoint(Worker &, PathResult &, Vec<dbl> const&)
+			{}
+
+
+			/**
+			The random numbers of each try of tracking a path, and of its endgame, are drawn from a stream of their own.
+			*/
+			static std::uint64_t RandomStreamOf(PathTask const& task, bool is_endgame)
+			{
+				return (std::uint64_t(task.retry) << 48) + 2*std::uint64_t(task.path) + (is_endgame ? 1 : 0);
+			}
+
+
+			/**
+			Whether different settings might get a path past a failure.  Paths going to infinity, or stopped on purpose, are where they should be.
+			*/
+			static bool IsRetryable(SuccessCode code)
+			{
+				switch (code)
+				{
+					case SuccessCode::Success:
+					case SuccessCode::GoingToInfinity:
+					case SuccessCode::SecurityMaxNormReached:
+					case SuccessCode::ExternallyTerminated:
+					case SuccessCode::MinTrackTimeReached:
+						return false;
+					default:
+						return true;
+				}
+			}
+
+
+			/**
+			Whether a failed path was stopped by Cancel, in which case it is marked so, counted as stopped, and neither retried nor finished.  Since the endgames report failing to track as they see fit, any failure after Cancel counts.
+			*/
+			bool Interrupted(PathResult & result)
+			{
+				if (!cancelled_)
+					return false;
+				result.success = SuccessCode::ExternallyTerminated;
+				metrics_.PathStopped();
+				return true;
+			}
+
+
+			/**
+			Queues the next try of a failed path, below every path not yet started, if it has a rung of the retry ladder left.
+
+			\return Whether it was queued.
+			*/
+			bool Retry(PathTask const& task, PathResult & result, detail::WorkStealingQueues<PathTask> & queues, unsigned worker)
+			{
+				if (task.retry >= retry_ladder_.size() || !IsRetryable(result.success))
+					return false;
+
+				if (task.retry==0)
+					result.first_failure = result.success;
+				result.num_retries = task.retry + 1;
+
+				BERTINI_LOG(debug) << "path " << task.path << " failed with code " << int(result.success) << ", retrying with rung " << task.retry+1 << " of the retry ladder";
+				queues.Push(worker, PathTask{task.path, false, task.retry+1}, -1.0 - task.retry);
+				return true;
+			}
+
+
+			// only the adaptive precision tracker has a maximum precision
+			template<typename T>
+			static unsigned MaximumPrecision(T const&)
+			{
+				return 0;
+			}
+
+			static unsigned MaximumPrecision(AMPTracker const& tracker)
+			{
+				return tracker.PrecisionSettings().maximum_precision;
+			}
+
+			template<typename T>
+			static void SetMaximumPrecision(T &, unsigned)
+			{}
+
+			static void SetMaximumPrecision(AMPTracker & tracker, unsigned precision)
+			{
+				auto settings = tracker.PrecisionSettings();
+				settings.maximum_precision = precision;
+				tracker.PrecisionSetup(settings);
+			}
+
+
+			/**
+			Sets a worker's tracker, and homotopy, to a rung of the retry ladder for its lifetime, setting them back after.  Does nothing for first tries.
+			*/
+			class RetryScope
+			{
+			public:
+				RetryScope(ParallelSolver & solver, Worker & w, PathTask const& task) : solver_(solver), w_(w), active_(task.retry > 0)
+				{
+					if (!active_)
+						return;
+
+					auto& tracker = *w.tracker;
+					predictor_ = tracker.Predictor();
+					tracking_tolerance_ = tracker.TrackingTolerance();
+					stepping_ = tracker.SteppingSettings();
+					maximum_precision_ = MaximumPrecision(tracker);
+
+					auto const& rung = solver.retry_ladder_[task.retry-1];
+					auto stepping = stepping_;
+					stepping.max_step_size = stepping_.max_step_size * rung.max_step_size_factor;
+					stepping.initial_step_size = std::min(stepping_.initial_step_size, stepping.max_step_size);
+					stepping.max_num_steps = stepping_.max_num_steps * rung.max_num_steps_factor;
+					tracker.Setup(rung.change_predictor ? rung.predictor : predictor_, tracking_tolerance_ * rung.tracking_tolerance_factor, tracker.PathTruncationThreshold(), stepping, tracker.NewtonSettings());
+					if (rung.maximum_precision > maximum_precision_)
+						SetMaximumPrecision(tracker, rung.maximum_precision);
+
+					auto const& gamma = solver.retry_gammas_[task.path-solver.first_path_];
+					if (gamma.size() > 0)
+						ApplyImplicitParameters(*w.homotopy, gamma);
+				}
+
+				~RetryScope()
+				{
+					if (!active_)
+						return;
+
+					auto& tracker = *w_.tracker;
+					tracker.Setup(predictor_, tracking_tolerance_, tracker.PathTruncationThreshold(), stepping_, tracker.NewtonSettings());
+					SetMaximumPrecision(tracker, maximum_precision_);
+					solver_.ApplyImplicitParameters(*w_.homotopy);
+				}
+
+				RetryScope(RetryScope const&) = delete;
+				RetryScope& operator=(RetryScope const&) = delete;
+
+			private:
+				ParallelSolver & solver_;
+				Worker & w_;
+				bool active_;
+				config::Predictor predictor_;
+				BaseRealType tracking_tolerance_;
+				config::Stepping<BaseRealType> stepping_;
+				unsigned maximum_precision_ = 0;
+			};
+
+
+			/**
+			Keeps the worker's memory, if more than its peak so far.
+			*/
+			void SampleMemory(Worker & w)
+			{
+				MemoryReport sample;
+				sample.Add("system: ", w.homotopy->MemoryUsage());
+				sample.Add("tracker: ", w.tracker->MemoryUsage());
+				sample.Add("endgame: ", w.endgame->MemoryUsage());
+				if (sample.Total() > w.peak_memory.Total())
+					w.peak_memory = std::move(sample);
+			}
+
+
+			/**
+			The highest precision a path reached, tracking or in its endgame.
+			*/
+			static unsigned PeakPrecision(PathResult const& result)
+			{
+				return std::max({result.precision_at_boundary, result.stats.max_precision, result.endgame_stats.peak_precision});
+			}
+
+
+			/**
+			Puts a finished path in the checkpoint log, the solution writer and the result handler, if there are any, counts it, and stops the solve if the predicate of SetStopWhen holds.
+			*/
+			void Finish(PathResult const& result)
+			{
+				metrics_.PathFinished(result.success, PeakPrecision(result));
+				if (checkpoint_log_)
+					checkpoint_log_->Append(FinishedPath, result);
+				WriteSolution(result);
+
+				std::lock_guard<std::mutex> lock(result_handler_mutex_);
+				progress_.Add(result.success);
+				if (result_handler_)
+					result_handler_(result);
+				if (stop_when_ && !cancelled_ && stop_when_(result, progress_))
+				{
+					stopped_early_ = true;
+					cancelled_ = true;
+				}
+			}
+
+
+			/**
+			Called by a worker's Checkpointer after each successful step.
+			*/
+			void CheckpointInFlight(Worker & w, TrackerType const& tracker)
+			{
+				metrics_.Step(w.index);
+				if (!checkpoint_log_)
+					return;
+
+				auto now = std::chrono::steady_clock::now();
+				if (now - w.last_checkpoint < checkpoint_interval_)
+					return;
+				w.last_checkpoint = now;
+
+				PathProgress progress;
+				progress.path = w.path;
+				progress.time = tracker.CurrentTime();
+				progress.point = tracker.CurrentPoint();
+				progress.stepsize = tracker.CurrentStepsize();
+				progress.precision = tracker.CurrentPrecision();
+				checkpoint_log_->Append(InFlightPath, progress);
+			}
+
+
+			/**
+			Reads the checkpoint log into the results, boundary points, and points to resume from, and opens it for appending.  Later entries for a path supersede earlier ones.
+			*/
+			void ReadCheckpoint(std::vector<bool> & finished)
+			{
+				auto first = first_path_, last = first_path_ + results_.size();
+				std::map<size_t, PathProgress> in_flight;
+
+				detail::AppendLog::Read(checkpoint_file_, [&](std::uint8_t kind, boost::archive::binary_iarchive & ar)
+					{
+						if (kind==FinishedPath)
+						{
+							PathResult r;
+							ar >> r;
+							if (r.path >= first && r.path < last)
+							{
+								finished[r.path-first] = true;
+								results_[r.path-first] = std::move(r);
+							}
+						}
+						else if (kind==InFlightPath)
+						{
+							PathProgress p;
+							ar >> p;
+							if (p.path >= first && p.path < last)
+								in_flight[p.path] = std::move(p);
+						}
+					});
+
+				num_resumed_ = std::count(finished.begin(), finished.end(), true);
+				for (auto& p : in_flight)
+				{
+					auto index = p.first-first;
+					if (finished[index])
+						continue;
+
+					++num_resumed_;
+
+					if (p.second.at_boundary)
+					{
+						results_[index].path = p.first;
+						results_[index].precision_at_boundary = p.second.precision;
+						results_[index].boundary_time = p.second.time;
+						boundary_points_[index] = std::move(p.second.point);
+					}
+					else
+						resume_points_.insert(std::move(p));
+				}
+
+				if (!checkpoint_log_)
+					checkpoint_log_.reset(new detail::AppendLog(checkpoint_file_));
+			}
+
+
+			void WriteSolution(PathResult const& result)
+			{
+				if (!solution_writer_)
+					return;
+
+				SolutionRecord<BaseComplexType> record;
+				record.path = result.path;
+				record.success = result.success;
+				record.cycle_number = result.cycle_number;
+				record.solution = result.solution;
+				solution_writer_->Write(std::move(record));
+			}
+
+
+			System homotopy_; ///< The homotopy from the start system to the target, from which each thread's copy is made.
+			SystemPool replicas_; ///< The threads' copies of the homotopy, taken by the workers and given back when they are destroyed.  Declared before the workers, so outlives them.
+			bool have_replicas_ = false; ///< Whether the homotopy has been given to replicas_, at the first making of the workers.
+			std::function<mpz_int()> num_start_points_; ///< The number of paths, asked of the start system at each Solve, since some gain points after construction.
+			std::function<Vec<BaseComplexType>(size_t)> start_point_; ///< Makes the start point of a path, from a start system, which is referred to, from solutions, which are copied, or from a solution file, read in place.
+			std::mutex start_point_mutex_; ///< Guards generation of start points, which evaluates the start system.
+			bool start_points_concurrent_ = false; ///< Whether start points may be made by many threads at once, without start_point_mutex_.
+			Vec<BaseComplexType> implicit_parameters_; ///< The values of the implicit parameters of the homotopy, set in each thread's copy of it.
+
+			TrackerSetup tracker_setup_;
+			EndgameFactory endgame_factory_;
+
+			unsigned num_threads_;
+			BaseComplexType endgame_boundary_;
+			config::EndgameHandoff handoff_; ///< Where each path starts its endgame, at the boundary or chosen per path.
+			std::vector<EndgameHint> endgame_hints_; ///< The warm start of each path's endgame, by index of start point.
+			std::vector<double> path_costs_; ///< The cost of each path in a previous solve, by index of start point, to start the most expensive first.
+			bool predict_path_costs_ = false; ///< Whether to predict the costs of paths without one set.
+			unsigned precision_; ///< The default precision of the thread calling Solve.
+
+			std::vector< std::unique_ptr<Worker> > workers_;
+			std::vector<PathResult> results_;
+			size_t first_path_ = 0; ///< The index of the first path of the most recent Solve, which is at the front of the results.
+			std::vector< Vec<BaseComplexType> > boundary_points_; ///< The point at the endgame boundary for each path, held until the end of the Solve, to find paths which crossed.  Empty for paths which failed before it.
+			std::vector< Vec<BaseComplexType> > handoff_points_; ///< The point past the boundary at which each path handed off automatically to its endgame, held until the endgame has run.  Empty for the rest.
+			config::PathCrossing<BaseRealType> path_crossing_; ///< How paths which crossed or jumped onto another are found and tracked again.
+			std::vector<config::Retry<BaseRealType>> retry_ladder_; ///< The settings of each try of a failed path after the first.
+			config::Sharpening sharpening_; ///< How the solutions of nonsingular endpoints are sharpened.  Not, by default.
+			std::vector< Vec<BaseComplexType> > retry_gammas_; ///< The gamma of the latest try of each path, if a rung chose a new one, for its endgame.  Empty otherwise.
+			bool gamma_is_parameter_ = false; ///< Whether the implicit parameter of the homotopy is the gamma of a straight line homotopy.
+			config::ThreadPlacement placement_; ///< Where the threads run.
+			std::vector<detail::ThreadSlot> slots_; ///< Where each thread runs, chosen when the workers are made.
+			size_t num_steals_ = 0, num_remote_steals_ = 0; ///< Counted over the most recent Solve, including retracks.
+			std::shared_ptr<SolutionWriter<BaseComplexType>> solution_writer_; ///< Where results go as they are made, if anywhere.
+			std::function<void(PathResult const&)> result_handler_; ///< Called with each result as it is made, if set.
+			std::function<bool(PathResult const&, SolveProgress const&)> stop_when_; ///< Stops the solve once it holds, if set.
+			std::function<bool(Vec<BaseComplexType> const&)> boundary_filter_; ///< Which paths to run the endgame of, if set.
+			SolveProgress progress_; ///< The running counts of the most recent Solve.
+			std::atomic<bool> stopped_early_{false}; ///< Whether stop_when_ cancelled the most recent Solve.
+			std::mutex result_handler_mutex_; ///< Keeps the result handler, the stopping predicate, and the counts to one thread at a time.
+			std::atomic<bool> cancelled_{false}; ///< Set by Cancel, read by the workers between paths and by their trackers between steps.
+
+			boost::filesystem::path checkpoint_file_; ///< The checkpoint log, or empty if not checkpointing.
+			std::chrono::duration<double> checkpoint_interval_{60};
+			std::unique_ptr<detail::AppendLog> checkpoint_log_; ///< The checkpoint log, open for appending once a Solve has read it.
+			std::map<size_t, PathProgress> resume_points_; ///< The last checkpoint of each path in flight when the log was read, only read while tracking.
+			size_t num_resumed_ = 0;
+
+			std::shared_ptr<StepTraceFile> step_trace_file_; ///< Where each thread's tracker records its steps, if anywhere.
+
+			SolveMetrics metrics_{num_threads_}; ///< The live counts of the running, or most recent, Solve.
+			boost::filesystem::path metrics_file_; ///< Where the metrics are written during each Solve, or empty if nowhere.
+			std::chrono::duration<double> metrics_interval_{10};
+			MetricsFormat metrics_format_ = MetricsFormat::Json;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
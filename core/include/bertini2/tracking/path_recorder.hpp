@@ -0,0 +1,577 @@
+//This file is part of Bertini 2.
+//
+//path_recorder.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_recorder.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_recorder.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file path_recorder.hpp
+
+\brief Provides PathRecorder, an observer which keeps the points of the paths a tracker tracks, thinned and within a memory budget, and PathTraceFile, the binary file it writes them to when the budget is used up.
+
+Where AMPPathAccumulator keeps a multiple precision copy of every accepted point for as long as it lives, a PathRecorder keeps points in double precision unless asked for more, only those where the path does something worth seeing, and never more than its budget of them, so paths can be recorded in production runs, and a path which jumped looked at afterwards.
+*/
+
+#ifndef BERTINI_TRACKING_PATH_RECORDER_HPP
+#define BERTINI_TRACKING_PATH_RECORDER_HPP
+
+#include "bertini2/tracking/events.hpp"
+#include "bertini2/tracking/base_tracker.hpp"
+#include "bertini2/memory_usage.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/type_index.hpp>
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief One point of a path, as kept by a PathRecorder.
+		*/
+		struct RecordedPoint
+		{
+			std::uint64_t path = 0; ///< As set on the recorder, such as the index of the start point.
+			std::uint32_t step = 0; ///< The number of steps taken in the call to TrackPath, counting the one which reached this point.
+			unsigned precision = 0; ///< The precision the point was tracked at, in digits.
+			dbl time; ///< The time at the point, rounded to double.
+			Vec<dbl> point; ///< The point, rounded to double.
+			Vec<mpfr> point_mp; ///< The point, at the precision it was tracked at.  Empty unless the recorder keeps multiple precision.
+
+			/**
+			\brief The bytes the point takes, with its vectors.
+			*/
+			std::size_t Bytes() const
+			{
+				return sizeof(RecordedPoint) + memory::HeapBytes(point) + memory::HeapBytes(point_mp);
+			}
+		};
+
+
+		/**
+		\brief The layout of binary path trace files.
+
+		A file is a FileHeader, followed by points, in the byte order of the machine which wrote it.  Each point is a PointHeader, then the real and imaginary parts of its coordinates rounded to double, then, if its digits are not 0, the real and imaginary parts of its coordinates at that many digits, each as a 32-bit length followed by that many characters of its decimal representation.  Points of different paths are interleaved in the order their recorders wrote them out.  A file cut short by a crash ends at most with part of a point, which readers ignore.
+		*/
+		namespace path_trace{
+
+			const char Magic[8] = {'B','2','P','A','T','H','\0','\0'};
+			const std::uint32_t Version = 1;
+
+			struct FileHeader
+			{
+				char magic[8];
+				std::uint32_t version;
+				std::uint32_t reserved;
+			};
+
+			struct PointHeader
+			{
+				std::uint64_t path;
+				double time_real;
+				double time_imag;
+				std::uint32_t step;
+				std::uint32_t precision; ///< The precision the point was tracked at.
+				std::uint32_t dimension;
+				std::uint32_t digits; ///< The precision of the multiple precision coordinates which follow those in double.  0 if there are none.
+			};
+
+			static_assert(sizeof(FileHeader)==16 && sizeof(PointHeader)==40, "path trace headers must have the sizes of the format");
+		} // re: namespace path_trace
+
+
+
+		/**
+		\brief A binary file of points of paths, written to by PathRecorders when their memory budgets are used up.
+
+		Each Write appends whole points under a lock, so one file may be shared by the recorders of many threads.  Unlike a StepTraceFile, there is no background thread: the points are written by the thread whose recorder is full, which happens once per memory budget of points, rather than once per step.
+
+		\code
+		auto file = std::make_shared<PathTraceFile>("paths.b2path");
+		PathRecorder<AMPTracker> recorder;
+		recorder.SetSink(file);
+		tracker.AddObserver(&recorder);
+
+		recorder.SetPath(0);
+		tracker.TrackPath(result, t_start, t_end, start_point);
+
+		recorder.Flush();
+		file->Close();
+		auto points = ReadPathTrace("paths.b2path");
+		\endcode
+		*/
+		class PathTraceFile
+		{
+		public:
+
+			/**
+			\param file The trace file.  An existing file is replaced.
+
+			\throws std::runtime_error If the file cannot be opened.
+			*/
+			explicit
+			PathTraceFile(boost::filesystem::path const& file)
+			{
+				out_.open(file.string(), std::ios::binary | std::ios::trunc);
+				if (!out_)
+					throw std::runtime_error("unable to open path trace file " + file.string());
+
+				path_trace::FileHeader h{};
+				std::memcpy(h.magic, path_trace::Magic, sizeof(h.magic));
+				h.version = path_trace::Version;
+				out_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+			}
+
+			PathTraceFile(PathTraceFile const&) = delete;
+			PathTraceFile& operator=(PathTraceFile const&) = delete;
+
+			/**
+			\brief Append points to the file.
+
+			\throws std::runtime_error If the file is closed, or cannot be written.
+			*/
+			void Write(std::vector<RecordedPoint> const& points)
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (!out_.is_open())
+					throw std::runtime_error("writing to a closed path trace file");
+
+				for (auto const& p : points)
+					WritePoint(p);
+				out_.flush();
+				if (!out_)
+					throw std::runtime_error("failed writing path trace file");
+				num_written_ += points.size();
+			}
+
+			/**
+			\brief Close the file.  Later writes throw.
+			*/
+			void Close()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (out_.is_open())
+					out_.close();
+			}
+
+			/**
+			\brief The number of points written to the file so far.
+			*/
+			unsigned long long NumWritten() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return num_written_;
+			}
+
+		private:
+
+			// called with the lock held.
+			void WritePoint(RecordedPoint const& p)
+			{
+				path_trace::PointHeader h{};
+				h.path = p.path;
+				h.time_real = p.time.real();
+				h.time_imag = p.time.imag();
+				h.step = p.step;
+				h.precision = p.precision;
+				h.dimension = static_cast<std::uint32_t>(p.point.size());
+				h.digits = p.point_mp.size() ? p.point_mp(0).precision() : 0;
+				out_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+				out_.write(reinterpret_cast<char const*>(p.point.data()), p.point.size()*sizeof(dbl));
+
+				if (!h.digits)
+					return;
+				for (int ii = 0; ii < p.point_mp.size(); ++ii)
+				{
+					WriteNumber(p.point_mp(ii).real());
+					WriteNumber(p.point_mp(ii).imag());
+				}
+			}
+
+			void WriteNumber(mpfr_float const& x)
+			{
+				const auto text = x.str(0, std::ios::scientific);
+				const auto length = static_cast<std::uint32_t>(text.size());
+				out_.write(reinterpret_cast<char const*>(&length), sizeof(length));
+				out_.write(text.data(), length);
+			}
+
+			std::ofstream out_;
+			mutable std::mutex mutex_; ///< Guards the file and the count.
+			unsigned long long num_written_ = 0;
+		};
+
+
+
+		/**
+		\brief Read the points of a path trace file.  Multiple precision coordinates are read at the precision they were written at.
+
+		\throws std::runtime_error If the file cannot be read, or is not a path trace file of this version.  A file cut short by a crash is read up to its last complete point.
+		*/
+		inline
+		std::vector<RecordedPoint> ReadPathTrace(boost::filesystem::path const& file)
+		{
+			std::ifstream in(file.string(), std::ios::binary);
+			if (!in)
+				throw std::runtime_error("unable to open path trace file " + file.string());
+
+			path_trace::FileHeader h;
+			if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+				throw std::runtime_error("path trace file too short for its header");
+			if (std::memcmp(h.magic, path_trace::Magic, sizeof(h.magic))!=0 || h.version!=path_trace::Version)
+				throw std::runtime_error("not a path trace file of this version");
+
+			auto read_number = [&in](mpfr_float & x)
+				{
+					std::uint32_t length;
+					if (!in.read(reinterpret_cast<char*>(&length), sizeof(length)))
+						return false;
+					std::string text(length, ' ');
+					if (!in.read(&text[0], length))
+						return false;
+					x = mpfr_float(text.c_str());
+					return true;
+				};
+
+			const auto previous_precision = DefaultPrecision();
+			std::vector<RecordedPoint> points;
+			path_trace::PointHeader p;
+			while (in.read(reinterpret_cast<char*>(&p), sizeof(p)))
+			{
+				RecordedPoint r;
+				r.path = p.path;
+				r.step = p.step;
+				r.precision = p.precision;
+				r.time = dbl(p.time_real, p.time_imag);
+				r.point.resize(p.dimension);
+				if (!in.read(reinterpret_cast<char*>(r.point.data()), p.dimension*sizeof(dbl)))
+					break;
+
+				if (p.digits)
+				{
+					DefaultPrecision(p.digits);
+					r.point_mp.resize(p.dimension);
+					bool complete = true;
+					for (std::uint32_t ii = 0; ii < p.dimension && complete; ++ii)
+					{
+						mpfr_float re, im;
+						complete = read_number(re) && read_number(im);
+						r.point_mp(ii) = mpfr(re, im);
+					}
+					if (!complete)
+						break;
+				}
+
+				points.push_back(std::move(r));
+			}
+			DefaultPrecision(previous_precision);
+			return points;
+		}
+
+
+
+		/**
+		\brief Keeps the points of the paths a tracker tracks, thinned as set in a config::PathRecording, within a budget of memory.
+
+		Only the points of successful steps are kept.  With the default Curvature decimation, a point is kept where the secant from the last kept point to it and the secant from it to the next point turn by more than the turning angle, or where the precision changes, as well as the first and last point of each call to TrackPath, so the points lie thick where the path bends, as where it nears another and may jump to it, and thin where it runs straight.  Each step costs one copy of the point in double precision, into storage reused from step to step; a multiple precision copy only if multiple precision is kept.
+
+		When the points kept take more than the memory budget, they are written to the PathTraceFile set with SetSink, and forgotten.  Without one, every other point is dropped, and the decimation made twice as coarse, so a recorder left on for a long run holds a sample of every path, rather than running out of memory.
+
+		Attach one recorder to each tracker, and set the path before tracking it, so its points can be told apart from those of other paths.
+
+		\code
+		config::PathRecording settings;
+		settings.memory_budget = 16 << 20;
+		PathRecorder<AMPTracker> recorder(settings);
+		tracker.AddObserver(&recorder);
+		recorder.SetPath(7);
+		tracker.TrackPath(result, t_start, t_end, start_point);
+		auto points = recorder.Take();
+		\endcode
+
+		\see PathTraceFile, ReadPathTrace
+		*/
+		template<class TrackerT>
+		class PathRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+		public:
+
+			explicit
+			PathRecorder(config::PathRecording const& settings = config::PathRecording()) : settings_(settings)
+			{
+				settings_.every_kth = std::max(settings_.every_kth, 1u);
+			}
+
+			/**
+			\brief Write the points to a file when the memory budget is used up, rather than thinning them.  Pass null to thin them again.
+			*/
+			void SetSink(std::shared_ptr<PathTraceFile> const& file)
+			{
+				sink_ = file;
+			}
+
+			/**
+			\brief Set the path the following points belong to.
+			*/
+			void SetPath(std::uint64_t path)
+			{
+				path_ = path;
+			}
+
+			/**
+			\brief The settings, with the decimation as coarsened by thinning.
+			*/
+			config::PathRecording const& Settings() const
+			{
+				return settings_;
+			}
+
+			/**
+			\brief The points kept in memory, those written to the sink excepted.
+			*/
+			std::vector<RecordedPoint> const& Points() const
+			{
+				return points_;
+			}
+
+			/**
+			\brief Get the points kept in memory, and start again with none.
+			*/
+			std::vector<RecordedPoint> Take()
+			{
+				std::vector<RecordedPoint> taken;
+				taken.swap(points_);
+				bytes_ = 0;
+				return taken;
+			}
+
+			/**
+			\brief Write the points kept in memory to the sink, if there is one.
+
+			\throws std::runtime_error If the sink cannot be written.
+			*/
+			void Flush()
+			{
+				if (!sink_ || points_.empty())
+					return;
+				sink_->Write(points_);
+				points_.clear();
+				bytes_ = 0;
+			}
+
+			/**
+			\brief The bytes taken by the points kept in memory.
+			*/
+			std::size_t MemoryBytes() const
+			{
+				return bytes_;
+			}
+
+			/**
+			\brief The number of successful steps seen.
+			*/
+			unsigned long long NumSteps() const
+			{
+				return num_steps_;
+			}
+
+			/**
+			\brief The number of times the points were thinned to fit the memory budget, for lack of a sink.
+			*/
+			unsigned NumThinnings() const
+			{
+				return num_thinnings_;
+			}
+
+			virtual bool Subscribes(std::type_info const& event_type) const override
+			{
+				return event_type==typeid(SuccessfulStep<EmitterT>)
+				    || event_type==typeid(TrackingEnded<EmitterT>);
+			}
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				auto const& type = typeid(e);
+
+				if (type==typeid(SuccessfulStep<EmitterT>))
+					Visit(static_cast<const SuccessfulStep<EmitterT>&>(e).Get());
+				else if (type==typeid(TrackingEnded<EmitterT>))
+				{
+					// the last point of the call is kept, whatever the decimation
+					if (has_pending_)
+						Keep(pending_);
+					has_pending_ = false;
+					call_steps_ = 0;
+				}
+			}
+
+			/**
+			Considers the point of the step just taken.
+			*/
+			virtual void Visit(TrackerT const& t) override
+			{
+				++num_steps_;
+				++call_steps_;
+
+				auto& c = candidate_;
+				c.path = path_;
+				c.step = t.NumTotalStepsTaken();
+				c.precision = t.CurrentPrecision();
+				c.time = ToDbl(t.CurrentTime());
+				t.CurrentPointInto(c.point);
+				if (settings_.multiple_precision)
+					t.CurrentPointInto(c.point_mp);
+
+				bool keep_candidate = call_steps_==1, keep_pending = false;
+				switch (settings_.decimation)
+				{
+					case config::PathDecimation::None:
+						keep_candidate = true; break;
+					case config::PathDecimation::EveryKth:
+						keep_candidate = keep_candidate || call_steps_ % settings_.every_kth == 0; break;
+					case config::PathDecimation::Curvature:
+						keep_pending = has_pending_ && (pending_.precision!=kept_precision_ || Turns(kept_point_, pending_.point, c.point)); break;
+				}
+
+				if (keep_pending)
+					Keep(pending_);
+
+				if (keep_candidate)
+				{
+					Keep(c);
+					has_pending_ = false;
+				}
+				else
+				{
+					std::swap(pending_, candidate_);
+					has_pending_ = true;
+				}
+			}
+
+		private:
+
+			static dbl ToDbl(dbl const& z)
+			{
+				return z;
+			}
+
+			static dbl ToDbl(mpfr const& z)
+			{
+				return static_cast<dbl>(z);
+			}
+
+			// whether the path turns by more than the turning angle at b, coming from a and going to c
+			bool Turns(Vec<dbl> const& a, Vec<dbl> const& b, Vec<dbl> const& c) const
+			{
+				double dot = 0, norm_u = 0, norm_v = 0;
+				for (int ii = 0; ii < b.size(); ++ii)
+				{
+					const dbl u = b(ii) - a(ii), v = c(ii) - b(ii);
+					dot += std::real(std::conj(u)*v);
+					norm_u += std::norm(u);
+					norm_v += std::norm(v);
+				}
+				if (norm_u==0 || norm_v==0)
+					return false;
+				return dot < std::cos(settings_.turning_angle) * std::sqrt(norm_u*norm_v);
+			}
+
+			void Keep(RecordedPoint const& p)
+			{
+				points_.push_back(p);
+				bytes_ += p.Bytes();
+				kept_point_ = p.point;
+				kept_precision_ = p.precision;
+
+				if (bytes_ > settings_.memory_budget)
+					MakeRoom();
+			}
+
+			// write out the points if there is a sink, or else drop every other one and coarsen the decimation
+			void MakeRoom()
+			{
+				if (sink_)
+				{
+					Flush();
+					return;
+				}
+
+				++num_thinnings_;
+				std::size_t kept = 0;
+				bytes_ = 0;
+				for (std::size_t ii = 0; ii < points_.size(); ii += 2)
+				{
+					bytes_ += points_[ii].Bytes();
+					if (kept!=ii)
+						std::swap(points_[kept], points_[ii]);
+					++kept;
+				}
+				points_.resize(kept);
+
+				switch (settings_.decimation)
+				{
+					case config::PathDecimation::None:
+						settings_.decimation = config::PathDecimation::EveryKth;
+						settings_.every_kth = 2; break;
+					case config::PathDecimation::EveryKth:
+						settings_.every_kth *= 2; break;
+					case config::PathDecimation::Curvature:
+						settings_.turning_angle = std::min(2*settings_.turning_angle, std::acos(-1.0)); break;
+				}
+			}
+
+			config::PathRecording settings_;
+			std::shared_ptr<PathTraceFile> sink_;
+			std::uint64_t path_ = 0;
+
+			std::vector<RecordedPoint> points_; ///< The points kept, in the order they were reached.
+			std::size_t bytes_ = 0; ///< The bytes of points_.
+
+			RecordedPoint candidate_; ///< The point of the current step.  Its storage is reused.
+			RecordedPoint pending_; ///< The point of the step before, not yet kept nor dropped, as that depends on the current step.
+			bool has_pending_ = false;
+			Vec<dbl> kept_point_; ///< The last point kept.
+			unsigned kept_precision_ = 0; ///< The precision of the last point kept.
+			unsigned call_steps_ = 0; ///< The successful steps of the current call to TrackPath.
+
+			unsigned long long num_steps_ = 0;
+			unsigned num_thinnings_ = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
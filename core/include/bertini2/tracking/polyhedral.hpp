@@ -0,0 +1,101 @@
+//This file is part of Bertini 2.
+//
+//polyhedral.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polyhedral.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polyhedral.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file polyhedral.hpp
+
+\brief Contains SolvePolyhedral, which finds the start points of a polyhedral start system by tracking the homotopies of its mixed cells.
+*/
+
+#ifndef BERTINI_TRACKING_POLYHEDRAL_HPP
+#define BERTINI_TRACKING_POLYHEDRAL_HPP
+
+#include "bertini2/start_system.hpp"
+#include "bertini2/tracking/tracker.hpp"
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Finds the start points of a polyhedral start system, by tracking the homotopy of each of its mixed cells from the solutions of the cell's binomial system.
+
+		The endpoints replace the start points of the start system, after which it is a start system like any other, for the homotopy from it to the target system, tracked by the same trackers and endgames.
+
+		The homotopies have real powers of t, which are computed through its logarithm, so undefined at 0, and the paths are tracked from a small positive start time, from the binomial solutions refined there by Newton's method.  The paths end at t=1, away from any singularity for generic coefficients, so need no endgame.
+
+		\code
+		start_system::Polyhedral G(target, num_threads);
+		auto num_failed = SolvePolyhedral<AMPTracker>(G, [](AMPTracker & tracker, System const& homotopy)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+				tracker.PrecisionSetup(config::AMPConfigFrom(homotopy));
+			});
+		\endcode
+
+		\tparam TrackerT The type of tracker, such as AMPTracker.
+		\param start_system The polyhedral start system.  Its start points are replaced by the endpoints of the successful paths.
+		\param configure Called with each tracker, and the homotopy it tracks, to set it up before tracking.
+		\param start_time The small positive time at which to begin tracking.
+		\param num_newton_iterations The number of Newton iterations refining the binomial solutions at the start time.
+		\return The number of paths which failed, so MixedVolume less NumStartPoints.
+		*/
+		template<typename TrackerT, typename ConfigureT>
+		unsigned SolvePolyhedral(start_system::Polyhedral & start_system, ConfigureT const& configure, double start_time = 1e-12, unsigned num_newton_iterations = 3)
+		{
+			using BaseComplexType = typename TrackerTraits<TrackerT>::BaseComplexType;
+
+			start_system.ClearStartPoints();
+			auto t = std::make_shared<node::Variable>("t");
+			const BaseComplexType t0(start_time), t1(1);
+
+			unsigned num_failed = 0;
+			for (unsigned cell = 0; cell < start_system.Cells().size(); ++cell)
+			{
+				auto homotopy = start_system.CellHomotopy(cell, t);
+				TrackerT tracker(homotopy);
+				configure(tracker, homotopy);
+
+				for (auto y : start_system.template CellStartPoints<BaseComplexType>(cell))
+				{
+					for (unsigned ii = 0; ii < num_newton_iterations; ++ii)
+						y -= homotopy.Jacobian(y, t0).lu().solve(homotopy.Eval(y, t0));
+
+					Vec<BaseComplexType> endpoint;
+					if (tracker.TrackPath(endpoint, t0, t1, y)==SuccessCode::Success)
+						start_system.AddStartPoint(endpoint);
+					else
+						++num_failed;
+				}
+			}
+
+			return num_failed;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,176 @@
+//This file is part of Bertini 2.
+//
+//post_processing.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//post_processing.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with post_processing.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file post_processing.hpp
+
+\brief Contains ClusterSolutions, which gathers the endpoints of a solve into distinct solutions, with their multiplicities, and classifies them as real, finite, and singular.
+*/
+
+#ifndef BERTINI_TRACKING_POST_PROCESSING_HPP
+#define BERTINI_TRACKING_POST_PROCESSING_HPP
+
+#include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/detail/close_points.hpp"
+
+#include <numeric>
+#include <vector>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief A distinct solution of a system, and the paths ending at it.
+		*/
+		template<typename ComplexType>
+		struct ClusteredSolution
+		{
+			Vec<ComplexType> solution; ///< The endpoint of the first of the paths.
+			std::vector<size_t> paths; ///< The paths ending at the solution, in increasing order.
+			unsigned multiplicity = 0; ///< The number of paths ending at the solution.
+			unsigned cycle_number = 0; ///< The largest cycle number of the paths.
+			bool is_real = false; ///< Whether every coordinate has imaginary part within the real threshold.
+			bool is_finite = false; ///< Whether the norm is within the endpoint finite threshold.
+			bool is_singular = false; ///< Whether more than one path ends at the solution, or any with cycle number more than 1.
+		};
+
+
+		/**
+		\brief Gathers endpoints into distinct solutions, and classifies them.
+
+		Endpoints within final_tol_times_mult of each other are one solution, as are chains of them.  The close pairs are found with a spatial index, see detail::ClosePairs, so this takes \f$O(n \log n)\f$ operations in the number of endpoints, rather than the \f$O(n^2)\f$ of comparing every pair, and the comparisons are shared between threads.
+
+		\param endpoints The dehomogenized endpoints, as made by System::DehomogenizePoint.  Empty ones, such as those of failed paths, are skipped.
+		\param cycle_numbers The cycle number of each endpoint's path, as computed by the endgame.  May be empty, for all 1.
+		\param settings The thresholds for clustering and classifying.
+		\param num_threads The number of threads to compare endpoints on.
+		\return The distinct solutions, in order of their first path.  The paths are indices into the endpoints.
+		*/
+		template<typename ComplexType, typename RealType>
+		std::vector<ClusteredSolution<ComplexType>> ClusterSolutions(std::vector<Vec<ComplexType>> const& endpoints, std::vector<unsigned> const& cycle_numbers, config::PostProcessing<RealType> const& settings, unsigned num_threads = 1)
+		{
+			using std::abs;
+			using std::imag;
+
+			// union-find, with each path pointing towards the first path of its cluster
+			std::vector<size_t> parent(endpoints.size());
+			std::iota(parent.begin(), parent.end(), 0);
+			auto root = [&parent](size_t ii)
+				{
+					while (parent[ii]!=ii)
+						ii = parent[ii] = parent[parent[ii]];
+					return ii;
+				};
+
+			for (auto const& p : detail::ClosePairs(endpoints, settings.final_tol_times_mult, num_threads))
+			{
+				auto a = root(p.first), b = root(p.second);
+				if (a < b)
+					parent[b] = a;
+				else if (b < a)
+					parent[a] = b;
+			}
+
+			std::vector<ClusteredSolution<ComplexType>> solutions;
+			std::vector<size_t> solution_of(endpoints.size());
+			for (size_t ii = 0; ii < endpoints.size(); ++ii)
+			{
+				if (endpoints[ii].size()==0)
+					continue;
+
+				auto r = root(ii);
+				if (r==ii)
+				{
+					solution_of[ii] = solutions.size();
+					solutions.emplace_back();
+					solutions.back().solution = endpoints[ii];
+				}
+
+				auto& s = solutions[solution_of[r]];
+				s.paths.push_back(ii);
+				++s.multiplicity;
+				s.cycle_number = std::max(s.cycle_number, ii < cycle_numbers.size() ? cycle_numbers[ii] : 1u);
+			}
+
+			for (auto& s : solutions)
+			{
+				s.is_real = true;
+				for (int jj = 0; jj < s.solution.size(); ++jj)
+					if (abs(imag(s.solution(jj))) > settings.real_threshold)
+					{
+						s.is_real = false;
+						break;
+					}
+				s.is_finite = s.solution.norm() <= settings.endpoint_finite_threshold;
+				s.is_singular = s.multiplicity > 1 || s.cycle_number > 1;
+			}
+
+			return solutions;
+		}
+
+
+		/**
+		\brief Gathers the successful paths of a solve into distinct solutions, and classifies them.
+
+		\code
+		solver.Solve();
+		auto solutions = ClusterResults(solver.Results(), config::PostProcessing<mpfr_float>(), solver.NumThreads());
+		for (auto const& s : solutions)
+			if (s.is_finite && !s.is_singular)
+				std::cout << s.solution << std::endl;
+		\endcode
+
+		\param results The results of a solve, such as ParallelSolver::Results.  Those not successful are skipped.
+		\param settings The thresholds for clustering and classifying.
+		\param num_threads The number of threads to compare endpoints on.
+		\return The distinct solutions, as from ClusterSolutions, but with the paths being the indices of the start points, PathResult::path.
+		*/
+		template<typename PathResultType, typename RealType>
+		auto ClusterResults(std::vector<PathResultType> const& results, config::PostProcessing<RealType> const& settings, unsigned num_threads = 1)
+		{
+			using ComplexType = typename std::decay<decltype(results.front().solution(0))>::type;
+
+			std::vector<Vec<ComplexType>> endpoints(results.size());
+			std::vector<unsigned> cycle_numbers(results.size());
+			for (size_t ii = 0; ii < results.size(); ++ii)
+				if (results[ii].success==SuccessCode::Success)
+				{
+					endpoints[ii] = results[ii].solution;
+					cycle_numbers[ii] = results[ii].cycle_number;
+				}
+
+			auto solutions = ClusterSolutions(endpoints, cycle_numbers, settings, num_threads);
+			for (auto& s : solutions)
+				for (auto& p : s.paths)
+					p = results[p].path;
+			return solutions;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
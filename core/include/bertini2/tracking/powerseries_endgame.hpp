@@ -117,7 +117,7 @@ Vec<ComplexT> result;
 //4. Track all points to 0.1
 for (unsigned ii = 0; ii < TD_start_sys.NumStartPoints(); ++ii)
 {
-    mpfr_float::default_precision(ambient_precision);
+    DefaultPrecision(ambient_precision);
     my_homotopy.precision(ambient_precision); // making sure our precision is all set up 
     auto start_point = TD_start_sys.StartPoint<ComplexT>(ii);
 
@@ -221,8 +221,34 @@ protected:
 	*/
 	mutable Vec<BCT> rand_vector;
 
+	/**
+	\brief For each candidate cycle number c, a Hermite interpolator of the newest samples in the s-plane, where s = t^(1/c).  Updated as samples are added, by UpdateInterpolators.
+	*/
+	mutable std::tuple< std::vector< HermiteInterpolator<UsedNumTs> >... > interpolators_;
+
+	/**
+	\brief The number of samples pushed into the interpolators, and the highest precision among them, which the interpolators are at.  The interpolators are rebuilt when the samples are set or cleared, or that precision changes.
+	*/
+	mutable std::size_t num_interpolated_samples_ = 0;
+	mutable unsigned interpolated_precision_ = 0;
+	mutable bool interpolators_stale_ = true;
+
 public:
 
+	/**
+	\brief An estimate of the memory held by the endgame, by component, including its samples at their current precision.
+	*/
+	MemoryReport MemoryUsage() const
+	{
+		using memory::HeapBytes;
+
+		auto report = EndgameBase<TrackerType, FinalPSEG>::MemoryUsage();
+		report.Add("samples", HeapBytes(times_) + HeapBytes(samples_) + HeapBytes(derivatives_) + HeapBytes(rand_vector));
+		report.Add("interpolation", HeapBytes(interpolators_));
+		return report;
+	}
+
+
 	auto UpperBoundOnCycleNumber() const { return upper_bound_on_cycle_number_;}
 
 	const config::PowerSeries& PowerSeriesSettings() const
@@ -238,13 +264,23 @@ public:
 	{
 		std::get<TimeCont<CT> >(times_).clear(); 
 		std::get<SampCont<CT> >(samples_).clear();
+		interpolators_stale_ = true;
+	}
+
+	/**
+	\brief Forget the path run on last, in each type of number used, keeping the settings and the storage of the samples.  Run does this itself, for the type of number it runs in; a driver running many paths with one endgame may call it between them.
+	*/
+	void Reset()
+	{
+		(void)std::initializer_list<int>{(ClearTimesAndSamples<UsedNumTs>(), 0)...};
+		this->ResetPathState();
 	}
 
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set;}
+	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set; interpolators_stale_ = true;}
 
 	/**
 	\brief Function to get the times used for the Power Series endgame.
@@ -256,7 +292,7 @@ public:
 	\brief Function to set the space values used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set;}
+	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set; interpolators_stale_ = true;}
 
 	/**
 	\brief Function to get the space values used for the Power Series endgame.
@@ -264,11 +300,17 @@ public:
 	template<typename CT>
 	auto GetSamples() const {return std::get<SampCont<CT> >(samples_);}
 
+	/**
+	\brief Function to set the derivatives dx/dt at the samples, one per sample, so that they need not be computed from the system.
+	*/
+	template<typename CT>
+	void SetDerivatives(SampCont<CT> derivatives_to_set) { std::get<SampCont<CT> >(derivatives_) = derivatives_to_set; interpolators_stale_ = true;}
+
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	// */	
 	template<typename CT>
-	void SetRandVec(Vec<CT> sample) {rand_vector = Vec<CT>::Random(sample.size());}
+	void SetRandVec(Vec<CT> sample) {rand_vector = RandomOfUnits<CT>(sample.size());}
 
 
 
@@ -371,6 +413,7 @@ public:
 		##Details:
 				\tparam CT The complex number type.
 			This is done by an exhaustive search from 1 to upper_bound_on_cycle_number. There is a conversion to the s-space from t-space in this function. 
+			The search is skipped if the previous cycle number predicts the newest sample better than its neighbors by the factor cycle_number_seed_margin in the power series settings.
 	As a by-product the derivatives at each of the samples is returned for further use. 
 	*/
 
@@ -383,9 +426,9 @@ public:
 		ComputeBoundOnCycleNumber<CT>();
 
 
-		SampCont<CT> samples = std::get<SampCont<CT> >(samples_); // take a copy...  replace this asap with something that doesn't copy the data...
-			const auto& times   = std::get<TimeCont<CT> >(times_);
-			const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
+		const auto& samples = std::get<SampCont<CT> >(samples_);
+		const auto& times   = std::get<TimeCont<CT> >(times_);
+		const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
 
@@ -397,9 +440,11 @@ public:
 		assert((samples.size() >= this->EndgameSettings().num_sample_points) && "must have sufficiently many sample points");
 
 		
-		const Vec<CT> most_recent_sample = samples.back();  // take a copy of the vector
-		samples.pop_back();// again, this should be replaced by something that doesn't need a copy of the samples
-		const CT most_recent_time = times.back();
+		UpdateInterpolators<CT>();
+		const auto& interpolators = std::get<std::vector<HermiteInterpolator<CT> > >(interpolators_);
+
+		const Vec<CT>& most_recent_sample = samples.back();
+		const CT& most_recent_time = times.back();
 
 		//Now we actually compute the Cycle Number
 
@@ -409,32 +454,47 @@ public:
 		//if there are less samples than num_sample_points return samples.size() otherwise return num_sample_points.
 		
 
-		unsigned num_used_points = samples.size() < this->EndgameSettings().num_sample_points 
+		unsigned num_used_points = samples.size()-1 < this->EndgameSettings().num_sample_points 
 									?
-								   samples.size() : this->EndgameSettings().num_sample_points ;
+								   samples.size()-1 : this->EndgameSettings().num_sample_points ;
 
-		unsigned offset = samples.size() - num_used_points;
-		auto min_found_difference = Eigen::NumTraits<RT>::highest();
-
-		TimeCont<CT> s_times(num_used_points);
-		SampCont<CT> s_derivatives(num_used_points);
+		// the distance from the newest sample to its prediction from the ones before it, for a candidate.  each is computed at most once.
+		Vec<CT> prediction;
+		std::vector<RT> differences(upper_bound_on_cycle_number_);
+		std::vector<bool> tried(upper_bound_on_cycle_number_, false);
+		auto Difference = [&](unsigned candidate) -> RT const&
+		{
+			if (!tried[candidate-1])
+			{
+				BERTINI_LOG(trace) << "testing cycle candidate " << candidate;
+				++this->stats_.num_cycle_number_trials;
+				++this->stats_.num_hermite_interpolations;
+
+				using std::pow;
+				interpolators[candidate-1].Evaluate(prediction, pow(most_recent_time,static_cast<RT>(1)/candidate), num_used_points, 1);
+				differences[candidate-1] = (prediction - most_recent_sample).norm();
+				tried[candidate-1] = true;
+			}
+			return differences[candidate-1];
+		};
 
+		// samples shift by one between calls, so the cycle number rarely changes.  keep the previous one if it is clearly better than its neighbors.
+		const unsigned previous = this->CycleNumber();
+		const auto margin = power_series_settings_.cycle_number_seed_margin;
+		if (margin > 0 && previous >= 1 && previous <= upper_bound_on_cycle_number_)
+		{
+			const RT seeded = Difference(previous) * margin;
+			if ((previous==1 || seeded < Difference(previous-1)) && (previous==upper_bound_on_cycle_number_ || seeded < Difference(previous+1)))
+			{
+				BERTINI_LOG(trace) << "cycle number kept at " << previous;
+				return this->cycle_number_;
+			}
+		}
 
+		auto min_found_difference = Eigen::NumTraits<RT>::highest();
 		for(unsigned int candidate = 1; candidate <= upper_bound_on_cycle_number_; ++candidate)
 		{			
-			BOOST_LOG_TRIVIAL(severity_level::trace) << "testing cycle candidate " << candidate;
-
-			for(unsigned int ii=0; ii<num_used_points; ++ii)// using the last sample to predict to. 
-			{   using std::pow;
-				s_times[ii] = pow(times[ii+offset],1/static_cast<RT>(candidate));
-				s_derivatives[ii] = derivatives[ii+offset] * (candidate * pow(times[ii+offset], static_cast<RT>(candidate-1)/candidate));
-			}
-
-			RT curr_diff = (HermiteInterpolateAndSolve(
-			                      pow(most_recent_time,static_cast<RT>(1)/candidate), // the target time
-			                      num_used_points,s_times,samples,s_derivatives) // the input data
-			                 - 
-			                 most_recent_sample).norm();
+			RT const& curr_diff = Difference(candidate);
 
 			if (curr_diff < min_found_difference)
 			{
@@ -443,7 +503,7 @@ public:
 			}
 
 		}// end cc loop over cycle number possibilities
-		BOOST_LOG_TRIVIAL(severity_level::trace) << "cycle number computed to be " << this->CycleNumber();
+		BERTINI_LOG(trace) << "cycle number computed to be " << this->CycleNumber();
 
 		return this->cycle_number_;
 	}//end ComputeCycleNumber
@@ -470,20 +530,99 @@ public:
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
 
-		if (TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
+		//Compute dx_dt for each sample, at the precision of the sample.
+		derivatives.clear(); derivatives.resize(samples.size());
+		for(unsigned ii = 0; ii < samples.size(); ++ii)
 		{
-			auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples);
-			this->GetSystem().precision(max_precision);
+			if (TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
+				this->GetSystem().precision(Precision(samples[ii]));
+		 	derivatives[ii] = PathDerivative(samples[ii],times[ii]);
 		}
+	}
 
-		//Compute dx_dt for each sample.
-		derivatives.clear(); derivatives.resize(samples.size());
-		for(unsigned ii = 0; ii < samples.size(); ++ii)
-		{	
-			// uses LU look at Eigen documentation on inverse in Eigen/LU.
-		 	derivatives[ii] = -(this->GetSystem().Jacobian(samples[ii],times[ii]).inverse())*(this->GetSystem().TimeDerivative(samples[ii],times[ii]));
+
+	/**
+		\brief The derivative dx/dt of the path through a sample, solving (dH/dx) dx/dt = -dH/dt.
+
+		The Jacobian and the time derivative come from one evaluation of the system, and are solved with an LU factorization rather than an inverse.  Each sample needs this only once: AdvanceTime computes it for the new sample, and keeps the ones before.
+
+		\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	Vec<CT> PathDerivative(Vec<CT> const& sample, CT const& time) const
+	{
+		const auto& sys = this->GetSystem();
+		Mat<CT> dh_dx(sys.NumTotalFunctions(), sys.NumVariables());
+		Vec<CT> dh_dt(sys.NumTotalFunctions());
+		sys.JacobianAndTimeDerivativeInPlace(dh_dx, dh_dt, sample, time);
+		Vec<CT> dx_dt = dh_dx.lu().solve(dh_dt);
+		return -dx_dt;
+	}
+	/**
+		\brief Bring the interpolators for each candidate cycle number up to date with the samples.
+
+		The samples added since the last update are converted to the s-plane for each candidate, and pushed.  If the samples were set or cleared, the highest precision among those interpolated changed, the upper bound on the cycle number grew, or the number of sample points changed, the interpolators are rebuilt from the newest samples instead.
+
+		Each holds one more than the number of sample points, so the cycle number can be computed by predicting the newest sample from the ones before it.
+
+		The samples keep the precisions they were computed at.  The interpolators are where they meet: each is at the highest precision among the samples it holds, and a sample of lower precision is raised to it only as a copy, when pushed.  So a sample dropped before the precision grows is never raised at all.
+
+		\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	void UpdateInterpolators()
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::pow;
+
+		const auto& samples = std::get<SampCont<CT> >(samples_);
+		const auto& times   = std::get<TimeCont<CT> >(times_);
+		const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
+		auto& interpolators = std::get<std::vector<HermiteInterpolator<CT> > >(interpolators_);
+
+		assert(samples.size()==derivatives.size() && "must have a derivative for each sample");
+
+		const unsigned capacity = this->EndgameSettings().num_sample_points+1;
+		const std::size_t first_interpolated = samples.size() > capacity ? samples.size()-capacity : 0;
+		unsigned precision = 0;
+		for (auto ii = first_interpolated; ii < samples.size(); ++ii)
+			precision = std::max(precision, Precision(samples[ii]));
+
+		if (interpolators_stale_ || interpolators.empty() || num_interpolated_samples_ > samples.size() || precision != interpolated_precision_
+		    || interpolators.size() < upper_bound_on_cycle_number_ || interpolators.front().Capacity() != capacity)
+		{
+			interpolators.resize(std::max<std::size_t>(interpolators.size(), upper_bound_on_cycle_number_));
+			for (auto& interp : interpolators)
+				interp.Reset(capacity, samples.back().size());
+			num_interpolated_samples_ = first_interpolated;
+			interpolated_precision_ = precision;
+			interpolators_stale_ = false;
+		}
+
+		if (TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
+			DefaultPrecision(precision);
+
+		CT time;
+		Vec<CT> sample, derivative;
+		for (; num_interpolated_samples_ < samples.size(); ++num_interpolated_samples_)
+		{
+			const auto ii = num_interpolated_samples_;
+			const bool raise = Precision(samples[ii]) != precision || Precision(derivatives[ii]) != precision || Precision(times[ii]) != precision;
+			if (raise)
+			{
+				time = times[ii]; sample = samples[ii]; derivative = derivatives[ii];
+				Precision(time, precision); Precision(sample, precision); Precision(derivative, precision);
+			}
+			const CT& t = raise ? time : times[ii];
+			const Vec<CT>& x = raise ? sample : samples[ii];
+			const Vec<CT>& dx_dt = raise ? derivative : derivatives[ii];
+
+			for (unsigned c = 1; c <= interpolators.size(); ++c)
+				interpolators[c-1].Push(pow(t,static_cast<RT>(1)/c), x, dx_dt*( c*pow(t,static_cast<RT>(c-1)/c )));
 		}
 	}
+
+
 	/**
 	\brief This function computes an approximation of the space value at the time time_t0. 
 
@@ -524,23 +663,13 @@ public:
 
 			ComputeCycleNumber<CT>();
 		auto c = this->CycleNumber();
-		// Conversion to S-plane.
-
-		
-		auto offset = samples.size() - num_sample_points;
-
-		TimeCont<CT> s_times(num_sample_points);
-		SampCont<CT> s_derivatives(num_sample_points);
-
-		for(unsigned ii = 0; ii < num_sample_points; ++ii){
-			if (c==0)
-				throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
-
-			s_times[ii] = pow(times[ii+offset],static_cast<RT>(1)/c);
-			s_derivatives[ii] = derivatives[ii+offset]*( c*pow(times[ii+offset],static_cast<RT>(c-1)/c ));
-		}
+		if (c==0)
+			throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
 
-		result = HermiteInterpolateAndSolve(pow(t0,static_cast<RT>(1)/c), num_sample_points, s_times, samples, s_derivatives);
+		// the interpolator for c already holds the samples in the s-plane, where s = t^(1/c)
+		++this->stats_.num_hermite_interpolations;
+		++this->stats_.num_approximations;
+		std::get<std::vector<HermiteInterpolator<CT> > >(interpolators_)[c-1].Evaluate(result, pow(t0,static_cast<RT>(1)/c), num_sample_points);
 		return SuccessCode::Success;
 	}//end ComputeApproximationOfXAtT0
 
@@ -573,39 +702,64 @@ public:
 
   		if (abs(next_time) < this->EndgameSettings().min_track_time)
   		{
-  			BOOST_LOG_TRIVIAL(severity_level::trace) << "Current time norm is less than min track time." << '\n';
+  			BERTINI_LOG(trace) << "Current time norm is less than min track time." << '\n';
 
   			return SuccessCode::MinTrackTimeReached;
   		}
 
 
-  		BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking to t = " << next_time << ", default precision: " << DefaultPrecision() << "\n";
+  		BERTINI_LOG(trace) << "tracking to t = " << next_time << ", default precision: " << DefaultPrecision() << "\n";
 		SuccessCode tracking_success = this->GetTracker().TrackPath(next_sample,times.back(),next_time,samples.back());
 		if (tracking_success != SuccessCode::Success)
 			return tracking_success;
 
 		AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
-		
+
+		// only the newest num_sample_points+1 samples are interpolated, and three used to estimate the cycle number.  dropping the oldest lets the new one reuse its storage.
+		while (samples.size() >= std::max<std::size_t>(this->EndgameSettings().num_sample_points+1, 3))
+		{
+			times.pop_front(); samples.pop_front(); derivatives.pop_front();
+			if (num_interpolated_samples_ > 0)
+				--num_interpolated_samples_;
+		}
+
 		times.push_back(next_time);
 		samples.push_back(next_sample);
+		this->CountSample(next_sample);
 
 		auto refine_success = AsDerived().RefineSample(samples.back(), next_sample,  times.back());
 		if (refine_success != SuccessCode::Success)
 		{
-			BOOST_LOG_TRIVIAL(severity_level::trace) << "refining failed, code " << int(refine_success);
+			BERTINI_LOG(trace) << "refining failed, code " << int(refine_success);
 			return refine_success;
 		}
 
+		// the samples before keep their precisions, meeting the new one's in the interpolators, so only the new one's time and derivative need be at its precision.
+		const auto precision = Precision(samples.back());
+		AsDerived().EnsureAtPrecision(times.back(), precision);
+		this->GetSystem().precision(precision);
 
- 		auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples, derivatives);
-		this->GetSystem().precision(max_precision);
-
-		derivatives.push_back(-(this->GetSystem().Jacobian(samples.back(),times.back()).inverse())*(this->GetSystem().TimeDerivative(samples.back(),times.back())));
+		derivatives.push_back(PathDerivative(samples.back(),times.back()));
 
  		return SuccessCode::Success;
 	}
 
 
+	/**
+	\brief Whether the upper bound on the cycle number is past the one for handing the path off to another endgame, in the power series settings.
+	*/
+	bool HandOffForCycleNumber() const
+	{
+		const auto bound = power_series_settings_.cycle_number_bound_for_handoff;
+		if (bound > 0 && upper_bound_on_cycle_number_ > bound)
+		{
+			BERTINI_LOG(debug) << "upper bound on cycle number " << upper_bound_on_cycle_number_ << " exceeds " << bound << ", handing off";
+			return true;
+		}
+		return false;
+	}
+
+
 	/**
 	\brief Primary function running the Power Series endgame. 
 
@@ -620,6 +774,7 @@ public:
 	\tparam CT The complex number type.
 				Tracking forward with the number of sample points, this function will make approximations using Hermite interpolation. This process will continue until two consecutive
 				approximations are withing final tolerance of each other. 
+				If the power series settings give a cycle number bound or number of stalled approximations for handing off, the endgame stops with CycleNumTooHigh when either is passed, leaving its samples for another endgame.  See HybridEndgame.
 	*/		
 	template<typename CT>
 	SuccessCode Run(const CT & start_time, const Vec<CT> & start_point)
@@ -631,30 +786,37 @@ public:
 			throw std::runtime_error(err_msg.str());
 		}
 
-		BOOST_LOG_TRIVIAL(severity_level::trace) << "\n\nPSEG(), default precision: " << DefaultPrecision() << "\n\n";
-		BOOST_LOG_TRIVIAL(severity_level::trace) << "start point precision: " << Precision(start_point(0)) << "\n\n";
+		BERTINI_LOG(trace) << "\n\nPSEG(), default precision: " << DefaultPrecision() << "\n\n";
+		BERTINI_LOG(trace) << "start point precision: " << Precision(start_point(0)) << "\n\n";
 
 		DefaultPrecision(Precision(start_point(0)));
 
 		using RT = typename Eigen::NumTraits<CT>::Real;
 		//Set up for the endgame.
 			ClearTimesAndSamples<CT>();
+			this->ResetPathState(this->GetHint().cycle_number); // seeds the search, if a hint has one
 
 			auto& samples = std::get<SampCont<CT> >(samples_);
 			auto& times   = std::get<TimeCont<CT> >(times_);
 			auto& derivatives  = std::get<SampCont<CT> >(derivatives_);
+			const auto num_kept = std::max<std::size_t>(this->EndgameSettings().num_sample_points+1, 3);
+			times.reserve(num_kept); samples.reserve(num_kept); derivatives.reserve(num_kept);
 			Vec<CT>& final_approx = std::get<Vec<CT> >(this->final_approximation_at_origin_);
-			SetRandVec(start_point);
+
+			CT warm_start_time = start_time;
+			Vec<CT> warm_start_point = start_point;
+			this->WarmStart(warm_start_time, warm_start_point);
+			SetRandVec(warm_start_point);
 
 	 	RT approx_error(1);  //setting up the error of successive approximations. 
 	 	
 	 	CT origin(0);
 
-		auto initial_sample_success = this->ComputeInitialSamples(start_time, start_point, times, samples);
+		auto initial_sample_success = this->ComputeInitialSamples(warm_start_time, warm_start_point, times, samples);
 
 		if (initial_sample_success!=SuccessCode::Success)
 		{
-			BOOST_LOG_TRIVIAL(severity_level::trace) << "initial sample gathering failed, code " << int(initial_sample_success) << std::endl;
+			BERTINI_LOG(trace) << "initial sample gathering failed, code " << int(initial_sample_success) << std::endl;
 			return initial_sample_success;
 		}
 
@@ -667,6 +829,9 @@ public:
 	 	if (extrapolation_code != SuccessCode::Success)
 	 		return extrapolation_code;
 
+	 	if (HandOffForCycleNumber())
+	 		return SuccessCode::CycleNumTooHigh;
+
 
 	 	RT norm_of_dehom_of_prev_approx;
 	 	if (this->SecuritySettings().level <= 0)
@@ -677,23 +842,26 @@ public:
 	  	Vec<CT> latest_approx;
 	    RT norm_of_dehom_of_latest_approx;
 
+	    RT prev_approx_error(0);
+	    unsigned num_stalled = 0;
+
 
 		while (approx_error > this->Tolerances().final_tolerance)
 		{
 	  		auto advance_code = AdvanceTime<CT>();
 	  		if (advance_code!=SuccessCode::Success)
 	 		{
-	 			BOOST_LOG_TRIVIAL(severity_level::trace) << "unable to advance time, code " << int(advance_code);
+	 			BERTINI_LOG(trace) << "unable to advance time, code " << int(advance_code);
 	 			return advance_code;
 	 		}
 
 	 		extrapolation_code = ComputeApproximationOfXAtT0(latest_approx, origin);
 	 		if (extrapolation_code!=SuccessCode::Success)
 	 		{
-	 			BOOST_LOG_TRIVIAL(severity_level::trace) << "failed to compute the approximation at " << origin << "\n\n";
+	 			BERTINI_LOG(trace) << "failed to compute the approximation at " << origin << "\n\n";
 	 			return extrapolation_code;
 	 		}
-	 		BOOST_LOG_TRIVIAL(severity_level::trace) << "latest approximation:\n" << latest_approx << '\n';
+	 		BERTINI_LOG(trace) << "latest approximation:\n" << latest_approx << '\n';
 
 	 		if(this->SecuritySettings().level <= 0)
 	 		{
@@ -703,7 +871,36 @@ public:
 	 		}
 
 	 		approx_error = (latest_approx - prev_approx).norm();
-	 		BOOST_LOG_TRIVIAL(severity_level::trace) << "consecutive approximation error:\n" << approx_error << '\n';
+	 		BERTINI_LOG(trace) << "consecutive approximation error:\n" << approx_error << '\n';
+
+	 		if (HandOffForCycleNumber())
+	 		{
+	 			final_approx = latest_approx;
+	 			return SuccessCode::CycleNumTooHigh;
+	 		}
+
+	 		const auto stall_limit = power_series_settings_.stalled_approximations_for_handoff;
+	 		num_stalled = prev_approx_error > 0 && approx_error >= prev_approx_error ? num_stalled+1 : 0;
+	 		prev_approx_error = approx_error;
+	 		if (stall_limit > 0 && num_stalled >= stall_limit)
+	 		{
+	 			BERTINI_LOG(debug) << "power series approximations stalled " << num_stalled << " times, handing off";
+	 			final_approx = latest_approx;
+	 			return SuccessCode::CycleNumTooHigh;
+	 		}
+
+	 		if (approx_error > this->Tolerances().final_tolerance && (this->CertifiedConverged(latest_approx) || this->DeflatedConverged(latest_approx, static_cast<double>(approx_error))))
+	 			break;
+
+	 		if (approx_error > this->Tolerances().final_tolerance)
+	 		{
+	 			auto early_abort_code = this->CheckEarlyAbort(times.back(), latest_approx, approx_error);
+	 			if (early_abort_code != SuccessCode::Success)
+	 			{
+	 				final_approx = latest_approx;
+	 				return early_abort_code;
+	 			}
+	 		}
 
 	 		prev_approx = latest_approx;
 	 		if(this->SecuritySettings().level <= 0)
@@ -711,6 +908,7 @@ public:
 		} //end while	
 		// in case if we get out of the for loop without setting. 
 		final_approx = latest_approx;
+		this->converged_time_ = static_cast<double>(abs(times.front()));
 		return SuccessCode::Success;
 
 	} //end PSEG
@@ -27,6 +27,8 @@
 \file predict.hpp 
 
 \brief Wrapper functions for calling ODE predictors for systems.
+
+These are deprecated.  Each call makes a new predictor, converting its Butcher table to the working precision and allocating its stages, which for the higher order methods is a visible part of a step.  Hold a predict::ExplicitRKPredictor instead, as the trackers do, which keeps its tables and workspaces for each precision it has worked at, and call its Predict.
 */
 
 #ifndef BERTINI_PREDICT_HPP
@@ -57,6 +59,7 @@ namespace bertini{
 		\tparam RealType The complex number type for evaluation.
 		*/
 		template <typename ComplexType, typename RealType>
+		[[deprecated("makes a predictor per call; hold a predict::ExplicitRKPredictor, and call its Predict")]]
 		SuccessCode Predict(config::Predictor predictor_choice,
 							Vec<ComplexType> & next_space,
 							   System const& sys,
@@ -69,7 +72,7 @@ namespace bertini{
 		{
 			static_assert(std::is_same<typename Eigen::NumTraits<RealType>::Real, typename Eigen::NumTraits<ComplexType>::Real>::value,"underlying complex type and the type for comparisons must match");
 			
-			predict::ExplicitRKPredictor predictor(predictor_choice);
+			predict::ExplicitRKPredictor predictor(predictor_choice, sys);
 
 			return predictor.Predict(next_space,
 									sys,
@@ -98,6 +101,7 @@ namespace bertini{
 		\see Predict
 		*/
 		template <typename ComplexType, typename RealType>
+		[[deprecated("makes a predictor per call; hold a predict::ExplicitRKPredictor, and call its Predict")]]
 		SuccessCode Predict(config::Predictor predictor_choice,
 							Vec<ComplexType> & next_space,
 							RealType & size_proportion, /*\f$a\f$ from the AMP2 paper */
@@ -114,7 +118,7 @@ namespace bertini{
 		{
 			static_assert(std::is_same<typename Eigen::NumTraits<RealType>::Real, typename Eigen::NumTraits<ComplexType>::Real>::value,"underlying complex type and the type for comparisons must match");
 			
-			predict::ExplicitRKPredictor<ComplexType, RealType> predictor(predictor_choice);
+			predict::ExplicitRKPredictor predictor(predictor_choice, sys);
 
 			return predictor.Predict(next_space,
 										  size_proportion,
@@ -142,6 +146,7 @@ namespace bertini{
 		\see Predict
 		*/
 		template <typename ComplexType, typename RealType>
+		[[deprecated("makes a predictor per call; hold a predict::ExplicitRKPredictor, and call its Predict")]]
 		SuccessCode Predict(config::Predictor predictor_choice,
 							Vec<ComplexType> & next_space,
 							RealType & error_estimate,
@@ -159,7 +164,7 @@ namespace bertini{
 		{
 			static_assert(std::is_same<typename Eigen::NumTraits<RealType>::Real, typename Eigen::NumTraits<ComplexType>::Real>::value,"underlying complex type and the type for comparisons must match");
 
-			predict::ExplicitRKPredictor<ComplexType, RealType> predictor(predictor_choice);
+			predict::ExplicitRKPredictor predictor(predictor_choice, sys);
 
 			return predictor.Predict(next_space,
 												error_estimate,
@@ -198,6 +203,7 @@ namespace bertini{
 		\tparam RealType The complex number type for evaluation.
 		*/
 		template <typename ComplexType, typename RealType>
+		[[deprecated("makes a predictor per call; hold a predict::ExplicitRKPredictor, and call its Predict")]]
 		SuccessCode Predict(config::Predictor predictor_choice,
 							Vec<ComplexType> & next_space,
 							   System const& sys,
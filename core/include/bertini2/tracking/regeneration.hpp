@@ -0,0 +1,316 @@
+//This file is part of Bertini 2.
+//
+//regeneration.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//regeneration.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with regeneration.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file regeneration.hpp
+
+\brief Contains the RegenerationSolver type, for solving a polynomial system equation by equation.
+*/
+
+#ifndef BERTINI_TRACKING_REGENERATION_HPP
+#define BERTINI_TRACKING_REGENERATION_HPP
+
+#include "bertini2/slice.hpp"
+#include "bertini2/tracking/parallel_solver.hpp"
+#include "bertini2/tracking/post_processing.hpp"
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Solves a square polynomial system equation by equation, by regeneration.
+
+		Each function \f$f_k\f$ of degree \f$d_k\f$ gets a LinearSlice of \f$d_k\f$ random linear functions \f$\ell_{k,1},\dots,\ell_{k,d_k}\f$.  Stage \f$k\f$ starts from the solutions \f$W_{k-1}\f$ of
+		\f[ f_1 = \dots = f_{k-1} = \ell_{k,1} = \ell_{k+1,1} = \dots = \ell_{n,1} = 0, \f]
+		which for \f$k=1\f$ is the single solution of a linear system.  Each is moved from \f$\ell_{k,1}\f$ to each of the other \f$\ell_{k,j}\f$, so the points found together solve the system with \f$\ell_{k,1}\f$ replaced by \f$\gamma\prod_j \ell_{k,j}\f$, and are the start points of the homotopy replacing that by \f$f_k\f$.  Its endpoints are \f$W_k\f$, and \f$W_n\f$ are the solutions of the system.
+
+		The endpoints of each stage at infinity, and those which are singular, are dropped as config::Regeneration says, so each stage starts only from the nonsingular finite solutions of the last, and the number of paths is usually far less than the Bezout number, which the total degree homotopy tracks.  Regeneration so finds the nonsingular isolated solutions of the system, and the singular solutions it reaches at the last stage.
+
+		The paths of each stage are tracked by a ParallelSolver, so are shared between threads.  The stages depend on each other, so run in turn.
+
+		\code
+		RegenerationSolver<AMPTracker> solver(sys, [](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+			});
+		solver.Solve();
+
+		for (auto const& s : solver.Solutions())
+			std::cout << s.solution << std::endl;
+		\endcode
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam EndgameType The type of endgame to use.  Defaults to the power series endgame for the tracker type.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class RegenerationSolver
+		{
+		public:
+
+			using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			using Solver = ParallelSolver<TrackerType, EndgameType>;
+			using TrackerSetup = typename Solver::TrackerSetup;
+
+			/**
+			\brief Set up regeneration for a system, choosing the linear slices.
+
+			\throws std::runtime_error, if the system is not square, is not polynomial, has a path variable already, has other than one affine variable group, or is homogenized.
+
+			\param target The system to solve.
+			\param tracker_setup Called once on each thread's tracker of each stage, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			RegenerationSolver(System const& target, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				target_(target),
+				tracker_setup_(tracker_setup),
+				num_threads_(std::max(num_threads, 1u))
+			{
+				if (target.NumTotalFunctions() != target.NumVariables())
+					throw std::runtime_error("attempting to regenerate a non-square system");
+
+				if (target.HavePathVariable())
+					throw std::runtime_error("attempting to regenerate a system, but it has a path variable declared already");
+
+				if (target.NumVariableGroups() != 1 || target.NumHomVariableGroups() > 0 || target.NumUngroupedVariables() > 0)
+					throw std::runtime_error("regeneration needs a single affine variable group");
+
+				if (target.NumHomVariables() > 0)
+					throw std::runtime_error("regeneration works on affine systems, but the system is homogenized");
+
+				if (!target.IsPolynomial())
+					throw std::runtime_error("attempting to regenerate a non-polynomial system");
+
+				variables_ = target.AffineVariableGroup(0);
+				for (auto d : target.Degrees())
+					slices_.push_back(LinearSlice::RandomComplex(variables_, static_cast<unsigned>(std::max(d, 1))));
+			}
+
+
+			void SetSettings(config::Regeneration<BaseRealType> const& settings)
+			{
+				settings_ = settings;
+			}
+
+			config::Regeneration<BaseRealType> const& Settings() const
+			{
+				return settings_;
+			}
+
+			/**
+			\brief Set the thresholds by which endpoints of each stage are found infinite or singular, and the solutions are clustered.
+			*/
+			void SetPostProcessing(config::PostProcessing<BaseRealType> const& settings)
+			{
+				post_processing_ = settings;
+			}
+
+
+			/**
+			\brief Run all the stages, blocking until they are done.
+
+			Threads run at the default precision of the calling thread.
+			*/
+			void Solve()
+			{
+				num_paths_tracked_ = 0;
+				num_stage_points_.clear();
+
+				const auto n = variables_.size();
+
+				// the first linear function of every slice, for the single solution of stage 0
+				Mat<mpfr> A(n,n);
+				Vec<mpfr> b(n);
+				for (unsigned ii = 0; ii < n; ++ii)
+				{
+					for (unsigned jj = 0; jj < n; ++jj)
+						A(ii,jj) = slices_[ii].Coefficients()(0,jj);
+					b(ii) = -slices_[ii].Constants()(0);
+				}
+				Precision(A, DefaultPrecision());
+				Precision(b, DefaultPrecision());
+
+				std::vector< Vec<mpfr> > points{A.lu().solve(b)};
+				num_stage_points_.push_back(points.size());
+
+				solutions_.clear();
+				for (unsigned k = 0; k < n; ++k)
+				{
+					auto gamma = std::make_shared<node::Rational>(node::Rational::Rand());
+					Nd product = Linear(k,0);
+					for (unsigned j = 1; j < slices_[k].Dimension(); ++j)
+						product = product*Linear(k,j);
+
+					start_system::User regenerated(StageSystem(k, gamma*product));
+					for (auto const& p : points)
+						regenerated.AddStartPoint(p);
+
+					// move the points to each of the other linear functions of the slice
+					for (unsigned j = 1; j < slices_[k].Dimension(); ++j)
+					{
+						start_system::User start(StageSystem(k, std::make_shared<node::Rational>(node::Rational::Rand())*Linear(k,0)));
+						for (auto const& p : points)
+							start.AddStartPoint(p);
+
+						auto target = StageSystem(k, Linear(k,j));
+						Solver solver(target, start, tracker_setup_, num_threads_);
+						solver.SetEndgameFactory([this](TrackerType const& tracker)
+							{
+								std::unique_ptr<EndgameType> endgame(new EndgameType(tracker));
+								config::Tolerances<BaseRealType> tolerances;
+								tolerances.newton_before_endgame = settings_.newton_before_endgame;
+								tolerances.newton_during_endgame = settings_.newton_during_endgame;
+								tolerances.final_tolerance = settings_.final_tolerance;
+								endgame->SetToleranceSettings(tolerances);
+								return endgame;
+							});
+						solver.Solve();
+						num_paths_tracked_ += solver.Results().size();
+
+						for (auto const& r : solver.Results())
+							if (r.success==SuccessCode::Success)
+								regenerated.AddStartPoint(r.solution);
+					}
+
+					auto target = StageSystem(k, target_.Function(k)->entry_node());
+					Solver solver(target, regenerated, tracker_setup_, num_threads_);
+					solver.Solve();
+					num_paths_tracked_ += solver.Results().size();
+
+					bool last_stage = k+1==n;
+					points.clear();
+					for (auto& s : ClusterResults(solver.Results(), post_processing_, num_threads_))
+					{
+						if (settings_.remove_infinite_endpoints && !s.is_finite)
+							continue;
+
+						if (last_stage)
+							solutions_.push_back(std::move(s));
+						else if (!settings_.higher_dimension_check || !s.is_singular)
+							points.push_back(ToMultiple(s.solution));
+					}
+					num_stage_points_.push_back(last_stage ? solutions_.size() : points.size());
+
+					if (points.empty())
+						break;
+				}
+			}
+
+
+			/**
+			\brief The solutions of the system found by the last stage of the most recent Solve, clustered.  The paths of the clusters are indices into the results of that stage.
+			*/
+			std::vector<ClusteredSolution<BaseComplexType>> const& Solutions() const
+			{
+				return solutions_;
+			}
+
+			/**
+			\brief The number of points each stage of the most recent Solve started the next from, starting with the single solution of the linear system, and ending with the number of solutions.
+			*/
+			std::vector<size_t> const& NumStagePoints() const
+			{
+				return num_stage_points_;
+			}
+
+			/**
+			\brief The number of paths tracked by the most recent Solve, over all stages, moving slices and regenerating.
+			*/
+			size_t NumPathsTracked() const
+			{
+				return num_paths_tracked_;
+			}
+
+			/**
+			\brief The linear slice of each function of the system.
+			*/
+			std::vector<LinearSlice> const& Slices() const
+			{
+				return slices_;
+			}
+
+		private:
+
+			using Nd = std::shared_ptr<node::Node>;
+
+			// the jth linear function of the kth slice.
+			Nd Linear(unsigned k, unsigned j) const
+			{
+				auto const& c = slices_[k].Coefficients();
+				Nd f = std::make_shared<node::Float>(slices_[k].Constants()(j));
+				for (unsigned ii = 0; ii < variables_.size(); ++ii)
+					f = f + std::make_shared<node::Float>(c(j,ii))*variables_[ii];
+				return f;
+			}
+
+			// the system of stage k: the functions of the target before k, the given function, and the first linear function of each slice after k.
+			System StageSystem(unsigned k, Nd const& f) const
+			{
+				System s;
+				s.AddVariableGroup(variables_);
+				for (unsigned ii = 0; ii < k; ++ii)
+					s.AddFunction(target_.Function(ii)->entry_node());
+				s.AddFunction(f);
+				for (unsigned ii = k+1; ii < slices_.size(); ++ii)
+					s.AddFunction(Linear(ii,0));
+				return s;
+			}
+
+			static Vec<mpfr> ToMultiple(Vec<mpfr> const& x)
+			{
+				return x;
+			}
+
+			static Vec<mpfr> ToMultiple(Vec<dbl> const& x)
+			{
+				Vec<mpfr> y(x.size());
+				for (int ii = 0; ii < x.size(); ++ii)
+					y(ii) = mpfr(x(ii).real(), x(ii).imag());
+				return y;
+			}
+
+
+			System target_;
+			VariableGroup variables_;
+			std::vector<LinearSlice> slices_; ///< The linear functions of each function of the target, as many as its degree.
+			TrackerSetup tracker_setup_;
+			unsigned num_threads_;
+
+			config::Regeneration<BaseRealType> settings_;
+			config::PostProcessing<BaseRealType> post_processing_;
+
+			std::vector<ClusteredSolution<BaseComplexType>> solutions_;
+			std::vector<size_t> num_stage_points_;
+			size_t num_paths_tracked_ = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,207 @@
+//This file is part of Bertini 2.
+//
+//sharpen.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//sharpen.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with sharpen.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file sharpen.hpp
+
+\brief Contains Sharpen, which refines an approximation of a nonsingular root to many digits by Newton's method, doubling the precision with each iteration.
+*/
+
+#ifndef BERTINI_TRACKING_SHARPEN_HPP
+#define BERTINI_TRACKING_SHARPEN_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <Eigen/LU>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The outcome of sharpening a point.
+		*/
+		struct SharpenResult
+		{
+			bool converged = false; ///< Whether the point reached the digits wanted.
+			unsigned digits = 0; ///< The estimated number of correct digits of the point.
+			unsigned num_iterations = 0; ///< The Newton iterations, each one evaluation of the system at the precision of the iterate.
+			unsigned num_jacobians = 0; ///< The evaluations and factorizations of the Jacobian, each at the lowest precision which served.
+			unsigned final_precision = 0; ///< The precision of the point.
+		};
+
+
+		/**
+		\brief Sharpen an approximation of a nonsingular root to many digits by Newton's method, doubling the precision as the correct digits double, given evaluations of a system and its Jacobian.
+
+		Each iteration evaluates the system at the precision of the digits the step should reach, twice those of the iterate, plus the guard digits.  The step is of the size of the error of the iterate, so the Jacobian need only be good to the digits of the iterate: it is evaluated in double precision while that serves, and otherwise at the lowest precision which does, and kept until the iterates need more.  Sharpening from the final tolerance of an endgame to a hundred digits thus takes a handful of evaluations of the system, and fewer, cheaper, of the Jacobian.
+
+		Fails if the steps stop shrinking quadratically, as near a singular root, leaving the point as it was.
+
+		\param[in,out] x The approximation, replaced by the sharpened one, at the precision it was sharpened in, if converged.
+		\param eval Given a point, the values of the functions, at the precision of the point, as System::Eval.
+		\param jacobian Given a point in double or multiple precision, the Jacobian at its precision, as System::Jacobian.
+		\param set_precision Given a number of digits, brings the default precision, and the system, to it.
+		\param digits The correct digits wanted.
+		\param settings The guard digits, and the most iterations.
+		*/
+		template<typename EvalF, typename JacobianF, typename PrecisionF>
+		SharpenResult Sharpen(Vec<mpfr> & x, EvalF const& eval, JacobianF const& jacobian, PrecisionF const& set_precision, unsigned digits, config::Sharpening const& settings = config::Sharpening())
+		{
+			using std::log10;
+
+			SharpenResult result;
+			const unsigned guard = settings.guard_digits;
+			const unsigned double_digits = DoublePrecision();
+			const Vec<mpfr> start = x;
+
+			Eigen::PartialPivLU<Mat<dbl>> lu_double;
+			Eigen::PartialPivLU<Mat<mpfr>> lu;
+			unsigned jacobian_digits = 0; // the precision of the factored Jacobian, 0 before the first
+			double correct = 0; // the estimated correct digits of x, 0 before the first step
+			double previous_step = std::numeric_limits<double>::infinity();
+			double previous_step_digits = 0;
+
+			for (unsigned ii = 0; ii < settings.max_iterations; ++ii)
+			{
+				const unsigned wanted = std::min(digits, correct > 0 ? static_cast<unsigned>(2*correct) : 2*double_digits);
+				const unsigned working = std::max(double_digits, wanted + guard);
+				set_precision(working);
+				Precision(x, working);
+				Vec<mpfr> f = eval(x);
+
+				const unsigned needed = static_cast<unsigned>(correct) + guard;
+				if (jacobian_digits < needed)
+				{
+					if (needed <= double_digits)
+					{
+						lu_double.compute(jacobian(Vec<dbl>(x.template cast<dbl>())));
+						jacobian_digits = double_digits;
+					}
+					else
+					{
+						jacobian_digits = std::min(working, std::max(needed, 2*jacobian_digits));
+						set_precision(jacobian_digits);
+						Vec<mpfr> x_low = x;
+						Precision(x_low, jacobian_digits);
+						lu.compute(jacobian(x_low));
+						set_precision(working);
+					}
+					++result.num_jacobians;
+				}
+
+				Vec<mpfr> delta = jacobian_digits <= double_digits ?
+				                    Vec<mpfr>(lu_double.solve(Vec<dbl>(f.template cast<dbl>())).template cast<mpfr>())
+				                  : Vec<mpfr>(lu.solve(f));
+				x -= delta;
+				++result.num_iterations;
+
+				const double step = static_cast<double>(delta.norm()) / std::max(1.0, static_cast<double>(x.norm()));
+				const double step_digits = step > 0 ? -log10(step) : working;
+				if (ii > 0 && step > 0 && (step >= previous_step || step_digits < 1.5*previous_step_digits))
+				{ // not converging quadratically, as near a singular root
+					set_precision(static_cast<unsigned>(Precision(start)));
+					x = start;
+					return result;
+				}
+				previous_step = step;
+				previous_step_digits = step_digits;
+
+				// the error left is the step times the larger of itself and the relative error of the Jacobian, within the precision
+				correct = std::min(step_digits + std::min(step_digits, double(jacobian_digits) - guard), double(working) - guard);
+
+				if (ii > 0 && correct >= digits)
+				{
+					result.converged = true;
+					break;
+				}
+			}
+
+			result.digits = static_cast<unsigned>(std::max(correct, 0.0));
+			result.final_precision = Precision(x);
+			if (!result.converged)
+			{
+				set_precision(static_cast<unsigned>(Precision(start)));
+				x = start;
+			}
+			return result;
+		}
+
+
+		/**
+		\brief Sharpen an approximation of a nonsingular root of a system without a path variable to many digits, by Newton's method, doubling the precision.
+
+		The default precision and that of the system are as they were after.
+
+		\code
+		Vec<mpfr> x = endpoint;
+		auto sharpened = Sharpen(target, x, 100);
+		if (sharpened.converged)
+			std::cout << x << '\n'; // to 100 digits
+		\endcode
+		*/
+		inline SharpenResult Sharpen(System const& sys, Vec<mpfr> & x, unsigned digits, config::Sharpening const& settings = config::Sharpening())
+		{
+			const auto default_precision = DefaultPrecision();
+			const auto system_precision = sys.precision();
+			auto result = Sharpen(x,
+			                      [&sys](auto const& z){ return sys.Eval(z);},
+			                      [&sys](auto const& z){ return sys.Jacobian(z);},
+			                      [&sys](unsigned p){ DefaultPrecision(p); sys.precision(p);},
+			                      digits, settings);
+			DefaultPrecision(default_precision);
+			sys.precision(system_precision);
+			return result;
+		}
+
+		/**
+		\brief Sharpen an approximation of a nonsingular root of a system at a value of its path variable, such as the target system of a homotopy at 0, to many digits, by Newton's method, doubling the precision.
+
+		The default precision and that of the system are as they were after.
+		*/
+		inline SharpenResult Sharpen(System const& sys, Vec<mpfr> & x, mpfr const& path_variable_value, unsigned digits, config::Sharpening const& settings = config::Sharpening())
+		{
+			const auto default_precision = DefaultPrecision();
+			const auto system_precision = sys.precision();
+			auto result = Sharpen(x,
+			                      [&](auto const& z){ return sys.Eval(z, static_cast<typename std::decay_t<decltype(z)>::Scalar>(path_variable_value));},
+			                      [&](auto const& z){ return sys.Jacobian(z, static_cast<typename std::decay_t<decltype(z)>::Scalar>(path_variable_value));},
+			                      [&sys](unsigned p){ DefaultPrecision(p); sys.precision(p);},
+			                      digits, settings);
+			DefaultPrecision(default_precision);
+			sys.precision(system_precision);
+			return result;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
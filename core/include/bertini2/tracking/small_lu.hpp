@@ -0,0 +1,195 @@
+//This file is part of Bertini 2.
+//
+//small_lu.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//small_lu.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with small_lu.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file small_lu.hpp
+
+\brief Contains the SmallLU type, LU factorizations of small double precision matrices of sizes fixed at compile time.
+*/
+
+#ifndef BERTINI_TRACKING_SMALL_LU_HPP
+#define BERTINI_TRACKING_SMALL_LU_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+#include <Eigen/LU>
+
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief The LU factorization with partial pivoting of a small square matrix in double precision, by Eigen's kernels for the matrix's size fixed at compile time.
+
+		Mat<dbl> is of dynamic size, so its factorization and solves are neither unrolled nor kept off the heap, which for systems of a handful of variables costs more than the arithmetic.  SmallLU holds a fixed-size factorization for each size from 1 to MaxDimension, made once, and dispatches to the one for the size of the matrix at run time.  The algorithm is that of Eigen::PartialPivLU, so the results are those of the dynamic factorization.
+
+		Only double precision is supported.  The overloads for multiple precision exist so generic code compiles, and throw; see Handles.
+		*/
+		class SmallLU
+		{
+		public:
+
+			static constexpr int MaxDimension = 8;
+
+			/**
+			\brief Whether square matrices of a number type and size can be factored by a SmallLU.
+			*/
+			template<typename NumT>
+			static bool Handles(Eigen::Index size)
+			{
+				return std::is_same<NumT,dbl>::value && size >= 1 && size <= MaxDimension;
+			}
+
+
+			SmallLU() = default;
+			SmallLU(SmallLU &&) = default;
+			SmallLU& operator=(SmallLU &&) = default;
+
+			SmallLU(SmallLU const& other) : size_(other.size_), storage_(other.storage_ ? new Storage(*other.storage_) : nullptr)
+			{}
+
+			SmallLU& operator=(SmallLU const& other)
+			{
+				size_ = other.size_;
+				storage_.reset(other.storage_ ? new Storage(*other.storage_) : nullptr);
+				return *this;
+			}
+
+
+			/**
+			\brief Factor a matrix.
+
+			\return Whether the factorization succeeded, as LUPartialPivotDecompositionSuccessful.
+			\param J A square matrix of a size handled.
+			*/
+			MatrixSuccessCode Compute(Mat<dbl> const& J)
+			{
+				if (!storage_)
+					storage_.reset(new Storage);
+
+				size_ = J.rows();
+				return Dispatch(*this, [&J](auto & lu){
+						lu.compute(J);
+						return LUPartialPivotDecompositionSuccessful(lu.matrixLU());
+					});
+			}
+
+			MatrixSuccessCode Compute(Mat<mpfr> const& /*J*/)
+			{
+				throw std::logic_error("SmallLU factors only double precision matrices");
+			}
+
+
+			/**
+			\brief Solve with the factored matrix.  x is resized if need be.
+			*/
+			void Solve(Vec<dbl> & x, Vec<dbl> const& b) const
+			{
+				x.resize(size_);
+				Dispatch(*this, [&](auto const& lu){
+						using FixedVec = Eigen::Matrix<dbl, std::decay_t<decltype(lu.matrixLU())>::RowsAtCompileTime, 1>;
+						x = lu.solve(FixedVec(b));
+						return 0;
+					});
+			}
+
+			void Solve(Vec<mpfr> & /*x*/, Vec<mpfr> const& /*b*/) const
+			{
+				throw std::logic_error("SmallLU solves only in double precision");
+			}
+
+
+			/**
+			\brief The norm of the inverse of the factored matrix, in the way chosen in the AMP settings.
+
+			For the one-norm estimator, the inverse is formed, which at these sizes is cheaper than estimating, so the norm is exact.  Otherwise it is the norm of the solution for a random right hand side of units, as amp::NormJInverse.
+			*/
+			double NormInverse(config::AdaptiveMultiplePrecisionConfig const& AMP_config) const
+			{
+				const bool one_norm = AMP_config.norm_J_inverse_estimator==config::NormJInverseEstimator::OneNorm;
+				return Dispatch(*this, [one_norm](auto const& lu){
+						using FixedMat = std::decay_t<decltype(lu.matrixLU())>;
+						using FixedVec = Eigen::Matrix<dbl, FixedMat::RowsAtCompileTime, 1>;
+						if (one_norm)
+							return FixedMat(lu.inverse()).cwiseAbs().colwise().sum().maxCoeff();
+
+						FixedVec b;
+						for (int ii = 0; ii < b.size(); ++ii)
+							b(ii) = RandomUnit<dbl>();
+						return FixedVec(lu.solve(b)).norm();
+					});
+			}
+
+
+			/**
+			\brief The size of the factored matrix.  0 if none has been.
+			*/
+			Eigen::Index Size() const
+			{
+				return size_;
+			}
+
+		private:
+
+			template<int N>
+			using FixedLU = Eigen::PartialPivLU< Eigen::Matrix<dbl, N, N> >;
+
+			// the fixed-size factorizations, on the heap so their alignment is Eigen's, made with the first factorization
+			struct Storage
+			{
+				std::tuple< FixedLU<1>, FixedLU<2>, FixedLU<3>, FixedLU<4>, FixedLU<5>, FixedLU<6>, FixedLU<7>, FixedLU<8> > lu;
+				EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+			};
+
+			// call f on the factorization of the current size
+			template<typename Self, typename F>
+			static auto Dispatch(Self & self, F f) -> decltype(f(std::get<0>(self.storage_->lu)))
+			{
+				auto & lu = self.storage_->lu;
+				switch (self.size_)
+				{
+					case 1: return f(std::get<0>(lu));
+					case 2: return f(std::get<1>(lu));
+					case 3: return f(std::get<2>(lu));
+					case 4: return f(std::get<3>(lu));
+					case 5: return f(std::get<4>(lu));
+					case 6: return f(std::get<5>(lu));
+					case 7: return f(std::get<6>(lu));
+					case 8: return f(std::get<7>(lu));
+				}
+				throw std::logic_error("SmallLU used with size " + std::to_string(self.size_) + ", outside 1 to " + std::to_string(MaxDimension));
+			}
+
+			Eigen::Index size_ = 0;
+			std::unique_ptr<Storage> storage_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
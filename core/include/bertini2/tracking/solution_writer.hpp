@@ -0,0 +1,697 @@
+//This file is part of Bertini 2.
+//
+//solution_writer.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solution_writer.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solution_writer.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file solution_writer.hpp
+
+\brief Provides SolutionWriter, which writes the solutions of a run to files from a background thread, and BinarySolutionView and MappedSolutionFile, for reading its binary format in place.
+*/
+
+#ifndef BERTINI_TRACKING_SOLUTION_WRITER_HPP
+#define BERTINI_TRACKING_SOLUTION_WRITER_HPP
+
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The layout of binary solution files.
+
+		A file is a FileHeader, followed by records, each a RecordHeader and its coordinates.  Everything is in the byte order of the machine which wrote it, and every header and coordinate begins at a multiple of 8 bytes, so a mapped file can be read in place.
+
+		The coordinates of a record are its real and imaginary parts, in order.  If the record's precision is 0, each part is a double.  Otherwise each part is an MpfrHeader, followed by the limbs of the significand, mpfr_custom_get_size(precision) bytes rounded up to a multiple of 8.  Every part of a record has the record's precision, so records have a fixed size given their dimension and precision, which is also in their header.
+		*/
+		namespace solution_file{
+
+			const char Magic[8] = {'B','2','S','O','L','N','S','\0'};
+			const std::uint32_t Version = 1;
+
+			struct FileHeader
+			{
+				char magic[8];
+				std::uint32_t version;
+				std::uint32_t limb_bytes; ///< sizeof(mp_limb_t) on the writing machine.
+				std::uint64_t num_records; ///< Filled in when the writer is closed.  0 in a file still being written; walk the records instead.
+				std::uint64_t reserved;
+			};
+
+			/**
+			Describes a solution.  Flags are a combination of the Flags values.
+			*/
+			struct RecordHeader
+			{
+				std::uint64_t path; ///< The index of the start point of the path.
+				std::uint32_t record_bytes; ///< The size of the record, including this header.
+				std::uint32_t dimension; ///< The number of coordinates.  0 if the path produced no point.
+				std::uint32_t precision; ///< Bits of precision of the mpfr coordinates, or 0 for doubles.
+				std::int32_t success; ///< The SuccessCode of the path.
+				std::uint32_t cycle_number;
+				std::uint32_t flags;
+			};
+
+			struct MpfrHeader
+			{
+				std::int64_t exponent; ///< Meaningful only for regular numbers.
+				std::int32_t kind; ///< As from mpfr_custom_get_kind, whose sign is the sign of the number.
+				std::uint32_t padding;
+			};
+
+			enum Flags : std::uint32_t
+			{
+				Finite = 1,
+				Real = 2,
+				Singular = 4,
+				Infinite = 8
+			};
+
+			static_assert(sizeof(FileHeader)==32 && sizeof(RecordHeader)==32 && sizeof(MpfrHeader)==16, "solution file headers must have the sizes of the format");
+
+			inline
+			std::size_t RoundUp8(std::size_t n)
+			{
+				return (n + 7) & ~std::size_t(7);
+			}
+
+			inline
+			std::size_t PartBytes(std::uint32_t precision)
+			{
+				return precision==0 ? sizeof(double) : sizeof(MpfrHeader) + RoundUp8(mpfr_custom_get_size(precision));
+			}
+		} // re: namespace solution_file
+
+
+
+		/**
+		\brief A solution, as handed to a SolutionWriter.
+		*/
+		template<typename ComplexType>
+		struct SolutionRecord
+		{
+			std::size_t path = 0; ///< The index of the start point of the path.
+			SuccessCode success = SuccessCode::Failure;
+			unsigned cycle_number = 0;
+			Vec<ComplexType> solution; ///< The dehomogenized solution.  Empty if the path produced no point.
+		};
+
+
+
+		/**
+		\brief Writes the solutions of a run to files, from a background thread.
+
+		Write only queues the solution, so trackers are not held up by the disk, and may be called from any thread.  When the queue is long, Write waits for it to shorten, so a slow disk cannot make it grow without bound.
+
+		Solutions are sorted as Bertini Classic does, into the text files finite_solutions, real_finite_solutions, nonsingular_solutions, and singular_solutions, plus infinite_solutions, in the classic format: the number of solutions, a blank line, then each solution, one coordinate `real imag` per line, followed by a blank line.  Every solution, including failures, also goes to the binary file solutions.b2sol, whose layout is described in solution_file.
+
+		A solution is finite if its path succeeded, infinite if it was going to infinity, real if it is finite and every imaginary part is smaller in magnitude than the real threshold, and singular if it is finite and its cycle number is greater than 1.  Classic uses the condition number for singularity; the cycle number is what the endgames here report.
+
+		\code
+		auto writer = std::make_shared<SolutionWriter<mpfr>>("output");
+		solver.SetSolutionWriter(writer);
+		solver.Solve();
+		writer->Close();
+		\endcode
+
+		\tparam ComplexType dbl or mpfr.
+		*/
+		template<typename ComplexType>
+		class SolutionWriter
+		{
+		public:
+
+			using RecordType = SolutionRecord<ComplexType>;
+
+			/**
+			\param directory Where the files go.  Made if it does not exist.  Existing files of the same names are replaced.
+			\param write_text Whether to write the classic text files.
+			\param write_binary Whether to write the binary file.
+			*/
+			SolutionWriter(boost::filesystem::path const& directory, bool write_text = true, bool write_binary = true) : real_threshold_(1e-8)
+			{
+				boost::filesystem::create_directories(directory);
+
+				if (write_text)
+					for (unsigned ii = 0; ii < NumTextFiles; ++ii)
+					{
+						text_files_[ii].open((directory / TextFileName(ii)).string());
+						if (!text_files_[ii])
+							throw std::runtime_error("unable to open solution file " + (directory / TextFileName(ii)).string());
+						WriteCount(text_files_[ii], 0);
+					}
+
+				if (write_binary)
+				{
+					binary_file_.open((directory / "solutions.b2sol").string(), std::ios::binary);
+					if (!binary_file_)
+						throw std::runtime_error("unable to open solution file " + (directory / "solutions.b2sol").string());
+					WriteFileHeader(0);
+				}
+
+				thread_ = std::thread([this]{ Run(); });
+			}
+
+			SolutionWriter(SolutionWriter const&) = delete;
+			SolutionWriter& operator=(SolutionWriter const&) = delete;
+
+			~SolutionWriter()
+			{
+				try
+				{
+					Close();
+				}
+				catch (...)
+				{}
+			}
+
+			/**
+			\brief Set the size below which imaginary parts count as zero.  Defaults to 1e-8, as in Classic.  Set before writing.
+			*/
+			void SetRealThreshold(double threshold)
+			{
+				real_threshold_ = threshold;
+			}
+
+			/**
+			\brief Queue a solution for writing.
+
+			\throws Any error the background thread met while writing earlier solutions.
+			*/
+			void Write(RecordType record)
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				space_.wait(lock, [this]{ return queue_.size() < MaxQueued || error_ || closing_; });
+				if (error_)
+					std::rethrow_exception(error_);
+				if (closing_)
+					throw std::logic_error("writing a solution to a closed SolutionWriter");
+
+				queue_.push_back(std::move(record));
+				work_.notify_one();
+			}
+
+			/**
+			\brief Write everything queued, fill in the counts at the tops of the files, and close them.  Called by the destructor if not before.
+
+			\throws Any error the background thread met while writing.
+			*/
+			void Close()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					if (closing_ && !thread_.joinable())
+						return;
+					closing_ = true;
+				}
+				work_.notify_one();
+				space_.notify_all();
+				if (thread_.joinable())
+					thread_.join();
+
+				if (error_)
+					std::rethrow_exception(error_);
+
+				for (unsigned ii = 0; ii < NumTextFiles; ++ii)
+					if (text_files_[ii].is_open())
+					{
+						text_files_[ii].seekp(0);
+						WriteCount(text_files_[ii], text_counts_[ii]);
+						text_files_[ii].close();
+					}
+
+				if (binary_file_.is_open())
+				{
+					binary_file_.seekp(0);
+					WriteFileHeader(num_written_);
+					binary_file_.close();
+				}
+			}
+
+			/**
+			\brief The number of solutions written so far, not counting those still queued.
+			*/
+			std::size_t NumWritten() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return num_written_;
+			}
+
+		private:
+
+			enum TextFile {FiniteFile, RealFiniteFile, NonsingularFile, SingularFile, InfiniteFile, NumTextFiles};
+
+			static const std::size_t MaxQueued = 1<<12;
+			static const int CountWidth = 20; ///< The width the count at the top of a text file is padded to, so it can be filled in at the end.
+
+			static char const* TextFileName(unsigned ii)
+			{
+				static char const* names[NumTextFiles] = {"finite_solutions", "real_finite_solutions", "nonsingular_solutions", "singular_solutions", "infinite_solutions"};
+				return names[ii];
+			}
+
+			static void WriteCount(std::ofstream & file, std::size_t count)
+			{
+				file << std::left << std::setw(CountWidth) << count << "\n\n";
+			}
+
+
+			void Run()
+			{
+				std::deque<RecordType> batch;
+				for (;;)
+				{
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						work_.wait(lock, [this]{ return !queue_.empty() || closing_; });
+						if (queue_.empty())
+							return;
+						batch.swap(queue_);
+					}
+					space_.notify_all();
+
+					try
+					{
+						for (auto const& r : batch)
+							WriteRecord(r);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						error_ = std::current_exception();
+						space_.notify_all();
+						return;
+					}
+
+					std::lock_guard<std::mutex> lock(mutex_);
+					num_written_ += batch.size();
+					batch.clear();
+				}
+			}
+
+
+			void WriteRecord(RecordType const& r)
+			{
+				auto flags = Classify(r);
+
+				if (flags & solution_file::Finite)
+				{
+					WriteText(FiniteFile, r);
+					if (flags & solution_file::Real)
+						WriteText(RealFiniteFile, r);
+					WriteText((flags & solution_file::Singular) ? SingularFile : NonsingularFile, r);
+				}
+				else if (flags & solution_file::Infinite)
+					WriteText(InfiniteFile, r);
+
+				if (binary_file_.is_open())
+					WriteBinary(r, flags);
+			}
+
+
+			std::uint32_t Classify(RecordType const& r) const
+			{
+				using std::abs;
+				using std::imag;
+
+				std::uint32_t flags = 0;
+				if (r.success==SuccessCode::GoingToInfinity || r.success==SuccessCode::SecurityMaxNormReached)
+					return solution_file::Infinite;
+				if (r.success!=SuccessCode::Success)
+					return flags;
+
+				flags |= solution_file::Finite;
+				if (r.cycle_number > 1)
+					flags |= solution_file::Singular;
+
+				bool is_real = true;
+				for (int ii = 0; ii < r.solution.size() && is_real; ++ii)
+					is_real = abs(imag(r.solution(ii))) < real_threshold_;
+				if (is_real)
+					flags |= solution_file::Real;
+
+				return flags;
+			}
+
+
+			void WriteText(TextFile which, RecordType const& r)
+			{
+				auto& file = text_files_[which];
+				if (!file.is_open() || r.solution.size()==0)
+					return;
+
+				file << std::setprecision(TextDigits(r.solution(0))) << std::scientific;
+				for (int ii = 0; ii < r.solution.size(); ++ii)
+					file << real(r.solution(ii)) << " " << imag(r.solution(ii)) << "\n";
+				file << "\n";
+				++text_counts_[which];
+			}
+
+			static int TextDigits(dbl const&)
+			{
+				return std::numeric_limits<double>::max_digits10;
+			}
+
+			static int TextDigits(mpfr const& z)
+			{
+				return static_cast<int>(Precision(z));
+			}
+
+
+			void WriteFileHeader(std::uint64_t num_records)
+			{
+				solution_file::FileHeader h{};
+				std::memcpy(h.magic, solution_file::Magic, sizeof(h.magic));
+				h.version = solution_file::Version;
+				h.limb_bytes = sizeof(mp_limb_t);
+				h.num_records = num_records;
+				binary_file_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+			}
+
+			void WriteBinary(RecordType const& r, std::uint32_t flags)
+			{
+				auto precision = BinaryPrecision(r.solution);
+
+				solution_file::RecordHeader h{};
+				h.path = r.path;
+				h.dimension = static_cast<std::uint32_t>(r.solution.size());
+				h.precision = precision;
+				h.record_bytes = static_cast<std::uint32_t>(sizeof(h) + 2*h.dimension*solution_file::PartBytes(precision));
+				h.success = static_cast<std::int32_t>(r.success);
+				h.cycle_number = r.cycle_number;
+				h.flags = flags;
+				binary_file_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+
+				for (int ii = 0; ii < r.solution.size(); ++ii)
+				{
+					WritePart(real(r.solution(ii)), precision);
+					WritePart(imag(r.solution(ii)), precision);
+				}
+
+				if (!binary_file_)
+					throw std::runtime_error("failed writing binary solution file");
+			}
+
+			static std::uint32_t BinaryPrecision(Vec<dbl> const&)
+			{
+				return 0;
+			}
+
+			static std::uint32_t BinaryPrecision(Vec<mpfr> const& v)
+			{
+				return v.size()==0 ? 0 : static_cast<std::uint32_t>(mpfr_get_prec(v(0).real().backend().data()));
+			}
+
+			void WritePart(double x, std::uint32_t)
+			{
+				binary_file_.write(reinterpret_cast<char const*>(&x), sizeof(x));
+			}
+
+			void WritePart(mpfr_float const& x, std::uint32_t precision)
+			{
+				// parts at another precision than the first are rounded to it, so that records have a fixed layout.
+				mpfr_srcptr p = x.backend().data();
+				mpfr_float rounded;
+				if (mpfr_get_prec(p)!=static_cast<mpfr_prec_t>(precision))
+				{
+					mpfr_set_prec(rounded.backend().data(), precision);
+					mpfr_set(rounded.backend().data(), p, MPFR_RNDN);
+					p = rounded.backend().data();
+				}
+
+				solution_file::MpfrHeader h{};
+				h.kind = mpfr_custom_get_kind(p);
+				if (mpfr_regular_p(p))
+					h.exponent = mpfr_custom_get_exp(p);
+				binary_file_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+
+				auto num_bytes = mpfr_custom_get_size(precision);
+				static const char zeros[8] = {};
+				if (mpfr_regular_p(p))
+					binary_file_.write(static_cast<char const*>(mpfr_custom_get_significand(p)), num_bytes);
+				else
+					for (std::size_t ii = 0; ii < num_bytes; ii += sizeof(zeros))
+						binary_file_.write(zeros, std::min(sizeof(zeros), num_bytes-ii));
+				binary_file_.write(zeros, solution_file::RoundUp8(num_bytes) - num_bytes);
+			}
+
+
+			std::ofstream text_files_[NumTextFiles];
+			std::size_t text_counts_[NumTextFiles] = {}; ///< Written only by the background thread, until it is joined.
+			std::ofstream binary_file_;
+			double real_threshold_;
+
+			mutable std::mutex mutex_; ///< Guards the queue, the flags, the error, and num_written_.
+			std::condition_variable work_; ///< Signalled when there is something to write, or the writer is closing.
+			std::condition_variable space_; ///< Signalled when the queue shortens.
+			std::deque<RecordType> queue_;
+			bool closing_ = false;
+			std::exception_ptr error_;
+			std::size_t num_written_ = 0;
+
+			std::thread thread_;
+		};
+
+
+
+		/**
+		\brief Reads a binary solution file in place, from memory such as a mapped file.
+
+		The view does not copy the data, which must outlive it.
+
+		\code
+		boost::interprocess::file_mapping file("output/solutions.b2sol", boost::interprocess::read_only);
+		boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+		BinarySolutionView view(static_cast<char const*>(region.get_address()), region.get_size());
+
+		for (std::size_t ii = 0; ii < view.NumRecords(); ++ii)
+			if (view.Header(ii).flags & solution_file::Real)
+				std::cout << view.Solution<dbl>(ii) << "\n\n";
+		\endcode
+		*/
+		class BinarySolutionView
+		{
+		public:
+
+			/**
+			\throws std::runtime_error If the data is not a solution file in this machine's layout.  A file cut short by a crash is read up to its last complete record.
+			*/
+			BinarySolutionView(char const* data, std::size_t size) : data_(data)
+			{
+				solution_file::FileHeader h;
+				if (size < sizeof(h))
+					throw std::runtime_error("binary solution file too short for its header");
+				std::memcpy(&h, data, sizeof(h));
+
+				if (std::memcmp(h.magic, solution_file::Magic, sizeof(h.magic))!=0 || h.version!=solution_file::Version)
+					throw std::runtime_error("not a binary solution file of this version");
+				if (h.limb_bytes!=sizeof(mp_limb_t))
+					throw std::runtime_error("binary solution file was written on a machine with another limb size");
+
+				std::size_t offset = sizeof(h);
+				while (offset + sizeof(solution_file::RecordHeader) <= size)
+				{
+					auto r = HeaderAt(offset);
+					if (r.record_bytes < sizeof(r) || offset + r.record_bytes > size)
+						break;
+					offsets_.push_back(offset);
+					offset += r.record_bytes;
+				}
+			}
+
+			std::size_t NumRecords() const
+			{
+				return offsets_.size();
+			}
+
+			solution_file::RecordHeader Header(std::size_t ii) const
+			{
+				return HeaderAt(offsets_.at(ii));
+			}
+
+			/**
+			\brief A view of the records whose headers pass a test, in the same order, such as the finite solutions.  Only the headers are read.
+
+			\code
+			auto finite = view.Select([](solution_file::RecordHeader const& h){ return (h.flags & solution_file::Finite)!=0;});
+			\endcode
+			*/
+			template<typename PredicateT>
+			BinarySolutionView Select(PredicateT keep) const
+			{
+				BinarySolutionView selected(*this);
+				selected.offsets_.clear();
+				for (auto offset : offsets_)
+					if (keep(HeaderAt(offset)))
+						selected.offsets_.push_back(offset);
+				return selected;
+			}
+
+			/**
+			\brief The coordinates of a record, converted to ComplexType.  mpfr coordinates come at the precision they were written at.
+
+			Only reads the data, so may be called from many threads at once.
+			*/
+			template<typename ComplexType>
+			Vec<ComplexType> Solution(std::size_t ii) const
+			{
+				auto h = Header(ii);
+				Vec<ComplexType> v(h.dimension);
+
+				auto pos = data_ + offsets_.at(ii) + sizeof(h);
+				auto part_bytes = solution_file::PartBytes(h.precision);
+				for (unsigned jj = 0; jj < h.dimension; ++jj, pos += 2*part_bytes)
+				{
+					if (h.precision==0)
+						Set(v(jj), dbl(ReadDouble(pos), ReadDouble(pos+part_bytes)));
+					else
+						Set(v(jj), mpfr(ReadMpfr(pos, h.precision), ReadMpfr(pos+part_bytes, h.precision)));
+				}
+				return v;
+			}
+
+		private:
+
+			solution_file::RecordHeader HeaderAt(std::size_t offset) const
+			{
+				solution_file::RecordHeader r;
+				std::memcpy(&r, data_+offset, sizeof(r));
+				return r;
+			}
+
+			static double ReadDouble(char const* pos)
+			{
+				double x;
+				std::memcpy(&x, pos, sizeof(x));
+				return x;
+			}
+
+			static mpfr_float ReadMpfr(char const* pos, std::uint32_t precision)
+			{
+				solution_file::MpfrHeader h;
+				std::memcpy(&h, pos, sizeof(h));
+
+				auto num_bytes = mpfr_custom_get_size(precision);
+				std::vector<mp_limb_t> limbs((num_bytes + sizeof(mp_limb_t) - 1)/sizeof(mp_limb_t));
+				std::memcpy(limbs.data(), pos+sizeof(h), num_bytes);
+
+				mpfr_t x;
+				mpfr_custom_init(limbs.data(), precision);
+				mpfr_custom_init_set(x, h.kind, h.exponent, precision, limbs.data());
+
+				mpfr_float result;
+				mpfr_set_prec(result.backend().data(), precision);
+				mpfr_set(result.backend().data(), x, MPFR_RNDN);
+				return result;
+			}
+
+			static void Set(dbl & out, dbl const& in)
+			{
+				out = in;
+			}
+
+			static void Set(dbl & out, mpfr const& in)
+			{
+				out = dbl(in.real().convert_to<double>(), in.imag().convert_to<double>());
+			}
+
+			static void Set(mpfr & out, dbl const& in)
+			{
+				out = mpfr(mpfr_float(in.real()), mpfr_float(in.imag()));
+			}
+
+			static void Set(mpfr & out, mpfr const& in)
+			{
+				out = in;
+			}
+
+			char const* data_;
+			std::vector<std::size_t> offsets_; ///< Where each complete record starts.
+		};
+
+
+
+		/**
+		\brief A binary solution file mapped into memory, read only, and read in place by a BinarySolutionView.
+
+		Nothing is decoded until asked for, so a file of many solutions at high precision opens in the time it takes to find its records, and starts paths at once when handed to a ParallelSolver for a parameter homotopy.
+
+		\code
+		MappedSolutionFile generic("generic/solutions.b2sol");
+		auto starts = generic.View().Select([](solution_file::RecordHeader const& h){ return (h.flags & solution_file::Finite)!=0;});
+		ParallelSolver<AMPTracker> solver(H, starts, setup);
+		\endcode
+		*/
+		class MappedSolutionFile
+		{
+		public:
+
+			/**
+			\throws boost::interprocess::interprocess_exception If the file cannot be mapped, and std::runtime_error if it is not a solution file in this machine's layout.
+			*/
+			explicit MappedSolutionFile(boost::filesystem::path const& path) :
+				file_(path.string().c_str(), boost::interprocess::read_only),
+				region_(file_, boost::interprocess::read_only),
+				view_(static_cast<char const*>(region_.get_address()), region_.get_size())
+			{
+				region_.advise(boost::interprocess::mapped_region::advice_sequential);
+			}
+
+			MappedSolutionFile(MappedSolutionFile const&) = delete;
+			MappedSolutionFile& operator=(MappedSolutionFile const&) = delete;
+
+			/**
+			\brief The records of the file.  Views of it must not outlive it.
+			*/
+			BinarySolutionView const& View() const
+			{
+				return view_;
+			}
+
+		private:
+			boost::interprocess::file_mapping file_;
+			boost::interprocess::mapped_region region_;
+			BinarySolutionView view_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,562 @@
+//This file is part of Bertini 2.
+//
+//solve_metrics.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solve_metrics.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solve_metrics.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file solve_metrics.hpp
+
+\brief Contains SolveMetrics, live counts of a running solve, readable from any thread, and MetricsDumper, which writes them to a file every so often, as JSON or in the Prometheus text format.
+
+The counts are atomics, updated by the threads of the solve as they go, without locks, and read by whoever wants them, so a solve of many hours can be watched for stuck paths and idle threads while it runs, see ParallelSolver::SetMetricsFile.
+*/
+
+#ifndef BERTINI_TRACKING_SOLVE_METRICS_HPP
+#define BERTINI_TRACKING_SOLVE_METRICS_HPP
+
+#include "bertini2/logging.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The name of a SuccessCode, as written in metrics.
+		*/
+		inline char const* SuccessCodeName(SuccessCode code)
+		{
+			static char const* names[] = {"Success", "HigherPrecisionNecessary", "ReduceStepSize", "GoingToInfinity", "FailedToConverge", "MatrixSolveFailure", "MatrixSolveFailureFirstPartOfPrediction", "MaxNumStepsTaken", "MaxPrecisionReached", "MinStepSizeReached", "Failure", "SingularStartPoint", "ExternallyTerminated", "MinTrackTimeReached", "SecurityMaxNormReached", "CycleNumTooHigh"};
+			return names[static_cast<unsigned>(code)];
+		}
+
+
+		/**
+		\brief What a thread of a solve is doing.
+		*/
+		enum class ThreadActivity : std::uint8_t
+		{
+			Idle, ///< Looking for a task, or the solve is not running.
+			Tracking, ///< Tracking a path to the endgame boundary.
+			Endgame ///< Running the endgame of a path.
+		};
+
+
+		/**
+		\brief A copy of the counts of a SolveMetrics, at one time.
+		*/
+		struct MetricsSnapshot
+		{
+			static constexpr unsigned NumSuccessCodes = static_cast<unsigned>(SuccessCode::CycleNumTooHigh) + 1;
+			static constexpr unsigned NumPrecisionBuckets = 8;
+
+			/**
+			\brief The upper bounds, in digits, of the buckets of the precision histogram.  The last is unbounded.
+			*/
+			static constexpr unsigned PrecisionBucketBound(unsigned bucket)
+			{
+				return bucket+1 < NumPrecisionBuckets ? 16u << bucket : 0;
+			}
+
+			/**
+			\brief The state of one thread.
+			*/
+			struct Thread
+			{
+				ThreadActivity activity = ThreadActivity::Idle;
+				size_t path = 0; ///< The path being worked on, if not idle.
+				unsigned long long num_steps = 0; ///< Successful steps taken by the thread's tracker, tracking and in endgames.
+				double seconds_since_activity = 0; ///< Since the thread last took a step, or started or finished a task.  Large for a busy thread means a stuck path, and for an idle thread one starved of work.
+				size_t queue_depth = 0; ///< The tasks in the thread's queue when it last started or finished a task.
+			};
+
+			double seconds = 0; ///< Since the solve started.
+			size_t num_paths = 0; ///< The paths of the solve.
+			size_t num_finished = 0; ///< The paths finished, whatever their success code.
+			size_t num_in_flight = 0; ///< The paths started and not yet finished, being tracked, or waiting for their endgame or another try.
+			size_t num_stopped = 0; ///< The paths in flight when the solve was cancelled, which a checkpointed run resumes.
+			std::array<size_t, NumSuccessCodes> num_by_code{}; ///< The paths finished, by success code.
+			std::array<size_t, NumPrecisionBuckets> precision_histogram{}; ///< The paths finished, by the highest precision they reached, in the bucket of the least bound at least it.
+			unsigned long long precision_sum = 0; ///< The sum of the highest precisions of the paths finished, in digits.
+			unsigned long long num_steps = 0; ///< Successful steps taken, by all threads.
+			double steps_per_second = 0; ///< The mean rate of successful steps since the solve started.
+			std::vector<Thread> threads;
+
+			size_t NumByCode(SuccessCode code) const
+			{
+				return num_by_code[static_cast<unsigned>(code)];
+			}
+
+			size_t NumQueued() const
+			{
+				size_t n = 0;
+				for (auto const& t : threads)
+					n += t.queue_depth;
+				return n;
+			}
+
+			/**
+			\brief Write as a JSON object.
+			*/
+			void WriteJson(std::ostream & out) const
+			{
+				out << "{\n";
+				out << "  \"seconds\": " << seconds << ",\n";
+				out << "  \"num_paths\": " << num_paths << ",\n";
+				out << "  \"num_finished\": " << num_finished << ",\n";
+				out << "  \"num_in_flight\": " << num_in_flight << ",\n";
+				out << "  \"num_stopped\": " << num_stopped << ",\n";
+				out << "  \"num_queued\": " << NumQueued() << ",\n";
+				out << "  \"num_steps\": " << num_steps << ",\n";
+				out << "  \"steps_per_second\": " << steps_per_second << ",\n";
+
+				out << "  \"finished_by_code\": {";
+				bool first = true;
+				for (unsigned ii = 0; ii < NumSuccessCodes; ++ii)
+					if (num_by_code[ii] > 0)
+					{
+						out << (first ? "" : ",") << "\n    \"" << SuccessCodeName(static_cast<SuccessCode>(ii)) << "\": " << num_by_code[ii];
+						first = false;
+					}
+				out << (first ? "" : "\n  ") << "},\n";
+
+				out << "  \"precision_histogram\": [";
+				for (unsigned ii = 0; ii < NumPrecisionBuckets; ++ii)
+				{
+					out << (ii ? "," : "") << "\n    {\"le\": ";
+					if (PrecisionBucketBound(ii))
+						out << PrecisionBucketBound(ii);
+					else
+						out << "null";
+					out << ", \"count\": " << precision_histogram[ii] << "}";
+				}
+				out << "\n  ],\n";
+
+				static char const* activities[] = {"idle", "tracking", "endgame"};
+				out << "  \"threads\": [";
+				for (size_t ii = 0; ii < threads.size(); ++ii)
+				{
+					auto const& t = threads[ii];
+					out << (ii ? "," : "") << "\n    {\"activity\": \"" << activities[static_cast<unsigned>(t.activity)] << "\"";
+					if (t.activity!=ThreadActivity::Idle)
+						out << ", \"path\": " << t.path;
+					out << ", \"num_steps\": " << t.num_steps << ", \"seconds_since_activity\": " << t.seconds_since_activity << ", \"queue_depth\": " << t.queue_depth << "}";
+				}
+				out << "\n  ]\n}\n";
+			}
+
+			/**
+			\brief Write in the Prometheus text exposition format, as read by the textfile collector of the node exporter, with metric names starting bertini_solve_.
+			*/
+			void WritePrometheus(std::ostream & out) const
+			{
+				out << "# HELP bertini_solve_seconds Seconds since the solve started.\n# TYPE bertini_solve_seconds gauge\n";
+				out << "bertini_solve_seconds " << seconds << "\n";
+				out << "# HELP bertini_solve_paths The paths of the solve.\n# TYPE bertini_solve_paths gauge\n";
+				out << "bertini_solve_paths " << num_paths << "\n";
+				out << "# HELP bertini_solve_paths_in_flight Paths started and not yet finished.\n# TYPE bertini_solve_paths_in_flight gauge\n";
+				out << "bertini_solve_paths_in_flight " << num_in_flight << "\n";
+				out << "# HELP bertini_solve_paths_stopped Paths in flight when the solve was cancelled.\n# TYPE bertini_solve_paths_stopped gauge\n";
+				out << "bertini_solve_paths_stopped " << num_stopped << "\n";
+				out << "# HELP bertini_solve_paths_finished Paths finished, by success code.\n# TYPE bertini_solve_paths_finished gauge\n";
+				for (unsigned ii = 0; ii < NumSuccessCodes; ++ii)
+					out << "bertini_solve_paths_finished{code=\"" << SuccessCodeName(static_cast<SuccessCode>(ii)) << "\"} " << num_by_code[ii] << "\n";
+
+				out << "# HELP bertini_solve_path_precision_digits The highest precision reached by each finished path.\n# TYPE bertini_solve_path_precision_digits histogram\n";
+				size_t cumulative = 0;
+				for (unsigned ii = 0; ii < NumPrecisionBuckets; ++ii)
+				{
+					cumulative += precision_histogram[ii];
+					out << "bertini_solve_path_precision_digits_bucket{le=\"";
+					if (PrecisionBucketBound(ii))
+						out << PrecisionBucketBound(ii);
+					else
+						out << "+Inf";
+					out << "\"} " << cumulative << "\n";
+				}
+				out << "bertini_solve_path_precision_digits_sum " << precision_sum << "\n";
+				out << "bertini_solve_path_precision_digits_count " << cumulative << "\n";
+
+				out << "# HELP bertini_solve_steps_total Successful steps taken.\n# TYPE bertini_solve_steps_total counter\n";
+				out << "bertini_solve_steps_total " << num_steps << "\n";
+				out << "# HELP bertini_solve_steps_per_second The mean rate of successful steps since the solve started.\n# TYPE bertini_solve_steps_per_second gauge\n";
+				out << "bertini_solve_steps_per_second " << steps_per_second << "\n";
+
+				out << "# HELP bertini_solve_thread_busy Whether each thread is tracking or running an endgame.\n# TYPE bertini_solve_thread_busy gauge\n";
+				for (size_t ii = 0; ii < threads.size(); ++ii)
+					out << "bertini_solve_thread_busy{thread=\"" << ii << "\"} " << (threads[ii].activity==ThreadActivity::Idle ? 0 : 1) << "\n";
+				out << "# HELP bertini_solve_thread_steps_total Successful steps taken by each thread.\n# TYPE bertini_solve_thread_steps_total counter\n";
+				for (size_t ii = 0; ii < threads.size(); ++ii)
+					out << "bertini_solve_thread_steps_total{thread=\"" << ii << "\"} " << threads[ii].num_steps << "\n";
+				out << "# HELP bertini_solve_thread_seconds_since_activity Seconds since each thread last took a step, or started or finished a task.\n# TYPE bertini_solve_thread_seconds_since_activity gauge\n";
+				for (size_t ii = 0; ii < threads.size(); ++ii)
+					out << "bertini_solve_thread_seconds_since_activity{thread=\"" << ii << "\"} " << threads[ii].seconds_since_activity << "\n";
+				out << "# HELP bertini_solve_queue_depth Tasks in each thread's queue.\n# TYPE bertini_solve_queue_depth gauge\n";
+				for (size_t ii = 0; ii < threads.size(); ++ii)
+					out << "bertini_solve_queue_depth{thread=\"" << ii << "\"} " << threads[ii].queue_depth << "\n";
+			}
+		};
+
+
+		/**
+		\brief Live counts of the paths of a solve, the precisions they reach, the steps taken, and what each thread is doing.
+
+		Updated by the threads of the solve with relaxed atomic operations, and read with Take from any thread, at any time.  The counts are each exact, but a snapshot taken while the solve runs need not be consistent across them, say a path counted as finished and still in flight, as they are not updated together.
+
+		\code
+		auto snapshot = solver.Metrics().Take();
+		std::cout << snapshot.num_finished << " of " << snapshot.num_paths << " at " << snapshot.steps_per_second << " steps/s\n";
+		\endcode
+		*/
+		class SolveMetrics
+		{
+			using Clock = std::chrono::steady_clock;
+
+		public:
+
+			explicit
+			SolveMetrics(unsigned num_threads) : threads_(num_threads)
+			{
+				Start(0);
+			}
+
+			SolveMetrics(SolveMetrics const&) = delete;
+			SolveMetrics& operator=(SolveMetrics const&) = delete;
+
+			unsigned NumThreads() const
+			{
+				return static_cast<unsigned>(threads_.size());
+			}
+
+			/**
+			\brief Zero the counts, and start the clock, for a solve of a number of paths.  Call before the threads start.
+			*/
+			void Start(size_t num_paths)
+			{
+				start_.store(Now(), std::memory_order_relaxed);
+				num_paths_.store(num_paths, std::memory_order_relaxed);
+				num_finished_.store(0, std::memory_order_relaxed);
+				num_in_flight_.store(0, std::memory_order_relaxed);
+				num_stopped_.store(0, std::memory_order_relaxed);
+				for (auto& c : num_by_code_)
+					c.store(0, std::memory_order_relaxed);
+				for (auto& c : precision_histogram_)
+					c.store(0, std::memory_order_relaxed);
+				precision_sum_.store(0, std::memory_order_relaxed);
+				for (auto& t : threads_)
+				{
+					t.activity.store(static_cast<std::uint8_t>(ThreadActivity::Idle), std::memory_order_relaxed);
+					t.path.store(0, std::memory_order_relaxed);
+					t.num_steps.store(0, std::memory_order_relaxed);
+					t.last_activity.store(0, std::memory_order_relaxed);
+					t.queue_depth.store(0, std::memory_order_relaxed);
+				}
+			}
+
+			/**
+			\brief Count a path as in flight.
+			*/
+			void PathStarted()
+			{
+				num_in_flight_.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Count a path in flight as finished.
+
+			\param code Its success code.
+			\param precision The highest precision it reached, in digits.
+			*/
+			void PathFinished(SuccessCode code, unsigned precision)
+			{
+				num_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+				num_finished_.fetch_add(1, std::memory_order_relaxed);
+				num_by_code_[static_cast<unsigned>(code)].fetch_add(1, std::memory_order_relaxed);
+				precision_histogram_[PrecisionBucket(precision)].fetch_add(1, std::memory_order_relaxed);
+				precision_sum_.fetch_add(precision, std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Uncount a path finished with a code and precision, to be tracked again.  It is counted as in flight again when it starts.
+			*/
+			void PathReopened(SuccessCode code, unsigned precision)
+			{
+				num_finished_.fetch_sub(1, std::memory_order_relaxed);
+				num_by_code_[static_cast<unsigned>(code)].fetch_sub(1, std::memory_order_relaxed);
+				precision_histogram_[PrecisionBucket(precision)].fetch_sub(1, std::memory_order_relaxed);
+				precision_sum_.fetch_sub(precision, std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Count a path in flight as stopped by a cancellation, not finished.
+			*/
+			void PathStopped()
+			{
+				num_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+				num_stopped_.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Note a thread starting a task on a path.
+
+			\param thread The index of the thread.
+			\param path The path.
+			\param activity What the task is.
+			\param queue_depth The number of tasks in the thread's queue.
+			*/
+			void TaskStarted(unsigned thread, size_t path, ThreadActivity activity, size_t queue_depth)
+			{
+				auto& t = threads_[thread];
+				t.path.store(path, std::memory_order_relaxed);
+				t.activity.store(static_cast<std::uint8_t>(activity), std::memory_order_relaxed);
+				t.queue_depth.store(queue_depth, std::memory_order_relaxed);
+				t.last_activity.store(Now(), std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Note a thread finishing a task, and going idle until its next.
+			*/
+			void TaskDone(unsigned thread, size_t queue_depth)
+			{
+				auto& t = threads_[thread];
+				t.activity.store(static_cast<std::uint8_t>(ThreadActivity::Idle), std::memory_order_relaxed);
+				t.queue_depth.store(queue_depth, std::memory_order_relaxed);
+				t.last_activity.store(Now(), std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Count a successful step by a thread's tracker.
+			*/
+			void Step(unsigned thread)
+			{
+				auto& t = threads_[thread];
+				t.num_steps.fetch_add(1, std::memory_order_relaxed);
+				t.last_activity.store(Now(), std::memory_order_relaxed);
+			}
+
+			/**
+			\brief Set the queue depth of every thread to zero, once all their tasks are done.
+			*/
+			void ClearQueues()
+			{
+				for (auto& t : threads_)
+					t.queue_depth.store(0, std::memory_order_relaxed);
+			}
+
+			/**
+			\brief A copy of the counts as they are now.
+			*/
+			MetricsSnapshot Take() const
+			{
+				auto now = Now();
+				auto start = start_.load(std::memory_order_relaxed);
+
+				MetricsSnapshot s;
+				s.seconds = Seconds(now - start);
+				s.num_paths = num_paths_.load(std::memory_order_relaxed);
+				s.num_finished = num_finished_.load(std::memory_order_relaxed);
+				s.num_in_flight = num_in_flight_.load(std::memory_order_relaxed);
+				s.num_stopped = num_stopped_.load(std::memory_order_relaxed);
+				for (unsigned ii = 0; ii < MetricsSnapshot::NumSuccessCodes; ++ii)
+					s.num_by_code[ii] = num_by_code_[ii].load(std::memory_order_relaxed);
+				for (unsigned ii = 0; ii < MetricsSnapshot::NumPrecisionBuckets; ++ii)
+					s.precision_histogram[ii] = precision_histogram_[ii].load(std::memory_order_relaxed);
+				s.precision_sum = precision_sum_.load(std::memory_order_relaxed);
+
+				s.threads.resize(threads_.size());
+				for (size_t ii = 0; ii < threads_.size(); ++ii)
+				{
+					auto const& t = threads_[ii];
+					auto& u = s.threads[ii];
+					u.activity = static_cast<ThreadActivity>(t.activity.load(std::memory_order_relaxed));
+					u.path = t.path.load(std::memory_order_relaxed);
+					u.num_steps = t.num_steps.load(std::memory_order_relaxed);
+					u.queue_depth = t.queue_depth.load(std::memory_order_relaxed);
+					auto last = t.last_activity.load(std::memory_order_relaxed);
+					u.seconds_since_activity = last > 0 ? Seconds(now - last) : s.seconds;
+					s.num_steps += u.num_steps;
+				}
+				s.steps_per_second = s.seconds > 0 ? s.num_steps / s.seconds : 0;
+				return s;
+			}
+
+			/**
+			\brief The bucket of the precision histogram of a precision.
+			*/
+			static unsigned PrecisionBucket(unsigned precision)
+			{
+				unsigned bucket = 0;
+				while (bucket+1 < MetricsSnapshot::NumPrecisionBuckets && precision > MetricsSnapshot::PrecisionBucketBound(bucket))
+					++bucket;
+				return bucket;
+			}
+
+		private:
+
+			/**
+			The state of one thread, each field written by that thread only.
+			*/
+			struct ThreadSlot
+			{
+				std::atomic<std::uint8_t> activity{0};
+				std::atomic<size_t> path{0};
+				std::atomic<unsigned long long> num_steps{0};
+				std::atomic<long long> last_activity{0}; ///< Nanoseconds of the steady clock, or 0 if none since Start.
+				std::atomic<size_t> queue_depth{0};
+			};
+
+			static long long Now()
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+			}
+
+			static double Seconds(long long nanoseconds)
+			{
+				return nanoseconds * 1e-9;
+			}
+
+			std::atomic<long long> start_{0}; ///< Nanoseconds of the steady clock at Start.
+			std::atomic<size_t> num_paths_{0};
+			std::atomic<size_t> num_finished_{0};
+			std::atomic<size_t> num_in_flight_{0};
+			std::atomic<size_t> num_stopped_{0};
+			std::array<std::atomic<size_t>, MetricsSnapshot::NumSuccessCodes> num_by_code_;
+			std::array<std::atomic<size_t>, MetricsSnapshot::NumPrecisionBuckets> precision_histogram_;
+			std::atomic<unsigned long long> precision_sum_{0};
+			std::vector<ThreadSlot> threads_;
+		};
+
+
+		/**
+		\brief The formats a MetricsDumper writes.
+		*/
+		enum class MetricsFormat
+		{
+			Json, ///< A JSON object, see MetricsSnapshot::WriteJson.
+			Prometheus ///< The Prometheus text format, for the textfile collector of the node exporter, see MetricsSnapshot::WritePrometheus.
+		};
+
+
+		/**
+		\brief Writes the counts of a SolveMetrics to a file every interval, from a thread of its own, for its lifetime, and once more when destroyed.
+
+		Each write goes to a temporary file, which is then renamed over the file, so readers never see a partial one.  Failures to write are logged, and do not stop the solve.
+		*/
+		class MetricsDumper
+		{
+		public:
+
+			MetricsDumper(SolveMetrics const& metrics, boost::filesystem::path const& file, MetricsFormat format, std::chrono::duration<double> interval) : metrics_(metrics), file_(file), format_(format), interval_(interval)
+			{
+				thread_ = std::thread([this]()
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						while (!done_)
+						{
+							Write();
+							stop_.wait_for(lock, interval_, [this](){ return done_;});
+						}
+					});
+			}
+
+			~MetricsDumper()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					done_ = true;
+				}
+				stop_.notify_all();
+				thread_.join();
+				Write();
+			}
+
+			MetricsDumper(MetricsDumper const&) = delete;
+			MetricsDumper& operator=(MetricsDumper const&) = delete;
+
+			/**
+			\brief Write a snapshot of the counts to a file, by way of a temporary file renamed over it.
+
+			\throws std::runtime_error, if the temporary file can't be written, or boost::filesystem::filesystem_error if it can't be renamed.
+			*/
+			static void Write(SolveMetrics const& metrics, boost::filesystem::path const& file, MetricsFormat format)
+			{
+				auto snapshot = metrics.Take();
+				auto temp_path = file;
+				temp_path += boost::filesystem::unique_path(".%%%%-%%%%-%%%%");
+				{
+					std::ofstream out(temp_path.string());
+					if (!out)
+						throw std::runtime_error("unable to write metrics file " + temp_path.string());
+
+					if (format==MetricsFormat::Json)
+						snapshot.WriteJson(out);
+					else
+						snapshot.WritePrometheus(out);
+				}
+				boost::filesystem::rename(temp_path, file);
+			}
+
+		private:
+
+			void Write() const
+			{
+				try
+				{
+					Write(metrics_, file_, format_);
+				}
+				catch (std::exception const& e)
+				{
+					BERTINI_LOG(warning) << "failed to write metrics file " << file_.string() << ": " << e.what();
+				}
+			}
+
+			SolveMetrics const& metrics_;
+			boost::filesystem::path file_;
+			MetricsFormat format_;
+			std::chrono::duration<double> interval_;
+
+			std::mutex mutex_;
+			std::condition_variable stop_;
+			bool done_ = false;
+			std::thread thread_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,147 @@
+//This file is part of Bertini 2.
+//
+//step_history.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//step_history.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with step_history.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file step_history.hpp
+
+\brief Provides StepHistory, the accepted steps of a path, with dense output between them by cubic Hermite interpolation.
+*/
+
+#ifndef BERTINI_TRACKING_STEP_HISTORY_HPP
+#define BERTINI_TRACKING_STEP_HISTORY_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/mpfr_extensions.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The time, point, and derivative of the path with respect to time, at the start of a path and after each accepted step of it.
+
+		Kept by a tracker while tracking, when given one, see Tracker::TrackPath.  Between two steps, the path is approximated by the cubic Hermite interpolant of the points and derivatives at them, accurate to fourth order in the length of the step, so that points at times between steps are had by one short Newton refinement rather than by tracking to them.
+
+		\tparam CT The complex type of the points, that of the tracker keeping it.
+		*/
+		template<typename CT>
+		class StepHistory
+		{
+		public:
+
+			struct Step
+			{
+				CT time;
+				Vec<CT> point;
+				Vec<CT> derivative; ///< dx/dt at the time.
+				double distance; ///< From the time of the first step, along the path of time.
+			};
+
+			void Clear()
+			{
+				steps_.clear();
+			}
+
+			/**
+			\brief Keep a step, taken after the ones kept before it.
+			*/
+			void Add(CT const& time, Vec<CT> const& point, Vec<CT> const& derivative)
+			{
+				using std::abs;
+				const double distance = steps_.empty() ? 0 : static_cast<double>(abs(time - steps_.front().time));
+				steps_.push_back(Step{time, point, derivative, distance});
+			}
+
+			size_t Size() const
+			{
+				return steps_.size();
+			}
+
+			std::vector<Step> const& Steps() const
+			{
+				return steps_;
+			}
+
+			/**
+			\brief Approximate the point of the path at a time between the first and last steps kept.
+
+			In multiple precision, at the higher of the precisions of the two steps around the time, to which the result is set.
+
+			\param[out] x The approximation.
+			\param t The time, on the path of time between the first and last steps.
+			\return Whether the time is within the steps kept.  If not, x is not changed.
+			*/
+			bool Interpolate(Vec<CT> & x, CT const& t) const
+			{
+				using std::abs;
+				using bertini::Precision;
+				using RT = typename Eigen::NumTraits<CT>::Real;
+
+				if (steps_.size() < 2)
+					return false;
+
+				const double distance = static_cast<double>(abs(t - steps_.front().time));
+				if (distance > steps_.back().distance)
+					return false;
+
+				auto after = std::lower_bound(steps_.begin()+1, steps_.end(), distance,
+												[](Step const& s, double d){ return s.distance < d; });
+				if (after==steps_.end())
+					--after;
+				Step const& a = *(after-1);
+				Step const& b = *after;
+
+				const unsigned prec = std::max(Precision(a.point), Precision(b.point));
+				ScopedPrecision working(std::is_same<CT, dbl>::value ? DefaultPrecision() : prec);
+
+				CT t0 = a.time, t1 = b.time, s = t;
+				Vec<CT> x0 = a.point, x1 = b.point, d0 = a.derivative, d1 = b.derivative;
+				Precision(t0, prec); Precision(t1, prec); Precision(s, prec);
+				Precision(x0, prec); Precision(x1, prec); Precision(d0, prec); Precision(d1, prec);
+
+				const CT h = t1 - t0;
+				const CT u = (s - t0)/h;
+				const CT u2 = u*u, u3 = u2*u;
+
+				const CT h00 = RT(2)*u3 - RT(3)*u2 + RT(1);
+				const CT h10 = (u3 - RT(2)*u2 + u)*h;
+				const CT h01 = RT(3)*u2 - RT(2)*u3;
+				const CT h11 = (u3 - u2)*h;
+
+				x = h00*x0 + h10*d0 + h01*x1 + h11*d1;
+				return true;
+			}
+
+		private:
+			std::vector<Step> steps_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
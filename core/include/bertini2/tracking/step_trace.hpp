@@ -0,0 +1,624 @@
+//This file is part of Bertini 2.
+//
+//step_trace.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//step_trace.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with step_trace.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file step_trace.hpp
+
+\brief Provides StepTraceRecorder, an observer which records a compact binary record of every step a tracker takes, and StepTraceFile, which writes the records of many trackers to one file from a background thread.  StepRecorder keeps the same records in memory.
+
+Unlike GoryDetailLogger, which formats whole vectors as text at every event, a step costs one fixed-size copy into a buffer owned by the tracker's thread, so traces can be left on for every path of a production run, and the paths which turn out to be difficult investigated afterwards.
+*/
+
+#ifndef BERTINI_TRACKING_STEP_TRACE_HPP
+#define BERTINI_TRACKING_STEP_TRACE_HPP
+
+#include "bertini2/tracking/events.hpp"
+#include "bertini2/tracking/base_tracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/type_index.hpp>
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The layout of binary step trace files.
+
+		A file is a FileHeader, followed by Records, in the byte order of the machine which wrote it.  Records of different paths are interleaved, in the order their threads' buffers were written out, and those of one path are in the order its steps were taken.  A file cut short by a crash ends at most with part of a record, which readers ignore.
+		*/
+		namespace step_trace{
+
+			const char Magic[8] = {'B','2','T','R','A','C','E','\0'};
+			const std::uint32_t Version = 1;
+
+			struct FileHeader
+			{
+				char magic[8];
+				std::uint32_t version;
+				std::uint32_t record_bytes; ///< sizeof(Record).
+			};
+
+			/**
+			One step.  Quantities which are multiple precision in the tracker are rounded to double.
+			*/
+			struct Record
+			{
+				std::uint64_t path; ///< As set on the recorder, such as the index of the start point.
+				double time_real; ///< The time at the end of the step, or at its start if it failed.
+				double time_imag;
+				double stepsize; ///< The stepsize after the step, as adjusted by it.
+				double condition_number; ///< The most recent estimate of the condition number of the Jacobian, in the precision of the step.
+				double norm_delta_z; ///< The norm of the most recent Newton correction, in the precision of the step.  A residual of the step.
+				std::uint32_t step; ///< The number of steps taken in the call to TrackPath, counting this one.
+				std::uint32_t precision; ///< The precision the step was taken at, in digits.
+				std::int32_t success; ///< The SuccessCode of the step.
+				std::uint32_t reserved;
+			};
+
+			static_assert(sizeof(FileHeader)==16 && sizeof(Record)==64, "step trace records must have the sizes of the format");
+
+			inline
+			double ToDouble(double x)
+			{
+				return x;
+			}
+
+			inline
+			double ToDouble(mpfr_float const& x)
+			{
+				return x.convert_to<double>();
+			}
+
+			/**
+			The record of the step a tracker just finished, taken at a precision.
+			*/
+			template<class TrackerT>
+			Record MakeRecord(TrackerT const& t, std::uint64_t path, unsigned precision)
+			{
+				using std::real;
+				using std::imag;
+
+				auto time = t.CurrentTime();
+
+				Record r{};
+				r.path = path;
+				r.time_real = ToDouble(real(time));
+				r.time_imag = ToDouble(imag(time));
+				r.stepsize = ToDouble(t.CurrentStepsize());
+				r.condition_number = t.ConditionNumberEstimate(precision);
+				r.norm_delta_z = t.NormDeltaZ(precision);
+				r.step = t.NumTotalStepsTaken();
+				r.precision = precision;
+				r.success = static_cast<std::int32_t>(t.StepSuccessCode());
+				return r;
+			}
+		} // re: namespace step_trace
+
+
+
+		/**
+		\brief Writes the step records of many trackers to one file, from a background thread.
+
+		Each recording thread has its own Ring, a fixed-size single-producer single-consumer buffer.  Pushing a record takes no lock and never waits: if the background thread has fallen so far behind that a ring is full, the record is dropped and counted instead, so tracking is never held up by the disk.  The background thread wakes every flush interval and writes out whatever the rings hold, and Flush and Close write out the rest.
+
+		\code
+		auto file = std::make_shared<StepTraceFile>("steps.b2trace");
+		StepTraceRecorder<AMPTracker> recorder(file);
+		tracker.AddObserver(&recorder);
+
+		recorder.SetPath(0);
+		tracker.TrackPath(result, t_start, t_end, start_point);
+
+		file->Close();
+		auto records = ReadStepTrace("steps.b2trace");
+		\endcode
+		*/
+		class StepTraceFile
+		{
+		public:
+
+			/**
+			\brief A buffer of records from one thread, to be written to the file.  Made by StepTraceFile::NewRing, and owned by the file.
+			*/
+			class Ring
+			{
+			public:
+
+				explicit
+				Ring(std::size_t capacity) : records_(RoundUpToPowerOfTwo(capacity)), mask_(records_.size()-1)
+				{}
+
+				/**
+				\brief Add a record, to be written later.  Only ever call from one thread at a time.
+
+				\return Whether there was room.  If not, the record is dropped, and counted by NumDropped.
+				*/
+				bool Push(step_trace::Record const& r)
+				{
+					auto head = head_.load(std::memory_order_relaxed);
+					if (head - tail_.load(std::memory_order_acquire) == records_.size())
+					{
+						dropped_.fetch_add(1, std::memory_order_relaxed);
+						return false;
+					}
+
+					records_[head & mask_] = r;
+					head_.store(head+1, std::memory_order_release);
+					return true;
+				}
+
+				/**
+				\brief The number of records dropped because the ring was full.
+				*/
+				unsigned long long NumDropped() const
+				{
+					return dropped_.load(std::memory_order_relaxed);
+				}
+
+			private:
+
+				friend class StepTraceFile;
+
+				static std::size_t RoundUpToPowerOfTwo(std::size_t n)
+				{
+					std::size_t p = 1;
+					while (p < n)
+						p *= 2;
+					return p;
+				}
+
+				/**
+				Calls write(records, count) on everything pushed but not yet popped, in at most two contiguous pieces, and returns how many there were.  Only the file calls this, under its lock, so there is only ever one consumer.
+				*/
+				template<typename F>
+				std::size_t Pop(F write)
+				{
+					auto tail = tail_.load(std::memory_order_relaxed);
+					auto head = head_.load(std::memory_order_acquire);
+					auto count = head - tail;
+					if (count==0)
+						return 0;
+
+					auto first = tail & mask_;
+					auto to_end = std::min(count, records_.size() - first);
+					write(&records_[first], to_end);
+					if (to_end < count)
+						write(&records_[0], count - to_end);
+
+					tail_.store(head, std::memory_order_release);
+					return count;
+				}
+
+				std::vector<step_trace::Record> records_;
+				const std::size_t mask_;
+
+				// the producer writes head_ and the consumer tail_, so they are kept on separate cache lines.
+				char pad0_[64];
+				std::atomic<std::size_t> head_{0};
+				char pad1_[64];
+				std::atomic<std::size_t> tail_{0};
+				char pad2_[64];
+				std::atomic<unsigned long long> dropped_{0};
+			};
+
+
+			/**
+			\param file The trace file.  An existing file is replaced.
+			\param ring_capacity The number of records each ring holds.  Rounded up to a power of two.
+			\param flush_interval_seconds How often the background thread writes out the rings.
+
+			\throws std::runtime_error If the file cannot be opened.
+			*/
+			explicit
+			StepTraceFile(boost::filesystem::path const& file, std::size_t ring_capacity = 1<<14, double flush_interval_seconds = 0.05)
+				: ring_capacity_(ring_capacity), flush_interval_(flush_interval_seconds)
+			{
+				out_.open(file.string(), std::ios::binary | std::ios::trunc);
+				if (!out_)
+					throw std::runtime_error("unable to open step trace file " + file.string());
+
+				step_trace::FileHeader h{};
+				std::memcpy(h.magic, step_trace::Magic, sizeof(h.magic));
+				h.version = step_trace::Version;
+				h.record_bytes = sizeof(step_trace::Record);
+				out_.write(reinterpret_cast<char const*>(&h), sizeof(h));
+
+				thread_ = std::thread([this]{ Run(); });
+			}
+
+			StepTraceFile(StepTraceFile const&) = delete;
+			StepTraceFile& operator=(StepTraceFile const&) = delete;
+
+			~StepTraceFile()
+			{
+				try
+				{
+					Close();
+				}
+				catch (...)
+				{}
+			}
+
+			/**
+			\brief Make a ring for a thread to push records to.  It lives as long as the file.
+			*/
+			Ring& NewRing()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				rings_.emplace_back(new Ring(ring_capacity_));
+				return *rings_.back();
+			}
+
+			/**
+			\brief Write out everything pushed so far, and flush the file, on the calling thread.
+
+			\throws Any error met writing the file.
+			*/
+			void Flush()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (error_)
+					std::rethrow_exception(error_);
+				if (!out_.is_open())
+					return;
+				WriteRings();
+				out_.flush();
+			}
+
+			/**
+			\brief Stop the background thread, write out everything pushed so far, and close the file.  Called by the destructor if not before.  Records pushed afterwards are kept in their rings, and never written.
+
+			\throws Any error met writing the file.
+			*/
+			void Close()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					closing_ = true;
+				}
+				wake_.notify_one();
+				if (thread_.joinable())
+					thread_.join();
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (error_)
+					std::rethrow_exception(error_);
+				if (!out_.is_open())
+					return;
+				WriteRings();
+				out_.close();
+			}
+
+			/**
+			\brief The number of records written to the file so far.
+			*/
+			unsigned long long NumWritten() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return num_written_;
+			}
+
+			/**
+			\brief The number of records dropped by all the rings, because they were full.
+			*/
+			unsigned long long NumDropped() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				unsigned long long dropped = 0;
+				for (auto const& r : rings_)
+					dropped += r->NumDropped();
+				return dropped;
+			}
+
+		private:
+
+			void Run()
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				while (!closing_)
+				{
+					wake_.wait_for(lock, flush_interval_, [this]{ return closing_; });
+					try
+					{
+						WriteRings();
+					}
+					catch (...)
+					{
+						error_ = std::current_exception();
+						return;
+					}
+				}
+			}
+
+			// called with the lock held.
+			void WriteRings()
+			{
+				for (auto& r : rings_)
+					num_written_ += r->Pop([this](step_trace::Record const* records, std::size_t count)
+						{
+							out_.write(reinterpret_cast<char const*>(records), count*sizeof(step_trace::Record));
+						});
+
+				if (!out_)
+					throw std::runtime_error("failed writing step trace file");
+			}
+
+			std::ofstream out_;
+			const std::size_t ring_capacity_;
+			const std::chrono::duration<double> flush_interval_;
+
+			mutable std::mutex mutex_; ///< Guards the list of rings, consuming from them, the file, and the flags.
+			std::condition_variable wake_; ///< Signalled when the file is closing.
+			std::deque<std::unique_ptr<Ring>> rings_;
+			bool closing_ = false;
+			std::exception_ptr error_;
+			unsigned long long num_written_ = 0;
+
+			std::thread thread_;
+		};
+
+
+
+		/**
+		\brief Read the records of a step trace file.
+
+		\throws std::runtime_error If the file cannot be read, or is not a step trace file of this version and machine's layout.  A file cut short by a crash is read up to its last complete record.
+		*/
+		inline
+		std::vector<step_trace::Record> ReadStepTrace(boost::filesystem::path const& file)
+		{
+			std::ifstream in(file.string(), std::ios::binary);
+			if (!in)
+				throw std::runtime_error("unable to open step trace file " + file.string());
+
+			step_trace::FileHeader h;
+			if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+				throw std::runtime_error("step trace file too short for its header");
+			if (std::memcmp(h.magic, step_trace::Magic, sizeof(h.magic))!=0 || h.version!=step_trace::Version || h.record_bytes!=sizeof(step_trace::Record))
+				throw std::runtime_error("not a step trace file of this version");
+
+			std::vector<step_trace::Record> records;
+			step_trace::Record r;
+			while (in.read(reinterpret_cast<char*>(&r), sizeof(r)))
+				records.push_back(r);
+			return records;
+		}
+
+
+
+		/**
+		\brief Records every step a tracker takes to a StepTraceFile.
+
+		Attach one recorder to each tracker, and use each tracker from only one thread at a time, since each recorder pushes to its own ring without locking.  Set the path before tracking it, so its records can be told apart from those of other paths in the file.
+
+		Only the steps are recorded, from the SuccessfulStep and FailedStep events, with the precision from the NewStep event which began them.  The time, stepsize, condition number estimate and Newton residual are read from the tracker, and rounded to double.
+
+		\see StepTraceFile, ReadStepTrace
+		*/
+		template<class TrackerT>
+		class StepTraceRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+		public:
+
+			explicit
+			StepTraceRecorder(std::shared_ptr<StepTraceFile> const& file) : file_(file), ring_(file->NewRing())
+			{}
+
+			/**
+			\brief Set the path the following steps belong to.
+			*/
+			void SetPath(std::uint64_t path)
+			{
+				path_ = path;
+			}
+
+			/**
+			\brief The number of this recorder's records dropped because its ring was full.
+			*/
+			unsigned long long NumDropped() const
+			{
+				return ring_.NumDropped();
+			}
+
+			virtual bool Subscribes(std::type_info const& event_type) const override
+			{
+				return event_type==typeid(NewStep<EmitterT>)
+				    || event_type==typeid(SuccessfulStep<EmitterT>)
+				    || event_type==typeid(FailedStep<EmitterT>);
+			}
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				auto const& type = typeid(e);
+
+				if (type==typeid(NewStep<EmitterT>))
+					precision_ = static_cast<const NewStep<EmitterT>&>(e).Get().CurrentPrecision();
+				else if (type==typeid(SuccessfulStep<EmitterT>))
+					Visit(static_cast<const SuccessfulStep<EmitterT>&>(e).Get());
+				else if (type==typeid(FailedStep<EmitterT>))
+					Visit(static_cast<const FailedStep<EmitterT>&>(e).Get());
+			}
+
+			/**
+			Records the step just finished.
+			*/
+			virtual void Visit(TrackerT const& t) override
+			{
+				ring_.Push(step_trace::MakeRecord(t, path_, precision_));
+			}
+
+		private:
+
+			std::shared_ptr<StepTraceFile> file_; ///< Held so the ring outlives the recorder.
+			StepTraceFile::Ring & ring_;
+			std::uint64_t path_ = 0;
+			unsigned precision_ = 0;
+		};
+
+
+
+		/**
+		\brief Records every step a tracker takes in memory, as the records of a step trace, to be fetched once tracking is done, or handed on in batches.
+
+		For callers with no use for a file, such as the python bindings, for which a call per step would cost more than the step.  The records are those of a StepTraceRecorder, and the same rules hold: one recorder per tracker, and the path set before tracking it.
+
+		\code
+		StepRecorder<AMPTracker> recorder;
+		tracker.AddObserver(&recorder);
+		recorder.SetBatchHandler([](std::vector<step_trace::Record> && batch){ ... }, 1024);
+		\endcode
+		*/
+		template<class TrackerT>
+		class StepRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+		public:
+
+			using BatchHandler = std::function<void(std::vector<step_trace::Record> &&)>;
+
+			/**
+			\brief Set the path the following steps belong to.
+			*/
+			void SetPath(std::uint64_t path)
+			{
+				path_ = path;
+			}
+
+			/**
+			\brief The records kept so far.  Empty if handing them on in batches.
+			*/
+			std::vector<step_trace::Record> const& Records() const
+			{
+				return records_;
+			}
+
+			/**
+			\brief Get the records kept so far, and start again with none.
+			*/
+			std::vector<step_trace::Record> Take()
+			{
+				std::vector<step_trace::Record> taken;
+				taken.swap(records_);
+				return taken;
+			}
+
+			/**
+			\brief Hand the records to a function in batches, rather than keeping them.  Pass an empty function to keep them again.
+
+			\param handler Called with each batch, from the thread tracking.
+			\param batch_size The records in a batch.
+			\param at_tracking_end Whether to hand on the records left at the end of each call to TrackPath, as well, so that each path's records are handed on once it is tracked.  An endgame calls TrackPath many times.
+			*/
+			void SetBatchHandler(BatchHandler handler, std::size_t batch_size, bool at_tracking_end = true)
+			{
+				Flush();
+				handler_ = handler;
+				batch_size_ = std::max<std::size_t>(batch_size, 1);
+				at_tracking_end_ = at_tracking_end;
+				if (handler_)
+					records_.reserve(batch_size_);
+			}
+
+			/**
+			\brief Hand the records kept to the batch handler now, if there is one.
+			*/
+			void Flush()
+			{
+				if (!handler_ || records_.empty())
+					return;
+				std::vector<step_trace::Record> batch;
+				batch.reserve(batch_size_);
+				batch.swap(records_);
+				handler_(std::move(batch));
+			}
+
+			virtual bool Subscribes(std::type_info const& event_type) const override
+			{
+				return event_type==typeid(NewStep<EmitterT>)
+				    || event_type==typeid(SuccessfulStep<EmitterT>)
+				    || event_type==typeid(FailedStep<EmitterT>)
+				    || event_type==typeid(TrackingEnded<EmitterT>);
+			}
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				auto const& type = typeid(e);
+
+				if (type==typeid(NewStep<EmitterT>))
+					precision_ = static_cast<const NewStep<EmitterT>&>(e).Get().CurrentPrecision();
+				else if (type==typeid(SuccessfulStep<EmitterT>))
+					Visit(static_cast<const SuccessfulStep<EmitterT>&>(e).Get());
+				else if (type==typeid(FailedStep<EmitterT>))
+					Visit(static_cast<const FailedStep<EmitterT>&>(e).Get());
+				else if (type==typeid(TrackingEnded<EmitterT>) && at_tracking_end_)
+					Flush();
+			}
+
+			/**
+			Records the step just finished.
+			*/
+			virtual void Visit(TrackerT const& t) override
+			{
+				records_.push_back(step_trace::MakeRecord(t, path_, precision_));
+				if (handler_ && records_.size() >= batch_size_)
+					Flush();
+			}
+
+		private:
+
+			std::vector<step_trace::Record> records_;
+			BatchHandler handler_;
+			std::size_t batch_size_ = 1;
+			bool at_tracking_end_ = true;
+			std::uint64_t path_ = 0;
+			unsigned precision_ = 0;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
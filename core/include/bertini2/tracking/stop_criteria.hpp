@@ -0,0 +1,133 @@
+//This file is part of Bertini 2.
+//
+//stop_criteria.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//stop_criteria.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with stop_criteria.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file stop_criteria.hpp
+
+\brief Contains SolveProgress, the running counts of a solve, and predicates for stopping a solve once it has found what is wanted, see ParallelSolver::SetStopWhen.
+*/
+
+#ifndef BERTINI_TRACKING_STOP_CRITERIA_HPP
+#define BERTINI_TRACKING_STOP_CRITERIA_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+
+#include <cstddef>
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief The running counts of the paths of a solve, as each finishes.
+		*/
+		struct SolveProgress
+		{
+			size_t num_paths = 0; ///< The paths of the solve.
+			size_t num_finished = 0; ///< The paths finished so far, including the latest.
+			size_t num_successes = 0; ///< The paths whose endgame converged, to a finite solution.
+			size_t num_infinite = 0; ///< The paths which went to infinity.
+			size_t num_failures = 0; ///< The paths which failed otherwise.
+
+			/**
+			\brief Count a finished path.
+			*/
+			void Add(SuccessCode code)
+			{
+				++num_finished;
+				if (code==SuccessCode::Success)
+					++num_successes;
+				else if (code==SuccessCode::GoingToInfinity || code==SuccessCode::SecurityMaxNormReached)
+					++num_infinite;
+				else
+					++num_failures;
+			}
+		};
+
+
+		/**
+		\brief Whether every coordinate of a point has imaginary part within a threshold.
+		*/
+		template<typename CT>
+		bool IsRealPoint(Vec<CT> const& x, double threshold = 1e-8)
+		{
+			using std::abs;
+			for (Eigen::Index ii = 0; ii < x.size(); ++ii)
+				if (abs(imag(x(ii))) > threshold)
+					return false;
+			return true;
+		}
+
+		/**
+		\brief Whether a point is real, within a threshold, with every coordinate's real part positive.
+		*/
+		template<typename CT>
+		bool IsPositivePoint(Vec<CT> const& x, double threshold = 1e-8)
+		{
+			if (!IsRealPoint(x, threshold))
+				return false;
+			for (Eigen::Index ii = 0; ii < x.size(); ++ii)
+				if (!(real(x(ii)) > 0))
+					return false;
+			return true;
+		}
+
+
+		/**
+		\brief A predicate for ParallelSolver::SetStopWhen, stopping the solve once n successful paths have solutions accepted by a function, such as IsPositivePoint.
+
+		The count starts again with the first path finished of each Solve.
+
+		\code
+		solver.SetStopWhen(StopAfter(3, [](Vec<mpfr> const& x){ return IsPositivePoint(x);}));
+		\endcode
+		*/
+		template<typename AcceptF>
+		auto StopAfter(size_t n, AcceptF accept)
+		{
+			return [n, accept, count = size_t(0)](auto const& result, SolveProgress const& progress) mutable
+				{
+					if (progress.num_finished==1)
+						count = 0;
+					if (result.success==SuccessCode::Success && accept(result.solution))
+						++count;
+					return count >= n;
+				};
+		}
+
+		/**
+		\brief A predicate for ParallelSolver::SetStopWhen, stopping the solve once n paths have finite solutions.
+		*/
+		inline auto StopAfterSolutions(size_t n)
+		{
+			return [n](auto const&, SolveProgress const& progress){ return progress.num_successes >= n;};
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,182 @@
+//This file is part of Bertini 2.
+//
+//time_breakdown.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//time_breakdown.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with time_breakdown.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file time_breakdown.hpp
+
+\brief Accumulates the time a tracker spends at each kind of work, such as evaluating the Jacobian, or factoring it.
+
+A tracker holds one of these, shared with its predictor and corrector, and off until turned on with Tracker::EnableTimeBreakdown.  When off, each timed section costs one test of a flag.
+
+\code
+tracker.EnableTimeBreakdown(true);
+tracker.TrackPath(result, t_start, t_end, start_point);
+std::cout << tracker.GetTimeBreakdown();
+\endcode
+*/
+
+#ifndef BERTINI_TRACKING_TIME_BREAKDOWN_HPP
+#define BERTINI_TRACKING_TIME_BREAKDOWN_HPP
+
+#include "bertini2/trace_zones.hpp"
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief The kinds of work a tracker's time is broken down into.
+		*/
+		enum class TimedWork
+		{
+			FunctionEvaluation, ///< Evaluating the system alone, as in a chord Newton step.
+			JacobianEvaluation, ///< Evaluating the Jacobian, with the functions or the time derivative where evaluated together with it.
+			LinearAlgebra, ///< Factoring the Jacobian, and solving with the factorization.
+			AMPCriteria, ///< Checking the criteria of adaptive precision.
+			PrecisionChange, ///< Changing precision, including refining the point at the new precision.
+			ObserverNotification ///< Making events and passing them to observers.
+		};
+
+
+		/**
+		\brief Cumulative wall time at each kind of tracking work.
+
+		The kinds can nest: a precision change includes the evaluations and linear algebra of the refinement it does, and the observers notified of it.  The other kinds do not overlap each other.
+		*/
+		class TimeBreakdown
+		{
+		public:
+
+			static constexpr unsigned NumKinds = 6;
+
+			/**
+			\brief Times a section of code, from construction to destruction, adding it to a breakdown.  Does nothing if the breakdown is null or not enabled.
+
+			With trace zones compiled in, also a zone named for the kind of work, whether or not the breakdown is enabled; see trace_zones.hpp.
+			*/
+			class Scope
+			{
+			public:
+				Scope(TimeBreakdown * breakdown, TimedWork kind) : breakdown_(breakdown && breakdown->Enabled() ? breakdown : nullptr), kind_(kind)
+			#ifdef BERTINI_TRACE_ZONES
+					, zone_(TraceSite(kind))
+			#endif
+				{
+					if (breakdown_)
+						start_ = std::chrono::steady_clock::now();
+				}
+
+				~Scope()
+				{
+					if (breakdown_)
+						breakdown_->Add(kind_, std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+				}
+
+				Scope(Scope const&) = delete;
+				Scope& operator=(Scope const&) = delete;
+
+			private:
+				TimeBreakdown * breakdown_;
+				TimedWork kind_;
+				std::chrono::steady_clock::time_point start_;
+			#ifdef BERTINI_TRACE_ZONES
+				trace::Zone zone_;
+			#endif
+			};
+
+
+			bool Enabled() const
+			{
+				return enabled_;
+			}
+
+			/**
+			\brief Turn timing on or off.  The accumulated times are kept either way.
+			*/
+			void Enable(bool enabled)
+			{
+				enabled_ = enabled;
+			}
+
+			/**
+			\brief The seconds spent at a kind of work since construction or the last Reset.
+			*/
+			double Seconds(TimedWork kind) const
+			{
+				return seconds_[static_cast<unsigned>(kind)];
+			}
+
+			void Add(TimedWork kind, double seconds)
+			{
+				seconds_[static_cast<unsigned>(kind)] += seconds;
+			}
+
+			void Reset()
+			{
+				seconds_.fill(0);
+			}
+
+		#ifdef BERTINI_TRACE_ZONES
+			/**
+			\brief The trace zone of a kind of work, with a short name, such as LU.
+			*/
+			static trace::Site const& TraceSite(TimedWork kind)
+			{
+				static const trace::Site sites[NumKinds] = {
+					trace::Site("Eval", __func__, __FILE__, __LINE__),
+					trace::Site("Jacobian", __func__, __FILE__, __LINE__),
+					trace::Site("LU", __func__, __FILE__, __LINE__),
+					trace::Site("AMPCriteria", __func__, __FILE__, __LINE__),
+					trace::Site("ChangePrecision", __func__, __FILE__, __LINE__),
+					trace::Site("NotifyObservers", __func__, __FILE__, __LINE__)};
+				return sites[static_cast<unsigned>(kind)];
+			}
+		#endif
+
+			static char const* Name(TimedWork kind)
+			{
+				static char const* names[NumKinds] = {"function evaluation", "jacobian evaluation", "linear algebra", "amp criteria", "precision change", "observer notification"};
+				return names[static_cast<unsigned>(kind)];
+			}
+
+			friend std::ostream& operator<<(std::ostream & out, TimeBreakdown const& t)
+			{
+				for (unsigned ii = 0; ii < NumKinds; ++ii)
+					out << std::left << std::setw(24) << Name(static_cast<TimedWork>(ii)) << std::right << t.seconds_[ii] << " s\n";
+				return out;
+			}
+
+		private:
+			bool enabled_ = false;
+			std::array<double, NumKinds> seconds_{};
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -35,14 +35,18 @@
 #include "bertini2/eigen_extensions.hpp"
 
 #include "bertini2/system.hpp"
+#include "bertini2/detail/ring_buffer.hpp"
+
+#include <boost/serialization/version.hpp>
 
 namespace bertini
 {
 	namespace tracking{
 
 		// aliases for the types used to contain space and time samples, and random vectors for the endgames.
-		template<typename T> using SampCont = std::deque<Vec<T> >;
-		template<typename T> using TimeCont = std::deque<T>;
+		// ring buffers, so that dropping the oldest sample and pushing a new one reuses its storage.
+		template<typename T> using SampCont = detail::RingBuffer<Vec<T> >;
+		template<typename T> using TimeCont = detail::RingBuffer<T>;
 		
 		
 		enum class PrecisionType
@@ -145,12 +149,15 @@ namespace bertini
 
 		class AMPPowerSeriesEndgame;
 		class AMPCauchyEndgame;
+
+		template<typename Tracker>
+		class HybridEndgame;
 		}
 
 		/**
 		\brief Facilitates lookup of required endgame type based on tracker type
 		
-		Your current choices are PSEG or Cauchy.
+		Your current choices are PSEG, Cauchy, or Hybrid, which starts with the power series endgame and switches to Cauchy on paths with high cycle number.
 	
 		To get the Power Series Endgame for Adaptive Precision Tracker, use the following example code:
 		\code
@@ -168,6 +175,7 @@ namespace bertini
 		{
 			using PSEG = endgame::FixedPrecPowerSeriesEndgame<DoublePrecisionTracker>;
 			using Cauchy = endgame::FixedPrecCauchyEndgame<DoublePrecisionTracker>;
+			using Hybrid = endgame::HybridEndgame<DoublePrecisionTracker>;
 		};
 
 		template<>
@@ -175,6 +183,7 @@ namespace bertini
 		{
 			using PSEG = endgame::FixedPrecPowerSeriesEndgame<MultiplePrecisionTracker>;
 			using Cauchy = endgame::FixedPrecCauchyEndgame<MultiplePrecisionTracker>;
+			using Hybrid = endgame::HybridEndgame<MultiplePrecisionTracker>;
 		};
 
 		template<class D>
@@ -182,6 +191,7 @@ namespace bertini
 		{
 			using PSEG = typename EndgameSelector<D>::PSEG;
 			using Cauchy = typename EndgameSelector<D>::Cauchy;
+			using Hybrid = typename EndgameSelector<D>::Hybrid;
 		};
 
 		template<>
@@ -189,6 +199,7 @@ namespace bertini
 		{
 			using PSEG = endgame::AMPPowerSeriesEndgame;
 			using Cauchy = endgame::AMPCauchyEndgame;
+			using Hybrid = endgame::HybridEndgame<AMPTracker>;
 		};
 
 
@@ -233,7 +244,8 @@ namespace bertini
 				RKF45,
 				RKCashKarp45,
 				RKDormandPrince56,
-				RKVerner67
+				RKVerner67,
+				Pade ///< The [2/1] Pade approximant of the path from its Taylor coefficients, stepping no further than a fraction of its estimate of the distance to the nearest singularity.
 			};
 
 			
@@ -253,6 +265,138 @@ namespace bertini
 			};
 
 
+			/**
+			\brief How a solver checks for paths which jumped onto or crossed another, and retracks them.
+
+			Two paths at one point at the endgame boundary, where the homotopy is nonsingular, have crossed, and two paths ending at one nonsingular point at t=0 mean one jumped onto the other.  Both paths of such a pair are tracked again, with a tighter tracking tolerance, \e i.e. newton_before_endgame, and a smaller max step size, leaving the other paths alone.
+			*/
+			template<typename T>
+			struct PathCrossing
+			{
+				unsigned max_num_retracks = 2; ///< The most times a path is tracked again.  0 turns off the check.
+				T boundary_tolerance = T(1)/T(100000); ///< The distance under which two points at the endgame boundary are one.
+				T endpoint_tolerance = T(1)/T(10000000000); ///< The distance under which two endpoints at t=0 are one.
+				T retrack_tolerance_factor = T(1)/T(10); ///< The factor by which each retrack multiplies the tracking tolerance.
+				T retrack_step_size_factor = T(1)/T(2); ///< The factor by which each retrack multiplies the max step size.
+			};
+
+
+			/**
+			\brief One rung of the ladder of settings with which a parallel solve tracks a failed path again.
+
+			Each rung changes the settings the trackers were set up with, not those of the rung before, so list the rungs from mildest to most drastic.
+			*/
+			template<typename T>
+			struct Retry
+			{
+				T tracking_tolerance_factor = T(1)/T(10); ///< Multiplies the tracking tolerance.
+				T max_step_size_factor = T(1)/T(2); ///< Multiplies the max step size, which also bounds the initial step size.
+				unsigned max_num_steps_factor = 2; ///< Multiplies the most steps the tracker may take.
+				bool change_predictor = false; ///< Whether to use predictor instead of the tracker's own.
+				Predictor predictor = Predictor::RK4;
+				unsigned maximum_precision = 0; ///< For adaptive precision, the most precision paths may reach, if more than the trackers were set up with.
+				bool new_gamma = false; ///< For a solver of a StraightLineHomotopy, track with a new random gamma.  The path then ends at some solution, but not necessarily the one it would have reached, so its endpoint may duplicate another's.
+			};
+
+
+			/**
+			\brief Which cpus the threads of a parallel solve are pinned to.
+			*/
+			enum class ThreadPinning
+			{
+				None, ///< Leave the threads to the operating system.
+				Compact, ///< Fill the cpus of one NUMA node before starting on the next.  Best when the threads fit in a node.
+				Spread ///< Take the cpus of each NUMA node in turn, using the memory bandwidth of every node.
+			};
+
+			/**
+			\brief Where the threads of a parallel solve run, and where their memory is.
+
+			On machines of more than one socket, a thread working on memory of another socket's node is slowed by every cache miss.  With the threads pinned, each thread's copy of the homotopy, its tracker, and its endgame are made by a thread on its own cpu, and Linux puts memory on the node of the thread which first touches it.
+			*/
+			struct ThreadPlacement
+			{
+				ThreadPinning pinning = ThreadPinning::None;
+				bool local_allocation = true; ///< With pinning, make each thread's objects on its own cpu, so they are in the memory of its node.
+				bool local_stealing = true; ///< With pinning, an idle thread steals work from the threads of its own node before others.
+			};
+
+
+			/**
+			\brief Which of the steps of a path a PathRecorder keeps.
+			*/
+			enum class PathDecimation
+			{
+				None, ///< Every successful step.
+				EveryKth, ///< Every every_kth-th successful step of each call to TrackPath, and its first and last.
+				Curvature ///< The steps at which the path turns by more than turning_angle, or at which the precision changes, and the first and last of each call to TrackPath.
+			};
+
+			/**
+			\brief How a PathRecorder thins the points of paths, and how much memory it keeps them in.
+			*/
+			struct PathRecording
+			{
+				std::size_t memory_budget = std::size_t(64) << 20; ///< The bytes of points to keep in memory.  When exceeded, the points are written to the recorder's PathTraceFile if it has one, and otherwise every other point is dropped and the decimation made twice as coarse.
+				bool multiple_precision = false; ///< Keep each point at the precision it was tracked at, as well as rounded to double.
+				PathDecimation decimation = PathDecimation::Curvature;
+				unsigned every_kth = 10; ///< With EveryKth, the steps between those kept.
+				double turning_angle = 0.05; ///< With Curvature, the angle in radians between successive secants of the path, over which the point between them is kept.
+			};
+
+
+			/**
+			\brief Which of the signals of a path going singular handed it off to its endgame.
+			*/
+			enum class HandoffSignal
+			{
+				None, ///< None was seen.
+				ConditionGrowth, ///< The condition number of the Jacobian grew by condition_growth.
+				StepsizeCollapse, ///< The stepsize fell to stepsize_collapse of what it was.
+				PrecisionIncrease ///< The precision was raised precision_increases times.
+			};
+
+			/**
+			\brief Where each path of a parallel solve stops tracking and starts its endgame.
+
+			By default, every path hands off at the endgame boundary.  An endgame started too early spends its samples on paths with nonsingular endpoints, which the tracker would finish in a few steps, and one started too late leaves the tracker to raise its precision and shrink its steps to reach a singular endpoint.  Automatically, each path is tracked on past the boundary, toward 0, until the steps show it going singular, and its endgame starts there.  A path which shows no sign reaches 0, and is refined there by Newton's method without an endgame.  The signals are measured from the boundary, so set the boundary earlier than for a fixed handoff, for instance to 0.5.
+			*/
+			struct EndgameHandoff
+			{
+				bool automatic = false; ///< Choose the handoff of each path.  Otherwise every path hands off at the endgame boundary.
+				double condition_growth = 1e3; ///< Hand off once the estimate of the condition number of the Jacobian is this many times its estimate at the boundary.
+				double stepsize_collapse = 0.05; ///< Hand off once the stepsize is this fraction of the stepsize at the boundary.
+				unsigned precision_increases = 1; ///< Hand off once the precision has been raised this many times past the boundary.  0 for never.
+				double refinement_tolerance = 1e-11; ///< The tolerance of the Newton refinement at 0 of a path which reached it without an endgame.
+				unsigned max_refinement_iterations = 10;
+			};
+
+
+			/**
+			\brief How a monodromy solve builds its graph of parameter points, and when it stops.
+
+			The graph starts with num_parameter_points points, every two joined by an edge each way, and the solutions known at any point are tracked along every edge out of it until no edge gives a new one.  If the target number of solutions has not been found by then, a point is added to the graph, and this repeats, until max_num_stale_points points have been added in a row without finding a new solution at the base point.
+			*/
+			template<typename T>
+			struct Monodromy
+			{
+				unsigned num_parameter_points = 3; ///< The number of points of the first graph, including the base point.
+				size_t target_num_solutions = 0; ///< The number of solutions at generic parameters, at which the solve stops, if known.  0 if not.
+				unsigned max_num_stale_points = 2; ///< The number of points added in a row without a new solution at the base point, after which the solve stops.
+				T same_point_tolerance = T(1)/T(100000000); ///< The distance, relative to the larger norm, under which two solutions at one point are one.
+			};
+
+
+			/**
+			\brief How the trackers choose the stepsize after a successful step.
+			*/
+			enum class StepSizeController
+			{
+				Factors, ///< Multiply by step_size_success_factor after consecutive_successful_steps_before_stepsize_increase successful steps in a row.
+				PI ///< Scale after every successful step, by a proportional-integral controller on the error of the prediction.  \see PIStepSizeFactor
+			};
+
+
 			template<typename T>
 			struct Stepping
 			{
@@ -269,6 +413,28 @@ namespace bertini
 				unsigned max_num_steps = 1e5;
 
 				unsigned frequency_of_CN_estimation = 1;
+
+				StepSizeController step_size_controller = StepSizeController::Factors; ///< How to grow or shrink the stepsize after a successful step.  The factors above still bound the change with StepSizeController::PI, and a failed step still shrinks it by the fail factor.
+				T step_size_controller_safety = T(9)/T(10); ///< With StepSizeController::PI, the factor by which the controller's proposal is scaled down, to keep steps from failing.
+
+				bool estimate_initial_step_size = false; ///< When the stepsize is reinitialized at the start of a path, estimate it from the conditioning and curvature of the path there, rather than starting from initial_step_size.  Costs two Jacobians per path.
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & initial_step_size;
+					ar & max_step_size;
+					ar & min_step_size;
+					ar & step_size_success_factor;
+					ar & step_size_fail_factor;
+					ar & consecutive_successful_steps_before_stepsize_increase;
+					ar & min_num_steps;
+					ar & max_num_steps;
+					ar & frequency_of_CN_estimation;
+					ar & step_size_controller;
+					ar & step_size_controller_safety;
+					ar & estimate_initial_step_size;
+				}
 			};
 
 
@@ -277,6 +443,56 @@ namespace bertini
 			{
 				unsigned max_num_newton_iterations = 2;
 				unsigned min_num_newton_iterations = 1;
+
+				bool use_chord = false; ///< Reuse the Jacobian and its LU factorization across the iterations of one correction, refactoring only when convergence slows.
+				double chord_max_contraction = 0.5; ///< With use_chord, refactor when a Newton step is longer than this fraction of the one before it.
+
+				bool contraction_control = false; ///< Estimate the contraction of each correction from the lengths of its successive steps, accepting it as soon as the next step is predicted to be shorter than the tracking tolerance, and giving it up as soon as it cannot converge in max_num_newton_iterations.  In adaptive precision, an iterate is accepted early only if it meets AMP criteria B and C.
+
+				bool mixed_precision_solve = false; ///< In multiple precision, factor the Jacobian in double precision, and refine the solution of each Newton step with residuals in the current precision.  Falls back to factoring in the current precision if refinement stalls.
+				unsigned max_num_refinement_iterations = 5; ///< With mixed_precision_solve, the most refinement iterations for one solve before falling back.
+
+				double sparse_density_threshold = 0; ///< Evaluate the Jacobian as a sparse matrix and factor it with a sparse LU when the system's System::JacobianDensity() is below this.  0 never does.
+
+				bool fixed_size_solve = true; ///< In double precision, factor Jacobians of at most SmallLU::MaxDimension variables with Eigen's kernels for their size fixed at compile time, which are unrolled and do not allocate.
+
+				bool multiprecision_lu = true; ///< In multiple precision, factor Jacobians in the current precision with MultiprecisionLU, which keeps the factors contiguous at one precision and updates them in place, rather than with Eigen::PartialPivLU.
+
+				unsigned lapack_threshold = 50; ///< When configured --with-lapack, factor double precision Jacobians of at least this many variables with LapackLU, rather than Eigen.
+
+				bool use_krylov = false; ///< In multiple precision, solve for each Newton step of a square system by GMRES, with products of the Jacobian and vectors from System::JacobianTimesVector, preconditioned by the LU factorization of the Jacobian evaluated in double precision.  The Jacobian is then never formed or factored in the current precision, unless GMRES fails to converge, in which case it is, for that step.
+				unsigned max_num_krylov_iterations = 20; ///< With use_krylov, the most GMRES iterations for one step.  Preconditioned in double precision, each gains roughly the digits of double precision less those of the condition number of the Jacobian.
+				double krylov_relative_tolerance = 0; ///< With use_krylov, GMRES stops when the residual is this fraction of the right hand side.  0 is ten units of roundoff in the current precision.
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & max_num_newton_iterations;
+					ar & min_num_newton_iterations;
+					ar & use_chord;
+					ar & chord_max_contraction;
+					ar & contraction_control;
+					ar & mixed_precision_solve;
+					ar & max_num_refinement_iterations;
+					ar & sparse_density_threshold;
+					ar & fixed_size_solve;
+					ar & multiprecision_lu;
+					ar & lapack_threshold;
+					ar & use_krylov;
+					ar & max_num_krylov_iterations;
+					ar & krylov_relative_tolerance;
+				}
+			};
+
+
+			/**
+			\brief When a tracker switches the patch of a homogenized system, to keep the coordinates of its point bounded.  See Tracker::SetPatchSwitching.
+			*/
+			template<typename T>
+			struct PatchSwitching
+			{
+				T max_norm = T(0); ///< The norm of the point on the current patch past which the patch is switched, after a successful step.  0 never switches.
+				bool coordinate_patches = true; ///< Switch to the patch on which the largest coordinate of each variable group is 1, so that the others are at most 1, rather than to a new random patch.
 			};
 
 
@@ -295,6 +511,8 @@ namespace bertini
 			{
 				int level = 0;
 				T max_norm = T(100000);
+				unsigned early_abort_window = 3; //the number of consecutive endgame iterations a trend in the approximations must hold for, before predicting failure from it and stopping.  0 never stops early.
+				T divergence_rate = T(1)/T(2); //approximations whose norm grows at least as fast as |t|^(-divergence_rate), while their differences grow too, are judged going to infinity.
 			};
 
 			template<typename T>
@@ -304,6 +522,10 @@ namespace bertini
 				T min_track_time = T(1e-100); //nbrh radius in Bertini book.
 				T sample_factor = T(1)/T(2);
 				unsigned max_num_newton_iterations = 15; // the maximum number allowable iterations during endgames, for points used to approximate the final solution.
+				bool certify_approximations = false; // whether to stop once an approximation at the origin is certified, by the Krawczyk test, to be within the final tolerance of a root of the target system, before consecutive approximations agree to it.  Applies to nonsingular endpoints only.
+				bool deflate_endpoints = false; // whether to refine an approximation at the origin by Newton's method on a deflated system, see tracking::Deflate, once consecutive approximations agree to deflation_tolerance, and stop if it converges to the final tolerance.  For singular endpoints, which the endgame would otherwise approach at high precision.
+				T deflation_tolerance = T(1)/T(1000000); // how closely consecutive approximations must agree before deflating.
+				bool dense_initial_samples = false; // whether to track once to the last of the initial samples, keeping the steps, and make the ones between by refining interpolants of the steps, see StepHistory, rather than by tracking to each.
 			};
 
 
@@ -311,6 +533,9 @@ namespace bertini
 			{
 				unsigned max_cycle_number = 6;
 				unsigned cycle_number_amplification = 5;
+				unsigned cycle_number_seed_margin = 10; //the previous cycle number is kept without trying the others if it predicts the newest sample this many times better than its neighbors.  0 always tries every candidate.
+				unsigned cycle_number_bound_for_handoff = 0; //stop with CycleNumTooHigh once the upper bound on the cycle number exceeds this, so that a more robust endgame can take over the samples.  0 never stops.
+				unsigned stalled_approximations_for_handoff = 0; //likewise, once this many successive approximations fail to get closer together.  0 never stops.
 			};
 
 			template<typename T>
@@ -322,15 +547,37 @@ namespace bertini
 				unsigned int num_needed_for_stabilization = 3;
 				T maximum_cauchy_ratio = T(1)/T(2);
 				unsigned int fail_safe_maximum_cycle_number = 250; //max number of loops before giving up. 
+				unsigned int num_circle_threads = 1; //threads for tracking the arcs of a loop around the origin concurrently, from starts predicted by the previous loop.  1 tracks them in sequence.
+				bool hermite_quadrature = false; //whether the mean of the samples around the origin is corrected by the mean of their derivatives, which doubles the order of the quadrature for the cost of one linear solve per sample, and the number of sample points per loop is adapted from the size of the correction.
+				unsigned int min_num_circle_points = 3; //with hermite_quadrature, the fewest sample points per loop the number adapts down to, from num_sample_points.  At least 3.
 
 			};
 
 
+			/**
+			\brief How the witness supersets of a numerical irreducible decomposition are rid of junk, the points on components of higher dimension.  See NumericalIrreducibleDecomposition.
+			*/
 			struct TrackBack
 			{
-				unsigned minimum_cycle;
-				bool junk_removal_test;
-				unsigned max_depth_LDT;
+				unsigned minimum_cycle = 4; ///< The least cycle number of an endpoint for which the trackback of the endgame is worth doing.  Not used yet.
+				bool junk_removal_test = true; ///< Whether junk is found by the local dimension test, which needs no tracking.  Otherwise by membership tests in the witness sets of the higher dimensions, each tracking their points.
+				unsigned max_depth_LDT = 3; ///< The most deflations of the local dimension test, after which a point still singular is taken to be on a component of higher dimension.  An isolated point of multiplicity m needs fewer than m.
+			};
+
+
+			/**
+			\brief How a numerical irreducible decomposition finds its witness supersets, and breaks the pure witness sets into components.  See NumericalIrreducibleDecomposition.
+
+			The points of each pure witness set are moved around monodromy loops, each to a random slice and back, joining the points each is permuted with, until every group of joined points passes the linear trace test, or max_num_stale_loops loops in a row join none.  Groups left failing are then combined, fewest first, until the combinations pass.
+			*/
+			template<typename T>
+			struct Decomposition
+			{
+				T residual_tolerance = T(1)/T(100000000); ///< The largest norm of the functions at a point of a witness superset, relative to the larger of 1 and the norm of the point to the highest degree.  Endpoints with more solve only the randomized system.
+				T same_point_tolerance = T(1)/T(1000000); ///< The distance, relative to the larger norm, within which a point moved around a loop is a point of the witness set.
+				T trace_tolerance = T(1)/T(1000000); ///< The largest second difference of the trace of a group, relative to the larger of 1 and the sum of the norms of its points, for the trace to be linear.
+				unsigned max_num_stale_loops = 5; ///< The number of monodromy loops in a row joining no groups, after which the loops stop.
+				unsigned max_num_combined_groups = 12; ///< The most groups failing the trace test which are combined after the loops, every combination being tried.  Beyond that, the groups left are one component, not verified.
 			};
 
 
@@ -339,31 +586,73 @@ namespace bertini
 
 
 
+			/**
+			\brief How endpoints are clustered and classified, by ClusterSolutions.
+			*/
 			template<typename T>
 			struct PostProcessing{
-				T real_threshold;
-				T endpoint_finite_threshold;
-				T final_tol_multiplier;
-				T final_tol_times_mult;
+				T real_threshold = T(1)/T(100000000); ///< The largest imaginary part of a coordinate of a real solution.
+				T endpoint_finite_threshold = T(100000); ///< The largest norm of a finite solution.
+				T final_tol_multiplier = T(10); ///< The factor of the final tolerance within which endpoints are one solution.
+				T final_tol_times_mult = T(1)/T(10000000000); ///< The distance within which endpoints are one solution, the final tolerance times final_tol_multiplier.
 			};
 
 
 
+			/**
+			\brief How approximations of singular roots are refined, by tracking::Deflate.
+			*/
+			struct Deflation
+			{
+				double rank_tolerance = 1e-4; ///< The singular values of a Jacobian taken to be zero, relative to the larger of the largest and 1, in finding its rank.
+				unsigned max_deflations = 3; ///< The most times a system is deflated, each adding variables and equations, before giving up on making it regular.  An isolated root of multiplicity m needs fewer than m.
+				unsigned max_newton_iterations = 8; ///< The most Newton iterations on the deflated system.
+				double contour_radius = 1e-3; ///< The radius of the circle on which second derivatives are taken, relative to the larger of the norm of the point and 1.
+			};
+
+
+
+			/**
+			\brief How nonsingular endpoints are sharpened to many digits, by tracking::Sharpen.
+			*/
+			struct Sharpening
+			{
+				unsigned digits = 0; ///< The correct digits to sharpen endpoints to.  0 does not sharpen.
+				unsigned guard_digits = 8; ///< The digits of precision kept beyond those wanted of each iterate, and beyond those of the iterate in the Jacobian, for rounding and the condition number of the Jacobian.
+				unsigned max_iterations = 12; ///< The most Newton iterations.
+			};
+
+
+
+			/**
+			\brief How points are certified to be near roots, by tracking::Krawczyk.
+			*/
+			struct Certification
+			{
+				double inflation = 2; ///< The radius of each box tried, as a multiple of the least radius the last box suggested, the first suggesting the length of the Newton step.
+				unsigned max_attempts = 3; ///< The most boxes tried for one point.
+			};
+
 
 
 
 
 
 
+
+
+			/**
+			\brief How regeneration treats the endpoints of its stages, and the tolerances of the paths moving its linear slices.  See RegenerationSolver.
+			*/
 			template<typename T>
 			struct Regeneration
 			{
-				bool remove_infinite_endpoints;
-				bool higher_dimension_check;
+				bool remove_infinite_endpoints = true; ///< Whether endpoints of each stage beyond the finite threshold are dropped, rather than tracked on.
+				bool higher_dimension_check = true; ///< Whether singular endpoints of each stage but the last, which are multiple or on positive-dimensional components, are dropped, rather than tracked on.
 
-				T newton_before_endgame;
-				T newton_during_endgame;
-				T final_tolerance;
+				T newton_before_endgame = T(1)/T(10000000); ///< The tolerance before the endgame, of the paths moving the linear slices.
+				T newton_during_endgame = T(1)/T(100000000); ///< The tolerance during the endgame, of the paths moving the linear slices.
+				T final_tolerance = T(1)/T(100000000000); ///< The final tolerance of the endgame, of the paths moving the linear slices.
 			};
 
 			
@@ -389,6 +678,16 @@ namespace bertini
 			}
 
 
+			/**
+			\brief The ways of estimating the norm of the inverse of the Jacobian, used in the AMP criteria.
+			*/
+			enum class NormJInverseEstimator
+			{
+				RandomSolve, ///< The norm of \f$J^{-1} r\f$ for a random vector of units \f$r\f$.  One solve, but noisy from step to step.
+				OneNorm ///< Hager and Higham's estimate of \f$\|J^{-1}\|_1\f$.  A few solves, but deterministic and usually sharp, so fewer spurious precision increases.
+			};
+
+
 			/**
 			Holds the program parameters with respect to Adaptive Multiple Precision.
 			
@@ -434,6 +733,12 @@ namespace bertini
 				unsigned consecutive_successful_steps_before_precision_decrease = 10;
 
 				unsigned max_num_precision_decreases = 10; ///< The maximum number of times precision can be lowered during tracking of a segment of path.
+
+				NormJInverseEstimator norm_J_inverse_estimator = NormJInverseEstimator::RandomSolve; ///< How the norm of the inverse of the Jacobian is estimated for the criteria.
+
+				bool adaptive_predictor = false; ///< Switch among the predictors with error estimates while tracking, to the one of least estimated cost per unit of time.  Each path starts with the predictor set on the tracker.
+
+				double precision_change_cost = 0; ///< The cost of changing precision, converting the system and point, in steps at the higher precision.  A decrease is taken only if it saves more than this over consecutive_successful_steps_before_precision_decrease steps, so that precision does not go back and forth between adjacent levels.  0 decreases whenever the lower precision is cheaper.
 				
 
 				/**
@@ -476,6 +781,25 @@ namespace bertini
 				{
 					SetAMPConfigFrom(sys);
 				}
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & coefficient_bound;
+					ar & degree_bound;
+					ar & epsilon;
+					ar & Phi;
+					ar & Psi;
+					ar & safety_digits_1;
+					ar & safety_digits_2;
+					ar & maximum_precision;
+					ar & consecutive_successful_steps_before_precision_decrease;
+					ar & max_num_precision_decreases;
+					ar & norm_J_inverse_estimator;
+					ar & adaptive_predictor;
+					if (version >= 1)
+						ar & precision_change_cost;
+				}
 			}; // re: AdaptiveMultiplePrecisionConfig
 
 			inline
@@ -489,6 +813,8 @@ namespace bertini
 				out << "safety_digits_1: " << AMP.safety_digits_1 << "\n";
 				out << "safety_digits_2: " << AMP.safety_digits_2 << "\n";
 				out << "consecutive_successful_steps_before_precision_decrease" << AMP.consecutive_successful_steps_before_precision_decrease << "\n";
+				out << "adaptive_predictor: " << AMP.adaptive_predictor << "\n";
+				out << "precision_change_cost: " << AMP.precision_change_cost << "\n";
 				return out;
 			}
 
@@ -515,5 +841,8 @@ namespace bertini
 	} // re: namespace tracking 
 } // re: namespace bertini
 
+// version 1 added precision_change_cost
+BOOST_CLASS_VERSION(bertini::tracking::config::AdaptiveMultiplePrecisionConfig, 1)
+
 
 #endif
@@ -0,0 +1,205 @@
+//This file is part of Bertini 2.
+//
+//witness_sampler.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//witness_sampler.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with witness_sampler.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file witness_sampler.hpp
+
+\brief Contains the WitnessSampler type, for moving the slice of a witness set, to sample its component and test membership in it.
+*/
+
+#ifndef BERTINI_TRACKING_WITNESS_SAMPLER_HPP
+#define BERTINI_TRACKING_WITNESS_SAMPLER_HPP
+
+#include "bertini2/witness_set.hpp"
+#include "bertini2/tracking/parallel_solver.hpp"
+
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\brief Moves the points of a witness set to other slices, over several threads.
+
+		The homotopy is the witness set's SliceMovingHomotopy, made once, and tracked by a ParallelSolver kept for the life of the sampler, so each thread's copy of the homotopy, its compiled form, and its tracker are made once for all the slices moved to.  Each move tracks every point of the witness set, in parallel.
+
+		\code
+		WitnessSampler<AMPTracker> sampler(witness_set, setup);
+		for (auto const& w : sampler.Sample(10))
+			for (auto const& x : w.Points())
+				std::cout << x << std::endl;
+
+		bool on_component = sampler.Contains(x, mpfr_float("1e-8"));
+		\endcode
+
+		\tparam TrackerType The type of tracker to use, such as AMPTracker.
+		\tparam EndgameType The type of endgame to use.  Defaults to the power series endgame for the tracker type.
+		*/
+		template<class TrackerType, class EndgameType = typename EndgameSelector<TrackerType>::PSEG>
+		class WitnessSampler
+		{
+		public:
+
+			using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			using Solver = ParallelSolver<TrackerType, EndgameType>;
+			using TrackerSetup = typename Solver::TrackerSetup;
+
+			/**
+			\param witness_set The witness set whose points are moved.  It is copied.
+			\param tracker_setup Called once on each thread's tracker, to set its predictor, tolerances, and precision settings.
+			\param num_threads The number of threads to use, including the calling thread.  Defaults to the number of hardware threads.
+			*/
+			WitnessSampler(WitnessSet const& witness_set, TrackerSetup tracker_setup, unsigned num_threads = std::thread::hardware_concurrency()) :
+				witness_set_(witness_set),
+				solver_(witness_set.SliceMovingHomotopy(), StartPoints(witness_set), tracker_setup, num_threads)
+			{}
+
+
+			/**
+			\brief Move the points to another slice.
+
+			\param slice The target slice.  Must be on the same variables as the slice of the witness set, and slice as many dimensions.
+			\return The witness set for the target slice, with the endpoints of the paths which succeeded.
+			*/
+			WitnessSet MoveTo(LinearSlice const& slice)
+			{
+				WitnessSet moved(witness_set_.GetSystem(), slice);
+				for (auto const& x : Move(WitnessSet::SliceParameters(slice)))
+					moved.AddPoint(x);
+				return moved;
+			}
+
+			/**
+			\brief Move the points to each of a number of random complex slices, for points spread over the component.
+			*/
+			std::vector<WitnessSet> Sample(unsigned num_slices)
+			{
+				auto const& slice = witness_set_.Slice();
+
+				std::vector<WitnessSet> samples;
+				for (unsigned ii = 0; ii < num_slices; ++ii)
+					samples.push_back(MoveTo(LinearSlice::RandomComplex(slice.Variables(), slice.Dimension(), slice.IsHomogeneous())));
+				return samples;
+			}
+
+			/**
+			\brief Test whether a point is on the component, by moving the points to a random slice through it, and looking for it among the endpoints.
+
+			\throws std::runtime_error, if the slice of the witness set is homogeneous, so cannot be moved through a given point.
+
+			\param x The point, in the order of the variables of the slice.
+			\param tolerance The distance, relative to the larger norm, within which an endpoint is the point.
+			*/
+			bool Contains(Vec<BaseComplexType> const& x, BaseRealType const& tolerance)
+			{
+				using std::max;
+
+				auto const& slice = witness_set_.Slice();
+				if (slice.IsHomogeneous())
+					throw std::runtime_error("membership testing moves the slice through the point, so needs a slice with constants");
+
+				// random coefficients, and the constants putting the point on the slice
+				auto through = LinearSlice::RandomComplex(slice.Variables(), slice.Dimension());
+				auto parameters = WitnessSet::SliceParameters(through);
+				auto const& c = through.Coefficients();
+				auto num_coefficients = c.rows()*c.cols();
+				for (int ii = 0; ii < c.rows(); ++ii)
+				{
+					mpfr constant(0);
+					for (int jj = 0; jj < c.cols(); ++jj)
+						constant -= c(ii,jj)*ToMultiple(x(jj));
+					parameters(num_coefficients + ii) = constant;
+				}
+
+				BaseRealType x_norm = x.norm();
+				for (auto const& y : Move(parameters))
+				{
+					BaseRealType scale = max(BaseRealType(1), max(x_norm, BaseRealType(y.norm())));
+					if ((y-x).norm() <= tolerance * scale)
+						return true;
+				}
+				return false;
+			}
+
+			/**
+			\brief The solver moving the slices, for its results and settings.
+			*/
+			Solver & GetSolver()
+			{
+				return solver_;
+			}
+
+		private:
+
+			std::vector<Vec<BaseComplexType>> Move(Vec<mpfr> const& parameters)
+			{
+				Vec<BaseComplexType> target(parameters.size());
+				for (int ii = 0; ii < parameters.size(); ++ii)
+					target(ii) = static_cast<BaseComplexType>(parameters(ii));
+
+				solver_.SetImplicitParameters(target);
+				solver_.Solve();
+
+				std::vector<Vec<BaseComplexType>> endpoints;
+				for (auto const& r : solver_.Results())
+					if (r.success==SuccessCode::Success)
+						endpoints.push_back(r.solution);
+				return endpoints;
+			}
+
+			static std::vector<Vec<BaseComplexType>> StartPoints(WitnessSet const& witness_set)
+			{
+				std::vector<Vec<BaseComplexType>> points;
+				for (auto const& x : witness_set.Points())
+				{
+					Vec<BaseComplexType> y(x.size());
+					for (int ii = 0; ii < x.size(); ++ii)
+						y(ii) = static_cast<BaseComplexType>(x(ii));
+					points.push_back(y);
+				}
+				return points;
+			}
+
+			static mpfr ToMultiple(mpfr const& z)
+			{
+				return z;
+			}
+
+			static mpfr ToMultiple(dbl const& z)
+			{
+				return mpfr(z.real(), z.imag());
+			}
+
+
+			WitnessSet witness_set_;
+			Solver solver_;
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
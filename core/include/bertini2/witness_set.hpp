@@ -0,0 +1,135 @@
+//This file is part of Bertini 2.
+//
+//witness_set.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//witness_set.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with witness_set.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file witness_set.hpp
+
+\brief Defines WitnessSet, the points cut from a positive-dimensional solution component by a linear slice.
+*/
+
+
+#ifndef BERTINI_WITNESS_SET_HPP
+#define BERTINI_WITNESS_SET_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/slice.hpp"
+#include "bertini2/parameter_homotopy.hpp"
+
+
+namespace bertini
+{
+	/**
+	\brief A witness set for a solution component of a system: the system, a linear slice of as many dimensions as the component, and the points where the slice cuts the component.
+
+	The number of points is the degree of the component, if it is complete.  The system has as many functions as variables less the dimension of the slice, randomized down to that if need be, so that the system and slice together are square.
+
+	Moving the slice moves the points along the component, which samples it.  SliceMovingHomotopy makes a ParameterHomotopy for this, whose parameters are the coefficients of the slice.  The system's functions do not depend on the path variable, so in tree evaluation only the slice is reevaluated when only time changes, and one homotopy, compiled once, serves every target slice.  See tracking::WitnessSampler.
+	*/
+	class WitnessSet
+	{
+	public:
+
+		/**
+		\brief Make a witness set with no points yet.
+
+		\throws std::runtime_error, if the system has a path variable, or the system and slice together are not square, or the slice is on variables not of the system.
+		*/
+		WitnessSet(System const& system, LinearSlice const& slice);
+
+		/**
+		\brief Make a witness set with its points.
+		*/
+		WitnessSet(System const& system, LinearSlice const& slice, std::vector< Vec<mpfr> > const& points) : WitnessSet(system, slice)
+		{
+			points_ = points;
+		}
+
+
+		System const& GetSystem() const
+		{
+			return system_;
+		}
+
+		LinearSlice const& Slice() const
+		{
+			return slice_;
+		}
+
+		std::vector< Vec<mpfr> > const& Points() const
+		{
+			return points_;
+		}
+
+		void AddPoint(Vec<mpfr> const& x)
+		{
+			points_.push_back(x);
+		}
+
+		void AddPoint(Vec<dbl> const& x);
+
+		/**
+		\brief The dimension of the component, which is the number of dimensions sliced.
+		*/
+		unsigned Dimension() const
+		{
+			return slice_.Dimension();
+		}
+
+		/**
+		\brief The number of points, which is the degree of the component if the witness set is complete.
+		*/
+		size_t Degree() const
+		{
+			return points_.size();
+		}
+
+
+		/**
+		\brief The system with the functions of the slice appended, whose nonsingular solutions are the points.
+		*/
+		System SlicedSystem() const;
+
+		/**
+		\brief The homotopy moving the slice to others, with gamma trick, starting from this witness set's slice.
+
+		The family is the sliced system with the coefficients of the slice as its parameters, in the order of SliceParameters.  Set the target slice as the implicit parameters of the homotopy, in the same order.
+		*/
+		ParameterHomotopy SliceMovingHomotopy() const;
+
+		/**
+		\brief The coefficients of a slice in the order of the parameters of SliceMovingHomotopy: the coefficients row by row, then the constants, if the slice is not homogeneous.
+		*/
+		static Vec<mpfr> SliceParameters(LinearSlice const& slice);
+
+	private:
+
+		System system_;
+		LinearSlice slice_;
+		std::vector< Vec<mpfr> > points_;
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -0,0 +1,241 @@
+//This file is part of Bertini 2.
+//
+//classic_input_file.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//classic_input_file.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with classic_input_file.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/classic/input_file.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace bertini
+{
+	namespace classic
+	{
+		namespace
+		{
+			using Marks = std::vector<std::size_t>;
+
+			const std::string ConfigMarker = "CONFIG";
+			const std::string EndMarker = "END;";
+			const std::string InputMarker = "INPUT";
+
+			const auto npos = std::string::npos;
+
+			bool EndsWith(std::string const& text, std::string const& marker)
+			{
+				return text.size() >= marker.size() && std::equal(marker.rbegin(), marker.rend(), text.rbegin());
+			}
+
+			/**
+			The first mark at or after from, or npos.
+			*/
+			std::size_t Next(Marks const& marks, std::size_t from)
+			{
+				auto m = std::lower_bound(marks.begin(), marks.end(), from);
+				return m==marks.end() ? npos : *m;
+			}
+
+			/**
+			Leading space is skipped, as the skipper of SplitFileInputConfig would.
+			*/
+			std::size_t SkipSpace(std::string const& text, std::size_t from, std::size_t to)
+			{
+				while (from < to && std::isspace(static_cast<unsigned char>(text[from])))
+					++from;
+				return from;
+			}
+
+			std::string Section(std::string const& text, std::size_t from, std::size_t to)
+			{
+				from = SkipSpace(text, from, to);
+				return text.substr(from, to-from);
+			}
+
+			/**
+			Turns the text into the section [from, to), in place.
+			*/
+			std::string TakeSection(std::string & text, std::size_t from, std::size_t to)
+			{
+				from = SkipSpace(text, from, to);
+				text.erase(to);
+				text.erase(0, from);
+				return std::move(text);
+			}
+		}
+
+
+		SplitInputFile ReadInputFile(std::istream & in)
+		{
+			std::string text;
+			Marks config_marks, end_marks, input_marks; // where each marker starts in text, increasing
+
+			std::array<char, 1<<16> chunk;
+			bool in_comment = false;
+			while (in.read(chunk.data(), chunk.size()), in.gcount() > 0)
+			{
+				for (auto c = chunk.data(); c != chunk.data()+in.gcount(); ++c)
+				{
+					if (in_comment)
+					{
+						if (*c=='\n')
+						{
+							in_comment = false;
+							text.push_back('\n');
+						}
+						continue;
+					}
+
+					if (*c=='%')
+					{
+						in_comment = true;
+						continue;
+					}
+
+					text.push_back(*c);
+					switch (*c)
+					{
+						case 'G':
+							if (EndsWith(text, ConfigMarker))
+								config_marks.push_back(text.size()-ConfigMarker.size());
+							break;
+						case ';':
+							if (EndsWith(text, EndMarker))
+								end_marks.push_back(text.size()-EndMarker.size());
+							break;
+						case 'T':
+							if (EndsWith(text, InputMarker))
+								input_marks.push_back(text.size()-InputMarker.size());
+							break;
+					}
+				}
+			}
+
+
+			// the cases, and their numbers, are those of SplitFileInputConfig, tried in the same order.
+			SplitInputFile result;
+			auto end = text.size();
+
+			auto config = Next(config_marks, 0);
+			if (config!=npos)
+			{
+				auto config_start = config + ConfigMarker.size();
+
+				auto first_end = Next(end_marks, config_start);
+				if (first_end!=npos)
+				{
+					auto after_first_end = first_end + EndMarker.size();
+
+					auto input = Next(input_marks, after_first_end);
+					if (input!=npos) // 15 and 14
+					{
+						auto input_start = input + InputMarker.size();
+						auto second_end = Next(end_marks, input_start);
+						auto c = Section(text, config_start, first_end);
+						result.SetConfigInput(std::move(c), TakeSection(text, input_start, second_end==npos ? end : second_end));
+						return result;
+					}
+
+					auto second_end = Next(end_marks, after_first_end);
+					if (second_end!=npos) // 13
+					{
+						auto c = Section(text, config_start, first_end);
+						result.SetConfigInput(std::move(c), TakeSection(text, after_first_end, second_end));
+						return result;
+					}
+				}
+
+				auto input = Next(input_marks, config_start);
+				if (input!=npos)
+				{
+					auto input_start = input + InputMarker.size();
+					auto input_end = Next(end_marks, input_start);
+					if (input_end!=npos) // 11
+					{
+						auto c = Section(text, config_start, input);
+						result.SetConfigInput(std::move(c), TakeSection(text, input_start, input_end));
+						return result;
+					}
+				}
+
+				if (first_end!=npos) // 12
+				{
+					auto c = Section(text, config_start, first_end);
+					result.SetConfigInput(std::move(c), TakeSection(text, first_end + EndMarker.size(), end));
+					return result;
+				}
+
+				if (input!=npos) // 10
+				{
+					auto c = Section(text, config_start, input);
+					result.SetConfigInput(std::move(c), TakeSection(text, input + InputMarker.size(), end));
+					return result;
+				}
+
+				result.SetReadable(false); // 8
+				return result;
+			}
+
+
+			auto first_end = Next(end_marks, 0);
+			if (first_end!=npos)
+			{
+				auto after_first_end = first_end + EndMarker.size();
+				if (Next(input_marks, after_first_end)!=npos || Next(end_marks, after_first_end)!=npos) // 7, 6, and 5
+				{
+					result.SetReadable(false);
+					return result;
+				}
+			}
+
+			auto input = Next(input_marks, 0);
+			if (input!=npos) // 3 and 2
+			{
+				auto input_start = input + InputMarker.size();
+				auto input_end = Next(end_marks, input_start);
+				result.SetInput(TakeSection(text, input_start, input_end==npos ? end : input_end));
+			}
+			else if (first_end!=npos) // 1
+				result.SetInput(TakeSection(text, 0, first_end));
+			else // 0
+				result.SetInput(TakeSection(text, 0, end));
+
+			return result;
+		}
+
+
+		SplitInputFile ReadInputFile(boost::filesystem::path const& file)
+		{
+			std::ifstream fin(file.string(), std::ios::binary);
+			if (!fin)
+				throw std::runtime_error("unable to open input file " + file.string());
+
+			return ReadInputFile(fin);
+		}
+
+	} // re: namespace classic
+} // re: namespace bertini
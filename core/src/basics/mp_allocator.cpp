@@ -0,0 +1,259 @@
+//This file is part of Bertini 2.
+//
+//mp_allocator.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mp_allocator.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mp_allocator.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mp_allocator.cpp
+
+\brief The per-thread caching allocator for the limbs of multiple precision numbers.
+*/
+
+#include "bertini2/mp_allocator.hpp"
+#include "bertini2/config.h"
+
+#include <gmp.h>
+#include <mpfr.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+
+namespace bertini {
+
+	namespace mp_allocator {
+
+		namespace {
+
+			constexpr std::size_t kStep = sizeof(mp_limb_t);
+			constexpr std::size_t kNumSizes = MaxCachedBytes()/kStep + 1;
+
+			// the size's free list, or none if the size is not cached.
+			inline bool Cacheable(std::size_t size)
+			{
+				return size>0 && size<=MaxCachedBytes() && size%kStep==0;
+			}
+
+			struct ThreadCache
+			{
+				std::vector<void*> free_lists[kNumSizes];
+				ThreadStatistics statistics;
+
+				ThreadCache();
+				~ThreadCache();
+
+				void Release()
+				{
+					for (auto& list : free_lists)
+					{
+						for (auto p : list)
+							std::free(p);
+						list.clear();
+					}
+					statistics.num_cached = 0;
+				}
+			};
+
+#ifdef USE_THREAD_LOCAL
+			// trivially destructible, so readable while the cache itself is being destroyed at thread exit, and after.
+			thread_local bool cache_alive = false;
+
+			ThreadCache::ThreadCache()
+			{
+				cache_alive = true;
+			}
+
+			ThreadCache::~ThreadCache()
+			{
+				cache_alive = false;
+				Release();
+			}
+
+			// none once the thread's cache is gone, at thread exit.
+			ThreadCache* Cache()
+			{
+				static thread_local ThreadCache cache;
+				return cache_alive ? &cache : nullptr;
+			}
+#else
+			ThreadCache::ThreadCache() {}
+			ThreadCache::~ThreadCache() { Release(); }
+
+			ThreadCache* Cache()
+			{
+				return nullptr;
+			}
+#endif
+
+
+			void* (*previous_allocate)(std::size_t) = nullptr;
+			void* (*previous_reallocate)(void*, std::size_t, std::size_t) = nullptr;
+			void (*previous_free)(void*, std::size_t) = nullptr;
+			std::atomic<bool> installed(false);
+
+
+			// as GMP's own allocator does, since nothing may be thrown through GMP.
+			[[noreturn]] void OutOfMemory(std::size_t size)
+			{
+				std::fprintf(stderr, "bertini::mp_allocator: cannot allocate %zu bytes\n", size);
+				std::abort();
+			}
+
+			void* Malloc(std::size_t size)
+			{
+				void* p = std::malloc(size);
+				if (!p)
+					OutOfMemory(size);
+				return p;
+			}
+
+
+			void* Allocate(std::size_t size)
+			{
+				auto cache = Cacheable(size) ? Cache() : nullptr;
+				if (cache)
+				{
+					auto& list = cache->free_lists[size/kStep];
+					if (!list.empty())
+					{
+						void* p = list.back();
+						list.pop_back();
+						--cache->statistics.num_cached;
+						++cache->statistics.num_reused;
+						return p;
+					}
+					++cache->statistics.num_allocated;
+				}
+
+				return Malloc(size);
+			}
+
+
+			void Free(void* p, std::size_t size)
+			{
+				if (!p)
+					return;
+
+				auto cache = Cacheable(size) ? Cache() : nullptr;
+				if (cache)
+				{
+					auto& list = cache->free_lists[size/kStep];
+					if (list.size() < MaxCachedPerSize())
+					{
+						// GMP is C, so nothing may be thrown through it.  A block which cannot be cached is freed.
+						try
+						{
+							list.push_back(p);
+							++cache->statistics.num_cached;
+							return;
+						}
+						catch (std::bad_alloc const&)
+						{}
+					}
+				}
+				std::free(p);
+			}
+
+
+			void* Reallocate(void* p, std::size_t old_size, std::size_t new_size)
+			{
+				if (old_size==new_size)
+					return p;
+
+				if (!Cacheable(old_size) && !Cacheable(new_size))
+				{
+					void* q = std::realloc(p, new_size);
+					if (!q && new_size>0)
+						OutOfMemory(new_size);
+					return q;
+				}
+
+				void* q = Allocate(new_size);
+				std::memcpy(q, p, old_size < new_size ? old_size : new_size);
+				Free(p, old_size);
+				return q;
+			}
+
+		} // anonymous namespace
+
+
+
+		bool Install()
+		{
+#ifdef USE_THREAD_LOCAL
+			if (installed.exchange(true))
+				return true;
+
+			mp_get_memory_functions(&previous_allocate, &previous_reallocate, &previous_free);
+#if MPFR_VERSION_MAJOR >= 4
+			mpfr_mp_memory_cleanup();
+#endif
+			mp_set_memory_functions(Allocate, Reallocate, Free);
+			return true;
+#else
+			return false;
+#endif
+		}
+
+
+
+		void Uninstall()
+		{
+			if (!installed.exchange(false))
+				return;
+
+#if MPFR_VERSION_MAJOR >= 4
+			mpfr_mp_memory_cleanup();
+#endif
+			mp_set_memory_functions(previous_allocate, previous_reallocate, previous_free);
+		}
+
+
+
+		bool IsInstalled()
+		{
+			return installed;
+		}
+
+
+
+		void ReleaseThreadCache()
+		{
+			if (auto cache = Cache())
+				cache->Release();
+		}
+
+
+
+		ThreadStatistics GetThreadStatistics()
+		{
+			if (auto cache = Cache())
+				return cache->statistics;
+			return ThreadStatistics();
+		}
+
+	} // namespace mp_allocator
+} // namespace bertini
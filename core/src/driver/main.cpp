@@ -0,0 +1,346 @@
+//This file is part of Bertini 2.
+//
+//main.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//main.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with main.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file main.cpp
+
+\brief The bertini2 program, which solves a polynomial system given in a Classic input file by a total degree homotopy, over threads, and over MPI processes if configured with --enable-mpi.
+
+	bertini2 [options] input
+
+The CONFIG section is read in one pass by settings::ParseClassicConfig, checking the settings below, with the names and defaults of Classic.  Settings not listed are ignored.
+
+	tracktype          Only 0, finding the isolated solutions, is supported.
+	mptype             0 double, 1 fixed multiple at precision, 2 adaptive.  Default 2.
+	precision          The precision in bits for mptype 1.  Default 96.
+	odepredictor       -1 constant, 0 Euler, 1 Heun, 2 RK4, 3 Heun-Euler, 4 RK-Norsett34, 5 RKF45, 6 Cash-Karp, 7 Dormand-Prince, 8 Verner.  Default 5.
+	endgamenum         1 power series, 2 Cauchy.  Default 1.
+	tracktolbeforeeg   Default 1e-5.
+	tracktolduringeg   Default 1e-6.
+	finaltol           Default 1e-11.
+	maxstepsize        Default 0.1.
+	maxnumbersteps     Default 10000.
+	endgamebdry        Default 0.1.
+	stepsforincrease   Default 5.
+	maxnewtonits       Default 2.
+	securitymaxnorm    The norm beyond which a path is truncated.  Default 1e5.
+	ampmaxprec         The most bits of precision for mptype 2.  Default 1024.
+	ampsafetydigits1   Default 1.
+	ampsafetydigits2   Default 1.
+	coeffbound         For mptype 2.  Default 0, computed from the system.
+	degreebound        For mptype 2.  Default 0, computed from the system.
+	sharpendigits      Sharpen nonsingular endpoints to this many digits.  Default 0, not at all.
+
+The solutions are streamed to the output directory by a SolutionWriter as the paths finish, and the counts of the work done are printed once the run is over.
+*/
+
+#include "bertini2/config.h"
+#include "bertini2/classic/input_file.hpp"
+#include "bertini2/settings/classic_settings.hpp"
+#include "bertini2/system_reader.hpp"
+#include "bertini2/start_system.hpp"
+#include "bertini2/tracking/parallel_solver.hpp"
+#include "bertini2/tracking/solution_writer.hpp"
+
+#if BERTINI_ENABLE_MPI
+#include "bertini2/tracking/distributed_solver.hpp"
+#endif
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+
+namespace {
+
+	using namespace bertini;
+	using namespace bertini::tracking;
+	namespace po = boost::program_options;
+
+
+	using settings::ClassicSettings;
+
+
+	/**
+	The options of the command line.
+	*/
+	struct RunOptions
+	{
+		std::string input;
+		std::string output = ".";
+		unsigned num_threads = std::thread::hardware_concurrency();
+		std::string checkpoint;
+		double checkpoint_interval = 60;
+		size_t chunk_size = 256;
+		bool text = true;
+		bool binary = true;
+		std::string endgame_summary;
+		size_t stop_after = 0; ///< Stop once this many solutions of the kind stop_on are found, if not 0.
+		std::string stop_on = "finite";
+	};
+
+
+	template<typename TrackerType>
+	void PrecisionSetup(TrackerType &, ClassicSettings const&)
+	{}
+
+	void PrecisionSetup(AMPTracker & tracker, ClassicSettings const& s)
+	{
+		tracker.PrecisionSetup(s.AMPSettings(tracker.GetSystem()));
+	}
+
+
+	template<typename PathResultType>
+	void PrintCounters(std::ostream & out, std::vector<PathResultType> const& results, double seconds)
+	{
+		std::map<int, size_t> codes;
+		PathStats path_stats;
+		EndgameStats endgame_stats;
+		size_t num_retracked = 0, num_retried = 0;
+		for (auto const& r : results)
+		{
+			++codes[int(r.success)];
+			path_stats += r.stats;
+			endgame_stats += r.endgame_stats;
+			num_retracked += r.num_retracks > 0;
+			num_retried += r.num_retries > 0;
+		}
+
+		out << "paths: " << results.size() << "\n";
+		for (auto const& c : codes)
+			out << "  success code " << c.first << ": " << c.second << "\n";
+		out << "retracked: " << num_retracked << "\n";
+		out << "retried: " << num_retried << "\n";
+		out << "steps: " << path_stats.num_steps << " (" << path_stats.num_failed_steps << " failed)\n";
+		out << "newton iterations: " << path_stats.num_newton_iterations << "\n";
+		out << "jacobian evaluations: " << path_stats.num_jacobian_evaluations << "\n";
+		out << "factorizations: " << path_stats.num_factorizations << "\n";
+		out << "precision changes: " << path_stats.num_precision_increases << " up, " << path_stats.num_precision_decreases << " down\n";
+		out << "max precision: " << path_stats.max_precision << "\n";
+		out << "tracking seconds: " << path_stats.seconds_double << " double, " << path_stats.seconds_multiple << " multiple\n";
+		out << "endgames: " << endgame_stats << "\n";
+		out << "wall seconds: " << seconds << "\n";
+	}
+
+
+	template<typename ComplexType, typename PathResultType>
+	SolutionRecord<ComplexType> ToRecord(PathResultType const& r)
+	{
+		SolutionRecord<ComplexType> record;
+		record.path = r.path;
+		record.success = r.success;
+		record.cycle_number = r.cycle_number;
+		record.solution = r.solution;
+		return record;
+	}
+
+
+	template<class TrackerType, class EndgameType>
+	int Run(System const& target, start_system::TotalDegree const& start, ClassicSettings const& s, RunOptions const& o)
+	{
+		using Solver = ParallelSolver<TrackerType, EndgameType>;
+		using BaseComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+		using BaseRealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+		// made once, rather than from the settings for each tracker and endgame
+		const auto stepping = s.StepSettings<BaseRealType>();
+		const auto newton = s.NewtonSettings();
+		const auto tolerances = s.ToleranceSettings<BaseRealType>();
+
+		auto tracker_setup = [&s, &stepping, &newton, &tolerances](TrackerType & tracker)
+			{
+				tracker.Setup(s.PredictorSetting(), tolerances.newton_before_endgame, tolerances.path_truncation_threshold, stepping, newton);
+				PrecisionSetup(tracker, s);
+			};
+
+		// the settings of each solver tracking paths, checkpointing and stopping early only if it tracks them all
+		auto solver_setup = [&s, &o, &tolerances](Solver & solver, bool whole_run)
+			{
+				solver.SetEndgameFactory([&tolerances](TrackerType const& tracker)
+					{
+						std::unique_ptr<EndgameType> endgame(new EndgameType(tracker));
+						endgame->SetToleranceSettings(tolerances);
+						return endgame;
+					});
+				solver.SetEndgameBoundary(BaseComplexType(s.EndgameBoundary()));
+
+				if (s.SharpenDigits() > 0)
+				{
+					config::Sharpening sharpening;
+					sharpening.digits = s.SharpenDigits();
+					solver.SetSharpening(sharpening);
+				}
+
+				if (whole_run && !o.checkpoint.empty())
+					solver.SetCheckpointFile(o.checkpoint, o.checkpoint_interval);
+
+				if (whole_run && o.stop_after > 0)
+				{
+					if (o.stop_on=="real")
+						solver.SetStopWhen(StopAfter(o.stop_after, [](Vec<BaseComplexType> const& x){ return IsRealPoint(x);}));
+					else if (o.stop_on=="positive")
+						solver.SetStopWhen(StopAfter(o.stop_after, [](Vec<BaseComplexType> const& x){ return IsPositivePoint(x);}));
+					else
+						solver.SetStopWhen(StopAfterSolutions(o.stop_after));
+				}
+			};
+
+		auto started = std::chrono::steady_clock::now();
+		auto elapsed = [&started]{ return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count(); };
+
+	#if BERTINI_ENABLE_MPI
+		boost::mpi::communicator world;
+		DistributedSolver<TrackerType, start_system::TotalDegree, EndgameType> solver(world, tracker_setup, o.num_threads, o.chunk_size);
+		solver.SetSolverSetup([&](Solver & local){ solver_setup(local, world.size()==1); });
+
+		std::shared_ptr<SolutionWriter<BaseComplexType>> writer;
+		if (world.rank()==0)
+		{
+			writer = std::make_shared<SolutionWriter<BaseComplexType>>(o.output, o.text, o.binary);
+			solver.SetResultHandler([&writer](typename Solver::PathResult const& r){ writer->Write(ToRecord<BaseComplexType>(r)); });
+		}
+
+		solver.Solve(target, start);
+
+		if (world.rank()==0)
+		{
+			writer->Close();
+			PrintCounters(std::cout, solver.Results(), elapsed());
+		}
+	#else
+		Solver solver(target, start, tracker_setup, o.num_threads);
+		solver_setup(solver, true);
+
+		auto writer = std::make_shared<SolutionWriter<BaseComplexType>>(o.output, o.text, o.binary);
+		solver.SetSolutionWriter(writer);
+
+		solver.Solve();
+		writer->Close();
+
+		PrintCounters(std::cout, solver.Results(), elapsed());
+		std::cout << "steals: " << solver.NumSteals() << " (" << solver.NumRemoteSteals() << " remote)\n";
+
+		if (!o.endgame_summary.empty())
+		{
+			std::ofstream summary(o.endgame_summary);
+			solver.WriteEndgameSummary(summary);
+		}
+	#endif
+		return 0;
+	}
+
+
+	template<class TrackerType>
+	int RunWithEndgame(System const& target, start_system::TotalDegree const& start, ClassicSettings const& s, RunOptions const& o)
+	{
+		if (s.EndgameNum()==2)
+			return Run<TrackerType, typename EndgameSelector<TrackerType>::Cauchy>(target, start, s, o);
+		return Run<TrackerType, typename EndgameSelector<TrackerType>::PSEG>(target, start, s, o);
+	}
+
+} // re: namespace
+
+
+int main(int argc, char** argv)
+{
+#if BERTINI_ENABLE_MPI
+	boost::mpi::environment env(argc, argv);
+#endif
+
+	RunOptions o;
+	po::options_description visible("Usage: bertini2 [options] input\n\nOptions");
+	visible.add_options()
+		("help,h", "Print this message.")
+		("threads,t", po::value<unsigned>(&o.num_threads)->default_value(o.num_threads), "The number of threads to track paths on, per process.")
+		("output,o", po::value<std::string>(&o.output)->default_value(o.output), "The directory the solution files are written to.")
+		("checkpoint", po::value<std::string>(&o.checkpoint), "Checkpoint to this log, and resume from it if it exists.  With MPI, only a run of one process checkpoints.")
+		("checkpoint-interval", po::value<double>(&o.checkpoint_interval)->default_value(o.checkpoint_interval), "The least seconds between checkpoints of a path in flight.")
+		("chunk-size", po::value<size_t>(&o.chunk_size)->default_value(o.chunk_size), "With MPI, the number of paths handed to a process at a time.")
+		("no-text", "Do not write the Classic text solution files.")
+		("no-binary", "Do not write the binary solution file.")
+		("endgame-summary", po::value<std::string>(&o.endgame_summary), "Write a line per path with the work its endgame did to this file.")
+		("stop-after", po::value<size_t>(&o.stop_after), "Stop tracking once this many solutions of the kind given by --stop-on are found.  With MPI, only a run of one process stops early.")
+		("stop-on", po::value<std::string>(&o.stop_on)->default_value(o.stop_on), "The solutions --stop-after counts: finite, real, or positive, that is real with positive coordinates.");
+
+	po::options_description all;
+	all.add(visible).add_options()
+		("input", po::value<std::string>(&o.input));
+	po::positional_options_description positional;
+	positional.add("input", 1);
+
+	try
+	{
+		po::variables_map vm;
+		po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+		po::notify(vm);
+
+		if (vm.count("help") || o.input.empty())
+		{
+			std::cout << visible << "\n";
+			return vm.count("help") ? 0 : 1;
+		}
+		o.text = !vm.count("no-text");
+		o.binary = !vm.count("no-binary");
+		o.num_threads = std::max(o.num_threads, 1u);
+		if (o.stop_on!="finite" && o.stop_on!="real" && o.stop_on!="positive")
+			throw std::runtime_error("--stop-on must be finite, real, or positive");
+
+		auto split = classic::ReadInputFile(boost::filesystem::path(o.input));
+		if (!split.Readable())
+			throw std::runtime_error("unable to split " + o.input + " into its CONFIG and INPUT sections");
+		auto classic_settings = settings::ParseClassicConfig(split.Config());
+
+		if (classic_settings.MPType()==1)
+			DefaultPrecision(classic_settings.PrecisionDigits());
+
+		auto target = ReadSystem(split.Input(), o.num_threads);
+		target.Homogenize();
+		target.AutoPatch();
+		target.precision(DefaultPrecision());
+
+		auto start = start_system::TotalDegree(target);
+		start.Homogenize();
+
+		switch (classic_settings.MPType())
+		{
+			case 0:
+				return RunWithEndgame<DoublePrecisionTracker>(target, start, classic_settings, o);
+			case 1:
+				return RunWithEndgame<MultiplePrecisionTracker>(target, start, classic_settings, o);
+			default:
+				return RunWithEndgame<AMPTracker>(target, start, classic_settings, o);
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "bertini2: " << e.what() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,311 @@
+//This file is part of Bertini 2.
+//
+//common_subexpressions.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//common_subexpressions.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with common_subexpressions.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/common_subexpressions.hpp"
+
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		using Nd = std::shared_ptr<Node>;
+
+		/**
+		Performs the merging, remembering the canonical representative of every node seen so far.
+		*/
+		class Merger
+		{
+		public:
+
+			Nd Canonical(Nd const& n)
+			{
+				auto found = canonical_.find(n.get());
+				if (found!=canonical_.end())
+					return found->second;
+
+				Nd result = n;
+				Key key{std::type_index(typeid(*n)), {}, {}};
+				bool mergeable = true;
+
+				if (auto f = std::dynamic_pointer_cast<Function>(n))
+				{
+					if (f->entry_node())
+						f->SetRoot(Canonical(f->entry_node()));
+					mergeable = false;
+				}
+				else if (auto d = std::dynamic_pointer_cast<Differential>(n))
+					key.data.push_back(Address(d->GetVariable().get()));
+				else if (std::dynamic_pointer_cast<Integer>(n) || std::dynamic_pointer_cast<Rational>(n))
+				{
+					std::stringstream ss;
+					n->print(ss);
+					key.text = ss.str();
+				}
+				else if (std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+				{} // all instances have the same value, so the type is the key.
+				else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+				{
+					u->SetChild(Canonical(u->first_child()));
+					key.data.push_back(Address(u->first_child().get()));
+					if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+						key.data.push_back(static_cast<std::uintptr_t>(static_cast<std::intptr_t>(p->exponent())));
+				}
+				else if (auto o = std::dynamic_pointer_cast<NaryOperator>(n))
+				{
+					for (size_t ii = 0; ii < o->children_size(); ++ii)
+					{
+						o->SetChild(ii, Canonical(o->children()[ii]));
+						key.data.push_back(Address(o->children()[ii].get()));
+					}
+
+					if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+					{
+						for (bool b : s->children_sign())
+							key.data.push_back(b);
+					}
+					else if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+					{
+						for (bool b : m->children_mult_or_div())
+							key.data.push_back(b);
+					}
+				}
+				else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+				{
+					p->SetBase(Canonical(p->base()));
+					p->SetExponent(Canonical(p->exponent()));
+					key.data.push_back(Address(p->base().get()));
+					key.data.push_back(Address(p->exponent().get()));
+				}
+				else // variables, floats, and anything unknown are only identical to themselves
+					mergeable = false;
+
+				if (mergeable)
+				{
+					auto existing = representatives_.find(key);
+					if (existing!=representatives_.end())
+						result = existing->second;
+					else
+						representatives_.emplace(key, n);
+				}
+
+				canonical_[n.get()] = result;
+				return result;
+			}
+
+		private:
+
+			/**
+			The structure of a node: its type, the addresses of its canonical children and its other data, and the exact text of a numeric value.
+			*/
+			struct Key
+			{
+				std::type_index type;
+				std::vector<std::uintptr_t> data;
+				std::string text;
+
+				bool operator<(Key const& other) const
+				{
+					return std::tie(type, data, text) < std::tie(other.type, other.data, other.text);
+				}
+			};
+
+			static std::uintptr_t Address(void const* p)
+			{
+				return reinterpret_cast<std::uintptr_t>(p);
+			}
+
+			std::unordered_map<Node const*, Nd> canonical_; ///< The representative for each node visited.  Keys are only used for identity.
+			std::map<Key, Nd> representatives_; ///< The representatives, by structure.
+		};
+
+
+
+		/**
+		The data of a node other than its children, for structural hashing and equality.
+		*/
+		struct LocalStructure
+		{
+			std::type_index type;
+			std::vector<long> data;
+			std::string text;
+
+			bool operator==(LocalStructure const& other) const
+			{
+				return type==other.type && data==other.data && text==other.text;
+			}
+		};
+
+		LocalStructure Describe(Nd const& n)
+		{
+			LocalStructure local{std::type_index(typeid(*n)), {}, {}};
+
+			if (std::dynamic_pointer_cast<Function>(n))
+			{} // compared by entry node, not name
+			else if (auto v = std::dynamic_pointer_cast<Variable>(n))
+				local.text = v->name();
+			else if (auto d = std::dynamic_pointer_cast<Differential>(n))
+				local.text = d->GetVariable()->name();
+			else if (std::dynamic_pointer_cast<Number>(n))
+			{
+				std::stringstream ss;
+				n->print(ss);
+				local.text = ss.str();
+			}
+			else if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				local.data.push_back(p->exponent());
+			else if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+			{
+				for (bool b : s->children_sign())
+					local.data.push_back(b);
+			}
+			else if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+			{
+				for (bool b : m->children_mult_or_div())
+					local.data.push_back(b);
+			}
+
+			return local;
+		}
+
+		void HashCombine(std::size_t & seed, std::size_t h)
+		{
+			seed ^= h + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		}
+
+	}
+
+
+
+	std::size_t StructuralHasher::Hash(Nd const& n)
+	{
+		if (!n)
+			return 0;
+
+		auto found = hashes_.find(n.get());
+		if (found!=hashes_.end())
+			return found->second;
+
+		auto local = Describe(n);
+		std::size_t h = local.type.hash_code();
+		for (auto d : local.data)
+			HashCombine(h, std::hash<long>()(d));
+		HashCombine(h, std::hash<std::string>()(local.text));
+		for (const auto& c : Children(n))
+			HashCombine(h, Hash(c));
+
+		hashes_[n.get()] = h;
+		return h;
+	}
+
+
+
+	bool StructuralHasher::Equal(Nd const& a, Nd const& b)
+	{
+		if (a==b)
+			return true;
+		if (!a || !b || Hash(a)!=Hash(b))
+			return false;
+
+		auto key = std::make_pair(a.get(), b.get());
+		if (equal_.count(key))
+			return true;
+
+		if (!(Describe(a)==Describe(b)))
+			return false;
+
+		auto children_a = Children(a);
+		auto children_b = Children(b);
+		if (children_a.size()!=children_b.size())
+			return false;
+		for (size_t ii = 0; ii < children_a.size(); ++ii)
+			if (!Equal(children_a[ii], children_b[ii]))
+				return false;
+
+		equal_.insert(key);
+		return true;
+	}
+
+
+
+	std::size_t StructuralHash(Nd const& n)
+	{
+		return StructuralHasher().Hash(n);
+	}
+
+
+
+	bool StructurallyEqual(Nd const& a, Nd const& b)
+	{
+		return StructuralHasher().Equal(a, b);
+	}
+
+
+
+	size_t CountDistinctNodes(std::vector<Nd> const& roots)
+	{
+		std::unordered_set<Node const*> seen;
+		std::vector<Nd> to_visit(roots.begin(), roots.end());
+
+		while (!to_visit.empty())
+		{
+			auto n = to_visit.back();
+			to_visit.pop_back();
+
+			if (!n || !seen.insert(n.get()).second)
+				continue;
+
+			for (const auto& iter : Children(n))
+				to_visit.push_back(iter);
+		}
+
+		return seen.size();
+	}
+
+
+
+	CSEStatistics EliminateCommonSubexpressions(std::vector<Nd> const& roots)
+	{
+		CSEStatistics stats;
+		stats.nodes_before = CountDistinctNodes(roots);
+
+		Merger m;
+		for (const auto& iter : roots)
+			m.Canonical(iter);
+
+		stats.nodes_after = CountDistinctNodes(roots);
+		return stats;
+	}
+
+} // re: namespace node
+} // re: namespace bertini
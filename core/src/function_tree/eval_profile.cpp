@@ -0,0 +1,221 @@
+//This file is part of Bertini 2.
+//
+//eval_profile.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_profile.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_profile.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/eval_profile.hpp"
+#include "bertini2/system.hpp"
+
+#include <boost/core/demangle.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <vector>
+
+
+namespace bertini {
+namespace node{
+namespace profile{
+
+	namespace {
+
+		/**
+		A fresh evaluation in progress.
+		*/
+		struct Frame
+		{
+			Node const* function; // the innermost Function node being evaluated, this one or an ancestor.
+			double child_seconds;
+		};
+
+		struct ThreadState
+		{
+			std::unordered_map<Node const*, NodeProfile> profiles;
+			std::vector<Frame> stack;
+		};
+
+		ThreadState& State()
+		{
+		#ifdef USE_THREAD_LOCAL
+			static thread_local ThreadState state;
+		#else
+			static ThreadState state;
+		#endif
+			return state;
+		}
+
+
+		std::string TypeName(std::type_info const* type)
+		{
+			auto name = boost::core::demangle(type->name());
+			auto colons = name.rfind("::");
+			return colons==std::string::npos ? name : name.substr(colons+2);
+		}
+
+	} // re: namespace
+
+
+	std::unordered_map<Node const*, NodeProfile> const& Profiles()
+	{
+		return State().profiles;
+	}
+
+
+	void Reset()
+	{
+		State().profiles.clear();
+	}
+
+
+	ScopedEval::ScopedEval(Node const& n, bool multiple_precision) : multiple_precision_(multiple_precision)
+	{
+		auto& state = State();
+		Node const* enclosing = state.stack.empty() ? nullptr : state.stack.back().function;
+		bool is_function = dynamic_cast<Function const*>(&n)!=nullptr;
+
+		profile_ = &state.profiles[&n];
+		if (!profile_->type)
+		{
+			profile_->type = &typeid(n);
+			profile_->function = is_function ? &n : enclosing;
+		}
+
+		state.stack.push_back(Frame{is_function ? &n : enclosing, 0});
+		start_ = std::chrono::steady_clock::now();
+	}
+
+
+	ScopedEval::~ScopedEval()
+	{
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+
+		auto& state = State();
+		double self_seconds = seconds - state.stack.back().child_seconds;
+		state.stack.pop_back();
+		if (!state.stack.empty())
+			state.stack.back().child_seconds += seconds;
+
+		if (multiple_precision_)
+		{
+			++profile_->num_evals_mp;
+			profile_->self_seconds_mp += self_seconds;
+			profile_->total_seconds_mp += seconds;
+		}
+		else
+		{
+			++profile_->num_evals_d;
+			profile_->self_seconds_d += self_seconds;
+			profile_->total_seconds_d += seconds;
+		}
+	}
+
+
+	void Report(std::ostream & out, System const& sys, unsigned num_hotspots)
+	{
+		auto const& profiles = Profiles();
+
+		std::map<Node const*, std::string> names;
+		for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+			names[sys.Function(ii).get()] = sys.Function(ii)->name();
+		for (auto const& f : sys.Subfunctions())
+			names[f.get()] = f->name() + " (subfunction)";
+
+		auto name_of = [&names](Node const* f)
+			{
+				auto found = names.find(f);
+				return found==names.end() ? std::string("(unknown)") : found->second;
+			};
+
+		double total_seconds = 0;
+		for (auto const& p : profiles)
+			total_seconds += p.second.self_seconds_d + p.second.self_seconds_mp;
+
+		auto percent = [total_seconds](double s){ return total_seconds > 0 ? 100*s/total_seconds : 0; };
+
+		out << std::fixed;
+
+		out << "evaluation profile, " << std::setprecision(6) << total_seconds << " seconds in fresh evaluations\n\n";
+
+		out << "by function\n"
+		    << std::left << std::setw(32) << "name" << std::right << std::setw(14) << "evals dbl" << std::setw(14) << "evals mp" << std::setw(14) << "seconds" << std::setw(10) << "%" << "\n";
+		for (auto const& n : names)
+		{
+			auto found = profiles.find(n.first);
+			if (found==profiles.end())
+				continue;
+			auto const& p = found->second;
+			double seconds = p.total_seconds_d + p.total_seconds_mp;
+			out << std::left << std::setw(32) << n.second << std::right << std::setw(14) << p.num_evals_d << std::setw(14) << p.num_evals_mp
+			    << std::setw(14) << std::setprecision(6) << seconds << std::setw(10) << std::setprecision(2) << percent(seconds) << "\n";
+		}
+
+
+		struct TypeTotal
+		{
+			unsigned long long num_nodes = 0, num_evals = 0;
+			double seconds = 0;
+		};
+		std::map<std::string, TypeTotal> by_type;
+		for (auto const& p : profiles)
+		{
+			auto& t = by_type[TypeName(p.second.type)];
+			++t.num_nodes;
+			t.num_evals += p.second.num_evals_d + p.second.num_evals_mp;
+			t.seconds += p.second.self_seconds_d + p.second.self_seconds_mp;
+		}
+
+		std::vector<std::pair<std::string, TypeTotal>> types(by_type.begin(), by_type.end());
+		std::sort(types.begin(), types.end(), [](auto const& a, auto const& b){ return a.second.seconds > b.second.seconds; });
+
+		out << "\nby node type, self time\n"
+		    << std::left << std::setw(32) << "type" << std::right << std::setw(14) << "nodes" << std::setw(14) << "evals" << std::setw(14) << "seconds" << std::setw(10) << "%" << "\n";
+		for (auto const& t : types)
+			out << std::left << std::setw(32) << t.first << std::right << std::setw(14) << t.second.num_nodes << std::setw(14) << t.second.num_evals
+			    << std::setw(14) << std::setprecision(6) << t.second.seconds << std::setw(10) << std::setprecision(2) << percent(t.second.seconds) << "\n";
+
+
+		std::vector<std::pair<Node const*, NodeProfile const*>> nodes;
+		for (auto const& p : profiles)
+			nodes.emplace_back(p.first, &p.second);
+		auto num_listed = std::min<std::size_t>(num_hotspots, nodes.size());
+		std::partial_sort(nodes.begin(), nodes.begin()+num_listed, nodes.end(), [](auto const& a, auto const& b)
+			{ return a.second->self_seconds_d + a.second->self_seconds_mp > b.second->self_seconds_d + b.second->self_seconds_mp; });
+
+		out << "\nnodes with the most self time\n"
+		    << std::left << std::setw(32) << "type" << std::setw(32) << "in function" << std::right << std::setw(14) << "evals" << std::setw(14) << "seconds" << std::setw(10) << "%" << "\n";
+		for (std::size_t ii = 0; ii < num_listed; ++ii)
+		{
+			auto const& p = *nodes[ii].second;
+			double seconds = p.self_seconds_d + p.self_seconds_mp;
+			out << std::left << std::setw(32) << TypeName(p.type) << std::setw(32) << name_of(p.function) << std::right << std::setw(14) << p.num_evals_d + p.num_evals_mp
+			    << std::setw(14) << std::setprecision(6) << seconds << std::setw(10) << std::setprecision(2) << percent(seconds) << "\n";
+		}
+
+		out << std::defaultfloat;
+	}
+
+} // re: namespace profile
+} // re: namespace node
+} // re: namespace bertini
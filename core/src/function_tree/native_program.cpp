@@ -0,0 +1,367 @@
+//This file is part of Bertini 2.
+//
+//native_program.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//native_program.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with native_program.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/native_program.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <vector>
+
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		using Op = StraightLineProgram::OpCode;
+
+		std::string R(unsigned reg)
+		{
+			return "r[" + std::to_string(reg) + "]";
+		}
+
+		std::string A(unsigned reg)
+		{
+			return "a[" + std::to_string(reg) + "]";
+		}
+
+		std::string Unary(Op op)
+		{
+			switch (op)
+			{
+				case Op::Sqrt: return "std::sqrt";
+				case Op::Exp: return "std::exp";
+				case Op::Log: return "std::log";
+				case Op::Sin: return "std::sin";
+				case Op::Cos: return "std::cos";
+				case Op::Tan: return "std::tan";
+				case Op::ArcSin: return "std::asin";
+				case Op::ArcCos: return "std::acos";
+				case Op::ArcTan: return "std::atan";
+				default: return "";
+			}
+		}
+
+		// one statement, as StraightLineProgram::Eval
+		void WriteEval(std::ostream & out, StraightLineProgram::Instruction const& i)
+		{
+			out << "\t" << R(i.result) << " = ";
+			switch (i.op)
+			{
+				case Op::Add: out << R(i.lhs) << " + " << R(i.rhs); break;
+				case Op::Subtract: out << R(i.lhs) << " - " << R(i.rhs); break;
+				case Op::Multiply: out << R(i.lhs) << " * " << R(i.rhs); break;
+				case Op::Divide: out << R(i.lhs) << " / " << R(i.rhs); break;
+				case Op::Negate: out << "-" << R(i.lhs); break;
+				case Op::IntegerPower: out << "ipow(" << R(i.lhs) << ", " << i.exponent << ")"; break;
+				case Op::Power: out << "std::pow(" << R(i.lhs) << ", " << R(i.rhs) << ")"; break;
+				default: out << Unary(i.op) << "(" << R(i.lhs) << ")"; break;
+			}
+			out << ";\n";
+		}
+
+		// the adjoint statements of one instruction, as StraightLineProgram::ReverseSweep
+		void WriteSweep(std::ostream & out, StraightLineProgram::Instruction const& i)
+		{
+			const auto bar = A(i.result);
+			const auto l = R(i.lhs), rr = R(i.rhs), res = R(i.result);
+			const auto al = "\t\t" + A(i.lhs), ar = "\t\t" + A(i.rhs);
+
+			switch (i.op)
+			{
+				case Op::Add:
+					out << al << " += " << bar << "; " << ar << " += " << bar << ";\n"; break;
+				case Op::Subtract:
+					out << al << " += " << bar << "; " << ar << " -= " << bar << ";\n"; break;
+				case Op::Multiply:
+					out << al << " += " << bar << " * " << rr << "; " << ar << " += " << bar << " * " << l << ";\n"; break;
+				case Op::Divide:
+					out << al << " += " << bar << " / " << rr << "; " << ar << " -= " << bar << " * " << res << " / " << rr << ";\n"; break;
+				case Op::Negate:
+					out << al << " -= " << bar << ";\n"; break;
+				case Op::IntegerPower:
+					if (i.exponent!=0)
+						out << al << " += " << bar << " * C(" << i.exponent << ") * ipow(" << l << ", " << i.exponent-1 << ");\n";
+					break;
+				case Op::Power:
+					out << al << " += " << bar << " * " << rr << " * std::pow(" << l << ", " << rr << " - C(1));\n";
+					out << ar << " += " << bar << " * " << res << " * std::log(" << l << ");\n"; break;
+				case Op::Sqrt:
+					out << al << " += " << bar << " / (C(2) * " << res << ");\n"; break;
+				case Op::Exp:
+					out << al << " += " << bar << " * " << res << ";\n"; break;
+				case Op::Log:
+					out << al << " += " << bar << " / " << l << ";\n"; break;
+				case Op::Sin:
+					out << al << " += " << bar << " * std::cos(" << l << ");\n"; break;
+				case Op::Cos:
+					out << al << " -= " << bar << " * std::sin(" << l << ");\n"; break;
+				case Op::Tan:
+					out << al << " += " << bar << " * (C(1) + " << res << "*" << res << ");\n"; break;
+				case Op::ArcSin:
+					out << al << " += " << bar << " / std::sqrt(C(1) - " << l << "*" << l << ");\n"; break;
+				case Op::ArcCos:
+					out << al << " -= " << bar << " / std::sqrt(C(1) - " << l << "*" << l << ");\n"; break;
+				case Op::ArcTan:
+					out << al << " += " << bar << " / (C(1) + " << l << "*" << l << ");\n"; break;
+			}
+		}
+
+		std::string Environment(char const* name, std::string const& otherwise)
+		{
+			auto value = std::getenv(name);
+			return value && *value ? std::string(value) : otherwise;
+		}
+
+		// bumped whenever the generated functions change their signatures or meaning, so old libraries are not loaded
+		const unsigned NativeAbiVersion = 1;
+
+		std::vector<std::string> SplitWords(std::string const& s)
+		{
+			std::vector<std::string> words;
+			std::stringstream in(s);
+			std::string word;
+			while (in >> word)
+				words.push_back(word);
+			return words;
+		}
+
+		// a library is loaded only from places no one but this user could have written: not a link, owned by us, writable by neither group nor others
+		void RequirePrivate(std::string const& path, bool directory)
+		{
+			struct stat info;
+			if (lstat(path.c_str(), &info)!=0)
+				throw std::runtime_error("unable to stat " + path + " for native programs: " + std::strerror(errno));
+			if (directory ? !S_ISDIR(info.st_mode) : !S_ISREG(info.st_mode))
+				throw std::runtime_error("refusing native program path " + path + ": not a " + (directory ? "directory" : "regular file"));
+			if (info.st_uid!=getuid())
+				throw std::runtime_error("refusing native program path " + path + ": not owned by the current user");
+			if (info.st_mode & (S_IWGRP | S_IWOTH))
+				throw std::runtime_error("refusing native program path " + path + ": writable by group or others");
+		}
+
+		// runs the compiler directly, with no shell between, its output going to the log
+		int RunCompiler(std::vector<std::string> const& arguments, std::string const& log)
+		{
+			std::vector<char*> argv;
+			for (const auto& a : arguments)
+				argv.push_back(const_cast<char*>(a.c_str()));
+			argv.push_back(nullptr);
+
+			int out = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+			if (out<0)
+				throw std::runtime_error("unable to open compiler log " + log + ": " + std::strerror(errno));
+
+			pid_t pid = fork();
+			if (pid<0)
+			{
+				close(out);
+				throw std::runtime_error(std::string("unable to start the compiler: ") + std::strerror(errno));
+			}
+			if (pid==0)
+			{
+				dup2(out, STDOUT_FILENO);
+				dup2(out, STDERR_FILENO);
+				execvp(argv[0], argv.data());
+				_exit(127);
+			}
+			close(out);
+
+			int status;
+			while (waitpid(pid, &status, 0)<0)
+				if (errno!=EINTR)
+					throw std::runtime_error(std::string("unable to wait for the compiler: ") + std::strerror(errno));
+			return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+		}
+
+	} // anonymous namespace
+
+
+
+	std::string NativeProgram::Source(StraightLineProgram const& slp)
+	{
+		const auto& instructions = slp.Instructions();
+		const auto& outputs = slp.OutputRegisters();
+		const auto& extents = slp.OutputExtents();
+
+		std::stringstream out;
+		out << "// generated by bertini2 from a straight line program of " << instructions.size() << " instructions\n";
+		out << "#include <complex>\n\n";
+		out << "typedef std::complex<double> C;\n\n";
+		out << "static inline C ipow(C x, int n)\n{\n"
+		       "\tunsigned m = n < 0 ? -n : n;\n"
+		       "\tC y(1);\n"
+		       "\twhile (m)\n\t{\n\t\tif (m & 1)\n\t\t\ty *= x;\n\t\tx *= x;\n\t\tm >>= 1;\n\t}\n"
+		       "\treturn n < 0 ? C(1)/y : y;\n}\n\n";
+
+		out << "extern \"C\" void bertini_native_eval(C* r)\n{\n";
+		for (const auto& i : instructions)
+			WriteEval(out, i);
+		out << "}\n\n";
+
+		out << "extern \"C\" void bertini_native_sweep(unsigned index, C const* r, C* a)\n{\n";
+		out << "\tfor (unsigned ii = 0; ii < " << slp.NumRegisters() << "; ++ii)\n\t\ta[ii] = C(0);\n\n";
+		out << "\tswitch (index)\n\t{\n";
+		for (size_t k = 0; k < outputs.size(); ++k)
+		{
+			out << "\tcase " << k << ":\n";
+			out << "\t\t" << A(outputs[k]) << " = C(1);\n";
+			for (auto ii = extents[k]; ii > 0; --ii)
+				WriteSweep(out, instructions[ii-1]);
+			out << "\t\tbreak;\n";
+		}
+		out << "\t}\n}\n";
+
+		return out.str();
+	}
+
+
+
+	std::string NativeProgram::DefaultCacheDirectory()
+	{
+		namespace fs = boost::filesystem;
+
+		auto cache = Environment("XDG_CACHE_HOME", "");
+		if (!cache.empty())
+			return (fs::path(cache) / "bertini2_native").string();
+
+		auto home = Environment("HOME", "");
+		if (!home.empty())
+			return (fs::path(home) / ".cache" / "bertini2_native").string();
+
+		return (fs::temp_directory_path() / ("bertini2_native-" + std::to_string(getuid()))).string();
+	}
+
+
+
+	std::shared_ptr<NativeProgram> NativeProgram::Build(StraightLineProgram const& slp, std::string const& cache_directory)
+	{
+		namespace fs = boost::filesystem;
+
+		const auto source = Source(slp);
+		const auto compiler = Environment("BERTINI_NATIVE_CXX", "c++");
+		const auto flags = Environment("BERTINI_NATIVE_CXXFLAGS", "-O2");
+
+		// the library depends on how it was compiled as much as on what, so the compiler and its flags are part of the key
+		const auto key = compiler + '\0' + flags + '\0' + std::to_string(NativeAbiVersion) + '\0' + source;
+		std::stringstream name;
+		name << "slp_" << std::hex << std::hash<std::string>()(key) << "_" << std::dec << source.size();
+
+		fs::path directory(cache_directory);
+		boost::system::error_code ec;
+		if (directory.has_parent_path())
+		{
+			fs::create_directories(directory.parent_path(), ec);
+			if (ec)
+				throw std::runtime_error("unable to make directory " + directory.parent_path().string() + " for native programs: " + ec.message());
+		}
+		if (mkdir(directory.string().c_str(), S_IRWXU)!=0 && errno!=EEXIST)
+			throw std::runtime_error("unable to make directory " + directory.string() + " for native programs: " + std::strerror(errno));
+		RequirePrivate(directory.string(), true);
+
+		const auto library = directory / (name.str() + ".so");
+
+		std::shared_ptr<NativeProgram> native(new NativeProgram);
+		native->library_path_ = library.string();
+		struct stat info;
+		native->was_cached_ = lstat(native->library_path_.c_str(), &info)==0;
+
+		if (!native->was_cached_)
+		{
+			// built under names of this process's own, then moved into place, so concurrent builds of the same program do not collide
+			static std::atomic<unsigned> counter(0);
+			const auto unique = name.str() + "_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+			const auto source_file = directory / (unique + ".cpp");
+			const auto built = directory / (unique + ".so");
+			const auto log = directory / (unique + ".log");
+
+			{
+				std::ofstream f(source_file.string());
+				f << source;
+				if (!f)
+					throw std::runtime_error("unable to write native program source " + source_file.string());
+			}
+
+			std::vector<std::string> arguments{compiler};
+			for (auto& word : SplitWords(flags))
+				arguments.push_back(word);
+			for (auto word : {"-shared", "-fPIC", "-o"})
+				arguments.push_back(word);
+			arguments.push_back(built.string());
+			arguments.push_back(source_file.string());
+
+			if (RunCompiler(arguments, log.string())!=0)
+			{
+				std::string command;
+				for (const auto& a : arguments)
+					command += (command.empty() ? "" : " ") + a;
+				throw std::runtime_error("compiling native program failed, see " + log.string() + ".  command: " + command);
+			}
+
+			fs::rename(built, library, ec);
+			if (ec && !fs::exists(library))
+				throw std::runtime_error("unable to move native program into place at " + library.string() + ": " + ec.message());
+
+			fs::remove(source_file, ec);
+			fs::remove(log, ec);
+		}
+
+		RequirePrivate(native->library_path_, false);
+
+		native->handle_ = dlopen(native->library_path_.c_str(), RTLD_NOW | RTLD_LOCAL);
+		if (!native->handle_)
+			throw std::runtime_error("unable to load native program " + native->library_path_ + ": " + dlerror());
+
+		native->eval_ = reinterpret_cast<EvalFunction>(dlsym(native->handle_, "bertini_native_eval"));
+		native->sweep_ = reinterpret_cast<SweepFunction>(dlsym(native->handle_, "bertini_native_sweep"));
+		if (!native->eval_ || !native->sweep_)
+			throw std::runtime_error("native program " + native->library_path_ + " lacks its functions");
+
+		return native;
+	}
+
+
+
+	NativeProgram::~NativeProgram()
+	{
+		if (handle_)
+			dlclose(handle_);
+	}
+
+} // re: namespace node
+} // re: namespace bertini
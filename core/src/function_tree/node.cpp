@@ -25,6 +25,11 @@
 
 
 #include "function_tree.hpp"
+#include "bertini2/memory_usage.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <iterator>
 
 BOOST_CLASS_EXPORT(bertini::node::Variable)
 BOOST_CLASS_EXPORT(bertini::node::Differential)
@@ -54,3 +59,329 @@ BOOST_CLASS_EXPORT(bertini::node::PowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::IntegerPowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::SqrtOperator)
 BOOST_CLASS_EXPORT(bertini::node::ExpOperator)
+
+
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		// the heap bytes of the vectors of nodes and flags held by operators.  the nodes themselves are counted by the tree walk.
+		template<typename T>
+		std::size_t CapacityBytes(std::vector<T> const& v)
+		{
+			return v.capacity()*sizeof(T);
+		}
+
+		std::size_t CapacityBytes(std::vector<bool> const& v)
+		{
+			return v.capacity()/CHAR_BIT;
+		}
+
+	} // re: namespace
+
+
+	std::size_t detail::StoredValues::HeapBytes() const
+	{
+		return value_mp_ ? sizeof(*value_mp_) + memory::HeapBytes(value_mp_->first) : 0;
+	}
+
+	std::size_t detail::MpfrWorkspace::HeapBytes() const
+	{
+		return value_ ? memory::Bytes(*value_) : 0;
+	}
+
+	std::size_t detail::SharedFunctionValues::HeapBytes() const
+	{
+		if (!mp_)
+			return 0;
+		return sizeof(MultiplePrecision) + memory::HeapBytes(mp_->argument.first) + memory::HeapBytes(mp_->values.first) + memory::HeapBytes(mp_->values.second);
+	}
+
+
+	std::size_t Node::MemoryBytes() const
+	{
+		return sizeof(Node) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_);
+	}
+
+	std::size_t NaryOperator::MemoryBytes() const
+	{
+		return sizeof(NaryOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + CapacityBytes(children_);
+	}
+
+	std::size_t SumOperator::MemoryBytes() const
+	{
+		return sizeof(SumOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + CapacityBytes(children_) + CapacityBytes(children_sign_)
+		       + CapacityBytes(real_terms_) + CapacityBytes(imag_terms_) + CapacityBytes(sign_factors_);
+	}
+
+	std::size_t MultOperator::MemoryBytes() const
+	{
+		return sizeof(MultOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + CapacityBytes(children_) + CapacityBytes(children_mult_or_div_);
+	}
+
+	std::size_t IntegerPowerOperator::MemoryBytes() const
+	{
+		return sizeof(IntegerPowerOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + square_mp_.HeapBytes();
+	}
+
+	// the shared values are counted at each node sharing them, an overestimate of a few numbers per derivative.
+	std::size_t ExpOperator::MemoryBytes() const
+	{
+		return sizeof(ExpOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + sizeof(*shared_values_) + shared_values_->HeapBytes();
+	}
+
+	std::size_t SinOperator::MemoryBytes() const
+	{
+		return sizeof(SinOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + sizeof(*shared_values_) + shared_values_->HeapBytes();
+	}
+
+	std::size_t CosOperator::MemoryBytes() const
+	{
+		return sizeof(CosOperator) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + sizeof(*shared_values_) + shared_values_->HeapBytes();
+	}
+
+	std::size_t NamedSymbol::MemoryBytes() const
+	{
+		return sizeof(NamedSymbol) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + name_.capacity();
+	}
+
+	std::size_t Integer::MemoryBytes() const
+	{
+		return sizeof(Integer) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + memory::HeapBytes(true_value_);
+	}
+
+	std::size_t Float::MemoryBytes() const
+	{
+		return sizeof(Float) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + memory::HeapBytes(highest_precision_value_);
+	}
+
+	std::size_t Rational::MemoryBytes() const
+	{
+		return sizeof(Rational) + current_value_.HeapBytes() + CapacityBytes(differential_dependence_) + memory::HeapBytes(true_value_real_) + memory::HeapBytes(true_value_imag_);
+	}
+
+
+	std::vector<std::shared_ptr<Node> > Children(std::shared_ptr<Node> const& n)
+	{
+		if (auto f = std::dynamic_pointer_cast<Function>(n))
+		{
+			if (f->entry_node())
+				return {f->entry_node()};
+		}
+		else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+			return {u->first_child()};
+		else if (auto o = std::dynamic_pointer_cast<NaryOperator>(n))
+			return o->children();
+		else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+			return {p->base(), p->exponent()};
+
+		return {};
+	}
+
+
+	std::size_t TreeMemoryBytes(std::vector<std::shared_ptr<Node> > const& roots, std::unordered_set<Node const*> & counted)
+	{
+		std::size_t bytes = 0;
+		std::vector<std::shared_ptr<Node> > stack;
+		for (auto const& r : roots)
+			if (r)
+				stack.push_back(r);
+
+		while (!stack.empty())
+		{
+			auto n = stack.back();
+			stack.pop_back();
+			if (!counted.insert(n.get()).second)
+				continue;
+
+			bytes += n->MemoryBytes();
+			for (auto const& c : Children(n))
+				if (c)
+					stack.push_back(c);
+		}
+		return bytes;
+	}
+
+
+	namespace {
+
+		DifferentiationMemo*& ActiveMemo()
+		{
+		#ifdef USE_THREAD_LOCAL
+			static thread_local DifferentiationMemo* memo = nullptr;
+		#else
+			static DifferentiationMemo* memo = nullptr;
+		#endif
+			return memo;
+		}
+
+	} // re: namespace
+
+
+	DifferentiationMemo::DifferentiationMemo() : enclosing_(ActiveMemo())
+	{
+		ActiveMemo() = this;
+	}
+
+	DifferentiationMemo::~DifferentiationMemo()
+	{
+		ActiveMemo() = enclosing_;
+	}
+
+
+	std::shared_ptr<Node> DerivativeOf(std::shared_ptr<Node> const& n)
+	{
+		auto memo = ActiveMemo();
+		if (!memo)
+			return n->Differentiate();
+
+		auto found = memo->derivatives_.find(n.get());
+		if (found!=memo->derivatives_.end())
+			return found->second;
+
+		// differentiating recurses into the memo, so the lookup above cannot be reused for the insertion.
+		auto d = n->Differentiate();
+		memo->derivatives_.emplace(n.get(), d);
+		return d;
+	}
+
+
+
+	std::vector<std::shared_ptr<Node> > UniqueNodes(std::vector<std::shared_ptr<Node> > const& roots)
+	{
+		std::vector<std::shared_ptr<Node> > nodes;
+		std::unordered_set<Node const*> visited;
+		std::vector<std::shared_ptr<Node> > stack;
+		for (auto const& r : roots)
+			if (r)
+				stack.push_back(r);
+
+		while (!stack.empty())
+		{
+			auto n = stack.back();
+			stack.pop_back();
+			if (!visited.insert(n.get()).second)
+				continue;
+
+			nodes.push_back(n);
+			for (auto const& c : Children(n))
+				if (c)
+					stack.push_back(c);
+		}
+		return nodes;
+	}
+
+
+	namespace {
+
+		// the differentials a node of a derivative tree involves, while marking
+		struct Dependence
+		{
+			bool involves = false; ///< Whether it involves any differential.
+			bool all = false; ///< Whether it may be non-zero for every variable, the ids aside.
+			std::vector<VariableId> ids; ///< Otherwise, the variables it may be non-zero for, sorted.
+		};
+
+		// marks n after its children, and returns its dependence.  nodes reached again keep the dependence they were marked with.
+		Dependence const& MarkDependence(std::shared_ptr<Node> const& n, std::unordered_map<Node const*, Dependence> & marked, std::vector<std::shared_ptr<Node> > & involved)
+		{
+			auto found = marked.find(n.get());
+			if (found!=marked.end())
+				return found->second;
+
+			Dependence dependence;
+			if (auto d = std::dynamic_pointer_cast<Differential>(n))
+			{
+				dependence.involves = true;
+				dependence.ids.push_back(d->GetVariable()->Id());
+			}
+			else
+			{
+				const auto children = Children(n);
+				const auto sum = std::dynamic_pointer_cast<SumOperator>(n);
+				const auto product = std::dynamic_pointer_cast<MultOperator>(n);
+				const bool passes_through = std::dynamic_pointer_cast<Function>(n) || std::dynamic_pointer_cast<NegateOperator>(n);
+
+				bool linear = sum || product || passes_through;
+				unsigned num_involved = 0;
+				std::vector<VariableId> combined;
+				for (unsigned ii = 0; ii < children.size(); ++ii)
+				{
+					if (!children[ii])
+						continue;
+
+					auto const& c = MarkDependence(children[ii], marked, involved);
+					if (!c.involves)
+						continue;
+
+					// a product is zero when any factor is, but not when a divisor is
+					if (product && !product->children_mult_or_div()[ii])
+						linear = false;
+
+					// a sum is zero for a variable when all its terms are, a product when any factor is
+					if (num_involved++ == 0)
+						dependence = c;
+					else if (product)
+					{
+						if (dependence.all)
+							dependence = c;
+						else if (!c.all)
+						{
+							combined.clear();
+							std::set_intersection(dependence.ids.begin(), dependence.ids.end(), c.ids.begin(), c.ids.end(), std::back_inserter(combined));
+							dependence.ids.swap(combined);
+						}
+					}
+					else
+					{
+						if (c.all)
+						{
+							dependence.all = true;
+							dependence.ids.clear();
+						}
+						else if (!dependence.all)
+						{
+							combined.clear();
+							std::set_union(dependence.ids.begin(), dependence.ids.end(), c.ids.begin(), c.ids.end(), std::back_inserter(combined));
+							dependence.ids.swap(combined);
+						}
+					}
+				}
+
+				// a sum with a term free of differentials is not zero with them
+				if (sum && num_involved < children.size())
+					linear = false;
+
+				if (num_involved > 0 && !linear)
+				{
+					dependence.all = true;
+					dependence.ids.clear();
+				}
+			}
+
+			if (dependence.involves)
+				involved.push_back(n);
+			// a node zero for every variable is marked with a dependence on none it can be evaluated for
+			if (dependence.involves && !dependence.all && dependence.ids.empty())
+				n->DifferentialDependence(std::vector<VariableId>{NoVariable});
+			else
+				n->DifferentialDependence(dependence.all ? std::vector<VariableId>() : dependence.ids);
+			return marked.emplace(n.get(), std::move(dependence)).first->second;
+		}
+
+	} // re: namespace
+
+
+	std::vector<std::shared_ptr<Node> > MarkDifferentialDependence(std::shared_ptr<Node> const& root)
+	{
+		std::vector<std::shared_ptr<Node> > involved;
+		std::unordered_map<Node const*, Dependence> marked;
+		if (root)
+			MarkDependence(root, marked, involved);
+		return involved;
+	}
+
+} // re: namespace node
+} // re: namespace bertini
@@ -26,6 +26,10 @@
 
 #include "function_tree/operators/arithmetic.hpp"
 
+#include <Eigen/Core>
+
+#include <cmath>
+
 
 
 
@@ -71,7 +75,7 @@ namespace bertini{
 				if (converted)
 					continue;
 				
-				auto temp_node = children_[ii]->Differentiate();
+				auto temp_node = DerivativeOf(children_[ii]);
 				converted = std::dynamic_pointer_cast<Number>(temp_node);
 				if (converted)
 					if (converted->Eval<dbl>()==dbl(0.0))
@@ -248,57 +252,94 @@ namespace bertini{
 		
 
 		
-		dbl SumOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl SumOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			dbl retval;
 			this->FreshEval_d(retval, diff_variable);
 			return retval;
 		}
 			
-		void SumOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
-		{
-			evaluation_value = dbl(0);
-			for(int ii = 0; ii < children_.size(); ++ii)
+		namespace {
+			// Neumaier's variant of Kahan summation, which also compensates when a term is larger than the running sum.
+			double CompensatedSum(std::vector<double> const& terms, std::vector<double> const& signs)
 			{
-				if(children_sign_[ii])
-				{
-					children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
-					evaluation_value += temp_d_;
-				}
-				else
+				double sum = 0, compensation = 0;
+				for (size_t ii = 0; ii < terms.size(); ++ii)
 				{
-					children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
-					evaluation_value -= temp_d_;
+					double x = signs[ii]*terms[ii];
+					double t = sum + x;
+					if (std::abs(sum) >= std::abs(x))
+						compensation += (sum - t) + x;
+					else
+						compensation += (x - t) + sum;
+					sum = t;
 				}
+				return sum + compensation;
 			}
-			
+		}
+
+		void SumOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
+		{
+			const auto num_terms = children_.size();
+			if (sign_factors_.size()!=num_terms)
+			{
+				real_terms_.resize(num_terms);
+				imag_terms_.resize(num_terms);
+				sign_factors_.resize(num_terms);
+				for (size_t ii = 0; ii < num_terms; ++ii)
+					sign_factors_[ii] = children_sign_[ii] ? 1.0 : -1.0;
+			}
+
+			for (size_t ii = 0; ii < num_terms; ++ii)
+			{
+				children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
+				real_terms_[ii] = temp_d_.real();
+				imag_terms_[ii] = temp_d_.imag();
+			}
+
+			if (compensated_summation_)
+			{
+				evaluation_value = dbl(CompensatedSum(real_terms_, sign_factors_), CompensatedSum(imag_terms_, sign_factors_));
+				return;
+			}
+
+			// signed, contiguous reductions, which Eigen vectorizes
+			using Terms = Eigen::Map<const Eigen::ArrayXd>;
+			Terms signs(sign_factors_.data(), num_terms);
+			evaluation_value = dbl( (Terms(real_terms_.data(), num_terms)*signs).sum(),
+			                        (Terms(imag_terms_.data(), num_terms)*signs).sum() );
 		}
 
 			
 			
 		
-		mpfr SumOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr SumOperator::FreshEval_mp(VariableId diff_variable) const
 		{
 			mpfr retval;
 			this->FreshEval_mp(retval, diff_variable);
 			return retval;
 		}
 
-		void SumOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void SumOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
-			evaluation_value.SetZero();
-			for(int ii = 0; ii < children_.size(); ++ii)
+			if (children_.empty())
+			{
+				evaluation_value.SetZero();
+				return;
+			}
+
+			// the first term goes straight into the result, saving an addition to zero
+			children_[0]->EvalInPlace<mpfr>(evaluation_value, diff_variable);
+			if (!children_sign_[0])
+				evaluation_value *= -1;
+
+			// the terms are used where they are cached, without copying
+			for(int ii = 1; ii < children_.size(); ++ii)
 			{
 				if(children_sign_[ii])
-				{
-					children_[ii]->EvalInPlace<mpfr>(temp_mp_, diff_variable);
-					evaluation_value += temp_mp_;
-				}
+					evaluation_value += children_[ii]->EvalRef<mpfr>(diff_variable);
 				else
-				{
-					children_[ii]->EvalInPlace<mpfr>(temp_mp_, diff_variable);
-					evaluation_value -= temp_mp_;
-				}
+					evaluation_value -= children_[ii]->EvalRef<mpfr>(diff_variable);
 			}
 			
 		}
@@ -336,30 +377,30 @@ namespace bertini{
 		
 		std::shared_ptr<Node> NegateOperator::Differentiate() const
 		{
-			return std::make_shared<NegateOperator>(child_->Differentiate());
+			return std::make_shared<NegateOperator>(DerivativeOf(child_));
 		}
 		
-		dbl NegateOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl NegateOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			return -(child_->Eval<dbl>(diff_variable));
 		}
 		
-		void NegateOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void NegateOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = -evaluation_value;
 		}
 
 		
-		mpfr NegateOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr NegateOperator::FreshEval_mp(VariableId diff_variable) const
 		{
-			return -child_->Eval<mpfr>(diff_variable);
+			return -child_->EvalRef<mpfr>(diff_variable);
 		}
 
-		void NegateOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void NegateOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
-			evaluation_value = -evaluation_value;
+			evaluation_value *= -1;
 		}
 
 		
@@ -420,7 +461,7 @@ namespace bertini{
 			// this loop implements the generic product rule, perhaps inefficiently.
 			for (int ii = 0; ii < children_.size(); ++ii)
 			{
-				auto local_derivative = children_[ii]->Differentiate();
+				auto local_derivative = DerivativeOf(children_[ii]);
 				
 				// if the derivative of the current term is 0, then stop 
 				auto is_it_a_number = std::dynamic_pointer_cast<Float>(local_derivative);
@@ -566,55 +607,53 @@ namespace bertini{
 			return true;
 		}
 
-		dbl MultOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl MultOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			dbl retval;
 			this->FreshEval_d(retval, diff_variable);
 			return retval;
 		}
 		
-		void MultOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void MultOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
+			// each divisor is divided out in turn.  a product of the divisors could overflow or underflow where the quotients do not.
 			evaluation_value = dbl(1);
 			for(int ii = 0; ii < children_.size(); ++ii)
 			{
-				if(children_mult_or_div_[ii])
-				{
-					children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
+				children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
+				if (children_mult_or_div_[ii])
 					evaluation_value *= temp_d_;
-				}
 				else
-				{
-					children_[ii]->EvalInPlace<dbl>(temp_d_, diff_variable);
 					evaluation_value /= temp_d_;
-				}
 			}
-			
 		}
 
 		
-		mpfr MultOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr MultOperator::FreshEval_mp(VariableId diff_variable) const
 		{
 			mpfr retval;
 			this->FreshEval_mp(retval, diff_variable);
 			return retval;
 		}
 		
-		void MultOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void MultOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
-			evaluation_value.SetOne();
-			for(int ii = 0; ii < children_.size(); ++ii)
+			// the first factor goes straight into the result, saving a multiplication by one
+			int first = 0;
+			if (!children_.empty() && children_mult_or_div_[0])
+			{
+				children_[0]->EvalInPlace<mpfr>(evaluation_value, diff_variable);
+				first = 1;
+			}
+			else
+				evaluation_value.SetOne();
+
+			for(int ii = first; ii < children_.size(); ++ii)
 			{
 				if(children_mult_or_div_[ii])
-				{
-					children_[ii]->EvalInPlace<mpfr>(temp_mp_, diff_variable);
-					evaluation_value *= temp_mp_;
-				}
+					evaluation_value *= children_[ii]->EvalRef<mpfr>(diff_variable);
 				else
-				{
-					children_[ii]->EvalInPlace<mpfr>(temp_mp_, diff_variable);
-					evaluation_value /= temp_mp_;
-				}
+					evaluation_value /= children_[ii]->EvalRef<mpfr>(diff_variable);
 			}
 			
 		}
@@ -644,7 +683,7 @@ namespace bertini{
 		{
 			
 			auto exp_minus_one = std::make_shared<SumOperator>(exponent_, true, std::make_shared<Float>("1.0"),false);
-			auto ret_mult = std::make_shared<MultOperator>(base_->Differentiate());
+			auto ret_mult = std::make_shared<MultOperator>(DerivativeOf(base_));
 			ret_mult->AddChild(exponent_);
 			ret_mult->AddChild(std::make_shared<PowerOperator>(base_, exp_minus_one));
 			return ret_mult;
@@ -764,12 +803,12 @@ namespace bertini{
 			return false;
 		}
 		
-		dbl PowerOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl PowerOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			return std::pow( base_->Eval<dbl>(diff_variable), exponent_->Eval<dbl>());
 		}
 
-		void PowerOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void PowerOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
 			dbl temp_d;
 			exponent_->EvalInPlace<dbl>(temp_d);
@@ -779,18 +818,16 @@ namespace bertini{
 		}
 
 		
-		mpfr PowerOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr PowerOperator::FreshEval_mp(VariableId diff_variable) const
 		{
-			return pow( base_->Eval<mpfr>(diff_variable), exponent_->Eval<mpfr>());
+			return pow( base_->EvalRef<mpfr>(diff_variable), exponent_->EvalRef<mpfr>());
 		}
 
-		void PowerOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void PowerOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
-			mpfr temp_mp;
-			exponent_->EvalInPlace<mpfr>(temp_mp);
 			base_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			
-			evaluation_value = pow(evaluation_value, temp_mp);
+			evaluation_value = pow(evaluation_value, exponent_->EvalRef<mpfr>());
 		}
 
 		
@@ -828,16 +865,16 @@ namespace bertini{
 			if (exponent_==0)
 				return std::make_shared<Integer>(0);
 			else if (exponent_==1)
-				return child_->Differentiate();
+				return DerivativeOf(child_);
 			else if (exponent_==2){
 				auto M = std::make_shared<MultOperator>(std::make_shared<Integer>(2), child_);
-				M->AddChild(child_->Differentiate());
+				M->AddChild(DerivativeOf(child_));
 				return M;
 			}
 			else{
 				auto M = std::make_shared<MultOperator>(std::make_shared<Integer>(exponent_),
 														std::make_shared<IntegerPowerOperator>(child_, exponent_-1) );
-				M->AddChild(child_->Differentiate());
+				M->AddChild(DerivativeOf(child_));
 				return M;
 			}
 		}
@@ -881,7 +918,7 @@ namespace bertini{
 		std::shared_ptr<Node> SqrtOperator::Differentiate() const
 		{
 			auto ret_mult = std::make_shared<MultOperator>(std::make_shared<PowerOperator>(child_, std::make_shared<Rational>(mpq_rational(-1,2),0)));
-			ret_mult->AddChild(child_->Differentiate());
+			ret_mult->AddChild(DerivativeOf(child_));
 			ret_mult->AddChild(std::make_shared<Rational>(mpq_rational(1,2),0));
 			return ret_mult;
 		}
@@ -899,24 +936,24 @@ namespace bertini{
 		}
 		
 
-		dbl SqrtOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl SqrtOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			return sqrt(child_->Eval<dbl>(diff_variable));
 		}
 		
-		void SqrtOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void SqrtOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = sqrt(evaluation_value);
 		}
 
 		
-		mpfr SqrtOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr SqrtOperator::FreshEval_mp(VariableId diff_variable) const
 		{
-			return sqrt(child_->Eval<mpfr>(diff_variable));
+			return sqrt(child_->EvalRef<mpfr>(diff_variable));
 		}
 		
-		void SqrtOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void SqrtOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = sqrt(evaluation_value);
@@ -951,7 +988,8 @@ namespace bertini{
 		
 		std::shared_ptr<Node> ExpOperator::Differentiate() const
 		{
-			return exp(child_)*child_->Differentiate();
+			std::shared_ptr<Node> E = std::make_shared<ExpOperator>(child_, shared_values_);
+			return E*DerivativeOf(child_);
 		}
 		
 		int ExpOperator::Degree(std::shared_ptr<Variable> const& v) const
@@ -966,27 +1004,43 @@ namespace bertini{
 			}
 		}
 		
-		dbl ExpOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		template<typename T>
+		void ExpOperator::FreshEvalInPlace(T& evaluation_value, VariableId diff_variable) const
 		{
-			return exp(child_->Eval<dbl>(diff_variable));
+			child_->EvalInPlace<T>(evaluation_value, diff_variable);
+
+			auto& shared = *shared_values_;
+			if (!shared.ComputedAt(evaluation_value))
+			{
+				shared.ComputingAt(evaluation_value);
+				shared.First<T>() = exp(evaluation_value);
+			}
+			evaluation_value = shared.First<T>();
+		}
+
+		dbl ExpOperator::FreshEval_d(VariableId diff_variable) const
+		{
+			dbl evaluation_value;
+			FreshEvalInPlace(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
-		void ExpOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void ExpOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
-			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
-			evaluation_value = exp(evaluation_value);
+			FreshEvalInPlace(evaluation_value, diff_variable);
 		}
 
 		
-		mpfr ExpOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr ExpOperator::FreshEval_mp(VariableId diff_variable) const
 		{
-			return exp(child_->Eval<mpfr>(diff_variable));
+			mpfr evaluation_value;
+			FreshEvalInPlace(evaluation_value, diff_variable);
+			return evaluation_value;
 		}
 		
-		void ExpOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void ExpOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
-			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
-			evaluation_value = exp(evaluation_value);
+			FreshEvalInPlace(evaluation_value, diff_variable);
 		}
 
 
@@ -1014,7 +1068,7 @@ namespace bertini{
 		
 		std::shared_ptr<Node> LogOperator::Differentiate() const
 		{
-			return std::make_shared<MultOperator>(child_,false,child_->Differentiate(),true);
+			return std::make_shared<MultOperator>(child_,false,DerivativeOf(child_),true);
 		}
 		
 		int LogOperator::Degree(std::shared_ptr<Variable> const& v) const
@@ -1029,24 +1083,24 @@ namespace bertini{
 			}
 		}
 		
-		dbl LogOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
+		dbl LogOperator::FreshEval_d(VariableId diff_variable) const
 		{
 			return log(child_->Eval<dbl>(diff_variable));
 		}
 		
-		void LogOperator::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void LogOperator::FreshEval_d(dbl& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<dbl>(evaluation_value, diff_variable);
 			evaluation_value = log(evaluation_value);
 		}
 
 		
-		mpfr LogOperator::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+		mpfr LogOperator::FreshEval_mp(VariableId diff_variable) const
 		{
-			return log(child_->Eval<mpfr>(diff_variable));
+			return log(child_->EvalRef<mpfr>(diff_variable));
 		}
 		
-		void LogOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
+		void LogOperator::FreshEval_mp(mpfr& evaluation_value, VariableId diff_variable) const
 		{
 			child_->EvalInPlace<mpfr>(evaluation_value, diff_variable);
 			evaluation_value = log(evaluation_value);
@@ -56,7 +56,8 @@ namespace node{
 
 	std::shared_ptr<Node> SinOperator::Differentiate() const
 	{
-		return cos(child_) * child_->Differentiate();
+		std::shared_ptr<Node> C = std::make_shared<CosOperator>(child_, shared_values_);
+		return C * DerivativeOf(child_);
 	}
 	
 
@@ -72,7 +73,7 @@ namespace node{
 
 	std::shared_ptr<Node> ArcSinOperator::Differentiate() const
 	{
-		return child_->Differentiate()/sqrt(1-pow(child_,2));
+		return DerivativeOf(child_)/sqrt(1-pow(child_,2));
 	}
 
 
@@ -87,7 +88,8 @@ namespace node{
 	
 	std::shared_ptr<Node> CosOperator::Differentiate() const
 	{
-		return -sin(child_) * child_->Differentiate();
+		std::shared_ptr<Node> S = std::make_shared<SinOperator>(child_, shared_values_);
+		return -S * DerivativeOf(child_);
 	}
 	
 	
@@ -109,7 +111,7 @@ namespace node{
 
 	std::shared_ptr<Node> ArcCosOperator::Differentiate() const
 	{
-		return -child_->Differentiate()/sqrt(1-pow(child_,2));
+		return -DerivativeOf(child_)/sqrt(1-pow(child_,2));
 	}
 
 
@@ -128,7 +130,7 @@ namespace node{
 
 	std::shared_ptr<Node> TanOperator::Differentiate() const
 	{
-		return child_->Differentiate() /  pow(cos(child_),2);
+		return DerivativeOf(child_) /  pow(cos(child_),2);
 	}
 
 
@@ -147,7 +149,7 @@ namespace node{
 
 	std::shared_ptr<Node> ArcTanOperator::Differentiate() const
 	{
-		return child_->Differentiate() / (1 + pow(child_,2));
+		return DerivativeOf(child_) / (1 + pow(child_,2));
 	}
 
 } // re: namespace node	
@@ -0,0 +1,354 @@
+//This file is part of Bertini 2.
+//
+//simplify.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//simplify.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with simplify.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/simplify.hpp"
+
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		using Nd = std::shared_ptr<Node>;
+
+		/**
+		An exact complex rational value, used for folding Integer and Rational constants.
+		*/
+		struct Exact
+		{
+			mpq_rational real = 0;
+			mpq_rational imag = 0;
+		};
+
+		bool IsExact(Nd const& n, Exact & value)
+		{
+			if (auto i = std::dynamic_pointer_cast<Integer>(n))
+			{
+				value.real = mpq_rational(i->true_value());
+				value.imag = 0;
+				return true;
+			}
+			else if (auto r = std::dynamic_pointer_cast<Rational>(n))
+			{
+				value.real = r->true_value_real();
+				value.imag = r->true_value_imag();
+				return true;
+			}
+			return false;
+		}
+
+		bool IsZero(Exact const& v)
+		{
+			return v.real==0 && v.imag==0;
+		}
+
+		bool IsOne(Exact const& v)
+		{
+			return v.real==1 && v.imag==0;
+		}
+
+		Exact Negative(Exact const& a)
+		{
+			return Exact{-a.real, -a.imag};
+		}
+
+		Exact Plus(Exact const& a, Exact const& b)
+		{
+			return Exact{a.real+b.real, a.imag+b.imag};
+		}
+
+		Exact Times(Exact const& a, Exact const& b)
+		{
+			return Exact{a.real*b.real - a.imag*b.imag, a.real*b.imag + a.imag*b.real};
+		}
+
+		// b must be non-zero
+		Exact Over(Exact const& a, Exact const& b)
+		{
+			mpq_rational d = b.real*b.real + b.imag*b.imag;
+			return Exact{(a.real*b.real + a.imag*b.imag)/d, (a.imag*b.real - a.real*b.imag)/d};
+		}
+
+		// if e is negative, base must be non-zero
+		Exact Power(Exact base, int e)
+		{
+			if (e<0)
+			{
+				base = Over(Exact{1,0}, base);
+				e = -e;
+			}
+
+			Exact result{1,0};
+			while (e)
+			{
+				if (e & 1)
+					result = Times(result, base);
+				base = Times(base, base);
+				e >>= 1;
+			}
+			return result;
+		}
+
+		Nd MakeNode(Exact const& v)
+		{
+			if (v.imag==0 && boost::multiprecision::denominator(v.real)==1)
+				return std::make_shared<Integer>(mpz_int(boost::multiprecision::numerator(v.real)));
+			else
+				return std::make_shared<Rational>(v.real, v.imag);
+		}
+
+
+		/**
+		Performs the simplification, remembering the result for every node seen so far, so that shared subtrees are simplified once.
+		*/
+		class Simplifier
+		{
+		public:
+
+			Nd Run(Nd const& n)
+			{
+				auto found = simplified_.find(n.get());
+				if (found!=simplified_.end())
+					return found->second;
+
+				// hold on to the original, so its address cannot be reused by a new node during this pass.
+				visited_.push_back(n);
+
+				Nd result = n;
+				if (auto f = std::dynamic_pointer_cast<Function>(n))
+				{
+					if (f->entry_node())
+						f->SetRoot(Run(f->entry_node()));
+				}
+				else if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+					result = SimplifySum(s);
+				else if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+					result = SimplifyProduct(m);
+				else if (auto neg = std::dynamic_pointer_cast<NegateOperator>(n))
+					result = SimplifyNegation(neg);
+				else if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+					result = MakeIntegerPower(Run(p->first_child()), p->exponent(), p);
+				else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+					result = SimplifyPower(p);
+				else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+					u->SetChild(Run(u->first_child()));
+
+				simplified_[n.get()] = result;
+				return result;
+			}
+
+		private:
+
+			using Terms = std::vector< std::pair<Nd,bool> >;
+
+
+			Nd SimplifySum(std::shared_ptr<SumOperator> const& s)
+			{
+				Terms terms;
+				Exact constant;
+				for (size_t ii = 0; ii < s->children_size(); ++ii)
+					CollectTerm(Run(s->children()[ii]), s->children_sign()[ii], terms, constant);
+
+				if (!IsZero(constant))
+					terms.emplace_back(MakeNode(constant), true);
+
+				if (terms.empty())
+					return std::make_shared<Integer>(0);
+
+				if (terms.size()==1)
+					return terms[0].second ? terms[0].first : std::make_shared<NegateOperator>(terms[0].first);
+
+				auto result = std::make_shared<SumOperator>(terms[0].first, terms[0].second, terms[1].first, terms[1].second);
+				for (size_t ii = 2; ii < terms.size(); ++ii)
+					result->AddChild(terms[ii].first, terms[ii].second);
+				return result;
+			}
+
+			// t must already be simplified.
+			void CollectTerm(Nd const& t, bool sign, Terms & terms, Exact & constant)
+			{
+				Exact value;
+				if (IsExact(t, value))
+					constant = Plus(constant, sign ? value : Negative(value));
+				else if (auto s = std::dynamic_pointer_cast<SumOperator>(t))
+				{
+					for (size_t ii = 0; ii < s->children_size(); ++ii)
+						CollectTerm(s->children()[ii], s->children_sign()[ii]==sign, terms, constant);
+				}
+				else if (auto neg = std::dynamic_pointer_cast<NegateOperator>(t))
+					CollectTerm(neg->first_child(), !sign, terms, constant);
+				else
+					terms.emplace_back(t, sign);
+			}
+
+
+			Nd SimplifyProduct(std::shared_ptr<MultOperator> const& m)
+			{
+				Terms factors;
+				Exact constant{1,0};
+				for (size_t ii = 0; ii < m->children_size(); ++ii)
+					CollectFactor(Run(m->children()[ii]), m->children_mult_or_div()[ii], factors, constant);
+
+				if (IsZero(constant))
+					return std::make_shared<Integer>(0);
+
+				if (factors.empty())
+					return MakeNode(constant);
+
+				bool negate = false;
+				if (constant.real==-1 && constant.imag==0)
+				{
+					negate = true;
+					constant = Exact{1,0};
+				}
+
+				if (!IsOne(constant))
+					factors.insert(factors.begin(), std::make_pair(MakeNode(constant), true));
+
+				Nd result;
+				if (factors.size()==1 && factors[0].second)
+					result = factors[0].first;
+				else if (factors.size()==1)
+					result = std::make_shared<MultOperator>(std::make_shared<Integer>(1), true, factors[0].first, false);
+				else
+				{
+					auto product = std::make_shared<MultOperator>(factors[0].first, factors[0].second, factors[1].first, factors[1].second);
+					for (size_t ii = 2; ii < factors.size(); ++ii)
+						product->AddChild(factors[ii].first, factors[ii].second);
+					result = product;
+				}
+
+				if (negate)
+					return std::make_shared<NegateOperator>(result);
+				else
+					return result;
+			}
+
+			// f must already be simplified.
+			void CollectFactor(Nd const& f, bool mult, Terms & factors, Exact & constant)
+			{
+				Exact value;
+				if (IsExact(f, value) && (mult || !IsZero(value)))
+					constant = mult ? Times(constant, value) : Over(constant, value);
+				else if (auto m = std::dynamic_pointer_cast<MultOperator>(f))
+				{
+					for (size_t ii = 0; ii < m->children_size(); ++ii)
+						CollectFactor(m->children()[ii], m->children_mult_or_div()[ii]==mult, factors, constant);
+				}
+				else if (auto neg = std::dynamic_pointer_cast<NegateOperator>(f))
+				{
+					constant = Negative(constant);
+					CollectFactor(neg->first_child(), mult, factors, constant);
+				}
+				else // including division by an exact zero, which is left for evaluation to deal with
+					factors.emplace_back(f, mult);
+			}
+
+
+			Nd SimplifyNegation(std::shared_ptr<NegateOperator> const& neg)
+			{
+				auto child = Run(neg->first_child());
+
+				Exact value;
+				if (IsExact(child, value))
+					return MakeNode(Negative(value));
+
+				if (auto inner = std::dynamic_pointer_cast<NegateOperator>(child))
+					return inner->first_child();
+
+				neg->SetChild(child);
+				return neg;
+			}
+
+
+			// base must already be simplified.  original is reused if nothing changes.
+			Nd MakeIntegerPower(Nd const& base, int e, std::shared_ptr<IntegerPowerOperator> const& original = nullptr)
+			{
+				if (e==0)
+					return std::make_shared<Integer>(1);
+
+				if (e==1)
+					return base;
+
+				Exact value;
+				if (IsExact(base, value) && (e>0 || !IsZero(value)))
+					return MakeNode(Power(value, e));
+
+				if (auto inner = std::dynamic_pointer_cast<IntegerPowerOperator>(base))
+				{
+					long combined = static_cast<long>(e)*inner->exponent();
+					if (combined <= std::numeric_limits<int>::max() && combined >= std::numeric_limits<int>::min())
+						return MakeIntegerPower(inner->first_child(), static_cast<int>(combined));
+				}
+
+				if (original && original->exponent()==e)
+				{
+					original->SetChild(base);
+					return original;
+				}
+
+				return std::make_shared<IntegerPowerOperator>(base, e);
+			}
+
+
+			Nd SimplifyPower(std::shared_ptr<PowerOperator> const& p)
+			{
+				auto base = Run(p->base());
+				auto exponent = Run(p->exponent());
+
+				Exact value;
+				if (IsExact(exponent, value) && value.imag==0 && boost::multiprecision::denominator(value.real)==1)
+				{
+					mpz_int e = boost::multiprecision::numerator(value.real);
+					if (e <= std::numeric_limits<int>::max() && e >= std::numeric_limits<int>::min())
+						return MakeIntegerPower(base, e.convert_to<int>());
+				}
+
+				p->SetBase(base);
+				p->SetExponent(exponent);
+				return p;
+			}
+
+
+			std::unordered_map<Node const*, Nd> simplified_; ///< The result for each node visited.  Keys are only used for identity.
+			std::vector<Nd> visited_; ///< The nodes visited, kept alive for the duration of the pass.
+		};
+
+	}
+
+
+
+	std::shared_ptr<Node> Simplify(std::shared_ptr<Node> const& n)
+	{
+		Simplifier s;
+		return s.Run(n);
+	}
+
+} // re: namespace node
+} // re: namespace bertini
@@ -0,0 +1,491 @@
+//This file is part of Bertini 2.
+//
+//sparse_polynomials.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//sparse_polynomials.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with sparse_polynomials.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/sparse_polynomials.hpp"
+#include "function_tree/symbols/differential.hpp"
+#include "bertini2/memory_usage.hpp"
+#include "bertini2/mpfr_extensions.hpp"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+
+namespace bertini {
+namespace node{
+
+	namespace {
+
+		using Monomial = std::vector<unsigned>; ///< The exponent of each input.
+		using Polynomial = std::map<Monomial, mpfr>; ///< Coefficients by monomial.  Empty is zero.
+
+		/**
+		Expands trees into Polynomials, remembering the expansion of each node, so that shared subtrees are expanded once.  Used with the working precision set to that of the expansion.
+		*/
+		struct Expander
+		{
+			Expander(std::vector<std::shared_ptr<Variable> > const& inputs, unsigned prec) : num_inputs(inputs.size()), precision(prec)
+			{
+				for (unsigned ii = 0; ii < inputs.size(); ++ii)
+					input_indices[inputs[ii].get()] = ii;
+			}
+
+			Polynomial Constant(mpfr const& c) const
+			{
+				Polynomial p;
+				p[Monomial(num_inputs,0)] = c;
+				return p;
+			}
+
+			static bool IsConstant(Polynomial const& p)
+			{
+				if (p.empty())
+					return true;
+				if (p.size()>1)
+					return false;
+				const auto& m = p.begin()->first;
+				return std::all_of(m.begin(), m.end(), [](unsigned e){return e==0;});
+			}
+
+			static mpfr ConstantValue(Polynomial const& p)
+			{
+				return p.empty() ? mpfr(0) : p.begin()->second;
+			}
+
+			static void CheckSize(Polynomial const& p)
+			{
+				if (p.size() > SparsePolynomials::MaxTerms)
+					throw std::runtime_error("polynomial expansion has too many terms");
+			}
+
+			static void Scale(Polynomial & p, mpfr const& c)
+			{
+				for (auto& iter : p)
+					iter.second *= c;
+			}
+
+			static void Accumulate(Polynomial & p, Polynomial const& q, bool add)
+			{
+				for (const auto& iter : q)
+					if (add)
+						p[iter.first] += iter.second;
+					else
+						p[iter.first] -= iter.second;
+				CheckSize(p);
+			}
+
+			// the size is checked as the product grows, so a product too large to use is abandoned before it is formed
+			Polynomial Multiply(Polynomial const& a, Polynomial const& b) const
+			{
+				Polynomial result;
+				Monomial m(num_inputs);
+				for (const auto& iter : a)
+					for (const auto& jter : b)
+					{
+						for (size_t ii = 0; ii < num_inputs; ++ii)
+							m[ii] = iter.first[ii] + jter.first[ii];
+						result[m].MultiplyAdd(iter.second, jter.second);
+						CheckSize(result);
+					}
+				return result;
+			}
+
+			// the value of a number at the precision of the expansion, from its exact or highest precision value, so the node, perhaps shared with other trees, is left as it is
+			mpfr NumberValue(std::shared_ptr<Node> const& n) const
+			{
+				mpfr value;
+				if (auto i = std::dynamic_pointer_cast<Integer>(n))
+					value = mpfr(i->true_value());
+				else if (auto r = std::dynamic_pointer_cast<Rational>(n))
+					value = mpfr(mpfr_float(r->true_value_real()), mpfr_float(r->true_value_imag()));
+				else if (auto f = std::dynamic_pointer_cast<Float>(n))
+					value = f->highest_precision_value();
+				else if (std::dynamic_pointer_cast<special_number::Pi>(n))
+					value = mpfr(mpfr_float(acos(mpfr_float(-1))));
+				else
+					value = mpfr(mpfr_float(exp(mpfr_float(1))));
+				value.precision(precision);
+				return value;
+			}
+
+			Polynomial Power(Polynomial const& base, unsigned exponent) const
+			{
+				Polynomial result = Constant(mpfr(1)), square = base;
+				while (exponent > 0)
+				{
+					if (exponent & 1)
+						result = Multiply(result, square);
+					exponent >>= 1;
+					if (exponent > 0)
+						square = Multiply(square, square);
+				}
+				return result;
+			}
+
+			// a power with negative exponent is a polynomial only if its base is constant
+			Polynomial SignedPower(Polynomial const& base, int exponent) const
+			{
+				if (exponent >= 0)
+					return Power(base, exponent);
+
+				if (!IsConstant(base))
+					throw std::runtime_error("negative power of a non-constant is not a polynomial");
+				return Constant(mpfr(1)/ConstantValue(Power(base, -exponent)));
+			}
+
+			Polynomial const& Expand(std::shared_ptr<Node> const& n)
+			{
+				auto found = expanded.find(n.get());
+				if (found!=expanded.end())
+					return found->second;
+
+				Polynomial result;
+
+				if (auto v = std::dynamic_pointer_cast<Variable>(n))
+				{
+					auto index = input_indices.find(v.get());
+					if (index==input_indices.end())
+						throw std::runtime_error("function depends on a variable which is not an input of the polynomial expansion");
+
+					Monomial m(num_inputs,0);
+					m[index->second] = 1;
+					result[m] = mpfr(1);
+				}
+				else if (std::dynamic_pointer_cast<Number>(n) || std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+					result = Constant(NumberValue(n));
+				else if (std::dynamic_pointer_cast<Jacobian>(n) || std::dynamic_pointer_cast<Differential>(n))
+					throw std::runtime_error("derivative nodes cannot be expanded into polynomials");
+				else if (auto f = std::dynamic_pointer_cast<Function>(n))
+				{
+					f->EnsureNotEmpty();
+					result = Expand(f->entry_node());
+				}
+				else if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+				{
+					const auto& terms = s->children();
+					const auto& signs = s->children_sign();
+					for (size_t ii = 0; ii < terms.size(); ++ii)
+						Accumulate(result, Expand(terms[ii]), signs[ii]);
+				}
+				else if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+				{
+					const auto& factors = m->children();
+					const auto& mult_or_div = m->children_mult_or_div();
+
+					result = Constant(mpfr(1));
+					for (size_t ii = 0; ii < factors.size(); ++ii)
+					{
+						const auto& factor = Expand(factors[ii]);
+						if (mult_or_div[ii])
+							result = Multiply(result, factor);
+						else if (IsConstant(factor))
+							Scale(result, mpfr(1)/ConstantValue(factor));
+						else
+							throw std::runtime_error("division by a non-constant is not a polynomial");
+					}
+				}
+				else if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+					result = SignedPower(Expand(p->first_child()), p->exponent());
+				else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+				{
+					const auto& exponent = Expand(p->exponent());
+					if (!IsConstant(exponent))
+						throw std::runtime_error("power with non-constant exponent is not a polynomial");
+
+					auto e = ConstantValue(exponent);
+					if (e.imag()!=0 || e.real()!=round(e.real()))
+						throw std::runtime_error("power with non-integer exponent is not a polynomial");
+
+					result = SignedPower(Expand(p->base()), e.real().convert_to<int>());
+				}
+				else if (std::dynamic_pointer_cast<NegateOperator>(n))
+				{
+					result = Expand(std::dynamic_pointer_cast<NegateOperator>(n)->first_child());
+					Scale(result, mpfr(-1));
+				}
+				else
+					throw std::runtime_error("node of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " cannot be expanded into a polynomial");
+
+				return expanded[n.get()] = std::move(result);
+			}
+
+			size_t num_inputs;
+			unsigned precision;
+			std::unordered_map<Variable const*, unsigned> input_indices;
+			std::unordered_map<Node const*, Polynomial> expanded;
+		};
+
+	}
+
+
+
+	void SparsePolynomials::Clear()
+	{
+		inputs_.clear();
+		outputs_.clear();
+		terms_.clear();
+		factors_.clear();
+		std::get<std::vector<dbl> >(coefficients_).clear();
+		std::get<std::vector<mpfr> >(coefficients_).clear();
+		expanded_coefficients_.clear();
+		expansion_precision_ = 0;
+		max_degrees_.clear();
+		power_offsets_.clear();
+		max_factors_ = 0;
+		homogenizations_.clear();
+		ResizeWorkspaces();
+	}
+
+
+	void SparsePolynomials::SetInputs(std::vector<std::shared_ptr<Variable> > const& inputs)
+	{
+		if (!outputs_.empty())
+			throw std::runtime_error("setting the inputs of sparse polynomials which already have outputs");
+
+		inputs_ = inputs;
+		max_degrees_.assign(inputs_.size(), 0);
+		ResizeWorkspaces();
+	}
+
+
+	unsigned SparsePolynomials::AddOutput(std::shared_ptr<Node> const& f)
+	{
+		if (outputs_.empty())
+			expansion_precision_ = precision_;
+
+		ScopedPrecision scoped(expansion_precision_);
+		Expander expander(inputs_, expansion_precision_);
+		const auto& p = expander.Expand(f);
+
+		outputs_.push_back(f);
+		AppendTerms(p, outputs_.size()-1);
+		ResizeWorkspaces();
+		return outputs_.size()-1;
+	}
+
+
+	void SparsePolynomials::Homogenize(std::vector<std::shared_ptr<Variable> > const& inputs, std::vector<VariableGroup> const& groups, VariableGroup const& homogenizing)
+	{
+		if (groups.size()!=homogenizing.size())
+			throw std::runtime_error("homogenizing sparse polynomials needs a homogenizing variable for each group");
+
+		std::unordered_map<Variable const*, unsigned> input_indices;
+		for (unsigned ii = 0; ii < inputs.size(); ++ii)
+			input_indices[inputs[ii].get()] = ii;
+
+		auto IndexOf = [&input_indices](std::shared_ptr<Variable> const& v)
+			{
+				auto found = input_indices.find(v.get());
+				if (found==input_indices.end())
+					throw std::runtime_error("variable " + v->name() + " is not among the inputs of the homogenized polynomials");
+				return found->second;
+			};
+
+		std::vector<Homogenization> homogenizations;
+		for (unsigned ii = 0; ii < groups.size(); ++ii)
+		{
+			Homogenization h{IndexOf(homogenizing[ii]), std::vector<bool>(inputs.size(), false), {}};
+			h.in_group[h.input] = true;
+
+			VariableGroup group = groups[ii];
+			if (std::find(group.begin(), group.end(), homogenizing[ii])==group.end())
+				group.push_front(homogenizing[ii]);
+			for (const auto& v : group)
+				h.in_group[IndexOf(v)] = true;
+
+			for (const auto& f : outputs_)
+			{
+				h.degrees.push_back(f->Degree(group));
+				if (h.degrees.back() < 0)
+					throw std::runtime_error("homogenizing a function which is not a polynomial in a variable group");
+			}
+			homogenizations.push_back(std::move(h));
+		}
+
+		std::vector<unsigned> new_indices;
+		for (const auto& v : inputs_)
+			new_indices.push_back(IndexOf(v));
+		for (auto& f : factors_)
+			f.input = new_indices[f.input];
+
+		inputs_ = inputs;
+		homogenizations_ = std::move(homogenizations);
+		ApplyHomogenization();
+	}
+
+
+	void SparsePolynomials::ApplyHomogenization()
+	{
+		std::vector<Factor> factors;
+		factors.reserve(factors_.size());
+		max_degrees_.assign(inputs_.size(), 0);
+		max_factors_ = 0;
+
+		for (auto& term : terms_)
+		{
+			const unsigned first = factors.size();
+			factors.insert(factors.end(), factors_.begin()+term.first_factor, factors_.begin()+term.first_factor+term.num_expanded_factors);
+
+			for (const auto& h : homogenizations_)
+			{
+				int degree = 0;
+				for (unsigned jj = first; jj < factors.size(); ++jj)
+					if (h.in_group[factors[jj].input])
+						degree += factors[jj].exponent;
+
+				const int deficiency = h.degrees[term.output] - degree;
+				if (deficiency < 0)
+					throw std::runtime_error("term of higher degree than its function in a variable group");
+				if (deficiency > 0)
+					factors.push_back(Factor{h.input, static_cast<unsigned>(deficiency)});
+			}
+
+			term.first_factor = first;
+			term.num_factors = factors.size() - first;
+			for (unsigned jj = first; jj < factors.size(); ++jj)
+				max_degrees_[factors[jj].input] = std::max(max_degrees_[factors[jj].input], factors[jj].exponent);
+			max_factors_ = std::max(max_factors_, term.num_factors);
+		}
+
+		factors_.swap(factors);
+		ResizeWorkspaces();
+	}
+
+
+	void SparsePolynomials::precision(unsigned new_precision)
+	{
+		if (new_precision==precision_)
+			return;
+
+		precision_ = new_precision;
+		if (!outputs_.empty() && precision_ > expansion_precision_)
+		{
+			Build();
+			return;
+		}
+
+		auto& coefficients_mp = std::get<std::vector<mpfr> >(coefficients_);
+		for (size_t ii = 0; ii < coefficients_mp.size(); ++ii)
+		{
+			coefficients_mp[ii].precision(expansion_precision_);
+			coefficients_mp[ii] = expanded_coefficients_[ii];
+			coefficients_mp[ii].precision(precision_);
+		}
+		ResizeWorkspaces();
+	}
+
+
+	void SparsePolynomials::Build()
+	{
+		terms_.clear();
+		factors_.clear();
+		std::get<std::vector<dbl> >(coefficients_).clear();
+		std::get<std::vector<mpfr> >(coefficients_).clear();
+		expanded_coefficients_.clear();
+		max_degrees_.assign(inputs_.size(), 0);
+		max_factors_ = 0;
+
+		expansion_precision_ = precision_;
+		ScopedPrecision scoped(expansion_precision_);
+		Expander expander(inputs_, expansion_precision_);
+		for (unsigned ii = 0; ii < outputs_.size(); ++ii)
+			AppendTerms(expander.Expand(outputs_[ii]), ii);
+
+		if (!homogenizations_.empty())
+			ApplyHomogenization();
+		else
+			ResizeWorkspaces();
+	}
+
+
+	void SparsePolynomials::AppendTerms(std::map<std::vector<unsigned>, mpfr> const& p, unsigned output)
+	{
+		auto& coefficients_d = std::get<std::vector<dbl> >(coefficients_);
+		auto& coefficients_mp = std::get<std::vector<mpfr> >(coefficients_);
+
+		for (const auto& iter : p)
+		{
+			const auto& c = iter.second;
+			if (c.real()==0 && c.imag()==0)
+				continue;
+
+			Term term{output, static_cast<unsigned>(factors_.size()), 0, 0};
+			for (unsigned ii = 0; ii < inputs_.size(); ++ii)
+				if (iter.first[ii] > 0)
+				{
+					factors_.push_back(Factor{ii, iter.first[ii]});
+					++term.num_factors;
+					max_degrees_[ii] = std::max(max_degrees_[ii], iter.first[ii]);
+				}
+			term.num_expanded_factors = term.num_factors;
+			max_factors_ = std::max(max_factors_, term.num_factors);
+			terms_.push_back(term);
+
+			expanded_coefficients_.push_back(c);
+			coefficients_mp.push_back(c);
+			coefficients_mp.back().precision(precision_);
+			coefficients_d.push_back(dbl(c.real().convert_to<double>(), c.imag().convert_to<double>()));
+		}
+	}
+
+
+	void SparsePolynomials::ResizeWorkspaces()
+	{
+		power_offsets_.resize(inputs_.size());
+		size_t num_powers = 0;
+		for (size_t ii = 0; ii < inputs_.size(); ++ii)
+		{
+			power_offsets_[ii] = num_powers;
+			num_powers += max_degrees_[ii]+1;
+		}
+
+		std::get<std::vector<dbl> >(powers_).resize(num_powers);
+		std::get<std::vector<dbl> >(values_).resize(outputs_.size());
+		std::get<std::vector<dbl> >(derivatives_).resize(outputs_.size()*inputs_.size());
+		std::get<std::vector<dbl> >(scratch_).resize(max_factors_+3);
+
+		std::get<std::vector<mpfr> >(powers_).resize(num_powers);
+		std::get<std::vector<mpfr> >(values_).resize(outputs_.size());
+		std::get<std::vector<mpfr> >(derivatives_).resize(outputs_.size()*inputs_.size());
+		std::get<std::vector<mpfr> >(scratch_).resize(max_factors_+3);
+
+		for (auto workspace : {&powers_, &values_, &derivatives_, &scratch_})
+			for (auto& iter : std::get<std::vector<mpfr> >(*workspace))
+				iter.precision(precision_);
+	}
+
+	size_t SparsePolynomials::MemoryBytes() const
+	{
+		using memory::HeapBytes;
+
+		return sizeof(SparsePolynomials)
+		       + inputs_.capacity()*sizeof(inputs_[0]) + outputs_.capacity()*sizeof(outputs_[0])
+		       + HeapBytes(terms_) + HeapBytes(factors_) + HeapBytes(coefficients_) + HeapBytes(expanded_coefficients_)
+		       + HeapBytes(max_degrees_) + HeapBytes(power_offsets_) + homogenizations_.capacity()*sizeof(Homogenization)
+		       + HeapBytes(powers_) + HeapBytes(values_) + HeapBytes(derivatives_) + HeapBytes(scratch_);
+	}
+
+} // re: namespace node
+} // re: namespace bertini
@@ -0,0 +1,637 @@
+//This file is part of Bertini 2.
+//
+//straight_line_program.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_program.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_program.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "function_tree/straight_line_program.hpp"
+#include "function_tree/native_program.hpp"
+#include "bertini2/memory_usage.hpp"
+
+#include <algorithm>
+#include <limits>
+
+
+namespace bertini {
+namespace node{
+
+	size_t StraightLineProgram::AddOutput(std::shared_ptr<Node> const& root)
+	{
+		native_.reset();
+		parallel_plan_ = ParallelPlan();
+		outputs_.push_back(Lower(root));
+		output_extents_.push_back(instructions_.size());
+		return outputs_.size()-1;
+	}
+
+
+	void StraightLineProgram::Clear()
+	{
+		lowered_.clear();
+		inputs_.clear();
+		constants_.clear();
+		instructions_.clear();
+		outputs_.clear();
+		output_extents_.clear();
+		native_.reset();
+		parallel_plan_ = ParallelPlan();
+		thread_adjoints_.clear();
+
+		num_registers_ = 0;
+		std::get<std::vector<dbl> >(workspace_.registers_).clear();
+		std::get<std::vector<mpfr> >(workspace_.registers_).clear();
+		std::get<std::vector<dbl> >(workspace_.adjoints_).clear();
+		std::get<std::vector<mpfr> >(workspace_.adjoints_).clear();
+
+		batch_size_ = 0;
+		batch_real_.clear();
+		batch_imag_.clear();
+		batch_adjoint_real_.clear();
+		batch_adjoint_imag_.clear();
+	}
+
+
+	namespace {
+
+		using Op = StraightLineProgram::OpCode;
+
+		// the value of an instruction whose batched form is not written out lane by lane.
+		dbl ApplyScalar(StraightLineProgram::Instruction const& i, dbl const& a, dbl const& b)
+		{
+			switch (i.op)
+			{
+				case Op::IntegerPower: return pow(a, i.exponent);
+				case Op::Power: return pow(a, b);
+				case Op::Sqrt: return sqrt(a);
+				case Op::Exp: return exp(a);
+				case Op::Log: return log(a);
+				case Op::Sin: return sin(a);
+				case Op::Cos: return cos(a);
+				case Op::Tan: return tan(a);
+				case Op::ArcSin: return asin(a);
+				case Op::ArcCos: return acos(a);
+				case Op::ArcTan: return atan(a);
+				default: throw std::runtime_error("arithmetic instruction passed to scalar application in straight line program");
+			}
+		}
+
+		// the contributions to the adjoints of the arguments of such an instruction, matching ReverseSweep.
+		void AccumulateScalar(StraightLineProgram::Instruction const& i, dbl const& bar, dbl const& a, dbl const& b, dbl const& result, dbl & a_bar, dbl & b_bar)
+		{
+			const dbl one(1);
+			switch (i.op)
+			{
+				case Op::IntegerPower:
+					if (i.exponent!=0)
+						a_bar += bar * dbl(i.exponent) * pow(a, i.exponent-1);
+					break;
+				case Op::Power:
+					a_bar += bar * b * pow(a, b - one);
+					b_bar += bar * result * log(a); break;
+				case Op::Sqrt: a_bar += bar / (dbl(2) * result); break;
+				case Op::Exp: a_bar += bar * result; break;
+				case Op::Log: a_bar += bar / a; break;
+				case Op::Sin: a_bar += bar * cos(a); break;
+				case Op::Cos: a_bar -= bar * sin(a); break;
+				case Op::Tan: a_bar += bar * (one + result*result); break;
+				case Op::ArcSin: a_bar += bar / sqrt(one - a*a); break;
+				case Op::ArcCos: a_bar -= bar / sqrt(one - a*a); break;
+				case Op::ArcTan: a_bar += bar / (one + a*a); break;
+				default: throw std::runtime_error("arithmetic instruction passed to scalar accumulation in straight line program");
+			}
+		}
+	}
+
+
+	void StraightLineProgram::BeginBatch(size_t num_points) const
+	{
+		batch_size_ = num_points;
+		batch_real_.resize(num_registers_*num_points);
+		batch_imag_.resize(num_registers_*num_points);
+		batch_adjoint_real_.resize(num_registers_*num_points);
+		batch_adjoint_imag_.resize(num_registers_*num_points);
+
+		const auto& r = std::get<std::vector<dbl> >(workspace_.registers_);
+		auto broadcast = [&](unsigned reg, dbl const& value)
+		{
+			std::fill(batch_real_.begin() + reg*num_points, batch_real_.begin() + (reg+1)*num_points, value.real());
+			std::fill(batch_imag_.begin() + reg*num_points, batch_imag_.begin() + (reg+1)*num_points, value.imag());
+		};
+
+		for (const auto& iter : inputs_)
+			broadcast(iter.second, iter.first->current_value<dbl>());
+
+		for (const auto& iter : constants_)
+			broadcast(iter.second, r[iter.second]);
+	}
+
+
+	void StraightLineProgram::EvalBatch() const
+	{
+		const auto N = batch_size_;
+		double* re = batch_real_.data();
+		double* im = batch_imag_.data();
+
+		for (const auto& i : instructions_)
+		{
+			double* zr = re + i.result*N;       double* zi = im + i.result*N;
+			const double* ar = re + i.lhs*N;    const double* ai = im + i.lhs*N;
+			const double* br = re + i.rhs*N;    const double* bi = im + i.rhs*N;
+
+			switch (i.op)
+			{
+				case OpCode::Add:
+					for (size_t k = 0; k < N; ++k)
+					{
+						zr[k] = ar[k] + br[k];
+						zi[k] = ai[k] + bi[k];
+					}
+					break;
+				case OpCode::Subtract:
+					for (size_t k = 0; k < N; ++k)
+					{
+						zr[k] = ar[k] - br[k];
+						zi[k] = ai[k] - bi[k];
+					}
+					break;
+				case OpCode::Multiply:
+					for (size_t k = 0; k < N; ++k)
+					{
+						double r = ar[k]*br[k] - ai[k]*bi[k];
+						zi[k] = ar[k]*bi[k] + ai[k]*br[k];
+						zr[k] = r;
+					}
+					break;
+				case OpCode::Divide:
+					for (size_t k = 0; k < N; ++k)
+					{
+						double d = br[k]*br[k] + bi[k]*bi[k];
+						double r = (ar[k]*br[k] + ai[k]*bi[k]) / d;
+						zi[k] = (ai[k]*br[k] - ar[k]*bi[k]) / d;
+						zr[k] = r;
+					}
+					break;
+				case OpCode::Negate:
+					for (size_t k = 0; k < N; ++k)
+					{
+						zr[k] = -ar[k];
+						zi[k] = -ai[k];
+					}
+					break;
+				default:
+					for (size_t k = 0; k < N; ++k)
+					{
+						auto z = ApplyScalar(i, dbl(ar[k],ai[k]), dbl(br[k],bi[k]));
+						zr[k] = z.real();
+						zi[k] = z.imag();
+					}
+			}
+		}
+	}
+
+
+	void StraightLineProgram::ReverseSweepBatch(size_t index) const
+	{
+		const auto N = batch_size_;
+		const double* re = batch_real_.data();
+		const double* im = batch_imag_.data();
+		double* bar_re = batch_adjoint_real_.data();
+		double* bar_im = batch_adjoint_imag_.data();
+
+		std::fill(batch_adjoint_real_.begin(), batch_adjoint_real_.end(), 0.0);
+		std::fill(batch_adjoint_imag_.begin(), batch_adjoint_imag_.end(), 0.0);
+		std::fill(batch_adjoint_real_.begin() + outputs_[index]*N, batch_adjoint_real_.begin() + (outputs_[index]+1)*N, 1.0);
+
+		for (auto ii = output_extents_[index]; ii > 0; --ii)
+		{
+			const auto& i = instructions_[ii-1];
+			const double* zr = re + i.result*N;       const double* zi = im + i.result*N;
+			const double* ar = re + i.lhs*N;          const double* ai = im + i.lhs*N;
+			const double* br = re + i.rhs*N;          const double* bi = im + i.rhs*N;
+			const double* gr = bar_re + i.result*N;   const double* gi = bar_im + i.result*N;
+			double* a_bar_r = bar_re + i.lhs*N;       double* a_bar_i = bar_im + i.lhs*N;
+			double* b_bar_r = bar_re + i.rhs*N;       double* b_bar_i = bar_im + i.rhs*N;
+
+			switch (i.op)
+			{
+				case OpCode::Add:
+					for (size_t k = 0; k < N; ++k)
+					{
+						a_bar_r[k] += gr[k]; a_bar_i[k] += gi[k];
+						b_bar_r[k] += gr[k]; b_bar_i[k] += gi[k];
+					}
+					break;
+				case OpCode::Subtract:
+					for (size_t k = 0; k < N; ++k)
+					{
+						a_bar_r[k] += gr[k]; a_bar_i[k] += gi[k];
+						b_bar_r[k] -= gr[k]; b_bar_i[k] -= gi[k];
+					}
+					break;
+				case OpCode::Multiply:
+					for (size_t k = 0; k < N; ++k)
+					{
+						a_bar_r[k] += gr[k]*br[k] - gi[k]*bi[k];
+						a_bar_i[k] += gr[k]*bi[k] + gi[k]*br[k];
+						b_bar_r[k] += gr[k]*ar[k] - gi[k]*ai[k];
+						b_bar_i[k] += gr[k]*ai[k] + gi[k]*ar[k];
+					}
+					break;
+				case OpCode::Divide:
+					for (size_t k = 0; k < N; ++k)
+					{
+						// with q = bar / rhs, the lhs gets q and the rhs gets -q*result
+						double d = br[k]*br[k] + bi[k]*bi[k];
+						double qr = (gr[k]*br[k] + gi[k]*bi[k]) / d;
+						double qi = (gi[k]*br[k] - gr[k]*bi[k]) / d;
+						a_bar_r[k] += qr; a_bar_i[k] += qi;
+						b_bar_r[k] -= qr*zr[k] - qi*zi[k];
+						b_bar_i[k] -= qr*zi[k] + qi*zr[k];
+					}
+					break;
+				case OpCode::Negate:
+					for (size_t k = 0; k < N; ++k)
+					{
+						a_bar_r[k] -= gr[k]; a_bar_i[k] -= gi[k];
+					}
+					break;
+				default:
+					for (size_t k = 0; k < N; ++k)
+					{
+						dbl a_bar(0), b_bar(0);
+						AccumulateScalar(i, dbl(gr[k],gi[k]), dbl(ar[k],ai[k]), dbl(br[k],bi[k]), dbl(zr[k],zi[k]), a_bar, b_bar);
+						a_bar_r[k] += a_bar.real(); a_bar_i[k] += a_bar.imag();
+						if (i.op==OpCode::Power)
+						{
+							b_bar_r[k] += b_bar.real(); b_bar_i[k] += b_bar.imag();
+						}
+					}
+			}
+		}
+	}
+
+
+	bool StraightLineProgram::EvalNative(std::vector<dbl> & r) const
+	{
+		if (!native_)
+			return false;
+		native_->Eval(r.data());
+		return true;
+	}
+
+
+	bool StraightLineProgram::ReverseSweepNative(size_t index, std::vector<dbl> const& r, std::vector<dbl> & a) const
+	{
+		if (!native_)
+			return false;
+		native_->ReverseSweep(index, r.data(), a.data());
+		return true;
+	}
+
+
+	StraightLineProgram::Workspace StraightLineProgram::MakeWorkspace() const
+	{
+		ReadInputs<dbl>(workspace_);
+		ReadInputs<mpfr>(workspace_);
+		return workspace_;
+	}
+
+
+	void StraightLineProgram::precision(unsigned new_precision) const
+	{
+		auto& r = std::get<std::vector<mpfr> >(workspace_.registers_);
+		auto& a = std::get<std::vector<mpfr> >(workspace_.adjoints_);
+
+		auto& outgoing = precision_tiers_[precision_];
+		r.swap(outgoing.registers);
+		a.swap(outgoing.adjoints);
+		outgoing.valid = true;
+
+		auto& incoming = precision_tiers_[new_precision];
+		if (incoming.valid)
+		{
+			r.swap(incoming.registers);
+			a.swap(incoming.adjoints);
+			incoming.valid = false;
+			precision_ = new_precision;
+			return;
+		}
+
+		// first time at this precision.  whatever was swapped out of the tier is reused as storage.
+		r.resize(num_registers_);
+		a.resize(num_registers_);
+		for (auto& iter : r)
+			iter.precision(new_precision);
+
+		for (auto& iter : a)
+			iter.precision(new_precision);
+
+		for (const auto& iter : constants_)
+		{
+			iter.first->precision(new_precision);
+			iter.first->Reset();
+			r[iter.second] = iter.first->EvalRef<mpfr>();
+			r[iter.second].precision(new_precision);
+		}
+
+		precision_ = new_precision;
+	}
+
+
+	unsigned StraightLineProgram::NewRegister()
+	{
+		precision_tiers_.clear();
+
+		std::get<std::vector<dbl> >(workspace_.registers_).emplace_back();
+		std::get<std::vector<dbl> >(workspace_.adjoints_).emplace_back();
+
+		mpfr z;
+		z.precision(precision_);
+		std::get<std::vector<mpfr> >(workspace_.registers_).push_back(z);
+		std::get<std::vector<mpfr> >(workspace_.adjoints_).push_back(z);
+
+		return num_registers_++;
+	}
+
+
+	unsigned StraightLineProgram::Emit(OpCode op, unsigned lhs, unsigned rhs, int exponent)
+	{
+		auto result = NewRegister();
+		instructions_.push_back(Instruction{op, result, lhs, rhs, exponent});
+		return result;
+	}
+
+
+	unsigned StraightLineProgram::LowerConstant(std::shared_ptr<Node> const& n)
+	{
+		auto result = NewRegister();
+		constants_.push_back(std::make_pair(n, result));
+
+		n->precision(precision_);
+		n->Reset();
+		std::get<std::vector<dbl> >(workspace_.registers_)[result] = n->Eval<dbl>();
+		std::get<std::vector<mpfr> >(workspace_.registers_)[result] = n->EvalRef<mpfr>();
+		std::get<std::vector<mpfr> >(workspace_.registers_)[result].precision(precision_);
+
+		return result;
+	}
+
+
+	unsigned StraightLineProgram::Lower(std::shared_ptr<Node> const& n)
+	{
+		auto found = lowered_.find(n.get());
+		if (found!=lowered_.end())
+			return found->second;
+
+		unsigned result;
+
+		if (auto v = std::dynamic_pointer_cast<Variable>(n))
+		{
+			result = NewRegister();
+			inputs_.push_back(std::make_pair(v, result));
+		}
+		else if (std::dynamic_pointer_cast<Number>(n) || std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+			result = LowerConstant(n);
+		else if (std::dynamic_pointer_cast<Jacobian>(n) || std::dynamic_pointer_cast<Differential>(n))
+			throw std::runtime_error("derivative nodes cannot be lowered into a straight line program");
+		else if (auto f = std::dynamic_pointer_cast<Function>(n))
+		{
+			f->EnsureNotEmpty();
+			result = Lower(f->entry_node());
+		}
+		else if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+		{
+			const auto& terms = s->children();
+			const auto& signs = s->children_sign();
+
+			if (terms.empty())
+				result = LowerConstant(std::make_shared<Integer>(0));
+			else
+			{
+				result = Lower(terms[0]);
+				if (!signs[0])
+					result = Emit(OpCode::Negate, result);
+
+				for (size_t ii = 1; ii < terms.size(); ++ii)
+				{
+					auto term = Lower(terms[ii]);
+					result = Emit(signs[ii] ? OpCode::Add : OpCode::Subtract, result, term);
+				}
+			}
+		}
+		else if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+		{
+			const auto& factors = m->children();
+			const auto& mult_or_div = m->children_mult_or_div();
+
+			if (factors.empty())
+				result = LowerConstant(std::make_shared<Integer>(1));
+			else
+			{
+				result = Lower(factors[0]);
+				if (!mult_or_div[0])
+					result = Emit(OpCode::Divide, LowerConstant(std::make_shared<Integer>(1)), result);
+
+				for (size_t ii = 1; ii < factors.size(); ++ii)
+				{
+					auto factor = Lower(factors[ii]);
+					result = Emit(mult_or_div[ii] ? OpCode::Multiply : OpCode::Divide, result, factor);
+				}
+			}
+		}
+		else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+		{
+			auto base = Lower(p->base());
+			auto exponent = Lower(p->exponent());
+			result = Emit(OpCode::Power, base, exponent);
+		}
+		else if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+			result = Emit(OpCode::IntegerPower, Lower(p->first_child()), 0, p->exponent());
+		else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+		{
+			OpCode op;
+			if (std::dynamic_pointer_cast<NegateOperator>(n))
+				op = OpCode::Negate;
+			else if (std::dynamic_pointer_cast<SqrtOperator>(n))
+				op = OpCode::Sqrt;
+			else if (std::dynamic_pointer_cast<ExpOperator>(n))
+				op = OpCode::Exp;
+			else if (std::dynamic_pointer_cast<LogOperator>(n))
+				op = OpCode::Log;
+			else if (std::dynamic_pointer_cast<SinOperator>(n))
+				op = OpCode::Sin;
+			else if (std::dynamic_pointer_cast<CosOperator>(n))
+				op = OpCode::Cos;
+			else if (std::dynamic_pointer_cast<TanOperator>(n))
+				op = OpCode::Tan;
+			else if (std::dynamic_pointer_cast<ArcSinOperator>(n))
+				op = OpCode::ArcSin;
+			else if (std::dynamic_pointer_cast<ArcCosOperator>(n))
+				op = OpCode::ArcCos;
+			else if (std::dynamic_pointer_cast<ArcTanOperator>(n))
+				op = OpCode::ArcTan;
+			else
+				throw std::runtime_error("unable to lower unary operator of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " into a straight line program");
+
+			result = Emit(op, Lower(u->first_child()));
+		}
+		else
+			throw std::runtime_error("unable to lower node of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " into a straight line program");
+
+		lowered_[n.get()] = result;
+		return result;
+	}
+
+	StraightLineProgram::ParallelPlan const& StraightLineProgram::ParallelPlanFor(unsigned num_threads) const
+	{
+		if (parallel_plan_.num_threads==num_threads)
+			return parallel_plan_;
+
+		// a level narrower than this many instructions per thread is not worth a Sync, so is done by the first thread
+		constexpr size_t MinInstructionsPerThread = 16;
+
+		const auto none = std::numeric_limits<size_t>::max();
+		const auto shared = none-1;
+		const auto n = instructions_.size();
+
+		std::vector<size_t> producer(num_registers_, none);
+		for (size_t ii = 0; ii < n; ++ii)
+			producer[instructions_[ii].result] = ii;
+
+		auto reads_rhs = [](OpCode op)
+			{
+				return op==OpCode::Add || op==OpCode::Subtract || op==OpCode::Multiply || op==OpCode::Divide || op==OpCode::Power;
+			};
+
+		// the output on which each instruction exclusively depends, or shared, or none if no output needs it.  users come after what they use, so one backward pass suffices.
+		std::vector<size_t> owner(n, none);
+		auto claim = [&](unsigned reg, size_t by)
+			{
+				const auto p = producer[reg];
+				if (p==none)
+					return;
+				if (owner[p]==none)
+					owner[p] = by;
+				else if (owner[p]!=by)
+					owner[p] = shared;
+			};
+
+		for (size_t ii = 0; ii < outputs_.size(); ++ii)
+			claim(outputs_[ii], ii);
+
+		for (auto ii = n; ii > 0; --ii)
+		{
+			const auto& i = instructions_[ii-1];
+			if (owner[ii-1]==none)
+				continue;
+			claim(i.lhs, owner[ii-1]);
+			if (reads_rhs(i.op))
+				claim(i.rhs, owner[ii-1]);
+		}
+
+		// the shared instructions by level, the level of one being one more than the deepest of the instructions it reads
+		std::vector<size_t> level(n, 0);
+		std::vector<std::vector<size_t> > levels;
+		std::vector<std::vector<size_t> > by_output(outputs_.size());
+		for (size_t ii = 0; ii < n; ++ii)
+		{
+			if (owner[ii]==none)
+				continue;
+			if (owner[ii]!=shared)
+			{
+				by_output[owner[ii]].push_back(ii);
+				continue;
+			}
+
+			const auto& i = instructions_[ii];
+			auto depth = [&](unsigned reg)
+				{
+					const auto p = producer[reg];
+					return p==none ? size_t(0) : level[p]+1;
+				};
+			level[ii] = depth(i.lhs);
+			if (reads_rhs(i.op))
+				level[ii] = std::max(level[ii], depth(i.rhs));
+
+			if (levels.size() <= level[ii])
+				levels.resize(level[ii]+1);
+			levels[level[ii]].push_back(ii);
+		}
+
+		ParallelPlan plan;
+		plan.num_threads = num_threads;
+		for (auto& l : levels)
+		{
+			const bool parallel = l.size() >= MinInstructionsPerThread*num_threads;
+			if (parallel || plan.stages.empty() || plan.stages.back().parallel)
+				plan.stages.push_back({std::move(l), parallel});
+			else
+				plan.stages.back().instructions.insert(plan.stages.back().instructions.end(), l.begin(), l.end());
+		}
+
+		// the outputs, largest first, each to the thread with the fewest instructions so far
+		std::vector<size_t> order(outputs_.size());
+		for (size_t ii = 0; ii < order.size(); ++ii)
+			order[ii] = ii;
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b){ return by_output[a].size() > by_output[b].size();});
+
+		plan.exclusive.resize(num_threads);
+		for (auto o : order)
+		{
+			auto& least = *std::min_element(plan.exclusive.begin(), plan.exclusive.end(),
+			                                [](std::vector<size_t> const& a, std::vector<size_t> const& b){ return a.size() < b.size();});
+			least.insert(least.end(), by_output[o].begin(), by_output[o].end());
+		}
+		for (auto& e : plan.exclusive)
+			std::sort(e.begin(), e.end());
+
+		parallel_plan_ = std::move(plan);
+		return parallel_plan_;
+	}
+
+
+	size_t StraightLineProgram::MemoryBytes() const
+	{
+		using memory::HeapBytes;
+
+		size_t bytes = sizeof(StraightLineProgram)
+		             + lowered_.size()*(sizeof(Node const*) + sizeof(unsigned) + sizeof(void*))
+		             + inputs_.capacity()*sizeof(inputs_[0])
+		             + constants_.capacity()*sizeof(constants_[0])
+		             + HeapBytes(instructions_) + HeapBytes(outputs_) + HeapBytes(output_extents_)
+		             + HeapBytes(workspace_.registers_) + HeapBytes(workspace_.adjoints_)
+		             + HeapBytes(batch_real_) + HeapBytes(batch_imag_) + HeapBytes(batch_adjoint_real_) + HeapBytes(batch_adjoint_imag_)
+		             + HeapBytes(parallel_plan_.exclusive);
+
+		for (auto const& s : parallel_plan_.stages)
+			bytes += sizeof(s) + HeapBytes(s.instructions);
+		for (auto const& t : thread_adjoints_)
+			bytes += sizeof(t) + HeapBytes(t);
+
+		for (auto const& t : precision_tiers_)
+			bytes += sizeof(t) + HeapBytes(t.second.registers) + HeapBytes(t.second.adjoints);
+
+		return bytes;
+	}
+
+} // re: namespace node
+} // re: namespace bertini
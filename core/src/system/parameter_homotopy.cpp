@@ -0,0 +1,69 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "parameter_homotopy.hpp"
+
+
+namespace bertini {
+
+	ParameterHomotopy::ParameterHomotopy(System const& family, Vec<mpfr> const& start_parameters, bool use_gamma_trick) :
+		start_parameters_(start_parameters)
+	{
+		if (family.NumParameters()==0)
+			throw std::runtime_error("attempting to construct parameter homotopy from a system with no parameters");
+
+		if (family.HavePathVariable())
+			throw std::runtime_error("attempting to construct parameter homotopy, but the family has a path variable declared already");
+
+		if (family.NumImplicitParameters() > 0)
+			throw std::runtime_error("attempting to construct parameter homotopy, but the family has implicit parameters, which are used for the target parameters");
+
+		if (static_cast<size_t>(start_parameters.size()) != family.NumParameters())
+			throw std::runtime_error("number of start parameters (" + std::to_string(start_parameters.size()) + ") doesn't match number of parameters of the family (" + std::to_string(family.NumParameters()) + ")");
+
+		// a deep copy, so that redefining the parameters leaves the family alone
+		homotopy_ = Clone(family);
+
+		auto t = std::make_shared<node::Variable>("t");
+		gamma_ = std::make_shared<node::Rational>(use_gamma_trick ? node::Rational::Rand() : node::Rational(1));
+
+		std::shared_ptr<node::Node> tau = t;
+		if (use_gamma_trick)
+			tau = gamma_*t/(1 + (gamma_-1)*t);
+
+		VariableGroup targets;
+		const auto& parameters = homotopy_.Parameters();
+		for (unsigned ii = 0; ii < parameters.size(); ++ii)
+		{
+			auto target = std::make_shared<node::Variable>(parameters[ii]->name() + "_target");
+			auto start = std::make_shared<node::Float>(start_parameters(ii));
+			parameters[ii]->SetRoot(target + tau*(start - target));
+			targets.push_back(target);
+		}
+
+		homotopy_.AddImplicitParameters(targets);
+		homotopy_.AddPathVariable(t);
+	}
+
+} // namespace bertini
@@ -0,0 +1,92 @@
+//This file is part of Bertini 2.
+//
+//squared_up_system.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//squared_up_system.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with squared_up_system.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "squared_up_system.hpp"
+
+
+namespace bertini {
+
+	SquaredUpSystem::SquaredUpSystem(System const& sys, unsigned k) : num_functions_(k)
+	{
+		if (k==0 || k > sys.NumFunctions())
+			throw std::runtime_error("the number of functions of a squared up system must be positive, and at most the number of functions of the system");
+
+		if (sys.HavePathVariable())
+			throw std::runtime_error("attempting to square up a system with a path variable");
+
+		original_ = sys.Clone();
+
+		const auto rest = sys.NumFunctions() - k;
+		auto& R = std::get<Mat<dbl> >(randomization_);
+		R.resize(k, rest);
+		for (unsigned ii = 0; ii < k; ++ii)
+			for (unsigned jj = 0; jj < rest; ++jj)
+			{
+				coefficients_.push_back(std::make_shared<node::Rational>(node::Rational::Rand()));
+				R(ii,jj) = coefficients_.back()->Eval<dbl>();
+			}
+	}
+
+
+
+	std::tuple<Mat<dbl>, Mat<mpfr> > const& SquaredUpSystem::RandomizationAtPrecision(mpfr) const
+	{
+		if (randomization_precision_!=DefaultPrecision())
+		{
+			const auto rest = original_.NumFunctions() - num_functions_;
+			auto& R = std::get<Mat<mpfr> >(randomization_);
+			R.resize(num_functions_, rest);
+			for (unsigned ii = 0; ii < num_functions_; ++ii)
+				for (unsigned jj = 0; jj < rest; ++jj)
+				{
+					auto const& c = coefficients_[ii*rest + jj];
+					R(ii,jj) = mpfr(mpfr_float(c->true_value_real()), mpfr_float(c->true_value_imag()));
+				}
+			randomization_precision_ = DefaultPrecision();
+		}
+		return randomization_;
+	}
+
+
+
+	System SquaredUpSystem::AsSystem() const
+	{
+		using Nd = std::shared_ptr<node::Node>;
+
+		const auto rest = original_.NumFunctions() - num_functions_;
+
+		System s;
+		s.CopyVariableStructure(original_);
+		for (unsigned ii = 0; ii < num_functions_; ++ii)
+		{
+			Nd f = original_.Function(ii)->entry_node();
+			for (unsigned jj = 0; jj < rest; ++jj)
+				f = f + coefficients_[ii*rest + jj]*original_.Function(num_functions_+jj)->entry_node();
+			s.AddFunction(f);
+		}
+		return s;
+	}
+
+} // namespace bertini
@@ -24,14 +24,95 @@
 
 #include "start_system.hpp"
 
+#include <algorithm>
+
 
 BOOST_CLASS_EXPORT(bertini::start_system::TotalDegree);
+BOOST_CLASS_EXPORT(bertini::start_system::LinearProduct);
+BOOST_CLASS_EXPORT(bertini::start_system::MHomogeneous);
+BOOST_CLASS_EXPORT(bertini::start_system::Polyhedral);
+BOOST_CLASS_EXPORT(bertini::start_system::User);
 
 
 namespace bertini {
 
 	namespace start_system {
 
+		namespace {
+
+			/**
+			The functions of a TotalDegree start system, x_i^{d_i} - r_i h^{d_i}, with h = 1 if not homogenized.
+			*/
+			class TotalDegreeClosedForm : public ClosedFormStart
+			{
+			public:
+				TotalDegreeClosedForm(std::vector<unsigned> indices, int homogenizing_index, std::vector<unsigned> degrees, std::vector<std::shared_ptr<node::Rational> > const& random_values) :
+					indices_(std::move(indices)), homogenizing_index_(homogenizing_index), degrees_(std::move(degrees))
+				{
+					for (auto const& r : random_values)
+					{
+						real_.push_back(r->true_value_real());
+						imag_.push_back(r->true_value_imag());
+						values_d_.push_back(dbl(double(r->true_value_real()), double(r->true_value_imag())));
+					}
+				}
+
+			private:
+
+				dbl Value(dbl, size_t ii) const
+				{
+					return values_d_[ii];
+				}
+
+				mpfr Value(mpfr, size_t ii) const
+				{
+					return mpfr(mpfr_float(real_[ii]), mpfr_float(imag_[ii]));
+				}
+
+				template<typename T>
+				void EvalT(Vec<T> & f, Vec<T> const& x) const
+				{
+					for (size_t ii = 0; ii < indices_.size(); ++ii)
+					{
+						const int d = static_cast<int>(degrees_[ii]);
+						f(ii) = pow(x(indices_[ii]), d);
+						if (homogenizing_index_ < 0)
+							f(ii) -= Value(T(), ii);
+						else
+							f(ii) -= Value(T(), ii) * pow(x(homogenizing_index_), d);
+					}
+				}
+
+				template<typename T>
+				void JacobianT(Mat<T> & J, Vec<T> const& x) const
+				{
+					using RT = typename Eigen::NumTraits<T>::Real;
+
+					J.topRows(indices_.size()).setZero();
+					for (size_t ii = 0; ii < indices_.size(); ++ii)
+					{
+						const int d = static_cast<int>(degrees_[ii]);
+						J(ii, indices_[ii]) = pow(x(indices_[ii]), d-1) * RT(d);
+						if (homogenizing_index_ >= 0)
+							J(ii, homogenizing_index_) = Value(T(), ii) * pow(x(homogenizing_index_), d-1) * RT(-d);
+					}
+				}
+
+				void Eval(Vec<dbl> & f, Vec<dbl> const& x) const override { EvalT(f, x); }
+				void Eval(Vec<mpfr> & f, Vec<mpfr> const& x) const override { EvalT(f, x); }
+				void Jacobian(Mat<dbl> & J, Vec<dbl> const& x) const override { JacobianT(J, x); }
+				void Jacobian(Mat<mpfr> & J, Vec<mpfr> const& x) const override { JacobianT(J, x); }
+
+				std::vector<unsigned> indices_; ///< The position of the variable of each function among the variables.
+				int homogenizing_index_; ///< The position of the homogenizing variable, or -1.
+				std::vector<unsigned> degrees_;
+				std::vector<mpq_rational> real_, imag_; ///< The random values, exactly, for multiple precision at any precision.
+				std::vector<dbl> values_d_;
+			};
+
+		} // re: namespace
+
+
 		// constructor for TotalDegree start system, from any other *suitable* system.
 		TotalDegree::TotalDegree(System const& s)
 		{
@@ -104,6 +185,48 @@ namespace bertini {
 
 
 		
+		std::shared_ptr<const ClosedFormStart> TotalDegree::ClosedForm() const
+		{
+			auto const& group = AffineVariableGroup(0);
+			auto const& variables = Variables();
+			if (group.size()!=degrees_.size() || variables.size() > group.size()+1)
+				return nullptr;
+
+			std::vector<unsigned> indices;
+			for (auto const& v : group)
+				indices.push_back(static_cast<unsigned>(std::find(variables.begin(), variables.end(), v) - variables.begin()));
+
+			int homogenizing_index = -1;
+			if (variables.size()==group.size()+1)
+				for (unsigned jj = 0; jj < variables.size(); ++jj)
+					if (std::find(indices.begin(), indices.end(), jj)==indices.end())
+						homogenizing_index = static_cast<int>(jj);
+
+			std::vector<unsigned> degrees;
+			for (auto const& d : degrees_)
+				degrees.push_back(static_cast<unsigned>(d));
+
+			return std::make_shared<TotalDegreeClosedForm>(std::move(indices), homogenizing_index, std::move(degrees), random_values_);
+		}
+
+
+
+		dbl TotalDegree::StartCoordinate(dbl, size_t ii, mpz_int const& k) const
+		{
+			return exp( std::acos(-1) * dbl(0,2) * double(k) / double(degrees_[ii])  ) * pow(random_values_[ii]->Eval<dbl>(), double(1) / double(degrees_[ii]));
+		}
+
+
+		mpfr TotalDegree::StartCoordinate(mpfr, size_t ii, mpz_int const& k) const
+		{
+			auto two_i = mpfr(0,2);
+			auto one = mpfr(1);
+
+			return exp( acos( mpfr_float(-1) ) * two_i * mpfr_float(k) / mpfr_float(degrees_[ii])  ) * pow(random_values_[ii]->Eval<mpfr>(), one / degrees_[ii]);
+		}
+
+
+		
 		Vec<dbl> TotalDegree::GenerateStartPoint(dbl,mpz_int index) const
 		{
 			Vec<dbl> start_point(NumVariables());
@@ -117,7 +240,7 @@ namespace bertini {
 			}
 
 			for (size_t ii = 0; ii< NumNaturalVariables(); ++ii)
-				start_point(ii+offset) = exp( std::acos(-1) * dbl(0,2) * double(indices[ii]) / double(degrees_[ii])  ) * pow(random_values_[ii]->Eval<dbl>(), double(1) / double(degrees_[ii]));
+				start_point(ii+offset) = StartCoordinate(dbl(), ii, indices[ii]);
 
 			if (IsPatched())
 				RescalePointToFitPatchInPlace(start_point);
@@ -138,11 +261,8 @@ namespace bertini {
 				offset = 1;
 			}
 
-			auto two_i = mpfr(0,2);
-			auto one = mpfr(1);
-
 			for (size_t ii = 0; ii< NumNaturalVariables(); ++ii)
-				start_point(ii+offset) = exp( acos( mpfr_float(-1) ) * two_i * mpfr_float(indices[ii]) / mpfr_float(degrees_[ii])  ) * pow(random_values_[ii]->Eval<mpfr>(), one / degrees_[ii]);
+				start_point(ii+offset) = StartCoordinate(mpfr(), ii, indices[ii]);
 
 			if (IsPatched())
 				RescalePointToFitPatchInPlace(start_point);
@@ -151,6 +271,454 @@ namespace bertini {
 			return start_point;
 		}
 
+
+
+
+		// constructor for LinearProduct start system, from any other *suitable* system.
+		LinearProduct::LinearProduct(System const& s, bool use_supports)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumUngroupedVariables() > 0)
+				throw std::runtime_error("ungrouped variables are present.  currently unallowed");
+
+			if (s.NumTotalFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct linear product start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct linear product start system, but target system has path varible declared already");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct linear product start system from non-polynomial target system");
+
+			const auto num_functions = s.NumFunctions();
+			const auto num_groups = s.NumVariableGroups();
+
+			degrees_.assign(num_functions, std::vector<int>(num_groups));
+			supports_.assign(num_functions, std::vector< std::vector<unsigned> >(num_groups));
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+				for (unsigned jj = 0; jj < num_groups; ++jj)
+				{
+					auto const& group = s.AffineVariableGroup(jj);
+					degrees_[ii][jj] = s.Function(ii)->Degree(group);
+
+					auto multidegree = s.Function(ii)->MultiDegree(group);
+					for (unsigned kk = 0; kk < group.size(); ++kk)
+						if (!use_supports || multidegree[kk] > 0)
+							supports_[ii][jj].push_back(kk);
+				}
+
+			CopyVariableStructure(s);
+
+			linear_factors_.resize(num_functions);
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+			{
+				Nd f;
+				linear_factors_[ii].resize(num_groups);
+				for (unsigned jj = 0; jj < num_groups; ++jj)
+				{
+					auto const& group = s.AffineVariableGroup(jj);
+					auto const& support = supports_[ii][jj];
+					linear_factors_[ii][jj].resize(degrees_[ii][jj]);
+					for (auto& factor : linear_factors_[ii][jj])
+					{
+						for (unsigned kk = 0; kk <= support.size(); ++kk)
+							factor.push_back(std::make_shared<node::Rational>(node::Rational::Rand()));
+
+						Nd linear = factor.back();
+						for (unsigned kk = 0; kk < support.size(); ++kk)
+							linear = linear + factor[kk]*group[support[kk]];
+						f = f ? f*linear : linear;
+					}
+				}
+				AddFunction(f ? f : std::make_shared<node::Integer>(1));
+			}
+
+			std::vector<unsigned> assignment, remaining(num_groups);
+			for (unsigned jj = 0; jj < num_groups; ++jj)
+				remaining[jj] = s.AffineVariableGroup(jj).size();
+			assignment_offsets_.push_back(0);
+			EnumerateAssignments(assignment, remaining, 1);
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+		}// linear product constructor
+
+
+
+		void LinearProduct::EnumerateAssignments(std::vector<unsigned> & assignment, std::vector<unsigned> & remaining, mpz_int const& num_points)
+		{
+			const auto ii = assignment.size();
+			if (ii==degrees_.size())
+			{
+				if (!IsAdmissible(assignment))
+					return;
+
+				assignments_.push_back(assignment);
+				assignment_offsets_.push_back(assignment_offsets_.back() + num_points);
+				return;
+			}
+
+			for (unsigned jj = 0; jj < remaining.size(); ++jj)
+			{
+				if (remaining[jj]==0 || degrees_[ii][jj]<=0)
+					continue;
+
+				assignment.push_back(jj);
+				--remaining[jj];
+				EnumerateAssignments(assignment, remaining, num_points * degrees_[ii][jj]);
+				++remaining[jj];
+				assignment.pop_back();
+			}
+		}
+
+
+
+		namespace {
+
+			// find a variable for function ii, reassigning those already matched if need be.  the augmenting path step of bipartite matching.
+			bool Augment(unsigned ii, std::vector<unsigned> const& functions, std::vector< std::vector<unsigned> > const& supports, std::vector<int> & matched_function, std::vector<bool> & visited)
+			{
+				for (auto v : supports[functions[ii]])
+				{
+					if (visited[v])
+						continue;
+					visited[v] = true;
+					if (matched_function[v] < 0 || Augment(matched_function[v], functions, supports, matched_function, visited))
+					{
+						matched_function[v] = ii;
+						return true;
+					}
+				}
+				return false;
+			}
+		}
+
+
+
+		bool LinearProduct::IsAdmissible(std::vector<unsigned> const& assignment) const
+		{
+			for (unsigned jj = 0; jj < NumVariableGroups(); ++jj)
+			{
+				std::vector<unsigned> functions;
+				std::vector< std::vector<unsigned> > supports(degrees_.size());
+				for (unsigned ii = 0; ii < assignment.size(); ++ii)
+					if (assignment[ii]==jj)
+					{
+						functions.push_back(ii);
+						supports[ii] = supports_[ii][jj];
+					}
+
+				std::vector<int> matched_function(AffineVariableGroup(jj).size(), -1);
+				for (unsigned ii = 0; ii < functions.size(); ++ii)
+				{
+					std::vector<bool> visited(matched_function.size(), false);
+					if (!Augment(ii, functions, supports, matched_function, visited))
+						return false;
+				}
+			}
+			return true;
+		}
+
+
+
+		mpz_int LinearProduct::NumStartPoints() const
+		{
+			return assignment_offsets_.empty() ? mpz_int(0) : assignment_offsets_.back();
+		}
+
+
+
+		template<typename T>
+		Vec<T> LinearProduct::GenerateStartPoint(mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in LinearProduct::GenerateStartPoint, index exceeds the number of start points");
+
+			// the assignment, and which of the chosen linear factors each function takes
+			auto a = std::upper_bound(assignment_offsets_.begin(), assignment_offsets_.end(), index) - assignment_offsets_.begin() - 1;
+			auto const& assignment = assignments_[a];
+
+			std::vector<mpz_int> num_factors;
+			for (size_t ii = 0; ii < assignment.size(); ++ii)
+				num_factors.push_back(degrees_[ii][assignment[ii]]);
+			auto factors = IndexToSubscript(mpz_int(index - assignment_offsets_[a]), num_factors);
+
+			const bool is_homogenized = NumHomVariables() > 0;
+			Vec<T> start_point(NumVariables());
+			unsigned offset = 0;
+			for (unsigned jj = 0; jj < NumVariableGroups(); ++jj)
+			{
+				const auto group_size = AffineVariableGroup(jj).size();
+
+				Mat<T> A = Mat<T>::Zero(group_size, group_size);
+				Vec<T> b(group_size);
+				unsigned row = 0;
+				for (size_t ii = 0; ii < assignment.size(); ++ii)
+				{
+					if (assignment[ii]!=jj)
+						continue;
+
+					auto const& support = supports_[ii][jj];
+					auto const& factor = linear_factors_[ii][jj][static_cast<unsigned>(factors[ii])];
+					for (unsigned kk = 0; kk < support.size(); ++kk)
+						A(row,support[kk]) = factor[kk]->Eval<T>();
+					b(row) = -factor.back()->Eval<T>();
+					++row;
+				}
+
+				if (is_homogenized)
+					start_point(offset++) = T(1);
+				start_point.segment(offset, group_size) = A.lu().solve(b);
+				offset += group_size;
+			}
+
+			if (IsPatched())
+				RescalePointToFitPatchInPlace(start_point);
+
+			return start_point;
+		}
+
+
+
+		Vec<dbl> LinearProduct::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			return GenerateStartPoint<dbl>(index);
+		}
+
+
+		Vec<mpfr> LinearProduct::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			return GenerateStartPoint<mpfr>(index);
+		}
+
+
+
+		namespace {
+
+			// the product of the powers of the variables, or null for the origin
+			std::shared_ptr<node::Node> Monomial(VariableGroup const& vars, std::vector<unsigned> const& exponents)
+			{
+				std::shared_ptr<node::Node> m;
+				for (unsigned jj = 0; jj < exponents.size(); ++jj)
+				{
+					if (exponents[jj]==0)
+						continue;
+					std::shared_ptr<node::Node> p = exponents[jj]==1 ? std::shared_ptr<node::Node>(vars[jj]) : pow(vars[jj], static_cast<int>(exponents[jj]));
+					m = m ? m*p : p;
+				}
+				return m;
+			}
+		}
+
+
+
+		// constructor for Polyhedral start system, from any other *suitable* system.
+		Polyhedral::Polyhedral(System const& s, unsigned num_threads)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumHomVariables() > 0)
+				throw std::runtime_error("attempting to construct polyhedral start system from homogenized target system.  currently unallowed");
+
+			if (s.NumFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct polyhedral start system, but target system has path varible declared already");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-polynomial target system");
+
+			CopyVariableStructure(s);
+			auto const& vars = s.Variables();
+			const auto num_functions = s.NumFunctions();
+
+			node::SparsePolynomials expansion;
+			expansion.SetInputs(std::vector< std::shared_ptr<node::Variable> >(vars.begin(), vars.end()));
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+				expansion.AddOutput(s.Function(ii));
+
+			supports_.resize(num_functions);
+			coefficients_.resize(num_functions);
+			liftings_.resize(num_functions);
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+			{
+				supports_[ii] = expansion.Exponents(ii);
+
+				// the origin makes the mixed volume bound the solutions with zero coordinates, too
+				std::vector<unsigned> origin(vars.size(), 0);
+				if (std::find(supports_[ii].begin(), supports_[ii].end(), origin)==supports_[ii].end())
+					supports_[ii].push_back(origin);
+
+				std::shared_ptr<node::Node> f;
+				for (const auto& a : supports_[ii])
+				{
+					coefficients_[ii].push_back(std::make_shared<node::Rational>(node::Rational::Rand()));
+					liftings_[ii].push_back(RandomRat().convert_to<double>());
+
+					auto m = Monomial(vars, a);
+					std::shared_ptr<node::Node> term = m ? coefficients_[ii].back()*m : coefficients_[ii].back();
+					f = f ? f+term : term;
+				}
+				AddFunction(f);
+			}
+
+			cells_ = detail::MixedCells(supports_, liftings_, num_threads);
+		}// polyhedral constructor
+
+
+
+		System Polyhedral::CellHomotopy(unsigned cell, Var const& t) const
+		{
+			auto const& c = cells_[cell];
+			auto const& vars = Variables();
+
+			// the power of t of each monomial, zero on the edges of the cell
+			std::vector< std::vector<double> > powers(supports_.size());
+			double least_power = 0;
+			for (unsigned ii = 0; ii < supports_.size(); ++ii)
+			{
+				auto lifted = [&](unsigned a)
+					{
+						double v = liftings_[ii][a];
+						for (unsigned jj = 0; jj < vars.size(); ++jj)
+							v += supports_[ii][a][jj] * c.inner_normal[jj];
+						return v;
+					};
+
+				const double lowest = lifted(c.edges[ii].first);
+				for (unsigned a = 0; a < supports_[ii].size(); ++a)
+				{
+					bool on_edge = a==c.edges[ii].first || a==c.edges[ii].second;
+					powers[ii].push_back(on_edge ? 0 : std::max(lifted(a) - lowest, 0.));
+					if (powers[ii].back() > 0 && (least_power==0 || powers[ii].back() < least_power))
+						least_power = powers[ii].back();
+				}
+			}
+
+			System h;
+			h.CopyVariableStructure(*this);
+			h.AddPathVariable(t);
+			for (unsigned ii = 0; ii < supports_.size(); ++ii)
+			{
+				std::shared_ptr<node::Node> f;
+				for (unsigned a = 0; a < supports_[ii].size(); ++a)
+				{
+					auto m = Monomial(vars, supports_[ii][a]);
+					std::shared_ptr<node::Node> term = m ? coefficients_[ii][a]*m : coefficients_[ii][a];
+
+					if (powers[ii][a] > 0)
+					{
+						double scaled = powers[ii][a] / least_power;
+						term = term * (std::abs(scaled-1) < 1e-12 ? std::shared_ptr<node::Node>(t) : pow(t, mpfr_float(scaled)));
+					}
+					f = f ? f+term : term;
+				}
+				h.AddFunction(f);
+			}
+			return h;
+		}
+
+
+
+		void Polyhedral::AddStartPoint(Vec<dbl> const& x)
+		{
+			Vec<mpfr> y(x.size());
+			for (int ii = 0; ii < x.size(); ++ii)
+				y(ii) = mpfr(x(ii).real(), x(ii).imag());
+			start_points_.push_back(y);
+		}
+
+
+		void Polyhedral::AddStartPoint(Vec<mpfr> const& x)
+		{
+			start_points_.push_back(x);
+		}
+
+
+
+		Vec<dbl> Polyhedral::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in Polyhedral::GenerateStartPoint, index exceeds the number of start points found");
+
+			auto const& x = start_points_[static_cast<size_t>(index)];
+			Vec<dbl> start_point(x.size());
+			for (int ii = 0; ii < x.size(); ++ii)
+				start_point(ii) = dbl(x(ii).real().convert_to<double>(), x(ii).imag().convert_to<double>());
+			return start_point;
+		}
+
+
+		Vec<mpfr> Polyhedral::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in Polyhedral::GenerateStartPoint, index exceeds the number of start points found");
+
+			Vec<mpfr> start_point = start_points_[static_cast<size_t>(index)];
+			using bertini::Precision;
+			Precision(start_point, DefaultPrecision());
+			return start_point;
+		}
+
+
+
+		User::User(System const& s)
+		{
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct user start system, but the system has a path variable declared already");
+
+			System::operator=(s);
+		}
+
+
+		void User::AddStartPoint(Vec<dbl> const& x)
+		{
+			Vec<mpfr> y(x.size());
+			for (int ii = 0; ii < x.size(); ++ii)
+				y(ii) = mpfr(x(ii).real(), x(ii).imag());
+			start_points_.push_back(y);
+		}
+
+
+		void User::AddStartPoint(Vec<mpfr> const& x)
+		{
+			start_points_.push_back(x);
+		}
+
+
+		Vec<dbl> User::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in User::GenerateStartPoint, index exceeds the number of start points added");
+
+			auto const& x = start_points_[static_cast<size_t>(index)];
+			Vec<dbl> start_point(x.size());
+			for (int ii = 0; ii < x.size(); ++ii)
+				start_point(ii) = dbl(x(ii).real().convert_to<double>(), x(ii).imag().convert_to<double>());
+			return start_point;
+		}
+
+
+		Vec<mpfr> User::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in User::GenerateStartPoint, index exceeds the number of start points added");
+
+			Vec<mpfr> start_point = start_points_[static_cast<size_t>(index)];
+			using bertini::Precision;
+			Precision(start_point, DefaultPrecision());
+			return start_point;
+		}
+
+
+
 		inline
 		TotalDegree operator*(TotalDegree td, std::shared_ptr<node::Node> const& n)
 		{
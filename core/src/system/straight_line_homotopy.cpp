@@ -0,0 +1,73 @@
+//This file is part of Bertini 2.
+//
+//straight_line_homotopy.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_homotopy.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_homotopy.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "straight_line_homotopy.hpp"
+
+
+namespace bertini {
+
+	StraightLineHomotopy::StraightLineHomotopy(System const& target, System const& start, bool use_gamma_trick)
+	{
+		if (target.HavePathVariable() || start.HavePathVariable())
+			throw std::runtime_error("attempting to construct straight line homotopy, but a system has a path variable declared already");
+
+		if (target.NumImplicitParameters() > 0 || start.NumImplicitParameters() > 0)
+			throw std::runtime_error("attempting to construct straight line homotopy, but a system has implicit parameters, and gamma is the implicit parameter of the homotopy");
+
+		if (target.NumVariables() != start.NumVariables() || target.NumTotalFunctions() != start.NumTotalFunctions())
+			throw std::runtime_error("target and start systems of a straight line homotopy must have the same numbers of variables and functions");
+
+		target_ = target.Clone();
+		start_ = start.Clone();
+		if (auto start_system = dynamic_cast<start_system::StartSystem const*>(&start))
+			start_closed_form_ = start_system->ClosedForm();
+
+		auto t = std::make_shared<node::Variable>("t");
+		gamma_variable_ = std::make_shared<node::Variable>("gamma");
+
+		std::shared_ptr<node::Node> gamma_t = gamma_variable_*t;
+		homotopy_ = (1-t)*target + gamma_t*start;
+		homotopy_.AddImplicitParameter(gamma_variable_);
+		homotopy_.AddPathVariable(t);
+
+		SetGamma(use_gamma_trick ? RandomUnit<mpfr>() : mpfr(1));
+	}
+
+
+
+	void StraightLineHomotopy::SetGamma(mpfr const& gamma)
+	{
+		std::get<mpfr>(gamma_) = gamma;
+		std::get<dbl>(gamma_) = dbl(gamma);
+
+		Vec<mpfr> gamma_mpfr(1);
+		gamma_mpfr(0) = gamma;
+		homotopy_.SetImplicitParameters(gamma_mpfr);
+
+		Vec<dbl> gamma_dbl(1);
+		gamma_dbl(0) = std::get<dbl>(gamma_);
+		homotopy_.SetImplicitParameters(gamma_dbl);
+	}
+
+} // namespace bertini
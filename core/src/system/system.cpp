@@ -25,6 +25,14 @@
 
 #include "system.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
 
@@ -35,6 +43,31 @@ BOOST_CLASS_EXPORT(bertini::System)
 namespace bertini 
 {
 
+	System System::Clone() const
+	{
+		std::stringstream buffer;
+		{
+			boost::archive::binary_oarchive oa(buffer);
+			oa << *this;
+		}
+
+		System clone;
+		{
+			boost::archive::binary_iarchive ia(buffer);
+			ia >> clone;
+		}
+
+		// the evaluation modes are not serialized
+		clone.use_compiled_evaluation_ = use_compiled_evaluation_;
+		clone.use_polynomial_evaluation_ = use_polynomial_evaluation_;
+		clone.use_native_evaluation_ = use_native_evaluation_;
+		clone.native_cache_directory_ = native_cache_directory_;
+		if (compensated_summation_)
+			clone.CompensatedSummation(true);
+		return clone;
+	}
+
+
 	void swap(System & a, System & b)
 	{
 		using std::swap;
@@ -51,6 +84,7 @@ namespace bertini
 
 		swap(a.have_ordering_,b.have_ordering_);
 		swap(a.variable_ordering_,b.variable_ordering_);
+		swap(a.variable_nodes_,b.variable_nodes_);
 
 		swap(a.implicit_parameters_,b.implicit_parameters_);
 		swap(a.explicit_parameters_,b.explicit_parameters_);
@@ -61,10 +95,38 @@ namespace bertini
 
 		swap(a.is_differentiated_,b.is_differentiated_);
 		swap(a.jacobian_,b.jacobian_);
+		swap(a.cse_statistics_,b.cse_statistics_);
+		swap(a.jacobian_structure_,b.jacobian_structure_);
 
 		swap(a.precision_,b.precision_);
 		swap(a.is_patched_,b.is_patched_);
 		swap(a.patch_,b.patch_);
+
+		swap(a.use_compiled_evaluation_,b.use_compiled_evaluation_);
+		swap(a.use_native_evaluation_,b.use_native_evaluation_);
+		swap(a.native_cache_directory_,b.native_cache_directory_);
+		swap(a.evaluation_team_,b.evaluation_team_);
+		swap(a.is_compiled_,b.is_compiled_);
+		swap(a.have_dependencies_,b.have_dependencies_);
+		swap(a.space_dependent_nodes_,b.space_dependent_nodes_);
+		swap(a.time_dependent_nodes_,b.time_dependent_nodes_);
+		swap(a.have_precision_nodes_,b.have_precision_nodes_);
+		swap(a.precision_nodes_,b.precision_nodes_);
+		swap(a.have_bounds_,b.have_bounds_);
+		swap(a.degrees_,b.degrees_);
+		swap(a.coefficient_bound_,b.coefficient_bound_);
+		swap(a.coefficient_bound_evaluations_,b.coefficient_bound_evaluations_);
+		swap(a.have_path_terms_,b.have_path_terms_);
+		swap(a.path_terms_,b.path_terms_);
+		swap(a.has_path_terms_,b.has_path_terms_);
+		swap(a.compiled_functions_,b.compiled_functions_);
+		swap(a.compiled_variable_registers_,b.compiled_variable_registers_);
+		swap(a.compiled_path_variable_register_,b.compiled_path_variable_register_);
+		swap(a.use_polynomial_evaluation_,b.use_polynomial_evaluation_);
+		swap(a.compensated_summation_,b.compensated_summation_);
+		swap(a.is_expanded_,b.is_expanded_);
+		swap(a.is_expandable_,b.is_expandable_);
+		swap(a.polynomial_functions_,b.polynomial_functions_);
 	}
 
 	// the copy constructor
@@ -83,6 +145,7 @@ namespace bertini
 
 		jacobian_ = other.jacobian_;
 		is_differentiated_ = other.is_differentiated_;
+		cse_statistics_ = other.cse_statistics_;
 
 
 		time_order_of_variable_groups_ = other.time_order_of_variable_groups_;
@@ -90,10 +153,17 @@ namespace bertini
 		current_variable_values_ = other.current_variable_values_;
 
 		variable_ordering_ = other.variable_ordering_;
+		BindVariables();
 		have_ordering_ =  other.have_ordering_;
 
 		precision_ = other.precision_;
 
+		use_compiled_evaluation_ = other.use_compiled_evaluation_;
+		use_native_evaluation_ = other.use_native_evaluation_;
+		native_cache_directory_ = other.native_cache_directory_;
+		use_polynomial_evaluation_ = other.use_polynomial_evaluation_;
+		compensated_summation_ = other.compensated_summation_;
+
 		// now to do the members which are not simply copied
 		constant_subfunctions_.resize(other.constant_subfunctions_.size());
 		for (unsigned ii = 0; ii < constant_subfunctions_.size(); ++ii)
@@ -202,69 +272,631 @@ namespace bertini
 
 	void System::precision(unsigned new_precision) const
 	{
-		for (const auto& iter : functions_) {
-			iter->precision(new_precision);
+		if (!have_precision_nodes_)
+			ComputePrecisionNodes();
+
+		for (const auto& iter : precision_nodes_)
+			iter->OwnPrecision(new_precision);
+
+		using bertini::Precision;
+		Precision(std::get<Vec<mpfr> >(current_variable_values_),new_precision);
+
+		if (IsPatched())
+			patch_.Precision(new_precision);
+
+		if (is_compiled_)
+			compiled_functions_.precision(new_precision);
+
+		if (is_expanded_ && is_expandable_)
+			polynomial_functions_.precision(new_precision);
+
+		// values stored at the old precision must not survive the change, constant or not.
+		for (const auto& iter : functions_)
+			iter->Reset();
+
+		precision_ = new_precision;
+	}
+
+
+	void System::Differentiate() const
+	{
+			auto num_functions = NumFunctions();
+			std::vector<Nd> derivatives(num_functions);
+
+			// each thread differentiates a block of functions, sharing the derivative of each node among its uses in the block.  only reading the functions, the threads need no locking.
+			std::exception_ptr error;
+			std::mutex error_mutex;
+			auto differentiate = [this, &derivatives, &error, &error_mutex](unsigned first, unsigned last, unsigned precision)
+				{
+					try
+					{
+						DefaultPrecision(precision);
+						node::DifferentiationMemo memo;
+						for (unsigned ii = first; ii < last; ++ii)
+							derivatives[ii] = node::DerivativeOf(functions_[ii]);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(error_mutex);
+						error = std::current_exception();
+					}
+				};
+
+			unsigned num_threads = 1;
+		#ifdef USE_THREAD_LOCAL
+			// the memos are per thread, so threads are worth it only for many functions
+			const unsigned min_functions_per_thread = 64;
+			num_threads = std::max(1u, std::min(std::thread::hardware_concurrency(), static_cast<unsigned>(num_functions / min_functions_per_thread)));
+		#endif
+
+			std::vector<std::thread> threads;
+			auto block = (num_functions + num_threads - 1) / num_threads;
+			for (unsigned tt = 1; tt < num_threads; ++tt)
+				threads.emplace_back(differentiate, std::min<unsigned>(tt*block, num_functions), std::min<unsigned>((tt+1)*block, num_functions), DefaultPrecision());
+			differentiate(0, std::min<unsigned>(block, num_functions), DefaultPrecision());
+			for (auto& t : threads)
+				t.join();
+			if (error)
+				std::rethrow_exception(error);
+
+			// simplification rewrites shared nodes in place, so is done by one thread.
+			jacobian_.resize(num_functions);
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+				jacobian_[ii] = std::make_shared<bertini::node::Jacobian>(node::Simplify(derivatives[ii]));
+			if (compensated_summation_)
+				ApplyCompensatedSummation(node::UniqueNodes(std::vector<Nd>(jacobian_.begin(), jacobian_.end())));
+
+			is_differentiated_ = true;
+			have_precision_nodes_ = false;
+
+			// the product rule in particular repeats factors many times over.
+			MergeCommonSubexpressions();
+
+			ComputeJacobianStructure();
+		}
+
+
+
+	void System::MergeCommonSubexpressions() const
+	{
+		std::vector<Nd> roots(functions_.begin(), functions_.end());
+		if (is_differentiated_)
+			for (const auto& iter : jacobian_)
+				if (iter)
+					roots.push_back(iter);
+
+		cse_statistics_ = node::EliminateCommonSubexpressions(roots);
+
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_precision_nodes_ = false;
+	}
+
+
+
+	MemoryReport System::MemoryUsage() const
+	{
+		using memory::HeapBytes;
+
+		MemoryReport report;
+		std::unordered_set<node::Node const*> counted;
+
+		std::vector<Nd> roots(functions_.begin(), functions_.end());
+		roots.insert(roots.end(), subfunctions_.begin(), subfunctions_.end());
+		roots.insert(roots.end(), explicit_parameters_.begin(), explicit_parameters_.end());
+		roots.insert(roots.end(), constant_subfunctions_.begin(), constant_subfunctions_.end());
+		report.Add("function trees", node::TreeMemoryBytes(roots, counted));
+
+		std::vector<Nd> derivatives;
+		for (const auto& iter : jacobian_)
+			if (iter)
+				derivatives.push_back(iter);
+		report.Add("jacobian trees", node::TreeMemoryBytes(derivatives, counted));
+
+		report.Add("compiled evaluation", is_compiled_ ? compiled_functions_.MemoryBytes() : 0);
+		report.Add("polynomial evaluation", is_expanded_ && is_expandable_ ? polynomial_functions_.MemoryBytes() : 0);
+
+		report.Add("workspace", sizeof(System) + HeapBytes(current_variable_values_)
+		                        + (space_dependent_nodes_.capacity() + time_dependent_nodes_.capacity())*sizeof(Nd)
+		                        + jacobian_.capacity()*sizeof(Jac) + HeapBytes(jacobian_structure_)
+		                        + HeapBytes(compiled_variable_registers_));
+		return report;
+	}
+
+
+
+	void System::Compile() const
+	{
+		compiled_functions_.Clear();
+		compiled_functions_.precision(precision_);
+
+		for (const auto& iter : functions_)
+			compiled_functions_.AddOutput(iter);
+
+		const auto& vars = Variables();
+		compiled_variable_registers_.resize(vars.size());
+		for (unsigned ii = 0; ii < vars.size(); ++ii)
+			compiled_variable_registers_[ii] = compiled_functions_.RegisterOf(vars[ii]);
+
+		compiled_path_variable_register_ = have_path_variable_ ? compiled_functions_.RegisterOf(path_variable_) : -1;
+
+		if (use_native_evaluation_)
+			compiled_functions_.SetNative(node::NativeProgram::Build(compiled_functions_, native_cache_directory_));
+
+		is_compiled_ = true;
+	}
+
+
+
+	void System::ExpandPolynomials() const
+	{
+		polynomial_functions_.Clear();
+		polynomial_functions_.precision(precision_);
+
+		const auto& vars = Variables();
+		std::vector< std::shared_ptr<node::Variable> > inputs(vars.begin(), vars.end());
+		if (have_path_variable_)
+			inputs.push_back(path_variable_);
+		polynomial_functions_.SetInputs(inputs);
+
+		try
+		{
+			for (const auto& iter : functions_)
+				polynomial_functions_.AddOutput(iter);
+			is_expandable_ = true;
+		}
+		catch (std::runtime_error const&)
+		{
+			polynomial_functions_.Clear();
+			is_expandable_ = false;
+		}
+
+		is_expanded_ = true;
+	}
+
+
+
+	void System::PrepareBatch(Mat<dbl> const& X) const
+	{
+		if (X.rows()!=NumVariables())
+		{
+			std::stringstream ss;
+			ss << "trying to evaluate system at a batch of points, but number of input variables (" << X.rows() << ") doesn't match number of system variables (" << NumVariables() << ").";
+			throw std::runtime_error(ss.str());
+		}
+
+		if (!is_compiled_)
+			Compile();
+
+		compiled_functions_.BeginBatch(X.cols());
+		for (unsigned jj = 0; jj < NumVariables(); ++jj)
+			if (compiled_variable_registers_[jj] >= 0)
+				for (unsigned kk = 0; kk < X.cols(); ++kk)
+					compiled_functions_.SetBatchInput(compiled_variable_registers_[jj], kk, X(jj,kk));
+
+		compiled_functions_.EvalBatch();
+	}
+
+
+
+	void System::BatchFunctions(Mat<dbl> const& X, Mat<dbl> & F) const
+	{
+		F.resize(NumTotalFunctions(), X.cols());
+		for (unsigned kk = 0; kk < X.cols(); ++kk)
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				F(ii,kk) = compiled_functions_.BatchOutput(ii,kk);
+
+		if (IsPatched())
+			patch_.EvalBatchInPlace(F, X);
+	}
+
+
+
+	void System::BatchDerivatives(Mat<dbl> const& X, std::vector< Mat<dbl> > & J, Mat<dbl> * ds_dt) const
+	{
+		J.resize(X.cols());
+		for (auto& iter : J)
+			iter.resize(NumTotalFunctions(), NumVariables());
+
+		if (ds_dt)
+			ds_dt->setZero(NumTotalFunctions(), X.cols());
+
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+		{
+			compiled_functions_.ReverseSweepBatch(ii);
+			for (unsigned jj = 0; jj < NumVariables(); ++jj)
+			{
+				auto reg = compiled_variable_registers_[jj];
+				for (unsigned kk = 0; kk < X.cols(); ++kk)
+					J[kk](ii,jj) = reg < 0 ? dbl(0) : compiled_functions_.BatchAdjoint(reg, kk);
+			}
+
+			if (ds_dt && compiled_path_variable_register_ >= 0)
+				for (unsigned kk = 0; kk < X.cols(); ++kk)
+					(*ds_dt)(ii,kk) = compiled_functions_.BatchAdjoint(compiled_path_variable_register_, kk);
+		}
+
+		if (IsPatched())
+			for (auto& iter : J)
+				patch_.JacobianInPlace(iter);
+	}
+
+
+
+	void System::EvalBatch(Mat<dbl> const& X, Mat<dbl> & F) const
+	{
+		PrepareBatch(X);
+		BatchFunctions(X, F);
+	}
+
+
+
+	void System::EvalBatch(Mat<dbl> const& X, dbl const& path_variable_value, Mat<dbl> & F) const
+	{
+		if (!have_path_variable_)
+			throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+		SetPathVariable(path_variable_value);
+		EvalBatch(X, F);
+	}
+
+
+
+	void System::JacobianBatch(Mat<dbl> const& X, std::vector< Mat<dbl> > & J) const
+	{
+		PrepareBatch(X);
+		BatchDerivatives(X, J, nullptr);
+	}
+
+
+
+	void System::JacobianBatch(Mat<dbl> const& X, dbl const& path_variable_value, std::vector< Mat<dbl> > & J) const
+	{
+		if (!have_path_variable_)
+			throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+		SetPathVariable(path_variable_value);
+		JacobianBatch(X, J);
+	}
+
+
+
+	void System::EvalJacobianAndTimeDerivativeBatch(Mat<dbl> const& X, dbl const& path_variable_value, Mat<dbl> & F, std::vector< Mat<dbl> > & J, Mat<dbl> & ds_dt) const
+	{
+		if (!have_path_variable_)
+			throw std::runtime_error("computing time derivative of system with no path variable defined");
+
+		SetPathVariable(path_variable_value);
+		PrepareBatch(X);
+		BatchFunctions(X, F);
+		BatchDerivatives(X, J, &ds_dt);
+	}
+
+
+
+	namespace {
+
+		enum : unsigned char
+		{
+			DependsOnSpace = 1,
+			DependsOnTime = 2
+		};
+
+		using Nd = std::shared_ptr<node::Node>;
+
+		// classify a node by the union of the dependencies of its children, recording each distinct operator or function node once.
+		unsigned char ClassifyDependencies(Nd const& n, std::shared_ptr<node::Variable> const& path_variable, std::unordered_map<node::Node const*, unsigned char> & classified, std::vector<Nd> & space_dependent, std::vector<Nd> & time_dependent)
+		{
+			auto found = classified.find(n.get());
+			if (found!=classified.end())
+				return found->second;
+
+			unsigned char dependencies = 0;
+
+			if (auto v = std::dynamic_pointer_cast<node::Variable>(n))
+			{
+				// variables are invalidated by set_current_value, so are not recorded
+				dependencies = (v==path_variable) ? DependsOnTime : DependsOnSpace;
+				classified[n.get()] = dependencies;
+				return dependencies;
+			}
+			else if (auto f = std::dynamic_pointer_cast<node::Function>(n))
+			{
+				if (f->entry_node())
+					dependencies = ClassifyDependencies(f->entry_node(), path_variable, classified, space_dependent, time_dependent);
+			}
+			else if (auto u = std::dynamic_pointer_cast<node::UnaryOperator>(n))
+				dependencies = ClassifyDependencies(u->first_child(), path_variable, classified, space_dependent, time_dependent);
+			else if (auto o = std::dynamic_pointer_cast<node::NaryOperator>(n))
+			{
+				for (const auto& iter : o->children())
+					dependencies |= ClassifyDependencies(iter, path_variable, classified, space_dependent, time_dependent);
+			}
+			else if (auto p = std::dynamic_pointer_cast<node::PowerOperator>(n))
+				dependencies = ClassifyDependencies(p->base(), path_variable, classified, space_dependent, time_dependent)
+				             | ClassifyDependencies(p->exponent(), path_variable, classified, space_dependent, time_dependent);
+			// everything else -- numbers, special numbers, differentials -- is constant
+
+			classified[n.get()] = dependencies;
+
+			if (dependencies & DependsOnSpace)
+				space_dependent.push_back(n);
+			if (dependencies & DependsOnTime)
+				time_dependent.push_back(n);
+
+			return dependencies;
+		}
+	}
+
+
+
+	namespace {
+
+		// record the column of each variable appearing below n, visiting each distinct node once.
+		void CollectVariableColumns(Nd const& n, std::unordered_map<node::Node const*, unsigned> const& columns, std::unordered_set<node::Node const*> & visited, std::vector<unsigned> & found)
+		{
+			if (!visited.insert(n.get()).second)
+				return;
+
+			if (std::dynamic_pointer_cast<node::Variable>(n))
+			{
+				auto column = columns.find(n.get());
+				if (column!=columns.end()) // the path variable has no column
+					found.push_back(column->second);
+			}
+			else if (auto f = std::dynamic_pointer_cast<node::Function>(n))
+			{
+				if (f->entry_node())
+					CollectVariableColumns(f->entry_node(), columns, visited, found);
+			}
+			else if (auto u = std::dynamic_pointer_cast<node::UnaryOperator>(n))
+				CollectVariableColumns(u->first_child(), columns, visited, found);
+			else if (auto o = std::dynamic_pointer_cast<node::NaryOperator>(n))
+			{
+				for (const auto& iter : o->children())
+					CollectVariableColumns(iter, columns, visited, found);
+			}
+			else if (auto p = std::dynamic_pointer_cast<node::PowerOperator>(n))
+			{
+				CollectVariableColumns(p->base(), columns, visited, found);
+				CollectVariableColumns(p->exponent(), columns, visited, found);
+			}
 		}
+	}
+
+
+
+	void System::ComputeJacobianStructure() const
+	{
+		const auto& vars = Variables();
+		std::unordered_map<node::Node const*, unsigned> columns;
+		for (unsigned jj = 0; jj < vars.size(); ++jj)
+			columns[vars[jj].get()] = jj;
 
-		for (const auto& iter : subfunctions_) {
-			iter->precision(new_precision);
+		jacobian_structure_.assign(NumFunctions(), std::vector<unsigned>());
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+		{
+			std::unordered_set<node::Node const*> visited;
+			CollectVariableColumns(functions_[ii], columns, visited, jacobian_structure_[ii]);
+			std::sort(jacobian_structure_[ii].begin(), jacobian_structure_[ii].end());
 		}
+	}
+
+
+
+	void System::ClearJacobian() const
+	{
+		jacobian_.assign(NumFunctions(), Jac());
+		ComputeJacobianStructure();
+		is_differentiated_ = true;
+		have_precision_nodes_ = false;
+	}
+
 
-		for (const auto& iter : explicit_parameters_) {
-			iter->precision(new_precision);
+
+	void System::DifferentiateFunction(unsigned ii) const
+	{
+		Nd derivative;
+		{
+			node::DifferentiationMemo memo;
+			derivative = node::DerivativeOf(functions_[ii]);
 		}
+		jacobian_[ii] = std::make_shared<node::Jacobian>(node::Simplify(derivative));
+		jacobian_[ii]->precision(precision_);
+		jacobian_[ii]->DifferentialNodes(node::MarkDifferentialDependence(jacobian_[ii]));
+		if (compensated_summation_)
+			ApplyCompensatedSummation(node::UniqueNodes({jacobian_[ii]}));
+		have_precision_nodes_ = false;
+	}
+
 
 
-		for (const auto& iter :implicit_parameters_) {
-			iter->precision(new_precision);
+	void System::ComputeDependencies() const
+	{
+		space_dependent_nodes_.clear();
+		time_dependent_nodes_.clear();
+
+		std::unordered_map<node::Node const*, unsigned char> classified;
+		for (const auto& iter : functions_)
+		{
+			ClassifyDependencies(iter, path_variable_, classified, space_dependent_nodes_, time_dependent_nodes_);
+			iter->Reset();
 		}
 
-		for (const auto& iter : constant_subfunctions_) {
-			iter->precision(new_precision);
+		have_dependencies_ = true;
+		have_path_terms_ = false;
+	}
+
+
+
+	void System::ComputePathTerms() const
+	{
+		path_terms_.assign(NumFunctions(), std::vector<PathTerm>());
+		has_path_terms_.assign(NumFunctions(), false);
+
+		std::unordered_map<node::Node const*, unsigned char> classified;
+		std::vector<Nd> space_dependent, time_dependent;
+		auto dependencies = [&](Nd const& n)
+			{
+				return ClassifyDependencies(n, path_variable_, classified, space_dependent, time_dependent);
+			};
+		auto derivative = [this](Nd const& n)
+			{
+				auto d = std::make_shared<node::Jacobian>(node::Simplify(n->Differentiate()));
+				d->precision(precision_);
+				return d;
+			};
+
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+		{
+			auto entry = functions_[ii]->entry_node();
+			if (!entry)
+				continue;
+
+			std::vector<Nd> terms{entry};
+			std::vector<bool> signs{true};
+			if (auto sum = std::dynamic_pointer_cast<node::SumOperator>(entry))
+			{
+				terms = sum->children();
+				signs = sum->children_sign();
+			}
+
+			bool qualifies = true;
+			for (unsigned jj = 0; jj < terms.size() && qualifies; ++jj)
+			{
+				auto d = dependencies(terms[jj]);
+				if (!(d & DependsOnTime))
+					continue;
+
+				if (!(d & DependsOnSpace))
+				{
+					path_terms_[ii].push_back(PathTerm{signs[jj], derivative(terms[jj]), {}, {}});
+					continue;
+				}
+
+				// a product of a coefficient in the path variable and factors free of it
+				auto product = std::dynamic_pointer_cast<node::MultOperator>(terms[jj]);
+				if (!product)
+				{
+					qualifies = false;
+					break;
+				}
+
+				PathTerm term{signs[jj], nullptr, {}, {}};
+				for (unsigned kk = 0; kk < product->children().size(); ++kk)
+				{
+					const auto& factor = product->children()[kk];
+					auto multiply = product->children_mult_or_div()[kk];
+					auto f = dependencies(factor);
+					if (!(f & DependsOnTime))
+					{
+						term.factors.push_back(factor);
+						term.multiply.push_back(multiply);
+					}
+					else if (!(f & DependsOnSpace) && multiply && !term.coefficient_derivative)
+						term.coefficient_derivative = derivative(factor);
+					else
+						qualifies = false;
+				}
+
+				if (qualifies)
+					path_terms_[ii].push_back(std::move(term));
+			}
+
+			has_path_terms_[ii] = qualifies;
+			if (!qualifies)
+				path_terms_[ii].clear();
 		}
 
+		have_path_terms_ = true;
+		have_precision_nodes_ = false;
+	}
+
+
+
+	void System::ComputePrecisionNodes() const
+	{
+		std::vector<Nd> roots(functions_.begin(), functions_.end());
+		roots.insert(roots.end(), subfunctions_.begin(), subfunctions_.end());
+		roots.insert(roots.end(), explicit_parameters_.begin(), explicit_parameters_.end());
+		roots.insert(roots.end(), implicit_parameters_.begin(), implicit_parameters_.end());
+		roots.insert(roots.end(), constant_subfunctions_.begin(), constant_subfunctions_.end());
+
 		if (is_differentiated_)
 			for (const auto& iter : jacobian_)
-				iter->precision(new_precision);
+				if (iter)
+					roots.push_back(iter);
+
+		if (have_path_terms_)
+			for (const auto& iter : path_terms_)
+				for (const auto& jter : iter)
+					roots.push_back(jter.coefficient_derivative);
 
 		if (have_path_variable_)
-			path_variable_->precision(new_precision);
+			roots.push_back(path_variable_);
 
+		roots.insert(roots.end(), homogenizing_variables_.begin(), homogenizing_variables_.end());
+		for (const auto& iter : variable_groups_)
+			roots.insert(roots.end(), iter.begin(), iter.end());
+		for (const auto& iter : hom_variable_groups_)
+			roots.insert(roots.end(), iter.begin(), iter.end());
+		roots.insert(roots.end(), ungrouped_variables_.begin(), ungrouped_variables_.end());
 
-		for (const auto& iter : homogenizing_variables_)
-			iter->precision(new_precision);
+		precision_nodes_ = node::UniqueNodes(roots);
+		have_precision_nodes_ = true;
 
-		for (const auto& iter : variable_groups_)
-			for (const auto& jter : iter)
-				jter->precision(new_precision);
+		ApplyCompensatedSummation(precision_nodes_);
+	}
 
-		for (const auto& iter : hom_variable_groups_)
-			for (const auto& jter : iter)
-				jter->precision(new_precision);
 
-		for (const auto& iter : ungrouped_variables_)
-			iter->precision(new_precision);
 
-		using bertini::Precision;
-		Precision(std::get<Vec<mpfr> >(current_variable_values_),new_precision);
+	void System::CompensatedSummation(bool use)
+	{
+		compensated_summation_ = use;
+		if (!have_precision_nodes_)
+			ComputePrecisionNodes();
+		else
+			ApplyCompensatedSummation(precision_nodes_);
+	}
 
-		if (IsPatched())
-			patch_.Precision(new_precision);
 
-		precision_ = new_precision;
+
+	void System::ApplyCompensatedSummation(std::vector<Nd> const& nodes) const
+	{
+		for (const auto& iter : nodes)
+			if (auto sum = std::dynamic_pointer_cast<node::SumOperator>(iter))
+				sum->CompensatedSummation(compensated_summation_);
 	}
 
 
-	void System::Differentiate() const
+
+	void System::InvalidateSpaceDependentNodes() const
 	{
-			jacobian_.resize(NumFunctions());
-			auto num_functions = NumFunctions();
-			for (int ii = 0; ii < num_functions; ++ii)
-				jacobian_[ii] = std::make_shared<bertini::node::Jacobian>(functions_[ii]->Differentiate());
+		if (!have_dependencies_)
+		{
+			ComputeDependencies();
+			return;
+		}
 
-			is_differentiated_ = true;
+		for (const auto& iter : space_dependent_nodes_)
+			iter->ResetStoredValues();
+	}
+
+
+
+	void System::InvalidateTimeDependentNodes() const
+	{
+		if (!have_dependencies_)
+		{
+			ComputeDependencies();
+			return;
 		}
 
+		for (const auto& iter : time_dependent_nodes_)
+			iter->ResetStoredValues();
+	}
+
 
 
 
@@ -298,39 +930,63 @@ namespace bertini
 			throw std::runtime_error("size mismatch on number of homogenizing variables and number of variable groups");
 
 		if (!already_had_homvars)
+		{
 			homogenizing_variables_.resize(NumVariableGroups());
+			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+			{
+				std::stringstream converter;
+				converter << "HOM_VAR_" << ii;
+				homogenizing_variables_[ii] = std::make_shared<bertini::node::Variable>(converter.str());
+			}
+		}
 
-
-		auto group_counter = 0;
-		for (auto curr_var_gp = variable_groups_.begin(); curr_var_gp!=variable_groups_.end(); curr_var_gp++)
+		// the expansion is homogenized in place, from the degrees of the trees before they are, so need not be expanded again.
+		if (is_expanded_ && is_expandable_)
 		{
-			std::stringstream converter;
-			converter << "HOM_VAR_" << group_counter;
+			auto ordering = VariableOrdering();
+			std::vector< std::shared_ptr<node::Variable> > inputs(ordering.begin(), ordering.end());
+			if (have_path_variable_)
+				inputs.push_back(path_variable_);
 
-			
+			try
+			{
+				polynomial_functions_.Homogenize(inputs, variable_groups_, homogenizing_variables_);
+			}
+			catch (std::runtime_error const&)
+			{
+				is_expanded_ = false;
+			}
+		}
+		else
+			is_expanded_ = false;
+
+		for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+		{
+			Var hom_var = homogenizing_variables_[ii];
 			if (already_had_homvars){
-				Var hom_var = homogenizing_variables_[group_counter];
-				VariableGroup temp_group = *curr_var_gp;
+				VariableGroup temp_group = variable_groups_[ii];
 				temp_group.push_front(hom_var);
 				for (const auto& curr_function : functions_)
 					curr_function->Homogenize(temp_group, hom_var);
 			}
 			else
-			{
-				Var hom_var = std::make_shared<bertini::node::Variable>(converter.str());
-				homogenizing_variables_[group_counter] = hom_var;
 				for (const auto& curr_function : functions_)
-					curr_function->Homogenize(*curr_var_gp, hom_var);
-			}
-		
-			
-
-			group_counter++;
+					curr_function->Homogenize(variable_groups_[ii], hom_var);
 		}
 
+		// homogenization multiplies terms by powers of the homogenizing variables, many of them zeroth or first powers.
+		for (const auto& curr_function : functions_)
+			node::Simplify(curr_function);
+
 		#ifndef BERTINI_DISABLE_ASSERTS
 		assert(homogenizing_variables_.size() == variable_groups_.size());
 		#endif
+
+		is_compiled_ = false;
+		have_ordering_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -420,6 +1076,11 @@ namespace bertini
 	{
 		variable_groups_.push_back(v);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Affine);
@@ -432,6 +1093,11 @@ namespace bertini
 	{
 		hom_variable_groups_.push_back(v);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Homogeneous);
@@ -445,6 +1111,11 @@ namespace bertini
 	{
 		ungrouped_variables_.push_back(v);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Ungrouped);
@@ -457,6 +1128,11 @@ namespace bertini
 	{
 		ungrouped_variables_.insert( ungrouped_variables_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		for (const auto& iter : v)
@@ -470,6 +1146,11 @@ namespace bertini
 	{
 		implicit_parameters_.push_back(v);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -479,6 +1160,11 @@ namespace bertini
 	{
 		implicit_parameters_.insert( implicit_parameters_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -493,6 +1179,11 @@ namespace bertini
 	{
 		explicit_parameters_.push_back(F);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -501,6 +1192,11 @@ namespace bertini
 	{
 		explicit_parameters_.insert( explicit_parameters_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -511,6 +1207,11 @@ namespace bertini
 	{
 		subfunctions_.push_back(F);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -519,6 +1220,11 @@ namespace bertini
 	{
 		subfunctions_.insert( subfunctions_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -529,6 +1235,11 @@ namespace bertini
 	{
 		functions_.push_back(F);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -538,6 +1249,11 @@ namespace bertini
 		Fn F = std::make_shared<node::Function>(N);
 		functions_.push_back(F);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -546,6 +1262,11 @@ namespace bertini
 	{
 		functions_.insert( functions_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -557,6 +1278,11 @@ namespace bertini
 	{
 		constant_subfunctions_.push_back(F);
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -564,6 +1290,11 @@ namespace bertini
 	{
 		constant_subfunctions_.insert( constant_subfunctions_.end(), v.begin(), v.end() );
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -575,6 +1306,11 @@ namespace bertini
 	{
 		path_variable_ = v;
 		is_differentiated_ = false;
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		have_path_variable_ = true;
 	}
 
@@ -662,10 +1398,21 @@ namespace bertini
 	void System::ConstructOrdering() const
 	{
 		variable_ordering_ = VariableOrdering();
+		BindVariables();
 		have_ordering_ = true;
 	}
 
 
+	//private
+	void System::BindVariables() const
+	{
+		variable_nodes_.clear();
+		variable_nodes_.reserve(variable_ordering_.size());
+		for (const auto& v : variable_ordering_)
+			variable_nodes_.push_back(v.get());
+	}
+
+
 
 	const VariableGroup& System::Variables() const
 	{
@@ -692,6 +1439,7 @@ namespace bertini
 		have_path_variable_ = other.have_path_variable_;
 
 		variable_ordering_ = other.variable_ordering_; 
+		BindVariables();
 		have_ordering_ = other.have_ordering_;
 	}
 
@@ -746,6 +1494,18 @@ namespace bertini
 	}
 
 
+	void System::SetPatch(Patch const& new_patch) const
+	{
+		if (!IsPatched())
+			throw std::runtime_error("trying to replace the patch of an unpatched system.  patch it first.");
+		if (new_patch.VariableGroupSizes()!=patch_.VariableGroupSizes())
+			throw std::runtime_error("trying to replace the patch of a system by one on variable groups of different sizes");
+
+		patch_ = new_patch;
+		patch_.Precision(precision_);
+	}
+
+
 			
 
     //////////////////////
@@ -756,10 +1516,36 @@ namespace bertini
 
     mpfr_float System::CoefficientBound(unsigned num_evaluations) const
     {
-    	mpfr_float bound("0");
+    	if (!have_bounds_)
+    		ValidateBounds();
+
+    	if (coefficient_bound_evaluations_ >= num_evaluations)
+    		return coefficient_bound_;
+
+    	mpfr_float bound = coefficient_bound_evaluations_ > 0 ? coefficient_bound_ : mpfr_float("0");
+
+    	for (unsigned ii=coefficient_bound_evaluations_; ii < num_evaluations; ii++)
+    	{
+    		// double suffices for an estimate, unless it overflows, or the double values of the implicit parameters might not be set
+    		if (NumImplicitParameters()==0)
+    		{
+	    		Vec<dbl> randy = RandomOfUnits<dbl>(NumVariables());
+	    		Vec<dbl> f_vals;
+	    		if (HavePathVariable())
+	    			f_vals = Eval(randy, RandomUnit<dbl>());
+	    		else
+	    			f_vals = Eval(randy);
+
+	    		auto dh_dx = Jacobian<dbl>();
+
+	    		double b = std::max(f_vals.array().abs().maxCoeff(), dh_dx.array().abs().maxCoeff());
+	    		if (std::isfinite(b))
+	    		{
+	    			bound = max(mpfr_float(b), bound);
+	    			continue;
+	    		}
+    		}
 
-    	for (unsigned ii=0; ii < num_evaluations; ii++)
-    	{	
     		Vec<mpfr> randy = RandomOfUnits<mpfr>(NumVariables());
     		Vec<mpfr> f_vals;
     		if (HavePathVariable())
@@ -771,11 +1557,46 @@ namespace bertini
 	    	
 			bound = max(f_vals.array().abs().maxCoeff(),dh_dx.array().abs().maxCoeff(), bound);
 		}
+
+		// differentiating on the first evaluation does not invalidate the bounds
+		coefficient_bound_ = bound;
+		coefficient_bound_evaluations_ = num_evaluations;
     	return bound;
 	}
 
 
 
+	std::size_t System::StructuralHash() const
+	{
+		auto combine = [](std::size_t & seed, std::size_t h)
+			{
+				seed ^= h + 0x9e3779b9 + (seed<<6) + (seed>>2);
+			};
+
+		std::size_t h = 0;
+		for (const auto& v : Variables())
+			combine(h, std::hash<std::string>()(v->name()));
+		if (HavePathVariable())
+			combine(h, std::hash<std::string>()(path_variable_->name()));
+
+		node::StructuralHasher hasher;
+		for (const auto& f : functions_)
+			combine(h, hasher.Hash(f));
+		return h;
+	}
+
+
+
+	//private
+	void System::ValidateBounds() const
+	{
+		degrees_.clear();
+		coefficient_bound_evaluations_ = 0;
+		have_bounds_ = true;
+	}
+
+
+
 
 
 
@@ -790,8 +1611,12 @@ namespace bertini
 
     int System::DegreeBound() const
     {
-    	auto degs = Degrees(Variables());
-    	return *std::max_element(degs.begin(), degs.end());
+    	if (!have_bounds_)
+    		ValidateBounds();
+
+    	if (degrees_.empty())
+    		degrees_ = Degrees(Variables());
+    	return *std::max_element(degrees_.begin(), degrees_.end());
     }
 
 
@@ -836,6 +1661,11 @@ namespace bertini
 		}
 
 		swap(functions_, re_ordered_functions);
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -863,6 +1693,11 @@ namespace bertini
 		}
 
 		swap(functions_, re_ordered_functions);
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -890,6 +1725,12 @@ namespace bertini
 
 		path_variable_.reset();
 		have_path_variable_ = false;
+
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 	}
 
 
@@ -965,7 +1806,8 @@ namespace bertini
 		{
 			out << "system is differentiated; jacobian:\n";
 			for (const auto& iter : s.jacobian_) {
-				out << (iter)->name() << " = " << *iter << "\n";
+				if (iter)
+					out << (iter)->name() << " = " << *iter << "\n";
 			}
 			out << "\n";
 		}
@@ -1029,6 +1871,11 @@ namespace bertini
 		for (auto iter=functions_.begin(); iter!=functions_.end(); iter++)
 			(*iter)->SetRoot( (*(rhs.functions_.begin()+(iter-functions_.begin())))->entry_node() + (*iter)->entry_node());
 
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		return *this;
 	}
 
@@ -1044,6 +1891,11 @@ namespace bertini
 		{
 			(*iter)->SetRoot( N * (*iter)->entry_node());
 		}
+		is_compiled_ = false;
+		is_expanded_ = false;
+		have_dependencies_ = false;
+		have_bounds_ = false;
+		have_precision_nodes_ = false;
 		return *this;
 	}
 
@@ -1061,6 +1913,24 @@ namespace bertini
 
 
 	
+	System Clone(System const& sys)
+	{
+		std::stringstream buffer;
+		{
+			boost::archive::text_oarchive oa(buffer);
+			oa << sys;
+		}
+
+		System copy;
+		{
+			boost::archive::text_iarchive ia(buffer);
+			ia >> copy;
+		}
+		return copy;
+	}
+
+
+
 	System Concatenate(System sys1, System const& sys2)
 	{
 		// first we will deal with the variable structure
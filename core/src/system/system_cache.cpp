@@ -0,0 +1,126 @@
+//This file is part of Bertini 2.
+//
+//system_cache.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_cache.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_cache.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/system_cache.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/serialization/string.hpp>
+
+namespace bertini {
+
+	namespace {
+		const std::string CacheIdentifier = "bertini2 system cache";
+		const unsigned CacheFormatVersion = 1; ///< Increment when the stored contents change.
+	}
+
+
+	SystemCache::SystemCache(boost::filesystem::path const& directory) : directory_(directory)
+	{
+		boost::filesystem::create_directories(directory_);
+	}
+
+
+	std::uint64_t SystemCache::Key(std::string const& system_text, std::string const& settings)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](std::string const& s)
+		{
+			for (unsigned char c : s)
+			{
+				hash ^= c;
+				hash *= 1099511628211ull;
+			}
+		};
+
+		mix(system_text);
+		mix(std::string(1,'\0')); // so that moving text between the two changes the key
+		mix(settings);
+		return hash;
+	}
+
+
+	boost::filesystem::path SystemCache::Path(std::string const& system_text, std::string const& settings) const
+	{
+		std::stringstream name;
+		name << std::hex << std::setw(16) << std::setfill('0') << Key(system_text, settings) << ".b2sys";
+		return directory_ / name.str();
+	}
+
+
+	bool SystemCache::Load(std::string const& system_text, std::string const& settings, System & sys) const
+	{
+		std::ifstream fin(Path(system_text, settings).string(), std::ios::binary);
+		if (!fin)
+			return false;
+
+		try
+		{
+			boost::archive::binary_iarchive ia(fin);
+
+			std::string identifier, stored_text, stored_settings;
+			unsigned version;
+			ia >> identifier >> version;
+			if (identifier!=CacheIdentifier || version!=CacheFormatVersion)
+				return false;
+
+			ia >> stored_text >> stored_settings;
+			if (stored_text!=system_text || stored_settings!=settings)
+				return false;
+
+			System loaded;
+			ia >> loaded;
+			swap(sys, loaded);
+			return true;
+		}
+		catch (boost::archive::archive_exception const&)
+		{
+			// written by another build, or truncated.  either way, not usable.
+			return false;
+		}
+	}
+
+
+	void SystemCache::Store(std::string const& system_text, std::string const& settings, System const& sys) const
+	{
+		auto path = Path(system_text, settings);
+		auto temp_path = path;
+		temp_path += boost::filesystem::unique_path(".%%%%-%%%%-%%%%");
+
+		{
+			std::ofstream fout(temp_path.string(), std::ios::binary);
+			if (!fout)
+				throw std::runtime_error("unable to write system cache file " + temp_path.string());
+
+			boost::archive::binary_oarchive oa(fout);
+			oa << CacheIdentifier << CacheFormatVersion << system_text << settings << sys;
+		}
+
+		boost::filesystem::rename(temp_path, path);
+	}
+
+} // re: namespace bertini
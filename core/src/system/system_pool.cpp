@@ -0,0 +1,219 @@
+//This file is part of Bertini 2.
+//
+//system_pool.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_pool.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_pool.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "system_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+
+namespace bertini {
+
+	SystemPool::SystemPool(System const& prototype, unsigned num_replicas) : prototype_(prototype)
+	{
+		Reserve(num_replicas);
+	}
+
+
+
+	void SystemPool::SetPrototype(System const& prototype, unsigned num_replicas)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			prototype_ = prototype;
+			replicas_.clear();
+			held_.clear();
+			thread_replicas_.clear();
+		}
+		Reserve(num_replicas);
+	}
+
+
+
+	void SystemPool::Reserve(unsigned num_replicas)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		while (replicas_.size() < num_replicas)
+			CloneReplica();
+	}
+
+
+
+	unsigned SystemPool::NumReplicas() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return replicas_.size();
+	}
+
+
+
+	std::shared_ptr<System> SystemPool::Replica(unsigned index) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return replicas_.at(index);
+	}
+
+
+
+	std::shared_ptr<System> SystemPool::Acquire()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return replicas_[Take()];
+	}
+
+
+
+	void SystemPool::Release(std::shared_ptr<System> const& replica)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto found = std::find(replicas_.begin(), replicas_.end(), replica);
+		if (found==replicas_.end())
+			throw std::invalid_argument("releasing a system which is not a replica of this pool");
+
+		unsigned index = found - replicas_.begin();
+		held_[index] = false;
+		for (auto iter = thread_replicas_.begin(); iter!=thread_replicas_.end(); )
+			if (iter->second==index)
+				iter = thread_replicas_.erase(iter);
+			else
+				++iter;
+	}
+
+
+
+	std::shared_ptr<System> SystemPool::ThreadReplica()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto id = std::this_thread::get_id();
+		auto found = thread_replicas_.find(id);
+		if (found!=thread_replicas_.end())
+			return replicas_[found->second];
+
+		auto index = Take();
+		thread_replicas_[id] = index;
+		return replicas_[index];
+	}
+
+
+
+	void SystemPool::ReleaseThreadReplica()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto found = thread_replicas_.find(std::this_thread::get_id());
+		if (found==thread_replicas_.end())
+			return;
+
+		held_[found->second] = false;
+		thread_replicas_.erase(found);
+	}
+
+
+
+	unsigned SystemPool::NumHeld() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return std::count(held_.begin(), held_.end(), true);
+	}
+
+
+
+	void SystemPool::SetImplicitParameters(Vec<mpfr> const& values)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		Vec<dbl> values_d(values.size());
+		for (int ii = 0; ii < values.size(); ++ii)
+			values_d(ii) = static_cast<dbl>(values(ii));
+
+		prototype_.SetImplicitParameters(values);
+		prototype_.SetImplicitParameters(values_d);
+		for (auto const& r : replicas_)
+		{
+			r->SetImplicitParameters(values);
+			r->SetImplicitParameters(values_d);
+		}
+	}
+
+
+
+	void SystemPool::CopyPatches(System const& patched)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		prototype_.CopyPatches(patched);
+		for (auto const& r : replicas_)
+			r->CopyPatches(patched);
+	}
+
+
+
+	void SystemPool::precision(unsigned new_precision)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		prototype_.precision(new_precision);
+		for (auto const& r : replicas_)
+			r->precision(new_precision);
+	}
+
+
+
+	MemoryReport SystemPool::MemoryUsage() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		MemoryReport report;
+		report.Add("prototype: ", prototype_.MemoryUsage());
+		for (auto const& r : replicas_)
+			report.Add("replicas: ", r->MemoryUsage());
+		return report;
+	}
+
+
+
+	void SystemPool::CloneReplica()
+	{
+		auto start = std::chrono::steady_clock::now();
+		replicas_.push_back(std::make_shared<System>(prototype_.Clone()));
+		held_.push_back(false);
+		clone_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+
+
+	unsigned SystemPool::Take()
+	{
+		unsigned index = std::find(held_.begin(), held_.end(), false) - held_.begin();
+		if (index==replicas_.size())
+			CloneReplica();
+
+		held_[index] = true;
+		return index;
+	}
+
+} // namespace bertini
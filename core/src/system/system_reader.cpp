@@ -0,0 +1,547 @@
+//This file is part of Bertini 2.
+//
+//system_reader.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_reader.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_reader.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/system_reader.hpp"
+#include "bertini2/detail/work_stealing.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace bertini {
+
+	namespace {
+
+		using NodePtr = std::shared_ptr<node::Node>;
+		using FunctionPtr = std::shared_ptr<node::Function>;
+		using VariablePtr = std::shared_ptr<node::Variable>;
+
+		/**
+		A name, and the statement it was declared in, so that expressions can be held to the names declared before them.
+		*/
+		struct Symbol
+		{
+			NodePtr node;
+			size_t statement;
+		};
+
+		using Symbols = std::unordered_map<std::string, Symbol>;
+
+
+		/**
+		A position in the text, with the ways of moving through it which both passes use.
+		*/
+		class Cursor
+		{
+		public:
+
+			Cursor(char const* begin, char const* pos, char const* end) : begin_(begin), pos_(pos), end_(end)
+			{}
+
+		protected:
+
+			void SkipSpace()
+			{
+				while (pos_!=end_ && std::isspace(static_cast<unsigned char>(*pos_)))
+					++pos_;
+			}
+
+			bool Accept(char c)
+			{
+				SkipSpace();
+				if (pos_!=end_ && *pos_==c)
+				{
+					++pos_;
+					return true;
+				}
+				return false;
+			}
+
+			void Expect(char c)
+			{
+				if (!Accept(c))
+					Fail(std::string("'") + c + "'");
+			}
+
+			static bool IsDigit(char c)
+			{
+				return std::isdigit(static_cast<unsigned char>(c));
+			}
+
+			/**
+			A name is letters, followed by letters, digits, and []_.  Returns the empty string if there is no name here.
+			*/
+			std::string Name()
+			{
+				SkipSpace();
+				auto start = pos_;
+				if (pos_!=end_ && std::isalpha(static_cast<unsigned char>(*pos_)))
+				{
+					++pos_;
+					while (pos_!=end_ && (std::isalnum(static_cast<unsigned char>(*pos_)) || *pos_=='[' || *pos_==']' || *pos_=='_'))
+						++pos_;
+				}
+				return std::string(start, pos_);
+			}
+
+			[[noreturn]] void Fail(std::string const& expected) const
+			{
+				auto line = 1 + std::count(begin_, pos_, '\n');
+				auto line_start = pos_;
+				while (line_start!=begin_ && *(line_start-1)!='\n')
+					--line_start;
+				auto line_end = std::find(pos_, end_, '\n');
+
+				throw std::runtime_error("unable to read system: expecting " + expected + " on line " + std::to_string(line) + ", at column " + std::to_string(1+(pos_-line_start)) + " of \"" + std::string(line_start, line_end) + "\"");
+			}
+
+			char const* begin_; ///< The start of the whole text, for locating errors.
+			char const* pos_;
+			char const* end_; ///< The end of the part of the text being read.
+		};
+
+
+
+		/**
+		Reads the expression of one definition, from just after the = to just before the ;.  Mirrors the rules of FunctionParser, one member function per rule, but decides which alternative to take by looking at the next character or name, instead of by trying them in turn.
+
+		Only reads the symbols, so several may run at once.  The nodes of symbols are shared by the new nodes, never changed.
+		*/
+		class ExpressionReader : Cursor
+		{
+		public:
+
+			ExpressionReader(char const* begin, char const* pos, char const* end, Symbols const& symbols, size_t statement) : Cursor(begin, pos, end), symbols_(symbols), statement_(statement)
+			{}
+
+			NodePtr Read()
+			{
+				auto root = std::make_shared<node::Function>(Expression());
+				SkipSpace();
+				if (pos_!=end_)
+					Fail("';'");
+				return root;
+			}
+
+		private:
+
+			NodePtr Expression()
+			{
+				auto val = Term();
+				for (;;)
+				{
+					if (Accept('+'))
+						val += Term();
+					else if (Accept('-'))
+						val -= Term();
+					else
+						return val;
+				}
+			}
+
+			NodePtr Term()
+			{
+				auto val = Factor();
+				for (;;)
+				{
+					if (Accept('*'))
+						val *= Factor();
+					else if (Accept('/'))
+						val /= Factor();
+					else
+						return val;
+				}
+			}
+
+			NodePtr Factor()
+			{
+				auto val = Element();
+				while (Accept('^'))
+				{
+					auto p = Element();
+					val = pow(val, p);
+				}
+				return val;
+			}
+
+			NodePtr Element()
+			{
+				SkipSpace();
+				if (pos_==end_)
+					Fail("an expression");
+
+				if (std::isalpha(static_cast<unsigned char>(*pos_)))
+				{
+					auto start = pos_;
+					auto name = Name();
+
+					// a subfunction is declared by its own definition, so it may appear in it, as in one pass of SystemParser.
+					auto s = symbols_.find(name);
+					if (s!=symbols_.end() && s->second.statement <= statement_)
+						return s->second.node;
+
+					if (name=="sin" || name=="cos" || name=="tan" || name=="exp" || name=="log" || name=="sqrt")
+					{
+						Expect('(');
+						auto arg = Expression();
+						Expect(')');
+
+						if (name=="sin") return node::sin(arg);
+						if (name=="cos") return node::cos(arg);
+						if (name=="tan") return node::tan(arg);
+						if (name=="exp") return node::exp(arg);
+						if (name=="log") return node::log(arg);
+						return node::sqrt(arg);
+					}
+
+					pos_ = start;
+					Fail("a declared name");
+				}
+
+				if (auto n = Number())
+					return n;
+
+				if (Accept('('))
+				{
+					auto val = Expression();
+					Expect(')');
+					return val;
+				}
+
+				// as in FunctionParser, a sign applies to the whole expression after it, not just the next element.
+				if (Accept('-'))
+					return -Expression();
+				if (Accept('+'))
+					return Expression();
+
+				Fail("an expression");
+			}
+
+			/**
+			A number is an optional -, digits with an optional decimal point, and an optional exponent e or E, optional -, and digits.  There is no space inside a number.  Those with a decimal point become Floats, the others Integers.
+
+			Returns nullptr, and reads nothing, if there is no number here.
+			*/
+			NodePtr Number()
+			{
+				auto p = pos_;
+				if (p!=end_ && *p=='-')
+					++p;
+
+				auto digits_before = p;
+				while (p!=end_ && IsDigit(*p))
+					++p;
+				bool have_digits = p!=digits_before;
+
+				bool have_point = false;
+				if (p!=end_ && *p=='.')
+				{
+					auto after_point = p+1;
+					auto q = after_point;
+					while (q!=end_ && IsDigit(*q))
+						++q;
+					if (have_digits || q!=after_point)
+					{
+						have_point = true;
+						have_digits = true;
+						p = q;
+					}
+				}
+
+				if (!have_digits)
+					return nullptr;
+
+				if (p!=end_ && (*p=='e' || *p=='E'))
+				{
+					auto q = p+1;
+					if (q!=end_ && *q=='-')
+						++q;
+					if (q!=end_ && IsDigit(*q))
+					{
+						while (q!=end_ && IsDigit(*q))
+							++q;
+						p = q;
+					}
+				}
+
+				std::string text(pos_, p);
+				std::replace(text.begin(), text.end(), 'E', 'e');
+				pos_ = p;
+
+				if (have_point)
+					return std::make_shared<node::Float>(text);
+				else
+					return std::make_shared<node::Integer>(text);
+			}
+
+			Symbols const& symbols_;
+			size_t statement_; ///< The statement being read, to hold it to the names declared before.
+		};
+
+
+
+		/**
+		Reads one system.  The first pass, Read, handles the declarations in order, and sets aside the expression of each definition, which ReadDefinitions then reads, possibly in parallel.
+		*/
+		class Reader : Cursor
+		{
+		public:
+
+			Reader(std::string const& input) : Cursor(input.data(), input.data(), input.data()+input.size())
+			{
+				auto pi = node::Pi();
+				auto e = node::E();
+				auto i = node::I();
+				symbols_.emplace("pi", Symbol{pi,0}); symbols_.emplace("Pi", Symbol{pi,0});
+				symbols_.emplace("e", Symbol{e,0}); symbols_.emplace("E", Symbol{e,0});
+				symbols_.emplace("i", Symbol{i,0}); symbols_.emplace("I", Symbol{i,0});
+			}
+
+			System Read(unsigned num_threads)
+			{
+				System sys;
+
+				while (SkipSpace(), pos_!=end_)
+				{
+					auto start = pos_;
+					auto word = Name();
+
+					if (word=="variable_group")
+						sys.AddVariableGroup(NewVariables());
+					else if (word=="hom_variable_group")
+						sys.AddHomVariableGroup(NewVariables());
+					else if (word=="variable")
+						sys.AddUngroupedVariables(NewVariables());
+					else if (word=="implicit_parameter")
+						sys.AddImplicitParameters(NewVariables());
+					else if (word=="function")
+						sys.AddFunctions(NewFunctions());
+					else if (word=="constant")
+						sys.AddConstants(NewFunctions());
+					else if (word=="parameter")
+						sys.AddParameters(NewFunctions());
+					else if (word=="pathvariable")
+						sys.AddPathVariable(NewVariable());
+					else
+					{
+						auto f = functions_.find(word);
+						if (f!=functions_.end())
+							Definition(f->second);
+						else if (IsNew(word))
+						{
+							auto F = MakeFunction(word);
+							Definition(F);
+							sys.AddSubfunction(F);
+						}
+						else
+						{
+							pos_ = start;
+							Fail("a declaration, or a definition of a function");
+						}
+						++statement_;
+						continue;
+					}
+
+					Expect(';');
+					++statement_;
+				}
+
+				ReadDefinitions(num_threads);
+
+				sys.MergeCommonSubexpressions();
+				return sys;
+			}
+
+		private:
+
+			/**
+			A definition whose expression is yet to be read.  The text is [begin, end), between the = and the ;.
+			*/
+			struct PendingDefinition
+			{
+				FunctionPtr function; ///< nullptr if a later definition of the same function replaces this one.  Still read, for errors.
+				char const* begin;
+				char const* end;
+				size_t statement;
+			};
+
+
+			/////////////
+			//
+			//  declarations
+			//
+			//////////////
+
+			bool IsNew(std::string const& name) const
+			{
+				static const std::unordered_set<std::string> declarations{"variable_group", "hom_variable_group", "variable", "function", "constant", "parameter", "implicit_parameter", "pathvariable", "random", "random_real"};
+
+				return !name.empty() && !declarations.count(name) && !symbols_.count(name);
+			}
+
+			std::string NewName()
+			{
+				auto start = pos_;
+				auto name = Name();
+				if (!IsNew(name))
+				{
+					pos_ = start;
+					Fail("a new name");
+				}
+				return name;
+			}
+
+			VariablePtr NewVariable()
+			{
+				auto name = NewName();
+				auto V = std::make_shared<node::Variable>(name);
+				symbols_.emplace(name, Symbol{V, statement_});
+				return V;
+			}
+
+			VariableGroup NewVariables()
+			{
+				VariableGroup v;
+				do
+					v.push_back(NewVariable());
+				while (Accept(','));
+				return v;
+			}
+
+			FunctionPtr MakeFunction(std::string const& name)
+			{
+				auto F = std::make_shared<node::Function>(name);
+				symbols_.emplace(name, Symbol{F, statement_});
+				functions_.emplace(name, F);
+				return F;
+			}
+
+			std::vector<FunctionPtr> NewFunctions()
+			{
+				std::vector<FunctionPtr> f;
+				do
+					f.push_back(MakeFunction(NewName()));
+				while (Accept(','));
+				return f;
+			}
+
+			/**
+			Sets aside the expression after the =, to just before the ;, which ends the definition, since expressions contain no ;.
+			*/
+			void Definition(FunctionPtr const& F)
+			{
+				Expect('=');
+
+				auto semicolon = std::find(pos_, end_, ';');
+				if (semicolon==end_)
+				{
+					pos_ = end_;
+					Fail("';'");
+				}
+
+				auto previous = defined_.find(F.get());
+				if (previous!=defined_.end())
+					definitions_[previous->second].function = nullptr;
+				defined_[F.get()] = definitions_.size();
+
+				definitions_.push_back(PendingDefinition{F, pos_, semicolon, statement_});
+				pos_ = semicolon+1;
+			}
+
+
+			/////////////
+			//
+			//  expressions
+			//
+			//////////////
+
+			/**
+			Reads the expressions set aside.  Each is read into its own nodes, so they are independent tasks.  An error in any is reported as the error in the earliest, as reading in order would.
+			*/
+			void ReadDefinitions(unsigned num_threads)
+			{
+				if (definitions_.empty())
+					return;
+
+				const size_t min_parallel_length = 1<<16;
+				if (end_-begin_ < static_cast<std::ptrdiff_t>(min_parallel_length))
+					num_threads = 1;
+				num_threads = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(num_threads, definitions_.size())));
+
+				std::vector<std::exception_ptr> errors(definitions_.size());
+				auto precision = DefaultPrecision();
+
+				auto read = [&](unsigned, size_t const& ii)
+				{
+					DefaultPrecision(precision); // numbers are made at the precision of the calling thread, wherever they are read
+					auto const& d = definitions_[ii];
+					try
+					{
+						auto root = ExpressionReader(begin_, d.begin, d.end, symbols_, d.statement).Read();
+						if (d.function)
+							d.function->SetRoot(root);
+					}
+					catch (...)
+					{
+						errors[ii] = std::current_exception();
+					}
+				};
+
+				if (num_threads==1)
+					for (size_t ii = 0; ii < definitions_.size(); ++ii)
+						read(0, ii);
+				else
+				{
+					detail::WorkStealingQueues<size_t> queues(num_threads);
+					for (size_t ii = 0; ii < definitions_.size(); ++ii)
+						queues.Push(ii % num_threads, ii, static_cast<double>(definitions_[ii].end - definitions_[ii].begin));
+					detail::RunWorkStealing<size_t>(queues, read);
+				}
+
+				for (auto const& e : errors)
+					if (e)
+						std::rethrow_exception(e);
+			}
+
+
+			Symbols symbols_; ///< Variables, functions, and special numbers, by name.
+			std::unordered_map<std::string, FunctionPtr> functions_; ///< The functions which may be defined with name = expression;
+			std::vector<PendingDefinition> definitions_; ///< The definitions, in order, with their expressions unread.
+			std::unordered_map<node::Function const*, size_t> defined_; ///< The latest definition of each function.
+			size_t statement_ = 0; ///< The number of statements read so far.
+		};
+
+	} // re: namespace {}
+
+
+	System ReadSystem(std::string const& input, unsigned num_threads)
+	{
+		return Reader(input).Read(num_threads);
+	}
+
+} // re: namespace bertini
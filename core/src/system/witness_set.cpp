@@ -0,0 +1,124 @@
+//This file is part of Bertini 2.
+//
+//witness_set.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//witness_set.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with witness_set.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "witness_set.hpp"
+
+#include <algorithm>
+
+
+namespace bertini {
+
+	WitnessSet::WitnessSet(System const& system, LinearSlice const& slice) : system_(system), slice_(slice)
+	{
+		if (system.HavePathVariable())
+			throw std::runtime_error("attempting to construct witness set, but the system has a path variable declared already");
+
+		if (system.NumTotalFunctions() + slice.Dimension() != system.NumVariables())
+			throw std::runtime_error("the system (" + std::to_string(system.NumTotalFunctions()) + " functions) and slice (" + std::to_string(slice.Dimension()) + " dimensions) of a witness set must together be square in the " + std::to_string(system.NumVariables()) + " variables");
+
+		const auto& vars = system.Variables();
+		for (const auto& v : slice.Variables())
+			if (std::find(vars.begin(), vars.end(), v)==vars.end())
+				throw std::runtime_error("the slice of a witness set must be on variables of its system");
+	}
+
+
+
+	void WitnessSet::AddPoint(Vec<dbl> const& x)
+	{
+		Vec<mpfr> y(x.size());
+		for (int ii = 0; ii < x.size(); ++ii)
+			y(ii) = mpfr(x(ii).real(), x(ii).imag());
+		points_.push_back(y);
+	}
+
+
+
+	System WitnessSet::SlicedSystem() const
+	{
+		System sliced(system_);
+		auto const& c = slice_.Coefficients();
+		auto const& vars = slice_.Variables();
+		for (unsigned ii = 0; ii < slice_.Dimension(); ++ii)
+		{
+			std::shared_ptr<node::Node> f = slice_.IsHomogeneous() ? std::shared_ptr<node::Node>(std::make_shared<node::Integer>(0)) : std::make_shared<node::Float>(slice_.Constants()(ii));
+			for (unsigned jj = 0; jj < vars.size(); ++jj)
+				f = f + std::make_shared<node::Float>(c(ii,jj))*vars[jj];
+			sliced.AddFunction(f);
+		}
+		return sliced;
+	}
+
+
+
+	ParameterHomotopy WitnessSet::SliceMovingHomotopy() const
+	{
+		System family(system_);
+		auto const& vars = slice_.Variables();
+		auto parameters = SliceParameters(slice_);
+
+		// the parameters, named for their place in the slice, defined as the current slice for the sake of evaluating the family
+		unsigned next = 0;
+		auto parameter = [&](std::string const& name)
+			{
+				auto p = std::make_shared<node::Function>(name);
+				p->SetRoot(std::make_shared<node::Float>(parameters(next++)));
+				family.AddParameter(p);
+				return p;
+			};
+
+		std::vector< std::vector< std::shared_ptr<node::Function> > > coefficients(slice_.Dimension());
+		for (unsigned ii = 0; ii < slice_.Dimension(); ++ii)
+			for (unsigned jj = 0; jj < vars.size(); ++jj)
+				coefficients[ii].push_back(parameter("slice_" + std::to_string(ii) + "_" + std::to_string(jj)));
+
+		for (unsigned ii = 0; ii < slice_.Dimension(); ++ii)
+		{
+			std::shared_ptr<node::Node> f = slice_.IsHomogeneous() ? std::shared_ptr<node::Node>(std::make_shared<node::Integer>(0)) : parameter("slice_" + std::to_string(ii));
+			for (unsigned jj = 0; jj < vars.size(); ++jj)
+				f = f + coefficients[ii][jj]*vars[jj];
+			family.AddFunction(f);
+		}
+
+		return ParameterHomotopy(family, parameters);
+	}
+
+
+
+	Vec<mpfr> WitnessSet::SliceParameters(LinearSlice const& slice)
+	{
+		auto const& c = slice.Coefficients();
+		auto num_constants = slice.IsHomogeneous() ? 0 : slice.Dimension();
+
+		Vec<mpfr> parameters(c.rows()*c.cols() + num_constants);
+		unsigned next = 0;
+		for (int ii = 0; ii < c.rows(); ++ii)
+			for (int jj = 0; jj < c.cols(); ++jj)
+				parameters(next++) = c(ii,jj);
+		for (unsigned ii = 0; ii < num_constants; ++ii)
+			parameters(next++) = slice.Constants()(ii);
+		return parameters;
+	}
+
+} // namespace bertini
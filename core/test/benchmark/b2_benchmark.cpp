@@ -0,0 +1,418 @@
+//This file is part of Bertini 2.
+//
+//b2_benchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_benchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_benchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+// The benchmarks of the core operations of Bertini 2, for tracking performance between versions.
+//
+// call as
+//
+//   b2_benchmark [--filter=REGEX] [--min_time=SECONDS] [--repetitions=N] [--format=console|json] [--precisions=30,50,100] [--input=FILE]... [--counters]
+//                [--baseline=FILE] [--threshold=FRACTION]
+//
+// benchmark names are Operation/system/number type, like Eval/katsura5/dbl or TrackPath/cyclic5/prec30.
+// each --input file is a Bertini Classic input file, which is parsed, and added to the corpus of systems.
+// --counters reads the hardware performance counters around each benchmark loop, on Linux, and reports cycles,
+// instructions, cache misses and branch misses per call, to tell whether evaluation, mpfr allocation, or the LU dominates.
+// --baseline compares against the JSON of an earlier run, flagging benchmarks slower by more than --threshold (default 0.05)
+// and, with --repetitions of at least 2 in both runs, by more than their spread explains.  the exit code is 1 if any are.
+// `make benchmark-baseline` and `make benchmark-compare` do this over the corpus in test/benchmark/corpus.
+
+
+#include "bertini2/bertini.hpp"
+#include "bertini2/system_reader.hpp"
+#include "bertini2/classic/input_file.hpp"
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/endgame.hpp"
+
+#include "benchmark.hpp"
+#include "systems.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+
+using namespace bertini;
+using namespace bertini::benchmark;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::complex;
+
+
+namespace {
+
+	struct CorpusEntry
+	{
+		std::string name;
+		std::function<System()> make;
+		bool small; ///< Whether to track paths on it, which takes much longer than evaluating.
+	};
+
+
+	template<typename T>
+	std::string TypeName(unsigned precision);
+
+	template<>
+	std::string TypeName<dbl>(unsigned)
+	{
+		return "dbl";
+	}
+
+	template<>
+	std::string TypeName<mpfr>(unsigned precision)
+	{
+		return "mpfr" + std::to_string(precision);
+	}
+
+
+	// a fixed point, away from the usual trouble spots, so runs are comparable.
+	template<typename T>
+	Vec<T> TestPoint(unsigned size)
+	{
+		Vec<T> x(size);
+		for (unsigned ii = 0; ii < size; ++ii)
+			x(ii) = T(0.5 + 0.0625*ii, -0.25 + 0.03125*ii);
+		return x;
+	}
+
+
+	/**
+	Runs the body of a benchmark, turning exceptions into errors in the report.
+	*/
+	template<typename F>
+	void Guard(State & state, F f)
+	{
+		try
+		{
+			f();
+		}
+		catch (std::exception const& e)
+		{
+			state.SkipWithError(e.what());
+			while (state.KeepRunning())
+			{}
+		}
+	}
+
+
+	template<typename T>
+	void RegisterEvaluation(CorpusEntry const& entry, unsigned precision)
+	{
+		auto suffix = "/" + entry.name + "/" + TypeName<T>(precision);
+		auto make = entry.make;
+
+		Register("Eval" + suffix, [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<T>(make());
+			H.system.precision(precision);
+			auto x = TestPoint<T>(H.system.NumVariables());
+			T t(0.25, 0.125);
+			Vec<T> f(H.system.NumTotalFunctions());
+			while (state.KeepRunning())
+				H.system.EvalInPlace(f, x, t);
+		});});
+
+		Register("Jacobian" + suffix, [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<T>(make());
+			H.system.precision(precision);
+			auto x = TestPoint<T>(H.system.NumVariables());
+			T t(0.25, 0.125);
+			Mat<T> J(H.system.NumTotalFunctions(), H.system.NumVariables());
+			while (state.KeepRunning())
+				H.system.JacobianInPlace(J, x, t);
+		});});
+
+		Register("LUSolve" + suffix, [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<T>(make());
+			H.system.precision(precision);
+			auto x = TestPoint<T>(H.system.NumVariables());
+			T t(0.25, 0.125);
+			Mat<T> J = H.system.Jacobian(x, t);
+			Vec<T> f = H.system.Eval(x, t);
+			Vec<T> delta_x(x.size());
+			Eigen::PartialPivLU<Mat<T>> LU(J.rows());
+			while (state.KeepRunning())
+			{
+				LU.compute(J);
+				delta_x = LU.solve(f);
+			}
+		});});
+
+		Register("TimeDerivative" + suffix, [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<T>(make());
+			H.system.precision(precision);
+			auto x = TestPoint<T>(H.system.NumVariables());
+			T t(0.25, 0.125);
+			Vec<T> ds_dt(H.system.NumTotalFunctions());
+			while (state.KeepRunning())
+				H.system.TimeDerivativeInPlace(ds_dt, x, t);
+		});});
+
+		Register("NewtonCorrect" + suffix, [=](State & state){ Guard(state, [&]{
+			using RT = typename Eigen::NumTraits<T>::Real;
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<T>(make());
+			H.system.precision(precision);
+
+			// a start point, nudged off the path, corrected for a fixed number of iterations.
+			Vec<T> x = H.start_point + TestPoint<T>(H.system.NumVariables())*T(1e-3, 0);
+			T t(1, 0);
+			Vec<T> corrected(x.size());
+			tracking::correct::NewtonCorrector newton(H.system);
+			RT tolerance(1e-300);
+			while (state.KeepRunning())
+				newton.Correct(corrected, H.system, x, t, tolerance, 3, 3);
+		});});
+
+		using tracking::config::Predictor;
+		std::vector<std::pair<std::string, Predictor>> methods{
+			{"Euler", Predictor::Euler}, {"Heun", Predictor::Heun}, {"RK4", Predictor::RK4},
+			{"HeunEuler", Predictor::HeunEuler}, {"RKNorsett34", Predictor::RKNorsett34}, {"RKF45", Predictor::RKF45},
+			{"RKCashKarp45", Predictor::RKCashKarp45}, {"RKDormandPrince56", Predictor::RKDormandPrince56}, {"RKVerner67", Predictor::RKVerner67}};
+
+		for (auto const& m : methods)
+		{
+			auto method = m.second;
+			Register("Predict" + m.first + suffix, [=](State & state){ Guard(state, [&]{
+				using RT = typename Eigen::NumTraits<T>::Real;
+				DefaultPrecision(precision);
+				auto H = TotalDegreeHomotopy<T>(make());
+				H.system.precision(precision);
+
+				tracking::predict::ExplicitRKPredictor predictor(method, H.system);
+				Vec<T> next;
+				T t(1, 0), delta_t(-0.01, 0);
+				RT condition_number(1), tolerance(1e-5);
+				unsigned steps_since_condition_number = 0;
+				while (state.KeepRunning())
+					predictor.Predict(next, H.system, H.start_point, t, delta_t, condition_number, steps_since_condition_number, 1, tolerance);
+			});});
+		}
+	}
+
+
+	/**
+	Tracks the first path of the total degree homotopy to the system, from t=1 to 0.1, starting at a precision.  Precision 16 is double precision.
+	*/
+	void RegisterTracking(CorpusEntry const& entry, unsigned precision)
+	{
+		auto make = entry.make;
+		Register("TrackPath/" + entry.name + "/prec" + std::to_string(precision), [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+			auto H = TotalDegreeHomotopy<mpfr>(make());
+			H.system.precision(precision);
+
+			tracking::AMPTracker tracker(H.system);
+			tracker.Setup(tracking::config::Predictor::RK4, mpfr_float("1e-5"), mpfr_float("1e5"), tracking::config::Stepping<mpfr_float>(), tracking::config::Newton());
+			tracker.PrecisionSetup(tracking::config::AMPConfigFrom(H.system));
+
+			Vec<mpfr> result;
+			tracking::SuccessCode code = tracking::SuccessCode::Success;
+			while (state.KeepRunning())
+			{
+				DefaultPrecision(precision);
+				code = tracker.TrackPath(result, mpfr(1), mpfr("0.1"), H.start_point);
+			}
+			std::stringstream label;
+			label << "steps=" << tracker.NumTotalStepsTaken() << " final_precision=" << tracker.CurrentPrecision() << (code==tracking::SuccessCode::Success ? "" : " failed");
+			state.SetLabel(label.str());
+		});});
+	}
+
+
+	/**
+	Runs an endgame on the classic triple root at x=1, (x-1)^3 (1-t) + (x^3+1) t, from t=0.1.
+	*/
+	template<typename EndgameT>
+	void RegisterEndgame(std::string const& name, unsigned precision)
+	{
+		Register("Endgame" + name + "/triple_root/prec" + std::to_string(precision), [=](State & state){ Guard(state, [&]{
+			DefaultPrecision(precision);
+
+			System sys;
+			auto x = std::make_shared<node::Variable>("x"), t = std::make_shared<node::Variable>("t");
+			sys.AddFunction(pow(x-1,3)*(1-t) + (pow(x,3)+1)*t);
+			sys.AddVariableGroup(VariableGroup{x});
+			sys.AddPathVariable(t);
+
+			tracking::AMPTracker tracker(sys);
+			tracker.Setup(tracking::config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), tracking::config::Stepping<mpfr_float>(), tracking::config::Newton());
+			tracker.PrecisionSetup(tracking::config::AMPConfigFrom(sys));
+
+			mpfr boundary_time("0.1");
+			Vec<mpfr> boundary_point(1);
+			boundary_point << mpfr("5.000000000000001e-01", "9.084258952712920e-17");
+
+			EndgameT endgame(tracker);
+			while (state.KeepRunning())
+			{
+				DefaultPrecision(precision);
+				endgame.Run(boundary_time, boundary_point);
+			}
+			state.SetLabel("cycle_number=" + std::to_string(endgame.CycleNumber()));
+		});});
+	}
+
+
+	void RegisterParsing(boost::filesystem::path const& file)
+	{
+		auto name = file.stem().string();
+		auto input = classic::ReadInputFile(file).Input();
+
+		Register("ParseQi/" + name, [=](State & state){ Guard(state, [&]{
+			while (state.KeepRunning())
+				System S(input);
+		});});
+
+		Register("ReadSystem/" + name, [=](State & state){ Guard(state, [&]{
+			while (state.KeepRunning())
+				System S = ReadSystem(input);
+		});});
+	}
+
+
+	std::vector<unsigned> ParsePrecisions(std::string const& list)
+	{
+		std::vector<unsigned> precisions;
+		std::stringstream ss(list);
+		std::string item;
+		while (std::getline(ss, item, ','))
+			precisions.push_back(std::stoul(item));
+		return precisions;
+	}
+
+
+	std::string Today()
+	{
+		std::time_t now = std::time(nullptr);
+		char buffer[32];
+		std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+		return buffer;
+	}
+
+} // re: namespace
+
+
+
+int main(int argc, char** argv)
+{
+	RunOptions options;
+	std::vector<unsigned> precisions{30, 50, 100};
+	std::vector<boost::filesystem::path> inputs;
+
+	for (int ii = 1; ii < argc; ++ii)
+	{
+		std::string arg(argv[ii]);
+		auto value = arg.substr(arg.find('=')+1);
+
+		if (arg.find("--filter=")==0)
+			options.filter = value;
+		else if (arg.find("--min_time=")==0)
+			options.min_seconds = std::stod(value);
+		else if (arg.find("--repetitions=")==0)
+			options.repetitions = std::max<unsigned>(1, std::stoul(value));
+		else if (arg.find("--format=")==0)
+			options.json = value=="json";
+		else if (arg.find("--precisions=")==0)
+			precisions = ParsePrecisions(value);
+		else if (arg.find("--input=")==0)
+			inputs.push_back(value);
+		else if (arg=="--counters")
+			CountersEnabled() = true;
+		else if (arg.find("--baseline=")==0)
+			options.baseline = value;
+		else if (arg.find("--threshold=")==0)
+			options.threshold = std::stod(value);
+		else
+		{
+			std::cerr << "usage: b2_benchmark [--filter=REGEX] [--min_time=SECONDS] [--repetitions=N] [--format=console|json] [--precisions=30,50,100] [--input=FILE]... [--counters] [--baseline=FILE] [--threshold=FRACTION]\n";
+			return 2;
+		}
+	}
+
+
+	std::vector<CorpusEntry> corpus{
+		{"katsura5", []{ return Katsura(5); }, true},
+		{"katsura8", []{ return Katsura(8); }, false},
+		{"cyclic5", []{ return Cyclic(5); }, true},
+		{"cyclic7", []{ return Cyclic(7); }, false},
+		{"griewank_osborne", []{ return GriewankOsborne(); }, true}};
+
+	for (auto const& file : inputs)
+	{
+		RegisterParsing(file);
+		auto input = classic::ReadInputFile(file).Input();
+		corpus.push_back({file.stem().string(), [input]{ return System(input); }, false});
+	}
+
+
+	for (auto const& entry : corpus)
+	{
+		RegisterEvaluation<dbl>(entry, DoublePrecision());
+		for (auto p : precisions)
+			RegisterEvaluation<mpfr>(entry, p);
+	}
+
+	std::vector<unsigned> tracking_precisions{DoublePrecision()};
+	tracking_precisions.insert(tracking_precisions.end(), precisions.begin(), precisions.end());
+
+	for (auto const& entry : corpus)
+		if (entry.small)
+			for (auto p : tracking_precisions)
+				RegisterTracking(entry, p);
+
+	for (auto p : tracking_precisions)
+	{
+		RegisterEndgame<tracking::EndgameSelector<tracking::AMPTracker>::PSEG>("PowerSeries", p);
+		RegisterEndgame<tracking::EndgameSelector<tracking::AMPTracker>::Cauchy>("Cauchy", p);
+	}
+
+
+	std::vector<std::pair<std::string, std::string>> context{
+		{"date", Today()},
+		{"executable", argv[0]},
+#ifdef NDEBUG
+		{"build_type", "release"},
+#else
+		{"build_type", "debug"},
+#endif
+		{"min_time", std::to_string(options.min_seconds)},
+		{"repetitions", std::to_string(options.repetitions)},
+		{"counters", CountersEnabled() ? "true" : "false"}};
+
+	try
+	{
+		return RunMatching(options, context);
+	}
+	catch (std::runtime_error const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return 2;
+	}
+}
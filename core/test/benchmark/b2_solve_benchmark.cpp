@@ -0,0 +1,325 @@
+//This file is part of Bertini 2.
+//
+//b2_solve_benchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_solve_benchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_solve_benchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+// Solves a whole total degree homotopy with the ParallelSolver, at increasing numbers of threads, and reports how it scales.
+//
+// call as
+//
+//   b2_solve_benchmark [--system=cyclic7] [--input=FILE] [--threads=1,2,4] [--pinning=none|compact|spread] [--no_local_stealing] [--format=console|json]
+//
+// --system is one of katsuraN, cyclicN, or griewank_osborne.  --input solves a Bertini Classic input file instead.
+// the thread counts default to 1, 2, 4, ... up to the number of hardware threads, and the number of hardware threads itself.
+// --pinning pins the threads to cpus, see config::ThreadPlacement, and --no_local_stealing lets pinned threads steal
+// from any other, rather than those of their own NUMA node first.
+//
+// for each thread count, reported are the paths per second, the 50th, 90th, 99th percentile and maximum time per path,
+// the fraction of tracking time spent at each precision, the parallel efficiency relative to the first thread count,
+// the number of NUMA nodes the threads ran on, and how many tasks were stolen, in all and from another node.
+
+
+#include "bertini2/bertini.hpp"
+#include "bertini2/classic/input_file.hpp"
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/endgame.hpp"
+#include "bertini2/tracking/observers.hpp"
+#include "bertini2/tracking/parallel_solver.hpp"
+
+#include "benchmark.hpp"
+#include "systems.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <set>
+
+
+using namespace bertini;
+using namespace bertini::tracking;
+
+using mpfr = bertini::complex;
+
+
+namespace {
+
+	struct Run
+	{
+		unsigned num_threads;
+		double seconds;
+		size_t num_paths;
+		size_t num_failed;
+		std::vector<double> path_seconds; ///< Sorted.
+		std::map<unsigned, double> precision_seconds;
+		unsigned num_nodes; ///< The number of NUMA nodes the threads were pinned to, 1 if not pinned.
+		size_t num_steals;
+		size_t num_remote_steals;
+
+		double PathsPerSecond() const
+		{
+			return num_paths / seconds;
+		}
+
+		double Percentile(double p) const
+		{
+			if (path_seconds.empty())
+				return 0;
+			auto index = std::min(path_seconds.size()-1, static_cast<size_t>(p*path_seconds.size()));
+			return path_seconds[index];
+		}
+
+		double PrecisionFraction(unsigned precision) const
+		{
+			double total = 0;
+			for (auto const& s : precision_seconds)
+				total += s.second;
+			return total > 0 ? precision_seconds.at(precision)/total : 0;
+		}
+
+		/**
+		The speedup over the base run, divided by the increase in threads.
+		*/
+		double Efficiency(Run const& base) const
+		{
+			return (PathsPerSecond()/base.PathsPerSecond()) / (double(num_threads)/base.num_threads);
+		}
+	};
+
+
+	System MakeSystem(std::string const& name)
+	{
+		if (name=="griewank_osborne")
+			return benchmark::GriewankOsborne();
+		if (name.find("katsura")==0)
+			return benchmark::Katsura(std::stoul(name.substr(7)));
+		if (name.find("cyclic")==0)
+			return benchmark::Cyclic(std::stoul(name.substr(6)));
+		throw std::invalid_argument("unknown system " + name + ", expected katsuraN, cyclicN, or griewank_osborne");
+	}
+
+
+	Run Solve(System const& target, start_system::TotalDegree const& td, unsigned num_threads, config::ThreadPlacement const& placement)
+	{
+		// one timer per thread's tracker.  declared before the solver, so they outlive its trackers.
+		std::vector<std::unique_ptr<PrecisionTimer<AMPTracker>>> timers;
+
+		ParallelSolver<AMPTracker> solver(target, td, [&timers](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-5"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+
+				timers.emplace_back(new PrecisionTimer<AMPTracker>);
+				tracker.AddObserver(timers.back().get());
+			}, num_threads);
+		solver.SetThreadPlacement(placement);
+
+		auto started = std::chrono::steady_clock::now();
+		solver.Solve();
+
+		Run run;
+		run.num_threads = num_threads;
+		run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+		run.num_paths = solver.Results().size();
+		run.num_failed = 0;
+
+		for (auto const& r : solver.Results())
+		{
+			run.path_seconds.push_back(r.seconds);
+			if (r.success!=SuccessCode::Success)
+				++run.num_failed;
+		}
+		std::sort(run.path_seconds.begin(), run.path_seconds.end());
+
+		std::set<unsigned> nodes;
+		for (auto const& slot : solver.ThreadSlots())
+			nodes.insert(slot.node);
+		run.num_nodes = nodes.size();
+		run.num_steals = solver.NumSteals();
+		run.num_remote_steals = solver.NumRemoteSteals();
+
+		for (auto const& t : timers)
+			for (auto const& s : t->Seconds())
+				run.precision_seconds[s.first] += s.second;
+
+		return run;
+	}
+
+
+	std::vector<unsigned> DefaultThreads()
+	{
+		unsigned max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+		std::vector<unsigned> threads;
+		for (unsigned n = 1; n < max_threads; n *= 2)
+			threads.push_back(n);
+		threads.push_back(max_threads);
+		return threads;
+	}
+
+
+	std::vector<unsigned> ParseThreads(std::string const& list)
+	{
+		std::vector<unsigned> threads;
+		std::stringstream ss(list);
+		std::string item;
+		while (std::getline(ss, item, ','))
+			threads.push_back(std::stoul(item));
+		return threads;
+	}
+
+
+	void ReportConsole(std::string const& name, std::vector<Run> const& runs)
+	{
+		std::cout << name << ", " << runs.front().num_paths << " paths\n\n"
+		          << std::setw(8) << "threads" << std::setw(12) << "seconds" << std::setw(12) << "paths/s"
+		          << std::setw(12) << "p50 (s)" << std::setw(12) << "p90 (s)" << std::setw(12) << "p99 (s)" << std::setw(12) << "max (s)"
+		          << std::setw(12) << "efficiency" << std::setw(8) << "failed"
+		          << std::setw(8) << "nodes" << std::setw(10) << "steals" << std::setw(10) << "remote" << "  time at precision\n";
+
+		for (auto const& r : runs)
+		{
+			std::cout << std::fixed << std::setprecision(4)
+			          << std::setw(8) << r.num_threads << std::setw(12) << r.seconds << std::setw(12) << r.PathsPerSecond()
+			          << std::setw(12) << r.Percentile(0.5) << std::setw(12) << r.Percentile(0.9) << std::setw(12) << r.Percentile(0.99) << std::setw(12) << r.Percentile(1)
+			          << std::setw(12) << r.Efficiency(runs.front()) << std::setw(8) << r.num_failed
+			          << std::setw(8) << r.num_nodes << std::setw(10) << r.num_steals << std::setw(10) << r.num_remote_steals << " ";
+			std::cout << std::setprecision(1);
+			for (auto const& s : r.precision_seconds)
+				std::cout << " " << s.first << ":" << 100*r.PrecisionFraction(s.first) << "%";
+			std::cout << "\n" << std::defaultfloat;
+		}
+	}
+
+
+	void ReportJSON(std::string const& name, std::vector<Run> const& runs, std::string const& pinning)
+	{
+		std::cout << "{\n  \"system\": \"" << benchmark::JSONEscape(name) << "\",\n"
+		          << "  \"num_paths\": " << runs.front().num_paths << ",\n"
+		          << "  \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+		          << "  \"num_numa_nodes\": " << detail::CpuTopology::Detect().NumNodes() << ",\n"
+		          << "  \"pinning\": \"" << pinning << "\",\n"
+		          << "  \"runs\": [";
+
+		for (size_t ii = 0; ii < runs.size(); ++ii)
+		{
+			auto const& r = runs[ii];
+			std::cout << (ii==0 ? "\n" : ",\n") << "    {\n"
+			          << std::setprecision(6)
+			          << "      \"threads\": " << r.num_threads << ",\n"
+			          << "      \"seconds\": " << r.seconds << ",\n"
+			          << "      \"paths_per_second\": " << r.PathsPerSecond() << ",\n"
+			          << "      \"num_failed\": " << r.num_failed << ",\n"
+			          << "      \"path_seconds\": {\"p50\": " << r.Percentile(0.5) << ", \"p90\": " << r.Percentile(0.9) << ", \"p99\": " << r.Percentile(0.99) << ", \"max\": " << r.Percentile(1) << "},\n"
+			          << "      \"parallel_efficiency\": " << r.Efficiency(runs.front()) << ",\n"
+			          << "      \"num_nodes\": " << r.num_nodes << ",\n"
+			          << "      \"num_steals\": " << r.num_steals << ",\n"
+			          << "      \"num_remote_steals\": " << r.num_remote_steals << ",\n"
+			          << "      \"precision_fractions\": {";
+			bool first = true;
+			for (auto const& s : r.precision_seconds)
+			{
+				std::cout << (first ? "" : ", ") << "\"" << s.first << "\": " << r.PrecisionFraction(s.first);
+				first = false;
+			}
+			std::cout << "}\n    }";
+		}
+		std::cout << "\n  ]\n}\n";
+	}
+
+} // re: namespace
+
+
+
+int main(int argc, char** argv)
+{
+	std::string name = "cyclic7";
+	boost::filesystem::path input;
+	std::vector<unsigned> threads = DefaultThreads();
+	bool json = false;
+	std::string pinning = "none";
+	config::ThreadPlacement placement;
+
+	for (int ii = 1; ii < argc; ++ii)
+	{
+		std::string arg(argv[ii]);
+		auto value = arg.substr(arg.find('=')+1);
+
+		if (arg.find("--system=")==0)
+			name = value;
+		else if (arg.find("--input=")==0)
+			input = value;
+		else if (arg.find("--threads=")==0)
+			threads = ParseThreads(value);
+		else if (arg.find("--format=")==0)
+			json = value=="json";
+		else if (arg.find("--pinning=")==0 && (value=="none" || value=="compact" || value=="spread"))
+			pinning = value;
+		else if (arg=="--no_local_stealing")
+			placement.local_stealing = false;
+		else
+		{
+			std::cerr << "usage: b2_solve_benchmark [--system=cyclic7] [--input=FILE] [--threads=1,2,4] [--pinning=none|compact|spread] [--no_local_stealing] [--format=console|json]\n";
+			return 2;
+		}
+	}
+
+	System target;
+	try
+	{
+		if (input.empty())
+			target = MakeSystem(name);
+		else
+		{
+			name = input.stem().string();
+			target = System(classic::ReadInputFile(input).Input());
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return 2;
+	}
+
+	target.Homogenize();
+	target.AutoPatch();
+
+	auto td = start_system::TotalDegree(target);
+	td.Homogenize();
+
+	if (threads.empty())
+		threads = DefaultThreads();
+
+	if (pinning=="compact")
+		placement.pinning = config::ThreadPinning::Compact;
+	else if (pinning=="spread")
+		placement.pinning = config::ThreadPinning::Spread;
+
+	std::vector<Run> runs;
+	for (auto n : threads)
+		runs.push_back(Solve(target, td, n, placement));
+
+	if (json)
+		ReportJSON(name, runs, pinning);
+	else
+		ReportConsole(name, runs);
+
+	return 0;
+}
@@ -0,0 +1,940 @@
+//This file is part of Bertini 2.
+//
+//benchmark.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file benchmark.hpp
+
+\brief A small benchmark harness, in the style of Google Benchmark, for the b2_benchmark program.
+
+A benchmark is a function taking a State, which does its setup, then runs the code to be timed in a loop `while (state.KeepRunning())`.  Each benchmark is run with more and more iterations until it takes at least a minimum time, and the time per iteration of the last run is reported, either for reading or as JSON, for comparing between versions.
+
+Each benchmark can be run several times, see RunOptions::repetitions, to get the spread of its time as well as the mean.  A run can be compared against a baseline written earlier as JSON, see Compare, to flag the benchmarks which have slowed down by more than a threshold, and by more than the spread of the two runs can explain.
+
+On Linux, the hardware performance counters for cycles, instructions, cache misses, and branch misses can be read around the loop as well, see CountersEnabled.  They are reported per iteration.  Reading them needs permission to use perf_event_open, such as kernel.perf_event_paranoid at most 2; if they cannot be read, the benchmarks run and report without them.
+*/
+
+#ifndef BERTINI_TEST_BENCHMARK_HPP
+#define BERTINI_TEST_BENCHMARK_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <cstring>
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bertini {
+namespace benchmark {
+
+	/**
+	\brief Whether to read the hardware performance counters around each benchmark loop.  Off unless set.
+	*/
+	inline
+	bool& CountersEnabled()
+	{
+		static bool enabled = false;
+		return enabled;
+	}
+
+
+	/**
+	\brief A group of hardware performance counters for the calling thread: cycles, instructions, cache misses, and branch misses.  User space only.
+
+	If the counters cannot be opened, for want of permission or support, Available is false and Error says why, and the other methods do nothing.  If the processor has fewer counters free than asked for, the kernel multiplexes them, and the counts are scaled up from the time each was running.
+	*/
+	class PerfCounters
+	{
+	public:
+
+		static std::vector<std::string> const& Names()
+		{
+			static std::vector<std::string> names{"cycles", "instructions", "cache_misses", "branch_misses"};
+			return names;
+		}
+
+	#ifdef __linux__
+		PerfCounters()
+		{
+			const std::uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+			for (auto config : configs)
+			{
+				perf_event_attr attr;
+				std::memset(&attr, 0, sizeof(attr));
+				attr.size = sizeof(attr);
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = config;
+				attr.disabled = fds_.empty() ? 1 : 0; // the leader starts the group
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+				int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, fds_.empty() ? -1 : fds_.front(), 0));
+				if (fd < 0)
+				{
+					error_ = std::string("unable to open hardware performance counters: ") + std::strerror(errno);
+					Close();
+					return;
+				}
+				fds_.push_back(fd);
+			}
+		}
+
+		~PerfCounters()
+		{
+			Close();
+		}
+
+		PerfCounters(PerfCounters const&) = delete;
+		PerfCounters& operator=(PerfCounters const&) = delete;
+
+		bool Available() const
+		{
+			return !fds_.empty();
+		}
+
+		/**
+		\brief Zero the counters and start counting.
+		*/
+		void Start()
+		{
+			if (!Available())
+				return;
+			ioctl(fds_.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(fds_.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+
+		/**
+		\brief Stop counting, and get the counts since Start, in the order of Names.
+		*/
+		std::vector<double> Stop()
+		{
+			if (!Available())
+				return {};
+			ioctl(fds_.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+			// nr, time enabled, time running, then a value for each counter.
+			std::vector<std::uint64_t> data(3 + fds_.size());
+			if (read(fds_.front(), data.data(), data.size()*sizeof(std::uint64_t)) != static_cast<ssize_t>(data.size()*sizeof(std::uint64_t)))
+				return {};
+
+			double scale = data[2] > 0 ? double(data[1])/data[2] : 0;
+			std::vector<double> counts;
+			for (std::size_t ii = 0; ii < fds_.size(); ++ii)
+				counts.push_back(data[3+ii]*scale);
+			return counts;
+		}
+
+	private:
+
+		void Close()
+		{
+			for (auto fd : fds_)
+				close(fd);
+			fds_.clear();
+		}
+
+		std::vector<int> fds_; ///< The leader of the group first.
+	#else
+		PerfCounters() : error_("hardware performance counters are only read on Linux")
+		{}
+
+		bool Available() const
+		{
+			return false;
+		}
+
+		void Start()
+		{}
+
+		std::vector<double> Stop()
+		{
+			return {};
+		}
+
+	private:
+	#endif
+
+		std::string error_;
+
+	public:
+
+		std::string const& Error() const
+		{
+			return error_;
+		}
+	};
+
+
+	/**
+	\brief The state of one run of a benchmark, which counts and times the iterations of its loop.
+	*/
+	class State
+	{
+	public:
+		explicit
+		State(std::size_t max_iterations) : max_iterations_(max_iterations)
+		{}
+
+		/**
+		\brief Whether to run another iteration.  Starts the clocks on the first call, and stops them on the last.
+		*/
+		bool KeepRunning()
+		{
+			if (!started_)
+			{
+				started_ = true;
+				if (CountersEnabled())
+				{
+					counters_.reset(new PerfCounters);
+					counters_->Start();
+				}
+				start_real_ = std::chrono::steady_clock::now();
+				start_cpu_ = std::clock();
+			}
+
+			if (iterations_ < max_iterations_ && error_.empty())
+			{
+				++iterations_;
+				return true;
+			}
+
+			real_seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_real_).count();
+			cpu_seconds_ = double(std::clock() - start_cpu_) / CLOCKS_PER_SEC;
+			if (counters_)
+				counts_ = counters_->Stop();
+			return false;
+		}
+
+		/**
+		\brief Say something about this run, which is reported with it.
+		*/
+		void SetLabel(std::string const& label)
+		{
+			label_ = label;
+		}
+
+		/**
+		\brief Stop the run, reporting an error rather than a time.  The loop ends at the next call to KeepRunning.
+		*/
+		void SkipWithError(std::string const& error)
+		{
+			error_ = error;
+		}
+
+		std::size_t Iterations() const { return iterations_; }
+		double RealSeconds() const { return real_seconds_; }
+		double CPUSeconds() const { return cpu_seconds_; }
+		std::string const& Label() const { return label_; }
+		std::string const& Error() const { return error_; }
+		std::vector<double> const& Counts() const { return counts_; } ///< Over the whole loop, in the order of PerfCounters::Names.  Empty if not read.
+
+	private:
+		std::size_t max_iterations_;
+		std::size_t iterations_ = 0;
+		bool started_ = false;
+		std::chrono::steady_clock::time_point start_real_;
+		std::clock_t start_cpu_ = 0;
+		double real_seconds_ = 0;
+		double cpu_seconds_ = 0;
+		std::string label_;
+		std::string error_;
+		std::unique_ptr<PerfCounters> counters_;
+		std::vector<double> counts_;
+	};
+
+
+	using Function = std::function<void(State&)>;
+
+	struct Benchmark
+	{
+		std::string name;
+		Function function;
+	};
+
+	struct Result
+	{
+		std::string name;
+		std::size_t iterations;
+		double real_ns; ///< Per iteration.
+		double cpu_ns; ///< Per iteration.
+		std::string label;
+		std::string error;
+		std::vector<double> counters; ///< Per iteration, in the order of PerfCounters::Names.  Empty if not read.
+		unsigned repetitions = 1;
+		double real_ns_stddev = 0; ///< The sample standard deviation of real_ns over the repetitions.  0 if only one.
+	};
+
+
+	inline
+	std::vector<Benchmark>& Registry()
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+	inline
+	void Register(std::string const& name, Function f)
+	{
+		Registry().push_back(Benchmark{name, f});
+	}
+
+
+	inline
+	Result Summarize(Benchmark const& b, State const& state)
+	{
+		auto n = std::max<std::size_t>(state.Iterations(), 1);
+		std::vector<double> counters;
+		for (auto c : state.Counts())
+			counters.push_back(c/n);
+		return Result{b.name, state.Iterations(), 1e9*state.RealSeconds()/n, 1e9*state.CPUSeconds()/n, state.Label(), state.Error(), counters};
+	}
+
+
+	/**
+	\brief Run a benchmark, growing the number of iterations until a run takes at least min_seconds.
+	*/
+	inline
+	Result Run(Benchmark const& b, double min_seconds)
+	{
+		std::size_t iterations = 1;
+		while (true)
+		{
+			State state(iterations);
+			b.function(state);
+
+			bool long_enough = state.RealSeconds() >= min_seconds || iterations >= 1000000000;
+			if (!state.Error().empty() || long_enough)
+				return Summarize(b, state);
+
+			// aim past the minimum, as Google Benchmark does, but grow by at most 10x at once.
+			double per_iteration = std::max(state.RealSeconds(), 1e-9) / iterations;
+			double wanted = 1.4 * min_seconds / per_iteration;
+			iterations = std::max(iterations+1, std::min<std::size_t>(10*iterations, static_cast<std::size_t>(wanted)));
+		}
+	}
+
+
+	/**
+	\brief Run a benchmark several times, with the number of iterations found by Run, reporting the mean time per iteration and its standard deviation.
+	*/
+	inline
+	Result RunRepeated(Benchmark const& b, double min_seconds, unsigned repetitions)
+	{
+		auto result = Run(b, min_seconds);
+		if (repetitions < 2 || !result.error.empty())
+			return result;
+
+		std::vector<double> real{result.real_ns};
+		double cpu = result.cpu_ns;
+		for (unsigned ii = 1; ii < repetitions; ++ii)
+		{
+			State state(result.iterations);
+			b.function(state);
+			auto r = Summarize(b, state);
+			if (!r.error.empty())
+				return r;
+
+			real.push_back(r.real_ns);
+			cpu += r.cpu_ns;
+			for (std::size_t jj = 0; jj < std::min(r.counters.size(), result.counters.size()); ++jj)
+				result.counters[jj] += r.counters[jj];
+		}
+
+		double mean = 0;
+		for (auto x : real)
+			mean += x;
+		mean /= repetitions;
+
+		double variance = 0;
+		for (auto x : real)
+			variance += (x-mean)*(x-mean);
+		variance /= repetitions-1;
+
+		result.real_ns = mean;
+		result.real_ns_stddev = std::sqrt(variance);
+		result.cpu_ns = cpu/repetitions;
+		for (auto& c : result.counters)
+			c /= repetitions;
+		result.repetitions = repetitions;
+		return result;
+	}
+
+
+	inline
+	std::string JSONEscape(std::string const& s)
+	{
+		std::string escaped;
+		for (char c : s)
+		{
+			if (c=='"' || c=='\\')
+				escaped.push_back('\\');
+			escaped.push_back(c);
+		}
+		return escaped;
+	}
+
+
+	inline
+	void ReportJSON(std::ostream & out, std::vector<Result> const& results, std::vector<std::pair<std::string, std::string>> const& context)
+	{
+		out << "{\n  \"context\": {\n";
+		for (auto const& c : context)
+			out << "    \"" << JSONEscape(c.first) << "\": \"" << JSONEscape(c.second) << "\",\n";
+		out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n  },\n";
+
+		out << "  \"benchmarks\": [";
+		for (std::size_t ii = 0; ii < results.size(); ++ii)
+		{
+			auto const& r = results[ii];
+			out << (ii==0 ? "\n" : ",\n") << "    {\n"
+			    << "      \"name\": \"" << JSONEscape(r.name) << "\",\n";
+			if (!r.error.empty())
+				out << "      \"error_occurred\": true,\n"
+				    << "      \"error_message\": \"" << JSONEscape(r.error) << "\",\n";
+			if (!r.label.empty())
+				out << "      \"label\": \"" << JSONEscape(r.label) << "\",\n";
+			out << "      \"iterations\": " << r.iterations << ",\n"
+			    << "      \"repetitions\": " << r.repetitions << ",\n"
+			    << std::setprecision(6)
+			    << "      \"real_time\": " << r.real_ns << ",\n"
+			    << "      \"real_time_stddev\": " << r.real_ns_stddev << ",\n"
+			    << "      \"cpu_time\": " << r.cpu_ns << ",\n";
+			for (std::size_t jj = 0; jj < r.counters.size(); ++jj)
+				out << "      \"" << PerfCounters::Names()[jj] << "\": " << r.counters[jj] << ",\n";
+			out << "      \"time_unit\": \"ns\"\n"
+			    << "    }";
+		}
+		out << "\n  ]\n}\n";
+	}
+
+
+	inline
+	void ReportConsoleHeader(std::ostream & out, std::size_t name_width)
+	{
+		out << std::left << std::setw(name_width) << "Benchmark" << std::right
+		    << std::setw(16) << "Time (ns)" << std::setw(16) << "CPU (ns)" << std::setw(14) << "Iterations" << "\n"
+		    << std::string(name_width+46, '-') << "\n";
+	}
+
+	inline
+	void ReportConsole(std::ostream & out, Result const& r, std::size_t name_width)
+	{
+		out << std::left << std::setw(name_width) << r.name << std::right;
+		if (!r.error.empty())
+			out << "  ERROR: " << r.error << "\n";
+		else
+		{
+			out << std::fixed << std::setprecision(0)
+			    << std::setw(16) << r.real_ns << std::setw(16) << r.cpu_ns << std::setw(14) << r.iterations;
+			for (std::size_t jj = 0; jj < r.counters.size(); ++jj)
+				out << "  " << PerfCounters::Names()[jj] << "=" << r.counters[jj];
+			if (r.counters.size() > 1 && r.counters[0] > 0)
+				out << "  IPC=" << std::setprecision(2) << r.counters[1]/r.counters[0];
+			if (r.repetitions > 1 && r.real_ns > 0)
+				out << "  stddev=" << std::setprecision(1) << 100*r.real_ns_stddev/r.real_ns << "%";
+			out << "  " << r.label << "\n" << std::defaultfloat;
+		}
+	}
+
+
+	namespace detail {
+
+		/**
+		\brief A JSON value, as read by ParseJSON.  Enough of JSON to read back the reports of ReportJSON, and those of Google Benchmark.
+		*/
+		struct JSONValue
+		{
+			enum class Kind { Null, Bool, Number, String, Array, Object };
+
+			Kind kind = Kind::Null;
+			double number = 0;
+			std::string string;
+			std::vector<JSONValue> items;
+			std::vector<std::pair<std::string, JSONValue>> members;
+
+			JSONValue const* Find(std::string const& key) const
+			{
+				for (auto const& m : members)
+					if (m.first==key)
+						return &m.second;
+				return nullptr;
+			}
+		};
+
+		class JSONParser
+		{
+		public:
+			explicit
+			JSONParser(std::string const& text) : text_(text)
+			{}
+
+			JSONValue Parse()
+			{
+				auto v = Value();
+				SkipSpace();
+				if (pos_!=text_.size())
+					Fail("trailing characters");
+				return v;
+			}
+
+		private:
+
+			[[noreturn]] void Fail(std::string const& what) const
+			{
+				throw std::runtime_error("malformed JSON at character " + std::to_string(pos_) + ": " + what);
+			}
+
+			void SkipSpace()
+			{
+				while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_])))
+					++pos_;
+			}
+
+			char Peek()
+			{
+				SkipSpace();
+				if (pos_==text_.size())
+					Fail("unexpected end");
+				return text_[pos_];
+			}
+
+			void Expect(char c)
+			{
+				if (Peek()!=c)
+					Fail(std::string("expected ") + c);
+				++pos_;
+			}
+
+			bool Match(std::string const& word)
+			{
+				if (text_.compare(pos_, word.size(), word)!=0)
+					return false;
+				pos_ += word.size();
+				return true;
+			}
+
+			std::string String()
+			{
+				Expect('"');
+				std::string s;
+				while (pos_ < text_.size() && text_[pos_]!='"')
+				{
+					if (text_[pos_]=='\\' && pos_+1 < text_.size())
+					{
+						++pos_;
+						switch (text_[pos_])
+						{
+							case 'n': s.push_back('\n'); break;
+							case 't': s.push_back('\t'); break;
+							case 'u': s.push_back('?'); pos_ += 4; break; // benchmark names are ascii
+							default: s.push_back(text_[pos_]);
+						}
+					}
+					else
+						s.push_back(text_[pos_]);
+					++pos_;
+				}
+				Expect('"');
+				return s;
+			}
+
+			JSONValue Value()
+			{
+				JSONValue v;
+				char c = Peek();
+				if (c=='{')
+				{
+					v.kind = JSONValue::Kind::Object;
+					++pos_;
+					if (Peek()=='}')
+						++pos_;
+					else
+						while (true)
+						{
+							auto key = String();
+							Expect(':');
+							v.members.emplace_back(key, Value());
+							if (Peek()==',')
+								++pos_;
+							else
+							{
+								Expect('}');
+								break;
+							}
+						}
+				}
+				else if (c=='[')
+				{
+					v.kind = JSONValue::Kind::Array;
+					++pos_;
+					if (Peek()==']')
+						++pos_;
+					else
+						while (true)
+						{
+							v.items.push_back(Value());
+							if (Peek()==',')
+								++pos_;
+							else
+							{
+								Expect(']');
+								break;
+							}
+						}
+				}
+				else if (c=='"')
+				{
+					v.kind = JSONValue::Kind::String;
+					v.string = String();
+				}
+				else if (Match("true"))
+				{
+					v.kind = JSONValue::Kind::Bool;
+					v.number = 1;
+				}
+				else if (Match("false"))
+					v.kind = JSONValue::Kind::Bool;
+				else if (Match("null"))
+				{}
+				else
+				{
+					char const* begin = text_.c_str() + pos_;
+					char* end;
+					v.kind = JSONValue::Kind::Number;
+					v.number = std::strtod(begin, &end);
+					if (end==begin)
+						Fail("expected a value");
+					pos_ += end-begin;
+				}
+				return v;
+			}
+
+			std::string const& text_;
+			std::size_t pos_ = 0;
+		};
+
+	} // namespace detail
+
+
+	/**
+	\brief Read the results of a run written by ReportJSON, such as a stored baseline.
+
+	Only the fields written by ReportJSON are read, so Google Benchmark output can be read too, though its aggregates of repetitions are read as separate benchmarks.
+
+	\throws std::runtime_error If the file cannot be read, or is not JSON with a list of benchmarks.
+	*/
+	inline
+	std::vector<Result> ReadJSON(std::string const& filename)
+	{
+		std::ifstream in(filename);
+		if (!in)
+			throw std::runtime_error("unable to open benchmark results " + filename);
+		std::stringstream buffer;
+		buffer << in.rdbuf();
+		auto text = buffer.str();
+
+		auto root = detail::JSONParser(text).Parse();
+		auto benchmarks = root.Find("benchmarks");
+		if (!benchmarks || benchmarks->kind!=detail::JSONValue::Kind::Array)
+			throw std::runtime_error(filename + " has no list of benchmarks");
+
+		std::vector<Result> results;
+		for (auto const& b : benchmarks->items)
+		{
+			auto number = [&b](char const* key, double otherwise)
+				{
+					auto v = b.Find(key);
+					return v && v->kind==detail::JSONValue::Kind::Number ? v->number : otherwise;
+				};
+			auto string = [&b](char const* key)
+				{
+					auto v = b.Find(key);
+					return v && v->kind==detail::JSONValue::Kind::String ? v->string : std::string();
+				};
+
+			Result r;
+			r.name = string("name");
+			r.iterations = static_cast<std::size_t>(number("iterations", 0));
+			r.real_ns = number("real_time", 0);
+			r.cpu_ns = number("cpu_time", 0);
+			r.label = string("label");
+			r.error = string("error_message");
+			r.repetitions = static_cast<unsigned>(number("repetitions", 1));
+			r.real_ns_stddev = number("real_time_stddev", 0);
+			results.push_back(r);
+		}
+		return results;
+	}
+
+
+	/**
+	\brief The change in time of one benchmark, between a baseline and the current run.
+	*/
+	struct Comparison
+	{
+		std::string name;
+		std::string kernel; ///< The operation benchmarked, the first part of the name, like Eval or PredictRK4.
+		std::string precision; ///< The number type or precision, the last part of the name, like dbl, mpfr50, or prec30.  Empty for names of fewer than three parts.
+		double baseline_ns;
+		double current_ns;
+		double delta; ///< The relative change in time, current/baseline - 1.  Positive is slower.
+		bool tested; ///< Whether both runs had repetitions, so that Welch's t-test was done.  If not, only the threshold applies.
+		bool significant; ///< Whether the change passes both the threshold and, if tested, the t-test.
+
+		bool Slower() const { return significant && delta > 0; }
+		bool Faster() const { return significant && delta < 0; }
+	};
+
+
+	/**
+	\brief The two-sided 95% critical value of Student's t distribution, for a number of degrees of freedom.
+	*/
+	inline
+	double StudentT95(double degrees_of_freedom)
+	{
+		static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+		                               2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+		                               2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+		auto df = static_cast<int>(std::floor(degrees_of_freedom));
+		if (df < 1)
+			return table[0];
+		if (df > 30)
+			return 1.96;
+		return table[df-1];
+	}
+
+
+	/**
+	\brief Compare the times of the benchmarks run both in a baseline and now.
+
+	A change is significant if it is larger than the threshold, relative to the baseline time, and, when both runs have at least two repetitions, if Welch's t-test on the means rejects equal times at the 95% level.  Benchmarks in only one of the runs, or with an error in either, are left out.
+
+	\param baseline The results of the earlier run.
+	\param current The results of this run.
+	\param threshold The smallest relative change to flag, such as 0.05 for 5%.
+	*/
+	inline
+	std::vector<Comparison> Compare(std::vector<Result> const& baseline, std::vector<Result> const& current, double threshold)
+	{
+		std::map<std::string, Result const*> earlier;
+		for (auto const& r : baseline)
+			if (r.error.empty() && r.real_ns > 0)
+				earlier[r.name] = &r;
+
+		std::vector<Comparison> comparisons;
+		for (auto const& now : current)
+		{
+			auto found = earlier.find(now.name);
+			if (found==earlier.end() || !now.error.empty())
+				continue;
+			auto const& then = *found->second;
+
+			Comparison c;
+			c.name = now.name;
+			auto first = now.name.find('/'), last = now.name.rfind('/');
+			c.kernel = now.name.substr(0, first);
+			c.precision = first!=last ? now.name.substr(last+1) : "";
+			c.baseline_ns = then.real_ns;
+			c.current_ns = now.real_ns;
+			c.delta = now.real_ns/then.real_ns - 1;
+
+			c.tested = then.repetitions > 1 && now.repetitions > 1;
+			bool beyond_noise = true;
+			if (c.tested)
+			{
+				double v0 = then.real_ns_stddev*then.real_ns_stddev/then.repetitions;
+				double v1 = now.real_ns_stddev*now.real_ns_stddev/now.repetitions;
+				if (v0+v1 > 0)
+				{
+					double t = (now.real_ns - then.real_ns)/std::sqrt(v0+v1);
+					double df = (v0+v1)*(v0+v1) / (v0*v0/(then.repetitions-1) + v1*v1/(now.repetitions-1));
+					beyond_noise = std::abs(t) > StudentT95(df);
+				}
+			}
+			c.significant = std::abs(c.delta) > threshold && beyond_noise;
+			comparisons.push_back(c);
+		}
+		return comparisons;
+	}
+
+
+	/**
+	\brief Write the comparisons, one line per benchmark, then a summary for each kernel at each precision: the geometric mean of the ratios of times, and the numbers significantly slower and faster.
+
+	\return The number of benchmarks significantly slower.
+	*/
+	inline
+	std::size_t ReportComparison(std::ostream & out, std::vector<Comparison> const& comparisons)
+	{
+		std::size_t name_width = 10;
+		for (auto const& c : comparisons)
+			name_width = std::max(name_width, c.name.size()+2);
+
+		out << "\n" << std::left << std::setw(name_width) << "Benchmark" << std::right
+		    << std::setw(16) << "Baseline (ns)" << std::setw(16) << "Current (ns)" << std::setw(10) << "Change" << "\n"
+		    << std::string(name_width+42, '-') << "\n";
+
+		struct Summary
+		{
+			double sum_log_ratio = 0;
+			std::size_t count = 0, slower = 0, faster = 0;
+		};
+		std::map<std::pair<std::string, std::string>, Summary> summaries;
+
+		std::size_t num_slower = 0;
+		for (auto const& c : comparisons)
+		{
+			out << std::left << std::setw(name_width) << c.name << std::right << std::fixed
+			    << std::setprecision(0) << std::setw(16) << c.baseline_ns << std::setw(16) << c.current_ns
+			    << std::showpos << std::setprecision(1) << std::setw(9) << 100*c.delta << "%" << std::noshowpos;
+			if (c.Slower())
+				out << "  SLOWER";
+			else if (c.Faster())
+				out << "  faster";
+			if (c.significant && !c.tested)
+				out << " (untested, no repetitions)";
+			out << "\n" << std::defaultfloat;
+
+			auto& s = summaries[{c.kernel, c.precision}];
+			s.sum_log_ratio += std::log1p(c.delta);
+			++s.count;
+			s.slower += c.Slower();
+			s.faster += c.Faster();
+			num_slower += c.Slower();
+		}
+
+		out << "\n" << std::left << std::setw(24) << "Kernel" << std::setw(12) << "Precision" << std::right
+		    << std::setw(12) << "Mean change" << std::setw(10) << "Slower" << std::setw(10) << "Faster" << std::setw(8) << "Of" << "\n"
+		    << std::string(76, '-') << "\n";
+		for (auto const& s : summaries)
+		{
+			double mean_change = std::expm1(s.second.sum_log_ratio/s.second.count);
+			out << std::left << std::setw(24) << s.first.first << std::setw(12) << s.first.second << std::right << std::fixed
+			    << std::showpos << std::setprecision(1) << std::setw(11) << 100*mean_change << "%" << std::noshowpos
+			    << std::setw(10) << s.second.slower << std::setw(10) << s.second.faster << std::setw(8) << s.second.count << "\n" << std::defaultfloat;
+		}
+
+		out << "\n" << num_slower << " of " << comparisons.size() << " benchmarks significantly slower than the baseline\n";
+		return num_slower;
+	}
+
+
+	/**
+	\brief How to run the registered benchmarks, and whether to compare them against a baseline.
+	*/
+	struct RunOptions
+	{
+		std::string filter = "."; ///< Only benchmarks whose names match this regular expression are run.
+		double min_seconds = 0.5; ///< The least time to run each benchmark for, in each repetition.
+		unsigned repetitions = 1; ///< The number of times to run each benchmark.  At least two are needed to test the significance of a change from a baseline.
+		bool json = false; ///< Whether to report as JSON, rather than as a table.
+		std::string baseline; ///< A JSON report of an earlier run, to compare against.  Empty not to compare.
+		double threshold = 0.05; ///< The smallest relative change flagged in a comparison.
+	};
+
+
+	/**
+	\brief Run the registered benchmarks whose names match a regular expression, reporting to standard out.
+
+	With a baseline, the comparison is reported after the results, to standard out, or to standard error when reporting JSON, so the JSON can still be stored as the next baseline.
+
+	\param options What to run, and how.
+	\param context Name-value pairs describing the run, put in the JSON.
+	\return 1 if any benchmark failed or is significantly slower than the baseline, 0 otherwise.
+	*/
+	inline
+	int RunMatching(RunOptions const& options, std::vector<std::pair<std::string, std::string>> const& context)
+	{
+		std::regex pattern(options.filter);
+
+		std::vector<Result> baseline;
+		if (!options.baseline.empty())
+			baseline = ReadJSON(options.baseline); // before running, to fail early
+
+		if (CountersEnabled())
+		{
+			PerfCounters probe;
+			if (!probe.Available())
+				std::cerr << probe.Error() << ", reporting times only\n";
+		}
+
+		std::size_t name_width = 10;
+		std::vector<Benchmark const*> selected;
+		for (auto const& b : Registry())
+			if (std::regex_search(b.name, pattern))
+			{
+				selected.push_back(&b);
+				name_width = std::max(name_width, b.name.size()+2);
+			}
+
+		if (!options.json)
+			ReportConsoleHeader(std::cout, name_width);
+
+		std::vector<Result> results;
+		for (auto b : selected)
+		{
+			results.push_back(RunRepeated(*b, options.min_seconds, options.repetitions));
+			if (!options.json)
+				ReportConsole(std::cout, results.back(), name_width);
+		}
+
+		if (options.json)
+			ReportJSON(std::cout, results, context);
+
+		bool failed = std::any_of(results.begin(), results.end(), [](Result const& r){ return !r.error.empty(); });
+		if (!options.baseline.empty())
+		{
+			auto comparisons = Compare(baseline, results, options.threshold);
+			failed = ReportComparison(options.json ? std::cerr : std::cout, comparisons) > 0 || failed;
+		}
+
+		return failed ? 1 : 0;
+	}
+
+} // namespace benchmark
+} // namespace bertini
+
+#endif
@@ -0,0 +1,173 @@
+//This file is part of Bertini 2.
+//
+//systems.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//systems.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with systems.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file systems.hpp
+
+\brief The standard systems benchmarked by b2_benchmark, and total degree homotopies to them.
+*/
+
+#ifndef BERTINI_TEST_BENCHMARK_SYSTEMS_HPP
+#define BERTINI_TEST_BENCHMARK_SYSTEMS_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/start_system.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bertini {
+namespace benchmark {
+
+	using Var = std::shared_ptr<node::Variable>;
+
+	inline
+	std::vector<Var> MakeVariables(std::string const& prefix, unsigned n)
+	{
+		std::vector<Var> v;
+		for (unsigned ii = 0; ii < n; ++ii)
+			v.push_back(std::make_shared<node::Variable>(prefix + std::to_string(ii)));
+		return v;
+	}
+
+	inline
+	System WithVariables(std::vector<Var> const& v)
+	{
+		System sys;
+		sys.AddVariableGroup(VariableGroup(v.begin(), v.end()));
+		return sys;
+	}
+
+
+	/**
+	\brief Katsura-n, n+1 equations in n+1 variables, with \f$2^n\f$ solutions.
+
+	\f$\sum_{l=-n}^n x_{|l|} x_{|m-l|} = x_m\f$ for \f$m=0,\dots,n-1\f$, where \f$x_k=0\f$ for \f$k>n\f$, and \f$\sum_{l=-n}^n x_{|l|} = 1\f$.
+	*/
+	inline
+	System Katsura(unsigned n)
+	{
+		auto x = MakeVariables("x", n+1);
+		System sys = WithVariables(x);
+
+		for (int m = 0; m < int(n); ++m)
+		{
+			std::shared_ptr<node::Node> f = -x[m];
+			for (int l = -int(n); l <= int(n); ++l)
+				if (std::abs(m-l) <= int(n))
+					f = f + x[std::abs(l)]*x[std::abs(m-l)];
+			sys.AddFunction(f);
+		}
+
+		std::shared_ptr<node::Node> f = std::make_shared<node::Integer>(-1);
+		for (int l = -int(n); l <= int(n); ++l)
+			f = f + x[std::abs(l)];
+		sys.AddFunction(f);
+
+		return sys;
+	}
+
+
+	/**
+	\brief Cyclic-n, n equations in n variables.
+
+	\f$\sum_{i=0}^{n-1} \prod_{j=i}^{i+k-1} x_{j \bmod n} = 0\f$ for \f$k=1,\dots,n-1\f$, and \f$\prod_i x_i = 1\f$.
+	*/
+	inline
+	System Cyclic(unsigned n)
+	{
+		auto x = MakeVariables("x", n);
+		System sys = WithVariables(x);
+
+		for (unsigned k = 1; k < n; ++k)
+		{
+			std::shared_ptr<node::Node> f;
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				std::shared_ptr<node::Node> term = x[ii];
+				for (unsigned jj = ii+1; jj < ii+k; ++jj)
+					term = term * x[jj % n];
+				f = f ? f + term : term;
+			}
+			sys.AddFunction(f);
+		}
+
+		std::shared_ptr<node::Node> prod = x[0];
+		for (unsigned ii = 1; ii < n; ++ii)
+			prod = prod * x[ii];
+		sys.AddFunction(prod - 1);
+
+		return sys;
+	}
+
+
+	/**
+	\brief The Griewank-Osborne system, whose isolated solution at the origin is singular, of multiplicity 3.
+	*/
+	inline
+	System GriewankOsborne()
+	{
+		auto v = MakeVariables("x", 2);
+		System sys = WithVariables(v);
+
+		sys.AddFunction(mpq_rational(29,16)*pow(v[0],3) - 2*v[0]*v[1]);
+		sys.AddFunction(v[1] - pow(v[0],2));
+
+		return sys;
+	}
+
+
+	/**
+	\brief A total degree homotopy \f$(1-t) f + t g\f$ to a target system, homogenized and patched, and a start point for it at \f$t=1\f$.
+	*/
+	template<typename T>
+	struct Homotopy
+	{
+		System system;
+		Vec<T> start_point;
+	};
+
+	template<typename T>
+	Homotopy<T> TotalDegreeHomotopy(System target)
+	{
+		target.Homogenize();
+		target.AutoPatch();
+
+		start_system::TotalDegree td(target);
+		td.Homogenize();
+
+		auto t = std::make_shared<node::Variable>("t");
+
+		Homotopy<T> h;
+		h.system = (1-t)*target + t*td;
+		h.system.AddPathVariable(t);
+		h.start_point = td.template StartPoint<T>(0);
+		return h;
+	}
+
+} // namespace benchmark
+} // namespace bertini
+
+#endif
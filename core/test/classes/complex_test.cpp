@@ -25,6 +25,8 @@
 
 
 #include "bertini2/num_traits.hpp"
+#include "bertini2/double_double.hpp"
+#include "bertini2/mp_allocator.hpp"
 #include <boost/test/unit_test.hpp>
 #include <fstream>
 
@@ -788,5 +790,120 @@ BOOST_AUTO_TEST_CASE(mpfr_float_serialization2)
 	
 }
 
+BOOST_AUTO_TEST_CASE(complex_multiply_add)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::complex a("0.3","-1.1"), b("0.1","1.2"), c("0.2","1.3");
+	bertini::complex expected = a + b*c;
+
+	a.MultiplyAdd(b,c);
+	BOOST_CHECK(abs(a - expected) < threshold_clearance_mp);
+
+	a.MultiplySubtract(b,c);
+	BOOST_CHECK(abs(a - bertini::complex("0.3","-1.1")) < threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_CASE(complex_karatsuba_multiplication)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::complex z("0.1","1.2"), v("0.2","1.3");
+	bertini::complex k = z;
+	k.MultiplyKaratsuba(v);
+
+	BOOST_CHECK(abs(real(k)-mpfr_float("-1.54")) < threshold_clearance_mp);
+	BOOST_CHECK(abs(imag(k)-mpfr_float("0.37")) < threshold_clearance_mp);
+
+	k = z;
+	k.MultiplyKaratsuba(k);
+	BOOST_CHECK(abs(k - z*z) < threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_CASE(double_double_carries_31_digits)
+{
+	using bertini::dd_real;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	dd_real third = dd_real(1)/3;
+	mpfr_float exact = mpfr_float(1)/3;
+	BOOST_CHECK(abs(static_cast<mpfr_float>(third) - exact) < mpfr_float("1e-31"));
+
+	// lost entirely in double
+	dd_real x = dd_real(1) + 1e-20;
+	BOOST_CHECK(x - 1 == dd_real(1e-20));
+
+	dd_real r = sqrt(dd_real(2));
+	BOOST_CHECK(abs(static_cast<mpfr_float>(r) - sqrt(mpfr_float(2))) < mpfr_float("1e-31"));
+}
+
+
+BOOST_AUTO_TEST_CASE(dd_complex_arithmetic_matches_complex)
+{
+	using bertini::dd_complex;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::complex z("0.1","1.2"), v("-0.3","0.7");
+	dd_complex zd(z), vd(v);
+
+	auto close = [](dd_complex const& a, bertini::complex const& b)
+	{
+		return abs(static_cast<bertini::complex>(a) - b) < mpfr_float("1e-30");
+	};
+
+	BOOST_CHECK(close(zd+vd, z+v));
+	BOOST_CHECK(close(zd-vd, z-v));
+	BOOST_CHECK(close(zd*vd, z*v));
+	BOOST_CHECK(close(zd/vd, z/v));
+	BOOST_CHECK(close(sqrt(zd), sqrt(z)));
+}
+
+
+BOOST_AUTO_TEST_CASE(dd_complex_lu_solve)
+{
+	using bertini::dd_complex;
+	using MatD = Eigen::Matrix<dd_complex, Eigen::Dynamic, Eigen::Dynamic>;
+	using VecD = Eigen::Matrix<dd_complex, Eigen::Dynamic, 1>;
+
+	MatD A(3,3);
+	A << dd_complex(2,1), dd_complex(0,-1), dd_complex(1),
+	     dd_complex(1), dd_complex(3,0.5), dd_complex(0,2),
+	     dd_complex(-1,1), dd_complex(1), dd_complex(4);
+
+	VecD x(3);
+	x << dd_complex(1,-1), dd_complex(0.5), dd_complex(0,3);
+
+	VecD b = A*x;
+	VecD y = A.lu().solve(b);
+
+	for (int ii = 0; ii < 3; ++ii)
+		BOOST_CHECK(static_cast<double>(abs(y(ii)-x(ii))) < 1e-29);
+}
+
+BOOST_AUTO_TEST_CASE(mp_allocator_reuses_limbs_of_freed_numbers)
+{
+	using namespace bertini::mp_allocator;
+	ScopedInstall install;
+	if (!IsInstalled())
+		return; // no thread_local in this build
+
+	bertini::complex a(1.5,-2), b(0.25,3);
+	bertini::complex expected = a*b + a;
+
+	auto before = GetThreadStatistics();
+	for (int ii = 0; ii < 10; ++ii)
+	{
+		bertini::complex c = a*b + a;
+		BOOST_CHECK(abs(c - expected) < 1e-14);
+	}
+	auto after = GetThreadStatistics();
+	BOOST_CHECK(after.num_reused > before.num_reused);
+
+	ReleaseThreadCache();
+	BOOST_CHECK_EQUAL(GetThreadStatistics().num_cached, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -33,6 +33,7 @@
 
 #include <iostream>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
 #include <vector>
@@ -1119,6 +1120,100 @@ BOOST_AUTO_TEST_CASE(arccosine_differentiate)
 	BOOST_CHECK(fabs(J->EvalJ<mpfr>(x).imag() / exact_mpfr.imag() -1) < threshold_clearance_mp);
 }
 
+BOOST_AUTO_TEST_CASE(sin_cos_exp_share_values_with_derivatives)
+{
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	auto S = sin(pow(x,2));
+	auto C = cos(x);
+	auto E = exp(x*3);
+	auto JS = std::make_shared<Jacobian>(S->Differentiate());
+	auto JC = std::make_shared<Jacobian>(C->Differentiate());
+	auto JE = std::make_shared<Jacobian>(E->Differentiate());
+
+	// the values shared between a node and its derivative must follow the argument from point to point, whichever is evaluated first
+	for (dbl x_val : {xnum_dbl, dbl(0.3,-0.8)})
+	{
+		x->set_current_value(x_val);
+		for (auto n : {S, C, E})
+			n->Reset();
+		for (auto n : {JS, JC, JE})
+			n->Reset();
+
+		BOOST_CHECK(abs(JS->EvalJ<dbl>(x) - dbl(2)*x_val*cos(x_val*x_val)) < threshold_clearance_d);
+		BOOST_CHECK(abs(S->Eval<dbl>() - sin(x_val*x_val)) < threshold_clearance_d);
+		BOOST_CHECK(abs(C->Eval<dbl>() - cos(x_val)) < threshold_clearance_d);
+		BOOST_CHECK(abs(JC->EvalJ<dbl>(x) + sin(x_val)) < threshold_clearance_d);
+		BOOST_CHECK(abs(JE->EvalJ<dbl>(x) - dbl(3)*exp(dbl(3)*x_val)) < threshold_clearance_d);
+		BOOST_CHECK(abs(E->Eval<dbl>() - exp(dbl(3)*x_val)) < threshold_clearance_d);
+	}
+
+	for (mpfr x_val : {xnum_mpfr, mpfr("0.3","-0.8")})
+	{
+		x->set_current_value(x_val);
+		for (auto n : {S, C, E})
+			n->Reset();
+		for (auto n : {JS, JC, JE})
+			n->Reset();
+
+		mpfr x_squared = x_val*x_val;
+		mpfr three_x = mpfr(3)*x_val;
+		BOOST_CHECK(abs(JS->EvalJ<mpfr>(x) - mpfr(2)*x_val*cos(x_squared)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(S->Eval<mpfr>() - sin(x_squared)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(C->Eval<mpfr>() - cos(x_val)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(JC->EvalJ<mpfr>(x) + sin(x_val)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(JE->EvalJ<mpfr>(x) - mpfr(3)*exp(three_x)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(E->Eval<mpfr>() - exp(three_x)) < threshold_clearance_mp);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(sin_cos_exp_shared_values_follow_a_raise_of_precision)
+{
+	using mpfr_float = bertini::mpfr_float;
+	bertini::DefaultPrecision(16);
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	auto S = sin(pow(x,2));
+	auto C = cos(x);
+	auto E = exp(x*3);
+	auto JS = std::make_shared<Jacobian>(S->Differentiate());
+	auto JC = std::make_shared<Jacobian>(C->Differentiate());
+	auto JE = std::make_shared<Jacobian>(E->Differentiate());
+
+	// a point exactly representable at both precisions, so the argument compares equal after the raise
+	x->set_current_value(mpfr("0.5","0.25"));
+	for (auto n : {S, C, E})
+		n->Eval<mpfr>();
+	for (auto n : {JS, JC, JE})
+		n->EvalJ<mpfr>(x);
+
+	bertini::DefaultPrecision(50);
+	for (auto n : {S, C, E})
+		n->precision(50);
+	for (auto n : {JS, JC, JE})
+		n->precision(50);
+	x->precision(50);
+	x->set_current_value(mpfr("0.5","0.25"));
+	for (auto n : {S, C, E})
+		n->Reset();
+	for (auto n : {JS, JC, JE})
+		n->Reset();
+
+	mpfr x_val("0.5","0.25");
+	mpfr x_squared = x_val*x_val;
+	mpfr three_x = mpfr(3)*x_val;
+	mpfr_float tol("1e-48");
+	BOOST_CHECK(abs(S->Eval<mpfr>() - sin(x_squared)) < tol);
+	BOOST_CHECK(abs(JS->EvalJ<mpfr>(x) - mpfr(2)*x_val*cos(x_squared)) < tol);
+	BOOST_CHECK(abs(JC->EvalJ<mpfr>(x) + sin(x_val)) < tol);
+	BOOST_CHECK(abs(C->Eval<mpfr>() - cos(x_val)) < tol);
+	BOOST_CHECK(abs(E->Eval<mpfr>() - exp(three_x)) < tol);
+	BOOST_CHECK(abs(JE->EvalJ<mpfr>(x) - mpfr(3)*exp(three_x)) < tol);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
 BOOST_AUTO_TEST_CASE(arctangent_differentiate)
 {
 	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
@@ -1208,4 +1303,85 @@ BOOST_AUTO_TEST_CASE(integer_power_system)
 	BOOST_CHECK(abs( imag(J(0,0)) - mpfr_float("0.871779788708134710447396396772")) < threshold_clearance_mp);
 }
 
+
+BOOST_AUTO_TEST_CASE(memoized_differentiation_shares_derivatives)
+{
+	bertini::Var x = std::make_shared<Variable>("x");
+	bertini::Var y = std::make_shared<Variable>("y");
+
+	std::shared_ptr<Node> g = x*y + pow(x,3);
+	std::shared_ptr<Node> f1 = g*x + g;
+	std::shared_ptr<Node> f2 = sin(g) - y;
+
+	// without a memo, each use of g is differentiated afresh
+	BOOST_CHECK(bertini::node::DerivativeOf(g) != bertini::node::DerivativeOf(g));
+
+	std::shared_ptr<Node> d1, d2;
+	{
+		bertini::node::DifferentiationMemo memo;
+		auto dg = bertini::node::DerivativeOf(g);
+		BOOST_CHECK(bertini::node::DerivativeOf(g) == dg);
+		auto size = memo.Size();
+		d1 = bertini::node::DerivativeOf(f1);
+		d2 = bertini::node::DerivativeOf(f2);
+		BOOST_CHECK(memo.Size() > size);
+	}
+
+	// the derivatives are the same as without the memo
+	x->set_current_value(dbl(0.3,0.1));
+	y->set_current_value(dbl(-0.6,0.4));
+	for (auto const& pair : {std::make_pair(f1,d1), std::make_pair(f2,d2)})
+	{
+		auto memoized = std::make_shared<Jacobian>(pair.second);
+		auto fresh = std::make_shared<Jacobian>(pair.first->Differentiate());
+		for (auto const& v : {x,y})
+			BOOST_CHECK(abs(memoized->EvalJ<dbl>(v) - fresh->EvalJ<dbl>(v)) < threshold_clearance_d);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(derivative_marked_with_differential_dependence_evaluates_by_column)
+{
+	bertini::Var x = std::make_shared<Variable>("x");
+	bertini::Var y = std::make_shared<Variable>("y");
+	bertini::Var z = std::make_shared<Variable>("z");
+
+	std::shared_ptr<Node> f = x*y + pow(z,2)*x - sin(y) + exp(z)/y;
+
+	auto marked = std::make_shared<Jacobian>(f->Differentiate());
+	auto fresh = std::make_shared<Jacobian>(f->Differentiate());
+
+	// variables are made with ids of their own
+	BOOST_CHECK(x->Id() != y->Id());
+	BOOST_CHECK(y->Id() != z->Id());
+
+	auto involved = bertini::node::MarkDifferentialDependence(marked);
+	marked->DifferentialNodes(involved);
+	BOOST_CHECK(!involved.empty());
+	for (auto const& v : {x,y,z})
+		BOOST_CHECK(marked->DependsOnDifferential(v->Id()));
+
+	// the parts of the derivative of x*y involve dx and dy, but not dz
+	auto dxy = std::make_shared<Jacobian>((x*y)->Differentiate());
+	bertini::node::MarkDifferentialDependence(dxy);
+	std::vector<bertini::node::VariableId> ids{x->Id(), y->Id()};
+	std::sort(ids.begin(), ids.end());
+	BOOST_CHECK(dxy->DifferentialDependence() == ids);
+	BOOST_CHECK(!dxy->DependsOnDifferential(z->Id()));
+
+	x->set_current_value(dbl(0.3,0.1));
+	y->set_current_value(dbl(-0.6,0.4));
+	z->set_current_value(dbl(0.2,-0.9));
+	for (auto const& v : {x,y,z})
+		BOOST_CHECK(abs(marked->EvalJ<dbl>(v) - fresh->EvalJ<dbl>(v)) < threshold_clearance_d);
+
+	// column by column at one point, only the derivative parts are evaluated again
+	marked->Reset();
+	for (auto const& v : {x,y,z,x})
+	{
+		dbl value;
+		marked->EvalJColumnInPlace(value, v->Id());
+		BOOST_CHECK(abs(value - fresh->EvalJ<dbl>(v)) < threshold_clearance_d);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
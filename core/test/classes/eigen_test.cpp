@@ -315,6 +315,36 @@ BOOST_AUTO_TEST_SUITE(kahan_matrix_solving_LU)
 	}
 
 
+	BOOST_AUTO_TEST_CASE(inverse_one_norm_estimate_d)
+	{
+		using dbl = std::complex<double>;
+		bertini::Mat<dbl> A(3,3);
+		A << dbl(4,1), dbl(1), dbl(0,-2),
+			 dbl(1),   dbl(3), dbl(1),
+			 dbl(0,2), dbl(-1), dbl(5,-1);
+
+		auto LU = A.lu();
+		double exact = A.inverse().cwiseAbs().colwise().sum().maxCoeff();
+		double estimate = bertini::InverseOneNormEstimate(LU);
+
+		// a lower bound, and for a matrix this small, sharp.
+		BOOST_CHECK(estimate <= exact*(1+1e-12));
+		BOOST_CHECK(estimate >= exact/3);
+	}
+
+	BOOST_AUTO_TEST_CASE(inverse_one_norm_estimate_mp)
+	{
+		using data_type = bertini::mpfr;
+		bertini::Mat<data_type> A(2,2);
+		A << data_type(2), data_type(0), data_type(0), data_type("0.001");
+
+		auto LU = A.lu();
+		mpfr_float estimate = bertini::InverseOneNormEstimate(LU);
+
+		BOOST_CHECK(abs(estimate - mpfr_float(1000)) < threshold_clearance_mp);
+	}
+
+
 	BOOST_AUTO_TEST_CASE(eigen_norm_of_vector)
 	{
 		Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A(1,3);
@@ -38,6 +38,8 @@
 
 #include "bertini2/bertini.hpp"
 #include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/function_tree/straight_line_program.hpp"
 
 
 #include <boost/spirit/include/qi.hpp>
@@ -143,6 +145,46 @@ BOOST_AUTO_TEST_CASE(manual_construction_sqrt_x){
 }
 
 
+BOOST_AUTO_TEST_CASE(sum_compensated_summation_d){
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+	std::shared_ptr<Variable> z = std::make_shared<Variable>("z");
+
+	x->set_current_value<dbl>(dbl(1e16, 1e16));
+	y->set_current_value<dbl>(dbl(1, 1));
+	z->set_current_value<dbl>(dbl(1e16, 1e16));
+
+	auto N = std::make_shared<bertini::node::SumOperator>(x, true, y, true);
+	N->AddChild(z, false);
+
+	N->CompensatedSummation(true);
+	dbl v = N->Eval<dbl>();
+
+	BOOST_CHECK_EQUAL(v.real(), 1);
+	BOOST_CHECK_EQUAL(v.imag(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(mult_divides_in_turn_d){
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+	std::shared_ptr<Variable> z = std::make_shared<Variable>("z");
+
+	// the product of the divisors overflows, though neither quotient does
+	x->set_current_value<dbl>(dbl(1e300, 0));
+	y->set_current_value<dbl>(dbl(1e200, 0));
+	z->set_current_value<dbl>(dbl(1e200, 0));
+
+	auto N = std::make_shared<bertini::node::MultOperator>(x, true, y, false);
+	N->AddChild(z, false);
+
+	dbl v = N->Eval<dbl>();
+
+	BOOST_CHECK(fabs(v.real()/1e-100 - 1) < threshold_clearance_d);
+	BOOST_CHECK_EQUAL(v.imag(), 0);
+}
+
+
 BOOST_AUTO_TEST_CASE(manual_construction_x_plus_y_plus_number){
 	using mpfr_float = bertini::mpfr_float;
 	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
@@ -1823,6 +1865,234 @@ BOOST_AUTO_TEST_CASE(function_tree_combine_product_of_two_integer_powers)
 
 
 
+BOOST_AUTO_TEST_CASE(node_precision_set_before_multiple_precision_evaluation)
+{
+	bertini::DefaultPrecision(30);
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Node> N = x*x + 1;
+
+	x->set_current_value(dbl(2,1));
+	BOOST_CHECK(abs(N->Eval<dbl>() - dbl(4,4)) < threshold_clearance_d);
+
+	// no multiple precision value has been made yet, but the precision must still stick
+	N->precision(50);
+	BOOST_CHECK_EQUAL(N->precision(), 50);
+
+	bertini::DefaultPrecision(50);
+	x->set_current_value(mpfr(2,1));
+	auto v = N->Eval<mpfr>();
+	BOOST_CHECK_EQUAL(v.precision(), 50);
+	BOOST_CHECK(abs(v - mpfr(4,4)) < threshold_clearance_mp);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(integer_powers_of_variable_share_power_table)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Node> N = pow(x,2) + pow(x,7) - pow(x,-3);
+	std::shared_ptr<Node> M = pow(x+1,6);
+
+	for (dbl x_val : {xnum_dbl, dbl(-0.4,1.3)})
+	{
+		x->set_current_value(x_val);
+		N->Reset();
+		M->Reset();
+
+		dbl exact = x_val*x_val + x_val*x_val*x_val*x_val*x_val*x_val*x_val - dbl(1)/(x_val*x_val*x_val);
+		BOOST_CHECK(abs(N->Eval<dbl>() - exact) < threshold_clearance_d);
+		BOOST_CHECK(abs(M->Eval<dbl>() - std::pow(x_val+dbl(1),6)) < threshold_clearance_d);
+	}
+
+	for (mpfr x_val : {xnum_mpfr, mpfr("-0.4","1.3")})
+	{
+		x->set_current_value(x_val);
+		N->Reset();
+		M->Reset();
+
+		mpfr exact = x_val*x_val + x_val*x_val*x_val*x_val*x_val*x_val*x_val - mpfr(1)/(x_val*x_val*x_val);
+		mpfr shifted = x_val+mpfr(1);
+		BOOST_CHECK(abs(N->Eval<mpfr>() - exact) < threshold_clearance_mp);
+		BOOST_CHECK(abs(M->Eval<mpfr>() - shifted*shifted*shifted*shifted*shifted*shifted) < threshold_clearance_mp);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(eval_ref_refers_to_cached_value)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+	std::shared_ptr<Node> N = x*y - x/y + pow(x,3);
+
+	x->set_current_value(xnum_mpfr);
+	y->set_current_value(ynum_mpfr);
+	N->Reset();
+
+	mpfr const& first = N->EvalRef<mpfr>();
+	mpfr const& second = N->EvalRef<mpfr>();
+	BOOST_CHECK_EQUAL(&first, &second);
+
+	mpfr exact = xnum_mpfr*ynum_mpfr - xnum_mpfr/ynum_mpfr + xnum_mpfr*xnum_mpfr*xnum_mpfr;
+	BOOST_CHECK(abs(first - exact) < threshold_clearance_mp);
+	BOOST_CHECK_EQUAL(N->Eval<mpfr>(), first);
+
+	mpfr in_place;
+	N->EvalInPlace<mpfr>(in_place);
+	BOOST_CHECK_EQUAL(in_place, first);
+
+	// the reference sees the next evaluation
+	x->set_current_value(ynum_mpfr);
+	N->Reset();
+	N->EvalRef<mpfr>();
+	exact = ynum_mpfr*ynum_mpfr - mpfr(1) + ynum_mpfr*ynum_mpfr*ynum_mpfr;
+	BOOST_CHECK(abs(first - exact) < threshold_clearance_mp);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(function_tree_simplify_removes_identities_and_folds_constants)
+{
+	using bertini::node::Integer;
+	using bertini::node::Rational;
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+	std::shared_ptr<Node> zero = std::make_shared<Integer>(0), one = std::make_shared<Integer>(1);
+
+	auto S = bertini::node::Simplify(x*zero + one*y);
+	BOOST_CHECK(S==y);
+
+	S = bertini::node::Simplify(pow(x,1) - zero);
+	BOOST_CHECK(S==x);
+
+	S = bertini::node::Simplify(pow(std::make_shared<Integer>(2),3) * std::make_shared<Rational>(mpq_rational(1,4)) - std::make_shared<Integer>(2));
+	auto as_integer = std::dynamic_pointer_cast<Integer>(S);
+	BOOST_CHECK(as_integer);
+	if (as_integer)
+		BOOST_CHECK_EQUAL(as_integer->true_value(), 0);
+
+	S = bertini::node::Simplify(-(-x));
+	BOOST_CHECK(S==x);
+}
+
+
+BOOST_AUTO_TEST_CASE(function_tree_simplify_flattens_and_preserves_value)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+
+	std::shared_ptr<Node> N = ((x + y) + (x - 3*y)) - (2*(x*y)*5) + pow(pow(x,2),3);
+
+	x->set_current_value<dbl>(xnum_dbl);
+	y->set_current_value<dbl>(ynum_dbl);
+	x->set_current_value<mpfr>(xnum_mpfr);
+	y->set_current_value<mpfr>(ynum_mpfr);
+
+	dbl before_d = N->Eval<dbl>();
+	mpfr before_mp = N->Eval<mpfr>();
+
+	auto S = bertini::node::Simplify(N);
+
+	auto as_sum = std::dynamic_pointer_cast<bertini::node::SumOperator>(S);
+	BOOST_CHECK(as_sum);
+	if (as_sum)
+	{
+		BOOST_CHECK_EQUAL(as_sum->children_size(), 6);
+		for (const auto& iter : as_sum->children())
+			BOOST_CHECK(!std::dynamic_pointer_cast<bertini::node::SumOperator>(iter));
+	}
+
+	S->Reset();
+	BOOST_CHECK(abs(S->Eval<dbl>() - before_d) < threshold_clearance_d);
+	BOOST_CHECK(abs(S->Eval<mpfr>() - before_mp) < threshold_clearance_mp);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(numbers_keep_values_across_reset_and_recompute_on_precision_change)
+{
+	using mpfr_float = bertini::mpfr_float;
+	bertini::DefaultPrecision(16);
+
+	auto third = std::make_shared<bertini::node::Rational>(mpq_rational(1,3));
+	auto a = std::make_shared<Float>("0.1234567890123456789012345678901234567890123456789");
+
+	auto low = third->Eval<mpfr>();
+	a->Eval<mpfr>();
+	third->Reset();
+	BOOST_CHECK_EQUAL(third->Eval<mpfr>(), low);
+
+	// the values made at 16 digits must not be kept at 50
+	bertini::DefaultPrecision(50);
+	third->precision(50);
+	a->precision(50);
+	BOOST_CHECK(abs(third->Eval<mpfr>() - mpfr(mpfr_float(1)/3)) < mpfr_float("1e-45"));
+	BOOST_CHECK(abs(a->Eval<mpfr>() - mpfr("0.1234567890123456789012345678901234567890123456789")) < mpfr_float("1e-45"));
+
+	auto e = bertini::node::E();
+	e->precision(50);
+	BOOST_CHECK(abs(e->Eval<mpfr>() - mpfr(exp(mpfr_float(1)))) < mpfr_float("1e-45"));
+	BOOST_CHECK_EQUAL(e->Eval<dbl>(), dbl(exp(1.0)));
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(slp_workspace_adjoints_are_the_derivatives)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	auto x = std::make_shared<Variable>("x");
+	auto y = std::make_shared<Variable>("y");
+	std::shared_ptr<Node> f = x*x*y + sin(y);
+
+	bertini::node::StraightLineProgram slp;
+	auto index = slp.AddOutput(f);
+	const auto rx = slp.RegisterOf(x), ry = slp.RegisterOf(y);
+
+	x->set_current_value(dbl(0.5,0.25));
+	y->set_current_value(dbl(-1.5,0.75));
+	x->set_current_value(mpfr("0.5","0.25"));
+	y->set_current_value(mpfr("-1.5","0.75"));
+
+	auto w = slp.MakeWorkspace();
+	w.Register<dbl>(rx) = dbl(1.25,-0.5);
+	w.Register<dbl>(ry) = dbl(0.75,2.0);
+	slp.Eval<dbl>(w);
+	slp.ReverseSweep<dbl>(index, w);
+
+	dbl xd(1.25,-0.5), yd(0.75,2.0);
+	BOOST_CHECK(abs(w.Adjoint<dbl>(rx) - dbl(2.)*xd*yd) < threshold_clearance_d);
+	BOOST_CHECK(abs(w.Adjoint<dbl>(ry) - (xd*xd + cos(yd))) < threshold_clearance_d);
+
+	// the program's own workspace is untouched by the other
+	slp.Eval<dbl>();
+	slp.ReverseSweep<dbl>(index);
+	BOOST_CHECK(abs(slp.Adjoint<dbl>(rx) - dbl(2.)*dbl(0.5,0.25)*dbl(-1.5,0.75)) < threshold_clearance_d);
+
+	w.Register<mpfr>(rx) = mpfr("1.25","-0.5");
+	w.Register<mpfr>(ry) = mpfr("0.75","2.0");
+	slp.Eval<mpfr>(w);
+	slp.ReverseSweep<mpfr>(index, w);
+
+	mpfr xm("1.25","-0.5"), ym("0.75","2.0");
+	BOOST_CHECK(abs(w.Adjoint<mpfr>(rx) - mpfr(2)*xm*ym) < threshold_clearance_mp);
+	BOOST_CHECK(abs(w.Adjoint<mpfr>(ry) - (xm*xm + cos(ym))) < threshold_clearance_mp);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
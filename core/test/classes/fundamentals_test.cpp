@@ -27,6 +27,8 @@
 #include <boost/multiprecision/mpfr.hpp>
 #include <boost/multiprecision/random.hpp>
 #include <iostream>
+#include <thread>
+#include <tuple>
 
 #include "bertini2/limbo.hpp"
 #include "bertini2/num_traits.hpp"
@@ -232,6 +234,142 @@ BOOST_AUTO_TEST_CASE(precision_of_complex_double_is_16)
 }
 
 
+BOOST_AUTO_TEST_CASE(scoped_precision_restores_on_exit)
+{
+	using bertini::DefaultPrecision;
+	auto initial = DefaultPrecision();
+	{
+		bertini::ScopedPrecision higher(initial+50);
+		BOOST_CHECK_EQUAL(DefaultPrecision(), initial+50);
+		BOOST_CHECK_EQUAL(bertini::mpfr_float(1).precision(), initial+50);
+		BOOST_CHECK_EQUAL(higher.Previous(), initial);
+	}
+	BOOST_CHECK_EQUAL(DefaultPrecision(), initial);
+
+	try
+	{
+		bertini::ScopedPrecision higher(initial+50);
+		throw std::runtime_error("leaving by exception");
+	}
+	catch (std::runtime_error const&)
+	{}
+	BOOST_CHECK_EQUAL(DefaultPrecision(), initial);
+}
+
+BOOST_AUTO_TEST_CASE(philox_matches_known_answers)
+{
+	// from the known answer tests of Random123
+	std::uint32_t out[4];
+	std::uint32_t counter[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+	std::uint32_t key[2] = {0xa4093822, 0x299f31d0};
+	bertini::Philox4x32::Block(out, counter, key);
+	BOOST_CHECK_EQUAL(out[0], 0xd16cfe09u);
+	BOOST_CHECK_EQUAL(out[1], 0x94fdccebu);
+	BOOST_CHECK_EQUAL(out[2], 0x5001e420u);
+	BOOST_CHECK_EQUAL(out[3], 0x24126ea1u);
+}
+
+BOOST_AUTO_TEST_CASE(random_stream_is_the_same_on_any_thread)
+{
+	using bertini::ScopedRandomStream;
+
+	auto draw = []()
+		{
+			ScopedRandomStream stream(42);
+			bertini::mpfr_float x;
+			bertini::RandomMp(x, 100);
+			return std::make_pair(bertini::RandomDouble(), x);
+		};
+
+	auto here = draw();
+	bertini::RandomDouble(); // moving this thread's own generator on changes nothing in the stream
+	auto again = draw();
+	decltype(here) there;
+	std::thread other([&](){ there = draw(); });
+	other.join();
+
+	BOOST_CHECK_EQUAL(here.first, again.first);
+	BOOST_CHECK_EQUAL(here.first, there.first);
+	BOOST_CHECK(here.second==again.second);
+	BOOST_CHECK(here.second==there.second);
+}
+
+BOOST_AUTO_TEST_CASE(random_seed_twice_draws_the_same)
+{
+	auto previous = bertini::RandomSeed();
+
+	bertini::RandomSeed(42);
+	auto first = bertini::RandomDouble();
+	bertini::RandomDouble();
+
+	bertini::RandomSeed(42);
+	BOOST_CHECK_EQUAL(bertini::RandomDouble(), first);
+
+	// double and multiple precision draws interleaved, some taking an odd number of 32 bit outputs, and some through Boost's distributions, so that any state left from before reseeding would show
+	auto draw = []()
+		{
+			std::complex<double> z = bertini::RandomUnit<std::complex<double> >();
+			mpfr x;
+			bertini::RandomMp(x, 40);
+			auto n = bertini::RandomInt<20>();
+			bertini::complex w = bertini::RandomUnit<bertini::complex>();
+			auto r = bertini::RandomRat<10>();
+			double d = bertini::RandomDouble();
+			return std::make_tuple(z, x, n, w, r, d);
+		};
+
+	auto initial_precision = DefaultPrecision();
+	DefaultPrecision(30);
+	bertini::RandomSeed(7);
+	auto once = draw();
+	draw();
+	bertini::RandomSeed(7);
+	auto again = draw();
+
+	BOOST_CHECK(std::get<0>(once)==std::get<0>(again));
+	BOOST_CHECK(std::get<1>(once)==std::get<1>(again));
+	BOOST_CHECK(std::get<2>(once)==std::get<2>(again));
+	BOOST_CHECK(std::get<3>(once)==std::get<3>(again));
+	BOOST_CHECK(std::get<4>(once)==std::get<4>(again));
+	BOOST_CHECK_EQUAL(std::get<5>(once), std::get<5>(again));
+
+	DefaultPrecision(initial_precision);
+	bertini::RandomSeed(previous);
+}
+
+BOOST_AUTO_TEST_CASE(random_mp_is_in_unit_interval_at_its_precision)
+{
+	for (unsigned digits : {10u, 50u, 333u, 50000u})
+	{
+		bertini::mpfr_float x;
+		bertini::RandomMp(x, digits);
+		BOOST_CHECK_EQUAL(x.precision(), digits);
+		BOOST_CHECK(x >= 0);
+		BOOST_CHECK(x < 1);
+	}
+}
+
+#ifdef HAVE_THREAD_DEFAULT_PRECISION
+BOOST_AUTO_TEST_CASE(precision_set_on_one_thread_is_not_seen_on_another)
+{
+	using bertini::DefaultPrecision;
+	auto initial = DefaultPrecision();
+
+	unsigned other_precision = 0;
+	std::thread other([&]()
+		{
+			DefaultPrecision(200);
+			other_precision = bertini::mpfr_float(1).precision();
+		});
+	other.join();
+
+	BOOST_CHECK_EQUAL(other_precision, 200);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), initial);
+	BOOST_CHECK_EQUAL(bertini::mpfr_float(1).precision(), initial);
+}
+#endif
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
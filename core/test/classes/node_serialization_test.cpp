@@ -45,6 +45,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <sstream>
 
 #include "bertini2/function_tree.hpp"
 #include "bertini2/system.hpp"
@@ -207,6 +208,73 @@ BOOST_AUTO_TEST_CASE(system_serialize)
 }
 
 
+BOOST_AUTO_TEST_CASE(mpfr_binary_serialize_is_exact)
+{
+	bertini::DefaultPrecision(200);
+
+	std::vector<bertini::mpfr_float> numbers{bertini::mpfr_float(1)/3, -sqrt(bertini::mpfr_float(2)), bertini::mpfr_float(0), -bertini::mpfr_float(0), bertini::mpfr_float("1e-12345")};
+	bertini::mpfr z(bertini::mpfr_float(2)/7, -bertini::mpfr_float(5)/11);
+
+	std::stringstream buffer;
+	{
+		boost::archive::binary_oarchive oa(buffer);
+		oa << numbers << z;
+	}
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::vector<bertini::mpfr_float> loaded;
+	bertini::mpfr z_loaded;
+	{
+		boost::archive::binary_iarchive ia(buffer);
+		ia >> loaded >> z_loaded;
+	}
+
+	BOOST_REQUIRE_EQUAL(loaded.size(), numbers.size());
+	for (unsigned ii = 0; ii < numbers.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(loaded[ii].precision(), numbers[ii].precision());
+		BOOST_CHECK(loaded[ii]==numbers[ii]);
+		BOOST_CHECK_EQUAL(signbit(loaded[ii]), signbit(numbers[ii]));
+	}
+
+	BOOST_CHECK_EQUAL(z_loaded.precision(), 200);
+	BOOST_CHECK(z_loaded==z);
+}
+
+
+BOOST_AUTO_TEST_CASE(system_clone)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y + 0.1; f2 = x1*y; ";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+
+	bertini::System clone = sys.Clone();
+
+	// the clone has its own variables
+	BOOST_CHECK(clone.Variables()[0]!=sys.Variables()[0]);
+
+	Vec<dbl> values(2), other_values(2);
+	values << dbl(2.0), dbl(3.0);
+	other_values << dbl(-1.0), dbl(0.5);
+
+	Vec<dbl> v_clone = clone.Eval(values);
+	Vec<dbl> v = sys.Eval(other_values);
+
+	// evaluating one leaves the other alone
+	BOOST_CHECK_EQUAL(clone.Variables()[0]->current_value<dbl>(), dbl(2.0));
+
+	BOOST_CHECK(abs(v_clone(0) - dbl(36.1)) < threshold_clearance_d);
+	BOOST_CHECK(abs(v_clone(1) - dbl(12.0)) < threshold_clearance_d);
+	BOOST_CHECK(abs(v(0) - dbl(0.35)) < threshold_clearance_d);
+	BOOST_CHECK(abs(v(1) - dbl(0.5)) < threshold_clearance_d);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -216,6 +216,43 @@ BOOST_AUTO_TEST_CASE(patch_rescale_and_evaluate_prec_default_mpfr)
 }
 
 
+BOOST_AUTO_TEST_CASE(patch_batch_rescale_eval_and_jacobian_match_pointwise)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::vector<unsigned> s{2,3};
+
+	Patch p(s);
+	p.Precision(16);
+
+	Mat<dbl> X(5,3);
+	for (int ii = 0; ii < 5; ++ii)
+		for (int kk = 0; kk < 3; ++kk)
+			X(ii,kk) = dbl(ii+1, kk-1);
+
+	Mat<dbl> F(4,3);
+	p.EvalBatchInPlace(F, X);
+	for (int kk = 0; kk < 3; ++kk)
+	{
+		Vec<dbl> x = X.col(kk);
+		auto f = p.Eval(x);
+		for (int ii = 0; ii < 2; ++ii)
+			BOOST_CHECK(abs(F(ii+2,kk) - f(ii)) < threshold_clearance_d);
+	}
+
+	p.RescalePointsToFitInPlace(X);
+	p.EvalBatchInPlace(F, X);
+	for (int kk = 0; kk < 3; ++kk)
+		for (int ii = 0; ii < 2; ++ii)
+			BOOST_CHECK(abs(F(ii+2,kk)) < threshold_clearance_d);
+
+	Mat<dbl> J = Mat<dbl>::Zero(2,5);
+	p.JacobianInPlace(J);
+	Vec<dbl> x = X.col(0);
+	BOOST_CHECK(J == p.Jacobian(x));
+}
+
+
 BOOST_AUTO_TEST_CASE(patch_equality_checks)
 {
 	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
@@ -309,6 +309,250 @@ BOOST_AUTO_TEST_CASE(quadratic_cubic_quartic_start_points)
 
 
 
+BOOST_AUTO_TEST_CASE(total_degree_start_points_walk_matches_indexing)
+{
+	bertini::System sys;
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	VariableGroup vars;
+	vars.push_back(x); vars.push_back(y); vars.push_back(z);
+
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(y+x*y + mpfr_float("0.5"));
+	sys.AddFunction(pow(x,3)+x*y+bertini::node::E());
+	sys.AddFunction(pow(x,2)*pow(y,2)+x*y*z*z - 1);
+
+	bertini::start_system::TotalDegree TD(sys);
+	using Points = bertini::start_system::TotalDegreeStartPoints<dbl>;
+
+	// the chunks partition the start points, and walking each visits the same points as indexing
+	const unsigned num_chunks = 5;
+	mpz_int expected_index = 0;
+	for (unsigned chunk = 0; chunk < num_chunks; ++chunk)
+	{
+		auto range = Points::Chunk(TD.NumStartPoints(), chunk, num_chunks);
+		BOOST_CHECK_EQUAL(range.first, expected_index);
+
+		for (auto points = TD.StartPoints<dbl>(range.first, range.second); !points.Done(); points.Next())
+		{
+			BOOST_CHECK_EQUAL(points.Index(), expected_index);
+			BOOST_CHECK((points.Current() - TD.StartPoint<dbl>(points.Index())).norm() < threshold_clearance_d);
+			++expected_index;
+		}
+	}
+	BOOST_CHECK_EQUAL(expected_index, TD.NumStartPoints());
+
+	BOOST_CHECK_THROW(Points::Chunk(TD.NumStartPoints(), num_chunks, num_chunks), std::out_of_range);
+	BOOST_CHECK(TD.StartPoints<dbl>(TD.NumStartPoints(), TD.NumStartPoints()+3).Done());
+
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	mpz_int num_points = 0;
+	for (auto points = TD.StartPoints<mpfr>(7, TD.NumStartPoints()); !points.Done(); points.Next())
+	{
+		BOOST_CHECK((points.Current() - TD.StartPoint<mpfr>(points.Index())).norm() < threshold_clearance_mp);
+		++num_points;
+	}
+	BOOST_CHECK_EQUAL(num_points, TD.NumStartPoints() - 7);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(total_degree_closed_form_matches_trees)
+{
+	bertini::System sys;
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	VariableGroup vars;
+	vars.push_back(x); vars.push_back(y); vars.push_back(z);
+
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(y+x*y + mpfr_float("0.5"));
+	sys.AddFunction(pow(x,3)+x*y+bertini::node::E());
+	sys.AddFunction(pow(x,2)*pow(y,2)+x*y*z*z - 1);
+
+	bertini::start_system::TotalDegree TD(sys);
+	auto closed_form = TD.ClosedForm();
+	BOOST_REQUIRE(closed_form);
+
+	Vec<dbl> v(3);
+	v << dbl(0.3,0.1), dbl(-0.7,0.2), dbl(1.1,-0.4);
+	Vec<dbl> f(3);
+	Mat<dbl> J(3,3);
+	closed_form->EvalInPlace(f, v);
+	closed_form->JacobianInPlace(J, v);
+	BOOST_CHECK((f - TD.Eval(v)).norm() < threshold_clearance_d);
+	BOOST_CHECK((J - TD.Jacobian(v)).norm() < threshold_clearance_d);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> w(3);
+	w << mpfr("0.3","0.1"), mpfr("-0.7","0.2"), mpfr("1.1","-0.4");
+	Vec<mpfr> g(3);
+	Mat<mpfr> K(3,3);
+	closed_form->EvalInPlace(g, w);
+	closed_form->JacobianInPlace(K, w);
+	BOOST_CHECK((g - TD.Eval(w)).norm() < threshold_clearance_mp);
+	BOOST_CHECK((K - TD.Jacobian(w)).norm() < threshold_clearance_mp);
+
+	// homogenized, the homogenizing variable has a column of its own, and the patch is not part of the closed form
+	sys.Homogenize();
+	sys.AutoPatch();
+	bertini::start_system::TotalDegree TD_hom(sys);
+	closed_form = TD_hom.ClosedForm();
+	BOOST_REQUIRE(closed_form);
+
+	Vec<dbl> u(4);
+	u << dbl(0.9,0.3), dbl(0.3,0.1), dbl(-0.7,0.2), dbl(1.1,-0.4);
+	Vec<dbl> f_hom(3);
+	Mat<dbl> J_hom(3,4);
+	closed_form->EvalInPlace(f_hom, u);
+	closed_form->JacobianInPlace(J_hom, u);
+	BOOST_CHECK((f_hom - TD_hom.Eval(u).head(3)).norm() < threshold_clearance_d);
+	BOOST_CHECK((J_hom - TD_hom.Jacobian(u).topRows(3)).norm() < threshold_clearance_d);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(multihomogeneous_start_system_bilinear)
+{
+	bertini::System sys;
+	Var x1 = std::make_shared<bertini::node::Variable>("x1"), x2 = std::make_shared<bertini::node::Variable>("x2");
+	Var y1 = std::make_shared<bertini::node::Variable>("y1"), y2 = std::make_shared<bertini::node::Variable>("y2");
+
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y1,y2});
+	sys.AddFunction(x1*y1 + x2*y2 - 1);
+	sys.AddFunction(x1*y2 - x2*y1 + x1 + mpfr_float("0.5"));
+	sys.AddFunction(pow(x1,2) + y1*y2 - 2);
+	sys.AddFunction(x2*y1 + y2 - 3);
+
+	bertini::start_system::MHomogeneous MH(sys);
+	bertini::start_system::TotalDegree TD(sys);
+
+	BOOST_CHECK_EQUAL(MH.MultiDegrees()[2][0], 2);
+	BOOST_CHECK_EQUAL(MH.MultiDegrees()[2][1], 2);
+	BOOST_CHECK_EQUAL(MH.MultiDegrees()[3][0], 1);
+	BOOST_CHECK_EQUAL(MH.Degrees()[2], 4);
+
+	// choose two of the four functions for the x group, weighted by the chosen degrees
+	BOOST_CHECK_EQUAL(MH.Assignments().size(), 6);
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 12);
+	BOOST_CHECK(MH.NumStartPoints() < TD.NumStartPoints());
+
+	std::vector<Vec<dbl>> points;
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		auto function_values = MH.Eval(start);
+		for (unsigned jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+
+		for (auto const& other : points)
+			BOOST_CHECK((start - other).norm() > relaxed_threshold_clearance_d);
+		points.push_back(start);
+	}
+	BOOST_CHECK_THROW(MH.StartPoint<dbl>(MH.NumStartPoints()), std::out_of_range);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<mpfr>(ii);
+		auto function_values = MH.Eval(start);
+		for (unsigned jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(linear_product_start_system_uses_supports)
+{
+	bertini::System sys;
+	Var x1 = std::make_shared<bertini::node::Variable>("x1"), x2 = std::make_shared<bertini::node::Variable>("x2");
+	Var y1 = std::make_shared<bertini::node::Variable>("y1"), y2 = std::make_shared<bertini::node::Variable>("y2");
+
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y1,y2});
+	sys.AddFunction(x1*y1 - 1);
+	sys.AddFunction(x1*y2 - 2);
+	sys.AddFunction(x2*y1 + x1 - 3);
+	sys.AddFunction(x2*y2 + y1 - 4);
+
+	bertini::start_system::LinearProduct LP(sys);
+	bertini::start_system::MHomogeneous MH(sys);
+
+	BOOST_CHECK_EQUAL(LP.Supports()[0][0].size(), 1);
+	BOOST_CHECK_EQUAL(LP.Supports()[2][0].size(), 2);
+	BOOST_CHECK_EQUAL(MH.Supports()[0][0].size(), 2);
+
+	// assigning f0 and f1 to the x group, or f0 and f2 to the y group, leaves it singular
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 6);
+	BOOST_CHECK_EQUAL(LP.NumStartPoints(), 4);
+
+	std::vector<Vec<dbl>> points;
+	for (mpz_int ii = 0; ii < LP.NumStartPoints(); ++ii)
+	{
+		auto start = LP.StartPoint<dbl>(ii);
+		auto function_values = LP.Eval(start);
+		for (unsigned jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+
+		for (auto const& other : points)
+			BOOST_CHECK((start - other).norm() > relaxed_threshold_clearance_d);
+		points.push_back(start);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(polyhedral_start_system_cells)
+{
+	bertini::System sys;
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x + pow(y,3) - 2);
+
+	bertini::start_system::Polyhedral G(sys);
+
+	BOOST_CHECK_EQUAL(G.Supports()[0].size(), 2);
+	BOOST_CHECK_EQUAL(G.Supports()[1].size(), 3);
+	BOOST_CHECK_EQUAL(G.MixedVolume(), 4);
+
+	Var t = std::make_shared<bertini::node::Variable>("t");
+	Vec<dbl> point(2);
+	point << dbl(0.3,-1.2), dbl(1.1,0.4);
+
+	unsigned long num_binomial_solutions = 0;
+	for (unsigned cell = 0; cell < G.Cells().size(); ++cell)
+	{
+		auto h = G.CellHomotopy(cell, t);
+
+		// at t=1, the homotopy of each cell is the start system
+		BOOST_CHECK((h.Eval(point, dbl(1)) - G.Eval(point)).norm() < relaxed_threshold_clearance_d);
+
+		// near t=0, its binomial system, solved by the cell's start points
+		auto starts = G.CellStartPoints<dbl>(cell);
+		BOOST_CHECK_EQUAL(starts.size(), G.Cells()[cell].volume);
+		for (auto const& s : starts)
+			BOOST_CHECK(h.Eval(s, dbl(1e-14)).norm() < relaxed_threshold_clearance_d);
+		num_binomial_solutions += starts.size();
+	}
+	BOOST_CHECK_EQUAL(num_binomial_solutions, G.MixedVolume());
+
+	// the sizes of the binomial systems need not match the mixed volume, but the count of cyclic-3 is known
+	std::vector<bertini::detail::Support> cyclic{{{1,0,0},{0,1,0},{0,0,1}}, {{1,1,0},{0,1,1},{1,0,1}}, {{1,1,1},{0,0,0}}};
+	std::vector< std::vector<double> > liftings{{0.31,0.77,0.12}, {0.58,0.04,0.93}, {0.45,0.66}};
+	BOOST_CHECK_EQUAL(bertini::detail::MixedVolume(bertini::detail::MixedCells(cyclic, liftings)), 6);
+	BOOST_CHECK_EQUAL(bertini::detail::MixedVolume(bertini::detail::MixedCells(cyclic, liftings, 3)), 6);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(quadratic_cubic_quartic_all_the_way_to_final_system)
 {
 	bertini::System sys;
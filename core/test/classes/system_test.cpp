@@ -38,11 +38,16 @@
 */
 
 #include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <sstream>
 
 
 
 #include "bertini2/system.hpp"
 #include "bertini2/system_parsing.hpp"
+#include "bertini2/system_cache.hpp"
+#include "bertini2/system_reader.hpp"
+#include "bertini2/squared_up_system.hpp"
 
 using System = bertini::System;
 using Var = std::shared_ptr<bertini::Variable>;
@@ -473,6 +478,50 @@ BOOST_AUTO_TEST_CASE(system_evaluate_mpfr)
 
 
 
+/**
+\class bertini::System
+\test \b system_compensated_summation_is_per_system Turn on compensated summation in one of two systems, and evaluate both in double precision.
+*/
+BOOST_AUTO_TEST_CASE(system_compensated_summation_is_per_system)
+{
+	auto make_sum = []()
+	{
+		auto sum = std::make_shared<bertini::node::SumOperator>(std::make_shared<bertini::Variable>("x"), true, std::make_shared<bertini::Variable>("y"), true);
+		sum->AddChild(std::make_shared<bertini::Variable>("z"), false);
+		return sum;
+	};
+	auto make_system = [](std::shared_ptr<bertini::node::SumOperator> const& sum)
+	{
+		bertini::System sys;
+		VariableGroup vars;
+		for (const auto& iter : sum->children())
+			vars.push_back(std::dynamic_pointer_cast<bertini::Variable>(iter));
+		sys.AddVariableGroup(vars);
+		sys.AddFunction(sum);
+		return sys;
+	};
+
+	auto compensated_sum = make_sum(), plain_sum = make_sum();
+	auto compensated = make_system(compensated_sum), plain = make_system(plain_sum);
+	compensated.CompensatedSummation(true);
+
+	BOOST_CHECK(compensated.CompensatedSummation());
+	BOOST_CHECK(compensated_sum->CompensatedSummation());
+	BOOST_CHECK(!plain.CompensatedSummation());
+	BOOST_CHECK(!plain_sum->CompensatedSummation());
+
+	Vec<dbl> values(3);
+	values << dbl(1e16), dbl(1), dbl(1e16);
+
+	// 1e16+1 rounds to 1e16 in double precision, unless the rounding error is carried along
+	BOOST_CHECK_EQUAL(compensated.Eval(values)(0), dbl(1));
+
+	compensated.CompensatedSummation(false);
+	BOOST_CHECK(!compensated_sum->CompensatedSummation());
+}
+
+
+
 /**
 \class bertini::System
 \test \b add_two_systems Test the arithmetic sum of two Systems.
@@ -963,10 +1012,1361 @@ BOOST_AUTO_TEST_CASE(ref_test)
 }
 
 
+/**
+\class bertini::System
+\test \b system_compiled_evaluation_matches_tree Compiled evaluation, through a straight line program, must produce the same values as walking the function trees, in both double and multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(system_compiled_evaluation_matches_tree)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
 
+	auto shared = x*y - 2;
 
-BOOST_AUTO_TEST_SUITE_END()
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(shared,3)*t + sin(x)/y - (1-t)*exp(y));
+	sys.AddFunction(-shared + sqrt(x+t) - pow(y,x) + bertini::node::Pi()*log(y));
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	auto tree_d = sys.Eval(values, time);
+	sys.UseCompiledEvaluation(true);
+	auto compiled_d = sys.Eval(values, time);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		BOOST_CHECK(abs(tree_d(ii) - compiled_d(ii)) < threshold_clearance_d);
+
+
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.3","-1.2"), mpfr("1.1","0.4");
+	mpfr time_mp("0.5","0.1");
+
+	auto compiled_mp = sys.Eval(values_mp, time_mp);
+	sys.UseCompiledEvaluation(false);
+	auto tree_mp = sys.Eval(values_mp, time_mp);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		BOOST_CHECK(abs(tree_mp(ii) - compiled_mp(ii)) < threshold_clearance_mp);
+}
+
+
+/**
+\class bertini::System
+\test \b system_polynomial_evaluation_matches_tree Evaluation of a polynomial system from its expansion into monomials must produce the same values, Jacobian, and time derivative as walking the trees.
+*/
+BOOST_AUTO_TEST_CASE(system_polynomial_evaluation_matches_tree)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(x*y - 2,3)*t - (1-t)*pow(y,2)/3);
+	sys.AddFunction(-(x+y)*(x-y) + x*t*t - mpfr_float("1.5"));
+
+	BOOST_CHECK(!sys.UsingPolynomialEvaluation()); // off unless asked for
+	sys.UsePolynomialEvaluation(true);
+	BOOST_CHECK(sys.UsingPolynomialEvaluation());
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	auto f_poly = sys.Eval(values, time);
+	auto J_poly = sys.Jacobian(values, time);
+	auto dt_poly = sys.TimeDerivative(values, time);
 
+	sys.UsePolynomialEvaluation(false);
+	BOOST_CHECK(!sys.UsingPolynomialEvaluation());
 
+	auto f_tree = sys.Eval(values, time);
+	auto J_tree = sys.Jacobian(values, time);
+	auto dt_tree = sys.TimeDerivative(values, time);
 
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_poly(ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(dt_tree(ii) - dt_poly(ii)) < threshold_clearance_d);
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_poly(ii,jj)) < threshold_clearance_d);
+	}
+
+
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.3","-1.2"), mpfr("1.1","0.4");
+	mpfr time_mp("0.5","0.1");
+
+	auto J_tree_mp = sys.Jacobian(values_mp, time_mp);
+	sys.UsePolynomialEvaluation(true);
+	auto J_poly_mp = sys.Jacobian(values_mp, time_mp);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_poly_mp(ii,jj)) < threshold_clearance_mp);
+}
 
+
+/**
+\class bertini::System
+\test \b system_polynomial_evaluation_follows_precision Polynomial evaluation must carry all the digits of a raise of precision, after a lowering as well, and expanding must leave the numbers of the trees at their own precision.
+*/
+BOOST_AUTO_TEST_CASE(system_polynomial_evaluation_follows_precision)
+{
+	DefaultPrecision(16);
+
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	auto a = std::make_shared<bertini::node::Float>("0.1234567890123456789012345678901234567890123456789");
+	auto third = std::make_shared<bertini::node::Rational>(bertini::mpq_rational(1,3));
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(a*x*y - third*pow(y,2) + 1);
+	sys.UsePolynomialEvaluation(true);
+
+	Vec<mpfr> values(2);
+	values << mpfr("0.5","0.25"), mpfr("-1.5","0.75");
+	a->precision(40);
+	sys.Eval(values);
+	BOOST_CHECK_EQUAL(a->precision(), 40); // expanding made numbers of its own, leaving the tree's as they were
+
+	auto Exact = []()
+	{
+		mpfr x("0.5","0.25"), y("-1.5","0.75");
+		return mpfr("0.1234567890123456789012345678901234567890123456789")*x*y - mpfr(mpfr_float(1)/3)*y*y + mpfr(1);
+	};
+
+	for (unsigned digits : {50u, 30u, 50u})
+	{
+		DefaultPrecision(digits);
+		sys.precision(digits);
+		Vec<mpfr> v(2);
+		v << mpfr("0.5","0.25"), mpfr("-1.5","0.75");
+		BOOST_CHECK(sys.UsingPolynomialEvaluation());
+		BOOST_CHECK(abs(sys.Eval(v)(0) - Exact()) < pow(mpfr_float(10), -static_cast<int>(digits)+3));
+	}
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\class bertini::System
+\test \b system_homogenize_expanded_polynomials Homogenizing a system already expanded for polynomial evaluation homogenizes the expansion in place, which must agree with the homogenized trees, in each of two groups, and with a term cancelling in the tree.
+*/
+BOOST_AUTO_TEST_CASE(system_homogenize_expanded_polynomials)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var z = std::make_shared<bertini::Variable>("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddVariableGroup(VariableGroup{z});
+	sys.AddFunction(pow(x,3)*z - x*y + z*z - 2);
+	sys.AddFunction((x+y)*(x-y) - x*x + y*z + 1); // the x^2 terms cancel, but the degree of the tree is 2
+
+	sys.UsePolynomialEvaluation(true);
+	BOOST_CHECK(sys.UsingPolynomialEvaluation());
+	sys.Homogenize();
+	BOOST_CHECK(sys.IsHomogeneous());
+	BOOST_CHECK(sys.UsingPolynomialEvaluation());
+	BOOST_CHECK_EQUAL(sys.NumVariables(), 5);
+
+	Vec<dbl> values(5);
+	values << dbl(0.7,0.2), dbl(0.3,-1.2), dbl(1.1,0.4), dbl(-0.4,0.9), dbl(0.6,-0.5);
+
+	auto f_poly = sys.Eval(values);
+	auto J_poly = sys.Jacobian(values);
+
+	sys.UsePolynomialEvaluation(false);
+	auto f_tree = sys.Eval(values);
+	auto J_tree = sys.Jacobian(values);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_poly(ii)) < threshold_clearance_d);
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_poly(ii,jj)) < threshold_clearance_d);
+	}
+
+	// the homogenization survives expanding again, at a change of precision
+	sys.UsePolynomialEvaluation(true);
+	DefaultPrecision(100);
+	sys.precision(100);
+
+	Vec<mpfr> values_mp(5);
+	for (unsigned ii = 0; ii < 5; ++ii)
+		values_mp(ii) = mpfr(values(ii).real(), values(ii).imag());
+
+	auto f_poly_mp = sys.Eval(values_mp);
+	sys.UsePolynomialEvaluation(false);
+	auto f_tree_mp = sys.Eval(values_mp);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		BOOST_CHECK(abs(f_tree_mp(ii) - f_poly_mp(ii)) < threshold_clearance_mp);
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\class bertini::System
+\test \b system_straight_line_time_derivative_from_values The time derivative of a straight-line homotopy between non-polynomial systems, evaluated by walking the trees, must be the start system less the target, as the Jacobian with respect to the path variable gives, and must follow changes of the path variable.
+*/
+BOOST_AUTO_TEST_CASE(system_straight_line_time_derivative_from_values)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	auto gamma = std::make_shared<bertini::node::Float>("0.8","0.6");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction((1-t)*(sin(x)*y - 1) + gamma*t*(pow(x,2) - 1));
+	sys.AddFunction((1-t)*(pow(x,2) + exp(y)) + gamma*t*(pow(y,2) - 1));
+	sys.AddFunction((1-t)*x*y - t*t*exp(x)); // not a straight line, from the Jacobian
+
+	BOOST_CHECK(!sys.UsingPolynomialEvaluation());
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl g = gamma->Eval<dbl>();
+	dbl x0 = values(0), y0 = values(1);
+
+	for (dbl time : {dbl(0.5,0.1), dbl(0.25,-0.3)})
+	{
+		auto dt = sys.TimeDerivative(values, time);
+
+		BOOST_CHECK(abs(dt(0) - (g*(x0*x0 - 1.) - (sin(x0)*y0 - 1.))) < threshold_clearance_d);
+		BOOST_CHECK(abs(dt(1) - (g*(y0*y0 - 1.) - (x0*x0 + exp(y0)))) < threshold_clearance_d);
+		BOOST_CHECK(abs(dt(2) - (-x0*y0 - 2.*time*exp(x0))) < threshold_clearance_d);
+
+		Vec<dbl> dt_fused(sys.NumFunctions());
+		Mat<dbl> J(sys.NumFunctions(), sys.NumVariables());
+		sys.JacobianAndTimeDerivativeInPlace(J, dt_fused, values, time);
+		BOOST_CHECK((dt - dt_fused).norm() < threshold_clearance_d);
+	}
+
+
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.3","-1.2"), mpfr("1.1","0.4");
+	mpfr time_mp("0.5","0.1");
+	mpfr g_mp = gamma->Eval<mpfr>();
+
+	auto dt_mp = sys.TimeDerivative(values_mp, time_mp);
+	BOOST_CHECK(abs(dt_mp(0) - (g_mp*(values_mp(0)*values_mp(0) - mpfr(1)) - (sin(values_mp(0))*values_mp(1) - mpfr(1)))) < threshold_clearance_mp);
+}
+
+
+/**
+\class bertini::System
+\test \b system_polynomial_evaluation_not_used_for_nonpolynomial A system with a transcendental function must be evaluated by walking its trees.
+*/
+BOOST_AUTO_TEST_CASE(system_polynomial_evaluation_not_used_for_nonpolynomial)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y);
+	sys.UsePolynomialEvaluation(true);
+	BOOST_CHECK(sys.UsingPolynomialEvaluation());
+
+	sys.AddFunction(sin(x) + y);
+	BOOST_CHECK(!sys.UsingPolynomialEvaluation());
+
+	Vec<dbl> values(2);
+	values << dbl(2), dbl(3);
+	auto f = sys.Eval(values);
+	BOOST_CHECK(abs(f(1) - (sin(dbl(2)) + dbl(3))) < threshold_clearance_d);
+}
+
+
+/**
+\class bertini::System
+\test \b system_compiled_evaluation_recompiles_after_modification Adding a function to a system in compiled evaluation mode must cause it to be lowered again.
+*/
+BOOST_AUTO_TEST_CASE(system_compiled_evaluation_recompiles_after_modification)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y);
+	sys.UseCompiledEvaluation(true);
+
+	Vec<dbl> values(2);
+	values << dbl(2), dbl(3);
+
+	auto f = sys.Eval(values);
+	BOOST_CHECK_EQUAL(f.size(), 1);
+	BOOST_CHECK(abs(f(0) - dbl(6)) < threshold_clearance_d);
+
+	sys.AddFunction(x/y + pow(x,2));
+	f = sys.Eval(values);
+	BOOST_CHECK_EQUAL(f.size(), 2);
+	BOOST_CHECK(abs(f(1) - dbl(2.0/3.0 + 4.0)) < threshold_clearance_d);
+}
+
+/**
+\class bertini::System
+\test \b system_compiled_jacobian_matches_tree The Jacobian and time derivative computed by reverse sweeps over the compiled program must match those from the differentiated trees.
+*/
+BOOST_AUTO_TEST_CASE(system_compiled_jacobian_matches_tree)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var z = std::make_shared<bertini::Variable>("z");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	auto shared = x*y - z;
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(shared,3)*t + cos(x)/y - (1-t)*exp(y*z));
+	sys.AddFunction(-shared + sqrt(x+t) - pow(y,mpfr_float("1.5")) + z/(x*t) + atan(z));
+	sys.AddFunction(x + y + 2*t);
+
+	Vec<dbl> values(3);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4), dbl(-0.7,0.2);
+	dbl time(0.5,0.1);
+
+	auto J_tree = sys.Jacobian(values, time);
+	auto dt_tree = sys.TimeDerivative(values, time);
+	sys.UseCompiledEvaluation(true);
+	auto J_compiled = sys.Jacobian(values, time);
+	auto dt_compiled = sys.TimeDerivative(values, time);
+
+	// the reverse sweeps and the differentiated trees round differently, by a few ulps of the entries, some of which are larger than 1
+	using std::max;
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+	{
+		BOOST_CHECK(abs(dt_tree(ii) - dt_compiled(ii)) < relaxed_threshold_clearance_d * max(1.0, abs(dt_tree(ii))));
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_compiled(ii,jj)) < relaxed_threshold_clearance_d * max(1.0, abs(J_tree(ii,jj))));
+	}
+
+	BOOST_CHECK_EQUAL(J_compiled(2,2), dbl(0));
+
+
+	Vec<mpfr> values_mp(3);
+	values_mp << mpfr("0.3","-1.2"), mpfr("1.1","0.4"), mpfr("-0.7","0.2");
+	mpfr time_mp("0.5","0.1");
+
+	auto J_compiled_mp = sys.Jacobian(values_mp, time_mp);
+	sys.UseCompiledEvaluation(false);
+	auto J_tree_mp = sys.Jacobian(values_mp, time_mp);
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_compiled_mp(ii,jj)) < threshold_clearance_mp);
+}
+
+/**
+\class bertini::System
+\test \b system_compiled_evaluation_by_team_matches_serial Sharing compiled evaluation among a team of threads must give the values, Jacobian, and time derivative of evaluation on one thread, with subexpressions shared among many functions, wide enough to be computed in parallel.
+*/
+BOOST_AUTO_TEST_CASE(system_compiled_evaluation_by_team_matches_serial)
+{
+	const unsigned n = 12, num_shared = 80;
+	std::vector<Var> x;
+	for (unsigned ii = 0; ii < n; ++ii)
+		x.push_back(std::make_shared<bertini::Variable>("x" + std::to_string(ii)));
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	std::vector<std::shared_ptr<bertini::node::Node> > shared;
+	for (unsigned k = 0; k < num_shared; ++k)
+		shared.push_back(x[k%n]*x[(7*k+3)%n] + int(k));
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup(x.begin(), x.end()));
+	sys.AddPathVariable(t);
+	for (unsigned ii = 0; ii < n; ++ii)
+	{
+		std::shared_ptr<bertini::node::Node> f = t*pow(x[ii],2) - sin(x[(ii+1)%n]);
+		for (unsigned k = 0; k < 10; ++k)
+			f = f + shared[(5*ii+k)%num_shared]*x[ii];
+		sys.AddFunction(f);
+	}
+	sys.UseCompiledEvaluation(true);
+
+	Vec<dbl> values(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		values(ii) = dbl(0.1*ii - 0.4, 0.3 - 0.05*ii);
+	dbl time(0.6,0.2);
+
+	auto f_serial = sys.Eval(values, time);
+	auto J_serial = sys.Jacobian(values, time);
+	auto dt_serial = sys.TimeDerivative(values, time);
+
+	sys.SetEvaluationTeam(std::make_shared<bertini::detail::ThreadTeam>(4));
+	auto f_team = sys.Eval(values, time);
+	auto J_team = sys.Jacobian(values, time);
+	auto dt_team = sys.TimeDerivative(values, time);
+
+	BOOST_CHECK((f_team - f_serial).norm() < threshold_clearance_d);
+	BOOST_CHECK((J_team - J_serial).norm() < threshold_clearance_d);
+	BOOST_CHECK((dt_team - dt_serial).norm() < threshold_clearance_d);
+
+	Vec<mpfr> values_mp(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		values_mp(ii) = mpfr(values(ii));
+	mpfr time_mp(time);
+
+	auto J_team_mp = sys.Jacobian(values_mp, time_mp);
+	sys.SetEvaluationTeam(nullptr);
+	auto J_serial_mp = sys.Jacobian(values_mp, time_mp);
+
+	BOOST_CHECK((J_team_mp - J_serial_mp).norm() < threshold_clearance_mp);
+}
+
+/**
+\class bertini::System
+\test \b system_fused_eval_and_jacobian The fused entry points EvalAndJacobianInPlace and JacobianAndTimeDerivativeInPlace must agree with the separate evaluations, for both tree and compiled evaluation, on a patched system.
+*/
+BOOST_AUTO_TEST_CASE(system_fused_eval_and_jacobian)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*y*t - pow(x,2) + 3);
+	sys.AddFunction(pow(y,3)*t - x/2);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	Vec<dbl> values(3);
+	values << dbl(1.0,0.2), dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	for (bool compiled : {false, true})
+	{
+		sys.UseCompiledEvaluation(compiled);
+
+		auto f = sys.Eval(values, time);
+		auto J = sys.Jacobian(values, time);
+		auto dt = sys.TimeDerivative(values, time);
+
+		Vec<dbl> f_fused(sys.NumTotalFunctions()), dt_fused(sys.NumTotalFunctions());
+		Mat<dbl> J_fused(sys.NumTotalFunctions(), sys.NumVariables()), J_fused_2(sys.NumTotalFunctions(), sys.NumVariables());
+		sys.EvalAndJacobianInPlace(f_fused, J_fused, values, time);
+		sys.JacobianAndTimeDerivativeInPlace(J_fused_2, dt_fused, values, time);
+
+		BOOST_CHECK((f - f_fused).norm() < threshold_clearance_d);
+		BOOST_CHECK((J - J_fused).norm() < threshold_clearance_d);
+		BOOST_CHECK((J - J_fused_2).norm() < threshold_clearance_d);
+		BOOST_CHECK((dt - dt_fused).norm() < threshold_clearance_d);
+	}
+}
+
+
+
+
+/**
+\class bertini::System
+\test \b system_jacobian_products_and_columns Products of the Jacobian with vectors on either side, and subsets of its columns, must agree with the full Jacobian, on a patched system with a path variable and a transcendental function.
+*/
+BOOST_AUTO_TEST_CASE(system_jacobian_products_and_columns)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*y*t - pow(x,2) + 3*y*t);
+	sys.AddFunction(pow(y,3)*t - x*exp(t)/2);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	Vec<dbl> values(3), v(3), w(3);
+	values << dbl(1.0,0.2), dbl(0.3,-1.2), dbl(1.1,0.4);
+	v << dbl(0.2,-0.7), dbl(1.3,0.1), dbl(-0.4,0.5);
+	w << dbl(0.6,0.6), dbl(-1.1,0.3), dbl(0.8,-0.2);
+	dbl time(0.5,0.1);
+
+	auto J = sys.Jacobian(values, time);
+
+	BOOST_CHECK((sys.JacobianTimesVector(values, time, v) - J*v).norm() < threshold_clearance_d);
+	BOOST_CHECK((sys.VectorTimesJacobian(values, time, w) - J.transpose()*w).norm() < threshold_clearance_d);
+
+	auto columns = sys.JacobianColumns(values, time, {2,0});
+	BOOST_CHECK_EQUAL(columns.cols(), 2);
+	BOOST_CHECK((columns.col(0) - J.col(2)).norm() < threshold_clearance_d);
+	BOOST_CHECK((columns.col(1) - J.col(0)).norm() < threshold_clearance_d);
+
+	BOOST_CHECK_THROW(sys.JacobianTimesVector(values, v), std::runtime_error);
+	BOOST_CHECK_THROW(sys.JacobianColumns(values, time, {3}), std::runtime_error);
+
+
+	Vec<mpfr> values_mp(3), v_mp(3);
+	values_mp << mpfr("1.0","0.2"), mpfr("0.3","-1.2"), mpfr("1.1","0.4");
+	v_mp << mpfr("0.2","-0.7"), mpfr("1.3","0.1"), mpfr("-0.4","0.5");
+	mpfr time_mp("0.5","0.1");
+
+	auto J_mp = sys.Jacobian(values_mp, time_mp);
+	Vec<mpfr> Jv_mp = J_mp*v_mp;
+	auto Jv = sys.JacobianTimesVector(values_mp, time_mp, v_mp);
+	for (unsigned ii = 0; ii < sys.NumTotalFunctions(); ++ii)
+		BOOST_CHECK(abs(Jv(ii) - Jv_mp(ii)) < threshold_clearance_mp);
+}
+
+
+
+
+/**
+\class bertini::System
+\test \b system_sparse_jacobian_matches_dense Structural zeros of the Jacobian must be found, and the sparse Jacobian must agree with the dense one, including the patch, in both evaluation modes.
+*/
+BOOST_AUTO_TEST_CASE(system_sparse_jacobian_matches_dense)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*t - 1);
+	sys.AddFunction(pow(y,3)*t - x/2);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	// the first function does not depend on y
+	auto const& structure = sys.JacobianStructure();
+	BOOST_CHECK_EQUAL(structure.size(), 2);
+	BOOST_CHECK_EQUAL(structure[0].size(), 2);
+	BOOST_CHECK_EQUAL(structure[1].size(), 3);
+	BOOST_CHECK(sys.JacobianDensity() < 1);
+
+	Vec<dbl> values(3);
+	values << dbl(1.0,0.2), dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	for (bool compiled : {false, true})
+	{
+		sys.UseCompiledEvaluation(compiled);
+
+		auto J = sys.Jacobian(values, time);
+
+		Eigen::SparseMatrix<dbl> J_sparse;
+		sys.SparseJacobianInPlace(J_sparse, values, time);
+
+		BOOST_CHECK_EQUAL(J_sparse.nonZeros(), 8);
+		BOOST_CHECK((J - Mat<dbl>(J_sparse)).norm() < threshold_clearance_d);
+	}
+}
+
+
+
+
+/**
+\class bertini::System
+\test \b system_selective_reset_after_setting_space_or_time Setting only the variables, or only the path variable, must invalidate every node depending on that value, while the values of the other nodes remain correct.
+*/
+BOOST_AUTO_TEST_CASE(system_selective_reset_after_setting_space_or_time)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	auto c = exp(bertini::node::Pi()/4);
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*y + c*t);
+	sys.AddFunction(pow(t,2) - c);
+	sys.AddFunction(y - 2*c);
+
+	const dbl cval = exp(dbl(acos(-1.0)/4));
+	Vec<dbl> f(3);
+
+	Vec<dbl> values(2);
+	values << dbl(1,1), dbl(2,-1);
+	dbl time(0.5,0.2);
+
+	sys.SetVariables(values);
+	sys.SetPathVariable(time);
+	sys.EvalInPlace(f);
+	BOOST_CHECK(abs(f(0) - (values(0)*values(1) + cval*time)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - (time*time - cval)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(2) - (values(1) - 2.*cval)) < threshold_clearance_d);
+
+	values << dbl(-0.5,3), dbl(0.25,1);
+	sys.SetVariables(values);
+	sys.EvalInPlace(f);
+	BOOST_CHECK(abs(f(0) - (values(0)*values(1) + cval*time)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - (time*time - cval)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(2) - (values(1) - 2.*cval)) < threshold_clearance_d);
+
+	time = dbl(-1.5,0.7);
+	sys.SetPathVariable(time);
+	sys.EvalInPlace(f);
+	BOOST_CHECK(abs(f(0) - (values(0)*values(1) + cval*time)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - (time*time - cval)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(2) - (values(1) - 2.*cval)) < threshold_clearance_d);
+}
+
+
+
+/**
+\class bertini::System
+\test \b system_differentiate_merges_common_subexpressions Differentiation merges the repeated factors produced by the product rule, reducing the number of distinct nodes, without changing the values of the functions or the Jacobian.
+*/
+BOOST_AUTO_TEST_CASE(system_differentiate_merges_common_subexpressions)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var z = std::make_shared<bertini::Variable>("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(x*y*z + pow(x,2)*y);
+	sys.AddFunction(x*y*z - pow(x,2)*z);
+	sys.AddFunction(pow(x,2)*y*z - 1);
+
+	Vec<dbl> values(3);
+	values << dbl(1.0,0.2), dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl a = values(0), b = values(1), c = values(2);
+
+	auto J = sys.Jacobian(values);
+
+	auto const& stats = sys.CommonSubexpressionStatistics();
+	BOOST_CHECK(stats.nodes_after < stats.nodes_before);
+
+	Mat<dbl> J_exact(3,3);
+	J_exact << b*c + 2.*a*b, a*c + a*a, a*b,
+	           b*c - 2.*a*c, a*c, a*b - a*a,
+	           2.*a*b*c, a*a*c, a*a*b;
+
+	BOOST_CHECK((J - J_exact).norm() < threshold_clearance_d);
+
+	auto f = sys.Eval(values);
+	BOOST_CHECK(abs(f(0) - (a*b*c + a*a*b)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - (a*b*c - a*a*c)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(2) - (a*a*b*c - 1.)) < threshold_clearance_d);
+}
+
+/**
+\class bertini::System
+\test \b system_batch_evaluation_matches_pointwise Evaluating the functions and Jacobian at a batch of points must agree with evaluating at each point separately.
+*/
+BOOST_AUTO_TEST_CASE(system_batch_evaluation_matches_pointwise)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var z = std::make_shared<bertini::Variable>("z");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(x*y - z,3)*t + cos(x)/y - (1-t)*exp(y*z));
+	sys.AddFunction(x*x/z + sqrt(x+t) - pow(y,mpfr_float("1.5")));
+	sys.AddFunction(x + y + 2*t);
+
+	const unsigned num_points = 7;
+	Mat<dbl> X(3, num_points);
+	for (unsigned kk = 0; kk < num_points; ++kk)
+		X.col(kk) << dbl(0.3+0.1*kk,-1.2), dbl(1.1,0.4-0.05*kk), dbl(-0.7,0.2+0.01*kk);
+	dbl time(0.5,0.1);
+
+	Mat<dbl> F;
+	std::vector< Mat<dbl> > J;
+	sys.EvalBatch(X, time, F);
+	sys.JacobianBatch(X, time, J);
+
+	BOOST_CHECK_EQUAL(F.rows(), sys.NumTotalFunctions());
+	BOOST_CHECK_EQUAL(F.cols(), num_points);
+	BOOST_CHECK_EQUAL(J.size(), num_points);
+
+	for (unsigned kk = 0; kk < num_points; ++kk)
+	{
+		Vec<dbl> x_k = X.col(kk);
+		auto f_k = sys.Eval(x_k, time);
+		auto J_k = sys.Jacobian(x_k, time);
+
+		for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+		{
+			BOOST_CHECK(abs(F(ii,kk) - f_k(ii)) < relaxed_threshold_clearance_d);
+			for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+				BOOST_CHECK(abs(J[kk](ii,jj) - J_k(ii,jj)) < relaxed_threshold_clearance_d);
+		}
+	}
+}
+
+/**
+\class bertini::System
+\test \b system_evaluation_context_independent Evaluating through separate caller-owned contexts must agree with ordinary evaluation, and must not disturb the values in other contexts or in the system.
+*/
+BOOST_AUTO_TEST_CASE(system_evaluation_context_independent)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(t*pow(x,3) - sin(y)*(1-t));
+	sys.AddFunction(x*y/(x+t) - 2);
+
+	Vec<dbl> p(2), q(2);
+	p << dbl(0.3,-1.2), dbl(1.1,0.4);
+	q << dbl(-0.7,0.2), dbl(0.5,0.9);
+	dbl time(0.5,0.1);
+
+	auto f_p = sys.Eval(p, time);
+	auto J_p = sys.Jacobian(p, time);
+	auto f_q = sys.Eval(q, time);
+	auto J_q = sys.Jacobian(q, time);
+
+	auto context_p = sys.MakeEvaluationContext();
+	auto context_q = sys.MakeEvaluationContext();
+
+	Vec<dbl> g_p(2), g_q(2);
+	Mat<dbl> K_p(2,2), K_q(2,2);
+	sys.EvalInPlace(context_p, g_p, p, time);
+	sys.EvalInPlace(context_q, g_q, q, time);
+	sys.JacobianInPlace(context_p, K_p, p, time);
+	sys.JacobianInPlace(context_q, K_q, q, time);
+
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_p(ii) - g_p(ii)) < relaxed_threshold_clearance_d);
+		BOOST_CHECK(abs(f_q(ii) - g_q(ii)) < relaxed_threshold_clearance_d);
+		for (unsigned jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(J_p(ii,jj) - K_p(ii,jj)) < relaxed_threshold_clearance_d);
+			BOOST_CHECK(abs(J_q(ii,jj) - K_q(ii,jj)) < relaxed_threshold_clearance_d);
+		}
+	}
+
+	// the system's own state is that of the last ordinary evaluation, at q.
+	auto f_current = sys.Eval<dbl>();
+	for (unsigned ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(f_current(ii) - f_q(ii)) < relaxed_threshold_clearance_d);
+
+	sys.AddFunction(x - y);
+	Vec<dbl> g(3);
+	BOOST_CHECK_THROW(sys.EvalInPlace(context_p, g, p, time), std::runtime_error);
+}
+
+
+
+/**
+\class bertini::SystemCache
+\test \b system_cache_stores_and_loads A system made through the cache is loaded on the next request for the same text and settings, without being prepared again, and evaluates the same.
+*/
+BOOST_AUTO_TEST_CASE(system_cache_stores_and_loads)
+{
+	namespace fs = boost::filesystem;
+	auto directory = fs::temp_directory_path() / fs::unique_path("b2_system_cache_test_%%%%-%%%%");
+
+	bertini::classic::SplitInputFile input;
+	input.SetInput("variable_group x, y; function f1, f2; f1 = x^2*y - 3; f2 = x - y;");
+
+	unsigned num_prepared = 0;
+	auto prepare = [&num_prepared](System & s){ s.Differentiate(); ++num_prepared; };
+
+	Vec<dbl> values(2);
+	values << dbl(1.5,0.2), dbl(-0.5,1);
+
+	{
+		bertini::SystemCache cache(directory);
+
+		auto made = cache.GetOrMake(input, "settings a", prepare);
+		BOOST_CHECK_EQUAL(num_prepared, 1);
+
+		auto loaded = cache.GetOrMake(input, "settings a", prepare);
+		BOOST_CHECK_EQUAL(num_prepared, 1);
+
+		auto f_made = made.Eval(values);
+		auto f_loaded = loaded.Eval(values);
+		auto J_made = made.Jacobian(values);
+		auto J_loaded = loaded.Jacobian(values);
+		for (unsigned ii = 0; ii < 2; ++ii)
+		{
+			BOOST_CHECK(abs(f_made(ii) - f_loaded(ii)) < threshold_clearance_d);
+			for (unsigned jj = 0; jj < 2; ++jj)
+				BOOST_CHECK(abs(J_made(ii,jj) - J_loaded(ii,jj)) < threshold_clearance_d);
+		}
+
+		// different settings are a different key
+		cache.GetOrMake(input, "settings b", prepare);
+		BOOST_CHECK_EQUAL(num_prepared, 2);
+
+		System unchanged;
+		BOOST_CHECK(!cache.Load("variable_group z; function g; g = z;", "settings a", unchanged));
+		BOOST_CHECK_EQUAL(unchanged.NumFunctions(), 0);
+	}
+
+	fs::remove_all(directory);
+}
+
+
+/**
+\test \b system_reader_matches_qi_parser ReadSystem makes the same system as the Qi parser, including the reading of a leading minus sign, and rejects what the Qi parser rejects.
+*/
+BOOST_AUTO_TEST_CASE(system_reader_matches_qi_parser)
+{
+	std::string text = "variable_group x, y;\n"
+						"variable z;\n"
+						"pathvariable t;\n"
+						"parameter s;\n"
+						"constant c;\n"
+						"function f1, f2, f3;\n"
+						"c = 1.5e-1 - 2*I;\n"
+						"s = t^2;\n"
+						"g = x*y - z/3;\n"
+						"f1 = g^2 + -x + y - .25*sin(x) + cos(y)*exp(z);\n"
+						"f2 = -2^2*x - c*s*(x + y)^3 + sqrt(z) - tan(pi*x)/7.;\n"
+						"f3 = x*-y + z + log(1 + x*x) - 3.0E2*g;\n";
+
+	System qi(text);
+	System reader = bertini::ReadSystem(text);
+
+	BOOST_CHECK_EQUAL(reader.NumFunctions(), qi.NumFunctions());
+	BOOST_CHECK_EQUAL(reader.NumVariables(), qi.NumVariables());
+	BOOST_CHECK_EQUAL(reader.NumVariableGroups(), qi.NumVariableGroups());
+	BOOST_CHECK(reader.HavePathVariable());
+
+	Vec<dbl> values(3);
+	values << dbl(0.3,0.2), dbl(-0.5,1), dbl(1.1,-0.4);
+	dbl time(0.7,0.1);
+
+	auto f_qi = qi.Eval(values, time);
+	auto f_reader = reader.Eval(values, time);
+	auto J_qi = qi.Jacobian(values, time);
+	auto J_reader = reader.Jacobian(values, time);
+	for (unsigned ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f_qi(ii) - f_reader(ii)) < threshold_clearance_d);
+		for (unsigned jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(J_qi(ii,jj) - J_reader(ii,jj)) < threshold_clearance_d);
+	}
+
+	BOOST_CHECK_THROW(bertini::ReadSystem("variable_group x; function f; f = y;"), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::ReadSystem("variable_group x; function f; f = x"), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::ReadSystem("variable_group x, x; function f; f = x;"), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::ReadSystem("variable_group x; function f; x = f;"), std::runtime_error);
+}
+
+
+/**
+\test \b system_reader_parallel_definitions Reading the definitions of a large system over several threads gives the same system as reading them on one, and an error is reported at the first place in the text, whichever thread finds it.
+*/
+BOOST_AUTO_TEST_CASE(system_reader_parallel_definitions)
+{
+	const unsigned num_functions = 200, num_terms = 60;
+
+	std::stringstream text;
+	text << "variable_group x0, x1, x2, x3;\nfunction ";
+	for (unsigned ii = 0; ii < num_functions; ++ii)
+		text << "f" << ii << (ii+1<num_functions ? ", " : ";\n");
+	text << "g = x0*x1 - 1;\n";
+	for (unsigned ii = 0; ii < num_functions; ++ii)
+	{
+		text << "f" << ii << " = g";
+		for (unsigned jj = 0; jj < num_terms; ++jj)
+			text << " + " << (ii+jj)%7+1 << "*x" << jj%4 << "^" << jj%3 << "*x" << (ii+jj)%4;
+		text << ";\n";
+	}
+	BOOST_REQUIRE(text.str().size() > (1<<16)); // so that the reading is actually parallel
+
+	System serial = bertini::ReadSystem(text.str(), 1);
+	System parallel = bertini::ReadSystem(text.str(), 4);
+
+	BOOST_CHECK_EQUAL(parallel.NumFunctions(), num_functions);
+
+	Vec<dbl> values(4);
+	values << dbl(0.3,0.2), dbl(-0.5,1), dbl(1.1,-0.4), dbl(0.2,0.9);
+
+	auto f_serial = serial.Eval(values);
+	auto f_parallel = parallel.Eval(values);
+	for (unsigned ii = 0; ii < num_functions; ++ii)
+		BOOST_CHECK(abs(f_serial(ii) - f_parallel(ii)) < threshold_clearance_d);
+
+	std::string bad = text.str() + "f0 = x0 + y;\nf1 = x1 + z;\n";
+	try
+	{
+		bertini::ReadSystem(bad, 4);
+		BOOST_CHECK(false);
+	}
+	catch (std::runtime_error const& e)
+	{
+		BOOST_CHECK(std::string(e.what()).find("f0 = x0 + y")!=std::string::npos);
+	}
+
+	// a name may be used only after its declaration, as when reading in one pass
+	BOOST_CHECK_THROW(bertini::ReadSystem("function f; f = h; h = 1;", 1), std::runtime_error);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(eval_profile_reports_functions_and_subfunctions)
+{
+	System sys("function f1, f2; variable_group x, y; g = x*y; f1 = g + x^2; f2 = g - y;");
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+
+	bertini::node::profile::Reset();
+
+	Vec<dbl> values(2);
+	for (unsigned ii = 0; ii < 10; ++ii)
+	{
+		values << dbl(0.3+ii,0.2), dbl(-0.5,1+ii);
+		sys.Eval(values);
+	}
+
+	auto const& profiles = bertini::node::profile::Profiles();
+
+#ifdef BERTINI_ENABLE_EVAL_PROFILING
+	auto f1 = profiles.find(sys.Function(0).get());
+	BOOST_REQUIRE(f1!=profiles.end());
+	BOOST_CHECK_EQUAL(f1->second.num_evals_d, 10);
+	BOOST_CHECK_EQUAL(f1->second.num_evals_mp, 0);
+	BOOST_CHECK(f1->second.total_seconds_d >= f1->second.self_seconds_d);
+
+	std::stringstream report;
+	bertini::node::profile::Report(report, sys);
+	BOOST_CHECK(report.str().find("f1")!=std::string::npos);
+	BOOST_CHECK(report.str().find("g (subfunction)")!=std::string::npos);
+#else
+	BOOST_CHECK(profiles.empty());
+#endif
+}
+
+
+
+BOOST_AUTO_TEST_CASE(memory_usage_grows_with_jacobian_and_precision)
+{
+	System sys("function f1, f2; variable_group x, y; g = x*y; f1 = g + x^2; f2 = g - y;");
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+
+	Vec<mpfr> values(2);
+	values << mpfr(0.3,0.2), mpfr(-0.5,1);
+
+	sys.Eval(values);
+	auto before = sys.MemoryUsage();
+	BOOST_CHECK(before.components.at("function trees") > 0);
+	BOOST_CHECK_EQUAL(before.components.at("jacobian trees"), 0);
+
+	sys.Jacobian(values);
+	auto differentiated = sys.MemoryUsage();
+	BOOST_CHECK(differentiated.components.at("jacobian trees") > 0);
+	BOOST_CHECK(differentiated.Total() > before.Total());
+
+	DefaultPrecision(100);
+	sys.precision(100);
+	values << mpfr(0.3,0.2), mpfr(-0.5,1);
+	sys.Jacobian(values);
+	auto higher = sys.MemoryUsage();
+	BOOST_CHECK(higher.components.at("function trees") > differentiated.components.at("function trees"));
+	BOOST_CHECK(higher.components.at("workspace") > differentiated.components.at("workspace"));
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(compiled_jacobian_makes_no_derivative_trees)
+{
+	System sys("function f1, f2; variable_group x, y; g = x*y; f1 = g + x^2; f2 = g - y;");
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(true);
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,0.2), dbl(-0.5,1);
+
+	sys.Eval(values);
+	auto J_compiled = sys.Jacobian(values);
+	Eigen::SparseMatrix<dbl> J_sparse;
+	sys.SparseJacobianInPlace(J_sparse);
+	BOOST_CHECK_EQUAL(sys.JacobianStructure().size(), 2);
+	BOOST_CHECK_EQUAL(sys.MemoryUsage().components.at("jacobian trees"), 0);
+
+	// the trees are made on first use, and agree
+	sys.UseCompiledEvaluation(false);
+	auto J_trees = sys.Jacobian(values);
+	BOOST_CHECK(sys.MemoryUsage().components.at("jacobian trees") > 0);
+	BOOST_CHECK((J_trees - J_compiled).norm() < 1e-14);
+	BOOST_CHECK((Mat<dbl>(J_sparse) - J_compiled).norm() < 1e-14);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(precision_change_reaches_every_shared_node)
+{
+	System sys("function f1, f2; variable_group x, y; g = x*y; f1 = g + x^2; f2 = g*g - y;");
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+
+	Vec<mpfr> values(2);
+	values << mpfr(0.3,0.2), mpfr(-0.5,1);
+	auto J_before = sys.Jacobian(values);
+
+	DefaultPrecision(100);
+	sys.precision(100);
+
+	for (auto const& n : bertini::node::UniqueNodes({sys.Function(0), sys.Function(1)}))
+		BOOST_CHECK_EQUAL(n->precision(), 100);
+
+	values << mpfr(0.3,0.2), mpfr(-0.5,1);
+	auto J = sys.Jacobian(values);
+	for (int ii = 0; ii < J.rows(); ++ii)
+		for (int jj = 0; jj < J.cols(); ++jj)
+		{
+			BOOST_CHECK_EQUAL(Precision(J(ii,jj)), 100);
+			BOOST_CHECK(abs(J(ii,jj) - J_before(ii,jj)) < 1e-25);
+		}
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	sys.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(set_variables_binds_by_index_after_reordering_and_copy)
+{
+	System sys("function f; variable_group x; variable_group y; f = x - 2*y;");
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+
+	Vec<dbl> values(2);
+	values << dbl(1,0), dbl(3,0);
+	BOOST_CHECK(abs(sys.Eval(values)(0) - dbl(-5,0)) < 1e-14);
+
+	// a new group changes the ordering, so the variables are bound again
+	VariableGroup z{std::make_shared<bertini::Variable>("z")};
+	sys.AddVariableGroup(z);
+	Vec<dbl> more(3);
+	more << dbl(1,0), dbl(3,0), dbl(7,0);
+	BOOST_CHECK(abs(sys.Eval(more)(0) - dbl(-5,0)) < 1e-14);
+
+	System copy(sys);
+	more << dbl(4,0), dbl(1,0), dbl(0,0);
+	BOOST_CHECK(abs(copy.Eval(more)(0) - dbl(2,0)) < 1e-14);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(degree_and_coefficient_bounds_are_kept_until_modified)
+{
+	System sys("function f1, f2; variable_group x, y; f1 = x^2*y - 3; f2 = 5*x - y;");
+
+	BOOST_CHECK_EQUAL(sys.DegreeBound(), 3);
+	auto bound = sys.CoefficientBound();
+	BOOST_CHECK(bound > 0);
+	BOOST_CHECK_EQUAL(sys.CoefficientBound(), bound);
+
+	// more points only raise the estimate
+	BOOST_CHECK(sys.CoefficientBound(3) >= bound);
+
+	std::shared_ptr<Variable> x = sys.Variables()[0];
+	sys.AddFunction(pow(x,5)*1000);
+	BOOST_CHECK_EQUAL(sys.DegreeBound(), 5);
+	BOOST_CHECK(sys.CoefficientBound() > 100);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(structural_hash_and_equality_ignore_node_identity)
+{
+	System a("function f1, f2; variable_group x, y; f1 = x^2*y - 3/2; f2 = sin(x) + y;");
+	System b("function f1, f2; variable_group x, y; f1 = x^2*y - 3/2; f2 = sin(x) + y;");
+	System c("function f1, f2; variable_group x, y; f1 = x^2*y - 5/2; f2 = sin(x) + y;");
+
+	BOOST_CHECK_EQUAL(a.StructuralHash(), b.StructuralHash());
+	BOOST_CHECK(a.StructuralHash() != c.StructuralHash());
+
+	bertini::node::StructuralHasher hasher;
+	BOOST_CHECK(a.Function(0) != b.Function(0));
+	BOOST_CHECK(hasher.Equal(a.Function(0), b.Function(0)));
+	BOOST_CHECK(hasher.Equal(a.Function(1), b.Function(1)));
+	BOOST_CHECK(!hasher.Equal(a.Function(0), c.Function(0)));
+	BOOST_CHECK(!hasher.Equal(a.Function(0), a.Function(1)));
+
+	BOOST_CHECK(bertini::node::StructurallyEqual(a.Function(1), c.Function(1)));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(native_evaluation_matches_tree)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(x*y - 1,3)*t + cos(x)/y - (1-t)*exp(y));
+	sys.AddFunction(sqrt(x+t) - pow(y,-2) + x/(y*t));
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	auto f_tree = sys.Eval(values, time);
+	auto J_tree = sys.Jacobian(values, time);
+
+	auto cache = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+	sys.UseCompiledEvaluation(true);
+	sys.UseNativeEvaluation(true, cache);
+	BOOST_CHECK(sys.UsingNativeEvaluation());
+
+	Vec<dbl> f_native;
+	Mat<dbl> J_native;
+	try{
+		f_native = sys.Eval(values, time);
+		J_native = sys.Jacobian(values, time);
+	}
+	catch (std::runtime_error const& e)
+	{
+		BOOST_TEST_MESSAGE("no compiler for native evaluation: " << e.what());
+		return;
+	}
+
+	for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_native(ii)) < relaxed_threshold_clearance_d);
+		for (unsigned jj = 0; jj < sys.NumVariables(); ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_native(ii,jj)) < relaxed_threshold_clearance_d);
+	}
+
+	boost::filesystem::remove_all(cache);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(native_evaluation_refuses_a_cache_others_can_write)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 2);
+
+	Vec<dbl> values(1);
+	values << dbl(1.5,0.1);
+
+	auto cache = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	boost::filesystem::create_directory(cache);
+	boost::filesystem::permissions(cache, boost::filesystem::all_all);
+
+	sys.UseCompiledEvaluation(true);
+	sys.UseNativeEvaluation(true, cache.string());
+	BOOST_CHECK_THROW(sys.Eval(values), std::runtime_error);
+
+	boost::filesystem::remove_all(cache);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(taylor_coefficients_of_system_and_path)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(pow(x,2) - (1+t));
+	sys.AddFunction(y - exp(t)*x);
+
+	const unsigned order = 4;
+	using std::exp;
+
+	// in time, at a point off the path
+	Vec<dbl> values(2);
+	values << dbl(0.3,-1.2), dbl(1.1,0.4);
+	dbl time(0.5,0.1);
+
+	auto S = sys.TimeTaylorCoefficients(values, time, order);
+	BOOST_CHECK(abs(S(0,0) - (values(0)*values(0) - 1.0 - time)) < relaxed_threshold_clearance_d);
+	BOOST_CHECK(abs(S(0,1) - dbl(-1)) < relaxed_threshold_clearance_d);
+	double factorial = 1;
+	for (unsigned k = 1; k <= order; ++k)
+	{
+		factorial *= k;
+		BOOST_CHECK(abs(S(1,k) + values(0)*exp(time)/factorial) < relaxed_threshold_clearance_d);
+		if (k>1)
+			BOOST_CHECK(abs(S(0,k)) < relaxed_threshold_clearance_d);
+	}
+
+	// the path through (1,1) at t=0 is x = sqrt(1+t), y = exp(t) sqrt(1+t)
+	Vec<dbl> start(2);
+	start << dbl(1), dbl(1);
+	auto X = sys.PathTaylorCoefficients(start, dbl(0), order);
+
+	std::vector<double> root{1, 0.5, -0.125, 0.0625, -0.0390625};
+	std::vector<double> e{1, 1, 0.5, 1.0/6, 1.0/24};
+	for (unsigned k = 0; k <= order; ++k)
+	{
+		double product = 0;
+		for (unsigned j = 0; j <= k; ++j)
+			product += e[j]*root[k-j];
+		BOOST_CHECK(abs(X(0,k) - root[k]) < relaxed_threshold_clearance_d);
+		BOOST_CHECK(abs(X(1,k) - product) < relaxed_threshold_clearance_d);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(ball_evaluation_encloses_values_and_jacobian)
+{
+	using bertini::Ball;
+
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,3)*y - exp(y) + 2);
+	sys.AddFunction(sin(x*y) + sqrt(x) - y/x);
+
+	Vec<Ball<dbl> > box(2);
+	box << Ball<dbl>(dbl(1.2,0.3), 0.05), Ball<dbl>(dbl(-0.4,0.7), 0.05);
+	auto F = sys.EvalBall(box);
+	auto J = sys.JacobianBall(box);
+
+	for (int ii = 0; ii < 2; ++ii)
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(J(ii,jj).IsFinite() && J(ii,jj).Rad() < 1);
+
+	// corners and center of the box
+	for (double a : {-1., 0., 1.})
+		for (double b : {-1., 0., 1.})
+		{
+			Vec<dbl> v(2);
+			v << box(0).Mid() + dbl(a,b)*0.035, box(1).Mid() + dbl(b,-a)*0.035;
+			Vec<dbl> f = sys.Eval(v);
+			Mat<dbl> D = sys.Jacobian(v);
+			for (int ii = 0; ii < 2; ++ii)
+			{
+				BOOST_CHECK(F(ii).Contains(f(ii)));
+				for (int jj = 0; jj < 2; ++jj)
+					BOOST_CHECK(J(ii,jj).Contains(D(ii,jj)));
+			}
+		}
+
+	// at a point, the balls are about the values, with radii of their rounding error
+	Vec<Ball<dbl> > point(2);
+	point << Ball<dbl>(box(0).Mid()), Ball<dbl>(box(1).Mid());
+	Vec<dbl> v(2);
+	v << box(0).Mid(), box(1).Mid();
+	auto F_point = sys.EvalBall(point);
+	Vec<dbl> f = sys.Eval(v);
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(F_point(ii).Mid() - f(ii)) < relaxed_threshold_clearance_d);
+		BOOST_CHECK(F_point(ii).Rad() < relaxed_threshold_clearance_d);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(squared_up_system_matches_its_trees)
+{
+	System sys("function f1, f2, f3, f4; variable_group x, y; f1 = x^2*y - 3/2; f2 = x + y - 1; f3 = x*y^2 + 2; f4 = x^3 - y;");
+
+	bertini::SquaredUpSystem g(sys, 2);
+	BOOST_CHECK_EQUAL(g.NumFunctions(), 2);
+	BOOST_CHECK_EQUAL(g.NumVariables(), 2);
+	BOOST_CHECK_EQUAL(g.Randomization().rows(), 2);
+	BOOST_CHECK_EQUAL(g.Randomization().cols(), 2);
+
+	auto trees = g.AsSystem();
+	BOOST_CHECK_EQUAL(trees.NumFunctions(), 2);
+
+	bertini::Vec<dbl> x(2);
+	x << dbl(0.3,0.1), dbl(-0.7,0.2);
+	bertini::Vec<dbl> values;
+	bertini::Mat<dbl> J;
+	g.EvalAndJacobianInPlace(values, J, x);
+	BOOST_CHECK((values - trees.Eval(x)).norm() < threshold_clearance_d);
+	BOOST_CHECK((J - trees.Jacobian(x)).norm() < threshold_clearance_d);
+	BOOST_CHECK((g.Eval(x) - values).norm() < threshold_clearance_d);
+	BOOST_CHECK((g.Jacobian(x) - J).norm() < threshold_clearance_d);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	trees.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	g.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::Vec<mpfr> y(2);
+	y << mpfr("0.3","0.1"), mpfr("-0.7","0.2");
+	BOOST_CHECK((g.Eval(y) - trees.Eval(y)).norm() < threshold_clearance_mp);
+	BOOST_CHECK((g.Jacobian(y) - trees.Jacobian(y)).norm() < threshold_clearance_mp);
+
+	BOOST_CHECK_THROW(bertini::SquaredUpSystem(sys, 0), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::SquaredUpSystem(sys, 5), std::runtime_error);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(systems_sharing_variables_in_other_orders_evaluate_their_own_jacobians)
+{
+	Var x = std::make_shared<bertini::Variable>("x"), y = std::make_shared<bertini::Variable>("y");
+
+	System first, second;
+	first.AddVariableGroup(VariableGroup{x,y});
+	first.AddFunction(x*y + pow(x,3));
+	first.AddFunction(sin(y) - x);
+	first.UsePolynomialEvaluation(false);
+
+	second.AddVariableGroup(VariableGroup{y,x});
+	second.AddFunction(x*y + pow(x,3));
+	second.AddFunction(sin(y) - x);
+	second.UsePolynomialEvaluation(false);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-0.3), dbl(-1.1,0.2);
+	Vec<dbl> swapped(2);
+	swapped << values(1), values(0);
+
+	Mat<dbl> expected(2,2);
+	expected << values(1) + 3.0*pow(values(0),2), values(0),
+	            dbl(-1), cos(values(1));
+
+	const auto x_id = x->Id(), y_id = y->Id();
+
+	// the ids of the shared variables are theirs, not either system's, so evaluating changes nothing shared
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		auto J = first.Jacobian(values);
+		BOOST_CHECK((J - expected).norm() < threshold_clearance_d);
+
+		auto K = second.Jacobian(swapped);
+		BOOST_CHECK(abs(K(0,0) - expected(0,1)) < threshold_clearance_d);
+		BOOST_CHECK(abs(K(0,1) - expected(0,0)) < threshold_clearance_d);
+		BOOST_CHECK(abs(K(1,0) - expected(1,1)) < threshold_clearance_d);
+		BOOST_CHECK(abs(K(1,1) - expected(1,0)) < threshold_clearance_d);
+		BOOST_CHECK_EQUAL(x->Id(), x_id);
+		BOOST_CHECK_EQUAL(y->Id(), y_id);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_SUITE_END()
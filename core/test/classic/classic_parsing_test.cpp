@@ -32,6 +32,8 @@
 
 #include "bertini.hpp"
 #include <string>
+#include <sstream>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 
 
@@ -576,6 +578,71 @@ BOOST_AUTO_TEST_CASE(test_split_and_uncomment)
 }
 
 
+BOOST_AUTO_TEST_CASE(read_input_file_strips_and_splits_in_one_pass)
+{
+    std::string test_string = "%Title of file\n CONFIG \n tracktype: 1;  %comment about setting\n %  More full comments\n %Another line of comments\n trackit: 12;\n %commentsetting: 4; \n  %%%%%%%%%%%%%%%%%END of Settings%%%%%%%%%%%%%%\n END; \n stuff %more comments\n INPUT\n %Beginning comments\n variable_group x,y; %variables\n % Parameters \n parameter t; \n function f\n %Polynomials \n f = x^2 + y;\n %End of INPUT, END;\n END; stuff end";
+
+    std::stringstream in(test_string);
+    auto config_and_input = bertini::classic::ReadInputFile(in);
+    auto config = config_and_input.Config();
+    auto input = config_and_input.Input();
+
+    BOOST_CHECK(config_and_input.Readable());
+
+    BOOST_CHECK(config.find("%")==std::string::npos);
+    BOOST_CHECK(config.find("comment about setting")==std::string::npos);
+    BOOST_CHECK(input.find("%")==std::string::npos);
+    BOOST_CHECK(input.find("Polynomials")==std::string::npos);
+    BOOST_CHECK(input.find("End of")==std::string::npos);
+
+    BOOST_CHECK(config.find("tracktype: 1;")!=std::string::npos);
+    BOOST_CHECK(config.find("trackit: 12;")!=std::string::npos);
+    BOOST_CHECK(config.find("stuff")==std::string::npos);
+
+    BOOST_CHECK(input.find("variable_group x,y;")!=std::string::npos);
+    BOOST_CHECK(input.find("f = x^2 + y;")!=std::string::npos);
+    BOOST_CHECK(input.find("stuff")==std::string::npos);
+    BOOST_CHECK(input.find("END;")==std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_CASE(read_input_file_agrees_with_split_parser)
+{
+    std::vector<std::string> test_strings{
+        "abcd CONFIG\n\ntracktype: 1;\n\nEND; between INPUT\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\nEND;  efgh", // 15
+        "abcd CONFIG\n\ntracktype: 1;\n\nEND; between INPUT\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\n", // 14
+        "abcd CONFIG\n\ntracktype: 1;\n\nEND;\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\nEND;  efgh", // 13
+        "abcd CONFIG\n\ntracktype: 1;\n\nINPUT\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\nEND;  efgh", // 11
+        "abcd CONFIG\n\ntracktype: 1;\n\nEND;\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\n", // 12
+        "abcd CONFIG\n\ntracktype: 1;\n\nINPUT\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\n", // 10
+        "abcd CONFIG\n\ntracktype: 1;\n\n", // 8
+        "abcd END; between INPUT\n\nvariable_group x, y;\n\nEND;  efgh", // 7
+        "abcd INPUT\n\nvariable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\nEND;  efgh", // 3
+        "variable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\nEND;  efgh", // 1
+        "variable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;\n\n" // 0
+    };
+
+    for (auto const& test_string : test_strings)
+    {
+        bertini::classic::parsing::SplitFileInputConfig<std::string::const_iterator> parser;
+        bertini::classic::SplitInputFile split;
+        std::string::const_iterator iter = test_string.begin();
+        std::string::const_iterator end = test_string.end();
+        phrase_parse(iter, end, parser, boost::spirit::ascii::space, split);
+
+        std::stringstream in(test_string);
+        auto read = bertini::classic::ReadInputFile(in);
+
+        BOOST_CHECK_EQUAL(read.Readable(), split.Readable());
+        if (split.Readable())
+        {
+            BOOST_CHECK_EQUAL(read.Config(), split.Config());
+            BOOST_CHECK_EQUAL(read.Input(), split.Input());
+        }
+    }
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
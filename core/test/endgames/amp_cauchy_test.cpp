@@ -38,6 +38,7 @@
 #include "bertini2/num_traits.hpp"
 
 #include "bertini2/tracking/amp_cauchy_endgame.hpp"
+#include "bertini2/tracking/hybrid_endgame.hpp"
 
 #include "bertini2/tracking/observers.hpp"
 
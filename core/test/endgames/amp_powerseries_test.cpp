@@ -31,6 +31,7 @@
 #include "bertini2/num_traits.hpp"
 
 #include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/bundle_endgame.hpp"
 
 
 
@@ -171,4 +172,117 @@ BOOST_AUTO_TEST_CASE(ensure_uniform_precision_all_uniform_to_start)
 	for (const auto& s : samples)
 		BOOST_CHECK_EQUAL(Precision(s(0)),30);
 }
+
+
+
+/**
+Samples of lower precision than the newest are raised only in the interpolators, so keep their precision, and give the same approximation as if they had been raised.
+*/
+BOOST_AUTO_TEST_CASE(mixed_precision_samples_are_not_uniformized)
+{
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(pow(x-1,3)*(1-t) + (pow(x,3)+1)*t);
+	sys.AddPathVariable(t);
+
+	auto tracker = AMPTracker(sys);
+	config::Stepping<mpfr_float> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(config::Predictor::HeunEuler,
+	              	mpfr_float("1e-5"), mpfr_float("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
+
+	const std::vector<std::string> time_strings{".1", ".05", ".025"};
+	const std::vector<std::string> sample_strings{"0.50000000000000007812610562824908678293817200689660e0",
+	                                              "0.60000000000000000073301140774132693211475245208482e0",
+	                                              "0.67729059415987117534436422700325955211292174181447e0"};
+	const std::vector<unsigned> precisions{16, 20, 30};
+
+	TimeCont<mpfr> mixed_times, uniform_times;
+	SampCont<mpfr> mixed_samples, uniform_samples;
+	for (unsigned ii = 0; ii < precisions.size(); ++ii)
+	{
+		DefaultPrecision(30);
+		uniform_times.push_back(mpfr(time_strings[ii]));
+		uniform_samples.push_back(Vec<mpfr>::Constant(1, mpfr(sample_strings[ii])));
+
+		DefaultPrecision(precisions[ii]);
+		mixed_times.push_back(mpfr(time_strings[ii]));
+		mixed_samples.push_back(Vec<mpfr>::Constant(1, mpfr(sample_strings[ii])));
+	}
+
+	DefaultPrecision(30);
+	TestedEGType uniform(tracker);
+	uniform.SetTimes(uniform_times);
+	uniform.SetSamples(uniform_samples);
+	Vec<mpfr> uniform_approximation;
+	BOOST_CHECK(uniform.ComputeApproximationOfXAtT0(uniform_approximation, mpfr(0))==SuccessCode::Success);
+
+	TestedEGType mixed(tracker);
+	mixed.SetTimes(mixed_times);
+	mixed.SetSamples(mixed_samples);
+	Vec<mpfr> mixed_approximation;
+	BOOST_CHECK(mixed.ComputeApproximationOfXAtT0(mixed_approximation, mpfr(0))==SuccessCode::Success);
+
+	for (unsigned ii = 0; ii < precisions.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(Precision(mixed.GetTimes<mpfr>()[ii]), precisions[ii]);
+		BOOST_CHECK_EQUAL(Precision(mixed.GetSamples<mpfr>()[ii](0)), precisions[ii]);
+	}
+	BOOST_CHECK_EQUAL(Precision(mixed_approximation(0)), 30);
+	BOOST_CHECK_SMALL(abs(mixed_approximation(0) - uniform_approximation(0)), mpfr_float("1e-10"));
+}
+
+
+/**
+Two paths go to the double root at 0, with cycle number 2, and one to 1.  All are sampled together, and should converge in the bundle or when split out.
+*/
+BOOST_AUTO_TEST_CASE(bundle_endgame_agrees_with_solutions)
+{
+	DefaultPrecision(16);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction((pow(x,2) - t)*(x - 1));
+	sys.AddPathVariable(t);
+
+	auto tracker = AMPTracker(sys);
+	config::Stepping<mpfr_float> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(config::Predictor::HeunEuler,
+	              	mpfr_float("1e-6"), mpfr_float("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
+
+	BundleTracker bundle(sys);
+	bundle.Setup(1e-6, config::Stepping<double>(), config::Newton());
+
+	TestedEGType scalar(tracker);
+
+	std::vector<Vec<mpfr> > start_points(3, Vec<mpfr>(1));
+	start_points[0] << sqrt(mpfr("0.1"));
+	start_points[1] << -sqrt(mpfr("0.1"));
+	start_points[2] << mpfr(1);
+
+	std::vector<Vec<mpfr> > results;
+	auto codes = RunBundleEndgame(bundle, scalar, results, mpfr("0.1"), start_points);
+
+	BOOST_CHECK_EQUAL(codes.size(), 3);
+	for (auto code : codes)
+		BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_SMALL(abs(results[0](0)), mpfr_float("1e-10"));
+	BOOST_CHECK_SMALL(abs(results[1](0)), mpfr_float("1e-10"));
+	BOOST_CHECK_SMALL(abs(results[2](0) - mpfr(1)), mpfr_float("1e-10"));
+}
 BOOST_AUTO_TEST_SUITE_END()
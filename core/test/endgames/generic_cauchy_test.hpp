@@ -1204,6 +1204,169 @@ BOOST_AUTO_TEST_CASE(full_test_cycle_num_greater_than_1)
 }// end full_test_cycle_num_greater_than_1
 
 
+/*
+	The same, tracking the arcs of each loop after the first on three threads, from starts predicted by the previous loop.
+*/
+BOOST_AUTO_TEST_CASE(full_test_cycle_num_greater_than_1_concurrent_arcs)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t"); 
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	config::Stepping<BRT> stepping_preferences;
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	auto time = ComplexFromString("0.1");
+
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01");
+
+	Vec<BCT> x_origin(1); 
+	x_origin << BCT(1,0);
+
+	config::Cauchy<BRT> cauchy_settings;
+	cauchy_settings.num_circle_threads = 3;
+	TestedEGType my_endgame(tracker, cauchy_settings);
+
+	auto cauchy_endgame_success = my_endgame.Run(time,sample);
+
+	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).norm() < my_endgame.Tolerances().newton_during_endgame);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+}
+
+
+/*
+	The same, correcting the means of the loops with the derivatives at the samples, from 6 sample points per loop, adapting down toward 3.
+*/
+BOOST_AUTO_TEST_CASE(full_test_cycle_num_greater_than_1_hermite_quadrature)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+
+	config::Stepping<BRT> stepping_preferences;
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_preferences,
+                newton_preferences);
+
+	tracker.PrecisionSetup(precision_config);
+
+	auto time = ComplexFromString("0.1");
+
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01");
+
+	Vec<BCT> x_origin(1);
+	x_origin << BCT(1,0);
+
+	config::Cauchy<BRT> cauchy_settings;
+	cauchy_settings.hermite_quadrature = true;
+	config::Endgame<BRT> endgame_settings;
+	endgame_settings.num_sample_points = 6;
+	TestedEGType my_endgame(tracker, cauchy_settings, endgame_settings);
+
+	BOOST_CHECK_EQUAL(my_endgame.NumCirclePoints(), 6);
+
+	auto cauchy_endgame_success = my_endgame.Run(time,sample);
+
+	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).norm() < my_endgame.Tolerances().newton_during_endgame);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK(my_endgame.NumCirclePoints() >= 3);
+	BOOST_CHECK(my_endgame.NumCirclePoints() <= 6);
+}
+
+
+
+/**
+The path to the triple root of x^3 = t has cycle number 3, so the hybrid endgame should hand it from the power series endgame to the Cauchy endgame.  The path to the simple root of x = 1 + t should stay with the power series endgame.
+*/
+BOOST_AUTO_TEST_CASE(hybrid_hands_off_high_cycle_number_only)
+{
+	DefaultPrecision(ambient_precision);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddFunction( (pow(x,3) - t)*(x - 1 - t) );
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	config::Stepping<BRT> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_preferences,
+                newton_preferences);
+	tracker.PrecisionSetup(precision_config);
+
+	EndgameSelector<TrackerType>::Hybrid my_endgame(tracker);
+
+	auto time = ComplexFromString("0.1");
+	Vec<BCT> triple(1), simple(1);
+	triple << pow(ComplexFromString("0.1"), BRT(1)/BRT(3));
+	simple << ComplexFromString("1.1");
+
+	BOOST_CHECK(my_endgame.Run(time,triple)==SuccessCode::Success);
+	BOOST_CHECK(my_endgame.HandedOff());
+	BOOST_CHECK(my_endgame.Stats().handed_off);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 3);
+	BOOST_CHECK(my_endgame.FinalApproximation<BCT>().norm() < my_endgame.Cauchy().Tolerances().newton_during_endgame);
+
+	BOOST_CHECK(my_endgame.Run(time,simple)==SuccessCode::Success);
+	BOOST_CHECK(!my_endgame.HandedOff());
+	BOOST_CHECK(!my_endgame.Stats().handed_off);
+	BOOST_CHECK(abs(my_endgame.FinalApproximation<BCT>()(0) - BCT(1)) < my_endgame.PowerSeries().Tolerances().newton_during_endgame);
+}
+
+
 
 
 
@@ -224,6 +224,81 @@ BOOST_AUTO_TEST_CASE(hermite_interpolation)
 
 
 
+/**
+The incremental interpolator, with the samples of x^8 + 1 at .1, .05, and .025.  The Hermite interpolant of degree 5 through them is 1 - 119/102400000000 at the origin.
+*/
+BOOST_AUTO_TEST_CASE(hermite_interpolator_exact_on_samples_of_x_to_the_8)
+{
+	DefaultPrecision(ambient_precision);
+
+	HermiteInterpolator<BCT> interp;
+	interp.Reset(3,1);
+
+	Vec<BCT> sample(1), derivative(1);
+	for (auto t_string : {".1", ".05", ".025"})
+	{
+		BCT t = ComplexFromString(t_string);
+		sample << pow(t,8) + BCT(1);
+		derivative << BCT(8)*pow(t,7);
+		interp.Push(t, sample, derivative);
+	}
+	BOOST_CHECK_EQUAL(interp.NumPoints(), 3);
+
+	Vec<BCT> approx;
+	interp.Evaluate(approx, BCT(0), 3);
+	BOOST_CHECK_SMALL(abs(approx(0) - ComplexFromString("0.999999998837890625")), BRT(1e-14));
+}
+
+
+/**
+Pushing samples past the capacity of the interpolator forgets the oldest, and the interpolant of the newest ones, or of the ones before the newest, is that of a fresh interpolator of just them.  Samples of a polynomial of degree 5 are reproduced by three of them.
+*/
+BOOST_AUTO_TEST_CASE(hermite_interpolator_sliding_window)
+{
+	DefaultPrecision(ambient_precision);
+
+	auto p = [](BCT const& t){ return ((((BCT(1,2)*t + BCT(-3))*t + BCT(0,1))*t + BCT(2))*t + BCT(1,-1))*t + BCT(4);};
+	auto dp = [](BCT const& t){ return (((BCT(5,10)*t + BCT(-12))*t + BCT(0,3))*t + BCT(4))*t + BCT(1,-1);};
+
+	unsigned num_points = 3;
+	HermiteInterpolator<BCT> sliding;
+	sliding.Reset(num_points+1, 2);
+
+	TimeCont<BCT> times;
+	SampCont<BCT> samples, derivatives;
+	Vec<BCT> sample(2), derivative(2);
+	BCT t = ComplexFromString("0.5","0.1");
+	BCT target = ComplexFromString("0.01","-0.02");
+	for (unsigned ii = 0; ii < 8; ++ii)
+	{
+		t *= ComplexFromString("0.6");
+		sample << p(t), t*p(t);
+		derivative << dp(t), p(t) + t*dp(t);
+		times.push_back(t); samples.push_back(sample); derivatives.push_back(derivative);
+		sliding.Push(t, sample, derivative);
+
+		if (times.size() < num_points+1)
+			continue;
+
+		BOOST_CHECK_EQUAL(sliding.NumPoints(), num_points+1);
+
+		Vec<BCT> newest, before_newest, fresh_value;
+		sliding.Evaluate(newest, target, num_points);
+		sliding.Evaluate(before_newest, target, num_points, 1);
+
+		HermiteInterpolator<BCT> fresh;
+		fresh.Reset(num_points, 2);
+		for (unsigned jj = times.size()-num_points-1; jj < times.size()-1; ++jj)
+			fresh.Push(times[jj], samples[jj], derivatives[jj]);
+		fresh.Evaluate(fresh_value, target, num_points);
+
+		BOOST_CHECK_SMALL((before_newest - fresh_value).norm(), BRT(1e-12));
+		BOOST_CHECK_SMALL(abs(newest(0) - p(target)), BRT(1e-12));
+	}
+}
+
+
+
 
 
 
@@ -595,7 +670,7 @@ BOOST_AUTO_TEST_CASE(compute_initial_samples)
 	SampCont<BCT> correct_samples;
 
 	TimeCont<BCT> times; 
-	std::deque<Vec<BCT> > samples;
+	SampCont<BCT> samples;
 	BCT time(1);
 	Vec<BCT> sample(1);
 
@@ -640,6 +715,70 @@ BOOST_AUTO_TEST_CASE(compute_initial_samples)
 
 
 
+/**
+The same samples as compute_initial_samples, tracking once to the last of them, the one between refined from the dense output of the steps.
+*/
+BOOST_AUTO_TEST_CASE(compute_initial_samples_dense)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); sys.AddPathVariable(t);
+	sys.AddFunction( pow(x-1,3)*(1-t) + (pow(x,3) + 1)*t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_settings,
+                newton_settings);
+
+	tracker.PrecisionSetup(precision_config);
+
+	SampCont<BCT> correct_samples;
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("5.000000000000001e-01", "9.084258952712920e-17");
+	correct_samples.push_back(sample);
+	sample << ComplexFromString("6.000000000000000e-01", "8.165397611531455e-19");
+	correct_samples.push_back(sample);
+	sample << ComplexFromString("6.772905941598711e-01", "3.869924129415447e-17");
+	correct_samples.push_back(sample);
+
+	BCT current_time = ComplexFromString(".1");
+	Vec<BCT> current_space(1);
+	current_space << ComplexFromString("5.000000000000001e-01", "9.084258952712920e-17");
+
+	config::Endgame<BRT> endgame_settings;
+	endgame_settings.dense_initial_samples = true;
+	config::PowerSeries power_series_settings;
+
+	TestedEGType my_endgame(tracker,endgame_settings,power_series_settings);
+
+	TimeCont<BCT> times;
+	SampCont<BCT> samples;
+	auto tracking_success = my_endgame.ComputeInitialSamples(current_time, current_space, times, samples);
+
+	BOOST_REQUIRE(tracking_success==SuccessCode::Success);
+	BOOST_REQUIRE_EQUAL(samples.size(), correct_samples.size());
+	BOOST_CHECK(abs(times[1] - ComplexFromString(".05")) < 1e-15);
+
+	for(unsigned ii = 0; ii < samples.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(samples[ii].size(),1);
+		BOOST_CHECK((samples[ii] - correct_samples[ii]).norm() < my_endgame.Tolerances().newton_during_endgame);
+	}
+}
+
+
+
 
 
 
@@ -1145,3 +1284,178 @@ BOOST_AUTO_TEST_CASE(parabola)
 }
 
 
+
+
+BOOST_AUTO_TEST_CASE(parabola_endgame_stats)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(ambient_precision);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(pow(x,2) - t);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	auto tracker = TrackerType(sys);
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(TestedPredictor,
+	              	RealFromString("1e-6"), RealFromString("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(precision_config);
+
+	Vec<BCT> eg_boundary_point(1);
+	eg_boundary_point << sqrt(ComplexFromString("0.1"));
+
+	TestedEGType my_endgame(tracker);
+
+	BOOST_CHECK_EQUAL(my_endgame.Stats().num_samples, 0);
+
+	auto endgame_success = my_endgame.Run(ComplexFromString("0.1"),eg_boundary_point);
+	BOOST_CHECK(endgame_success==SuccessCode::Success);
+
+	auto stats = my_endgame.Stats();
+	BOOST_CHECK(stats.num_samples >= my_endgame.EndgameSettings().num_sample_points);
+	BOOST_CHECK(stats.num_approximations >= 2);
+	BOOST_CHECK(stats.num_hermite_interpolations >= stats.num_approximations);
+	BOOST_CHECK(stats.num_cycle_number_trials >= 1);
+	BOOST_CHECK(stats.peak_precision >= Precision(eg_boundary_point));
+}
+
+
+/**
+Keeping the previous cycle number when it clearly predicts best finds the same cycle number and root as trying every candidate each time, with fewer candidates tried.
+*/
+BOOST_AUTO_TEST_CASE(parabola_seeded_cycle_number_search)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(ambient_precision);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(pow(x,2) - t);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	auto tracker = TrackerType(sys);
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(TestedPredictor,
+	              	RealFromString("1e-6"), RealFromString("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(precision_config);
+
+	Vec<BCT> eg_boundary_point(1);
+	eg_boundary_point << sqrt(ComplexFromString("0.1"));
+
+	config::PowerSeries exhaustive_settings;
+	exhaustive_settings.cycle_number_seed_margin = 0;
+	TestedEGType exhaustive(tracker, exhaustive_settings);
+	TestedEGType seeded(tracker);
+
+	BOOST_CHECK(exhaustive.Run(ComplexFromString("0.1"),eg_boundary_point)==SuccessCode::Success);
+	BOOST_CHECK(seeded.Run(ComplexFromString("0.1"),eg_boundary_point)==SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(seeded.CycleNumber(), exhaustive.CycleNumber());
+	BOOST_CHECK_SMALL(abs(seeded.FinalApproximation<BCT>()(0)), BRT(1e-10));
+	BOOST_CHECK(seeded.Stats().num_cycle_number_trials <= exhaustive.Stats().num_cycle_number_trials);
+}
+
+
+/**
+Only the samples interpolated are kept, so that the storage of the dropped ones is reused for the new ones.
+*/
+BOOST_AUTO_TEST_CASE(parabola_keeps_window_of_samples)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(ambient_precision);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(pow(x,2) - t);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	auto tracker = TrackerType(sys);
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(TestedPredictor,
+	              	RealFromString("1e-6"), RealFromString("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(precision_config);
+
+	Vec<BCT> eg_boundary_point(1);
+	eg_boundary_point << sqrt(ComplexFromString("0.1"));
+
+	TestedEGType my_endgame(tracker);
+	BOOST_CHECK(my_endgame.Run(ComplexFromString("0.1"),eg_boundary_point)==SuccessCode::Success);
+
+	auto num_kept = std::max<std::size_t>(my_endgame.EndgameSettings().num_sample_points+1, 3);
+	auto samples = my_endgame.GetSamples<BCT>();
+	auto times = my_endgame.GetTimes<BCT>();
+	BOOST_CHECK(samples.size() <= num_kept);
+	BOOST_CHECK_EQUAL(times.size(), samples.size());
+	BOOST_CHECK(samples.capacity() <= 2*num_kept);
+	BOOST_CHECK_SMALL(abs(my_endgame.FinalApproximation<BCT>()(0)), BRT(1e-10));
+}
+
+
+/**
+x = 1/t goes to infinity at the origin.  The approximations double each time t is halved, so the endgame stops after a few iterations, rather than following the path until its norm reaches the path truncation threshold.
+*/
+BOOST_AUTO_TEST_CASE(hyperbola_stops_early_going_to_infinity)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(ambient_precision);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(x*t - 1);
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	auto tracker = TrackerType(sys);
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(TestedPredictor,
+	              	RealFromString("1e-6"), RealFromString("1e5"),
+					stepping_settings, newton_settings);
+	tracker.PrecisionSetup(precision_config);
+
+	Vec<BCT> eg_boundary_point(1);
+	eg_boundary_point << BCT(10);
+
+	TestedEGType early(tracker);
+	auto early_code = early.Run(ComplexFromString("0.1"),eg_boundary_point);
+	BOOST_CHECK(early_code==SuccessCode::GoingToInfinity);
+	BOOST_CHECK(early.Stats().early_abort==EarlyAbort::Diverging);
+
+	config::Security<BRT> no_early_abort;
+	no_early_abort.early_abort_window = 0;
+	TestedEGType late(tracker, no_early_abort);
+	auto late_code = late.Run(ComplexFromString("0.1"),eg_boundary_point);
+	BOOST_CHECK(late_code!=SuccessCode::Success);
+	BOOST_CHECK(late.Stats().early_abort==EarlyAbort::None);
+	BOOST_CHECK(early.Stats().num_samples < late.Stats().num_samples);
+}
@@ -116,6 +116,80 @@ BOOST_AUTO_TEST_CASE(add_ptr_sys_to_pool)
 	BOOST_CHECK(result.get() == sys.get());
 }
 
+
+BOOST_AUTO_TEST_CASE(replicas_evaluate_like_prototype_with_own_nodes)
+{
+	System sys("function f; variable_group x, y; f = x^2*y - 3;");
+	SystemPool sp(sys, 2);
+	BOOST_CHECK_EQUAL(sp.NumReplicas(), 2);
+	BOOST_CHECK(sp.CloneSeconds() >= 0);
+	BOOST_CHECK(sp.MemoryUsage().Total() > 0);
+
+	auto r0 = sp.Replica(0);
+	auto r1 = sp.Replica(1);
+	BOOST_CHECK(r0 != r1);
+	BOOST_CHECK(r0->Function(0) != sys.Function(0));
+	BOOST_CHECK(r0->Function(0) != r1->Function(0));
+
+	Vec<dbl> x(2);
+	x << dbl(2,1), dbl(-1,0.5);
+	BOOST_CHECK(abs(r1->Eval(x)(0) - sys.Eval(x)(0)) < 1e-14);
+
+	sp.precision(30);
+	BOOST_CHECK_EQUAL(r0->precision(), 30);
+	BOOST_CHECK_EQUAL(sp.Prototype().precision(), 30);
+	sp.precision(DefaultPrecision());
+}
+
+
+BOOST_AUTO_TEST_CASE(thread_replicas_have_affinity)
+{
+	System sys("function f; variable_group x; f = x - 1;");
+	SystemPool sp(sys, 1);
+
+	auto mine = sp.ThreadReplica();
+	BOOST_CHECK(sp.ThreadReplica() == mine);
+
+	std::shared_ptr<System> theirs;
+	std::thread other([&]{ theirs = sp.ThreadReplica(); });
+	other.join();
+
+	BOOST_CHECK(theirs != mine);
+	BOOST_CHECK_EQUAL(sp.NumReplicas(), 2);
+	BOOST_CHECK(sp.ThreadReplica() == mine);
+}
+
+
+BOOST_AUTO_TEST_CASE(replicas_given_back_are_reused)
+{
+	System sys("function f; variable_group x; f = x - 1;");
+	SystemPool sp(sys, 1);
+
+	auto a = sp.Acquire();
+	auto b = sp.Acquire();
+	BOOST_CHECK(a != b);
+	BOOST_CHECK_EQUAL(sp.NumReplicas(), 2);
+	BOOST_CHECK_EQUAL(sp.NumHeld(), 2);
+
+	sp.Release(a);
+	BOOST_CHECK_EQUAL(sp.NumHeld(), 1);
+	BOOST_CHECK(sp.Acquire() == a);
+	BOOST_CHECK_EQUAL(sp.NumReplicas(), 2);
+
+	BOOST_CHECK_THROW(sp.Release(std::make_shared<System>(sys)), std::invalid_argument);
+
+	// threads which give theirs back before ending do not grow the pool
+	sp.Release(a);
+	sp.Release(b);
+	for (int ii = 0; ii < 5; ++ii)
+	{
+		std::thread t([&]{ sp.ThreadReplica(); sp.ReleaseThreadReplica(); });
+		t.join();
+	}
+	BOOST_CHECK_EQUAL(sp.NumReplicas(), 2);
+	BOOST_CHECK_EQUAL(sp.NumHeld(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -132,6 +206,75 @@ BOOST_AUTO_TEST_CASE(make_double_point_point)
 {
 	PointPool<dbl> pool;
 }
+
+
+BOOST_AUTO_TEST_CASE(purge_cache_drops_objects_held_only_by_pool)
+{
+	SystemPool sp;
+	auto kept = sp.NewObj();
+	sp.NewObj();
+	BOOST_CHECK_EQUAL(sp.Size(), 2);
+
+	sp.PurgeCache();
+	BOOST_CHECK_EQUAL(sp.Size(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(handles_return_points_for_reuse)
+{
+	PointPool<dbl> pool;
+	const dbl* data;
+	{
+		auto x = pool.Acquire(3, DoublePrecision());
+		BOOST_CHECK_EQUAL(x->size(), 3);
+		data = x->data();
+	}
+	BOOST_CHECK_EQUAL(pool.NumFree(), 1);
+
+	auto y = pool.Acquire(3, DoublePrecision());
+	BOOST_CHECK_EQUAL(y->data(), data);
+	BOOST_CHECK_EQUAL(pool.NumReused(), 1);
+	BOOST_CHECK_EQUAL(pool.NumFree(), 0);
+
+	auto z = pool.Acquire(4, DoublePrecision());
+	BOOST_CHECK_EQUAL(pool.NumMade(), 2);
+
+	auto kept = z.Release();
+	BOOST_CHECK_EQUAL(kept.size(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
+
+BOOST_AUTO_TEST_SUITE(multiple_point_pool)
+
+using namespace bertini;
+
+BOOST_AUTO_TEST_CASE(points_are_recycled_by_precision)
+{
+	PointPool<mpfr> pool;
+	{
+		auto x = pool.Acquire(2, 50);
+		BOOST_CHECK_EQUAL(Precision((*x)(0)), 50);
+		auto y = pool.Acquire(2, 100);
+		BOOST_CHECK_EQUAL(Precision((*y)(1)), 100);
+	}
+	BOOST_CHECK_EQUAL(pool.NumFree(), 2);
+
+	auto z = pool.Acquire(2, 100);
+	BOOST_CHECK_EQUAL(Precision((*z)(0)), 100);
+	BOOST_CHECK_EQUAL(pool.NumReused(), 1);
+
+	auto w = pool.Acquire(2, 70);
+	BOOST_CHECK_EQUAL(pool.NumMade(), 3);
+	BOOST_CHECK_EQUAL(pool.NumFree(), 1);
+
+	pool.Clear();
+	BOOST_CHECK_EQUAL(pool.NumFree(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
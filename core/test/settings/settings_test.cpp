@@ -38,6 +38,7 @@
 
 #include "bertini2/bertini.hpp"
 #include "bertini2/settings/configIni_parse.hpp"
+#include "bertini2/settings/classic_settings.hpp"
 
 #include <boost/spirit/include/qi.hpp>
 #include <boost/test/unit_test.hpp>
@@ -162,5 +163,48 @@ BOOST_AUTO_TEST_CASE(full_config_to_vm)
 }
 
 
+BOOST_AUTO_TEST_CASE(parse_classic_config_one_pass)
+{
+    std::string config = "CONFIG\n MPType: 1; %comment about setting\n %TrackTolBeforeEG: 1e-3;\n Precision:128 \n ODEPredictor : -1;\n TRACKTOLBEFOREEG: 1e-7; MaxStepSize: 0.05;\n MaxNewtonIts: 3;\n SecurityMaxNorm: 1e6;\n UnusedSetting: 4;\nEND;";
+
+    auto s = bertini::settings::ParseClassicConfig(config);
+
+    BOOST_CHECK_EQUAL(s.MPType(), 1);
+    BOOST_CHECK_EQUAL(s.Precision(), 128);
+    BOOST_CHECK_EQUAL(s.PrecisionDigits(), 39);
+    BOOST_CHECK(s.PredictorSetting()==bertini::tracking::config::Predictor::Constant);
+    BOOST_CHECK_EQUAL(s.EndgameNum(), 1);
+
+    auto stepping = s.StepSettings<double>();
+    BOOST_CHECK_EQUAL(stepping.max_step_size, 0.05);
+    BOOST_CHECK_EQUAL(stepping.max_num_steps, 10000);
+
+    BOOST_CHECK_EQUAL(s.NewtonSettings().max_num_newton_iterations, 3);
+
+    auto tolerances = s.ToleranceSettings<double>();
+    BOOST_CHECK_EQUAL(tolerances.newton_before_endgame, 1e-7);
+    BOOST_CHECK_EQUAL(tolerances.newton_during_endgame, 1e-6);
+    BOOST_CHECK_EQUAL(tolerances.path_truncation_threshold, 1e6);
+}
+
+
+BOOST_AUTO_TEST_CASE(classic_settings_checked_as_set)
+{
+    using bertini::settings::ClassicSettingsBuilder;
+    using bertini::settings::ParseClassicConfig;
+
+    BOOST_CHECK_THROW(ClassicSettingsBuilder().Predictor(9), std::invalid_argument);
+    BOOST_CHECK_THROW(ClassicSettingsBuilder().FinalTol(0), std::invalid_argument);
+    BOOST_CHECK_THROW(ParseClassicConfig("mptype: 3;"), std::invalid_argument);
+    BOOST_CHECK_THROW(ParseClassicConfig("finaltol: 1e-11x;"), std::invalid_argument);
+    BOOST_CHECK_THROW(ParseClassicConfig("maxnumbersteps: -5;"), std::invalid_argument);
+
+    auto s = ClassicSettingsBuilder().MPType(0).EndgameNum(2).Build();
+    BOOST_CHECK_EQUAL(s.MPType(), 0);
+    BOOST_CHECK_EQUAL(s.EndgameNum(), 2);
+    BOOST_CHECK_EQUAL(s.TrackTolDuringEG(), 1e-6);
+}
+
+
 
 BOOST_AUTO_TEST_SUITE_END()
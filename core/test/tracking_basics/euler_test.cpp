@@ -132,6 +132,66 @@ BOOST_AUTO_TEST_CASE(circle_line_euler_double)
 	}
 	
 	
+	BOOST_AUTO_TEST_CASE(circle_line_euler_double_retry_reuses_cached_jacobian)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+		dbl current_time(0.9);
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		Vec<dbl> predicted(2);
+		predicted << dbl(2.40310963516214640018253210912048,0.187706567388887830930493342816564),
+		dbl(0.370984337833979085688209698697074, 1.30889906180158745272421523674049);
+		
+		double norm_J, norm_J_inverse, size_proportion;
+		double tracking_tolerance(1e-5);
+		double condition_number_estimate;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+		unsigned frequency_of_CN_estimation = 1;
+		
+		auto cache = std::make_shared<bertini::tracking::JacobianCache>();
+		ExplicitRKPredictor predictor(sys);
+		predictor.SetJacobianCache(cache);
+		
+		Vec<dbl> euler_prediction_result;
+		
+		// a first, too long, step, which stores the factorization at the current point
+		predictor.Predict(euler_prediction_result, size_proportion, norm_J, norm_J_inverse, sys,
+		                  current_space, current_time, dbl(-0.2),
+		                  condition_number_estimate, num_steps_since_last_condition_number_computation,
+		                  frequency_of_CN_estimation, tracking_tolerance, AMP);
+		
+		BOOST_CHECK(cache->Matches(current_space, current_time));
+		BOOST_CHECK(!cache->Matches(current_space, dbl(0.8)));
+		
+		// the retry from the same point must agree with a fresh prediction
+		auto success_code = predictor.Predict(euler_prediction_result, size_proportion, norm_J, norm_J_inverse, sys,
+		                                      current_space, current_time, dbl(-0.1),
+		                                      condition_number_estimate, num_steps_since_last_condition_number_computation,
+		                                      frequency_of_CN_estimation, tracking_tolerance, AMP);
+		
+		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(euler_prediction_result.size(),2);
+		for (unsigned ii = 0; ii < euler_prediction_result.size(); ++ii)
+			BOOST_CHECK(abs(euler_prediction_result(ii)-predicted(ii)) < threshold_clearance_d);
+		
+		cache->Invalidate();
+		BOOST_CHECK(!cache->Matches(current_space, current_time));
+	}
+	
+	
 	BOOST_AUTO_TEST_CASE(circle_line_euler_mp)
 	{
 		bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
@@ -825,6 +885,74 @@ BOOST_AUTO_TEST_CASE(circle_line_euler_double)
 		}
 		
 	}
+	
+	
+	BOOST_AUTO_TEST_CASE(circle_line_euler_change_precision_and_back)
+	{
+		bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+		mpfr delta_t("-0.1");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		mpfr_float norm_J, norm_J_inverse, size_proportion;
+		mpfr_float tracking_tolerance("1e-5");
+		mpfr_float condition_number_estimate;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+		unsigned frequency_of_CN_estimation = 1;
+		
+		ExplicitRKPredictor predictor(sys);
+		
+		auto predict = [&](Vec<mpfr> & result)
+		{
+			return predictor.Predict(result, size_proportion, norm_J, norm_J_inverse,
+			                         sys, current_space, current_time, delta_t,
+			                         condition_number_estimate, num_steps_since_last_condition_number_computation,
+			                         frequency_of_CN_estimation, tracking_tolerance, AMP);
+		};
+		
+		auto set_precision = [&](unsigned p)
+		{
+			bertini::DefaultPrecision(p);
+			Precision(current_space,p);
+			current_time.precision(p);
+			delta_t.precision(p);
+			sys.precision(p);
+			predictor.ChangePrecision(p);
+		};
+		
+		Vec<mpfr> first;
+		BOOST_CHECK(predict(first)==bertini::tracking::SuccessCode::Success);
+		
+		// the state at the original precision is kept while at 50, and swapped back in after
+		set_precision(50);
+		Vec<mpfr> at_50;
+		BOOST_CHECK(predict(at_50)==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(Precision(at_50(0)), 50);
+		
+		set_precision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> second;
+		BOOST_CHECK(predict(second)==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(Precision(second(0)), TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		
+		for (unsigned ii = 0; ii < second.size(); ++ii)
+			BOOST_CHECK(abs(second(ii)-first(ii)) < threshold_clearance_mp);
+	}
 
 BOOST_AUTO_TEST_SUITE_END()
 
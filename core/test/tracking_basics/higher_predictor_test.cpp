@@ -1286,6 +1286,77 @@ BOOST_AUTO_TEST_CASE(circle_line_RKDP56_double)
 
 
 
+BOOST_AUTO_TEST_CASE(circle_line_RKDP56_double_reuses_endpoint_stage)
+{
+	Vec<dbl> current_space(2);
+	current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+	dbl current_time(0.9);
+	dbl delta_t(-0.1);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+	VariableGroup vars{x,y};
+
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+	sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	AMP.coefficient_bound = 5;
+
+	double norm_J, norm_J_inverse, size_proportion, error_est;
+	double tracking_tolerance(1e-5);
+	double condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::RKDormandPrince56,sys);
+	ExplicitRKPredictor fresh(bertini::tracking::config::Predictor::RKDormandPrince56,sys);
+
+	Vec<dbl> first_step, second_step, fresh_step;
+	auto success_code = predictor.Predict(first_step, error_est, size_proportion, norm_J, norm_J_inverse,
+	                                      sys, current_space, current_time, delta_t,
+	                                      condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                                      frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumJacobianEvaluations(), 8);
+	BOOST_CHECK_EQUAL(predictor.NumReusedEndpointStages(), 0);
+
+	// the next step starts from the prediction, which is within the tracking tolerance of the last stage
+	dbl next_time = current_time + delta_t;
+	success_code = predictor.Predict(second_step, error_est, size_proportion, norm_J, norm_J_inverse,
+	                                 sys, first_step, next_time, delta_t,
+	                                 condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                                 frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumJacobianEvaluations(), 15);
+	BOOST_CHECK_EQUAL(predictor.NumFactorizations(), 15);
+	BOOST_CHECK_EQUAL(predictor.NumReusedEndpointStages(), 1);
+
+	success_code = fresh.Predict(fresh_step, error_est, size_proportion, norm_J, norm_J_inverse,
+	                             sys, first_step, next_time, delta_t,
+	                             condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                             frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK((second_step - fresh_step).norm() < tracking_tolerance);
+
+	// after forgetting it, or from elsewhere, the first stage is evaluated
+	predictor.ForgetEndpointStage();
+	success_code = predictor.Predict(second_step, error_est, size_proportion, norm_J, norm_J_inverse,
+	                                 sys, first_step, next_time, delta_t,
+	                                 condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                                 frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK_EQUAL(predictor.NumJacobianEvaluations(), 23);
+	BOOST_CHECK_EQUAL(predictor.NumReusedEndpointStages(), 1);
+}
+
+
+
+
+
 BOOST_AUTO_TEST_CASE(circle_line_RKDP56_mp)
 {
 	bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
@@ -1992,6 +2063,62 @@ BOOST_AUTO_TEST_CASE(monodromy_RKV67_mp)
 }
 
 
+////////////////////////
+//
+//	Pade
+//
+////////////////////////
+
+BOOST_AUTO_TEST_CASE(square_root_Pade_double_predicts_and_refuses_steps_past_its_trust_region)
+{
+	// x = sqrt(t+1), with a branch point at t = -1
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+
+	VariableGroup vars{x};
+
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+	sys.AddFunction( pow(x,2) - t - 1 );
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	Vec<dbl> current_space(1);
+	current_space << dbl(sqrt(2.0));
+	dbl current_time(1);
+
+	double norm_J, norm_J_inverse, size_proportion, error_est;
+	double tracking_tolerance(1e-5);
+	double condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Pade, sys);
+	BOOST_CHECK_EQUAL(predictor.Order(), 3);
+
+	Vec<dbl> prediction;
+	dbl delta_t(-0.25);
+	auto success_code = predictor.Predict(prediction, error_est, size_proportion, norm_J, norm_J_inverse,
+	                                      sys, current_space, current_time, delta_t,
+	                                      condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                                      frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK(abs(prediction(0) - sqrt(1.75)) < 1e-5);
+	BOOST_CHECK(error_est > 0 && error_est < 1e-4);
+	BOOST_CHECK_EQUAL(predictor.NumJacobianEvaluations(), 1);
+
+	// the coefficients put the branch point at distance 4, and the predictor trusts a quarter of that
+	BOOST_CHECK_CLOSE(predictor.SafeStepSize(), 1, 1e-6);
+
+	delta_t = dbl(-1.5);
+	success_code = predictor.Predict(prediction, error_est, size_proportion, norm_J, norm_J_inverse,
+	                                 sys, current_space, current_time, delta_t,
+	                                 condition_number_estimate, num_steps_since_last_condition_number_computation,
+	                                 frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::ReduceStepSize);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -30,6 +30,7 @@
 #include "limbo.hpp"
 #include "mpfr_complex.hpp"
 #include "tracking/newton_corrector.hpp"
+#include "tracking/ode_predictors.hpp"
 
 
 using System = bertini::System;
@@ -39,6 +40,7 @@ using Var = std::shared_ptr<Variable>;
 
 using VariableGroup = bertini::VariableGroup;
 using NewtonCorrector = bertini::tracking::correct::NewtonCorrector;
+using ExplicitRKPredictor = bertini::tracking::predict::ExplicitRKPredictor;
 
 
 
@@ -780,6 +782,675 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::FailedToConverge);
 	}
 
+	BOOST_AUTO_TEST_CASE(circle_line_chord_newton_matches_full_newton_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		bertini::mpfr_float tracking_tolerance("1e-10");
+		unsigned max_num_newton_iterations = 30;
+		unsigned min_num_newton_iterations = 1;
+		
+		Vec<mpfr> full_result;
+		std::shared_ptr<NewtonCorrector> corrector = std::make_shared<NewtonCorrector>(sys);
+		auto full_code = corrector->Correct(full_result,
+											   sys,
+											   current_space,
+											   current_time,
+											   tracking_tolerance,
+											   min_num_newton_iterations,
+											   max_num_newton_iterations,
+											   AMP);
+		
+		bertini::tracking::config::Newton chord_settings;
+		chord_settings.use_chord = true;
+		corrector->Settings(chord_settings);
+		
+		Vec<mpfr> chord_result;
+		auto chord_code = corrector->Correct(chord_result,
+												sys,
+												current_space,
+												current_time,
+												tracking_tolerance,
+												min_num_newton_iterations,
+												max_num_newton_iterations,
+												AMP);
+		
+		BOOST_CHECK(full_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(chord_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK((chord_result-full_result).norm() < mpfr_float("1e-9"));
+	}
+	
+	
+	BOOST_AUTO_TEST_CASE(circle_line_contraction_control_stops_an_iteration_early_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		bertini::mpfr_float tracking_tolerance("1e-10");
+		unsigned max_num_newton_iterations = 30;
+		unsigned min_num_newton_iterations = 1;
+		
+		Vec<mpfr> full_result;
+		std::shared_ptr<NewtonCorrector> corrector = std::make_shared<NewtonCorrector>(sys);
+		auto full_code = corrector->Correct(full_result,
+											   sys,
+											   current_space,
+											   current_time,
+											   tracking_tolerance,
+											   min_num_newton_iterations,
+											   max_num_newton_iterations,
+											   AMP);
+		auto full_iterations = corrector->NumIterations();
+		
+		bertini::tracking::config::Newton contraction_settings;
+		contraction_settings.contraction_control = true;
+		corrector->Settings(contraction_settings);
+		
+		Vec<mpfr> contraction_result;
+		auto contraction_code = corrector->Correct(contraction_result,
+												sys,
+												current_space,
+												current_time,
+												tracking_tolerance,
+												min_num_newton_iterations,
+												max_num_newton_iterations,
+												AMP);
+		auto contraction_iterations = corrector->NumIterations() - full_iterations;
+		
+		BOOST_CHECK(full_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(contraction_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(contraction_iterations < full_iterations);
+		BOOST_CHECK((contraction_result-full_result).norm() < mpfr_float("1e-9"));
+	}
+	
+	
+	BOOST_AUTO_TEST_CASE(newton_step_contraction_control_gives_up_hopeless_correction_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		// the Griewank Osborne example, diverging away from t = 0, as in newton_step_diverging_to_infinity_fails_to_converge_mp
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("256185069753.408853236449242927412","-387520022558.051912233172374487976"),
+		mpfr("-0.0212298348984663761753389403711889","-0.177814646531698303094367623155171");
+		
+		mpfr current_time(".1");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction(mpq_rational(29,16)*pow(x,3) - 2*x*y + t);
+		sys.AddFunction(y - pow(x,2));
+		
+		mpfr_float tracking_tolerance("1e1");
+		
+		unsigned max_num_newton_iterations = 5;
+		unsigned min_num_newton_iterations = 1;
+		
+		bertini::tracking::config::Newton contraction_settings;
+		contraction_settings.contraction_control = true;
+		
+		Vec<mpfr> newton_correction_result;
+		std::shared_ptr<NewtonCorrector> corrector = std::make_shared<NewtonCorrector>(sys);
+		corrector->Settings(contraction_settings);
+		auto success_code = corrector->Correct(newton_correction_result,
+												  sys,
+												  current_space,
+												  current_time,
+												  tracking_tolerance,
+												  min_num_newton_iterations,
+												  max_num_newton_iterations);
+		
+		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::FailedToConverge);
+		BOOST_CHECK_EQUAL(corrector->NumIterations(), 1);
+	}
+	
+	
+	BOOST_AUTO_TEST_CASE(circle_line_two_corrector_steps_mixed_precision_solve_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		// the same as circle_line_two_corrector_steps_mp.  refinement must recover the full precision result from a double factorization.
+		Vec<mpfr> corrected(2);
+		corrected << mpfr("1.14542104415948767661671388923986", "0.0217584797792294631577151109622764"),
+		mpfr("0.47922556512007318905475515868002", "-0.00310835425417563759395930156603948");
+		
+		bertini::mpfr_float tracking_tolerance("1e1");
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+		
+		bertini::tracking::config::Newton mixed_settings;
+		mixed_settings.mixed_precision_solve = true;
+		
+		std::shared_ptr<NewtonCorrector> corrector = std::make_shared<NewtonCorrector>(sys);
+		corrector->Settings(mixed_settings);
+		
+		Vec<mpfr> newton_correction_result;
+		auto success_code = corrector->Correct(newton_correction_result,
+												  sys,
+												  current_space,
+												  current_time,
+												  tracking_tolerance,
+												  min_num_newton_iterations,
+												  max_num_newton_iterations,
+												  AMP);
+		
+		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(newton_correction_result.size(),2);
+		for (unsigned ii = 0; ii < newton_correction_result.size(); ++ii)
+			BOOST_CHECK(abs(newton_correction_result(ii)-corrected(ii)) < threshold_clearance_mp);
+	}
+	
+	BOOST_AUTO_TEST_CASE(circle_line_two_corrector_steps_krylov_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		AMP.norm_J_inverse_estimator = bertini::tracking::config::NormJInverseEstimator::OneNorm;
+		
+		// the same as circle_line_two_corrector_steps_mp.  GMRES preconditioned in double precision must recover the full precision steps.
+		Vec<mpfr> corrected(2);
+		corrected << mpfr("1.14542104415948767661671388923986", "0.0217584797792294631577151109622764"),
+		mpfr("0.47922556512007318905475515868002", "-0.00310835425417563759395930156603948");
+		
+		bertini::mpfr_float tracking_tolerance("1e1");
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+		
+		bertini::tracking::config::Newton krylov_settings;
+		krylov_settings.use_krylov = true;
+		
+		NewtonCorrector corrector(sys);
+		corrector.Settings(krylov_settings);
+		
+		Vec<mpfr> newton_correction_result;
+		mpfr_float norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate;
+		auto success_code = corrector.Correct(newton_correction_result,
+		                                      norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                      sys,
+		                                      current_space,
+		                                      current_time,
+		                                      tracking_tolerance,
+		                                      min_num_newton_iterations,
+		                                      max_num_newton_iterations,
+		                                      AMP);
+		
+		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(newton_correction_result.size(),2);
+		for (unsigned ii = 0; ii < newton_correction_result.size(); ++ii)
+			BOOST_CHECK(abs(newton_correction_result(ii)-corrected(ii)) < threshold_clearance_mp);
+		
+		// the estimate of the norm of the inverse from the Krylov process is near that from the dense factorization
+		NewtonCorrector dense_corrector(sys);
+		Vec<mpfr> dense_result;
+		mpfr_float dense_norm_delta_z, dense_norm_J, dense_norm_J_inverse, dense_condition_number_estimate;
+		dense_corrector.Correct(dense_result,
+		                        dense_norm_delta_z, dense_norm_J, dense_norm_J_inverse, dense_condition_number_estimate,
+		                        sys, current_space, current_time, tracking_tolerance,
+		                        min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(norm_J_inverse > dense_norm_J_inverse/10);
+		BOOST_CHECK(norm_J_inverse < dense_norm_J_inverse*10);
+		BOOST_CHECK(abs(norm_J - dense_norm_J) < 1e-10*dense_norm_J);
+	}
+	
+	BOOST_AUTO_TEST_CASE(circle_line_fixed_size_solve_matches_dynamic_d)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+		
+		dbl current_time(0.9);
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		double tracking_tolerance(1e-10);
+		unsigned max_num_newton_iterations = 30;
+		unsigned min_num_newton_iterations = 1;
+		
+		NewtonCorrector corrector(sys);
+		
+		Vec<dbl> fixed_result;
+		auto fixed_code = corrector.Correct(fixed_result, sys, current_space, current_time,
+		                                    tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		bertini::tracking::config::Newton dynamic_settings;
+		dynamic_settings.fixed_size_solve = false;
+		corrector.Settings(dynamic_settings);
+		
+		Vec<dbl> dynamic_result;
+		auto dynamic_code = corrector.Correct(dynamic_result, sys, current_space, current_time,
+		                                      tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(fixed_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(dynamic_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK((fixed_result-dynamic_result).norm() < threshold_clearance_d);
+	}
+	
+#ifdef BERTINI_ENABLE_LAPACK
+	BOOST_AUTO_TEST_CASE(circle_line_lapack_solve_matches_eigen_d)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+		
+		dbl current_time(0.9);
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		AMP.norm_J_inverse_estimator = bertini::tracking::config::NormJInverseEstimator::OneNorm;
+		
+		double tracking_tolerance(1e-10);
+		unsigned max_num_newton_iterations = 30;
+		unsigned min_num_newton_iterations = 1;
+		
+		// every size to LAPACK, and none to the fixed-size kernels, which take precedence
+		bertini::tracking::config::Newton lapack_settings;
+		lapack_settings.fixed_size_solve = false;
+		lapack_settings.lapack_threshold = 1;
+		
+		NewtonCorrector corrector(sys);
+		corrector.Settings(lapack_settings);
+		
+		Vec<dbl> lapack_result;
+		double norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate;
+		auto lapack_code = corrector.Correct(lapack_result, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                     sys, current_space, current_time,
+		                                     tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		bertini::tracking::config::Newton eigen_settings = lapack_settings;
+		eigen_settings.lapack_threshold = std::numeric_limits<unsigned>::max();
+		corrector.Settings(eigen_settings);
+		
+		Vec<dbl> eigen_result;
+		double eigen_norm_delta_z, eigen_norm_J, eigen_norm_J_inverse, eigen_condition_number_estimate;
+		auto eigen_code = corrector.Correct(eigen_result, eigen_norm_delta_z, eigen_norm_J, eigen_norm_J_inverse, eigen_condition_number_estimate,
+		                                    sys, current_space, current_time,
+		                                    tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(lapack_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(eigen_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK((lapack_result-eigen_result).norm() < threshold_clearance_d);
+		BOOST_CHECK(std::abs(norm_J_inverse - eigen_norm_J_inverse) < threshold_clearance_d*eigen_norm_J_inverse);
+	}
+#endif
+	
+	BOOST_AUTO_TEST_CASE(multiprecision_lu_matches_eigen_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		using bertini::tracking::MultiprecisionLU;
+		
+		// more than two blocks, so the panels, the rows of U beside them, and the tiles of the trailing matrix are all exercised
+		const int n = 2*MultiprecisionLU::BlockSize + 3;
+		Mat<mpfr> A(n,n);
+		for (int ii = 0; ii < n; ++ii)
+			for (int jj = 0; jj < n; ++jj)
+				A(ii,jj) = bertini::RandomUnit<mpfr>();
+		Vec<mpfr> b = bertini::RandomOfUnits<mpfr>(n);
+		
+		MultiprecisionLU LU;
+		BOOST_CHECK(LU.Compute(A)==bertini::MatrixSuccessCode::Success);
+		BOOST_CHECK_EQUAL(LU.Size(), n);
+		
+		Vec<mpfr> x, y;
+		MultiprecisionLU copy(LU);
+		copy.Solve(x, b);
+		LU.SolveAdjoint(y, b);
+		
+		Vec<mpfr> expected_x = A.lu().solve(b), expected_y = Mat<mpfr>(A.adjoint()).lu().solve(b);
+		BOOST_CHECK((x - expected_x).norm() < threshold_clearance_mp*expected_x.norm());
+		BOOST_CHECK((y - expected_y).norm() < threshold_clearance_mp*expected_y.norm());
+		BOOST_CHECK((A*x - b).norm() < threshold_clearance_mp);
+		
+		Mat<mpfr> singular = Mat<mpfr>::Zero(3,3);
+		singular(0,0) = mpfr(1);
+		BOOST_CHECK(LU.Compute(singular)!=bertini::MatrixSuccessCode::Success);
+	}
+	
+	BOOST_AUTO_TEST_CASE(multiprecision_lu_by_team_matches_serial)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		using bertini::tracking::MultiprecisionLU;
+		
+		MultiprecisionLU serial, team;
+		team.SetThreadTeam(std::make_shared<bertini::detail::ThreadTeam>(3));
+		
+		// the smallest size the team factors, and one with enough tiles that each thread of the team updates several, and some threads none of the last.  the second reuses the buffers of the first.
+		for (int n : {2*MultiprecisionLU::BlockSize, 5*MultiprecisionLU::BlockSize + 7})
+		{
+			Mat<mpfr> A(n,n);
+			for (int ii = 0; ii < n; ++ii)
+				for (int jj = 0; jj < n; ++jj)
+					A(ii,jj) = bertini::RandomUnit<mpfr>();
+			Vec<mpfr> b = bertini::RandomOfUnits<mpfr>(n);
+			
+			BOOST_CHECK(serial.Compute(A)==bertini::MatrixSuccessCode::Success);
+			BOOST_CHECK(team.Compute(A)==bertini::MatrixSuccessCode::Success);
+			
+			// the same operations on each entry in the same order, so the same factors
+			Vec<mpfr> x_serial, x_team, y_serial, y_team;
+			serial.Solve(x_serial, b);
+			team.Solve(x_team, b);
+			serial.SolveAdjoint(y_serial, b);
+			team.SolveAdjoint(y_team, b);
+			BOOST_CHECK_EQUAL((x_team - x_serial).norm(), 0);
+			BOOST_CHECK_EQUAL((y_team - y_serial).norm(), 0);
+			BOOST_CHECK((A*x_team - b).norm() < threshold_clearance_mp);
+		}
+	}
+	
+	BOOST_AUTO_TEST_CASE(circle_line_multiprecision_lu_matches_eigen_corrector_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		AMP.norm_J_inverse_estimator = bertini::tracking::config::NormJInverseEstimator::OneNorm;
+		
+		bertini::mpfr_float tracking_tolerance("1e1");
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+		
+		NewtonCorrector corrector(sys);
+		
+		Vec<mpfr> blocked_result;
+		mpfr_float norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate;
+		auto blocked_code = corrector.Correct(blocked_result,
+		                                      norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                      sys, current_space, current_time, tracking_tolerance,
+		                                      min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		bertini::tracking::config::Newton eigen_settings;
+		eigen_settings.multiprecision_lu = false;
+		corrector.Settings(eigen_settings);
+		
+		Vec<mpfr> eigen_result;
+		mpfr_float eigen_norm_delta_z, eigen_norm_J, eigen_norm_J_inverse, eigen_condition_number_estimate;
+		auto eigen_code = corrector.Correct(eigen_result,
+		                                    eigen_norm_delta_z, eigen_norm_J, eigen_norm_J_inverse, eigen_condition_number_estimate,
+		                                    sys, current_space, current_time, tracking_tolerance,
+		                                    min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(blocked_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(eigen_code==bertini::tracking::SuccessCode::Success);
+		for (unsigned ii = 0; ii < blocked_result.size(); ++ii)
+			BOOST_CHECK(abs(blocked_result(ii)-eigen_result(ii)) < threshold_clearance_mp);
+		BOOST_CHECK(abs(norm_J_inverse - eigen_norm_J_inverse) < threshold_clearance_mp*eigen_norm_J_inverse);
+	}
+	
+	
+	BOOST_AUTO_TEST_CASE(chain_sparse_solve_matches_dense_d)
+	{
+		Vec<dbl> current_space(3);
+		current_space << dbl(1.3,0.2), dbl(1.1, 0.87), dbl(2.1,-0.3);
+		
+		dbl current_time(0.9);
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), z = std::make_shared<Variable>("z"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y,z};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		// each function in two of the three variables, so a third of the Jacobian is structurally zero
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + y - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(y*z - 2) );
+		sys.AddFunction( t*(z-2) + (1-t)*(pow(z,2) + x - 3) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		double tracking_tolerance(1e1);
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+		
+		bertini::tracking::config::Newton sparse_settings;
+		sparse_settings.sparse_density_threshold = 0.7;
+		BOOST_CHECK(sys.JacobianDensity() < sparse_settings.sparse_density_threshold);
+		
+		NewtonCorrector corrector(sys);
+		corrector.Settings(sparse_settings);
+		
+		Vec<dbl> sparse_result;
+		auto sparse_code = corrector.Correct(sparse_result, sys, current_space, current_time,
+		                                     tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		bertini::tracking::config::Newton dense_settings;
+		corrector.Settings(dense_settings);
+		
+		Vec<dbl> dense_result;
+		auto dense_code = corrector.Correct(dense_result, sys, current_space, current_time,
+		                                    tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(sparse_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(dense_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK((sparse_result-dense_result).norm() < threshold_clearance_d);
+	}
+	
+	BOOST_AUTO_TEST_CASE(chain_sparse_solve_matches_dense_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		Vec<mpfr> current_space(3);
+		current_space << mpfr("1.3","0.2"), mpfr("1.1", "0.87"), mpfr("2.1","-0.3");
+		
+		mpfr current_time("0.9");
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), z = std::make_shared<Variable>("z"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y,z};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + y - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(y*z - 2) );
+		sys.AddFunction( t*(z-2) + (1-t)*(pow(z,2) + x - 3) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		bertini::mpfr_float tracking_tolerance("1e1");
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+		
+		bertini::tracking::config::Newton sparse_settings;
+		sparse_settings.sparse_density_threshold = 0.7;
+		BOOST_CHECK(sys.JacobianDensity() < sparse_settings.sparse_density_threshold);
+		
+		NewtonCorrector corrector(sys);
+		corrector.Settings(sparse_settings);
+		
+		Vec<mpfr> sparse_result;
+		auto sparse_code = corrector.Correct(sparse_result, sys, current_space, current_time,
+		                                     tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		// Eigen's own dense factorization, rather than MultiprecisionLU, as the reference
+		bertini::tracking::config::Newton dense_settings;
+		dense_settings.multiprecision_lu = false;
+		corrector.Settings(dense_settings);
+		
+		Vec<mpfr> dense_result;
+		auto dense_code = corrector.Correct(dense_result, sys, current_space, current_time,
+		                                    tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		
+		BOOST_CHECK(sparse_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(dense_code==bertini::tracking::SuccessCode::Success);
+		for (unsigned ii = 0; ii < sparse_result.size(); ++ii)
+			BOOST_CHECK(abs(sparse_result(ii)-dense_result(ii)) < threshold_clearance_mp);
+	}
+	
+	
+	// configured with --enable-eigen_malloc_checks, which defines EIGEN_RUNTIME_NO_MALLOC for the library too
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+	BOOST_AUTO_TEST_CASE(circle_line_heun_euler_step_does_not_allocate_d)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+		
+		dbl current_time(0.9);
+		dbl delta_t(-0.1);
+		
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		
+		VariableGroup vars{x,y};
+		
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+		
+		double error_est, size_proportion, norm_J, norm_J_inverse, condition_number_estimate;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+		unsigned frequency_of_CN_estimation = 1;
+		double tracking_tolerance(1e-5);
+		unsigned max_num_newton_iterations = 3;
+		unsigned min_num_newton_iterations = 1;
+		
+		ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::HeunEuler, sys);
+		NewtonCorrector corrector(sys);
+		
+		Vec<dbl> predicted, corrected;
+		auto step = [&]()
+		{
+			predictor.Predict(predicted, error_est, size_proportion, norm_J, norm_J_inverse,
+			                  sys, current_space, current_time, delta_t,
+			                  condition_number_estimate, num_steps_since_last_condition_number_computation,
+			                  frequency_of_CN_estimation, tracking_tolerance, AMP);
+			return corrector.Correct(corrected, sys, predicted, dbl(current_time+delta_t),
+			                         tracking_tolerance, min_num_newton_iterations, max_num_newton_iterations, AMP);
+		};
+		
+		// the first step sizes the outputs, and the factorizations held by the predictor and corrector
+		auto first_code = step();
+		Vec<dbl> first_result = corrected;
+		
+		// Eigen asserts if it is asked for memory while this is off
+		Eigen::internal::set_is_malloc_allowed(false);
+		auto second_code = step();
+		Eigen::internal::set_is_malloc_allowed(true);
+		
+		BOOST_CHECK(first_code==second_code);
+		BOOST_CHECK((corrected-first_result).norm() < threshold_clearance_d);
+	}
+#endif
+	
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -29,6 +29,9 @@
 
 #include "bertini2/tracking/amp_tracker.hpp"
 #include "bertini2/tracking/observers.hpp"
+#include "bertini2/tracking/step_trace.hpp"
+#include "bertini2/tracking/path_recorder.hpp"
+#include "bertini2/logging.hpp"
 
 
 
@@ -230,6 +233,441 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 
 
 
+BOOST_AUTO_TEST_CASE(precision_timer_square_root)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	PrecisionTimer<AMPTracker> timer;
+
+	tracker.AddObserver(&timer);
+
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK(!timer.Seconds().empty());
+
+	double total = 0;
+	for (auto const& s : timer.Seconds())
+	{
+		BOOST_CHECK(s.second >= 0);
+		total += s.second;
+	}
+	BOOST_CHECK(total > 0);
+
+	timer.Reset();
+	BOOST_CHECK(timer.Seconds().empty());
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(step_trace_square_root)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_step_trace_test_%%%%-%%%%");
+	auto file = std::make_shared<StepTraceFile>(filename);
+	StepTraceRecorder<AMPTracker> recorder(file);
+
+	tracker.AddObserver(&recorder);
+	recorder.SetPath(3);
+
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+
+	file->Close();
+	auto records = ReadStepTrace(filename);
+	boost::filesystem::remove(filename);
+
+	BOOST_CHECK_EQUAL(recorder.NumDropped(), 0);
+	BOOST_CHECK_EQUAL(file->NumWritten(), records.size());
+	BOOST_CHECK_EQUAL(records.size(), tracker.NumTotalStepsTaken());
+
+	unsigned num_failed = 0;
+	for (unsigned ii = 0; ii < records.size(); ++ii)
+	{
+		auto const& r = records[ii];
+		BOOST_CHECK_EQUAL(r.path, 3);
+		BOOST_CHECK_EQUAL(r.step, ii+1);
+		BOOST_CHECK(r.precision >= 16);
+		BOOST_CHECK(r.stepsize > 0);
+		if (r.success!=static_cast<std::int32_t>(SuccessCode::Success))
+			++num_failed;
+	}
+	BOOST_CHECK_EQUAL(num_failed, tracker.NumFailedStepsTaken());
+	BOOST_CHECK(std::abs(records.back().time_real) < 1e-10);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(step_recorder_hands_on_batches)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
+
+	StepRecorder<AMPTracker> kept, batched;
+	std::vector<std::size_t> batch_sizes;
+	std::vector<step_trace::Record> handed_on;
+	batched.SetBatchHandler([&](std::vector<step_trace::Record> && batch)
+		{
+			batch_sizes.push_back(batch.size());
+			handed_on.insert(handed_on.end(), batch.begin(), batch.end());
+		}, 5);
+
+	tracker.AddObserver(&kept);
+	tracker.AddObserver(&batched);
+	kept.SetPath(2);
+	batched.SetPath(2);
+
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point, mpfr(1), mpfr(0), start_point);
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(kept.Records().size(), tracker.NumTotalStepsTaken());
+	BOOST_CHECK(batched.Records().empty()); // the rest were handed on at the end of tracking
+	BOOST_REQUIRE_EQUAL(handed_on.size(), kept.Records().size());
+	for (auto s : batch_sizes)
+		BOOST_CHECK(s <= 5);
+	for (unsigned ii = 0; ii < handed_on.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(handed_on[ii].path, 2);
+		BOOST_CHECK_EQUAL(handed_on[ii].step, kept.Records()[ii].step);
+		BOOST_CHECK_EQUAL(handed_on[ii].precision, kept.Records()[ii].precision);
+	}
+
+	auto taken = kept.Take();
+	BOOST_CHECK(kept.Records().empty());
+	BOOST_CHECK_EQUAL(taken.size(), handed_on.size());
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(path_recorder_thins_and_bounds_points)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
+
+	config::PathRecording every;
+	every.decimation = config::PathDecimation::None;
+	PathRecorder<AMPTracker> all(every), thinned;
+
+	// a budget of a few points, so the points are written out, or thinned, several times over the path
+	config::PathRecording small = every;
+	small.memory_budget = 6*sizeof(RecordedPoint);
+	small.multiple_precision = true;
+	PathRecorder<AMPTracker> spilled(small), bounded(small);
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_path_trace_test_%%%%-%%%%");
+	auto file = std::make_shared<PathTraceFile>(filename);
+	spilled.SetSink(file);
+
+	for (auto r : {&all, &thinned, &spilled, &bounded})
+	{
+		tracker.AddObserver(r);
+		r->SetPath(5);
+	}
+
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point, mpfr(1), mpfr(0), start_point);
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+
+	const auto num_successful = tracker.NumTotalStepsTaken() - tracker.NumFailedStepsTaken();
+	BOOST_CHECK_EQUAL(all.NumSteps(), num_successful);
+	BOOST_REQUIRE_EQUAL(all.Points().size(), num_successful);
+	BOOST_CHECK(all.Points().front().point_mp.size()==0);
+	BOOST_CHECK(std::abs(all.Points().back().time) < 1e-10);
+	BOOST_CHECK(abs(all.Points().back().point(0) - dbl(end_point(0))) < threshold_clearance_d);
+
+	// the path y = sqrt(t) bends ever more sharply toward t=0, where the points thicken, and the ends are kept
+	BOOST_REQUIRE(!thinned.Points().empty());
+	BOOST_CHECK(thinned.Points().size() < all.Points().size());
+	BOOST_CHECK_EQUAL(thinned.Points().front().step, all.Points().front().step);
+	BOOST_CHECK_EQUAL(thinned.Points().back().step, all.Points().back().step);
+
+	spilled.Flush();
+	file->Close();
+	auto written = ReadPathTrace(filename);
+	boost::filesystem::remove(filename);
+
+	BOOST_CHECK_EQUAL(file->NumWritten(), num_successful);
+	BOOST_REQUIRE_EQUAL(written.size(), num_successful);
+	for (unsigned ii = 0; ii < written.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(written[ii].path, 5);
+		BOOST_CHECK_EQUAL(written[ii].step, all.Points()[ii].step);
+		BOOST_CHECK_EQUAL(written[ii].precision, all.Points()[ii].precision);
+		BOOST_CHECK(written[ii].point==all.Points()[ii].point);
+		BOOST_REQUIRE_EQUAL(written[ii].point_mp.size(), 2);
+		BOOST_CHECK(abs(dbl(written[ii].point_mp(1)) - written[ii].point(1)) < threshold_clearance_d);
+	}
+
+	BOOST_CHECK(bounded.NumThinnings() > 0);
+	BOOST_CHECK(bounded.MemoryBytes() <= small.memory_budget);
+	BOOST_CHECK(bounded.Points().size() < num_successful);
+	BOOST_CHECK(bounded.Settings().decimation==config::PathDecimation::EveryKth);
+}
+
+
+
+
+
+/**
+Counts every event it gets, and says it only wants successful steps.
+*/
+template<class TrackerT>
+class SuccessfulStepCounter : public bertini::Observer<TrackerT>
+{
+public:
+	using EmitterT = typename bertini::tracking::TrackerTraits<TrackerT>::EventEmitterType;
+
+	virtual bool Subscribes(std::type_info const& event_type) const override
+	{
+		return event_type==typeid(bertini::tracking::SuccessfulStep<EmitterT>);
+	}
+
+	virtual void Observe(bertini::AnyEvent const& e) override
+	{
+		++num_events;
+		if (typeid(e)==typeid(bertini::tracking::SuccessfulStep<EmitterT>))
+			++num_successful_steps;
+	}
+
+	virtual void Visit(TrackerT const& t) override
+	{}
+
+	unsigned num_events = 0;
+	unsigned num_successful_steps = 0;
+};
+
+
+BOOST_AUTO_TEST_CASE(observers_get_only_subscribed_events)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	SuccessfulStepCounter<AMPTracker> counter;
+	PrecisionAccumulator<AMPTracker> precision_accumulator; // subscribes to everything
+
+	tracker.AddObserver(&counter);
+	tracker.AddObserver(&precision_accumulator);
+
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK(counter.num_successful_steps > 0);
+	BOOST_CHECK_EQUAL(counter.num_events, counter.num_successful_steps);
+	BOOST_CHECK(precision_accumulator.Precisions().size() > counter.num_events);
+
+	// an observer added after events of its type were first emitted gets them too
+	SuccessfulStepCounter<AMPTracker> late_counter;
+	tracker.AddObserver(&late_counter);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(late_counter.num_successful_steps > 0);
+	BOOST_CHECK_EQUAL(late_counter.num_events, late_counter.num_successful_steps);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(log_messages_below_severity_are_not_formatted)
+{
+	using bertini::severity_level;
+
+	unsigned num_formatted = 0;
+	auto count = [&num_formatted]{ return ++num_formatted; };
+
+	bool was_enabled = bertini::LogEnabled(severity_level::trace);
+
+	bertini::SetLogSeverity(severity_level::info);
+	BERTINI_LOG(trace) << "not written " << count();
+	BERTINI_LOG(debug) << "not written " << count();
+	BOOST_CHECK_EQUAL(num_formatted, 0);
+	BOOST_CHECK(!bertini::LogEnabled(severity_level::debug));
+	BOOST_CHECK(bertini::LogEnabled(severity_level::warning));
+
+	bertini::SetLogSeverity(was_enabled ? severity_level::trace : severity_level::info);
+}
+
+
+
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,195 @@
+//This file is part of Bertini 2.
+//
+//solution_writer_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solution_writer_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solution_writer_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+#include <boost/test/unit_test.hpp>
+#include "tracking/solution_writer.hpp"
+
+#include <fstream>
+#include <sstream>
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+	std::string Contents(fs::path const& file)
+	{
+		std::ifstream fin(file.string(), std::ios::binary);
+		std::stringstream buffer;
+		buffer << fin.rdbuf();
+		return buffer.str();
+	}
+
+	unsigned CountAtTop(fs::path const& file)
+	{
+		std::ifstream fin(file.string());
+		unsigned count;
+		fin >> count;
+		return count;
+	}
+
+	template<typename T>
+	bertini::tracking::SolutionRecord<T> Record(size_t path, bertini::tracking::SuccessCode success, unsigned cycle_number, Vec<T> const& solution)
+	{
+		bertini::tracking::SolutionRecord<T> r;
+		r.path = path;
+		r.success = success;
+		r.cycle_number = cycle_number;
+		r.solution = solution;
+		return r;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(solution_writer)
+
+
+BOOST_AUTO_TEST_CASE(solution_writer_sorts_into_classic_files_and_binary)
+{
+	using namespace bertini::tracking;
+
+	auto directory = fs::temp_directory_path() / fs::unique_path("b2_solution_writer_test_%%%%-%%%%");
+
+	Vec<dbl> real_point(2), complex_point(2), far_point(2);
+	real_point << dbl(1.5, 0), dbl(-2, 1e-12);
+	complex_point << dbl(0.25, 1), dbl(3, -4);
+	far_point << dbl(1e10, 1), dbl(2e10, 0);
+
+	{
+		SolutionWriter<dbl> writer(directory);
+		writer.Write(Record(0, SuccessCode::Success, 1, real_point));
+		writer.Write(Record(1, SuccessCode::Success, 2, complex_point));
+		writer.Write(Record(2, SuccessCode::GoingToInfinity, 0, far_point));
+		writer.Write(Record(3, SuccessCode::MinStepSizeReached, 0, Vec<dbl>()));
+		writer.Close();
+		BOOST_CHECK_EQUAL(writer.NumWritten(), 4);
+	}
+
+	BOOST_CHECK_EQUAL(CountAtTop(directory / "finite_solutions"), 2);
+	BOOST_CHECK_EQUAL(CountAtTop(directory / "real_finite_solutions"), 1);
+	BOOST_CHECK_EQUAL(CountAtTop(directory / "nonsingular_solutions"), 1);
+	BOOST_CHECK_EQUAL(CountAtTop(directory / "singular_solutions"), 1);
+	BOOST_CHECK_EQUAL(CountAtTop(directory / "infinite_solutions"), 1);
+
+	auto data = Contents(directory / "solutions.b2sol");
+	BinarySolutionView view(data.data(), data.size());
+	BOOST_REQUIRE_EQUAL(view.NumRecords(), 4);
+
+	BOOST_CHECK_EQUAL(view.Header(0).flags, solution_file::Finite | solution_file::Real);
+	BOOST_CHECK_EQUAL(view.Header(1).flags, solution_file::Finite | solution_file::Singular);
+	BOOST_CHECK_EQUAL(view.Header(2).flags, solution_file::Infinite);
+	BOOST_CHECK_EQUAL(view.Header(3).flags, 0);
+	BOOST_CHECK_EQUAL(view.Header(3).dimension, 0);
+	BOOST_CHECK_EQUAL(view.Header(1).path, 1);
+
+	auto read = view.Solution<dbl>(1);
+	BOOST_REQUIRE_EQUAL(read.size(), 2);
+	BOOST_CHECK(read(0)==complex_point(0));
+	BOOST_CHECK(read(1)==complex_point(1));
+
+	fs::remove_all(directory);
+}
+
+
+BOOST_AUTO_TEST_CASE(solution_writer_binary_mpfr_is_exact)
+{
+	using namespace bertini::tracking;
+	bertini::DefaultPrecision(40);
+
+	auto directory = fs::temp_directory_path() / fs::unique_path("b2_solution_writer_test_%%%%-%%%%");
+
+	Vec<mpfr> point(3);
+	point << mpfr("0.1234567890123456789012345678901234567", "-3.3"), mpfr("0", "0"), mpfr("-1e-300", "7");
+
+	{
+		SolutionWriter<mpfr> writer(directory, false, true);
+		writer.Write(Record(5, SuccessCode::Success, 1, point));
+	}
+
+	BOOST_CHECK(!fs::exists(directory / "finite_solutions"));
+
+	auto data = Contents(directory / "solutions.b2sol");
+	BinarySolutionView view(data.data(), data.size());
+	BOOST_REQUIRE_EQUAL(view.NumRecords(), 1);
+	BOOST_CHECK(view.Header(0).precision > 0);
+
+	auto read = view.Solution<mpfr>(0);
+	BOOST_REQUIRE_EQUAL(read.size(), 3);
+	for (unsigned ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(read(ii).real()==point(ii).real());
+		BOOST_CHECK(read(ii).imag()==point(ii).imag());
+	}
+
+	fs::remove_all(directory);
+}
+
+
+BOOST_AUTO_TEST_CASE(mapped_solution_file_selects_and_decodes_in_place)
+{
+	using namespace bertini::tracking;
+
+	bertini::DefaultPrecision(30);
+
+	auto directory = fs::temp_directory_path() / fs::unique_path("b2_solution_writer_test_%%%%-%%%%");
+
+	Vec<mpfr> a(2), b(2);
+	a << mpfr("1.5", "0"), mpfr("-2", "0.25");
+	b << mpfr("3", "-1"), mpfr("0", "4");
+
+	{
+		SolutionWriter<mpfr> writer(directory, false, true);
+		writer.Write(Record(0, SuccessCode::Success, 1, a));
+		writer.Write(Record(1, SuccessCode::MaxNumStepsTaken, 0, Vec<mpfr>()));
+		writer.Write(Record(2, SuccessCode::Success, 1, b));
+	}
+
+	{
+		MappedSolutionFile file(directory / "solutions.b2sol");
+		BOOST_REQUIRE_EQUAL(file.View().NumRecords(), 3);
+
+		auto finite = file.View().Select([](solution_file::RecordHeader const& h){ return (h.flags & solution_file::Finite)!=0;});
+		BOOST_REQUIRE_EQUAL(finite.NumRecords(), 2);
+		BOOST_CHECK_EQUAL(finite.Header(1).path, 2);
+
+		auto read = finite.Solution<mpfr>(1);
+		BOOST_REQUIRE_EQUAL(read.size(), 2);
+		BOOST_CHECK(read(1).imag()==b(1).imag());
+
+		auto read_double = finite.Solution<dbl>(0);
+		BOOST_CHECK_EQUAL(read_double(1), dbl(-2, 0.25));
+	}
+
+	fs::remove_all(directory);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
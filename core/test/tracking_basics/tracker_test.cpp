@@ -27,7 +27,26 @@
 
 #include <boost/test/unit_test.hpp>
 #include "start_system.hpp"
+#include "solution_cache.hpp"
 #include "tracking/tracker.hpp"
+#include "tracking/parallel_solver.hpp"
+#include "tracking/async_solve.hpp"
+#include "tracking/post_processing.hpp"
+#include "tracking/polyhedral.hpp"
+#include "tracking/monodromy.hpp"
+#include "tracking/regeneration.hpp"
+#include "tracking/witness_sampler.hpp"
+#include "tracking/irreducible_decomposition.hpp"
+#include "tracking/bundle_tracker.hpp"
+#include "tracking/certification.hpp"
+#include "tracking/deflation.hpp"
+#include "tracking/sharpen.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 
 using System = bertini::System;
 using Variable = bertini::node::Variable;
@@ -160,6 +179,48 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_quadratic)
 
 
 
+BOOST_AUTO_TEST_CASE(AMP_tracker_reset_and_setup_again_between_paths)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddFunction(y-pow(t,2));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(VariableGroup{y});
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::RK4, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
+
+	mpfr t_start(1), t_end(-1);
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_first;
+	BOOST_CHECK(tracker.TrackPath(y_first, t_start, t_end, y_start)==SuccessCode::Success);
+	auto num_steps = tracker.NumTotalStepsTaken();
+	BOOST_CHECK(num_steps > 0);
+
+	tracker.Reset();
+	BOOST_CHECK_EQUAL(tracker.NumTotalStepsTaken(), 0u);
+
+	// setting up with the same predictor keeps its tables, and tracks the same
+	tracker.Setup(config::Predictor::RK4, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	Vec<mpfr> y_second;
+	BOOST_CHECK(tracker.TrackPath(y_second, t_start, t_end, y_start)==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.NumTotalStepsTaken(), num_steps);
+	BOOST_CHECK(abs(y_second(0)-y_first(0)) < 1e-20);
+}
+
+
 BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic)
 {
 	mpfr_float::default_precision(30);
@@ -212,34 +273,91 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic)
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_tracker_track_square_root)
+BOOST_AUTO_TEST_CASE(AMP_minimize_tracking_cost_matches_direct_search)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	// the minimizer compares the logarithms of the costs in double; compare with comparing the costs themselves
+	for (int rhs = 0; rhs < 60; rhs += 3)
+		for (unsigned order : {0u, 1u, 4u})
+		{
+			const mpfr_float max_stepsize("0.1"), criterion_B_rhs(rhs);
+			unsigned expected_precision = 0;
+			mpfr_float expected_stepsize, min_cost = -1;
+			for (unsigned p : {16u, 20u, 30u, 40u, 50u, 60u, 70u, 80u})
+			{
+				mpfr_float stepsize = min(StepsizeSatisfyingCriterionB(p, criterion_B_rhs, 2, order), max_stepsize);
+				mpfr_float cost = ArithmeticCost(p) / stepsize;
+				if (min_cost < 0 || cost < min_cost)
+				{
+					min_cost = cost;
+					expected_precision = p;
+					expected_stepsize = stepsize;
+				}
+			}
+
+			unsigned new_precision;
+			mpfr_float new_stepsize;
+			MinimizeTrackingCost<mpfr_float>(new_precision, new_stepsize,
+			                                 16, mpfr_float("0.05"), 80, max_stepsize,
+			                                 criterion_B_rhs, 2, order);
+			BOOST_CHECK_EQUAL(new_precision, expected_precision);
+			BOOST_CHECK(abs(new_stepsize-expected_stepsize) <= expected_stepsize*mpfr_float("1e-25"));
+		}
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_cost_over_predictors_prefers_low_order_for_capped_steps_and_high_order_for_short_ones)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	// steps satisfying criterion B are far longer than the max for every order, so the fewest stages win
+	auto predictor = config::Predictor::RKF45;
+	unsigned new_precision;
+	mpfr_float new_stepsize;
+	MinimizeTrackingCostOverPredictors<mpfr_float>(predictor, new_precision, new_stepsize,
+	                                               16, mpfr_float("0.05"), 16, mpfr_float("0.1"),
+	                                               mpfr_float(10), 2);
+	BOOST_CHECK(predictor==config::Predictor::HeunEuler);
+	BOOST_CHECK_EQUAL(new_precision, 16);
+	BOOST_CHECK(abs(new_stepsize-mpfr_float("0.1")) < 1e-20);
+
+	// here they are short, and much longer for higher order
+	predictor = config::Predictor::HeunEuler;
+	MinimizeTrackingCostOverPredictors<mpfr_float>(predictor, new_precision, new_stepsize,
+	                                               16, mpfr_float("0.05"), 16, mpfr_float("0.1"),
+	                                               mpfr_float(30), 2);
+	BOOST_CHECK(predictor==config::Predictor::RKVerner67);
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_adaptive_predictor)
 {
 	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
 
-	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
 	Var t = std::make_shared<Variable>("t");
 
 	System sys;
 
-	VariableGroup v{x,y};
+	VariableGroup v{y};
 
-	sys.AddFunction(x-t);
-	sys.AddFunction(pow(y,2)-x);
+	sys.AddFunction(y-pow(t,10));
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
 	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	AMP.adaptive_predictor = true;
 
 	bertini::tracking::AMPTracker tracker(sys);
 
-
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
 
-
-	tracker.Setup(config::Predictor::Euler,
+	tracker.Setup(config::Predictor::RKF45,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
@@ -248,82 +366,57 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_square_root)
 	tracker.PrecisionSetup(AMP);
 
 	mpfr t_start(1);
-	mpfr t_end(0);
+	mpfr t_end(-2);
 	
-	Vec<mpfr> start_point(2);
-	Vec<mpfr> end_point;
-
-	SuccessCode tracking_success;
-
-
-	start_point << mpfr(1), mpfr(1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+	Vec<mpfr> y_end;
 
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
 
-	start_point << mpfr(1), mpfr(-1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+	// the predictor set on the tracker starts the next path
+	BOOST_CHECK(tracker.Predictor()==config::Predictor::RKF45);
+}
 
-	t_start = mpfr(-1);
-	start_point << mpfr(-1), mpfr(0,-1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
 
-	start_point << mpfr(-1), mpfr(0,1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+BOOST_AUTO_TEST_CASE(PI_step_size_factor_bounded_and_damped)
+{
+	using namespace bertini::tracking;
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+	BOOST_CHECK_CLOSE(CorrectablePredictionError(1e-6, 1), 1e-6, 1e-8);
+	BOOST_CHECK_CLOSE(CorrectablePredictionError(1e-6, 2), 1e-3, 1e-8);
+
+	// on target, the safety factor
+	BOOST_CHECK_CLOSE(PIStepSizeFactor(1, 1, 4, 0.9, 0.5, 2), 0.9, 1e-8);
+	// bounded by the fail and success factors
+	BOOST_CHECK_EQUAL(PIStepSizeFactor(0, 1, 4, 0.9, 0.5, 2), 2);
+	BOOST_CHECK_EQUAL(PIStepSizeFactor(1e6, 1, 4, 0.9, 0.5, 2), 0.5);
+	// a larger error shrinks the step, and less so after the error grew
+	BOOST_CHECK(PIStepSizeFactor(2, 1, 4, 0.9, 0.5, 2) < 0.9);
+	BOOST_CHECK(PIStepSizeFactor(2, 2, 4, 0.9, 0.5, 2) > PIStepSizeFactor(2, 1, 4, 0.9, 0.5, 2));
 }
 
 
-
-
-/*
-1.  Goal:  Handle a singular start point? 
-Expected Behavior:  Doesn't start tracking.
-System:  
-  f = x^2 + (1-t)*x;
-  g = y^2 + (1-t)*y;
-Start t:   1
-Start point:  (0,0)
-End t:   0
-End point:  N/A
-*/
-BOOST_AUTO_TEST_CASE(AMP_tracker_doesnt_start_from_singular_start_point)
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_PI_step_size_controller)
 {
 	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
 
-	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
 	Var t = std::make_shared<Variable>("t");
 
 	System sys;
 
-	VariableGroup v{x,y};
+	VariableGroup v{y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x);
-	sys.AddFunction(pow(y,2) + (1-t)*y);
+	sys.AddFunction(y-pow(t,10));
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
@@ -331,12 +424,11 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_doesnt_start_from_singular_start_point)
 
 	bertini::tracking::AMPTracker tracker(sys);
 
-
 	config::Stepping<mpfr_float> stepping_preferences;
+	stepping_preferences.step_size_controller = config::StepSizeController::PI;
 	config::Newton newton_preferences;
 
-
-	tracker.Setup(config::Predictor::Euler,
+	tracker.Setup(config::Predictor::RKF45,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
@@ -345,39 +437,36 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_doesnt_start_from_singular_start_point)
 	tracker.PrecisionSetup(AMP);
 
 	mpfr t_start(1);
-	mpfr t_end(0);
+	mpfr t_end(-2);
 	
-	Vec<mpfr> start_point(2);
-	Vec<mpfr> end_point;
-
-	SuccessCode tracking_success;
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
 
+	Vec<mpfr> y_end;
 
-	start_point << mpfr(0), mpfr(0);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
 
-	BOOST_CHECK(tracking_success==SuccessCode::SingularStartPoint);
-	BOOST_CHECK_EQUAL(end_point.size(),0);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
 }
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_tracker_tracking_DOES_SOMETHING_PREDICTABLE_from_near_to_singular_start_point)
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_estimated_initial_step_size)
 {
 	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
 
-	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
 	Var t = std::make_shared<Variable>("t");
 
 	System sys;
 
-	VariableGroup v{x,y};
+	VariableGroup v{y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x);
-	sys.AddFunction(pow(y,2) + (1-t)*y);
+	sys.AddFunction(y-pow(t,10));
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
@@ -385,13 +474,11 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_tracking_DOES_SOMETHING_PREDICTABLE_from_near_t
 
 	bertini::tracking::AMPTracker tracker(sys);
 
-
 	config::Stepping<mpfr_float> stepping_preferences;
+	stepping_preferences.estimate_initial_step_size = true;
 	config::Newton newton_preferences;
 
-	stepping_preferences.max_num_steps = 1e2;
-
-	tracker.Setup(config::Predictor::Euler,
+	tracker.Setup(config::Predictor::RK4,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
@@ -400,50 +487,51 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_tracking_DOES_SOMETHING_PREDICTABLE_from_near_t
 	tracker.PrecisionSetup(AMP);
 
 	mpfr t_start(1);
-	mpfr t_end(0);
+	mpfr t_end(-2);
 	
-	Vec<mpfr> start_point(2);
-	Vec<mpfr> end_point;
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
 
-	SuccessCode tracking_success;
+	Vec<mpfr> y_end;
 
-	start_point << mpfr("1e-28"), mpfr("1e-28");
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
 
-	BOOST_CHECK(tracking_success==SuccessCode::MaxNumStepsTaken);
-	BOOST_CHECK_EQUAL(end_point.size(),0);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
 }
 
 
+BOOST_AUTO_TEST_CASE(AMP_precision_decrease_pays_off_only_for_enough_saving)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
 
-/*
-2.  Goal:  Make sure we can handle a simple, mixed (x,y in both polynomials), nonhomogeneous system.
-Expected Behavior:  Success.
-System:
-  f = x^2 + (1-t)*x - 1;
- g = y^2 + (1-t)*x*y - 2;
-Start t:  1
-Start point:  (1, 1.414)
-End t:  0
-End point:  (6.180339887498949e-01, 1.138564265110173e+00)
-(Using Bertini default tracking tolerances.)
-*/
-BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision16)
+	// from 40 to 30 digits, with the same stepsize, saves 1.3 per step
+	BOOST_CHECK(PrecisionDecreasePaysOff(40, mpfr_float("0.01"), 30, mpfr_float("0.01"), 0, 10));
+	BOOST_CHECK(PrecisionDecreasePaysOff(40, mpfr_float("0.01"), 30, mpfr_float("0.01"), 0.5, 10));
+	BOOST_CHECK(!PrecisionDecreasePaysOff(40, mpfr_float("0.01"), 30, mpfr_float("0.01"), 2, 10));
+	// but not if the lower precision takes much shorter steps
+	BOOST_CHECK(!PrecisionDecreasePaysOff(40, mpfr_float("0.01"), 30, mpfr_float("0.005"), 0, 10));
+	// and dropping to double saves so much that it pays for a costly change
+	BOOST_CHECK(PrecisionDecreasePaysOff(40, mpfr_float("0.01"), DoublePrecision(), mpfr_float("0.01"), 5, 10));
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_costly_precision_changes)
 {
-	mpfr_float::default_precision(16);
+	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
 
-	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
 	Var t = std::make_shared<Variable>("t");
 
 	System sys;
 
-	VariableGroup v{x,y};
+	VariableGroup v{y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
-	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddFunction(y-pow(t,10));
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
@@ -451,12 +539,10 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	bertini::tracking::AMPTracker tracker(sys);
 
-
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
 
-
-	tracker.Setup(config::Predictor::Euler,
+	tracker.Setup(config::Predictor::RK4,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
@@ -464,28 +550,116 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	tracker.PrecisionSetup(AMP);
 
+	PathStatsObserver<AMPTracker> stats;
+	tracker.AddObserver(&stats);
+
 	mpfr t_start(1);
-	mpfr t_end(0);
+	mpfr t_end(-2);
 	
-	Vec<mpfr> start_point(2);
-	Vec<mpfr> end_point;
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
 
-	SuccessCode tracking_success;
+	Vec<mpfr> y_end;
 
+	tracker.TrackPath(y_end, t_start, t_end, y_start);
+	auto free_changes = stats.Take();
+	BOOST_CHECK_EQUAL(free_changes.num_avoided_precision_decreases, 0);
 
-	start_point << mpfr(1), mpfr("1.41421356237309504880168872421");
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	AMP.precision_change_cost = 1e6; // no decrease could pay for this
+	tracker.PrecisionSetup(AMP);
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
+	auto costly_changes = stats.Take();
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+	BOOST_CHECK(costly_changes.num_precision_decreases <= free_changes.num_precision_decreases);
+	BOOST_CHECK_EQUAL(costly_changes.num_avoided_precision_decreases, tracker.NumAvoidedPrecisionDecreases());
 }
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision30_tighter_track_tol)
+BOOST_AUTO_TEST_CASE(path_stats_and_AMP_config_serialize_their_added_fields)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	// archives of version 0 do not have the fields added since
+	BOOST_CHECK_EQUAL(boost::serialization::version<PathStats>::value, 1);
+	BOOST_CHECK_EQUAL(boost::serialization::version<config::AdaptiveMultiplePrecisionConfig>::value, 1);
+
+	PathStats stats;
+	stats.num_steps = 12;
+	stats.num_precision_decreases = 3;
+	stats.num_avoided_precision_decreases = 2;
+	stats.max_precision = 40;
+
+	config::AdaptiveMultiplePrecisionConfig AMP;
+	AMP.maximum_precision = 200;
+	AMP.precision_change_cost = 1.5;
+
+	std::stringstream buffer;
+	{
+		boost::archive::binary_oarchive oa(buffer);
+		oa << stats << AMP;
+	}
+
+	PathStats stats_in;
+	config::AdaptiveMultiplePrecisionConfig AMP_in;
+	{
+		boost::archive::binary_iarchive ia(buffer);
+		ia >> stats_in >> AMP_in;
+	}
+
+	BOOST_CHECK_EQUAL(stats_in.num_steps, 12);
+	BOOST_CHECK_EQUAL(stats_in.num_precision_decreases, 3);
+	BOOST_CHECK_EQUAL(stats_in.num_avoided_precision_decreases, 2);
+	BOOST_CHECK_EQUAL(stats_in.max_precision, 40);
+	BOOST_CHECK_EQUAL(AMP_in.maximum_precision, 200);
+	BOOST_CHECK_EQUAL(AMP_in.precision_change_cost, 1.5);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(parallel_solver_path_result_serializes_its_handoff)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+	using PathResult = ParallelSolver<AMPTracker>::PathResult;
+
+	// archives of version 0 have no boundary time or handoff signal
+	BOOST_CHECK_EQUAL(boost::serialization::version<PathResult>::value, 1);
+
+	PathResult result;
+	result.path = 7;
+	result.success = SuccessCode::Success;
+	result.condition_number = 25;
+	result.boundary_time = mpfr("0.05");
+	result.handoff_signal = config::HandoffSignal::StepsizeCollapse;
+
+	std::stringstream buffer;
+	{
+		boost::archive::binary_oarchive oa(buffer);
+		oa << result;
+	}
+
+	PathResult result_in;
+	{
+		boost::archive::binary_iarchive ia(buffer);
+		ia >> result_in;
+	}
+
+	BOOST_CHECK_EQUAL(result_in.path, 7);
+	BOOST_CHECK(result_in.success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(result_in.condition_number, 25);
+	BOOST_CHECK(result_in.boundary_time==mpfr("0.05"));
+	BOOST_CHECK(result_in.handoff_signal==config::HandoffSignal::StepsizeCollapse);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_square_root)
 {
 	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
@@ -498,8 +672,8 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	VariableGroup v{x,y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
-	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
@@ -511,10 +685,9 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
 
-	newton_preferences.max_num_newton_iterations = 6;
 
 	tracker.Setup(config::Predictor::Euler,
-	              	mpfr_float("1e-30"),
+	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
 					newton_preferences);
@@ -524,34 +697,66 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 	mpfr t_start(1);
 	mpfr t_end(0);
 	
-	mpfr_float::default_precision(30);
 	Vec<mpfr> start_point(2);
 	Vec<mpfr> end_point;
 
 	SuccessCode tracking_success;
 
 
-	start_point << mpfr(1), mpfr("1.41421356237309504880168872421");
+	start_point << mpfr(1), mpfr(1);
 	tracking_success = tracker.TrackPath(end_point,
 	                  t_start, t_end, start_point);
 
-	mpfr_float::default_precision(40);
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
 
-	Vec<mpfr> true_solution(2);
-	true_solution <<  mpfr("0.61803398874989484820458683436563811772030918"), mpfr("1.13856426511017256414753784441721594451116198");
 
+	start_point << mpfr(1), mpfr(-1);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
 
 	BOOST_CHECK(tracking_success==SuccessCode::Success);
 	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-true_solution(0)) < 1e-30);
-	BOOST_CHECK(abs(end_point(1)-true_solution(1)) < 1e-30);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
 
-	BOOST_CHECK( (end_point - true_solution).norm() < 1e-30);
+	t_start = mpfr(-1);
+	start_point << mpfr(-1), mpfr(0,-1);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+
+	start_point << mpfr(-1), mpfr(0,1);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
 }
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision30)
+
+/*
+1.  Goal:  Handle a singular start point? 
+Expected Behavior:  Doesn't start tracking.
+System:  
+  f = x^2 + (1-t)*x;
+  g = y^2 + (1-t)*y;
+Start t:   1
+Start point:  (0,0)
+End t:   0
+End point:  N/A
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_doesnt_start_from_singular_start_point)
 {
 	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
@@ -564,8 +769,8 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	VariableGroup v{x,y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
-	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddFunction(pow(x,2) + (1-t)*x);
+	sys.AddFunction(pow(y,2) + (1-t)*y);
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
@@ -593,24 +798,21 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 	Vec<mpfr> end_point;
 
 	SuccessCode tracking_success;
-	tracker.PrecisionPreservation(true);
 
-	start_point << mpfr(1), mpfr("1.414");
+
+	start_point << mpfr(0), mpfr(0);
 	tracking_success = tracker.TrackPath(end_point,
 	                  t_start, t_end, start_point);
 
-	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+	BOOST_CHECK(tracking_success==SuccessCode::SingularStartPoint);
+	BOOST_CHECK_EQUAL(end_point.size(),0);
 }
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision100)
+BOOST_AUTO_TEST_CASE(AMP_tracker_tracking_DOES_SOMETHING_PREDICTABLE_from_near_to_singular_start_point)
 {
-	mpfr_float::default_precision(100);
+	mpfr_float::default_precision(30);
 	using namespace bertini::tracking;
 
 	Var x = std::make_shared<Variable>("x");
@@ -621,12 +823,12 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	VariableGroup v{x,y};
 
-	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
-	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddFunction(pow(x,2) + (1-t)*x);
+	sys.AddFunction(pow(y,2) + (1-t)*y);
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
-	
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
 
 	bertini::tracking::AMPTracker tracker(sys);
 
@@ -634,14 +836,14 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
 
+	stepping_preferences.max_num_steps = 1e2;
 
 	tracker.Setup(config::Predictor::Euler,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
 					newton_preferences);
-	tracker.PrecisionPreservation(true);
-	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
 	tracker.PrecisionSetup(AMP);
 
 	mpfr t_start(1);
@@ -652,58 +854,47 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 
 	SuccessCode tracking_success;
 
-
-	start_point << mpfr(1), mpfr("1.414");
+	start_point << mpfr("1e-28"), mpfr("1e-28");
 	tracking_success = tracker.TrackPath(end_point,
 	                  t_start, t_end, start_point);
 
-	BOOST_CHECK_EQUAL(DefaultPrecision(),100);
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+	BOOST_CHECK(tracking_success==SuccessCode::MaxNumStepsTaken);
+	BOOST_CHECK_EQUAL(end_point.size(),0);
 }
 
 
 
-
-
-
-
 /*
-5.  Goal:  Fail when running into a singularity.
-Expected Behavior:  Path failure near t=0.5.
-Note:  There's a parameter in this system, which depends on the path variable.  This implicitly checks that functionality.
+2.  Goal:  Make sure we can handle a simple, mixed (x,y in both polynomials), nonhomogeneous system.
+Expected Behavior:  Success.
 System:
-  s= -1*(1-t) + 1*t;
- f = x^2-s;
- g = y^2-s;
+  f = x^2 + (1-t)*x - 1;
+ g = y^2 + (1-t)*x*y - 2;
 Start t:  1
-Start point:  (1,1)
+Start point:  (1, 1.414)
 End t:  0
-End point:  N/A (Path should fail at t=0.5)
+End point:  (6.180339887498949e-01, 1.138564265110173e+00)
+(Using Bertini default tracking tolerances.)
 */
-BOOST_AUTO_TEST_CASE(AMP_tracker_fails_with_singularity_on_path)
+BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision16)
 {
-	mpfr_float::default_precision(30);
+	mpfr_float::default_precision(16);
 	using namespace bertini::tracking;
 
 	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
 	Var t = std::make_shared<Variable>("t");
 
-	auto s = -1*(1-t) + 1*t;
-
 	System sys;
 
 	VariableGroup v{x,y};
 
-	sys.AddFunction(pow(x,2) - s);
-	sys.AddFunction(pow(y,2) - s);
+	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
 	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
-	
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
 
 	bertini::tracking::AMPTracker tracker(sys);
 
@@ -717,8 +908,7 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_fails_with_singularity_on_path)
 					mpfr_float("1e5"),
 					stepping_preferences,
 					newton_preferences);
-	tracker.PrecisionPreservation(true);
-	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
 	tracker.PrecisionSetup(AMP);
 
 	mpfr t_start(1);
@@ -727,31 +917,25 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_fails_with_singularity_on_path)
 	Vec<mpfr> start_point(2);
 	Vec<mpfr> end_point;
 
-	start_point << mpfr(1), mpfr(1);
-	SuccessCode tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	SuccessCode tracking_success;
 
-	BOOST_CHECK(tracking_success!=SuccessCode::Success);
-	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
-}
 
+	start_point << mpfr(1), mpfr("1.41421356237309504880168872421");
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
 
-// has two solutions:
-//
-// 1.
-// x = -0.61803398874989484820458683
-// y = 1.6180339887498948482045868
-//
-// 2. 
-// x = 0.16180339887498948482045868
-// y = -0.6180339887498948482045868
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+}
 
 
 
-BOOST_AUTO_TEST_CASE(AMP_track_total_degree_start_system)
+BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision30_tighter_track_tol)
 {
-	using namespace bertini::tracking;
 	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
 
 	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
@@ -761,98 +945,63 @@ BOOST_AUTO_TEST_CASE(AMP_track_total_degree_start_system)
 
 	VariableGroup v{x,y};
 
+	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddPathVariable(t);
 	sys.AddVariableGroup(v);
 
-	sys.AddFunction(x*y+1);
-	sys.AddFunction(x+y-1);
-	sys.Homogenize();
-	sys.AutoPatch();
-
-	BOOST_CHECK(sys.IsHomogeneous());
-	BOOST_CHECK(sys.IsPatched());	
-
-	
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
 
-	auto TD = bertini::start_system::TotalDegree(sys);
-	TD.Homogenize();
-	BOOST_CHECK(TD.IsHomogeneous());
-	BOOST_CHECK(TD.IsPatched());
+	bertini::tracking::AMPTracker tracker(sys);
 
-	auto final_system = (1-t)*sys + t*TD;
-	final_system.AddPathVariable(t);
 
-	auto tracker = AMPTracker(final_system);
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
-	tracker.Setup(config::Predictor::Euler,
-	              	mpfr_float("1e-5"), mpfr_float("1e5"),
-					stepping_preferences, newton_preferences);
-	
-	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
-	tracker.PrecisionPreservation(true);
-	mpfr t_start(1), t_end(0);
-	std::vector<Vec<mpfr> > solutions;
-	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
-	{
-		auto start_point = TD.StartPoint<mpfr>(ii);
 
-		Vec<mpfr> result;
-		SuccessCode tracking_success = tracker.TrackPath(result,t_start,t_end,start_point);
-		BOOST_CHECK(tracking_success==SuccessCode::Success);
-		BOOST_CHECK_EQUAL(DefaultPrecision(),30);
-		solutions.push_back(final_system.DehomogenizePoint(result));
-	}
+	newton_preferences.max_num_newton_iterations = 6;
 
-	Vec<mpfr> solution_1(2);
-	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-30"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
 
-	Vec<mpfr> solution_2(2);
-	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+	tracker.PrecisionSetup(AMP);
 
-	unsigned num_occurences(0);
-	for (auto s : solutions)
-	{
-		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
-			num_occurences++;
-	}
-	BOOST_CHECK_EQUAL(num_occurences,1);
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	mpfr_float::default_precision(30);
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
 
-	num_occurences = 0;
-	for (auto s : solutions)
-	{
-		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
-			num_occurences++;
-	}
-	BOOST_CHECK_EQUAL(num_occurences,1);
-}
+	SuccessCode tracking_success;
 
 
+	start_point << mpfr(1), mpfr("1.41421356237309504880168872421");
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
 
-std::vector<Vec<mpfr> > track_total_degree(bertini::tracking::AMPTracker const& tracker, bertini::start_system::TotalDegree const& TD)
-{
-	auto initial_precision = DefaultPrecision();
-	using namespace bertini::tracking;
-	mpfr t_start(1), t_end(0);
-	std::vector<Vec<mpfr> > solutions;
-	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
-	{
-		auto start_point = TD.StartPoint<mpfr>(ii);
+	mpfr_float::default_precision(40);
 
-		Vec<mpfr> result;
-		SuccessCode tracking_success;
+	Vec<mpfr> true_solution(2);
+	true_solution <<  mpfr("0.61803398874989484820458683436563811772030918"), mpfr("1.13856426511017256414753784441721594451116198");
 
-		tracking_success = tracker.TrackPath(result,t_start,t_end,start_point);
-		BOOST_CHECK(tracking_success==SuccessCode::Success);
-		solutions.push_back(tracker.GetSystem().DehomogenizePoint(result));
-	}
 
-	return solutions;
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-true_solution(0)) < 1e-30);
+	BOOST_CHECK(abs(end_point(1)-true_solution(1)) < 1e-30);
+
+	BOOST_CHECK( (end_point - true_solution).norm() < 1e-30);
 }
 
-BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
+
+
+BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision30)
 {
-	using namespace bertini::tracking;
 	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
 
 	Var x = std::make_shared<Variable>("x");
 	Var y = std::make_shared<Variable>("y");
@@ -862,8 +1011,205 @@ BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
 
 	VariableGroup v{x,y};
 
-	sys.AddVariableGroup(v);
-
+	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	SuccessCode tracking_success;
+	tracker.PrecisionPreservation(true);
+
+	start_point << mpfr(1), mpfr("1.414");
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision100)
+{
+	mpfr_float::default_precision(100);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+	tracker.PrecisionPreservation(true);
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	SuccessCode tracking_success;
+
+
+	start_point << mpfr(1), mpfr("1.414");
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),100);
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+}
+
+
+
+
+
+
+
+/*
+5.  Goal:  Fail when running into a singularity.
+Expected Behavior:  Path failure near t=0.5.
+Note:  There's a parameter in this system, which depends on the path variable.  This implicitly checks that functionality.
+System:
+  s= -1*(1-t) + 1*t;
+ f = x^2-s;
+ g = y^2-s;
+Start t:  1
+Start point:  (1,1)
+End t:  0
+End point:  N/A (Path should fail at t=0.5)
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_fails_with_singularity_on_path)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	auto s = -1*(1-t) + 1*t;
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(pow(x,2) - s);
+	sys.AddFunction(pow(y,2) - s);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+	tracker.PrecisionPreservation(true);
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	start_point << mpfr(1), mpfr(1);
+	SuccessCode tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success!=SuccessCode::Success);
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+}
+
+
+// has two solutions:
+//
+// 1.
+// x = -0.61803398874989484820458683
+// y = 1.6180339887498948482045868
+//
+// 2. 
+// x = 0.16180339887498948482045868
+// y = -0.6180339887498948482045868
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_track_total_degree_start_system)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
 	sys.AddFunction(x*y+1);
 	sys.AddFunction(x+y-1);
 	sys.Homogenize();
@@ -889,12 +1235,21 @@ BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
 	              	mpfr_float("1e-5"), mpfr_float("1e5"),
 					stepping_preferences, newton_preferences);
 	
-	auto AMP = bertini::tracking::config::AMPConfigFrom(final_system);
-	tracker.PrecisionSetup(AMP);
+	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
 	tracker.PrecisionPreservation(true);
-	auto solutions = track_total_degree(tracker, TD);
+	mpfr t_start(1), t_end(0);
+	std::vector<Vec<mpfr> > solutions;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		auto start_point = TD.StartPoint<mpfr>(ii);
+
+		Vec<mpfr> result;
+		SuccessCode tracking_success = tracker.TrackPath(result,t_start,t_end,start_point);
+		BOOST_CHECK(tracking_success==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+		solutions.push_back(final_system.DehomogenizePoint(result));
+	}
 
-	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
 	Vec<mpfr> solution_1(2);
 	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
 
@@ -919,6 +1274,1902 @@ BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(AMP_switches_patch_when_coordinates_grow)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System target;
+	target.AddVariableGroup(VariableGroup{x});
+	target.AddFunction(x - 1000001);
+	target.Homogenize();
+	target.AutoPatch();
+
+	// the homogenizing variable is first
+	auto h = target.Variables()[0];
+	System start;
+	start.CopyVariableStructure(target);
+	start.AddFunction(x - h);
+
+	auto final_system = (1-t)*target + t*start;
+	final_system.AddPathVariable(t);
+
+	// on the patch h = 1, x grows from 1 to 1000001 along the path
+	auto sizes = final_system.GetPatch().VariableGroupSizes();
+	auto original = bertini::Patch::Coordinate(sizes, std::vector<unsigned>{0});
+	final_system.SetPatch(original);
+
+	auto tracker = AMPTracker(final_system);
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::RK4,
+	              	mpfr_float("1e-8"), mpfr_float("1e10"),
+					stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
+
+	config::PatchSwitching<mpfr_float> switching;
+	switching.max_norm = mpfr_float(1000);
+	tracker.SetPatchSwitching(switching);
+
+	Vec<mpfr> start_point(2), result;
+	start_point << mpfr(1), mpfr(1);
+
+	BOOST_REQUIRE(tracker.TrackPath(result, mpfr(1), mpfr(0), start_point)==SuccessCode::Success);
+	BOOST_CHECK(tracker.NumPatchSwitches() >= 1);
+
+	// back on the patch the path started on, as is the system
+	BOOST_CHECK(final_system.GetPatch()==original);
+	BOOST_CHECK(abs(result(0) - mpfr(1)) < 1e-6);
+	BOOST_CHECK(abs(result(1) - mpfr(1000001)) < 1e-6*1000001);
+}
+
+
+
+std::vector<Vec<mpfr> > track_total_degree(bertini::tracking::AMPTracker const& tracker, bertini::start_system::TotalDegree const& TD)
+{
+	auto initial_precision = DefaultPrecision();
+	using namespace bertini::tracking;
+	mpfr t_start(1), t_end(0);
+	std::vector<Vec<mpfr> > solutions;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		auto start_point = TD.StartPoint<mpfr>(ii);
+
+		Vec<mpfr> result;
+		SuccessCode tracking_success;
+
+		tracking_success = tracker.TrackPath(result,t_start,t_end,start_point);
+		BOOST_CHECK(tracking_success==SuccessCode::Success);
+		solutions.push_back(tracker.GetSystem().DehomogenizePoint(result));
+	}
+
+	return solutions;
+}
+
+BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	BOOST_CHECK(sys.IsHomogeneous());
+	BOOST_CHECK(sys.IsPatched());	
+
+	
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+	BOOST_CHECK(TD.IsHomogeneous());
+	BOOST_CHECK(TD.IsPatched());
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	auto tracker = AMPTracker(final_system);
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"), mpfr_float("1e5"),
+					stepping_preferences, newton_preferences);
+	
+	auto AMP = bertini::tracking::config::AMPConfigFrom(final_system);
+	tracker.PrecisionSetup(AMP);
+	tracker.PrecisionPreservation(true);
+	auto solutions = track_total_degree(tracker, TD);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_occurences(0);
+	for (auto s : solutions)
+	{
+		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
+			num_occurences++;
+	}
+	BOOST_CHECK_EQUAL(num_occurences,1);
+
+	num_occurences = 0;
+	for (auto s : solutions)
+	{
+		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
+			num_occurences++;
+	}
+	BOOST_CHECK_EQUAL(num_occurences,1);
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_total_degree)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	solver.Solve();
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+	BOOST_CHECK_EQUAL(solver.Results().size(), TD.NumStartPoints());
+
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_occurences_1(0), num_occurences_2(0);
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(r.num_steps_to_boundary > 0);
+		BOOST_CHECK(r.stats.num_steps >= r.num_steps_to_boundary);
+		BOOST_CHECK(r.stats.num_newton_iterations > 0);
+		BOOST_CHECK(r.stats.num_jacobian_evaluations > 0);
+		BOOST_CHECK(r.stats.num_factorizations > 0);
+		BOOST_CHECK(r.stats.max_precision >= r.precision_at_boundary);
+		if ( (r.solution-solution_1).norm() < mpfr_float("1e-5"))
+			num_occurences_1++;
+		if ( (r.solution-solution_2).norm() < mpfr_float("1e-5"))
+			num_occurences_2++;
+	}
+	BOOST_CHECK_EQUAL(num_occurences_1,1);
+	BOOST_CHECK_EQUAL(num_occurences_2,1);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_pinned_threads)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	// threads are placed on the cpus of each node in turn, and wrap around when there are more threads than cpus
+	bertini::detail::CpuTopology two_nodes;
+	two_nodes.node_cpus = {{0,1},{4}};
+	auto slots = bertini::detail::PlaceThreads(two_nodes, 4, true);
+	BOOST_CHECK_EQUAL(slots[0].cpu, 0);
+	BOOST_CHECK_EQUAL(slots[1].cpu, 4);
+	BOOST_CHECK_EQUAL(slots[1].node, 1);
+	BOOST_CHECK_EQUAL(slots[2].cpu, 1);
+	BOOST_CHECK_EQUAL(slots[3].cpu, 0);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 3);
+
+	config::ThreadPlacement placement;
+	placement.pinning = config::ThreadPinning::Spread;
+	solver.SetThreadPlacement(placement);
+	solver.Solve();
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+	BOOST_CHECK_EQUAL(solver.ThreadSlots().size(), 3);
+	for (auto const& slot : solver.ThreadSlots())
+		BOOST_CHECK(slot.cpu >= 0);
+	BOOST_CHECK(solver.NumRemoteSteals() <= solver.NumSteals());
+
+	BOOST_CHECK_EQUAL(solver.Results().size(), TD.NumStartPoints());
+	for (auto const& r : solver.Results())
+		BOOST_CHECK(r.success==SuccessCode::Success);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_starts_expensive_paths_first)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 1);
+
+	// with one thread, the first step recorded is of the first path started
+	auto first_path_started = [&solver]()
+		{
+			auto trace = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_path_order_test_%%%%-%%%%");
+			solver.SetStepTraceFile(trace);
+			solver.Solve();
+			solver.SetStepTraceFile(boost::filesystem::path());
+			auto records = ReadStepTrace(trace);
+			boost::filesystem::remove(trace);
+			return records.empty() ? std::uint64_t(-1) : records.front().path;
+		};
+
+	BOOST_CHECK_EQUAL(first_path_started(), 0);
+
+	solver.SetPathCosts({1, 5});
+	BOOST_CHECK_EQUAL(first_path_started(), 1);
+
+	solver.SetPathCosts({});
+	solver.SetPathCostPrediction(true);
+	solver.Solve();
+	BOOST_CHECK_EQUAL(solver.Results().size(), TD.NumStartPoints());
+	for (auto const& r : solver.Results())
+		BOOST_CHECK(r.success==SuccessCode::Success);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_retries_failed_paths)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	// too few steps for any path to reach the endgame boundary
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			stepping_preferences.max_num_steps = 2;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	config::Retry<mpfr_float> same, more_steps;
+	same.max_num_steps_factor = 1;
+	more_steps.max_num_steps_factor = 1000;
+	more_steps.change_predictor = true;
+	more_steps.predictor = config::Predictor::RK4;
+	solver.SetRetryLadder({same, more_steps});
+	solver.Solve();
+
+	BOOST_CHECK_EQUAL(solver.NumRetried(), TD.NumStartPoints());
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(r.first_failure==SuccessCode::MaxNumStepsTaken);
+		BOOST_CHECK_EQUAL(r.num_retries, 2);
+	}
+
+	// the trackers are set back after each try
+	solver.SetRetryLadder({});
+	solver.Solve();
+	BOOST_CHECK_EQUAL(solver.NumRetried(), 0);
+	for (auto const& r : solver.Results())
+		BOOST_CHECK(r.success==SuccessCode::MaxNumStepsTaken);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_resumes_from_checkpoint)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto setup = [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		};
+
+	auto log = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_test_%%%%-%%%%");
+
+	ParallelSolver<AMPTracker> first_run(sys, TD, setup, 2);
+	first_run.SetCheckpointFile(log, 0); // checkpoint after every step
+	first_run.Solve();
+	BOOST_CHECK_EQUAL(first_run.NumResumed(), 0);
+
+	// an entry cut off by the process being killed is ignored
+	{
+		std::ofstream out(log.string(), std::ios::binary | std::ios::app);
+		out << "\x01\x40";
+	}
+
+	ParallelSolver<AMPTracker> second_run(sys, TD, setup, 2);
+	second_run.SetCheckpointFile(log);
+	second_run.Solve();
+
+	BOOST_CHECK_EQUAL(second_run.NumResumed(), TD.NumStartPoints());
+	BOOST_REQUIRE_EQUAL(second_run.Results().size(), first_run.Results().size());
+	for (size_t ii = 0; ii < first_run.Results().size(); ++ii)
+	{
+		auto const& a = first_run.Results()[ii];
+		auto const& b = second_run.Results()[ii];
+		BOOST_CHECK_EQUAL(a.path, b.path);
+		BOOST_CHECK(a.success==b.success);
+		BOOST_CHECK_EQUAL(a.num_steps_to_boundary, b.num_steps_to_boundary);
+		BOOST_CHECK(a.solution==b.solution);
+	}
+
+	boost::filesystem::remove(log);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_warm_starts_endgames_from_hints)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto setup = [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		};
+
+	ParallelSolver<AMPTracker> cold(sys, TD, setup, 2);
+	cold.Solve();
+
+	std::vector<EndgameHint> hints;
+	for (auto const& r : cold.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(r.endgame_hint.cycle_number, 1);
+		BOOST_CHECK(r.endgame_hint.start_time > 0);
+		hints.push_back(r.endgame_hint);
+	}
+
+	ParallelSolver<AMPTracker> warm(sys, TD, setup, 2);
+	warm.SetEndgameHints(hints);
+	warm.Solve();
+
+	BOOST_REQUIRE_EQUAL(warm.Results().size(), cold.Results().size());
+	unsigned num_cold_samples = 0, num_warm_samples = 0;
+	for (size_t ii = 0; ii < cold.Results().size(); ++ii)
+	{
+		auto const& a = cold.Results()[ii];
+		auto const& b = warm.Results()[ii];
+		BOOST_CHECK(b.success==SuccessCode::Success);
+		BOOST_CHECK((a.solution-b.solution).norm() < mpfr_float("1e-10"));
+		num_cold_samples += a.endgame_stats.num_samples;
+		num_warm_samples += b.endgame_stats.num_samples;
+	}
+	BOOST_CHECK(num_warm_samples <= num_cold_samples);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_hands_off_to_endgame_per_path)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction((x-1)*pow(x-2,2));
+	sys.AddFunction(y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	config::EndgameHandoff handoff;
+	handoff.automatic = true;
+	solver.SetEndgameBoundary(mpfr("0.5"));
+	solver.SetEndgameHandoff(handoff);
+	solver.Solve();
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+	BOOST_REQUIRE_EQUAL(solver.Results().size(), 3);
+
+	Vec<mpfr> simple(2), double_root(2);
+	simple << mpfr("1"), mpfr("1");
+	double_root << mpfr("2"), mpfr("1");
+
+	unsigned num_simple = 0, num_double = 0;
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(abs(r.boundary_time) <= mpfr_float("0.5"));
+		if ( (r.solution-simple).norm() < mpfr_float("1e-8"))
+		{
+			// nonsingular, so tracked to 0 and refined, with no endgame
+			++num_simple;
+			BOOST_CHECK(r.boundary_time==mpfr(0));
+			BOOST_CHECK_EQUAL(r.cycle_number, 1);
+			BOOST_CHECK_EQUAL(r.endgame_stats.num_samples, 0);
+		}
+		else if ( (r.solution-double_root).norm() < mpfr_float("1e-4"))
+		{
+			++num_double;
+			BOOST_CHECK(abs(r.boundary_time) > 0);
+		}
+	}
+	BOOST_CHECK_EQUAL(num_simple, 1);
+	BOOST_CHECK_EQUAL(num_double, 2);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_retracks_only_crossed_paths)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto setup = [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		};
+
+	ParallelSolver<AMPTracker> clean(sys, TD, setup, 2);
+	clean.Solve();
+	BOOST_CHECK_EQUAL(clean.NumRetracked(), 0);
+
+	// a boundary tolerance wider than the distance between the paths makes every pair look crossed
+	ParallelSolver<AMPTracker> crossed(sys, TD, setup, 2);
+	config::PathCrossing<mpfr_float> settings;
+	settings.boundary_tolerance = mpfr_float("1e10");
+	settings.max_num_retracks = 1;
+	crossed.SetPathCrossing(settings);
+	crossed.Solve();
+
+	BOOST_CHECK_EQUAL(crossed.NumRetracked(), TD.NumStartPoints());
+	BOOST_REQUIRE_EQUAL(crossed.Results().size(), clean.Results().size());
+	for (size_t ii = 0; ii < clean.Results().size(); ++ii)
+	{
+		auto const& a = clean.Results()[ii];
+		auto const& b = crossed.Results()[ii];
+		BOOST_CHECK_EQUAL(b.num_retracks, 1);
+		BOOST_CHECK(b.success==SuccessCode::Success);
+		BOOST_CHECK((a.solution-b.solution).norm() < mpfr_float("1e-5"));
+		// tighter settings take more steps
+		BOOST_CHECK(b.num_steps_to_boundary >= a.num_steps_to_boundary);
+	}
+
+	// and the trackers are set back after, so a second solve matches the first
+	settings.max_num_retracks = 0;
+	crossed.SetPathCrossing(settings);
+	crossed.Solve();
+	for (size_t ii = 0; ii < clean.Results().size(); ++ii)
+		BOOST_CHECK_EQUAL(crossed.Results()[ii].num_steps_to_boundary, clean.Results()[ii].num_steps_to_boundary);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(cluster_solutions_of_parallel_solve)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::Euler,
+			              	mpfr_float("1e-5"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+	solver.Solve();
+
+	auto solutions = ClusterResults(solver.Results(), config::PostProcessing<mpfr_float>(), 2);
+	BOOST_REQUIRE_EQUAL(solutions.size(), 2);
+	for (auto const& s : solutions)
+	{
+		BOOST_CHECK_EQUAL(s.multiplicity, 1);
+		BOOST_CHECK(s.is_real);
+		BOOST_CHECK(s.is_finite);
+		BOOST_CHECK(!s.is_singular);
+	}
+
+	// endpoints repeated, as by paths ending at a double root, are one singular solution
+	std::vector<Vec<mpfr>> endpoints;
+	for (auto const& r : solver.Results())
+		endpoints.push_back(r.solution);
+	endpoints.push_back(solver.Results()[0].solution);
+	endpoints.push_back(Vec<mpfr>());
+
+	auto clustered = ClusterSolutions(endpoints, std::vector<unsigned>(), config::PostProcessing<mpfr_float>());
+	BOOST_REQUIRE_EQUAL(clustered.size(), 2);
+	BOOST_CHECK_EQUAL(clustered[0].multiplicity, 2);
+	BOOST_CHECK(clustered[0].is_singular);
+	BOOST_CHECK(clustered[0].paths==std::vector<size_t>({0,2}));
+	BOOST_CHECK_EQUAL(clustered[1].multiplicity, 1);
+	BOOST_CHECK(!clustered[1].is_singular);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(krawczyk_certifies_nonsingular_roots_only)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*x + y*y - 2);
+	sys.AddFunction(x - exp(y-1));
+
+	Vec<dbl> near(2);
+	near << dbl(1+1e-10, -1e-10), dbl(1-1e-10, 0);
+	auto c = Krawczyk(sys, near);
+	BOOST_CHECK(c.certified);
+	BOOST_CHECK(c.radius < 1e-9);
+
+	Vec<mpfr> near_mp(2);
+	near_mp << mpfr("1.00000000000000000001","0"), mpfr("1","-1e-20");
+	auto c_mp = Krawczyk(sys, near_mp);
+	BOOST_CHECK(c_mp.certified);
+	BOOST_CHECK(c_mp.radius < 1e-19);
+
+	Vec<dbl> far(2);
+	far << dbl(2,1), dbl(-1,0.5);
+	BOOST_CHECK(!Krawczyk(sys, far).certified);
+
+	// a double root is never certified, however near
+	System singular;
+	singular.AddVariableGroup(VariableGroup{x,y});
+	singular.AddFunction(pow(x-1,2));
+	singular.AddFunction(y-1);
+	BOOST_CHECK(!Krawczyk(singular, near).certified);
+
+	std::vector<Vec<dbl>> points{near, far, Vec<dbl>(), near};
+	auto certificates = CertifyPoints(sys, points, config::Certification(), 2);
+	BOOST_REQUIRE_EQUAL(certificates.size(), 4);
+	BOOST_CHECK(certificates[0].certified);
+	BOOST_CHECK(!certificates[1].certified);
+	BOOST_CHECK(!certificates[2].certified);
+	BOOST_CHECK(certificates[3].certified);
+	BOOST_CHECK_EQUAL(certificates[0].radius, c.radius);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(deflation_refines_singular_roots)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	// a double root at (1,1), regular after one deflation
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x-1,2));
+	sys.AddFunction(y-x);
+
+	Vec<dbl> near(2);
+	near << dbl(1+1e-5, 2e-6), dbl(1-3e-6, 1e-6);
+	auto refined = Deflate(sys, near, 1e-11);
+	BOOST_CHECK(refined.converged);
+	BOOST_CHECK_EQUAL(refined.num_deflations, 1);
+	BOOST_CHECK((refined.point - Vec<dbl>::Ones(2)).norm() < 1e-10);
+
+	// the triple root of Griewank and Osborne, regular after two
+	System go;
+	go.AddVariableGroup(VariableGroup{x,y});
+	go.AddFunction(mpq_rational(29,16)*pow(x,3) - 2*x*y);
+	go.AddFunction(y - pow(x,2));
+
+	Vec<dbl> near_origin(2);
+	near_origin << dbl(1e-4, 1e-5), dbl(2e-5, -1e-5);
+	auto refined_go = Deflate(go, near_origin, 1e-11);
+	BOOST_CHECK(refined_go.converged);
+	BOOST_CHECK_EQUAL(refined_go.num_deflations, 2);
+	BOOST_CHECK(refined_go.point.norm() < 1e-10);
+
+	// a regular root takes plain Newton steps
+	Vec<mpfr> near_mp(2);
+	near_mp << mpfr("1.00001","0"), mpfr("0.99999","0");
+	System regular;
+	regular.AddVariableGroup(VariableGroup{x,y});
+	regular.AddFunction(x*x + y*y - 2);
+	regular.AddFunction(x - y);
+	auto refined_mp = Deflate(regular, near_mp, 1e-25);
+	BOOST_CHECK(refined_mp.converged);
+	BOOST_CHECK_EQUAL(refined_mp.num_deflations, 0);
+	BOOST_CHECK(abs(refined_mp.point(0) - mpfr(1)) < mpfr_float("1e-25"));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(sharpen_doubles_precision_to_many_digits)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*x - 2);
+	sys.AddFunction(x*y - 1);
+
+	Vec<mpfr> approx(2);
+	approx << mpfr("1.41421356237","1e-11"), mpfr("0.70710678118","0");
+	auto sharpened = Sharpen(sys, approx, 100);
+	BOOST_CHECK(sharpened.converged);
+	BOOST_CHECK(sharpened.digits >= 100);
+	BOOST_CHECK(sharpened.num_jacobians <= sharpened.num_iterations);
+	BOOST_CHECK(sharpened.final_precision > 100);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_CHECK_EQUAL(sys.precision(), 30);
+
+	DefaultPrecision(sharpened.final_precision);
+	mpfr_float root_2 = sqrt(mpfr_float(2));
+	BOOST_CHECK(abs(approx(0) - mpfr(root_2)) < mpfr_float("1e-100"));
+	BOOST_CHECK(abs(approx(1) - mpfr(root_2/2)) < mpfr_float("1e-100"));
+	DefaultPrecision(30);
+
+	// a double root does not sharpen, and is left as it was
+	System singular;
+	singular.AddVariableGroup(VariableGroup{x,y});
+	singular.AddFunction(pow(x-1,2));
+	singular.AddFunction(y-1);
+	Vec<mpfr> near(2);
+	near << mpfr("1.000001","0"), mpfr("1","0");
+	Vec<mpfr> near_copy = near;
+	BOOST_CHECK(!Sharpen(singular, near, 100).converged);
+	BOOST_CHECK(near==near_copy);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(bundle_tracker_total_degree)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	BundleTracker bundle(final_system);
+	bundle.Setup(1e-5, config::Stepping<double>(), config::Newton());
+
+	auto tracker = AMPTracker(final_system);
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"), mpfr_float("1e5"),
+					stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
+
+	std::vector<Vec<mpfr> > start_points;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+		start_points.push_back(TD.StartPoint<mpfr>(ii));
+
+	std::vector<Vec<mpfr> > results;
+	auto codes = TrackBundle(bundle, tracker, results, mpfr(1), mpfr(0), start_points);
+
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_occurences_1(0), num_occurences_2(0);
+	for (unsigned ii = 0; ii < results.size(); ++ii)
+	{
+		BOOST_CHECK(codes[ii]==SuccessCode::Success);
+		auto s = final_system.DehomogenizePoint(results[ii]);
+		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
+			num_occurences_1++;
+		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
+			num_occurences_2++;
+	}
+	BOOST_CHECK_EQUAL(num_occurences_1,1);
+	BOOST_CHECK_EQUAL(num_occurences_2,1);
+}
+
+
+
+// gives up on every lane, as a device backend would on paths it cannot handle in double precision
+class RejectingBundleBackend : public bertini::tracking::BundleBackend
+{
+public:
+	void Step(Mat<dbl> const& X, dbl const& t, dbl const& delta_t, dbl const& t_next, Mat<dbl> & X_next,
+	          std::vector<bool> & converged, std::vector<bertini::tracking::SuccessCode> & failures,
+	          double tracking_tolerance, bertini::tracking::config::Newton const& newton) override
+	{
+		++num_steps;
+		X_next = X;
+		converged.assign(X.cols(), false);
+		failures.assign(X.cols(), bertini::tracking::SuccessCode::HigherPrecisionNecessary);
+	}
+
+	unsigned num_steps = 0;
+};
+
+BOOST_AUTO_TEST_CASE(bundle_tracker_backend_lanes_finished_by_amp_tracker)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	BOOST_CHECK_EQUAL(final_system.CompiledVariableRegisters().size(), final_system.NumVariables());
+	BOOST_CHECK(final_system.CompiledPathVariableRegister() >= 0);
+	BOOST_CHECK_EQUAL(final_system.CompiledProgram().OutputRegisters().size(), final_system.NumTotalFunctions());
+
+	auto backend = std::make_shared<RejectingBundleBackend>();
+	BundleTracker bundle(final_system);
+	bundle.Setup(1e-5, config::Stepping<double>(), config::Newton());
+	bundle.SetBackend(backend);
+
+	auto tracker = AMPTracker(final_system);
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"), mpfr_float("1e5"),
+					stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
+
+	std::vector<Vec<mpfr> > start_points;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+		start_points.push_back(TD.StartPoint<mpfr>(ii));
+
+	std::vector<Vec<mpfr> > results;
+	auto codes = TrackBundle(bundle, tracker, results, mpfr(1), mpfr(0), start_points);
+
+	BOOST_CHECK_EQUAL(backend->num_steps, 1);
+
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_occurences_1(0), num_occurences_2(0);
+	for (unsigned ii = 0; ii < results.size(); ++ii)
+	{
+		BOOST_CHECK(codes[ii]==SuccessCode::Success);
+		auto s = final_system.DehomogenizePoint(results[ii]);
+		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
+			num_occurences_1++;
+		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
+			num_occurences_2++;
+	}
+	BOOST_CHECK_EQUAL(num_occurences_1,1);
+	BOOST_CHECK_EQUAL(num_occurences_2,1);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_time_breakdown_off_by_default_and_accumulates_when_on)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	auto tracker = AMPTracker(final_system);
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"), mpfr_float("1e5"),
+					stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(bertini::tracking::config::AMPConfigFrom(final_system));
+
+	BOOST_CHECK(!tracker.TimeBreakdownEnabled());
+	track_total_degree(tracker, TD);
+	BOOST_CHECK_EQUAL(tracker.SecondsIn(TimedWork::JacobianEvaluation), 0);
+	BOOST_CHECK_EQUAL(tracker.SecondsIn(TimedWork::LinearAlgebra), 0);
+
+	tracker.EnableTimeBreakdown(true);
+	track_total_degree(tracker, TD);
+	BOOST_CHECK(tracker.SecondsIn(TimedWork::JacobianEvaluation) > 0);
+	BOOST_CHECK(tracker.SecondsIn(TimedWork::LinearAlgebra) > 0);
+	BOOST_CHECK(tracker.SecondsIn(TimedWork::AMPCriteria) > 0);
+
+	tracker.ResetTimeBreakdown();
+	for (unsigned ii = 0; ii < TimeBreakdown::NumKinds; ++ii)
+		BOOST_CHECK_EQUAL(tracker.GetTimeBreakdown().Seconds(static_cast<TimedWork>(ii)), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(polyhedral_start_system_solves_sparse_system)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x + pow(y,3) - 2);
+
+	// the total degree is 6, but x = 1/y leaves y^4 - 2y + 1 = 0
+	bertini::start_system::Polyhedral G(sys, 2);
+	BOOST_CHECK_EQUAL(G.MixedVolume(), 4);
+	BOOST_CHECK_EQUAL(G.NumStartPoints(), 0);
+
+	auto setup = [](AMPTracker & tracker, System const& homotopy)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(homotopy));
+		};
+
+	auto num_failed = SolvePolyhedral<AMPTracker>(G, setup);
+	BOOST_CHECK_EQUAL(num_failed, 0);
+	BOOST_REQUIRE_EQUAL(G.NumStartPoints(), 4);
+	for (unsigned ii = 0; ii < 4; ++ii)
+		BOOST_CHECK(G.Eval(G.StartPoint<mpfr>(ii)).norm() < 1e-10);
+
+	ParallelSolver<AMPTracker> solver(sys, G, [&setup](AMPTracker & tracker)
+		{
+			setup(tracker, tracker.GetSystem());
+		}, 2);
+	solver.Solve();
+
+	BOOST_REQUIRE_EQUAL(solver.Results().size(), 4);
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(sys.Eval(r.solution).norm() < 1e-10);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_parameter_homotopy_sweep)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	auto a = std::make_shared<bertini::node::Function>("a");
+	auto b = std::make_shared<bertini::node::Function>("b");
+	a->SetRoot(std::make_shared<bertini::node::Float>("1"));
+	b->SetRoot(std::make_shared<bertini::node::Float>("1"));
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(a);
+	family.AddParameter(b);
+	family.AddFunction(x*x - a);
+	family.AddFunction(x*y - b);
+
+	Vec<mpfr> start_parameters(2);
+	start_parameters << mpfr(1), mpfr(1);
+	bertini::ParameterHomotopy H(family, start_parameters);
+
+	BOOST_CHECK_EQUAL(H.Homotopy().NumImplicitParameters(), 2);
+	BOOST_CHECK(H.Homotopy().HavePathVariable());
+	BOOST_CHECK_EQUAL(family.NumImplicitParameters(), 0);
+	BOOST_CHECK(!family.HavePathVariable());
+
+	// two paths, rather than the total degree of 4
+	std::vector<Vec<mpfr>> start_solutions(2, Vec<mpfr>(2));
+	start_solutions[0] << mpfr(1), mpfr(1);
+	start_solutions[1] << mpfr(-1), mpfr(-1);
+
+	ParallelSolver<AMPTracker> solver(H, start_solutions, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	BOOST_CHECK_THROW(solver.Solve(), std::runtime_error);
+
+	std::vector<Vec<mpfr>> targets(2, Vec<mpfr>(2));
+	targets[0] << mpfr(4), mpfr(2);
+	targets[1] << mpfr(9), mpfr(-3);
+
+	for (auto const& p : targets)
+	{
+		solver.SetImplicitParameters(p);
+		solver.Solve();
+
+		BOOST_REQUIRE_EQUAL(solver.Results().size(), 2);
+		for (auto const& r : solver.Results())
+		{
+			BOOST_CHECK(r.success==SuccessCode::Success);
+			auto const& s = r.solution;
+			BOOST_CHECK(abs(s(0)*s(0) - p(0)) < 1e-10);
+			BOOST_CHECK(abs(s(0)*s(1) - p(1)) < 1e-10);
+		}
+		BOOST_CHECK(abs(solver.Results()[0].solution(0) + solver.Results()[1].solution(0)) < 1e-10);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parameter_sensitivity_at_target_of_parameter_homotopy)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	auto a = std::make_shared<bertini::node::Function>("a");
+	auto b = std::make_shared<bertini::node::Function>("b");
+	a->SetRoot(std::make_shared<bertini::node::Float>("1"));
+	b->SetRoot(std::make_shared<bertini::node::Float>("1"));
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(a);
+	family.AddParameter(b);
+	family.AddFunction(x*x - a);
+	family.AddFunction(x*y - b);
+
+	Vec<mpfr> start_parameters(2);
+	start_parameters << mpfr(1), mpfr(1);
+	bertini::ParameterHomotopy H(family, start_parameters);
+
+	Vec<mpfr> target(2);
+	target << mpfr(4), mpfr(2);
+	H.Homotopy().SetImplicitParameters(target);
+
+	AMPTracker tracker(H.Homotopy());
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	tracker.Setup(config::Predictor::RK4,
+	              	mpfr_float("1e-12"), mpfr_float("1e5"),
+					stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(config::AMPConfigFrom(H.Homotopy()));
+
+	// x = sqrt(a), y = b/x, so dx/da = 1/(2x), dx/db = 0, dy/da = -b/(2x^3), dy/db = 1/x
+	Mat<mpfr> expected(2,2);
+	expected << mpfr("0.25"), mpfr(0), mpfr("-0.125"), mpfr("0.5");
+
+	Vec<mpfr> endpoint(2), refined;
+	endpoint << mpfr("2.0001"), mpfr("0.9999");
+	Mat<mpfr> dx_dp;
+	BOOST_REQUIRE(tracker.ParameterSensitivity(dx_dp, refined, endpoint, mpfr(0))==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(dx_dp.rows(), 2);
+	BOOST_CHECK_EQUAL(dx_dp.cols(), 2);
+	BOOST_CHECK(abs(refined(0) - mpfr(2)) < 1e-10);
+	BOOST_CHECK(abs(refined(1) - mpfr(1)) < 1e-10);
+	BOOST_CHECK((dx_dp - expected).norm() < 1e-8);
+
+	Vec<dbl> endpoint_d(2), refined_d;
+	endpoint_d << dbl(2.0001), dbl(0.9999);
+	Mat<dbl> dx_dp_d;
+	BOOST_REQUIRE(tracker.ParameterSensitivity(dx_dp_d, refined_d, endpoint_d, dbl(0))==SuccessCode::Success);
+	BOOST_CHECK((dx_dp_d - expected.cast<dbl>()).norm() < 1e-8);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_solution_cache_warm_starts_parameter_homotopy)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	auto a = std::make_shared<bertini::node::Function>("a");
+	auto b = std::make_shared<bertini::node::Function>("b");
+	a->SetRoot(std::make_shared<bertini::node::Float>("1"));
+	b->SetRoot(std::make_shared<bertini::node::Float>("1"));
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(a);
+	family.AddParameter(b);
+	family.AddFunction(x*x - a);
+	family.AddFunction(x*y - b);
+
+	const auto model = family.StructuralHash();
+	bertini::SolutionCache<mpfr> cache(10);
+
+	Vec<mpfr> near(2), far(2);
+	near << mpfr(1), mpfr(1);
+	far << mpfr(100), mpfr(-100);
+	std::vector<Vec<mpfr>> near_solutions(2, Vec<mpfr>(2)), far_solutions(2, Vec<mpfr>(2));
+	near_solutions[0] << mpfr(1), mpfr(1);
+	near_solutions[1] << mpfr(-1), mpfr(-1);
+	far_solutions[0] << mpfr(10), mpfr(-10);
+	far_solutions[1] << mpfr(-10), mpfr(10);
+	cache.Insert(model, near, near_solutions);
+	cache.Insert(model, far, far_solutions);
+
+	Vec<mpfr> p(2);
+	p << mpfr(4), mpfr(2);
+	BOOST_CHECK(!cache.Find(model, p));
+	BOOST_CHECK(!cache.Nearest(model + 1, p));
+
+	auto start = cache.Nearest(model, p);
+	BOOST_REQUIRE(start);
+	BOOST_CHECK(start->parameters==near);
+
+	bertini::ParameterHomotopy H(family, start->parameters);
+	ParallelSolver<AMPTracker> solver(H, start->solutions, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+	solver.SetImplicitParameters(p);
+	solver.Solve();
+
+	std::vector<Vec<mpfr>> solutions;
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(abs(r.solution(0)*r.solution(0) - p(0)) < 1e-10);
+		solutions.push_back(r.solution);
+	}
+	cache.Insert(model, p, solutions);
+
+	auto hit = cache.Find(model, p);
+	BOOST_REQUIRE(hit);
+	BOOST_CHECK_EQUAL(hit->solutions.size(), 2);
+	BOOST_CHECK_EQUAL(cache.Size(), 3);
+	BOOST_CHECK_EQUAL(cache.NumExactHits(), 1);
+	BOOST_CHECK_EQUAL(cache.NumNearestHits(), 1);
+	BOOST_CHECK_EQUAL(cache.NumMisses(), 2);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_parameter_homotopy_from_mapped_start_solutions)
+{
+	using namespace bertini::tracking;
+	namespace fs = boost::filesystem;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	auto a = std::make_shared<bertini::node::Function>("a");
+	auto b = std::make_shared<bertini::node::Function>("b");
+	a->SetRoot(std::make_shared<bertini::node::Float>("1"));
+	b->SetRoot(std::make_shared<bertini::node::Float>("1"));
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(a);
+	family.AddParameter(b);
+	family.AddFunction(x*x - a);
+	family.AddFunction(x*y - b);
+
+	// the start solutions, and a failed path, as a previous run would have written them
+	auto directory = fs::temp_directory_path() / fs::unique_path("b2_mapped_start_%%%%-%%%%");
+	{
+		SolutionWriter<mpfr> writer(directory, false, true);
+		SolutionRecord<mpfr> r;
+		r.success = SuccessCode::Success;
+		r.cycle_number = 1;
+		r.solution.resize(2);
+		r.path = 0; r.solution << mpfr(1), mpfr(1);
+		writer.Write(r);
+		r.path = 1; r.success = SuccessCode::MaxNumStepsTaken; r.solution.resize(0);
+		writer.Write(r);
+		r.path = 2; r.success = SuccessCode::Success; r.solution.resize(2); r.solution << mpfr(-1), mpfr(-1);
+		writer.Write(r);
+	}
+
+	{
+		MappedSolutionFile file(directory / "solutions.b2sol");
+		auto starts = file.View().Select([](solution_file::RecordHeader const& h){ return (h.flags & solution_file::Finite)!=0;});
+
+		Vec<mpfr> start_parameters(2);
+		start_parameters << mpfr(1), mpfr(1);
+		bertini::ParameterHomotopy H(family, start_parameters);
+
+		ParallelSolver<AMPTracker> solver(H, starts, [](AMPTracker & tracker)
+			{
+				config::Stepping<mpfr_float> stepping_preferences;
+				config::Newton newton_preferences;
+				tracker.Setup(config::Predictor::RK4,
+				              	mpfr_float("1e-6"), mpfr_float("1e5"),
+								stepping_preferences, newton_preferences);
+				tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+			}, 2);
+
+		Vec<mpfr> p(2);
+		p << mpfr(4), mpfr(2);
+		solver.SetImplicitParameters(p);
+		solver.Solve();
+
+		BOOST_REQUIRE_EQUAL(solver.Results().size(), 2);
+		for (auto const& r : solver.Results())
+		{
+			BOOST_CHECK(r.success==SuccessCode::Success);
+			BOOST_CHECK(abs(r.solution(0)*r.solution(0) - p(0)) < 1e-10);
+			BOOST_CHECK(abs(r.solution(0)*r.solution(1) - p(1)) < 1e-10);
+		}
+	}
+
+	fs::remove_all(directory);
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_monodromy_solver_finds_all_solutions_from_one)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	auto a = std::make_shared<bertini::node::Function>("a");
+	auto b = std::make_shared<bertini::node::Function>("b");
+	a->SetRoot(std::make_shared<bertini::node::Float>("1"));
+	b->SetRoot(std::make_shared<bertini::node::Float>("4"));
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(a);
+	family.AddParameter(b);
+	family.AddFunction(x*x - a);
+	family.AddFunction(y*y + x*y - b);
+
+	Vec<mpfr> base(2);
+	base << mpfr(1), mpfr(4);
+	std::vector<Vec<mpfr>> seed(1, Vec<mpfr>(2));
+	seed[0] << mpfr(1), mpfr("1.5615528128088302749107049","0"); // y^2 + y - 4
+
+	auto setup = [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		};
+
+	for (size_t target : {size_t(4), size_t(0)})
+	{
+		MonodromySolver<AMPTracker> solver(family, base, seed, setup, 2);
+		auto settings = solver.Settings();
+		settings.target_num_solutions = target;
+		solver.SetSettings(settings);
+		solver.Solve();
+
+		BOOST_CHECK_EQUAL(solver.Solutions().size(), 4);
+		BOOST_CHECK(solver.NumPathsTracked() > 0);
+		for (auto const& s : solver.Solutions())
+		{
+			BOOST_CHECK(abs(s(0)*s(0) - mpfr(1)) < 1e-10);
+			BOOST_CHECK(abs(s(1)*s(1) + s(0)*s(1) - mpfr(4)) < 1e-10);
+		}
+		if (target==0)
+			BOOST_CHECK(solver.NumParameterPoints() >= 3 + settings.max_num_stale_points);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_regeneration_drops_solutions_at_infinity)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x*y + x - 2);
+
+	// the Bezout number is 4, but the only finite solution is (1,1)
+	RegenerationSolver<AMPTracker> solver(sys, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	BOOST_CHECK_EQUAL(solver.Slices().size(), 2);
+	BOOST_CHECK_EQUAL(solver.Slices()[0].Dimension(), 2);
+
+	solver.Solve();
+
+	BOOST_REQUIRE_EQUAL(solver.NumStagePoints().size(), 3);
+	BOOST_CHECK_EQUAL(solver.NumStagePoints()[0], 1);
+	BOOST_CHECK_EQUAL(solver.NumStagePoints()[1], 2);
+	BOOST_CHECK_EQUAL(solver.NumStagePoints()[2], 1);
+
+	BOOST_REQUIRE_EQUAL(solver.Solutions().size(), 1);
+	Vec<mpfr> expected(2);
+	expected << mpfr(1), mpfr(1);
+	BOOST_CHECK((solver.Solutions()[0].solution - expected).norm() < 1e-10);
+	BOOST_CHECK(!solver.Solutions()[0].is_singular);
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_witness_sampler_moves_slice_and_tests_membership)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	VariableGroup v{x,y};
+
+	System sys;
+	sys.AddVariableGroup(v);
+	sys.AddFunction(x*x + y*y - 1);
+
+	// the circle meets the line c0 x + c1 y + k = 0 where (c0^2+c1^2) x^2 + 2 k c0 x + k^2 - c1^2 = 0
+	auto slice = bertini::LinearSlice::RandomComplex(v, 1);
+	mpfr c0 = slice.Coefficients()(0,0), c1 = slice.Coefficients()(0,1), k = slice.Constants()(0);
+	mpfr a = c0*c0 + c1*c1, b = mpfr(2)*k*c0, c = k*k - c1*c1;
+	mpfr root = sqrt(b*b - mpfr(4)*a*c);
+
+	std::vector<Vec<mpfr>> points;
+	for (auto const& r : {root, mpfr(-root)})
+	{
+		Vec<mpfr> p(2);
+		p(0) = (r - b)/(mpfr(2)*a);
+		p(1) = -(k + c0*p(0))/c1;
+		points.push_back(p);
+	}
+
+	bertini::WitnessSet witness_set(sys, slice, points);
+	BOOST_CHECK_EQUAL(witness_set.Dimension(), 1);
+	BOOST_CHECK_EQUAL(witness_set.Degree(), 2);
+	BOOST_CHECK_EQUAL(witness_set.SlicedSystem().NumTotalFunctions(), 2);
+
+	WitnessSampler<AMPTracker> sampler(witness_set, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	for (auto const& moved : sampler.Sample(2))
+	{
+		BOOST_REQUIRE_EQUAL(moved.Degree(), 2);
+		auto const& d = moved.Slice().Coefficients();
+		auto const& e = moved.Slice().Constants();
+		for (auto const& p : moved.Points())
+		{
+			BOOST_CHECK(abs(p(0)*p(0) + p(1)*p(1) - mpfr(1)) < 1e-10);
+			BOOST_CHECK(abs(d(0,0)*p(0) + d(0,1)*p(1) + e(0)) < 1e-10);
+		}
+	}
+
+	Vec<mpfr> on(2), off(2);
+	on << mpfr("0.6"), mpfr("0.8");
+	off << mpfr(1), mpfr(1);
+	BOOST_CHECK(sampler.Contains(on, mpfr_float("1e-8")));
+	BOOST_CHECK(!sampler.Contains(off, mpfr_float("1e-8")));
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_irreducible_decomposition_of_line_and_circle)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction((x - y)*(x*x + y*y - 1));
+
+	NumericalIrreducibleDecomposition<AMPTracker> decomposition(sys, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	decomposition.Decompose();
+
+	BOOST_REQUIRE_EQUAL(decomposition.PureWitnessSets().size(), 1);
+	BOOST_CHECK_EQUAL(decomposition.PureWitnessSets()[0].Dimension(), 1);
+	BOOST_CHECK_EQUAL(decomposition.PureWitnessSets()[0].Degree(), 3);
+	BOOST_CHECK_EQUAL(decomposition.NumJunkPoints(), 0);
+	BOOST_CHECK(decomposition.IsolatedSolutions().empty());
+
+	// the line, of degree 1, and the circle, of degree 2
+	BOOST_REQUIRE_EQUAL(decomposition.Components().size(), 2);
+	std::vector<size_t> degrees;
+	for (auto const& c : decomposition.Components())
+	{
+		BOOST_CHECK(c.verified);
+		BOOST_CHECK_EQUAL(c.witness_set.Dimension(), 1);
+		degrees.push_back(c.witness_set.Degree());
+	}
+	std::sort(degrees.begin(), degrees.end());
+	BOOST_CHECK_EQUAL(degrees[0], 1);
+	BOOST_CHECK_EQUAL(degrees[1], 2);
+
+	for (auto const& c : decomposition.Components())
+		for (auto const& p : c.witness_set.Points())
+			if (c.witness_set.Degree()==1)
+				BOOST_CHECK(abs(p(0) - p(1)) < 1e-10);
+			else
+				BOOST_CHECK(abs(p(0)*p(0) + p(1)*p(1) - mpfr(1)) < 1e-10);
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_straight_line_homotopy_changes_gamma)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+
+	bertini::StraightLineHomotopy H(sys, TD);
+	BOOST_CHECK_EQUAL(H.Homotopy().NumImplicitParameters(), 1);
+	BOOST_CHECK(H.Homotopy().HavePathVariable());
+	BOOST_CHECK(H.UsingClosedFormStart());
+
+	// evaluating from the separate systems agrees with the tree of the homotopy
+	Vec<dbl> v(2);
+	v << dbl(0.3,0.1), dbl(-0.7,0.2);
+	dbl t(0.4,0.05);
+	Vec<dbl> h;
+	H.EvalInPlace(h, v, t);
+	BOOST_CHECK((h - H.Homotopy().Eval(v, t)).norm() < 1e-14);
+	Mat<dbl> J;
+	H.JacobianInPlace(J, v, t);
+	BOOST_CHECK((J - H.Homotopy().Jacobian(v, t)).norm() < 1e-14);
+	Vec<dbl> ds_dt;
+	H.TimeDerivativeInPlace(ds_dt, v);
+	BOOST_CHECK((ds_dt - H.Homotopy().TimeDerivative(v, t)).norm() < 1e-14);
+
+	ParallelSolver<AMPTracker> solver(H, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	Vec<mpfr> solution_1(2), solution_2(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	Vec<mpfr> gamma(1);
+	gamma << mpfr("0.6","0.8");
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		if (ii==1)
+			solver.SetImplicitParameters(gamma);
+		solver.Solve();
+
+		unsigned num_occurences_1(0), num_occurences_2(0);
+		for (auto const& r : solver.Results())
+		{
+			BOOST_CHECK(r.success==SuccessCode::Success);
+			if ( (r.solution-solution_1).norm() < mpfr_float("1e-5"))
+				num_occurences_1++;
+			if ( (r.solution-solution_2).norm() < mpfr_float("1e-5"))
+				num_occurences_2++;
+		}
+		BOOST_CHECK_EQUAL(num_occurences_1,1);
+		BOOST_CHECK_EQUAL(num_occurences_2,1);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_sharpens_nonsingular_endpoints)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	config::Sharpening sharpening;
+	sharpening.digits = 60;
+	solver.SetSharpening(sharpening);
+	solver.Solve();
+
+	DefaultPrecision(80);
+	mpfr_float root_5 = sqrt(mpfr_float(5));
+	mpfr golden((1+root_5)/2), other((1-root_5)/2);
+	for (auto const& r : solver.Results())
+	{
+		BOOST_CHECK(r.success==SuccessCode::Success);
+		BOOST_CHECK(r.sharpened_digits >= 60);
+		BOOST_REQUIRE_EQUAL(r.solution.size(), 2);
+		mpfr_float error = std::min(mpfr_float(abs(r.solution(0)-golden) + abs(r.solution(1)-other)), mpfr_float(abs(r.solution(0)-other) + abs(r.solution(1)-golden)));
+		BOOST_CHECK(error < mpfr_float("1e-55"));
+	}
+	DefaultPrecision(30);
+}
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_stops_when_predicate_holds)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 1);
+
+	solver.SetStopWhen(StopAfterSolutions(1));
+	solver.Solve();
+
+	BOOST_CHECK(solver.StoppedEarly());
+	BOOST_CHECK_EQUAL(solver.Progress().num_finished, 1);
+	BOOST_CHECK_EQUAL(solver.Progress().num_successes, 1);
+	unsigned num_stopped = 0;
+	for (auto const& r : solver.Results())
+		if (r.success==SuccessCode::ExternallyTerminated)
+			++num_stopped;
+	BOOST_CHECK_EQUAL(num_stopped, 1);
+
+	// stopping early holds for one Solve only; the solution with positive x is the one kept at the boundary
+	solver.SetStopWhen(nullptr);
+	solver.SetBoundaryFilter([](Vec<mpfr> const& p){ return real(p(0)) > 0;});
+	solver.Solve();
+
+	BOOST_CHECK(!solver.StoppedEarly());
+	BOOST_CHECK_EQUAL(solver.Progress().num_finished, 2);
+	unsigned num_positive = 0, num_successes = 0;
+	for (auto const& r : solver.Results())
+		if (r.success==SuccessCode::Success)
+		{
+			++num_successes;
+			BOOST_CHECK(IsRealPoint(r.solution, 1e-5));
+			if (IsPositivePoint(Vec<mpfr>(r.solution.head(1)), 1e-5))
+				++num_positive;
+		}
+		else
+			BOOST_CHECK(r.success==SuccessCode::ExternallyTerminated);
+	BOOST_CHECK_EQUAL(num_successes, 1);
+	BOOST_CHECK_EQUAL(num_positive, 1);
+}
+
+BOOST_AUTO_TEST_CASE(AMP_parallel_solver_counts_live_metrics_and_writes_them)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	ParallelSolver<AMPTracker> solver(sys, TD, [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		}, 2);
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_metrics_test_%%%%-%%%%.prom");
+	solver.SetMetricsFile(file, 0.01, MetricsFormat::Prometheus);
+	solver.Solve();
+
+	auto m = solver.Metrics().Take();
+	BOOST_CHECK_EQUAL(m.num_paths, 2);
+	BOOST_CHECK_EQUAL(m.num_finished, 2);
+	BOOST_CHECK_EQUAL(m.num_in_flight, 0);
+	BOOST_CHECK_EQUAL(m.NumQueued(), 0);
+	BOOST_CHECK_EQUAL(m.NumByCode(SuccessCode::Success), 2);
+	BOOST_REQUIRE_EQUAL(m.threads.size(), 2);
+	for (auto const& t : m.threads)
+		BOOST_CHECK(t.activity==ThreadActivity::Idle);
+
+	size_t num_in_histogram = 0;
+	for (auto n : m.precision_histogram)
+		num_in_histogram += n;
+	BOOST_CHECK_EQUAL(num_in_histogram, 2);
+
+	// only successful steps are counted
+	unsigned long long num_steps = 0;
+	for (auto const& r : solver.Results())
+		num_steps += r.stats.num_steps;
+	BOOST_CHECK(m.num_steps > 0);
+	BOOST_CHECK(m.num_steps <= num_steps);
+	BOOST_CHECK(m.steps_per_second > 0);
+
+	// the file holds the final counts
+	std::ifstream in(file.string());
+	std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	BOOST_CHECK(contents.find("bertini_solve_paths_finished{code=\"Success\"} 2\n")!=std::string::npos);
+	BOOST_CHECK(contents.find("bertini_solve_paths_in_flight 0\n")!=std::string::npos);
+	BOOST_CHECK(contents.find("bertini_solve_path_precision_digits_count 2\n")!=std::string::npos);
+
+	boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(AMP_solve_async_stops_early_from_result_handler)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+
+	SolveExecutor executor(1);
+	AsyncSolveSettings<AMPTracker> settings;
+	settings.executor = &executor;
+	settings.tracker_setup = [](AMPTracker & tracker)
+		{
+			config::Stepping<mpfr_float> stepping_preferences;
+			config::Newton newton_preferences;
+			tracker.Setup(config::Predictor::RK4,
+			              	mpfr_float("1e-6"), mpfr_float("1e5"),
+							stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(config::AMPConfigFrom(tracker.GetSystem()));
+		};
+	settings.on_result = [](ParallelSolver<AMPTracker>::PathResult const& r)
+		{
+			return r.success!=SuccessCode::Success; // one solution is enough
+		};
+
+	auto handle = SolveAsync(sys, settings);
+	auto const& results = handle.Get();
+
+	BOOST_CHECK(handle.Done());
+	BOOST_CHECK(!sys.IsHomogeneous()); // the solve homogenized a copy
+	BOOST_REQUIRE_EQUAL(results.size(), 2);
+	BOOST_CHECK_EQUAL(handle.NumFinished(), 1);
+	BOOST_CHECK(handle.ResultsSoFar()[0].success==SuccessCode::Success);
+
+	unsigned num_successes = 0, num_stopped = 0;
+	for (auto const& r : results)
+	{
+		if (r.success==SuccessCode::Success)
+			++num_successes;
+		else if (r.success==SuccessCode::ExternallyTerminated)
+			++num_stopped;
+	}
+	BOOST_CHECK_EQUAL(num_successes, 1);
+	BOOST_CHECK_EQUAL(num_stopped, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
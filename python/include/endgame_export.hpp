@@ -61,6 +61,13 @@ namespace bertini{
 			using RT = typename TrackerTraits<typename EndgameT::TrackerType>::BaseRealType;
 
 			unsigned (EndgameT::*get_cycle_number_)() const = &EndgameT::CycleNumber;
+
+			// runs without the GIL, so python threads each with their own endgame run in parallel.
+			static SuccessCode Run(EndgameT & self, CT const& start_time, Vec<CT> const& start_point)
+			{
+				ReleaseGIL release;
+				return self.Run(start_time, start_point);
+			}
 		};// EndgameVisitor class
 
 
@@ -124,6 +131,8 @@ namespace bertini{
 				cl
 				.def_readwrite("level", &Security<NumT>::level,"Turns on or off truncation of paths going to infinity during the endgame.  0 is off, 1 is on.")
 				.def_readwrite("max_norm", &Security<NumT>::max_norm,"If on, the norm of which to truncate a path.")
+				.def_readwrite("early_abort_window", &Security<NumT>::early_abort_window,"The number of consecutive endgame iterations a trend must hold for before stopping early on a prediction of failure.  0 never stops early.")
+				.def_readwrite("divergence_rate", &Security<NumT>::divergence_rate,"Approximations whose norm grows at least as fast as |t|^(-divergence_rate) are judged going to infinity.")
 				;
 			}
 
@@ -163,6 +172,9 @@ namespace bertini{
 				cl
 				.def_readwrite("max_cycle_number", &config::PowerSeries::max_cycle_number,"The maximum cycle number to consider, when calculating the cycle number which best fits the path being tracked.")
 				.def_readwrite("cycle_number_amplification", &config::PowerSeries::cycle_number_amplification,"The maximum number allowable iterations during endgames, for points used to approximate the final solution.")
+				.def_readwrite("cycle_number_seed_margin", &config::PowerSeries::cycle_number_seed_margin,"How many times better than its neighbors the previous cycle number must predict the newest sample, to be kept without trying the others.  0 always tries every candidate.")
+				.def_readwrite("cycle_number_bound_for_handoff", &config::PowerSeries::cycle_number_bound_for_handoff,"Stop with CycleNumTooHigh once the upper bound on the cycle number exceeds this, so another endgame can take over.  0 never stops.")
+				.def_readwrite("stalled_approximations_for_handoff", &config::PowerSeries::stalled_approximations_for_handoff,"Stop with CycleNumTooHigh once this many successive approximations fail to get closer together.  0 never stops.")
 				;
 			}
 
@@ -187,6 +199,7 @@ namespace bertini{
 				.def_readwrite("minimum_for_c_over_k_stabilization", &config::Cauchy<NumT>::minimum_for_c_over_k_stabilization)
 				.def_readwrite("maximum_cauchy_ratio", &config::Cauchy<NumT>::maximum_cauchy_ratio)
 				.def_readwrite("fail_safe_maximum_cycle_number", &config::Cauchy<NumT>::fail_safe_maximum_cycle_number, "max number of loops before giving up." )
+				.def_readwrite("num_circle_threads", &config::Cauchy<NumT>::num_circle_threads, "threads for tracking the arcs of a loop around the origin concurrently.  1 tracks them in sequence." )
 				;
 			}
 
@@ -38,6 +38,8 @@
 #include <bertini2/eigen_extensions.hpp>
 
 #include "python_common.hpp"
+#include "numpy_export.hpp"
+#include "mpfr_array_export.hpp"
 
 #include "minieigen/src/common.hpp"
 #include "minieigen/src/converters.hpp"
@@ -58,19 +60,26 @@ namespace bertini{
 			custom_VectorAnyAny_from_sequence<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>();
 			custom_MatrixAnyAny_from_sequence<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>();
 			custom_MatrixAnyAny_from_sequence<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>();
+
+			// NumPy arrays of complex128 are copied in C++, rather than as sequences.  Registered after the above, so tried before them.
+			ExportNumpyConverters();
 			
 			
 			// Eigen Vector of type dbl or mpfr
 			class_<Eigen::Matrix<dbl,Eigen::Dynamic,1>>("VectorXd","/*TODO*/",
-														 py::init<>()).def(VectorVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,1>>());
+														 py::init<>()).def(VectorVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,1>>())
+														.def(NumpyVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,1>>());
 			class_<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>("VectorXmp","/*TODO*/",
-														py::init<>()).def(VectorVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>());
+														py::init<>()).def(VectorVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>())
+														.def(MpfrArrayVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>());
 			
 			// Eigen Matrix of type dbl or mpfr
 			class_<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>("MatrixXd","/*TODO*/",
-														py::init<>()).def(MatrixVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>());
+														py::init<>()).def(MatrixVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>())
+														.def(NumpyVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>());
 			class_<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>("MatrixXmp","/*TODO*/",
-														 py::init<>()).def(MatrixVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>());
+														 py::init<>()).def(MatrixVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>())
+														 .def(MpfrArrayVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>());
 
 		};
 		
@@ -0,0 +1,144 @@
+//This file is part of Bertini 2.
+//
+//python/mpfr_array_export.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/mpfr_array_export.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/mpfr_array_export.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//  daniel brake
+//  university of notre dame
+//
+//
+//  python/mpfr_array_export.hpp:  Header file for whole-array operations on the multiple precision Eigen vectors and matrices exposed to python.
+
+
+
+
+#ifndef BERTINI_PYTHON_MPFR_ARRAY_EXPORT_HPP
+#define BERTINI_PYTHON_MPFR_ARRAY_EXPORT_HPP
+
+#include <bertini2/eigen_extensions.hpp>
+
+#include "python_common.hpp"
+
+
+namespace bertini{
+	namespace python{
+
+		using dbl = std::complex<double>;
+		using mpfr = bertini::complex;
+
+
+		/**
+		 \brief Element-wise arithmetic, precision control, and conversion to and from double precision, for an exposed Eigen vector or matrix of mpfr.
+
+		 Each of these is one call from python, looping over the entries in C++, so that working with thousands of multiple precision numbers does not mean thousands of boxed python objects.  Conversion from double precision accepts NumPy complex128 arrays, and conversion to it gives a VectorXd or MatrixXd, which numpy.asarray views without copying.
+		 */
+		template<typename EigenT>
+		class MpfrArrayVisitor: public def_visitor<MpfrArrayVisitor<EigenT> >
+		{
+			friend class def_visitor_access;
+
+			using DoubleT = Eigen::Matrix<dbl, EigenT::RowsAtCompileTime, EigenT::ColsAtCompileTime>;
+
+		public:
+			template<class PyClass>
+			void visit(PyClass& cl) const
+			{
+				cl
+				.def("from_double", &MpfrArrayVisitor::FromDouble, "Make a multiple precision array, at the current default precision, from a double precision one, such as a complex128 numpy array.").staticmethod("from_double")
+				.def("to_double", &MpfrArrayVisitor::ToDouble, "Round to a double precision array.  numpy.asarray of the result does not copy.")
+
+				.def("cwise_product", &MpfrArrayVisitor::CwiseProduct, "The element-wise product with another array of the same shape.")
+				.def("cwise_quotient", &MpfrArrayVisitor::CwiseQuotient, "The element-wise quotient by another array of the same shape.")
+				.def("cwise_abs", &MpfrArrayVisitor::CwiseAbs, "The absolute values of the elements, as the real parts of an array of the same shape.")
+				.def("conjugate", &MpfrArrayVisitor::Conjugate, "The element-wise complex conjugate.")
+				.def("scaled", &MpfrArrayVisitor::Scaled, "Every element multiplied by a scalar.")
+
+				.def("precision", &MpfrArrayVisitor::GetPrecision, "The precision of the elements, in digits.")
+				.def("precision", &MpfrArrayVisitor::SetPrecision, "Change the precision of every element, in digits.")
+				;
+			}
+
+		private:
+
+			static EigenT FromDouble(DoubleT const& x)
+			{
+				return x.template cast<mpfr>();
+			}
+
+			static DoubleT ToDouble(EigenT const& self)
+			{
+				return self.unaryExpr([](mpfr const& z){ return static_cast<dbl>(z); });
+			}
+
+			static EigenT CwiseProduct(EigenT const& self, EigenT const& other)
+			{
+				CheckShape(self, other);
+				return self.cwiseProduct(other);
+			}
+
+			static EigenT CwiseQuotient(EigenT const& self, EigenT const& other)
+			{
+				CheckShape(self, other);
+				return self.cwiseQuotient(other);
+			}
+
+			static EigenT CwiseAbs(EigenT const& self)
+			{
+				return self.unaryExpr([](mpfr const& z){ return mpfr(abs(z), mpfr_float(0)); });
+			}
+
+			static EigenT Conjugate(EigenT const& self)
+			{
+				return self.unaryExpr([](mpfr const& z){ return conj(z); });
+			}
+
+			static EigenT Scaled(EigenT const& self, mpfr const& s)
+			{
+				return self*s;
+			}
+
+			static unsigned GetPrecision(EigenT const& self)
+			{
+				if (self.size()==0)
+					return DefaultPrecision();
+				return Precision(self);
+			}
+
+			static void SetPrecision(EigenT & self, unsigned prec)
+			{
+				Precision(self, prec);
+			}
+
+			static void CheckShape(EigenT const& a, EigenT const& b)
+			{
+				if (a.rows()!=b.rows() || a.cols()!=b.cols())
+				{
+					PyErr_SetString(PyExc_ValueError, "arrays must have the same shape for element-wise operations");
+					throw_error_already_set();
+				}
+			}
+		};
+
+	}
+}
+
+
+#endif
@@ -86,15 +86,12 @@ namespace bertini{
 			template <typename T>
 			static T Eval0(NodeBaseT& self) { return self.template Eval<T>();}
 
-			// Use templating to return member function pointer to Eval<T>
+			// Nodes are evaluated with respect to a variable by its id
 			template <typename T>
-			using Eval1_ptr = T (NodeBaseT::*)(std::shared_ptr<Variable> const&) const;
-
-			template <typename T>
-			static Eval1_ptr<T> return_Eval1_ptr()
+			static T Eval1(NodeBaseT& self, std::shared_ptr<Variable> const& diff_variable)
 			{
-				return &NodeBaseT::template Eval<T>;
-			};
+				return self.template Eval<T>(diff_variable ? diff_variable->Id() : NoVariable);
+			}
 
 
 
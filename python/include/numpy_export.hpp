@@ -0,0 +1,110 @@
+//This file is part of Bertini 2.
+//
+//python/numpy_export.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/numpy_export.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/numpy_export.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//  daniel brake
+//  university of notre dame
+//
+//
+//  python/numpy_export.hpp:  Header file for passing double precision Eigen vectors and matrices to and from NumPy without going element by element through Python.
+
+
+
+
+#ifndef BERTINI_PYTHON_NUMPY_EXPORT_HPP
+#define BERTINI_PYTHON_NUMPY_EXPORT_HPP
+
+#include <bertini2/eigen_extensions.hpp>
+
+#include "python_common.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+
+namespace bertini{
+	namespace python{
+
+		using dbl = std::complex<double>;
+
+
+		/**
+		 Register converters from any Python object exporting a buffer of complex doubles, such as a NumPy array of dtype complex128, to Eigen vectors and matrices of dbl.
+
+		 The data is copied in one pass in C++, following the strides of the buffer, rather than read element by element as a Python sequence.  A 1-D buffer converts to a vector, and a 2-D buffer to a matrix of the same shape.  Objects which are not such buffers fall through to the sequence converters.
+
+		 Must be called after the sequence converters are registered, so that these are tried first.
+		 */
+		void ExportNumpyConverters();
+
+
+		/**
+		 \brief Gives an exposed Eigen vector or matrix of dbl the NumPy array interface, so that numpy.asarray makes a view of its data rather than a copy.
+
+		 The array refers to the data of the Eigen object, and keeps the Python object alive, so it must not be resized while the array is in use.  Matrices are column major, and their arrays say so in their strides.
+		 */
+		template<typename EigenT>
+		class NumpyVisitor: public def_visitor<NumpyVisitor<EigenT> >
+		{
+			friend class def_visitor_access;
+
+		public:
+			template<class PyClass>
+			void visit(PyClass& cl) const
+			{
+				cl
+				.add_property("__array_interface__", &NumpyVisitor::ArrayInterface)
+				;
+			}
+
+		private:
+
+			static dict ArrayInterface(EigenT const& self)
+			{
+				static_assert(std::is_same<typename EigenT::Scalar, dbl>::value, "only double precision data has a NumPy array interface");
+
+				const long item = sizeof(dbl);
+				const std::uint16_t one = 1;
+				const bool little_endian = *reinterpret_cast<const unsigned char*>(&one)==1;
+
+				dict d;
+				d["version"] = 3;
+				d["typestr"] = little_endian ? "<c16" : ">c16";
+				d["data"] = make_tuple(reinterpret_cast<std::uintptr_t>(self.data()), false);
+				if (EigenT::ColsAtCompileTime==1)
+				{
+					d["shape"] = make_tuple(self.rows());
+				}
+				else
+				{
+					d["shape"] = make_tuple(self.rows(), self.cols());
+					d["strides"] = make_tuple(item, item*self.rows());
+				}
+				return d;
+			}
+		};
+
+	}
+}
+
+
+#endif
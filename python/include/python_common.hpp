@@ -49,7 +49,11 @@
 #include <boost/python/operators.hpp>
 #include <boost/operators.hpp>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 #include <sstream>
+#include <string>
 
 
 #include <bertini2/mpfr_complex.hpp>
@@ -62,4 +66,85 @@ using namespace boost::python;
 typedef bertini::mpfr_float bmp;
 
 
+namespace bertini{
+	namespace python{
+
+		/**
+		 Releases the Python GIL for its lifetime, so that other Python threads run while C++ works.  Nothing may touch a Python object while one exists.
+		 */
+		class ReleaseGIL
+		{
+		public:
+			ReleaseGIL() : state_(PyEval_SaveThread())
+			{}
+
+			~ReleaseGIL()
+			{
+				PyEval_RestoreThread(state_);
+			}
+
+			ReleaseGIL(ReleaseGIL const&) = delete;
+			ReleaseGIL& operator=(ReleaseGIL const&) = delete;
+
+		private:
+			PyThreadState* state_;
+		};
+
+
+		/**
+		 Holds the Python GIL for its lifetime, from any thread, so that C++ running on a thread of its own may call into Python.
+		 */
+		class AcquireGIL
+		{
+		public:
+			AcquireGIL() : state_(PyGILState_Ensure())
+			{}
+
+			~AcquireGIL()
+			{
+				PyGILState_Release(state_);
+			}
+
+			AcquireGIL(AcquireGIL const&) = delete;
+			AcquireGIL& operator=(AcquireGIL const&) = delete;
+
+		private:
+			PyGILState_STATE state_;
+		};
+
+
+		/**
+		 Pickles an exported type by its Boost binary serialization, as bytes.  Exact, and much faster than a text archive, since multiple precision numbers go as their limbs, but only for unpickling on the same type of machine, as with multiprocessing.  Use with def_pickle, on a class default constructed by init<>().
+		 */
+		template<typename T>
+		struct BinaryPickleSuite : pickle_suite
+		{
+			static tuple getstate(T const& self)
+			{
+				std::ostringstream buffer;
+				{
+					boost::archive::binary_oarchive ar(buffer);
+					ar << self;
+				}
+				std::string const& bytes = buffer.str();
+				return make_tuple(object(handle<>(PyBytes_FromStringAndSize(bytes.data(), bytes.size()))));
+			}
+
+			static void setstate(T & self, tuple state)
+			{
+				char* data;
+				Py_ssize_t size;
+				if (PyBytes_AsStringAndSize(object(state[0]).ptr(), &data, &size) < 0)
+					throw_error_already_set();
+
+				std::istringstream buffer(std::string(data, size));
+				boost::archive::binary_iarchive ar(buffer);
+				ar >> self;
+			}
+		};
+
+	}
+}
+
+
 #endif
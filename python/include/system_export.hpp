@@ -144,6 +144,50 @@ namespace bertini{
 				return &SystemBaseT::template Jacobian<T>;
 			};
 
+
+			static System Clone(SystemBaseT const& self)
+			{
+				return bertini::Clone(self);
+			}
+
+
+			// batched functions, for many points in one call from python
+			static Mat<dbl> EvalBatch1(SystemBaseT const& self, Mat<dbl> const& points)
+			{
+				Mat<dbl> values;
+				self.EvalBatch(points, values);
+				return values;
+			}
+
+			static Mat<dbl> EvalBatch2(SystemBaseT const& self, Mat<dbl> const& points, dbl const& time)
+			{
+				Mat<dbl> values;
+				self.EvalBatch(points, time, values);
+				return values;
+			}
+
+			static list JacobianBatch1(SystemBaseT const& self, Mat<dbl> const& points)
+			{
+				std::vector<Mat<dbl>> jacobians;
+				self.JacobianBatch(points, jacobians);
+				return ToList(jacobians);
+			}
+
+			static list JacobianBatch2(SystemBaseT const& self, Mat<dbl> const& points, dbl const& time)
+			{
+				std::vector<Mat<dbl>> jacobians;
+				self.JacobianBatch(points, time, jacobians);
+				return ToList(jacobians);
+			}
+
+			static list ToList(std::vector<Mat<dbl>> const& matrices)
+			{
+				list l;
+				for (auto const& m : matrices)
+					l.append(m);
+				return l;
+			}
+
 		};
 		
 		
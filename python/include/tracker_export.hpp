@@ -38,6 +38,10 @@
 #include "python_common.hpp"
 
 #include <bertini2/tracking/tracker.hpp>
+#include <bertini2/tracking/async_solve.hpp>
+#include <bertini2/detail/work_stealing.hpp>
+#include <bertini2/tracking/step_trace.hpp>
+#include <bertini2/tracking/observers.hpp>
 
 namespace bertini{
 	namespace python{
@@ -45,6 +49,19 @@ namespace bertini{
 
 		using namespace bertini::tracking;
 
+		/**
+		 Copy the settings for precision from one tracker to another, for the trackers which have them.
+		 */
+		template<typename TrackerT>
+		void CopyPrecisionSettings(TrackerT & to, TrackerT const& from)
+		{}
+
+		inline
+		void CopyPrecisionSettings(AMPTracker & to, AMPTracker const& from)
+		{
+			to.PrecisionSetup(from.PrecisionSettings());
+		}
+
 		/**
 		 Abstract Tracker class
 		 */
@@ -66,7 +83,87 @@ namespace bertini{
 			// resolve overloads for getting and setting predictor method.
 			void (TrackerT::*set_predictor_)(config::Predictor)= &TrackerT::Predictor;
 			config::Predictor (TrackerT::*get_predictor_)(void) const = &TrackerT::Predictor;
-			
+
+
+			// the observer is kept alive by the tracker, see with_custodian_and_ward in visit.
+			template<typename ObserverT>
+			static void AddObserver(TrackerT & self, ObserverT & observer)
+			{
+				self.AddObserver(&observer);
+			}
+
+			static dict TimeBreakdownDict(TrackerT const& self)
+			{
+				dict seconds;
+				for (unsigned ii = 0; ii < TimeBreakdown::NumKinds; ++ii)
+					seconds[static_cast<TimedWork>(ii)] = self.SecondsIn(static_cast<TimedWork>(ii));
+				return seconds;
+			}
+
+
+			// runs without the GIL, so python threads each with their own tracker and system track in parallel.
+			static SuccessCode TrackPath(TrackerT const& self, Vec<CT> & solution_at_endtime, CT const& start_time, CT const& end_time, Vec<CT> const& start_point)
+			{
+				ReleaseGIL release;
+				return self.TrackPath(solution_at_endtime, start_time, end_time, start_point);
+			}
+
+
+			/**
+			 Track many paths over native threads, each with a copy of the tracked system and a tracker with the settings of this one.  Returns the endpoints, one column per path, and the list of success codes.
+			 */
+			static tuple TrackPaths(TrackerT const& self, Mat<CT> const& start_points, CT const& start_time, CT const& end_time, unsigned num_threads)
+			{
+				struct Worker
+				{
+					System system;
+					std::unique_ptr<TrackerT> tracker;
+				};
+
+				num_threads = std::max(num_threads, 1u);
+
+				// made while holding the GIL, on this thread, since cloning reads the shared system.
+				std::vector<std::unique_ptr<Worker>> workers;
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+				{
+					std::unique_ptr<Worker> w(new Worker);
+					w->system = Clone(self.GetSystem());
+					w->tracker.reset(new TrackerT(w->system));
+					w->tracker->Setup(self.Predictor(), self.TrackingTolerance(), self.PathTruncationThreshold(), self.SteppingSettings(), self.NewtonSettings());
+					CopyPrecisionSettings(*w->tracker, self);
+					workers.push_back(std::move(w));
+				}
+
+				const auto num_paths = start_points.cols();
+				Mat<CT> endpoints = Mat<CT>::Zero(self.GetSystem().NumVariables(), num_paths);
+				std::vector<SuccessCode> codes(num_paths, SuccessCode::Failure);
+				const auto precision = DefaultPrecision();
+
+				{
+					ReleaseGIL release;
+
+					detail::WorkStealingQueues<Eigen::Index> queues(num_threads);
+					for (Eigen::Index ii = 0; ii < num_paths; ++ii)
+						queues.Push(ii % num_threads, ii);
+
+					detail::RunWorkStealing<Eigen::Index>(queues, [&](unsigned worker, Eigen::Index const& path)
+						{
+							DefaultPrecision(precision);
+							Worker& w = *workers[worker];
+							w.system.precision(precision);
+
+							Vec<CT> endpoint;
+							codes[path] = w.tracker->TrackPath(endpoint, start_time, end_time, start_points.col(path));
+							if (codes[path]==SuccessCode::Success)
+								endpoints.col(path) = endpoint;
+						});
+				}
+
+				list success_codes;
+				for (auto c : codes)
+					success_codes.append(c);
+				return make_tuple(endpoints, success_codes);
+			}
 
 
 
@@ -231,6 +328,18 @@ namespace bertini{
 		
 		void ExportConfigSettings();
 
+		void ExportStepTrace();
+
+		/**
+		 Export the native observers for a type of tracker, whose data is fetched as arrays or dicts once tracking is done, so that python need not run at each event.  Their names begin with the prefix.
+		 */
+		template<typename TrackerT>
+		void ExportObservers(std::string const& prefix);
+
+		void ExportAsyncSolve();
+
+		void ExportBatchSolve();
+
 }}// re: namespaces
 
 
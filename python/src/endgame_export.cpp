@@ -56,7 +56,7 @@ namespace bertini{
 			.def("get_system",  &EndgameT::GetSystem,  return_internal_reference<>(),"Get the tracked system")
 
 			.def("final_approximation", &EndgameT::template FinalApproximation<BCT>, return_internal_reference<>(),"Get the current approximation of the root")
-			.def("run", &EndgameT::template Run<BCT>,"Run the endgame, from start point and start time, to t=0")
+			.def("run", &EndgameVisitor::Run,"Run the endgame, from start point and start time, to t=0.  Releases the GIL while running, so endgames with their own trackers and systems may run in parallel from python threads.")
 			;
 		}
 
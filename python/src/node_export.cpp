@@ -103,9 +103,9 @@ namespace bertini{
 			.def("is_polynomial", IsPoly2 )
 
 			.def("evald", &Eval0<dbl> )
-			.def("evald", return_Eval1_ptr<dbl>() )
+			.def("evald", &Eval1<dbl> )
 			.def("evalmp", &Eval0<mpfr> )
-			.def("evalmp", return_Eval1_ptr<mpfr>() )
+			.def("evalmp", &Eval1<mpfr> )
 			
 			.def(self_ns::str(self_ns::self))
 			.def(self_ns::repr(self_ns::self))
@@ -0,0 +1,149 @@
+//This file is part of Bertini 2.
+//
+//python/numpy_export.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/numpy_export.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/numpy_export.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//  daniel brake
+//  university of notre dame
+//
+//
+//  python/numpy_export.cpp:  Source file for passing double precision Eigen vectors and matrices to and from NumPy.
+
+#include "numpy_export.hpp"
+
+#include <cstring>
+
+
+namespace bertini{
+	namespace python{
+
+		namespace {
+
+			/**
+			 Whether a buffer format is that of one complex double, with any native or little/big-endian prefix matching this machine.
+			 */
+			bool IsComplexDoubleFormat(const char* format)
+			{
+				if (!format)
+					return false;
+				if (*format=='@' || *format=='=' || *format=='<' || *format=='>' || *format=='!')
+					++format;
+				return std::strcmp(format, "Zd")==0;
+			}
+
+
+			/**
+			 A buffer view of a Python object, released when it goes out of scope.
+			 */
+			class BufferView
+			{
+			public:
+				explicit BufferView(PyObject* obj)
+				{
+					if (!PyObject_CheckBuffer(obj))
+						return;
+					if (PyObject_GetBuffer(obj, &view_, PyBUF_STRIDED_RO | PyBUF_FORMAT)!=0)
+					{
+						PyErr_Clear();
+						return;
+					}
+					acquired_ = true;
+				}
+
+				~BufferView()
+				{
+					if (acquired_)
+						PyBuffer_Release(&view_);
+				}
+
+				BufferView(BufferView const&) = delete;
+				BufferView& operator=(BufferView const&) = delete;
+
+				bool IsComplexDouble(int ndim) const
+				{
+					return acquired_ && view_.ndim==ndim && view_.itemsize==sizeof(dbl) && IsComplexDoubleFormat(view_.format);
+				}
+
+				Py_buffer const& View() const
+				{
+					return view_;
+				}
+
+			private:
+				Py_buffer view_;
+				bool acquired_ = false;
+			};
+
+
+			/**
+			 Converts a 1-D buffer of complex doubles to an Eigen vector, or a 2-D one to an Eigen matrix.
+			 */
+			template<typename EigenT>
+			struct EigenFromBuffer
+			{
+				static constexpr int NumDims = EigenT::ColsAtCompileTime==1 ? 1 : 2;
+
+				EigenFromBuffer()
+				{
+					converter::registry::push_back(&convertible, &construct, type_id<EigenT>());
+				}
+
+				static void* convertible(PyObject* obj)
+				{
+					BufferView b(obj);
+					return b.IsComplexDouble(NumDims) ? obj : nullptr;
+				}
+
+				static void construct(PyObject* obj, converter::rvalue_from_python_stage1_data* data)
+				{
+					BufferView b(obj);
+					auto const& view = b.View();
+
+					void* storage = ((converter::rvalue_from_python_storage<EigenT>*)data)->storage.bytes;
+
+					const Eigen::Index rows = view.shape[0];
+					const Eigen::Index cols = NumDims==1 ? 1 : view.shape[1];
+					EigenT* result = new (storage) EigenT(rows, cols);
+
+					// strides are in bytes, and may be any multiple of the item size, or negative.
+					const char* base = static_cast<const char*>(view.buf);
+					for (Eigen::Index jj = 0; jj < cols; ++jj)
+					{
+						const char* column = base + (NumDims==1 ? 0 : jj*view.strides[1]);
+						for (Eigen::Index ii = 0; ii < rows; ++ii)
+							std::memcpy(result->data() + ii + jj*rows, column + ii*view.strides[0], sizeof(dbl));
+					}
+
+					data->convertible = storage;
+				}
+			};
+
+		} // re: namespace
+
+
+		void ExportNumpyConverters()
+		{
+			EigenFromBuffer<Eigen::Matrix<dbl,Eigen::Dynamic,1>>();
+			EigenFromBuffer<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>();
+		}
+
+	}
+}
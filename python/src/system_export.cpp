@@ -56,6 +56,7 @@ namespace bertini{
 			.def("precision", get_prec_)
 			.def("precision", set_prec_)
 			.def("differentiate", &SystemBaseT::Differentiate)
+			.def("clone", &SystemVisitor::Clone, "Make a deep copy of the system, sharing no nodes with it, as each thread tracking with its own tracker needs.")
 
 			.def("eval", return_Eval0_ptr<dbl>() ,"evaluate the system in double precision, using already-set variable values.")
 			.def("eval", return_Eval0_ptr<mpfr>() ,"evaluate the system in multiple precision, using already-set variable values.")
@@ -71,6 +72,11 @@ namespace bertini{
 			.def("jacobian", return_Jac2_ptr<dbl>() , "evaluate the jacobian of the system, using time and space values passed into this function")
 			.def("jacobian", return_Jac2_ptr<mpfr>() , "evaluate the jacobian of the system, using time and space values passed into this function")
 
+			.def("eval_batch", &SystemVisitor::EvalBatch1, "evaluate the system in double precision at many points at once.  pass a 2-D complex128 numpy array with one column per point, and get a MatrixXd with one column of function values per point.  numpy.asarray of it does not copy.")
+			.def("eval_batch", &SystemVisitor::EvalBatch2, "evaluate the system in double precision at many points at once, at a time value passed into this function.  points are columns, as for the other eval_batch.")
+			.def("jacobian_batch", &SystemVisitor::JacobianBatch1, "evaluate the jacobian of the system in double precision at many points at once.  pass a 2-D complex128 numpy array with one column per point, and get a list of MatrixXd, one per point.")
+			.def("jacobian_batch", &SystemVisitor::JacobianBatch2, "evaluate the jacobian of the system in double precision at many points at once, at a time value passed into this function.  points are columns, as for the other jacobian_batch.")
+
 			.def("homogenize", &SystemBaseT::Homogenize)
 			.def("is_homogeneous", &SystemBaseT::IsHomogeneous)
 			.def("is_polynomial", &SystemBaseT::IsPolynomial)
@@ -168,6 +174,7 @@ namespace bertini{
 			// System class
 			class_<System, std::shared_ptr<System> >("System", init<>())
 			.def(SystemVisitor<System>())
+			.def_pickle(BinaryPickleSuite<System>()) // for sending to other processes.  Start systems are not pickled; make them there.
 			;
 			
 			// StartSystem class
@@ -181,6 +188,19 @@ namespace bertini{
 			.def("random_values", &start_system::TotalDegree::RandomValues, return_value_policy<copy_const_reference>())
 			;
 
+			// LinearProduct class
+			class_<start_system::LinearProduct, bases<start_system::StartSystem>, std::shared_ptr<start_system::LinearProduct> >("LinearProduct", init<System const&>())
+			;
+
+			// MHomogeneous class
+			class_<start_system::MHomogeneous, bases<start_system::LinearProduct>, std::shared_ptr<start_system::MHomogeneous> >("MHomogeneous", init<System const&>())
+			;
+
+			// Polyhedral class
+			class_<start_system::Polyhedral, bases<start_system::StartSystem>, std::shared_ptr<start_system::Polyhedral> >("Polyhedral", init<System const&, optional<unsigned> >())
+			.def("mixed_volume", &start_system::Polyhedral::MixedVolume)
+			;
+
 			
 		}
 
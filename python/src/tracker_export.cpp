@@ -30,6 +30,10 @@
 
 #include "tracker_export.hpp"
 
+#include <cstddef>
+#include <limits>
+#include <thread>
+
 namespace bertini{
 	namespace python{
 
@@ -39,14 +43,22 @@ namespace bertini{
 		{
 			cl
 			.def("setup", &TrackerT::Setup)
-			.def("track_path", &TrackerT::TrackPath)
+			.def("track_path", &TrackerVisitor::TrackPath, "Track a path from a start point at a start time, to an end time.  Releases the GIL while tracking, so trackers with their own systems may track in parallel from python threads.")
+			.def("track_paths", &TrackerVisitor::TrackPaths, "Track many paths in parallel, over native threads.  Pass a matrix of start points, one column per path, the start and end times, and the number of threads.  Returns the matrix of endpoints and the list of success codes.")
 			.def("get_system",&TrackerT::GetSystem,return_internal_reference<>())
 			.def("predictor",get_predictor_,"Query the current predictor method used by the tracker.")
 			.def("predictor",set_predictor_,"Set the predictor method used by the tracker.")
 			.def("set_stepsize", &TrackerT::SetStepSize)
 			.def("reinitialize_initial_step_size", &TrackerT::ReinitializeInitialStepSize)
 			.def("num_total_steps_taken", &TrackerT::NumTotalStepsTaken)
+			.def("enable_time_breakdown", &TrackerT::EnableTimeBreakdown, "Turn on or off timing the work of tracking, by kind.  Off by default.")
+			.def("time_breakdown_enabled", &TrackerT::TimeBreakdownEnabled)
+			.def("seconds_in", &TrackerT::SecondsIn, "The seconds spent at a kind of work, a TimedWork, while timing was on.")
+			.def("time_breakdown", &TrackerVisitor::TimeBreakdownDict, "The seconds spent at each kind of work while timing was on, as a dict keyed by TimedWork.")
+			.def("reset_time_breakdown", &TrackerT::ResetTimeBreakdown)
 			.def("tracking_tolerance", &TrackerT::TrackingTolerance)
+			.def("add_observer", &TrackerVisitor::AddObserver<PathStatsObserver<TrackerT>>, with_custodian_and_ward<1,2>(), "Attach a native observer, kept alive as long as the tracker.")
+			.def("add_observer", &TrackerVisitor::AddObserver<StepRecorder<TrackerT>>, with_custodian_and_ward<1,2>())
 			;
 		}
 
@@ -114,6 +126,8 @@ namespace bertini{
 			.def_readwrite("min_num_steps", &Stepping<T>::min_num_steps)
 			.def_readwrite("max_num_steps", &Stepping<T>::max_num_steps)
 			.def_readwrite("frequency_of_CN_estimation", &Stepping<T>::frequency_of_CN_estimation)
+			.def_readwrite("step_size_controller", &Stepping<T>::step_size_controller)
+			.def_readwrite("step_size_controller_safety", &Stepping<T>::step_size_controller_safety)
 			.def_readwrite("initial_step_size", &Stepping<T>::initial_step_size)
 			.def_readwrite("initial_step_size", &Stepping<T>::initial_step_size)
 			;
@@ -134,6 +148,12 @@ namespace bertini{
 			ExportConfigSettings();
 			ExportAMPTracker();
 			ExportFixedTrackers();
+			ExportStepTrace();
+			ExportObservers<AMPTracker>("AMP");
+			ExportObservers<DoublePrecisionTracker>("FixedDouble");
+			ExportObservers<MultiplePrecisionTracker>("FixedMultiple");
+			ExportAsyncSolve();
+			ExportBatchSolve();
 		}
 
 		void ExportAMPTracker()
@@ -169,6 +189,342 @@ namespace bertini{
 		
 		
 		
+		namespace {
+
+			/**
+			 Step records, as a NumPy structured array with a field for each member of step_trace::Record.
+			 */
+			object StepRecordArray(std::vector<step_trace::Record> const& records)
+			{
+				using step_trace::Record;
+
+				list names, formats, offsets;
+				auto field = [&](char const* name, char const* format, std::size_t offset)
+					{
+						names.append(name);
+						formats.append(format);
+						offsets.append(offset);
+					};
+				field("path", "u8", offsetof(Record, path));
+				field("time_real", "f8", offsetof(Record, time_real));
+				field("time_imag", "f8", offsetof(Record, time_imag));
+				field("stepsize", "f8", offsetof(Record, stepsize));
+				field("condition_number", "f8", offsetof(Record, condition_number));
+				field("norm_delta_z", "f8", offsetof(Record, norm_delta_z));
+				field("step", "u4", offsetof(Record, step));
+				field("precision", "u4", offsetof(Record, precision));
+				field("success", "i4", offsetof(Record, success));
+
+				dict spec;
+				spec["names"] = names;
+				spec["formats"] = formats;
+				spec["offsets"] = offsets;
+				spec["itemsize"] = sizeof(Record);
+
+				object numpy = import("numpy");
+				object data(handle<>(PyBytes_FromStringAndSize(reinterpret_cast<char const*>(records.data()), records.size()*sizeof(Record))));
+				return numpy.attr("frombuffer")(data, numpy.attr("dtype")(spec)).attr("copy")();
+			}
+
+			/**
+			 The records of a step trace file, as a NumPy structured array.
+			 */
+			object ReadStepTraceArray(std::string const& filename)
+			{
+				return StepRecordArray(ReadStepTrace(filename));
+			}
+
+			dict PathStatsDict(PathStats const& s)
+			{
+				dict d;
+				d["num_steps"] = s.num_steps;
+				d["num_failed_steps"] = s.num_failed_steps;
+				d["num_newton_iterations"] = s.num_newton_iterations;
+				d["num_jacobian_evaluations"] = s.num_jacobian_evaluations;
+				d["num_factorizations"] = s.num_factorizations;
+				d["num_precision_increases"] = s.num_precision_increases;
+				d["num_precision_decreases"] = s.num_precision_decreases;
+				d["num_avoided_precision_decreases"] = s.num_avoided_precision_decreases;
+				d["max_precision"] = s.max_precision;
+				d["seconds_double"] = s.seconds_double;
+				d["seconds_multiple"] = s.seconds_multiple;
+				return d;
+			}
+
+			template<typename TrackerT>
+			dict Stats(PathStatsObserver<TrackerT> const& self)
+			{
+				return PathStatsDict(self.Stats());
+			}
+
+			template<typename TrackerT>
+			dict TakeStats(PathStatsObserver<TrackerT> & self)
+			{
+				return PathStatsDict(self.Take());
+			}
+
+			template<typename TrackerT>
+			object Records(StepRecorder<TrackerT> const& self)
+			{
+				return StepRecordArray(self.Records());
+			}
+
+			template<typename TrackerT>
+			object TakeRecords(StepRecorder<TrackerT> & self)
+			{
+				return StepRecordArray(self.Take());
+			}
+
+			/**
+			 Pass python a NumPy array of records per batch, from the thread tracking, which takes the GIL to do so.  None goes back to keeping the records.
+			 */
+			template<typename TrackerT>
+			void SetBatchCallback(StepRecorder<TrackerT> & self, object callback, std::size_t batch_size, bool at_tracking_end)
+			{
+				if (callback.is_none())
+				{
+					self.SetBatchHandler(nullptr, batch_size, at_tracking_end);
+					return;
+				}
+
+				// released on whichever thread drops it last, which must hold the GIL to do so
+				std::shared_ptr<object> f(new object(callback), [](object* o){ AcquireGIL gil; delete o;});
+				self.SetBatchHandler([f](std::vector<step_trace::Record> && batch)
+					{
+						AcquireGIL gil;
+						try
+						{
+							(*f)(StepRecordArray(batch));
+						}
+						catch (error_already_set const&)
+						{
+							PyErr_Print();
+						}
+					}, batch_size, at_tracking_end);
+			}
+		}
+
+		template<typename TrackerT>
+		void ExportObservers(std::string const& prefix)
+		{
+			class_<PathStatsObserver<TrackerT>, boost::noncopyable>((prefix+"PathStatsObserver").c_str(), "Counts the work of the paths a tracker tracks, natively.  Attach with add_observer, and read the counts of each path with take after tracking it.", init<>())
+			.def("stats", &Stats<TrackerT>, "The counts since construction, or the last take, as a dict.")
+			.def("take", &TakeStats<TrackerT>, "The counts so far, as a dict, starting again from zero.")
+			;
+
+			class_<StepRecorder<TrackerT>, boost::noncopyable>((prefix+"StepRecorder").c_str(), "Records every step a tracker takes, natively, as the records of a step trace.  Attach with add_observer, and fetch the records after tracking, or have them passed to a callback in batches.", init<>())
+			.def("set_path", &StepRecorder<TrackerT>::SetPath, "Set the path the following steps belong to.")
+			.def("records", &Records<TrackerT>, "The records kept so far, as a NumPy structured array, as read_step_trace returns.")
+			.def("take", &TakeRecords<TrackerT>, "The records kept so far, starting again with none.")
+			.def("set_batch_callback", &SetBatchCallback<TrackerT>, (arg("callback"), arg("batch_size")=4096, arg("at_tracking_end")=true), "Pass the records to a callable in NumPy arrays of batch_size records, and those left at the end of each call to track_path if at_tracking_end, rather than keeping them.  Called from the thread tracking, holding the GIL.  Pass None to keep them again.")
+			.def("flush", &StepRecorder<TrackerT>::Flush, "Pass the records kept to the callback now.")
+			;
+		}
+
+		void ExportStepTrace()
+		{
+			def("read_step_trace", &ReadStepTraceArray, "Read a binary step trace file, as written by a StepTraceFile, into a NumPy structured array with one element per step, and fields path, time_real, time_imag, stepsize, condition_number, norm_delta_z, step, precision, and success.  Select the steps of one path with a[a['path']==p].  The success field holds the integer values of SuccessCode.");
+		}
+
+
+
+		namespace {
+
+			using AsyncHandle = SolveHandle<AMPTracker>;
+			using AsyncResult = AsyncHandle::PathResult;
+
+			/**
+			 A path's result as a dict, with keys path, success, solution and cycle_number.  Needs the GIL.
+			 */
+			dict PathResultDict(AsyncResult const& r)
+			{
+				dict d;
+				d["path"] = r.path;
+				d["success"] = r.success;
+				d["solution"] = r.solution;
+				d["cycle_number"] = r.cycle_number;
+				return d;
+			}
+
+			list PathResultList(std::vector<AsyncResult> const& results)
+			{
+				list l;
+				for (auto const& r : results)
+					l.append(PathResultDict(r));
+				return l;
+			}
+
+			list ResultsSoFar(AsyncHandle const& self)
+			{
+				return PathResultList(self.ResultsSoFar());
+			}
+
+			// waits without the GIL, so the callback may run meanwhile.
+			list Get(AsyncHandle const& self)
+			{
+				{
+					ReleaseGIL release;
+					self.Future().wait();
+				}
+				return PathResultList(self.Get());
+			}
+
+			/**
+			 Solve a system in the background with the settings of an adaptive precision tracker, calling back into python with each result if given a callable.
+			 */
+			AsyncHandle SolveAsyncAMP(System const& target, AMPTracker const& tracker, unsigned num_threads, object on_result)
+			{
+				AsyncSolveSettings<AMPTracker> settings;
+				settings.num_threads = num_threads;
+
+				auto predictor = tracker.Predictor();
+				auto tolerance = tracker.TrackingTolerance();
+				auto truncation = tracker.PathTruncationThreshold();
+				auto stepping = tracker.SteppingSettings();
+				auto newton = tracker.NewtonSettings();
+				auto precision = tracker.PrecisionSettings();
+				settings.tracker_setup = [=](AMPTracker & t)
+					{
+						t.Setup(predictor, tolerance, truncation, stepping, newton);
+						t.PrecisionSetup(precision);
+					};
+
+				if (!on_result.is_none())
+				{
+					// released on whichever thread drops it last, which must hold the GIL to do so
+					std::shared_ptr<object> callback(new object(on_result), [](object* o){ AcquireGIL gil; delete o;});
+					settings.on_result = [callback](AsyncResult const& r)
+						{
+							AcquireGIL gil;
+							try
+							{
+								object keep_going = (*callback)(PathResultDict(r));
+								return keep_going.is_none() || extract<bool>(keep_going)();
+							}
+							catch (error_already_set const&)
+							{
+								PyErr_Print();
+								return false;
+							}
+						};
+				}
+
+				return SolveAsync(target, settings);
+			}
+		}
+
+		void ExportAsyncSolve()
+		{
+			class_<AsyncHandle>("AsyncSolveHandle", no_init)
+			.def("done", &AsyncHandle::Done, "Whether the solve is done.")
+			.def("cancel", &AsyncHandle::Cancel, "Stop the solve soon.  Paths stopped have success code ExternallyTerminated.")
+			.def("num_finished", &AsyncHandle::NumFinished, "The number of paths finished so far.")
+			.def("results_so_far", &ResultsSoFar, "The results of the paths finished so far, in the order they finished, as dicts with keys path, success, solution and cycle_number.")
+			.def("get", &Get, "Wait for the solve, without holding the GIL, and get the results of all the paths, by index of start point.  Raises what the solve raised.")
+			;
+
+			def("solve_async", &SolveAsyncAMP, (arg("system"), arg("tracker"), arg("num_threads")=1, arg("on_result")=object()),
+				"Solve a system by a total degree homotopy in the background, on a pool of threads shared by the process, returning an AsyncSolveHandle at once.  The system is copied, and tracked with the settings of the adaptive precision tracker given.  If on_result is given, it is called with each path's result as it finishes, from a thread of the pool, and returning False cancels the solve, say once there are enough real solutions.");
+		}
+
+
+
+		namespace {
+
+			/**
+			 A one dimensional NumPy array copied from a vector.
+			 */
+			template<typename T>
+			object NumpyArray(std::vector<T> const& v, char const* dtype)
+			{
+				object numpy = import("numpy");
+				object data(handle<>(PyBytes_FromStringAndSize(reinterpret_cast<char const*>(v.data()), v.size()*sizeof(T))));
+				return numpy.attr("frombuffer")(data, numpy.attr("dtype")(dtype)).attr("copy")();
+			}
+
+			/**
+			 Track every path of the homotopy from a start system to a target, with the settings of a tracker, in C++ over native threads, without the GIL.  The results are columns, one entry per path.
+			 */
+			template<typename TrackerT>
+			dict BatchSolve(System const& target, start_system::StartSystem const& start, TrackerT const& tracker, unsigned num_threads, bool high_precision)
+			{
+				using Solver = ParallelSolver<TrackerT>;
+				using CT = typename TrackerTraits<TrackerT>::BaseComplexType;
+
+				// made while holding the GIL, since making the homotopy reads the systems.  The tracker outlives the solver, which copies its settings into each thread's tracker.
+				Solver solver(target, start, [&tracker](TrackerT & t)
+					{
+						t.Setup(tracker.Predictor(), tracker.TrackingTolerance(), tracker.PathTruncationThreshold(), tracker.SteppingSettings(), tracker.NewtonSettings());
+						CopyPrecisionSettings(t, tracker);
+					}, std::max(num_threads, 1u));
+
+				{
+					ReleaseGIL release;
+					solver.Solve();
+				}
+
+				auto const& results = solver.Results();
+				const auto num_paths = results.size();
+				const auto num_variables = target.NumNaturalVariables();
+
+				std::vector<dbl> endpoints(num_paths*num_variables, dbl(std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()));
+				std::vector<int> success(num_paths);
+				std::vector<unsigned> cycle_number(num_paths), max_precision(num_paths), num_retries(num_paths);
+				std::vector<double> condition_number(num_paths), seconds(num_paths);
+				std::vector<unsigned long long> num_steps(num_paths), num_failed_steps(num_paths), num_newton_iterations(num_paths), num_jacobian_evaluations(num_paths), num_factorizations(num_paths);
+				list endpoints_mp;
+
+				for (size_t ii = 0; ii < num_paths; ++ii)
+				{
+					auto const& r = results[ii];
+					if (static_cast<size_t>(r.solution.size())==num_variables)
+						for (size_t jj = 0; jj < num_variables; ++jj)
+							endpoints[ii*num_variables+jj] = dbl(static_cast<double>(real(r.solution(jj))), static_cast<double>(imag(r.solution(jj))));
+					success[ii] = static_cast<int>(r.success);
+					cycle_number[ii] = r.cycle_number;
+					condition_number[ii] = r.condition_number;
+					seconds[ii] = r.seconds;
+					num_retries[ii] = r.num_retries;
+					num_steps[ii] = r.stats.num_steps;
+					num_failed_steps[ii] = r.stats.num_failed_steps;
+					num_newton_iterations[ii] = r.stats.num_newton_iterations;
+					num_jacobian_evaluations[ii] = r.stats.num_jacobian_evaluations;
+					num_factorizations[ii] = r.stats.num_factorizations;
+					max_precision[ii] = r.stats.max_precision;
+					if (high_precision)
+						endpoints_mp.append(Vec<CT>(r.solution));
+				}
+
+				dict columns;
+				columns["endpoints"] = NumpyArray(endpoints, "c16").attr("reshape")(num_paths, num_variables);
+				columns["success"] = NumpyArray(success, "i4");
+				columns["cycle_number"] = NumpyArray(cycle_number, "u4");
+				columns["condition_number"] = NumpyArray(condition_number, "f8");
+				columns["seconds"] = NumpyArray(seconds, "f8");
+				columns["num_retries"] = NumpyArray(num_retries, "u4");
+				columns["num_steps"] = NumpyArray(num_steps, "u8");
+				columns["num_failed_steps"] = NumpyArray(num_failed_steps, "u8");
+				columns["num_newton_iterations"] = NumpyArray(num_newton_iterations, "u8");
+				columns["num_jacobian_evaluations"] = NumpyArray(num_jacobian_evaluations, "u8");
+				columns["num_factorizations"] = NumpyArray(num_factorizations, "u8");
+				columns["max_precision"] = NumpyArray(max_precision, "u4");
+				if (high_precision)
+					columns["endpoints_mp"] = endpoints_mp;
+				return columns;
+			}
+		}
+
+		void ExportBatchSolve()
+		{
+			char const* doc = "Track every path from a start system to a target system, homogenized and patched alike, with the settings of the tracker given, over native threads and without the GIL, returning a dict of columns with one entry per path: endpoints, a complex NumPy array of the dehomogenized endpoints in double precision, one row per path, NaN where the path failed; success, the integer values of SuccessCode; cycle_number; condition_number; seconds; num_retries; the counts num_steps, num_failed_steps, num_newton_iterations, num_jacobian_evaluations and num_factorizations; and max_precision.  With high_precision, also endpoints_mp, a list of the endpoints at the precision they were computed in.";
+
+			def("solve", &BatchSolve<AMPTracker>, (arg("system"), arg("start_system"), arg("tracker"), arg("threads")=std::thread::hardware_concurrency(), arg("high_precision")=false), doc);
+			def("solve", &BatchSolve<DoublePrecisionTracker>, (arg("system"), arg("start_system"), arg("tracker"), arg("threads")=std::thread::hardware_concurrency(), arg("high_precision")=false), doc);
+			def("solve", &BatchSolve<MultiplePrecisionTracker>, (arg("system"), arg("start_system"), arg("tracker"), arg("threads")=std::thread::hardware_concurrency(), arg("high_precision")=false), doc);
+		}
+
+
+
 		void ExportConfigSettings()
 		{
 			using namespace bertini::tracking::config;
@@ -184,6 +540,12 @@ namespace bertini{
 				.value("RKCashKarp45", Predictor::RKCashKarp45)
 				.value("RKDormandPrince56", Predictor::RKDormandPrince56)
 				.value("RKVerner67", Predictor::RKVerner67)
+				.value("Pade", Predictor::Pade)
+				;
+
+			enum_<StepSizeController>("StepSizeController")
+				.value("Factors", StepSizeController::Factors)
+				.value("PI", StepSizeController::PI)
 				;
 
 			enum_<SuccessCode>("SuccessCode")
@@ -204,6 +566,15 @@ namespace bertini{
 				.value("SecurityMaxNormReached", SuccessCode::SecurityMaxNormReached)
 				.value("CycleNumTooHigh", SuccessCode::CycleNumTooHigh)
 				;
+
+			enum_<TimedWork>("TimedWork")
+				.value("FunctionEvaluation", TimedWork::FunctionEvaluation)
+				.value("JacobianEvaluation", TimedWork::JacobianEvaluation)
+				.value("LinearAlgebra", TimedWork::LinearAlgebra)
+				.value("AMPCriteria", TimedWork::AMPCriteria)
+				.value("PrecisionChange", TimedWork::PrecisionChange)
+				.value("ObserverNotification", TimedWork::ObserverNotification)
+				;
 			
 			{ // enter a scope for config types
 				scope current_scope;
@@ -223,15 +594,18 @@ namespace bertini{
 
 				class_<Stepping<double>, std::shared_ptr<Stepping<double>> >("Stepping_d", init<>())
 					.def(SteppingVisitor<double>())
+					.def_pickle(BinaryPickleSuite<Stepping<double>>())
 					;
 				
 				class_<Stepping<mpfr_float>, std::shared_ptr<Stepping<mpfr_float>> >("Stepping_mp", init<>())
 					.def(SteppingVisitor<mpfr_float>())
+					.def_pickle(BinaryPickleSuite<Stepping<mpfr_float>>())
 					;
 				
 				class_<Newton, std::shared_ptr<Newton> >("Newton", init<>())
 					.def_readwrite("max_num_newton_iterations", &Newton::max_num_newton_iterations)
 					.def_readwrite("min_num_newton_iterations", &Newton::min_num_newton_iterations)
+					.def_pickle(BinaryPickleSuite<Newton>())
 					;
 				
 				
@@ -256,7 +630,10 @@ namespace bertini{
 					.def_readwrite("maximum_precision", &AdaptiveMultiplePrecisionConfig::maximum_precision)
 					.def_readwrite("consecutive_successful_steps_before_precision_decrease", &AdaptiveMultiplePrecisionConfig::consecutive_successful_steps_before_precision_decrease)
 					.def_readwrite("max_num_precision_decreases", &AdaptiveMultiplePrecisionConfig::max_num_precision_decreases)
+					.def_readwrite("adaptive_predictor", &AdaptiveMultiplePrecisionConfig::adaptive_predictor)
+					.def_readwrite("precision_change_cost", &AdaptiveMultiplePrecisionConfig::precision_change_cost)
 					.def_readwrite("coefficient_bound", &AdaptiveMultiplePrecisionConfig::coefficient_bound)
+					.def_pickle(BinaryPickleSuite<AdaptiveMultiplePrecisionConfig>())
 					;
 				
 				def("amp_config_from", &AMPConfigFrom, "make an AMPConfig from a System with generated settings for system-specific things, and default settings otherwise (such as safety digits).");
@@ -267,4 +644,3 @@ namespace bertini{
 
 
 }} // namespaces
-
@@ -28,6 +28,7 @@
 
 from pybertini import *
 import unittest
+import numpy as np
 import pdb
 
 
@@ -338,5 +339,39 @@ class MPFRComplex(unittest.TestCase):
 
 
 
+class MPFRArray(unittest.TestCase):
+    def setUp(self):
+        default_precision(30);
+        self.tol = mpfr_float("1e-27");
+        self.v = VectorXmp([mpfr_complex("-2.43",".21"), mpfr_complex("4.84", "-1.94")])
+        self.w = VectorXmp([mpfr_complex("-6.48", "-.731"), mpfr_complex("-.321", "-.72")])
+
+    def test_cwise(self):
+        v = self.v; w = self.w; tol = self.tol;
+        p = v.cwise_product(w)
+        q = p.cwise_quotient(w)
+        for ii in range(2):
+            self.assertLessEqual(abs(p[ii] - v[ii]*w[ii]), tol)
+            self.assertLessEqual(abs(q[ii] - v[ii]), tol)
+        a = v.cwise_abs()
+        self.assertLessEqual(abs(a[0] - mpfr_complex(abs(v[0]))), tol)
+        c = v.conjugate()
+        self.assertLessEqual(abs(c[1] - conj(v[1])), tol)
+
+    def test_precision(self):
+        v = self.v
+        self.assertEqual(v.precision(), 30)
+        v.precision(60)
+        self.assertEqual(v.precision(), 60)
+
+    def test_numpy_round_trip(self):
+        x = np.array([complex(1.5,-2), complex(0.25,3)], dtype=np.complex128)
+        v = VectorXmp.from_double(x)
+        self.assertEqual(v.precision(), 30)
+        y = np.asarray(v.to_double())
+        self.assertTrue(np.array_equal(x, y))
+
+
+
 if __name__ == '__main__':
     unittest.main();
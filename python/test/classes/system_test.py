@@ -35,6 +35,7 @@ from pybertini.function_tree.root import *
 from pybertini.function_tree import *
 import unittest
 import numpy as np
+import pickle
 import pdb
 
 
@@ -100,6 +101,37 @@ class SystemTest(unittest.TestCase):
 
 
 
+    def test_system_eval_numpy(self):
+        s = System();
+        s.add_ungrouped_variable(self.x);
+        s.add_ungrouped_variable(self.y);
+        s.add_ungrouped_variable(self.z);
+        s.add_function(self.f)
+        s.add_function(self.g)
+        #
+        points = np.array([[complex(3.5,2.89), complex(1,-1)],
+                           [complex(-9.32,.0765), complex(0.5,2)],
+                           [complex(5.4,-2.13), complex(-3,0.25)]], dtype=np.complex128);
+        #
+        e = np.asarray(s.eval(points[:,0]))
+        self.assertEqual(e.shape, (2,))
+        #
+        values = s.eval_batch(points)
+        v = np.asarray(values)
+        self.assertEqual(v.shape, (2,2))
+        jacobians = s.jacobian_batch(points)
+        self.assertEqual(len(jacobians), 2)
+        for ii in range(2):
+            single = np.asarray(s.eval(points[:,ii]))
+            self.assertTrue(np.max(np.abs(v[:,ii] - single)) < self.toldbl*np.max(np.abs(single)));
+            self.assertEqual(np.asarray(jacobians[ii]).shape, (2,3))
+        #
+        # the array is a view of the matrix, not a copy
+        values[0,0] = complex(-1,7)
+        self.assertEqual(v[0,0], complex(-1,7))
+
+
+
     def test_system_Jac(self):
         exact_real = ((-9.32, 3.5, 0), \
                       (-94.745870,3.8979,-13.5848))
@@ -206,6 +238,16 @@ class SystemTest(unittest.TestCase):
         self.assertLessEqual(np.abs(sysEval[1].imag / (-37.5584)-1), tol_d)
 
 
+    def test_system_pickle(self):
+        s = parse_system('function f1, f2; variable_group x,y,z; f1 = x*y; f2 = x^2*y - z*x;')
+        t = pickle.loads(pickle.dumps(s))
+        #
+        v = VectorXd((complex(3.5,2.89), complex(-9.32,.0765), complex(5.4,-2.13)));
+        e = s.eval(v); f = t.eval(v);
+        for ii in range(2):
+            self.assertEqual(e[ii], f[ii])
+
+
 
 if __name__ == '__main__':
     unittest.main();
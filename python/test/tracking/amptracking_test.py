@@ -38,6 +38,10 @@ from pybertini.tracking.config import *
 
 import unittest
 import numpy as np
+import os
+import pickle
+import struct
+import tempfile
 import pdb
 
 
@@ -128,6 +132,197 @@ class AMPTrackingTest(unittest.TestCase):
 
 
 
+    def test_tracker_time_breakdown(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y-t**2);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        tracker = AMPTracker(s);
+
+        stepping_pref = Stepping_mp();
+        newton_pref = Newton();
+
+        tracker.setup(Predictor.Euler, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_pref, newton_pref);
+        tracker.precision_setup(amp_config_from(s));
+
+        self.assertFalse(tracker.time_breakdown_enabled())
+        tracker.enable_time_breakdown(True)
+
+        y_end = VectorXmp();
+        tracker.track_path(y_end, mpfr_complex(1), mpfr_complex(-1), VectorXmp([mpfr_complex(1)]));
+
+        seconds = tracker.time_breakdown()
+        self.assertEqual(len(seconds), 6)
+        self.assertGreater(seconds[TimedWork.JacobianEvaluation], 0)
+        self.assertEqual(seconds[TimedWork.LinearAlgebra], tracker.seconds_in(TimedWork.LinearAlgebra))
+
+        tracker.reset_time_breakdown()
+        self.assertEqual(tracker.seconds_in(TimedWork.JacobianEvaluation), 0)
+
+
+
+    def test_native_observers(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y-t**2);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        tracker = AMPTracker(s);
+        tracker.setup(Predictor.Euler, mpfr_float("1e-5"), mpfr_float("1e5"), Stepping_mp(), Newton());
+        tracker.precision_setup(amp_config_from(s));
+
+        stats = AMPPathStatsObserver();
+        recorder = AMPStepRecorder();
+        batched = AMPStepRecorder();
+        tracker.add_observer(stats);
+        tracker.add_observer(recorder);
+        tracker.add_observer(batched);
+
+        batches = []
+        batched.set_batch_callback(lambda records: batches.append(len(records)), 4);
+
+        recorder.set_path(7);
+        y_end = VectorXmp();
+        tracker.track_path(y_end, mpfr_complex(1), mpfr_complex(-1), VectorXmp([mpfr_complex(1)]));
+
+        counts = stats.take()
+        records = recorder.take()
+        self.assertGreater(counts['num_steps'], 0)
+        self.assertEqual(len(records), counts['num_steps'])
+        self.assertTrue(np.all(records['path']==7))
+        self.assertEqual(sum(batches), counts['num_steps'])
+        self.assertTrue(all(b <= 4 for b in batches))
+        self.assertEqual(len(batched.records()), 0)
+        self.assertEqual(stats.stats()['num_steps'], 0)
+
+
+
+    def test_tracker_track_paths(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y**2-t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        tracker = AMPTracker(s);
+
+        stepping_pref = Stepping_mp();
+        newton_pref = Newton();
+
+        tracker.setup(Predictor.Euler, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_pref, newton_pref);
+        tracker.precision_setup(amp_config_from(s));
+
+        t_start = mpfr_complex(1)
+        t_end = mpfr_complex("0.5", "0")
+
+        starts = MatrixXmp([[mpfr_complex(1), mpfr_complex(-1)]]);
+
+        (ends, codes) = tracker.track_paths(starts, t_start, t_end, 2);
+
+        self.assertEqual(ends.cols(), 2)
+        self.assertEqual(len(codes), 2)
+        for ii in range(2):
+            self.assertEqual(codes[ii], SuccessCode.Success)
+            self.assertLessEqual(norm(ends[0,ii]*ends[0,ii]-t_end), mpfr_float("1e-5"))
+        self.assertGreater(norm(ends[0,0]-ends[0,1]), mpfr_float("1"))
+
+
+
+    def test_solve_async_stops_early(self):
+        default_precision(30);
+        x = self.x;  y = self.y;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(x); vars.append(y);
+        s.add_function(x*y+1);
+        s.add_function(x+y-1);
+        s.add_variable_group(vars);
+
+        tracker = AMPTracker(s);
+        tracker.setup(Predictor.RK4, mpfr_float("1e-6"), mpfr_float("1e5"), Stepping_mp(), Newton());
+        tracker.precision_setup(amp_config_from(s));
+
+        seen = []
+        def on_result(r):
+            seen.append(r['path'])
+            return r['success']!=SuccessCode.Success # one solution is enough
+
+        handle = solve_async(s, tracker, 1, on_result);
+        results = handle.get();
+
+        self.assertTrue(handle.done())
+        self.assertEqual(len(results), 2)
+        self.assertEqual(handle.num_finished(), len(seen))
+        codes = [r['success'] for r in results]
+        self.assertEqual(codes.count(SuccessCode.Success), 1)
+
+
+
+    def test_pickle_settings(self):
+        default_precision(30);
+        amp = AMPConfig();
+        amp.maximum_precision = 500;
+        amp.coefficient_bound = mpfr_float("12.5");
+        stepping = Stepping_mp();
+        stepping.max_step_size = mpfr_float("0.02");
+        newton = Newton();
+        newton.max_num_newton_iterations = 4;
+
+        amp2, stepping2, newton2 = pickle.loads(pickle.dumps((amp, stepping, newton)));
+
+        self.assertEqual(amp2.maximum_precision, 500)
+        self.assertEqual(amp2.coefficient_bound, mpfr_float("12.5"))
+        self.assertEqual(stepping2.max_step_size, mpfr_float("0.02"))
+        self.assertEqual(newton2.max_num_newton_iterations, 4)
+
+
+    def test_solve_columns(self):
+        default_precision(30);
+        x = self.x;  y = self.y;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(x); vars.append(y);
+        s.add_function(x*y+1);
+        s.add_function(x+y-1);
+        s.add_variable_group(vars);
+        s.homogenize();
+        s.auto_patch();
+
+        td = TotalDegree(s);
+        td.homogenize();
+
+        tracker = AMPTracker(s);
+        tracker.setup(Predictor.RK4, mpfr_float("1e-6"), mpfr_float("1e5"), Stepping_mp(), Newton());
+        tracker.precision_setup(amp_config_from(s));
+
+        columns = solve(s, td, tracker, 2, True);
+
+        self.assertEqual(columns['endpoints'].shape, (2,2))
+        self.assertTrue(np.all(columns['success']==int(SuccessCode.Success)))
+        self.assertTrue(np.all(columns['num_steps']>0))
+        self.assertEqual(len(columns['endpoints_mp']), 2)
+        golden = (1+np.sqrt(5))/2
+        self.assertLess(np.min(np.abs(columns['endpoints'][:,0]-golden)), 1e-5)
+
+
+
     def test_tracker_sqrt(self):
         default_precision(30);
         x = self.x;  y = self.y; t = self.t;
@@ -228,6 +423,30 @@ class AMPTrackingTest(unittest.TestCase):
         self.assertEqual(y_end.rows(), 0)
 
 
+    def test_read_step_trace(self):
+        # a header, two records, and part of a third, as left by a crash while writing.
+        header = struct.pack('=8sII', b'B2TRACE\0', 1, 64)
+        first = struct.pack('=Q5dIIiI', 7, 0.9, 0.0, 0.1, 12.5, 1e-9, 1, 16, int(SuccessCode.Success), 0)
+        second = struct.pack('=Q5dIIiI', 7, 0.9, 0.0, 0.05, 1e7, 1e-3, 2, 16, int(SuccessCode.HigherPrecisionNecessary), 0)
+
+        fd, name = tempfile.mkstemp(suffix='.b2trace')
+        with os.fdopen(fd, 'wb') as f:
+            f.write(header + first + second + second[:10])
+
+        try:
+            a = read_step_trace(name)
+        finally:
+            os.remove(name)
+
+        self.assertEqual(len(a), 2)
+        self.assertTrue(np.all(a['path'] == 7))
+        self.assertEqual(list(a['step']), [1, 2])
+        self.assertEqual(list(a['precision']), [16, 16])
+        self.assertEqual(a['success'][1], int(SuccessCode.HigherPrecisionNecessary))
+        self.assertAlmostEqual(a['condition_number'][1], 1e7)
+        self.assertAlmostEqual(a['stepsize'][0], 0.1)
+
+
 
 if __name__ == '__main__':
     unittest.main();